@@ -14,7 +14,6 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 #include "absl/container/node_hash_map.h"
 #include "absl/status/status.h"
@@ -22,23 +21,26 @@
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/decoder_base.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
 #include "iamf/obu/recon_gain_info_parameter_data.h"
+#include "iamf/obu/types.h"
 
 namespace iamf_tools {
 
 struct DecodedAudioFrame {
   uint32_t substream_id;
-  int32_t start_timestamp;  // Start time of this frame. Measured in ticks from
-                            // the Global Timing Module.
-  int32_t end_timestamp;  // End time of this frame. Measured in ticks from the
-                          // Global Timing Module.
+  // Start time of this frame. Measured in ticks from the Global Timing Module.
+  InternalTimestamp start_timestamp;
+  // End time of this frame. Measured in ticks from the Global Timing Module.
+  InternalTimestamp end_timestamp;
   uint32_t samples_to_trim_at_end;
   uint32_t samples_to_trim_at_start;
 
-  // Decoded samples. Includes any samples that will be trimmed in processing.
-  std::vector<std::vector<int32_t>> decoded_samples;
+  // Decoded samples arranged in (channel, time) axes. Includes any samples that
+  // will be trimmed in processing.
+  PlanarSampleBuffer<int32_t> decoded_samples;
 
   // Down-mixing parameters used to create this audio frame.
   DownMixingParams down_mixing_params;
@@ -15,12 +15,13 @@
 
 #include <cstdint>
 #include <optional>
-#include <vector>
 
 #include "iamf/cli/audio_element_with_data.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_frame.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
 #include "iamf/obu/recon_gain_info_parameter_data.h"
+#include "iamf/obu/types.h"
 
 namespace iamf_tools {
 
@@ -28,14 +29,16 @@ struct AudioFrameWithData {
   friend bool operator==(const AudioFrameWithData& lhs,
                          const AudioFrameWithData& rhs) = default;
   AudioFrameObu obu;
-  int32_t start_timestamp;  // Start time of this frame. Measured in ticks from
-                            // the Global Timing Module.
-  int32_t end_timestamp;  // End time of this frame. Measured in ticks from the
-                          // Global Timing Module.
-
-  // The PCM samples to encode this audio frame, if known. This is useful to
-  // calculate recon gain.
-  std::optional<std::vector<std::vector<int32_t>>> pcm_samples;
+  // Start time of this frame. Measured in ticks from the Global Timing Module.
+  InternalTimestamp start_timestamp;
+  // End time of this frame. Measured in ticks from the Global Timing Module.
+  InternalTimestamp end_timestamp;
+
+  // The PCM samples to encode this audio frame arranged in (channel, time)
+  // axes, if known. This is useful to calculate recon gain. `IamfEncoder`
+  // releases them once the temporal unit is demixed, so only the encoded audio
+  // is retained.
+  std::optional<PlanarSampleBuffer<int32_t>> pcm_samples;
 
   // Down-mixing parameters used to create this audio frame.
   DownMixingParams down_mixing_params;
@@ -35,6 +35,7 @@
 #include "iamf/cli/proto/parameter_data.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
@@ -266,8 +267,8 @@ GenerateParamIdToMetadataMap(
   return parameter_id_to_metadata;
 }
 
-absl::Status CompareTimestamps(int32_t expected_timestamp,
-                               int32_t actual_timestamp,
+absl::Status CompareTimestamps(InternalTimestamp expected_timestamp,
+                               InternalTimestamp actual_timestamp,
                                absl::string_view prompt) {
   if (expected_timestamp != actual_timestamp) {
     return absl::InvalidArgumentError(
@@ -278,7 +279,7 @@ absl::Status CompareTimestamps(int32_t expected_timestamp,
 }
 
 absl::Status WritePcmFrameToBuffer(
-    const std::vector<std::vector<int32_t>>& frame,
+    const PlanarSampleBuffer<int32_t>& frame,
     uint32_t samples_to_trim_at_start, uint32_t samples_to_trim_at_end,
     uint8_t bit_depth, bool big_endian, std::vector<uint8_t>& buffer) {
   if (bit_depth % 8 != 0) {
@@ -286,18 +287,18 @@ absl::Status WritePcmFrameToBuffer(
         "This function only supports an integer number of bytes.");
   }
   const size_t num_samples =
-      (frame.size() - samples_to_trim_at_start - samples_to_trim_at_end) *
-      frame[0].size();
+      (frame.num_ticks() - samples_to_trim_at_start - samples_to_trim_at_end) *
+      frame.num_channels();
 
   buffer.resize(num_samples * (bit_depth / 8));
 
-  // The input frame is arranged in (time, channel) axes. Interlace these in the
+  // The input frame is arranged in (channel, time) axes. Interlace these in the
   // output PCM and skip over any trimmed samples.
   int write_position = 0;
-  for (int t = samples_to_trim_at_start;
-       t < frame.size() - samples_to_trim_at_end; t++) {
-    for (int c = 0; c < frame[0].size(); ++c) {
-      const uint32_t sample = static_cast<uint32_t>(frame[t][c]);
+  for (size_t t = samples_to_trim_at_start;
+       t < frame.num_ticks() - samples_to_trim_at_end; t++) {
+    for (size_t c = 0; c < frame.num_channels(); ++c) {
+      const uint32_t sample = static_cast<uint32_t>(frame.Channel(c)[t]);
       RETURN_IF_NOT_OK(WritePcmSample(sample, bit_depth, big_endian,
                                       buffer.data(), write_position));
     }
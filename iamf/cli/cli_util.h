@@ -28,6 +28,7 @@
 #include "iamf/cli/proto/obu_header.pb.h"
 #include "iamf/cli/proto/param_definitions.pb.h"
 #include "iamf/cli/proto/parameter_data.pb.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
 #include "iamf/obu/mix_presentation.h"
@@ -121,13 +122,13 @@ GenerateParamIdToMetadataMap(
  * \return `absl::OkStatus()` if the timestamps are equal.
  *         `absl::InvalidArgumentError()` with a custom message otherwise.
  */
-absl::Status CompareTimestamps(int32_t expected_timestamp,
-                               int32_t actual_timestamp,
+absl::Status CompareTimestamps(InternalTimestamp expected_timestamp,
+                               InternalTimestamp actual_timestamp,
                                absl::string_view prompt = "");
 
 /*!\brief Writes interlaced PCM samples into the output buffer.
  *
- * \param frame Input frames arranged in (time, channel) axes.
+ * \param frame Input frames arranged in (channel, time) axes.
  * \param samples_to_trim_at_start Samples to trim at the beginning.
  * \param samples_to_trim_at_end Samples to trim at the end.
  * \param bit_depth Sample size in bits.
@@ -137,7 +138,7 @@ absl::Status CompareTimestamps(int32_t expected_timestamp,
  * \return `absl::OkStatus()` on success. A specific status on failure.
  */
 absl::Status WritePcmFrameToBuffer(
-    const std::vector<std::vector<int32_t>>& frame,
+    const PlanarSampleBuffer<int32_t>& frame,
     uint32_t samples_to_trim_at_start, uint32_t samples_to_trim_at_end,
     uint8_t bit_depth, bool big_endian, std::vector<uint8_t>& buffer);
 
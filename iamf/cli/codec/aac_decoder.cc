@@ -34,6 +34,7 @@
 #include "iamf/cli/codec/decoder_base.h"
 #include "iamf/cli/proto/codec_config.pb.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/aac_decoder_config.h"
@@ -171,7 +172,7 @@ absl::Status AacDecoder::Initialize() {
 
 absl::Status AacDecoder::DecodeAudioFrame(
     const std::vector<uint8_t>& encoded_frame) {
-  num_valid_ticks_ = 0;
+  RETURN_IF_NOT_OK(decoded_samples_.SetNumTicks(0));
 
   // Transform the data and feed it to the decoder.
   std::vector<UCHAR> input_data(encoded_frame.size());
@@ -198,16 +199,15 @@ absl::Status AacDecoder::DecodeAudioFrame(
                              /*flags=*/0),
       "Failed on `aacDecoder_DecodeFrame`: "));
 
-  // Arrange the interleaved data in (time, channel) axes with samples stored in
+  // Arrange the interleaved data in (channel, time) axes with samples stored in
   // the upper bytes of an `int32_t`.
   const absl::AnyInvocable<absl::Status(INT_PCM, int32_t&) const>
       kAacInternalTypeToInt32 = [](INT_PCM input, int32_t& output) {
         output = static_cast<int32_t>(input) << (32 - GetFdkAacBitDepth());
         return absl::OkStatus();
       };
-  return ConvertInterleavedToTimeChannel(absl::MakeConstSpan(output_pcm),
-                                         num_channels_, kAacInternalTypeToInt32,
-                                         decoded_samples_, num_valid_ticks_);
+  return ConvertInterleavedToPlanar(absl::MakeConstSpan(output_pcm),
+                                    kAacInternalTypeToInt32, decoded_samples_);
 }
 
 }  // namespace iamf_tools
@@ -11,6 +11,7 @@
  */
 #include "iamf/cli/codec/aac_encoder.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -26,6 +27,7 @@
 #include "iamf/cli/proto/codec_config.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "libAACenc/include/aacenc_lib.h"
 #include "libSYS/include/FDK_audio.h"
 #include "libSYS/include/machine_type.h"
@@ -198,10 +200,21 @@ absl::Status AacEncoder::InitializeEncoder() {
   return absl::OkStatus();
 }
 
+absl::Status AacEncoder::ResetEncoder() {
+  // Request a full reinitialization, which is performed by the next call to
+  // `aacEncEncode`. The handle and its buffers are reused.
+  RETURN_IF_NOT_OK(AacEncErrorToAbslStatus(
+      aacEncoder_SetParam(encoder_, AACENC_CONTROL_STATE, AACENC_INIT_ALL),
+      "Failed to request AAC encoder reset."));
+  return AacEncErrorToAbslStatus(
+      aacEncEncode(encoder_, nullptr, nullptr, nullptr, nullptr),
+      "Failed on call to `aacEncEncode`.");
+}
+
 AacEncoder::~AacEncoder() { aacEncClose(&encoder_); }
 
 absl::Status AacEncoder::EncodeAudioFrame(
-    int input_bit_depth, const std::vector<std::vector<int32_t>>& samples,
+    int input_bit_depth, const PlanarSampleBuffer<int32_t>& samples,
     std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data) {
   if (!encoder_) {
     LOG(ERROR) << "Expected `encoder_` to be initialized.";
@@ -227,14 +240,15 @@ absl::Status AacEncoder::EncodeAudioFrame(
   std::vector<INT_PCM> encoder_input_pcm(
       num_samples_per_channel * num_channels_, 0);
   int write_position = 0;
-  for (int t = 0; t < samples.size(); t++) {
-    for (int c = 0; c < samples[0].size(); ++c) {
+  for (size_t t = 0; t < samples.num_ticks(); t++) {
+    for (size_t c = 0; c < samples.num_channels(); ++c) {
       // Convert all frames to INT_PCM samples for input for `fdk_aac` (usually
       // 16-bit).
-      RETURN_IF_NOT_OK(WritePcmSample(
-          static_cast<uint32_t>(samples[t][c]), input_bit_depth, big_endian,
-          reinterpret_cast<uint8_t*>(encoder_input_pcm.data()),
-          write_position));
+      RETURN_IF_NOT_OK(
+          WritePcmSample(static_cast<uint32_t>(samples.Channel(c)[t]),
+                         input_bit_depth, big_endian,
+                         reinterpret_cast<uint8_t*>(encoder_input_pcm.data()),
+                         write_position));
     }
   }
 
@@ -14,7 +14,6 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 // This symbol conflicts with a macro in fdk_aac.
 #ifdef IS_LITTLE_ENDIAN
@@ -25,6 +24,7 @@
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/encoder_base.h"
 #include "iamf/cli/proto/codec_config.pb.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/aac_decoder_config.h"
 #include "libAACenc/include/aacenc_lib.h"
@@ -50,6 +50,12 @@ class AacEncoder : public EncoderBase {
    */
   absl::Status InitializeEncoder() override;
 
+  /*!\brief Reinitializes the `fdk_aac` encoder, keeping its configuration.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status ResetEncoder() override;
+
   /*!\brief Initializes `required_samples_to_delay_at_start_`.
    *
    * `InitializeEncoder` is required to be called before calling this function.
@@ -71,7 +77,7 @@ class AacEncoder : public EncoderBase {
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status EncodeAudioFrame(
-      int input_bit_depth, const std::vector<std::vector<int32_t>>& samples,
+      int input_bit_depth, const PlanarSampleBuffer<int32_t>& samples,
       std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data)
       override;
 
@@ -13,11 +13,11 @@
 #ifndef CLI_DECODER_BASE_H_
 #define CLI_DECODER_BASE_H_
 
-#include <cstddef>
 #include <cstdint>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "iamf/common/planar_sample_buffer.h"
 
 namespace iamf_tools {
 
@@ -36,9 +36,9 @@ class DecoderBase {
   DecoderBase(int num_channels, int num_samples_per_channel)
       : num_channels_(num_channels),
         num_samples_per_channel_(num_samples_per_channel),
-        decoded_samples_(num_samples_per_channel_,
-                         std::vector<int32_t>(num_channels)),
-        num_valid_ticks_(0) {}
+        decoded_samples_(num_channels, num_samples_per_channel) {
+    decoded_samples_.SetNumTicks(0).IgnoreError();
+  }
 
   /*!\brief Destructor.
    */
@@ -60,26 +60,23 @@ class DecoderBase {
 
   /*!\brief Outputs valid decoded samples.
    *
-   * \return Valid decoded samples.
+   * The samples are overwritten by the next call to `DecodeAudioFrame()`.
+   *
+   * \return Valid decoded samples arranged in (channel, time) axes.
    */
-  std::vector<std::vector<int32_t>> ValidDecodedSamples() const {
-    return {decoded_samples_.begin(),
-            decoded_samples_.begin() + num_valid_ticks_};
+  const PlanarSampleBuffer<int32_t>& ValidDecodedSamples() const {
+    return decoded_samples_;
   }
 
  protected:
   const int num_channels_;
   const int num_samples_per_channel_;
 
-  // Stores the output decoded frames arranged in (time, sample) axes. That
-  // is to say, each inner vector has one sample for per channel and the outer
-  // vector contains one inner vector for each time tick. When the decoded
-  // samples is shorter than a frame, only the first `num_valid_ticks_` ticks
-  // should be used.
-  std::vector<std::vector<int32_t>> decoded_samples_;
-
-  // Number of ticks (time samples) in `decoded_samples_` that are valid.
-  size_t num_valid_ticks_;
+  // Stores the output decoded frames arranged in (channel, time) axes. The
+  // buffer is sized for a full frame. When the decoded samples are shorter
+  // than a frame, only the first `decoded_samples_.num_ticks()` ticks are
+  // valid.
+  PlanarSampleBuffer<int32_t> decoded_samples_;
 };
 
 }  // namespace iamf_tools
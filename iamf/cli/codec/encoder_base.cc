@@ -12,12 +12,13 @@
 #include "iamf/cli/codec/encoder_base.h"
 
 #include <cstdint>
-#include <vector>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
 
 namespace iamf_tools {
 
@@ -32,20 +33,30 @@ absl::Status EncoderBase::Initialize(bool validate_codec_delay) {
   return absl::OkStatus();
 }
 
+absl::Status EncoderBase::Reset() {
+  // Reset the child class first; it may flush frames which are then dropped.
+  RETURN_IF_NOT_OK(ResetEncoder());
+
+  absl::MutexLock lock(&mutex_);
+  finalized_audio_frames_.clear();
+  finished_ = false;
+  return absl::OkStatus();
+}
+
 absl::Status EncoderBase::ValidateInputSamples(
-    const std::vector<std::vector<int32_t>>& samples) const {
-  if (samples.size() != num_samples_per_frame_) {
-    auto error_message = absl::StrCat("Found ", samples.size(),
+    const PlanarSampleBuffer<int32_t>& samples) const {
+  if (samples.num_ticks() != num_samples_per_frame_) {
+    auto error_message = absl::StrCat("Found ", samples.num_ticks(),
                                       " samples per channels. Expected ",
                                       num_samples_per_frame_, ".");
     return absl::InvalidArgumentError(error_message);
   }
-  if (samples.empty()) {
+  if (samples.num_ticks() == 0) {
     return absl::InvalidArgumentError("samples cannot be empty.");
   }
-  if (samples[0].size() != num_channels_) {
+  if (samples.num_channels() != num_channels_) {
     auto error_message =
-        absl::StrCat("Found ", samples[0].size(), " channels. Expected ",
+        absl::StrCat("Found ", samples.num_channels(), " channels. Expected ",
                      num_channels_, ".");
     return absl::InvalidArgumentError(error_message);
   }
@@ -16,12 +16,12 @@
 #include <cstdint>
 #include <list>
 #include <memory>
-#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
 #include "iamf/cli/audio_frame_with_data.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 
 namespace iamf_tools {
@@ -67,7 +67,7 @@ class EncoderBase {
   /*!\brief Encodes an audio frame.
    *
    * \param input_bit_depth Bit-depth of the input data.
-   * \param samples Samples arranged in (time x channel) axes. The samples are
+   * \param samples Samples arranged in (channel, time) axes. The samples are
    *        left-justified and stored in the upper `input_bit_depth` bits.
    * \param partial_audio_frame_with_data Unique pointer to take ownership of.
    *        The underlying `audio_frame_` is modified. All other fields are
@@ -76,7 +76,7 @@ class EncoderBase {
    *         the frame was finished. A specific status on failure.
    */
   virtual absl::Status EncodeAudioFrame(
-      int input_bit_depth, const std::vector<std::vector<int32_t>>& samples,
+      int input_bit_depth, const PlanarSampleBuffer<int32_t>& samples,
       std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data) = 0;
 
   /*!\brief Gets whether there are frames available.
@@ -117,6 +117,16 @@ class EncoderBase {
     return absl::OkStatus();
   }
 
+  /*!\brief Resets the encoder to encode a new substream.
+   *
+   * Keeps the configuration and the allocated codec state, so the encoder can
+   * be reused without calling `Initialize()` again. Any frames which were not
+   * popped are discarded. May be called before or after `Finalize()`.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status Reset();
+
   /*!\brief Gets whether the encoder has been closed.
    *
    * \return True if the encoder has been closed.
@@ -151,6 +161,12 @@ class EncoderBase {
    */
   virtual absl::Status InitializeEncoder() = 0;
 
+  /*!\brief Resets the child class to the state after `InitializeEncoder()`.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  virtual absl::Status ResetEncoder() = 0;
+
   /*!\brief Initializes `required_samples_to_delay_at_start_`.
    *
    * \param validate_codec_delay If true, validates the Codec Config OBU fields
@@ -180,7 +196,7 @@ class EncoderBase {
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status ValidateInputSamples(
-      const std::vector<std::vector<int32_t>>& samples) const;
+      const PlanarSampleBuffer<int32_t>& samples) const;
 
   uint32_t required_samples_to_delay_at_start_ = 0;
 
@@ -12,7 +12,6 @@
 
 #include "iamf/cli/codec/flac_decoder.h"
 
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -21,6 +20,8 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "iamf/cli/codec/decoder_base.h"
+#include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/flac_decoder_config.h"
 #include "include/FLAC/format.h"
@@ -63,22 +64,28 @@ FLAC__StreamDecoderWriteStatus FlacDecoder::LibFlacWriteCallback(
                << flac_decoder->GetNumSamplesPerChannel();
     return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
   }
-  std::vector<std::vector<int32_t>> decoded_samples(
-      num_samples_per_channel, std::vector<int32_t>(frame->header.channels));
+  auto& decoded_samples = flac_decoder->decoded_samples_;
+  if (frame->header.channels != decoded_samples.num_channels()) {
+    LOG(ERROR) << "Frame has " << frame->header.channels
+               << " channels, but the decoder expects "
+               << decoded_samples.num_channels();
+    return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+  }
+  if (!decoded_samples.SetNumTicks(num_samples_per_channel).ok()) {
+    return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+  }
   // Note: libFLAC represents data in a planar fashion, so each channel is
   // stored in a separate array, and the elements within those arrays represent
-  // time ticks. However, we store samples in an interleaved fashion, which
-  // means that each outer entry in decoded_samples represents a time tick, and
-  // each element within represents a channel. So we need to transpose the data
-  // from libFLAC's planar format into our interleaved format.
+  // time ticks. This matches the layout of `decoded_samples_`, so each channel
+  // is copied directly while left-justifying the samples.
   for (int c = 0; c < frame->header.channels; ++c) {
     const FLAC__int32* const channel_buffer = buffer[c];
+    const auto channel_samples = decoded_samples.Channel(c);
     for (int t = 0; t < num_samples_per_channel; ++t) {
-      decoded_samples[t][c] = channel_buffer[t]
-                              << (32 - frame->header.bits_per_sample);
+      channel_samples[t] = channel_buffer[t]
+                           << (32 - frame->header.bits_per_sample);
     }
   }
-  flac_decoder->SetDecodedFrame(decoded_samples);
   return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 }
 
@@ -146,7 +153,7 @@ absl::Status FlacDecoder::Finalize() {
 
 absl::Status FlacDecoder::DecodeAudioFrame(
     const std::vector<uint8_t>& encoded_frame) {
-  num_valid_ticks_ = 0;
+  RETURN_IF_NOT_OK(decoded_samples_.SetNumTicks(0));
 
   // Set the encoded frame to be decoded; the libflac decoder will copy the
   // data using LibFlacReadCallback.
@@ -155,11 +162,7 @@ absl::Status FlacDecoder::DecodeAudioFrame(
     // More specific error information is logged in LibFlacErrorCallback.
     return absl::InternalError("Failed to decode FLAC frame.");
   }
-  // Get the decoded frame, which will have been set by LibFlacWriteCallback.
-  // Copy the first `num_valid_ticks_` time samples to `decoded_samples_`.
-  num_valid_ticks_ = decoded_frame_.size();
-  std::copy(decoded_frame_.begin(), decoded_frame_.begin() + num_valid_ticks_,
-            decoded_samples_.begin());
+  // `LibFlacWriteCallback` wrote the decoded frame to `decoded_samples_`.
   return absl::OkStatus();
 }
 
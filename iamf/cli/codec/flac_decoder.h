@@ -117,7 +117,7 @@ class FlacDecoder : public DecoderBase {
   /*!\brief Writes a decoded flac frame to an instance of FlacDecoder.
    *
    * This callback function is used to write out a decoded frame from the
-   * libflac decoder.
+   * libflac decoder. The samples are available from `ValidDecodedSamples()`.
    *
    * \param decoder Unused libflac stream decoder. This parameter is not used in
    *        this implementation, but is included to override the libflac
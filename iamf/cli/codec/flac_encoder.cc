@@ -24,11 +24,11 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/synchronization/mutex.h"
-#include "absl/types/span.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/proto/codec_config.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/decoder_config/flac_decoder_config.h"
 #include "include/FLAC/format.h"
 #include "include/FLAC/ordinals.h"
@@ -148,7 +148,7 @@ FlacEncoder::~FlacEncoder() {
 }
 
 absl::Status FlacEncoder::EncodeAudioFrame(
-    int input_bit_depth, const std::vector<std::vector<int32_t>>& samples,
+    int input_bit_depth, const PlanarSampleBuffer<int32_t>& samples,
     std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data) {
   RETURN_IF_NOT_OK(ValidateNotFinalized());
   RETURN_IF_NOT_OK(ValidateInputSamples(samples));
@@ -181,9 +181,8 @@ absl::Status FlacEncoder::EncodeAudioFrame(
 
   // Convert input to the array that will be passed to `flac_encode`.
   std::vector<FLAC__int32> encoder_input_pcm;
-  RETURN_IF_NOT_OK(ConvertTimeChannelToInterleaved(
-      absl::MakeConstSpan(samples), kLeftJustifiedToRightJustified,
-      encoder_input_pcm));
+  RETURN_IF_NOT_OK(ConvertPlanarToInterleaved(
+      samples, kLeftJustifiedToRightJustified, encoder_input_pcm));
 
   LOG_FIRST_N(INFO, 1) << "Encoding " << encoder_input_pcm.size() * 4
                        << " bytes representing " << num_samples_per_channel
@@ -218,6 +217,24 @@ absl::Status FlacEncoder::InitializeEncoder() {
     return absl::UnknownError("Failed to initialize Flac encoder.");
   }
 
+  return InitializeStream();
+}
+
+absl::Status FlacEncoder::ResetEncoder() {
+  // Finishing a stream which was already finished is a no-op.
+  if (!FLAC__stream_encoder_finish(encoder_)) {
+    return absl::UnknownError("Failed to finish Flac stream.");
+  }
+  {
+    absl::MutexLock lock(&mutex_);
+    frame_index_to_frame_.clear();
+    next_frame_index_ = 0;
+  }
+
+  return InitializeStream();
+}
+
+absl::Status FlacEncoder::InitializeStream() {
   // Configure the FLAC encoder based on user input data.
   RETURN_IF_NOT_OK(Configure(encoder_metadata_, decoder_config_, num_channels_,
                              num_samples_per_frame_, output_sample_rate_,
@@ -15,7 +15,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/btree_map.h"
@@ -23,6 +22,7 @@
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/encoder_base.h"
 #include "iamf/cli/proto/codec_config.pb.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/flac_decoder_config.h"
 #include "include/FLAC/format.h"
@@ -81,7 +81,7 @@ class FlacEncoder : public EncoderBase {
    *         the frame was finished. A specific status on failure.
    */
   absl::Status EncodeAudioFrame(
-      int input_bit_depth, const std::vector<std::vector<int32_t>>& samples,
+      int input_bit_depth, const PlanarSampleBuffer<int32_t>& samples,
       std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data)
       override;
 
@@ -112,6 +112,21 @@ class FlacEncoder : public EncoderBase {
    */
   absl::Status InitializeEncoder() override;
 
+  /*!\brief Finishes and reinitializes the `libflac` stream.
+   *
+   * The `libflac` encoder is reused. `libflac` forgets the settings when a
+   * stream is finished, so they are configured again.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status ResetEncoder() override;
+
+  /*!\brief Configures and initializes a `libflac` stream.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status InitializeStream();
+
   const iamf_tools_cli_proto::FlacEncoderMetadata encoder_metadata_;
   const FlacDecoderConfig decoder_config_;
 
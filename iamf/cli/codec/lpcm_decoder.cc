@@ -22,6 +22,7 @@
 #include "iamf/cli/codec/decoder_base.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/lpcm_decoder_config.h"
 
@@ -43,7 +44,7 @@ absl::Status LpcmDecoder::Initialize() {
 
 absl::Status LpcmDecoder::DecodeAudioFrame(
     const std::vector<uint8_t>& encoded_frame) {
-  num_valid_ticks_ = 0;
+  RETURN_IF_NOT_OK(decoded_samples_.SetNumTicks(0));
   uint8_t bit_depth;
   auto status = decoder_config_.GetBitDepthToMeasureLoudness(bit_depth);
   if (!status.ok()) {
@@ -77,24 +78,23 @@ absl::Status LpcmDecoder::DecodeAudioFrame(
                      "num_samples_per_channel_= ",
                      num_samples_per_channel_, "."));
   }
-  num_valid_ticks_ = num_ticks;
+  RETURN_IF_NOT_OK(decoded_samples_.SetNumTicks(num_ticks));
 
   const bool little_endian = decoder_config_.IsLittleEndian();
 
-  int32_t sample_result;
-  for (size_t t = 0; t < num_valid_ticks_; ++t) {
-    // One sample for each channel in this time tick.
-    for (size_t c = 0; c < num_channels_; ++c) {
+  // The input is interleaved. Fill one contiguous output channel at a time.
+  for (size_t c = 0; c < num_channels_; ++c) {
+    const auto channel_samples = decoded_samples_.Channel(c);
+    for (size_t t = 0; t < num_ticks; ++t) {
       const size_t offset = (t * num_channels_ + c) * bytes_per_sample;
       absl::Span<const uint8_t> input_bytes(encoded_frame.data() + offset,
                                             bytes_per_sample);
       if (little_endian) {
-        status = LittleEndianBytesToInt32(input_bytes, sample_result);
+        status = LittleEndianBytesToInt32(input_bytes, channel_samples[t]);
       } else {
-        status = BigEndianBytesToInt32(input_bytes, sample_result);
+        status = BigEndianBytesToInt32(input_bytes, channel_samples[t]);
       }
       RETURN_IF_NOT_OK(status);
-      decoded_samples_[t][c] = sample_result;
     }
   }
   return absl::OkStatus();
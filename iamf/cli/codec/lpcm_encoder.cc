@@ -14,7 +14,6 @@
 #include <cstdint>
 #include <memory>
 #include <utility>
-#include <vector>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -23,6 +22,7 @@
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/cli_util.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/decoder_config/lpcm_decoder_config.h"
 
 namespace iamf_tools {
@@ -62,7 +62,7 @@ absl::Status LpcmEncoder::InitializeEncoder() {
 }
 
 absl::Status LpcmEncoder::EncodeAudioFrame(
-    int /*input_bit_depth*/, const std::vector<std::vector<int32_t>>& samples,
+    int /*input_bit_depth*/, const PlanarSampleBuffer<int32_t>& samples,
     std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data) {
   RETURN_IF_NOT_OK(ValidateNotFinalized());
   RETURN_IF_NOT_OK(ValidateInputSamples(samples));
@@ -14,11 +14,11 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 #include "absl/status/status.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/encoder_base.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/lpcm_decoder_config.h"
 
@@ -40,6 +40,14 @@ class LpcmEncoder : public EncoderBase {
    */
   absl::Status InitializeEncoder() override;
 
+  /*!\brief Resets the encoder.
+   *
+   * LPCM encoding is stateless; there is nothing to reset.
+   *
+   * \return `absl::OkStatus()`.
+   */
+  absl::Status ResetEncoder() override { return absl::OkStatus(); }
+
   /*!\brief Encodes an audio frame.
    *
    * \param input_bit_depth Ignored.
@@ -52,7 +60,7 @@ class LpcmEncoder : public EncoderBase {
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status EncodeAudioFrame(
-      int /*input_bit_depth*/, const std::vector<std::vector<int32_t>>& samples,
+      int /*input_bit_depth*/, const PlanarSampleBuffer<int32_t>& samples,
       std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data)
       override;
 
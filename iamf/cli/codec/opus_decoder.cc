@@ -25,6 +25,7 @@
 #include "iamf/cli/proto/codec_config.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/opus_decoder_config.h"
 #include "include/opus.h"
@@ -83,7 +84,7 @@ absl::Status OpusDecoder::Initialize() {
 
 absl::Status OpusDecoder::DecodeAudioFrame(
     const std::vector<uint8_t>& encoded_frame) {
-  num_valid_ticks_ = 0;
+  RETURN_IF_NOT_OK(decoded_samples_.SetNumTicks(0));
 
   // `opus_decode_float` decodes to `float` samples with channels interlaced.
   // Typically these values are in the range of [-1, +1] (always for
@@ -109,14 +110,13 @@ absl::Status OpusDecoder::DecodeAudioFrame(
   LOG_FIRST_N(INFO, 3) << "Opus decoded " << num_output_samples
                        << " samples per channel. With " << num_channels_
                        << " channels.";
-  // Convert the interleaved data to (time, channel) axes.
-  return ConvertInterleavedToTimeChannel(
+  // Convert the interleaved data to (channel, time) axes.
+  return ConvertInterleavedToPlanar(
       absl::MakeConstSpan(output_pcm_float)
           .first(num_output_samples * num_channels_),
-      num_channels_,
       absl::AnyInvocable<absl::Status(float, int32_t&) const>(
           NormalizedFloatingPointToInt32<float>),
-      decoded_samples_, num_valid_ticks_);
+      decoded_samples_);
 }
 
 }  // namespace iamf_tools
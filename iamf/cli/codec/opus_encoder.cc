@@ -11,6 +11,7 @@
  */
 #include "iamf/cli/codec/opus_encoder.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -21,12 +22,12 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/synchronization/mutex.h"
-#include "absl/types/span.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/opus_utils.h"
 #include "iamf/cli/proto/codec_config.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/decoder_config/opus_decoder_config.h"
 #include "include/opus.h"
 #include "include/opus_defines.h"
@@ -61,14 +62,13 @@ const absl::AnyInvocable<absl::Status(int32_t, float&) const>
       return absl::OkStatus();
     };
 
-absl::StatusOr<int> EncodeFloat(
-    const std::vector<std::vector<int32_t>>& samples,
-    int num_samples_per_channel, ::OpusEncoder* encoder,
-    std::vector<uint8_t>& audio_frame) {
+absl::StatusOr<int> EncodeFloat(const PlanarSampleBuffer<int32_t>& samples,
+                                int num_samples_per_channel,
+                                ::OpusEncoder* encoder,
+                                std::vector<uint8_t>& audio_frame) {
   std::vector<float> encoder_input_pcm;
-  RETURN_IF_NOT_OK(ConvertTimeChannelToInterleaved(absl::MakeConstSpan(samples),
-                                                   kInt32ToNormalizedFloat,
-                                                   encoder_input_pcm));
+  RETURN_IF_NOT_OK(ConvertPlanarToInterleaved(samples, kInt32ToNormalizedFloat,
+                                              encoder_input_pcm));
 
   // TODO(b/311655037): Test that samples are passed to `opus_encode_float` in
   //                    the correct order. Maybe also check they are in the
@@ -79,24 +79,24 @@ absl::StatusOr<int> EncodeFloat(
                            static_cast<opus_int32>(audio_frame.size()));
 }
 
-absl::StatusOr<int> EncodeInt16(
-    const std::vector<std::vector<int32_t>>& samples,
-    int num_samples_per_channel, int num_channels, ::OpusEncoder* encoder,
-    std::vector<uint8_t>& audio_frame) {
+absl::StatusOr<int> EncodeInt16(const PlanarSampleBuffer<int32_t>& samples,
+                                int num_samples_per_channel, int num_channels,
+                                ::OpusEncoder* encoder,
+                                std::vector<uint8_t>& audio_frame) {
   // `libopus` requires the native system endianness as input.
   const bool big_endian = IsNativeBigEndian();
   // Convert input to the array that will be passed to `opus_encode`.
   std::vector<opus_int16> encoder_input_pcm(
       num_samples_per_channel * num_channels, 0);
   int write_position = 0;
-  for (int t = 0; t < samples.size(); t++) {
-    for (int c = 0; c < samples[0].size(); ++c) {
+  for (size_t t = 0; t < samples.num_ticks(); t++) {
+    for (size_t c = 0; c < samples.num_channels(); ++c) {
       // Convert all frames to 16-bit samples for input to Opus.
       // Write the 16-bit samples directly into the pcm vector.
-      RETURN_IF_NOT_OK(
-          WritePcmSample(static_cast<uint32_t>(samples[t][c]), 16, big_endian,
-                         reinterpret_cast<uint8_t*>(encoder_input_pcm.data()),
-                         write_position));
+      RETURN_IF_NOT_OK(WritePcmSample(
+          static_cast<uint32_t>(samples.Channel(c)[t]), 16, big_endian,
+          reinterpret_cast<uint8_t*>(encoder_input_pcm.data()),
+          write_position));
     }
   }
 
@@ -170,10 +170,15 @@ absl::Status OpusEncoder::InitializeEncoder() {
   return absl::OkStatus();
 }
 
+absl::Status OpusEncoder::ResetEncoder() {
+  return OpusErrorCodeToAbslStatus(opus_encoder_ctl(encoder_, OPUS_RESET_STATE),
+                                   "Failed to reset Opus encoder.");
+}
+
 OpusEncoder::~OpusEncoder() { opus_encoder_destroy(encoder_); }
 
 absl::Status OpusEncoder::EncodeAudioFrame(
-    int /*input_bit_depth*/, const std::vector<std::vector<int32_t>>& samples,
+    int /*input_bit_depth*/, const PlanarSampleBuffer<int32_t>& samples,
     std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data) {
   RETURN_IF_NOT_OK(ValidateNotFinalized());
   RETURN_IF_NOT_OK(ValidateInputSamples(samples));
@@ -14,12 +14,12 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 
 #include "absl/status/status.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/encoder_base.h"
 #include "iamf/cli/proto/codec_config.pb.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/opus_decoder_config.h"
 #include "include/opus.h"
@@ -49,6 +49,12 @@ class OpusEncoder : public EncoderBase {
    */
   absl::Status InitializeEncoder() override;
 
+  /*!\brief Resets the `libopus` encoder state, keeping its configuration.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status ResetEncoder() override;
+
   /*!\brief Initializes `required_samples_to_delay_at_start_`.
    *
    * `InitializeEncoder` is required to be called before calling this function.
@@ -73,7 +79,7 @@ class OpusEncoder : public EncoderBase {
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status EncodeAudioFrame(
-      int /*input_bit_depth*/, const std::vector<std::vector<int32_t>>& samples,
+      int /*input_bit_depth*/, const PlanarSampleBuffer<int32_t>& samples,
       std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data)
       override;
 
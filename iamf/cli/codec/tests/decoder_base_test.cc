@@ -39,5 +39,18 @@ TEST(DecoderBaseTest, TestConstruction) {
   EXPECT_EQ(decoder.GetNumSamplesPerChannel(), kExpectedNumSamplesPerChannel);
 }
 
+TEST(DecoderBaseTest, ValidDecodedSamplesAreInitiallyEmpty) {
+  const int kNumChannels = 2;
+  const int kNumSamplesPerChannel = 8;
+  MockDecoder decoder(kNumChannels, kNumSamplesPerChannel);
+
+  const auto& decoded_samples = decoder.ValidDecodedSamples();
+
+  EXPECT_EQ(decoded_samples.num_channels(), kNumChannels);
+  EXPECT_EQ(decoded_samples.num_ticks(), 0);
+  // The buffer is sized for a full frame, so decoding does not allocate.
+  EXPECT_EQ(decoded_samples.max_num_ticks(), kNumSamplesPerChannel);
+}
+
 }  // namespace
 }  // namespace iamf_tools
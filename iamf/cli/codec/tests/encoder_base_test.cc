@@ -22,6 +22,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "iamf/cli/audio_frame_with_data.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_frame.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/obu_header.h"
@@ -46,11 +47,12 @@ class MockEncoder : public EncoderBase {
 
   MOCK_METHOD(
       absl::Status, EncodeAudioFrame,
-      (int input_bit_depth, const std::vector<std::vector<int32_t>>& samples,
+      (int input_bit_depth, const PlanarSampleBuffer<int32_t>& samples,
        std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data),
       (override));
 
   MOCK_METHOD(absl::Status, InitializeEncoder, (), (override));
+  MOCK_METHOD(absl::Status, ResetEncoder, (), (override));
   MOCK_METHOD(absl::Status, SetNumberOfSamplesToDelayAtStart,
               (bool validate_codec_delay), (override));
 };
@@ -137,6 +139,26 @@ TEST(EncoderBaseTest, FinalizeAndPopAppendNothingWhenNoFramesAvailable) {
   EXPECT_EQ(only_frame.audio_element_with_data, nullptr);
 }
 
+TEST(EncoderBaseTest, ResetAfterFinalizeAllowsEncodingAgain) {
+  MockEncoder encoder;
+  EXPECT_CALL(encoder, ResetEncoder()).WillOnce(Return(absl::OkStatus()));
+  EXPECT_THAT(encoder.Finalize(), IsOk());
+  EXPECT_TRUE(encoder.Finished());
+
+  EXPECT_THAT(encoder.Reset(), IsOk());
+
+  EXPECT_FALSE(encoder.Finished());
+  EXPECT_FALSE(encoder.FramesAvailable());
+}
+
+TEST(EncoderBaseTest, ResetFailsWhenResetEncoderFails) {
+  MockEncoder encoder;
+  EXPECT_CALL(encoder, ResetEncoder())
+      .WillOnce(Return(absl::UnknownError("")));
+
+  EXPECT_EQ(encoder.Reset().code(), absl::StatusCode::kUnknown);
+}
+
 TEST(EncoderBaseTest, DefaultZeroNumberOfSamplesToDelayAtStart) {
   MockEncoder encoder;
 
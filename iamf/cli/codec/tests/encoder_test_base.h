@@ -21,10 +21,12 @@
 #include "absl/memory/memory.h"
 #include "absl/status/status.h"
 #include "absl/status/status_matchers.h"
+#include "absl/types/span.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/codec/encoder_base.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_frame.h"
 
 namespace iamf_tools {
@@ -46,8 +48,14 @@ class EncoderTestBase {
     EXPECT_THAT(encoder_->Initialize(kValidateCodecDelay), IsOk());
   }
 
+  // Encodes `pcm_samples`, which are arranged in (time, channel) axes for
+  // readability of the tests.
   void EncodeAudioFrame(const std::vector<std::vector<int32_t>>& pcm_samples,
                         bool expected_encode_frame_is_ok = true) {
+    const auto planar_samples = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+        absl::MakeConstSpan(pcm_samples));
+    ASSERT_THAT(planar_samples, IsOk());
+
     // `EncodeAudioFrame` only passes on most of the data in the input
     // `AudioFrameWithData`. Simulate the timestamp to ensure frames are
     // returned in the correct order, but most other fields do not matter.
@@ -69,7 +77,7 @@ class EncoderTestBase {
 
     // Encode the frame as requested.
     EXPECT_EQ(encoder_
-                  ->EncodeAudioFrame(input_sample_size_, pcm_samples,
+                  ->EncodeAudioFrame(input_sample_size_, *planar_samples,
                                      std::move(partial_audio_frame_with_data))
                   .ok(),
               expected_encode_frame_is_ok);
@@ -111,7 +111,7 @@ TEST_F(FlacDecoderTest, WriteCallbackSuccess32BitSamples) {
   auto status = FlacDecoder::LibFlacWriteCallback(
       /*stream_decoder=*/nullptr, &frame, buffer, &flac_decoder);
   EXPECT_EQ(status, FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE);
-  EXPECT_THAT(flac_decoder.GetDecodedFrame(),
+  EXPECT_THAT(flac_decoder.ValidDecodedSamples().ToTimeChannel(),
               ElementsAreArray(std::vector<std::vector<int32_t>>(
                   {{1, 2}, {0x7fffffff, 3}, {3, 4}})));
 }
@@ -128,7 +128,7 @@ TEST_F(FlacDecoderTest, WriteCallbackSuccess16BitSamples) {
   auto status = FlacDecoder::LibFlacWriteCallback(
       /*stream_decoder=*/nullptr, &frame, buffer, &flac_decoder);
   EXPECT_EQ(status, FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE);
-  EXPECT_THAT(flac_decoder.GetDecodedFrame(),
+  EXPECT_THAT(flac_decoder.ValidDecodedSamples().ToTimeChannel(),
               ElementsAreArray(std::vector<std::vector<int32_t>>(
                   {{0x11110000, 0x01010000},
                    {static_cast<int32_t>(0xffff0000), 0x22220000}})));
@@ -150,6 +150,21 @@ TEST_F(FlacDecoderTest, WriteCallbackFailsOnMismatchedBlocksize) {
   EXPECT_EQ(status, FLAC__STREAM_DECODER_WRITE_STATUS_ABORT);
 }
 
+TEST_F(FlacDecoderTest, WriteCallbackFailsOnMismatchedNumberOfChannels) {
+  // The decoder is configured for two channels, but the encoded frame has
+  // one channel.
+  FlacDecoder flac_decoder = CreateFlacDecoder(3);
+  FLAC__Frame frame;
+  frame.header.channels = 1;
+  frame.header.blocksize = 3;
+  frame.header.bits_per_sample = 32;
+  FLAC__int32 channel_0[] = {1, 2, 3};
+  const FLAC__int32 *const buffer[] = {channel_0};
+  auto status = FlacDecoder::LibFlacWriteCallback(
+      /*stream_decoder=*/nullptr, &frame, buffer, &flac_decoder);
+  EXPECT_EQ(status, FLAC__STREAM_DECODER_WRITE_STATUS_ABORT);
+}
+
 TEST_F(FlacDecoderTest, InitializeSuccess) {
   FlacDecoder flac_decoder = CreateFlacDecoder();
   EXPECT_THAT(flac_decoder.Initialize(), IsOk());
@@ -180,13 +195,15 @@ TEST_F(FlacDecoderTest, DecodeAudioFrameSuccess) {
       {0x00000000, 0x00000000},
       {0x00000000, 0x00000000},
       {0x00000000, 0x00000000}};
-  EXPECT_EQ(flac_decoder.ValidDecodedSamples(), kExpectedDecodedSamples);
+  EXPECT_EQ(flac_decoder.ValidDecodedSamples().ToTimeChannel(),
+            kExpectedDecodedSamples);
 
   // Decode again.
   status = flac_decoder.DecodeAudioFrame(
       std::vector(kFlacEncodedFrame.begin(), kFlacEncodedFrame.end()));
   EXPECT_THAT(status, IsOk());
-  EXPECT_EQ(flac_decoder.ValidDecodedSamples(), kExpectedDecodedSamples);
+  EXPECT_EQ(flac_decoder.ValidDecodedSamples().ToTimeChannel(),
+            kExpectedDecodedSamples);
 }
 
 TEST_F(FlacDecoderTest, DecodeAudioFrameFailsOnMismatchedBlocksize) {
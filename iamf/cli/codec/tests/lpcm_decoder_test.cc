@@ -128,7 +128,8 @@ TEST(LpcmDecoderTest, DecodeAudioFrame_LittleEndian16BitSamples) {
   };
 
   auto status = lpcm_decoder.DecodeAudioFrame(encoded_frame);
-  const auto& decoded_samples = lpcm_decoder.ValidDecodedSamples();
+  const auto decoded_samples =
+      lpcm_decoder.ValidDecodedSamples().ToTimeChannel();
 
   EXPECT_THAT(status, IsOk());
   // We have two channels and four samples, so we expect two time ticks of two
@@ -157,7 +158,8 @@ TEST(LpcmDecoderTest, DecodeAudioFrame_BigEndian24BitSamples) {
   };
 
   auto status = lpcm_decoder.DecodeAudioFrame(encoded_frame);
-  const auto& decoded_samples = lpcm_decoder.ValidDecodedSamples();
+  const auto decoded_samples =
+      lpcm_decoder.ValidDecodedSamples().ToTimeChannel();
 
   EXPECT_THAT(status, IsOk());
   // We have two channels and six samples, so we expect three time ticks of two
@@ -186,7 +188,7 @@ TEST(LpcmDecoderTest, DecodeAudioFrame_WillNotDecodeWrongSize) {
 
   auto status = lpcm_decoder.DecodeAudioFrame(encoded_frame);
   EXPECT_FALSE(status.ok());
-  EXPECT_THAT(lpcm_decoder.ValidDecodedSamples(), ::testing::IsEmpty());
+  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().num_ticks(), 0);
 }
 
 TEST(LpcmDecoderTest, DecodeAudioFrame_OverwritesExistingSamples) {
@@ -198,15 +200,15 @@ TEST(LpcmDecoderTest, DecodeAudioFrame_OverwritesExistingSamples) {
 
   auto status = lpcm_decoder.DecodeAudioFrame(encoded_frame);
   EXPECT_THAT(status, IsOk());
-  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().size(), 1);
+  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().num_ticks(), 1);
 
   status = lpcm_decoder.DecodeAudioFrame(encoded_frame);
   EXPECT_THAT(status, IsOk());
-  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().size(), 1);
+  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().num_ticks(), 1);
 
   status = lpcm_decoder.DecodeAudioFrame(encoded_frame);
   EXPECT_THAT(status, IsOk());
-  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().size(), 1);
+  EXPECT_EQ(lpcm_decoder.ValidDecodedSamples().num_ticks(), 1);
 }
 
 }  // namespace
@@ -36,6 +36,7 @@
 #include "iamf/cli/proto/user_metadata.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/audio_frame.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
@@ -601,7 +602,7 @@ uint32_t GetSubstreamId(const DecodedAudioFrame& audio_frame_with_data) {
   return audio_frame_with_data.substream_id;
 }
 
-const std::vector<std::vector<int32_t>>* GetSamples(
+const PlanarSampleBuffer<int32_t>* GetSamples(
     const AudioFrameWithData& audio_frame_with_data) {
   if (!audio_frame_with_data.pcm_samples.has_value()) {
     return nullptr;
@@ -609,7 +610,7 @@ const std::vector<std::vector<int32_t>>* GetSamples(
   return &audio_frame_with_data.pcm_samples.value();
 }
 
-const std::vector<std::vector<int32_t>>* GetSamples(
+const PlanarSampleBuffer<int32_t>* GetSamples(
     const DecodedAudioFrame& audio_frame_with_data) {
   return &audio_frame_with_data.decoded_samples;
 }
@@ -660,7 +661,7 @@ absl::Status StoreSamplesForAudioElementId(
   if (audio_frames_or_decoded_audio_frames.empty()) {
     return absl::OkStatus();
   }
-  const int32_t common_start_timestamp =
+  const InternalTimestamp common_start_timestamp =
       audio_frames_or_decoded_audio_frames.begin()->start_timestamp;
 
   for (auto& audio_frame : audio_frames_or_decoded_audio_frames) {
@@ -677,22 +678,27 @@ absl::Status StoreSamplesForAudioElementId(
                                        "In StoreSamplesForAudioElementId(): "));
 
     const auto& labels = substream_id_labels_iter->second;
-    int channel_index = 0;
+    size_t channel_index = 0;
     for (const auto& label : labels) {
       const auto* input_samples = GetSamples(audio_frame);
       if (input_samples == nullptr) {
         return absl::InvalidArgumentError(
             "Input samples are not available for down-mixing.");
       }
-      const size_t num_ticks = input_samples->size();
+      if (channel_index >= input_samples->num_channels()) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Expected at least ", channel_index + 1, " channels in substream ",
+            substream_id, ", got ", input_samples->num_channels(), "."));
+      }
+      const auto input_channel = input_samples->Channel(channel_index);
 
       ConfigureLabeledFrame(audio_frame, labeled_frame);
 
       auto& samples = labeled_frame.label_to_samples[label];
-      samples.resize(num_ticks, 0);
+      samples.resize(input_channel.size(), 0);
       for (int t = 0; t < samples.size(); t++) {
-        samples[t] = Int32ToNormalizedFloatingPoint<InternalSampleType>(
-            (*input_samples)[t][channel_index]);
+        samples[t] =
+            Int32ToNormalizedFloatingPoint<InternalSampleType>(input_channel[t]);
       }
       channel_index++;
     }
@@ -711,6 +717,26 @@ absl::Status ApplyDemixers(const std::list<Demixer>& demixers,
   return absl::OkStatus();
 }
 
+// Demixes the frames of one audio element and stores them in
+// `id_to_labeled_frame`. Nothing is stored when the frames have no samples for
+// the audio element.
+template <typename T>
+absl::Status DemixFramesForAudioElementId(
+    DecodedUleb128 audio_element_id,
+    const DemxingMetadataForAudioElementId& demixing_metadata,
+    const std::list<T>& audio_frames_or_decoded_audio_frames,
+    IdLabeledFrameMap& id_to_labeled_frame) {
+  LabeledFrame labeled_frame;
+  RETURN_IF_NOT_OK(StoreSamplesForAudioElementId(
+      audio_frames_or_decoded_audio_frames,
+      demixing_metadata.substream_id_to_labels, labeled_frame));
+  if (!labeled_frame.label_to_samples.empty()) {
+    RETURN_IF_NOT_OK(ApplyDemixers(demixing_metadata.demixers, labeled_frame));
+    id_to_labeled_frame[audio_element_id] = std::move(labeled_frame);
+  }
+  return absl::OkStatus();
+}
+
 absl::Status GetDemixerMetadata(
     const DecodedUleb128 audio_element_id,
     const absl::flat_hash_map<DecodedUleb128, DemxingMetadataForAudioElementId>&
@@ -866,11 +892,10 @@ absl::Status DemixingModule::DownMixSamplesToSubstreams(
 
   for (const auto& [substream_id, output_channel_labels] :
        demixing_metadata->substream_id_to_labels) {
-    std::vector<std::vector<int32_t>> substream_samples(
-        num_time_ticks,
-        // One or two channels.
-        std::vector<int32_t>(output_channel_labels.size(), 0));
-    // Output gains to be applied to the (one or two) channels.
+    // Find the input samples and the linear output gains to be applied to the
+    // (one or two) channels.
+    std::vector<const std::vector<InternalSampleType>*> input_channels(
+        output_channel_labels.size());
     std::vector<double> output_gains_linear(output_channel_labels.size());
     int channel_index = 0;
     for (const auto& output_channel_label : output_channel_labels) {
@@ -879,10 +904,7 @@ absl::Status DemixingModule::DownMixSamplesToSubstreams(
         return absl::UnknownError(absl::StrCat(
             "Samples do not exist for channel: ", output_channel_label));
       }
-      for (int t = 0; t < num_time_ticks; t++) {
-        RETURN_IF_NOT_OK(NormalizedFloatingPointToInt32(
-            iter->second[t], substream_samples[t][channel_index]));
-      }
+      input_channels[channel_index] = &iter->second;
 
       // Compute and store the linear output gains.
       auto gain_iter =
@@ -905,14 +927,17 @@ absl::Status DemixingModule::DownMixSamplesToSubstreams(
     }
     auto& substream_data = substream_data_iter->second;
 
-    // Add all down mixed samples to both queues.
-
-    for (const auto& channel_samples : substream_samples) {
-      substream_data.samples_obu.push_back(channel_samples);
-
-      // Apply output gains to the samples going to the encoder.
-      std::vector<int32_t> attenuated_channel_samples(channel_samples.size());
+    // Add all down mixed samples to both queues, one tick at a time. The
+    // scratch ticks are reused so that no tick allocates.
+    std::vector<int32_t> channel_samples(output_channel_labels.size());
+    std::vector<int32_t> attenuated_channel_samples(
+        output_channel_labels.size());
+    for (int t = 0; t < num_time_ticks; t++) {
       for (int i = 0; i < channel_samples.size(); ++i) {
+        RETURN_IF_NOT_OK(NormalizedFloatingPointToInt32(
+            (*input_channels[i])[t], channel_samples[i]));
+
+        // Apply output gains to the samples going to the encoder.
         // Intermediate computation is a `double`. But both `channel_samples`
         // and `attenuated_channel_samples` are `int32_t`.
         const double attenuated_sample =
@@ -920,7 +945,9 @@ absl::Status DemixingModule::DownMixSamplesToSubstreams(
         RETURN_IF_NOT_OK(ClipDoubleToInt32(attenuated_sample,
                                            attenuated_channel_samples[i]));
       }
-      substream_data.samples_encode.push_back(attenuated_channel_samples);
+      RETURN_IF_NOT_OK(substream_data.samples_obu.PushBack(channel_samples));
+      RETURN_IF_NOT_OK(
+          substream_data.samples_encode.PushBack(attenuated_channel_samples));
     }
   }
 
@@ -936,25 +963,13 @@ absl::Status DemixingModule::DemixAudioSamples(
   for (const auto& [audio_element_id, demixing_metadata] :
        audio_element_id_to_demixing_metadata_) {
     // Process the original audio frames.
-    LabeledFrame labeled_frame;
-    RETURN_IF_NOT_OK(StoreSamplesForAudioElementId(
-        audio_frames, demixing_metadata.substream_id_to_labels, labeled_frame));
-    if (!labeled_frame.label_to_samples.empty()) {
-      RETURN_IF_NOT_OK(
-          ApplyDemixers(demixing_metadata.demixers, labeled_frame));
-      id_to_labeled_frame[audio_element_id] = std::move(labeled_frame);
-    }
+    RETURN_IF_NOT_OK(DemixFramesForAudioElementId(
+        audio_element_id, demixing_metadata, audio_frames,
+        id_to_labeled_frame));
     // Process the decoded audio frames.
-    LabeledFrame labeled_decoded_frame;
-    RETURN_IF_NOT_OK(StoreSamplesForAudioElementId(
-        decoded_audio_frames, demixing_metadata.substream_id_to_labels,
-        labeled_decoded_frame));
-    if (!labeled_decoded_frame.label_to_samples.empty()) {
-      RETURN_IF_NOT_OK(
-          ApplyDemixers(demixing_metadata.demixers, labeled_decoded_frame));
-      id_to_labeled_decoded_frame[audio_element_id] =
-          std::move(labeled_decoded_frame);
-    }
+    RETURN_IF_NOT_OK(DemixFramesForAudioElementId(
+        audio_element_id, demixing_metadata, decoded_audio_frames,
+        id_to_labeled_decoded_frame));
 
     LogForAudioElementId(audio_element_id, id_to_labeled_frame,
                          id_to_labeled_decoded_frame);
@@ -963,6 +978,19 @@ absl::Status DemixingModule::DemixAudioSamples(
   return absl::OkStatus();
 }
 
+absl::Status DemixingModule::DemixOriginalAudioSamples(
+    const std::list<AudioFrameWithData>& audio_frames,
+    IdLabeledFrameMap& id_to_labeled_frame) const {
+  for (const auto& [audio_element_id, demixing_metadata] :
+       audio_element_id_to_demixing_metadata_) {
+    RETURN_IF_NOT_OK(DemixFramesForAudioElementId(
+        audio_element_id, demixing_metadata, audio_frames,
+        id_to_labeled_frame));
+  }
+
+  return absl::OkStatus();
+}
+
 absl::Status DemixingModule::GetDownMixers(
     DecodedUleb128 audio_element_id,
     const std::list<Demixer>*& down_mixers) const {
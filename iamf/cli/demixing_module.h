@@ -14,7 +14,6 @@
 #define CLI_DEMIXING_MODULE_H_
 
 #include <cstdint>
-#include <deque>
 #include <list>
 #include <vector>
 
@@ -27,6 +26,7 @@
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/proto/audio_frame.pb.h"
 #include "iamf/cli/proto/user_metadata.pb.h"
+#include "iamf/common/sample_ring_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
 #include "iamf/obu/recon_gain_info_parameter_data.h"
@@ -37,12 +37,12 @@ namespace iamf_tools {
 struct SubstreamData {
   uint32_t substream_id;
 
-  // Samples arranged in a FIFO queue with a vector of channels. There can only
-  // be one or two channels. Includes "virtual" samples that are output from the
-  // encoder, but are not passed to the encoder.
-  std::deque<std::vector<int32_t>> samples_obu;
+  // Samples arranged in a FIFO queue of ticks. There can only be one or two
+  // channels. Includes "virtual" samples that are output from the encoder, but
+  // are not passed to the encoder.
+  SampleRingBuffer<int32_t> samples_obu;
   // Samples to pass to encoder.
-  std::deque<std::vector<int32_t>> samples_encode;
+  SampleRingBuffer<int32_t> samples_encode;
   // One or two elements; corresponding to the output gain to be applied to
   // each channel.
   std::vector<double> output_gains_linear;
@@ -56,7 +56,7 @@ typedef absl::node_hash_map<ChannelLabel::Label,
     LabelSamplesMap;
 
 struct LabeledFrame {
-  int32_t end_timestamp;
+  InternalTimestamp end_timestamp;
   uint32_t samples_to_trim_at_end;
   uint32_t samples_to_trim_at_start;
   LabelSamplesMap label_to_samples;
@@ -175,6 +175,19 @@ class DemixingModule {
       IdLabeledFrameMap& id_to_labeled_frame,
       IdLabeledFrameMap& id_to_labeled_decoded_frame) const;
 
+  /*!\brief Demix original audio samples only.
+   *
+   * Cheaper than `DemixAudioSamples()` when the decoded samples are not
+   * needed.
+   *
+   * \param audio_frames Audio Frames.
+   * \param id_to_labeled_frame Output data structure for samples.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status DemixOriginalAudioSamples(
+      const std::list<AudioFrameWithData>& audio_frames,
+      IdLabeledFrameMap& id_to_labeled_frame) const;
+
   /*!\brief Gets the down-mixers associated with an Audio Element ID.
    *
    * \param audio_element_id Audio Element ID
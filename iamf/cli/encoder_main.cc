@@ -9,12 +9,15 @@
  * source code in the PATENTS file, you can obtain it at
  * www.aomedia.org/license/patent.
  */
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <ios>
 #include <sstream>
 #include <string>
+#include <thread>  // NOLINT(build/c++11)
 
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
@@ -23,12 +26,13 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "iamf/cli/adm_to_user_metadata/app/adm_to_user_metadata_main_lib.h"
 #include "iamf/cli/encoder_main_lib.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/cli/proto/user_metadata.pb.h"
 #include "iamf/obu/ia_sequence_header.h"
-#include "src/google/protobuf/text_format.h"
 
 // Flags to parse input user metadata.
 ABSL_FLAG(
@@ -55,6 +59,16 @@ ABSL_FLAG(int32_t, adm_frame_duration_ms, 10,
           "Target frame duration in milliseconds. The actual frame duration "
           "may vary slightly. Used only if --adm_filename is provided.");
 
+// Flags to encode a batch of programmes.
+ABSL_FLAG(std::string, batch_manifest_filename, "",
+          "Filename of a manifest of programmes to encode in one process. Each "
+          "line holds a user metadata filename, an input wav directory and an "
+          "output IAMF directory, separated by tabs. When provided, all "
+          "other input and output flags are ignored.");
+ABSL_FLAG(int32_t, num_batch_workers, 0,
+          "Number of programmes to encode concurrently in batch mode. "
+          "Non-positive values use one worker per hardware thread.");
+
 // Flags to control output directory for either type of input.
 ABSL_FLAG(std::string, output_iamf_directory, "",
           "Output directory for iamf files");
@@ -62,40 +76,6 @@ ABSL_FLAG(std::string, output_iamf_directory, "",
 
 namespace {
 
-// Reads in a user metadata proto from a binary or textproto file.
-absl::StatusOr<iamf_tools_cli_proto::UserMetadata> ReadUserMetadataFromFile(
-    const std::filesystem::path& user_metadata_filename) {
-  std::ifstream user_metadata_file(user_metadata_filename.string(),
-                                   std::ios::binary | std::ios::in);
-  if (!user_metadata_file) {
-    return absl::FailedPreconditionError(
-        absl::StrCat("Error loading user_metadata_filename= ",
-                     user_metadata_filename.string()));
-  }
-
-  std::ostringstream user_metadata_stream;
-  user_metadata_stream << user_metadata_file.rdbuf();
-
-  bool is_parse_successful = false;
-  iamf_tools_cli_proto::UserMetadata user_metadata;
-  if (user_metadata_filename.extension() == ".binpb") {
-    is_parse_successful =
-        user_metadata.ParseFromString(user_metadata_stream.str());
-  } else if (user_metadata_filename.extension() == ".textproto" ||
-             user_metadata_filename.extension() == ".txtpb") {
-    is_parse_successful = google::protobuf::TextFormat::ParseFromString(
-        user_metadata_stream.str(), &user_metadata);
-  }
-
-  if (!is_parse_successful) {
-    return absl::InvalidArgumentError(
-        absl::StrCat("Error parsing proto with user_metadata_filename= ",
-                     user_metadata_filename.string()));
-  }
-
-  return user_metadata;
-}
-
 // Gets a user metadata proto and directory which the encoder will read wav
 // files from. The proto may be read directly from a file or be generated based
 // on an input ADM file.
@@ -115,7 +95,7 @@ GetUserMetadataAndInputWavDirectory(
         absl::GetFlag(FLAGS_input_wav_directory).empty()
             ? std::filesystem::path("iamf/cli/testdata/")
             : std::filesystem::path(absl::GetFlag(FLAGS_input_wav_directory));
-    return ReadUserMetadataFromFile(input_user_metadata_filename);
+    return iamf_tools::ReadUserMetadataFromFile(input_user_metadata_filename);
   } else {
     // Generate user metadata and wav files based on the input ADM file.
     std::ifstream adm_file(adm_filename, std::ios::binary | std::ios::in);
@@ -134,12 +114,68 @@ GetUserMetadataAndInputWavDirectory(
   }
 }
 
+// Encodes each programme listed in the manifest and logs its outcome.
+int RunBatch(const std::filesystem::path& batch_manifest_filename) {
+  std::ifstream manifest_file(batch_manifest_filename.string());
+  if (!manifest_file) {
+    LOG(ERROR) << "Error loading batch_manifest_filename= "
+               << batch_manifest_filename.string();
+    return static_cast<int>(absl::StatusCode::kFailedPrecondition);
+  }
+  std::ostringstream manifest_stream;
+  manifest_stream << manifest_file.rdbuf();
+  const auto jobs = iamf_tools::ParseEncoderJobManifest(manifest_stream.str());
+  if (!jobs.ok()) {
+    LOG(ERROR) << jobs.status();
+    return static_cast<int>(jobs.status().code());
+  }
+
+  int num_workers = absl::GetFlag(FLAGS_num_batch_workers);
+  if (num_workers <= 0) {
+    num_workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+  LOG(INFO) << "Encoding " << jobs->size() << " programmes with "
+            << num_workers << " workers.";
+  const absl::Time start = absl::Now();
+  const auto results = iamf_tools::BatchMain(*jobs, num_workers);
+  const absl::Duration duration = absl::Now() - start;
+
+  // As for a single programme, a job fails if its status does not match the
+  // expectation of its user metadata.
+  int num_failed_jobs = 0;
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto& result = results[i];
+    const bool job_failed = result.expected_to_succeed != result.status.ok();
+    num_failed_jobs += job_failed ? 1 : 0;
+    const std::string summary = absl::StrCat(
+        (*jobs)[i].user_metadata_filename,
+        " took= ", absl::FormatDuration(result.duration),
+        " reused_encoder= ", result.reused_encoder,
+        " status= ", result.status.ToString());
+    if (job_failed) {
+      LOG(ERROR) << "Failure. " << summary;
+    } else {
+      LOG(INFO) << "Success. " << summary;
+    }
+  }
+  LOG(INFO) << "Finished " << results.size() << " programmes in "
+            << absl::FormatDuration(duration) << " with " << num_failed_jobs
+            << " failures.";
+
+  return num_failed_jobs == 0 ? 0
+                              : static_cast<int>(absl::StatusCode::kUnknown);
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
   absl::SetProgramUsageMessage(argv[0]);
   absl::ParseCommandLine(argc, argv);
 
+  if (!absl::GetFlag(FLAGS_batch_manifest_filename).empty()) {
+    return RunBatch(absl::GetFlag(FLAGS_batch_manifest_filename));
+  }
+
   // Log the profile version flag.
   using enum iamf_tools::ProfileVersion;
   std::string iamf_profile = absl::GetFlag(FLAGS_adm_profile_version);
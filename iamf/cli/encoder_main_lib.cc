@@ -11,19 +11,36 @@
  */
 #include "iamf/cli/encoder_main_lib.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <ios>
+#include <limits>
 #include <list>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/demixing_module.h"
@@ -32,18 +49,23 @@
 #include "iamf/cli/obu_sequencer.h"
 #include "iamf/cli/parameter_block_partitioner.h"
 #include "iamf/cli/parameter_block_with_data.h"
+#include "iamf/cli/proto/encoder_control_metadata.pb.h"
 #include "iamf/cli/proto/temporal_delimiter.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/cli/proto/user_metadata.pb.h"
+#include "iamf/cli/rendering_mix_presentation_finalizer.h"
 #include "iamf/cli/wav_sample_provider.h"
 #include "iamf/cli/wav_writer.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/thread_pool.h"
 #include "iamf/obu/arbitrary_obu.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/ia_sequence_header.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
 #include "src/google/protobuf/repeated_ptr_field.h"
+#include "src/google/protobuf/text_format.h"
+#include "src/google/protobuf/util/message_differencer.h"
 
 namespace iamf_tools {
 
@@ -81,7 +103,8 @@ absl::Status PartitionParameterMetadata(UserMetadata& user_metadata) {
 }
 
 // Mapping from the start timestamps to lists of parameter block metadata.
-typedef absl::flat_hash_map<int32_t, std::list<ParameterBlockObuMetadata>>
+typedef absl::flat_hash_map<InternalTimestamp,
+                            std::list<ParameterBlockObuMetadata>>
     TimeParameterBlockMetadataMap;
 absl::Status OrganizeParameterBlockMetadata(
     const google::protobuf::RepeatedPtrField<ParameterBlockObuMetadata>&
@@ -109,22 +132,29 @@ absl::Status CollectLabeledSamplesForAudioElements(
   return absl::OkStatus();
 }
 
-void PrintAudioFrames(const std::list<AudioFrameWithData>& audio_frames) {
-  // Print the first, last, and any audio frames with `trimming_status_flag`
-  // set.
-  int i = 0;
+void PrintAudioFrame(int index,
+                     const AudioFrameWithData& audio_frame_with_data) {
+  LOG(INFO) << "Audio Frame OBU[" << index << "]";
+
+  audio_frame_with_data.obu.PrintObu();
+  LOG(INFO) << "    audio frame.start_timestamp= "
+            << audio_frame_with_data.start_timestamp;
+  LOG(INFO) << "    audio frame.end_timestamp= "
+            << audio_frame_with_data.end_timestamp;
+}
+
+// Prints the first audio frame and any audio frames with
+// `obu_trimming_status_flag` set. `audio_frame_index` is the index of the
+// first frame in `audio_frames` within the IA Sequence and is advanced past the
+// input frames.
+void PrintAudioFrames(const std::list<AudioFrameWithData>& audio_frames,
+                      int& audio_frame_index) {
   for (const auto& audio_frame_with_data : audio_frames) {
-    if (i == 0 || i == audio_frames.size() - 1 ||
+    if (audio_frame_index == 0 ||
         audio_frame_with_data.obu.header_.obu_trimming_status_flag) {
-      LOG(INFO) << "Audio Frame OBU[" << i << "]";
-
-      audio_frame_with_data.obu.PrintObu();
-      LOG(INFO) << "    audio frame.start_timestamp= "
-                << audio_frame_with_data.start_timestamp;
-      LOG(INFO) << "    audio frame.end_timestamp= "
-                << audio_frame_with_data.end_timestamp;
+      PrintAudioFrame(audio_frame_index, audio_frame_with_data);
     }
-    i++;
+    audio_frame_index++;
   }
 }
 
@@ -144,13 +174,138 @@ absl::Status CreateOutputDirectory(const std::string& output_directory) {
   return absl::OkStatus();
 }
 
+// Sequences the data OBUs output from a single call to
+// `IamfEncoder::OutputTemporalUnit()` and pushes them to all sequencers.
+//
+// Parameter blocks may span several temporal units, and they are written in
+// every temporal unit they overlap. They are held in `active_parameter_blocks`
+// until they end. Arbitrary OBUs with an insertion tick in
+// [`next_insertion_tick`, last start timestamp of `audio_frames`] are pushed
+// alongside `audio_frames`; those after the final audio frame are pushed by
+// passing empty `audio_frames`.
+absl::Status PushDataObusToSequencers(
+    const std::list<AudioFrameWithData>& audio_frames,
+    std::list<ParameterBlockWithData>& active_parameter_blocks,
+    const std::list<ArbitraryObu>& arbitrary_obus,
+    int64_t& next_insertion_tick,
+    std::vector<std::unique_ptr<ObuSequencerBase>>& obu_sequencers) {
+  TemporalUnitMap temporal_unit_map;
+  RETURN_IF_NOT_OK(ObuSequencerBase::GenerateTemporalUnitMap(
+      audio_frames, active_parameter_blocks, /*arbitrary_obus=*/{},
+      temporal_unit_map));
+
+  const int64_t last_insertion_tick =
+      audio_frames.empty() ? std::numeric_limits<int64_t>::max()
+                           : temporal_unit_map.rbegin()->first;
+  for (const auto& arbitrary_obu : arbitrary_obus) {
+    if (arbitrary_obu.insertion_tick_.has_value() &&
+        next_insertion_tick <= *arbitrary_obu.insertion_tick_ &&
+        *arbitrary_obu.insertion_tick_ <= last_insertion_tick) {
+      temporal_unit_map[*arbitrary_obu.insertion_tick_]
+          .arbitrary_obus.push_back(&arbitrary_obu);
+    }
+  }
+  next_insertion_tick = last_insertion_tick + 1;
+
+  for (const auto& [start_timestamp, temporal_unit] : temporal_unit_map) {
+    for (auto& obu_sequencer : obu_sequencers) {
+      RETURN_IF_NOT_OK(
+          obu_sequencer->PushTemporalUnit(start_timestamp, temporal_unit));
+    }
+  }
+
+  // Parameter blocks which end before the end of the final temporal unit
+  // cannot overlap any future temporal units.
+  if (!audio_frames.empty()) {
+    const InternalTimestamp end_timestamp = audio_frames.back().end_timestamp;
+    active_parameter_blocks.remove_if(
+        [end_timestamp](const ParameterBlockWithData& parameter_block) {
+          return parameter_block.end_timestamp <= end_timestamp;
+        });
+  }
+
+  return absl::OkStatus();
+}
+
+// Adds the samples and parameter block metadata of the next temporal unit to
+// `iamf_encoder`.
+absl::Status AddTemporalUnitInput(
+    const absl::flat_hash_map<DecodedUleb128, AudioElementWithData>&
+        audio_elements,
+    TimeParameterBlockMetadataMap& time_parameter_block_metadata,
+    WavSampleProvider& wav_sample_provider, IamfEncoder& iamf_encoder) {
+  iamf_encoder.BeginTemporalUnit();
+
+  InternalTimestamp input_timestamp = 0;
+  RETURN_IF_NOT_OK(iamf_encoder.GetInputTimestamp(input_timestamp));
+
+  // Add audio samples.
+  absl::flat_hash_map<DecodedUleb128, LabelSamplesMap> id_to_labeled_samples;
+  bool no_more_real_samples = false;
+  RETURN_IF_NOT_OK(CollectLabeledSamplesForAudioElements(
+      audio_elements, wav_sample_provider, id_to_labeled_samples,
+      no_more_real_samples));
+
+  for (const auto& [audio_element_id, labeled_samples] :
+       id_to_labeled_samples) {
+    for (const auto& [channel_label, samples] : labeled_samples) {
+      iamf_encoder.AddSamples(audio_element_id, channel_label, samples);
+    }
+  }
+
+  // In this program we always use up all samples from a WAV file, so we
+  // call `IamfEncoder::FinalizeAddSamples()` only when there is no more
+  // real samples. In other applications, the user may decide to stop adding
+  // audio samples based on other criteria.
+  if (no_more_real_samples) {
+    iamf_encoder.FinalizeAddSamples();
+  }
+
+  // Add parameter block metadata.
+  for (const auto& metadata : time_parameter_block_metadata[input_timestamp]) {
+    RETURN_IF_NOT_OK(iamf_encoder.AddParameterBlockMetadata(metadata));
+  }
+
+  return absl::OkStatus();
+}
+
+// Outputs the data OBUs of one temporal unit from `iamf_encoder` and pushes
+// them to all sequencers.
+absl::Status OutputAndPushTemporalUnit(
+    const std::list<ArbitraryObu>& arbitrary_obus, IamfEncoder& iamf_encoder,
+    std::list<ParameterBlockWithData>& active_parameter_blocks,
+    std::list<AudioFrameWithData>& last_audio_frames,
+    int64_t& next_insertion_tick, int& audio_frame_index,
+    std::vector<std::unique_ptr<ObuSequencerBase>>& obu_sequencers) {
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  RETURN_IF_NOT_OK(iamf_encoder.OutputTemporalUnit(temp_audio_frames,
+                                                   temp_parameter_blocks));
+  active_parameter_blocks.splice(active_parameter_blocks.end(),
+                                 temp_parameter_blocks);
+
+  if (temp_audio_frames.empty()) {
+    // Some audio codec will only output an encoded frame after the next
+    // frame "pushes" the old one out. So we wait till the next iteration to
+    // retrieve it.
+    LOG(INFO) << "No audio frame generated in this iteration; continue.";
+    return absl::OkStatus();
+  }
+
+  PrintAudioFrames(temp_audio_frames, audio_frame_index);
+  RETURN_IF_NOT_OK(PushDataObusToSequencers(
+      temp_audio_frames, active_parameter_blocks, arbitrary_obus,
+      next_insertion_tick, obu_sequencers));
+  last_audio_frames = std::move(temp_audio_frames);
+  return absl::OkStatus();
+}
+
 absl::Status GenerateTemporalUnitObus(
     const UserMetadata& user_metadata, const std::string& input_wav_directory,
     IamfEncoder& iamf_encoder,
     absl::flat_hash_map<DecodedUleb128, AudioElementWithData>& audio_elements,
-    std::list<MixPresentationObu>& mix_presentation_obus,
-    std::list<AudioFrameWithData>& audio_frames,
-    std::list<ParameterBlockWithData>& parameter_blocks) {
+    const std::list<ArbitraryObu>& arbitrary_obus,
+    std::vector<std::unique_ptr<ObuSequencerBase>>& obu_sequencers) {
   auto wav_sample_provider =
       WavSampleProvider::Create(user_metadata.audio_frame_metadata(),
                                 input_wav_directory, audio_elements);
@@ -163,116 +318,188 @@ absl::Status GenerateTemporalUnitObus(
   RETURN_IF_NOT_OK(OrganizeParameterBlockMetadata(
       user_metadata.parameter_block_metadata(), time_parameter_block_metadata));
 
-  // TODO(b/329375123): Make two while loops that run on two threads: one for
-  //                    adding samples and parameter block metadata, and one for
-  //                    outputing OBUs.
-  int data_obus_iteration = 0;  // Just for logging purposes.
-  while (iamf_encoder.GeneratingDataObus()) {
-    LOG_EVERY_N_SEC(INFO, 5)
-        << "\n\n============================= Generating Data OBUs Iter #"
-        << data_obus_iteration++ << " =============================\n";
-
-    iamf_encoder.BeginTemporalUnit();
-
-    int32_t input_timestamp = 0;
-    RETURN_IF_NOT_OK(iamf_encoder.GetInputTimestamp(input_timestamp));
+  // Only the OBUs which may still be written out are held; everything else is
+  // released as soon as it is pushed to the sequencers.
+  std::list<ParameterBlockWithData> active_parameter_blocks;
+  std::list<AudioFrameWithData> last_audio_frames;
+  int64_t next_insertion_tick = std::numeric_limits<int64_t>::min();
+  int audio_frame_index = 0;
 
-    // Add audio samples.
-    absl::flat_hash_map<DecodedUleb128, LabelSamplesMap> id_to_labeled_samples;
-    bool no_more_real_samples = false;
-    RETURN_IF_NOT_OK(CollectLabeledSamplesForAudioElements(
-        audio_elements, *wav_sample_provider, id_to_labeled_samples,
-        no_more_real_samples));
-
-    for (const auto& [audio_element_id, labeled_samples] :
-         id_to_labeled_samples) {
-      for (const auto& [channel_label, samples] : labeled_samples) {
-        iamf_encoder.AddSamples(audio_element_id, channel_label, samples);
+  int data_obus_iteration = 0;  // Just for logging purposes.
+  if (user_metadata.encoder_control_metadata().pipeline_queue_depth() > 0) {
+    // Add the input on one thread, and output the OBUs on this thread.
+    absl::Status input_status = absl::OkStatus();
+    std::thread input_thread([&]() {
+      while (input_status.ok() && iamf_encoder.GeneratingAudioFrames()) {
+        LOG_EVERY_N_SEC(INFO, 5)
+            << "\n\n============================= Generating Data OBUs Iter #"
+            << data_obus_iteration++ << " =============================\n";
+        input_status = AddTemporalUnitInput(
+            audio_elements, time_parameter_block_metadata,
+            *wav_sample_provider, iamf_encoder);
+        if (input_status.ok()) {
+          input_status = iamf_encoder.EndTemporalUnit();
+        }
       }
+      if (!input_status.ok()) {
+        iamf_encoder.AbortPipeline();
+      }
+    });
+
+    absl::Status output_status = absl::OkStatus();
+    while (output_status.ok() && iamf_encoder.GeneratingDataObus()) {
+      output_status = OutputAndPushTemporalUnit(
+          arbitrary_obus, iamf_encoder, active_parameter_blocks,
+          last_audio_frames, next_insertion_tick, audio_frame_index,
+          obu_sequencers);
     }
-
-    // In this program we always use up all samples from a WAV file, so we
-    // call `IamfEncoder::FinalizeAddSamples()` only when there is no more
-    // real samples. In other applications, the user may decide to stop adding
-    // audio samples based on other criteria.
-    if (no_more_real_samples) {
-      iamf_encoder.FinalizeAddSamples();
+    if (!output_status.ok()) {
+      iamf_encoder.AbortPipeline();
     }
-
-    // Add parameter block metadata.
-    for (const auto& metadata :
-         time_parameter_block_metadata[input_timestamp]) {
-      RETURN_IF_NOT_OK(iamf_encoder.AddParameterBlockMetadata(metadata));
+    input_thread.join();
+    // A stage which fails aborts the pipeline, and the other stage then only
+    // sees it as cancelled. Report the error which caused the abort.
+    if (absl::IsCancelled(input_status) && !output_status.ok()) {
+      return output_status;
     }
-
-    std::list<AudioFrameWithData> temp_audio_frames;
-    std::list<ParameterBlockWithData> temp_parameter_blocks;
-    IdLabeledFrameMap id_to_labeled_frame;
-    RETURN_IF_NOT_OK(iamf_encoder.OutputTemporalUnit(temp_audio_frames,
-                                                     temp_parameter_blocks));
-
-    if (temp_audio_frames.empty()) {
-      // Some audio codec will only output an encoded frame after the next
-      // frame "pushes" the old one out. So we wait till the next iteration to
-      // retrieve it.
-      LOG(INFO) << "No audio frame generated in this iteration; continue.";
-      continue;
+    RETURN_IF_NOT_OK(input_status);
+    RETURN_IF_NOT_OK(output_status);
+  } else {
+    while (iamf_encoder.GeneratingDataObus()) {
+      LOG_EVERY_N_SEC(INFO, 5)
+          << "\n\n============================= Generating Data OBUs Iter #"
+          << data_obus_iteration++ << " =============================\n";
+      RETURN_IF_NOT_OK(AddTemporalUnitInput(
+          audio_elements, time_parameter_block_metadata, *wav_sample_provider,
+          iamf_encoder));
+      RETURN_IF_NOT_OK(OutputAndPushTemporalUnit(
+          arbitrary_obus, iamf_encoder, active_parameter_blocks,
+          last_audio_frames, next_insertion_tick, audio_frame_index,
+          obu_sequencers));
     }
-
-    audio_frames.splice(audio_frames.end(), temp_audio_frames);
-    parameter_blocks.splice(parameter_blocks.end(), temp_parameter_blocks);
   }
   LOG(INFO) << "\n============================= END of Generating Data OBUs"
             << " =============================\n\n";
-  PrintAudioFrames(audio_frames);
+  if (!last_audio_frames.empty()) {
+    PrintAudioFrame(audio_frame_index - 1, last_audio_frames.back());
+  }
 
-  // Update the loudness information in the mix presentation OBUs.
-  RETURN_IF_NOT_OK(
-      iamf_encoder.FinalizeMixPresentationObus(mix_presentation_obus));
+  // Push any arbitrary OBUs which are inserted after the final audio frame.
+  RETURN_IF_NOT_OK(PushDataObusToSequencers(
+      /*audio_frames=*/{}, active_parameter_blocks, arbitrary_obus,
+      next_insertion_tick, obu_sequencers));
 
   return absl::OkStatus();
 }
 
-absl::Status WriteObus(
-    const UserMetadata& user_metadata, const std::string& output_iamf_directory,
+// Writes the data OBUs to all sequencers as they are generated. Then rewrites
+// the descriptor OBUs with the finalized Mix Presentation OBUs.
+absl::Status GenerateAndWriteObus(
+    const UserMetadata& user_metadata, const std::string& input_wav_directory,
+    IamfEncoder& iamf_encoder,
     const IASequenceHeaderObu& ia_sequence_header_obu,
     const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
-    const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
-    const std::list<MixPresentationObu>& mix_presentation_obus,
-    const std::list<AudioFrameWithData>& audio_frames,
-    const std::list<ParameterBlockWithData>& parameter_blocks,
-    const std::list<ArbitraryObu>& arbitrary_obus) {
-  const bool include_temporal_delimiters =
-      user_metadata.temporal_delimiter_metadata().enable_temporal_delimiters();
+    absl::flat_hash_map<DecodedUleb128, AudioElementWithData>& audio_elements,
+    std::list<MixPresentationObu>& mix_presentation_obus,
+    const std::list<ArbitraryObu>& arbitrary_obus,
+    std::vector<std::unique_ptr<ObuSequencerBase>>& obu_sequencers) {
+  for (auto& obu_sequencer : obu_sequencers) {
+    RETURN_IF_NOT_OK(obu_sequencer->PushDescriptorObus(
+        ia_sequence_header_obu, codec_config_obus, audio_elements,
+        mix_presentation_obus, arbitrary_obus));
+  }
+
+  RETURN_IF_NOT_OK(GenerateTemporalUnitObus(user_metadata, input_wav_directory,
+                                            iamf_encoder, audio_elements,
+                                            arbitrary_obus, obu_sequencers));
+
+  // Update the loudness information in the mix presentation OBUs.
+  RETURN_IF_NOT_OK(
+      iamf_encoder.FinalizeMixPresentationObus(mix_presentation_obus));
 
-  // TODO(b/349271859): Move the OBU sequencer inside `IamfEncoder`.
-  auto obu_sequencers = CreateObuSequencers(
-      user_metadata, output_iamf_directory, include_temporal_delimiters);
   for (auto& obu_sequencer : obu_sequencers) {
-    RETURN_IF_NOT_OK(obu_sequencer->PickAndPlace(
+    RETURN_IF_NOT_OK(obu_sequencer->UpdateDescriptorObusAndClose(
         ia_sequence_header_obu, codec_config_obus, audio_elements,
-        mix_presentation_obus, audio_frames, parameter_blocks, arbitrary_obus));
+        mix_presentation_obus, arbitrary_obus));
   }
 
   return absl::OkStatus();
 }
 
-}  // namespace
-
-absl::Status TestMain(const UserMetadata& input_user_metadata,
-                      const std::string& input_wav_directory,
-                      const std::string& output_iamf_directory) {
-  // Make a copy before modifying.
-  UserMetadata user_metadata(input_user_metadata);
+// An `IamfEncoder` together with the descriptor OBUs it was created from. It
+// may be reset to encode another IA Sequence from the same user metadata.
+struct EncoderSession {
+  // User metadata the encoder was created from, without the output file name
+  // prefix, which does not affect the encoder.
+  UserMetadata reuse_key;
 
   std::optional<IASequenceHeaderObu> ia_sequence_header_obu;
   absl::flat_hash_map<uint32_t, CodecConfigObu> codec_config_obus;
   absl::flat_hash_map<DecodedUleb128, AudioElementWithData> audio_elements;
-  std::list<MixPresentationObu> mix_presentation_obus;
-  std::list<AudioFrameWithData> audio_frames;
-  std::list<ParameterBlockWithData> parameter_blocks;
+  // Mix Presentation OBUs before they are finalized.
+  std::list<MixPresentationObu> preliminary_mix_presentation_obus;
   std::list<ArbitraryObu> arbitrary_obus;
 
+  std::optional<IamfEncoder> iamf_encoder;
+};
+
+UserMetadata GetReuseKey(const UserMetadata& user_metadata) {
+  UserMetadata reuse_key(user_metadata);
+  reuse_key.mutable_test_vector_metadata()->clear_file_name_prefix();
+  return reuse_key;
+}
+
+// Resets `session` when it was created from the same user metadata, or else
+// replaces it with a new session. `session` is left empty on failure.
+absl::Status ResetOrCreateEncoderSession(
+    const UserMetadata& input_user_metadata, const UserMetadata& user_metadata,
+    const RenderingMixPresentationFinalizer::WavWriterFactory&
+        wav_writer_factory,
+    std::unique_ptr<EncoderSession>& session, bool& reused_encoder) {
+  reused_encoder = false;
+  UserMetadata reuse_key = GetReuseKey(input_user_metadata);
+  if (session != nullptr && google::protobuf::util::MessageDifferencer::Equals(
+                                session->reuse_key, reuse_key)) {
+    const absl::Status reset_status = session->iamf_encoder->Reset(
+        CreateLoudnessCalculatorFactory().get(), wav_writer_factory,
+        session->audio_elements, session->preliminary_mix_presentation_obus);
+    if (!reset_status.ok()) {
+      session.reset();
+      return reset_status;
+    }
+    reused_encoder = true;
+    return absl::OkStatus();
+  }
+
+  session.reset();
+  // The encoder refers to the descriptor OBUs, so they are created in place.
+  auto new_session = std::make_unique<EncoderSession>();
+  new_session->reuse_key = std::move(reuse_key);
+  auto iamf_encoder = IamfEncoder::Create(
+      user_metadata, CreateRendererFactory().get(),
+      CreateLoudnessCalculatorFactory().get(), wav_writer_factory,
+      new_session->ia_sequence_header_obu, new_session->codec_config_obus,
+      new_session->audio_elements,
+      new_session->preliminary_mix_presentation_obus,
+      new_session->arbitrary_obus);
+  if (!iamf_encoder.ok()) {
+    return iamf_encoder.status();
+  }
+  new_session->iamf_encoder.emplace(*std::move(iamf_encoder));
+  session = std::move(new_session);
+  return absl::OkStatus();
+}
+
+// Encodes one IA Sequence, reusing the encoder of `session` when possible. On
+// return `session` holds the encoder, or is empty if encoding failed.
+absl::Status EncodeIaSequence(const UserMetadata& input_user_metadata,
+                              const std::string& input_wav_directory,
+                              const std::string& output_iamf_directory,
+                              std::unique_ptr<EncoderSession>& session,
+                              bool& reused_encoder) {
+  // Make a copy before modifying.
+  UserMetadata user_metadata(input_user_metadata);
+
   // Create output directories.
   RETURN_IF_NOT_OK(CreateOutputDirectory(output_iamf_directory));
 
@@ -304,25 +531,201 @@ absl::Status TestMain(const UserMetadata& input_user_metadata,
                              max_input_samples_per_frame);
   };
 
-  auto iamf_encoder = IamfEncoder::Create(
-      user_metadata, CreateRendererFactory().get(),
-      CreateLoudnessCalculatorFactory().get(), ProduceAllWavWriters,
-      ia_sequence_header_obu, codec_config_obus, audio_elements,
-      mix_presentation_obus, arbitrary_obus);
-  if (!iamf_encoder.ok()) {
-    return iamf_encoder.status();
+  RETURN_IF_NOT_OK(ResetOrCreateEncoderSession(
+      input_user_metadata, user_metadata, ProduceAllWavWriters, session,
+      reused_encoder));
+
+  // Finalizing updates the Mix Presentation OBUs in place. Keep the
+  // preliminary ones for the next IA Sequence.
+  std::list<MixPresentationObu> mix_presentation_obus(
+      session->preliminary_mix_presentation_obus);
+
+  // TODO(b/349271859): Move the OBU sequencer inside `IamfEncoder`.
+  const bool include_temporal_delimiters =
+      user_metadata.temporal_delimiter_metadata().enable_temporal_delimiters();
+  auto obu_sequencers = CreateObuSequencers(
+      user_metadata, output_iamf_directory, include_temporal_delimiters);
+
+  const auto status = GenerateAndWriteObus(
+      user_metadata, input_wav_directory, *session->iamf_encoder,
+      session->ia_sequence_header_obu.value(), session->codec_config_obus,
+      session->audio_elements, mix_presentation_obus, session->arbitrary_obus,
+      obu_sequencers);
+  if (!status.ok()) {
+    // Do not leave behind partial output.
+    for (auto& obu_sequencer : obu_sequencers) {
+      obu_sequencer->Abort();
+    }
+    // The encoder may be stopped partway through the IA Sequence.
+    session.reset();
+  }
+
+  return status;
+}
+
+// Idle encoder sessions, which later jobs with the same user metadata reset
+// instead of creating new encoders.
+class EncoderSessionPool {
+ public:
+  explicit EncoderSessionPool(int max_idle_sessions)
+      : max_idle_sessions_(std::max(max_idle_sessions, 1)) {}
+
+  // Takes an idle session created from the same user metadata. Returns
+  // `nullptr` if there is none.
+  std::unique_ptr<EncoderSession> Take(const UserMetadata& user_metadata) {
+    const UserMetadata reuse_key = GetReuseKey(user_metadata);
+    absl::MutexLock lock(&mutex_);
+    auto session_iter = std::find_if(
+        idle_sessions_.begin(), idle_sessions_.end(),
+        [&reuse_key](const std::unique_ptr<EncoderSession>& session) {
+          return google::protobuf::util::MessageDifferencer::Equals(
+              session->reuse_key, reuse_key);
+        });
+    if (session_iter == idle_sessions_.end()) {
+      return nullptr;
+    }
+    auto session = std::move(*session_iter);
+    idle_sessions_.erase(session_iter);
+    return session;
+  }
+
+  // Returns a session for later jobs. The oldest idle sessions are released
+  // so at most `max_idle_sessions` are held.
+  void Return(std::unique_ptr<EncoderSession> session) {
+    if (session == nullptr) {
+      return;
+    }
+    absl::MutexLock lock(&mutex_);
+    idle_sessions_.push_back(std::move(session));
+    if (idle_sessions_.size() > max_idle_sessions_) {
+      idle_sessions_.pop_front();
+    }
+  }
+
+ private:
+  const size_t max_idle_sessions_;
+  absl::Mutex mutex_;
+  std::list<std::unique_ptr<EncoderSession>> idle_sessions_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+absl::Status RunEncoderJob(const EncoderJob& job,
+                           EncoderSessionPool& session_pool,
+                           EncoderJobResult& result) {
+  const auto user_metadata =
+      ReadUserMetadataFromFile(job.user_metadata_filename);
+  if (!user_metadata.ok()) {
+    return user_metadata.status();
   }
+  result.expected_to_succeed = user_metadata->test_vector_metadata().is_valid();
+
+  auto session = session_pool.Take(*user_metadata);
+  const absl::Status status =
+      EncodeIaSequence(*user_metadata, job.input_wav_directory,
+                       job.output_iamf_directory, session,
+                       result.reused_encoder);
+  session_pool.Return(std::move(session));
+  return status;
+}
 
-  RETURN_IF_NOT_OK(GenerateTemporalUnitObus(
-      user_metadata, input_wav_directory, *iamf_encoder, audio_elements,
-      mix_presentation_obus, audio_frames, parameter_blocks));
+}  // namespace
 
-  RETURN_IF_NOT_OK(WriteObus(user_metadata, output_iamf_directory,
-                             ia_sequence_header_obu.value(), codec_config_obus,
-                             audio_elements, mix_presentation_obus,
-                             audio_frames, parameter_blocks, arbitrary_obus));
+absl::Status TestMain(const UserMetadata& input_user_metadata,
+                      const std::string& input_wav_directory,
+                      const std::string& output_iamf_directory) {
+  std::unique_ptr<EncoderSession> session;
+  bool unused_reused_encoder = false;
+  return EncodeIaSequence(input_user_metadata, input_wav_directory,
+                          output_iamf_directory, session,
+                          unused_reused_encoder);
+}
 
-  return absl::OkStatus();
+absl::StatusOr<UserMetadata> ReadUserMetadataFromFile(
+    const std::filesystem::path& user_metadata_filename) {
+  std::ifstream user_metadata_file(user_metadata_filename.string(),
+                                   std::ios::binary | std::ios::in);
+  if (!user_metadata_file) {
+    return absl::FailedPreconditionError(
+        absl::StrCat("Error loading user_metadata_filename= ",
+                     user_metadata_filename.string()));
+  }
+
+  std::ostringstream user_metadata_stream;
+  user_metadata_stream << user_metadata_file.rdbuf();
+
+  bool is_parse_successful = false;
+  UserMetadata user_metadata;
+  if (user_metadata_filename.extension() == ".binpb") {
+    is_parse_successful =
+        user_metadata.ParseFromString(user_metadata_stream.str());
+  } else if (user_metadata_filename.extension() == ".textproto" ||
+             user_metadata_filename.extension() == ".txtpb") {
+    is_parse_successful = google::protobuf::TextFormat::ParseFromString(
+        user_metadata_stream.str(), &user_metadata);
+  }
+
+  if (!is_parse_successful) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Error parsing proto with user_metadata_filename= ",
+                     user_metadata_filename.string()));
+  }
+
+  return user_metadata;
+}
+
+absl::StatusOr<std::vector<EncoderJob>> ParseEncoderJobManifest(
+    absl::string_view manifest) {
+  std::vector<EncoderJob> jobs;
+  int line_number = 0;
+  for (const absl::string_view line : absl::StrSplit(manifest, '\n')) {
+    ++line_number;
+    const absl::string_view stripped_line = absl::StripAsciiWhitespace(line);
+    if (stripped_line.empty() || stripped_line.front() == '#') {
+      continue;
+    }
+
+    // Fields are separated by tabs only, so paths may contain spaces. Apart
+    // from the line ending, fields are used verbatim.
+    absl::string_view fields_line = line;
+    absl::ConsumeSuffix(&fields_line, "\r");
+    const std::vector<std::string> fields = absl::StrSplit(fields_line, '\t');
+    if (fields.size() != 3) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Expected 3 tab-separated fields on manifest line ", line_number,
+          ", got ", fields.size(), ": ", stripped_line));
+    }
+    if (std::any_of(fields.begin(), fields.end(),
+                    [](const std::string& field) { return field.empty(); })) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Expected non-empty fields on manifest line ", line_number, ": ",
+          stripped_line));
+    }
+    jobs.push_back({.user_metadata_filename = fields[0],
+                    .input_wav_directory = fields[1],
+                    .output_iamf_directory = fields[2]});
+  }
+  return jobs;
+}
+
+std::vector<EncoderJobResult> BatchMain(const std::vector<EncoderJob>& jobs,
+                                        int num_workers) {
+  // Each task writes only to its own result.
+  std::vector<EncoderJobResult> results(jobs.size());
+  ThreadPool thread_pool(num_workers);
+  // Roughly one encoder per worker, which is reset between jobs with the same
+  // user metadata.
+  EncoderSessionPool session_pool(thread_pool.num_workers());
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    thread_pool.Schedule(
+        [&job = jobs[i], &session_pool, &result = results[i]]() {
+          const absl::Time start = absl::Now();
+          result.status = RunEncoderJob(job, session_pool, result);
+          result.duration = absl::Now() - start;
+        });
+  }
+  thread_pool.Wait();
+
+  return results;
 }
 
 }  // namespace iamf_tools
@@ -12,11 +12,18 @@
 #ifndef CLI_ENCODER_MAIN_LIB_H_
 #define CLI_ENCODER_MAIN_LIB_H_
 
+#include <filesystem>
 #include <string>
+#include <vector>
 
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
 #include "iamf/cli/proto/user_metadata.pb.h"
 
+namespace iamf_tools {
+
 /*!\brief Writes an IAMF bitstream and wav files to the output files.
  *
  * \param user_metadata Input user metadata describing the IAMF stream.
@@ -24,10 +31,73 @@
  * \param output_iamf_directory Directory to output IAMF files to.
  * \return `absl::OkStatus()` on success. A specific status on failure.
  */
-namespace iamf_tools {
 absl::Status TestMain(const iamf_tools_cli_proto::UserMetadata& user_metadata,
                       const std::string& input_wav_directory,
                       const std::string& output_iamf_directory);
-}
+
+/*!\brief Reads a user metadata proto from a binary or textproto file.
+ *
+ * The file is read as a textproto if the extension is `.textproto` or
+ * `.txtpb`. It is read as a binary proto if the extension is `.binpb`.
+ *
+ * \param user_metadata_filename File to read.
+ * \return User metadata on success. A specific status on failure.
+ */
+absl::StatusOr<iamf_tools_cli_proto::UserMetadata> ReadUserMetadataFromFile(
+    const std::filesystem::path& user_metadata_filename);
+
+/*!\brief One programme to encode in a batch.*/
+struct EncoderJob {
+  std::string user_metadata_filename;
+  std::string input_wav_directory;
+  std::string output_iamf_directory;
+};
+
+/*!\brief Outcome of one `EncoderJob`.*/
+struct EncoderJobResult {
+  // Status of reading the user metadata and encoding.
+  absl::Status status;
+  // Whether the user metadata expects encoding to succeed. False if the user
+  // metadata could not be read.
+  bool expected_to_succeed = false;
+  // Whether the encoder of an earlier job with the same user metadata was
+  // reset and reused.
+  bool reused_encoder = false;
+  // Wall time taken by the job, including reading the user metadata.
+  absl::Duration duration;
+};
+
+/*!\brief Parses a manifest of jobs to encode in a batch.
+ *
+ * Each line holds the user metadata filename, the input wav directory and the
+ * output IAMF directory of one job, separated by single tabs. Fields are taken
+ * verbatim, so paths may contain spaces; only a trailing `\r` is removed.
+ * Blank lines and lines whose first non-whitespace character is `#` are
+ * ignored.
+ *
+ * \param manifest Contents of the manifest.
+ * \return Jobs in the order they are listed on success. A specific status on
+ *         failure.
+ */
+absl::StatusOr<std::vector<EncoderJob>> ParseEncoderJobManifest(
+    absl::string_view manifest);
+
+/*!\brief Encodes many programmes concurrently in one process.
+ *
+ * Each worker takes the next unstarted job whenever it finishes one, so a mix
+ * of long and short programmes keeps every worker busy. Encoders are kept
+ * between jobs and reset for a later job with the same user metadata, apart
+ * from the output file name prefix, instead of being created again. Jobs must
+ * not share output files.
+ *
+ * \param jobs Jobs to encode.
+ * \param num_workers Number of jobs to encode concurrently. Non-positive
+ *        values encode the jobs one at a time on the calling thread.
+ * \return Result of each job, in the same order as `jobs`.
+ */
+std::vector<EncoderJobResult> BatchMain(const std::vector<EncoderJob>& jobs,
+                                        int num_workers);
+
+}  // namespace iamf_tools
 
 #endif  // CLI_ENCODER_MAIN_LIB_H_
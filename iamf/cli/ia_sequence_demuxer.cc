@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/ia_sequence_demuxer.h"
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <utility>
+#include <variant>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/cli/cli_util.h"
+#include "iamf/cli/proto_to_obu/audio_element_generator.h"
+#include "iamf/common/macros.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/obu/audio_element.h"
+#include "iamf/obu/audio_frame.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/ia_sequence_header.h"
+#include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/obu_header.h"
+#include "iamf/obu/param_definitions.h"
+#include "iamf/obu/parameter_block.h"
+#include "iamf/obu/temporal_delimiter.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+
+namespace {
+
+bool IsAudioFrameObuType(ObuType obu_type) {
+  return obu_type == kObuIaAudioFrame ||
+         (kObuIaAudioFrameId0 <= obu_type && obu_type <= kObuIaAudioFrameId17);
+}
+
+bool IsReservedObuType(ObuType obu_type) {
+  return kObuIaReserved24 <= obu_type && obu_type <= kObuIaReserved30;
+}
+
+/*!\brief Reads the header of the next OBU if the entire OBU is available.
+ *
+ * \param rb Buffer to read from.
+ * \param header Output header of the OBU.
+ * \param payload_size Output size of the payload of the OBU.
+ * \param insufficient_data Set to true if the buffer ends before the end of
+ *        the OBU. The read position is then restored.
+ * \return `absl::OkStatus()` on success or when more data is needed. A
+ *         specific status on failure.
+ */
+absl::Status ReadHeaderOfCompleteObu(ReadBitBuffer& rb, ObuHeader& header,
+                                     int64_t& payload_size,
+                                     bool& insufficient_data) {
+  insufficient_data = false;
+  if (!rb.IsDataAvailable()) {
+    insufficient_data = true;
+    return absl::OkStatus();
+  }
+  const int64_t start_position = rb.Tell();
+  const absl::Status header_status = header.ReadAndValidate(rb, payload_size);
+  if (absl::IsResourceExhausted(header_status) ||
+      (header_status.ok() && !rb.CanReadBytes(payload_size))) {
+    insufficient_data = true;
+    return rb.Seek(start_position);
+  }
+  return header_status;
+}
+
+/*!\brief Consumes the payload of an OBU which is not needed.
+ *
+ * The payload is skipped by seeking rather than being copied out.
+ *
+ * \param payload_size Size of the payload to skip.
+ * \param rb Buffer to read from.
+ * \return `absl::OkStatus()` on success. A specific status on failure.
+ */
+absl::Status SkipObuPayload(int64_t payload_size, ReadBitBuffer& rb) {
+  if (payload_size == 0) {
+    return absl::OkStatus();
+  }
+  // Seeking to the end of the source is not allowed. Seek to the last byte of
+  // the payload and consume it instead.
+  RETURN_IF_NOT_OK(rb.Seek(rb.Tell() + (payload_size - 1) * 8));
+  uint8_t unused_last_byte;
+  return rb.ReadUnsignedLiteral(8, unused_last_byte);
+}
+
+/*!\brief Reads the substream ID of an audio frame and skips the rest of it.
+ *
+ * \param header Header of the audio frame.
+ * \param payload_size Size of the payload of the audio frame.
+ * \param rb Buffer to read from.
+ * \param substream_id Output substream ID of the audio frame.
+ * \return `absl::OkStatus()` on success. A specific status on failure.
+ */
+absl::Status SkipAudioFrame(const ObuHeader& header, int64_t payload_size,
+                            ReadBitBuffer& rb, DecodedUleb128& substream_id) {
+  if (header.obu_type != kObuIaAudioFrame) {
+    // The ID is implied by `obu_type`.
+    substream_id = static_cast<DecodedUleb128>(header.obu_type) -
+                   static_cast<DecodedUleb128>(kObuIaAudioFrameId0);
+    return SkipObuPayload(payload_size, rb);
+  }
+  int8_t encoded_uleb128_size = 0;
+  RETURN_IF_NOT_OK(rb.ReadULeb128(substream_id, encoded_uleb128_size));
+  if (encoded_uleb128_size > payload_size) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Audio frame substream_id overflows the payload. payload_size= ",
+        payload_size));
+  }
+  return SkipObuPayload(payload_size - encoded_uleb128_size, rb);
+}
+
+/*!\brief Restores the read position after a partial read.
+ *
+ * \param position Position to restore.
+ * \param rb Buffer to rewind.
+ * \return `absl::OkStatus()` on success. A specific status on failure.
+ */
+absl::Status Rewind(int64_t position, ReadBitBuffer& rb) {
+  // Nothing was read if the buffer was exhausted at `position`, and seeking to
+  // the end of the source is not allowed.
+  if (rb.Tell() == position) {
+    return absl::OkStatus();
+  }
+  return rb.Seek(position);
+}
+
+absl::Status FinalizeAudioElement(AudioElementWithData& audio_element) {
+  const AudioElementObu& obu = audio_element.obu;
+  switch (obu.GetAudioElementType()) {
+    using enum AudioElementObu::AudioElementType;
+    case kAudioElementChannelBased:
+      return AudioElementGenerator::FinalizeScalableChannelLayoutConfig(
+          obu.audio_substream_ids_,
+          std::get<ScalableChannelLayoutConfig>(obu.config_),
+          audio_element.substream_id_to_labels,
+          audio_element.label_to_output_gain,
+          audio_element.channel_numbers_for_layers);
+    case kAudioElementSceneBased:
+      return AudioElementGenerator::FinalizeAmbisonicsConfig(
+          obu, audio_element.substream_id_to_labels);
+    default:
+      // Reserved audio element types carry no labels.
+      return absl::OkStatus();
+  }
+}
+
+}  // namespace
+
+absl::Status IaSequenceDemuxer::ReadDescriptorObus(bool is_end_of_stream,
+                                                   bool& insufficient_data) {
+  insufficient_data = false;
+  if (ia_sequence_header_.has_value()) {
+    return absl::FailedPreconditionError(
+        "Descriptor OBUs have already been read.");
+  }
+
+  // Descriptors are only committed to the demuxer after all of them are read;
+  // otherwise the read position is restored to try again later.
+  const int64_t start_position = rb_.Tell();
+  std::optional<IASequenceHeaderObu> ia_sequence_header;
+  absl::flat_hash_map<DecodedUleb128, CodecConfigObu> codec_configs;
+  std::list<AudioElementObu> audio_element_obus;
+  std::list<MixPresentationObu> mix_presentations;
+  while (true) {
+    const int64_t obu_start_position = rb_.Tell();
+    ObuHeader header;
+    int64_t payload_size = 0;
+    bool obu_insufficient_data = false;
+    RETURN_IF_NOT_OK(ReadHeaderOfCompleteObu(rb_, header, payload_size,
+                                             obu_insufficient_data));
+    if (obu_insufficient_data) {
+      // A stream may end right after its descriptors, but not within one.
+      if (is_end_of_stream && ia_sequence_header.has_value() &&
+          !rb_.IsDataAvailable()) {
+        break;
+      }
+      if (is_end_of_stream) {
+        return absl::InvalidArgumentError(
+            "Stream ended before the descriptor OBUs were complete.");
+      }
+      insufficient_data = true;
+      return Rewind(start_position, rb_);
+    }
+
+    if (!ia_sequence_header.has_value()) {
+      if (header.obu_type != kObuIaSequenceHeader) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("An IA Sequence must start with an IA Sequence "
+                         "Header OBU. Got obu_type= ",
+                         header.obu_type));
+      }
+      auto obu =
+          IASequenceHeaderObu::CreateFromBuffer(header, payload_size, rb_);
+      RETURN_IF_NOT_OK(obu.status());
+      ia_sequence_header = *std::move(obu);
+      continue;
+    }
+
+    if (header.obu_redundant_copy || IsReservedObuType(header.obu_type)) {
+      RETURN_IF_NOT_OK(SkipObuPayload(payload_size, rb_));
+      continue;
+    }
+
+    if (header.obu_type == kObuIaCodecConfig) {
+      auto obu = CodecConfigObu::CreateFromBuffer(header, payload_size, rb_);
+      RETURN_IF_NOT_OK(obu.status());
+      const DecodedUleb128 codec_config_id = obu->GetCodecConfigId();
+      if (!codec_configs.emplace(codec_config_id, *std::move(obu)).second) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Duplicate codec_config_id= ", codec_config_id));
+      }
+    } else if (header.obu_type == kObuIaAudioElement) {
+      auto obu = AudioElementObu::CreateFromBuffer(header, payload_size, rb_);
+      RETURN_IF_NOT_OK(obu.status());
+      audio_element_obus.push_back(*std::move(obu));
+    } else if (header.obu_type == kObuIaMixPresentation) {
+      auto obu =
+          MixPresentationObu::CreateFromBuffer(header, payload_size, rb_);
+      RETURN_IF_NOT_OK(obu.status());
+      mix_presentations.push_back(*std::move(obu));
+    } else if (header.obu_type == kObuIaSequenceHeader) {
+      return absl::InvalidArgumentError(
+          "Found a second non-redundant IA Sequence Header OBU within the "
+          "descriptor OBUs.");
+    } else {
+      // The first temporal unit begins here. Leave its first OBU unread.
+      RETURN_IF_NOT_OK(rb_.Seek(obu_start_position));
+      break;
+    }
+  }
+
+  // All descriptors are available. Resolve the references between them.
+  absl::flat_hash_map<DecodedUleb128, AudioElementWithData> audio_elements;
+  for (auto& audio_element_obu : audio_element_obus) {
+    const DecodedUleb128 audio_element_id =
+        audio_element_obu.GetAudioElementId();
+    const DecodedUleb128 codec_config_id = audio_element_obu.GetCodecConfigId();
+    auto codec_config_iter = codec_configs.find(codec_config_id);
+    if (codec_config_iter == codec_configs.end()) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Audio Element with ID ", audio_element_id,
+                       " references unknown codec_config_id= ",
+                       codec_config_id));
+    }
+    auto [audio_element_iter, inserted] = audio_elements.emplace(
+        audio_element_id, AudioElementWithData{
+                              .obu = std::move(audio_element_obu),
+                              .codec_config = &codec_config_iter->second,
+                          });
+    if (!inserted) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Duplicate audio_element_id= ", audio_element_id));
+    }
+    RETURN_IF_NOT_OK(FinalizeAudioElement(audio_element_iter->second));
+  }
+
+  absl::flat_hash_set<DecodedUleb128> substream_ids;
+  for (const auto& [audio_element_id, audio_element] : audio_elements) {
+    for (const auto substream_id : audio_element.obu.audio_substream_ids_) {
+      if (!substream_ids.insert(substream_id).second) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Duplicate substream_id= ", substream_id));
+      }
+    }
+  }
+
+  // Move the descriptors into place before building the parameter metadata;
+  // the metadata refers to parameter definitions within them.
+  ia_sequence_header_ = *std::move(ia_sequence_header);
+  codec_configs_ = std::move(codec_configs);
+  audio_elements_ = std::move(audio_elements);
+  mix_presentations_ = std::move(mix_presentations);
+  substream_ids_ = std::move(substream_ids);
+  for (auto& [audio_element_id, audio_element] : audio_elements_) {
+    audio_element.codec_config =
+        &codec_configs_.at(audio_element.obu.GetCodecConfigId());
+  }
+
+  absl::flat_hash_map<DecodedUleb128, const ParamDefinition*>
+      param_definitions;
+  RETURN_IF_NOT_OK(CollectAndValidateParamDefinitions(
+      audio_elements_, mix_presentations_, param_definitions));
+  auto parameter_id_to_metadata =
+      GenerateParamIdToMetadataMap(param_definitions, audio_elements_);
+  RETURN_IF_NOT_OK(parameter_id_to_metadata.status());
+  parameter_id_to_metadata_ = *std::move(parameter_id_to_metadata);
+
+  return absl::OkStatus();
+}
+
+absl::Status IaSequenceDemuxer::ReadTemporalUnit(
+    bool is_end_of_stream, std::optional<TemporalUnit>& output_temporal_unit,
+    bool& insufficient_data) {
+  output_temporal_unit.reset();
+  TemporalUnit temporal_unit;
+  bool is_complete = false;
+  RETURN_IF_NOT_OK(ProcessTemporalUnit(is_end_of_stream, &temporal_unit,
+                                       is_complete, insufficient_data));
+  if (is_complete) {
+    output_temporal_unit = std::move(temporal_unit);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status IaSequenceDemuxer::SkipTemporalUnit(
+    bool is_end_of_stream, std::optional<int64_t>& output_temporal_unit_size,
+    bool& insufficient_data) {
+  output_temporal_unit_size.reset();
+  const int64_t start_position = rb_.Tell();
+  bool is_complete = false;
+  RETURN_IF_NOT_OK(ProcessTemporalUnit(is_end_of_stream,
+                                       /*temporal_unit=*/nullptr, is_complete,
+                                       insufficient_data));
+  if (is_complete) {
+    output_temporal_unit_size = (rb_.Tell() - start_position) / 8;
+  }
+  return absl::OkStatus();
+}
+
+absl::Status IaSequenceDemuxer::ProcessTemporalUnit(
+    bool is_end_of_stream, TemporalUnit* temporal_unit, bool& is_complete,
+    bool& insufficient_data) {
+  is_complete = false;
+  insufficient_data = false;
+  if (!ia_sequence_header_.has_value()) {
+    return absl::FailedPreconditionError(
+        "Descriptor OBUs must be read before temporal units.");
+  }
+  if (substream_ids_.empty()) {
+    return absl::FailedPreconditionError(
+        "Temporal units cannot be delimited without any audio substreams.");
+  }
+
+  const int64_t start_position = rb_.Tell();
+  absl::flat_hash_set<DecodedUleb128> substream_ids_in_temporal_unit;
+  bool is_temporal_unit_empty = true;
+  int num_obus_in_temporal_unit = 0;
+  while (substream_ids_in_temporal_unit.size() < substream_ids_.size()) {
+    ObuHeader header;
+    int64_t payload_size = 0;
+    bool obu_insufficient_data = false;
+    RETURN_IF_NOT_OK(ReadHeaderOfCompleteObu(rb_, header, payload_size,
+                                             obu_insufficient_data));
+    if (obu_insufficient_data) {
+      if (!is_end_of_stream) {
+        insufficient_data = true;
+        return Rewind(start_position, rb_);
+      }
+      if (is_temporal_unit_empty && !rb_.IsDataAvailable()) {
+        // The stream ended cleanly between temporal units.
+        return absl::OkStatus();
+      }
+      return absl::InvalidArgumentError(
+          "Stream ended within a temporal unit.");
+    }
+    is_temporal_unit_empty = false;
+
+    if (header.obu_redundant_copy || IsReservedObuType(header.obu_type)) {
+      RETURN_IF_NOT_OK(SkipObuPayload(payload_size, rb_));
+      continue;
+    }
+
+    if (header.obu_type == kObuIaTemporalDelimiter) {
+      if (num_obus_in_temporal_unit > 0) {
+        return absl::InvalidArgumentError(
+            "A temporal delimiter must be the first OBU of a temporal unit.");
+      }
+      if (temporal_unit == nullptr) {
+        RETURN_IF_NOT_OK(SkipObuPayload(payload_size, rb_));
+      } else {
+        auto obu =
+            TemporalDelimiterObu::CreateFromBuffer(header, payload_size, rb_);
+        RETURN_IF_NOT_OK(obu.status());
+        temporal_unit->temporal_delimiter = *std::move(obu);
+      }
+    } else if (header.obu_type == kObuIaParameterBlock) {
+      if (temporal_unit == nullptr) {
+        RETURN_IF_NOT_OK(SkipObuPayload(payload_size, rb_));
+      } else {
+        auto obu = ParameterBlockObu::CreateFromBuffer(
+            header, payload_size, parameter_id_to_metadata_, rb_);
+        RETURN_IF_NOT_OK(obu.status());
+        temporal_unit->parameter_blocks.push_back(*std::move(obu));
+      }
+    } else if (IsAudioFrameObuType(header.obu_type)) {
+      DecodedUleb128 substream_id;
+      std::optional<AudioFrameObu> audio_frame;
+      if (temporal_unit == nullptr) {
+        RETURN_IF_NOT_OK(
+            SkipAudioFrame(header, payload_size, rb_, substream_id));
+      } else {
+        auto obu = AudioFrameObu::CreateFromBuffer(header, payload_size, rb_);
+        RETURN_IF_NOT_OK(obu.status());
+        substream_id = obu->GetSubstreamId();
+        audio_frame = *std::move(obu);
+      }
+      if (!substream_ids_.contains(substream_id)) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Found an audio frame for unknown substream_id= ", substream_id));
+      }
+      if (!substream_ids_in_temporal_unit.insert(substream_id).second) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Found multiple audio frames for substream_id= ", substream_id,
+            " in the same temporal unit."));
+      }
+      if (audio_frame.has_value()) {
+        temporal_unit->audio_frames.push_back(*std::move(audio_frame));
+      }
+    } else {
+      // A non-redundant descriptor would begin a new IA Sequence.
+      return absl::UnimplementedError(absl::StrCat(
+          "Unsupported non-redundant descriptor OBU after the first temporal "
+          "unit. obu_type= ",
+          header.obu_type));
+    }
+    num_obus_in_temporal_unit++;
+  }
+
+  is_complete = true;
+  return absl::OkStatus();
+}
+
+}  // namespace iamf_tools
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+
+#ifndef CLI_IA_SEQUENCE_DEMUXER_H_
+#define CLI_IA_SEQUENCE_DEMUXER_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/obu/audio_frame.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/ia_sequence_header.h"
+#include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/param_definitions.h"
+#include "iamf/obu/parameter_block.h"
+#include "iamf/obu/temporal_delimiter.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+
+/*!\brief Demuxes an IA Sequence from a `ReadBitBuffer` incrementally.
+ *
+ * The demuxer first reads the descriptor OBUs via `ReadDescriptorObus()`, then
+ * reads one temporal unit at a time via `ReadTemporalUnit()`. Each call either
+ * consumes a complete unit of work or leaves the read position untouched and
+ * reports that more data is needed. Redundant copies of descriptor OBUs and
+ * OBUs with reserved types are skipped.
+ *
+ * When the buffer is a `StreamBasedReadBitBuffer` the caller may push bytes as
+ * they arrive. Between calls the caller may `Flush(rb.Tell() / 8)` to release
+ * consumed bytes; doing so bounds the buffered data to roughly one temporal
+ * unit.
+ */
+class IaSequenceDemuxer {
+ public:
+  /*!\brief OBUs which make up a single temporal unit. */
+  struct TemporalUnit {
+    std::optional<TemporalDelimiterObu> temporal_delimiter;
+    std::list<std::unique_ptr<ParameterBlockObu>> parameter_blocks;
+    std::list<AudioFrameObu> audio_frames;
+  };
+
+  /*!\brief Constructor.
+   *
+   * \param rb Buffer to read from. Must outlive this demuxer.
+   */
+  explicit IaSequenceDemuxer(ReadBitBuffer& rb) : rb_(rb) {}
+
+  /*!\brief Reads the descriptor OBUs at the start of the IA Sequence.
+   *
+   * The descriptors end at the first temporal delimiter, parameter block, or
+   * audio frame OBU, which is left unread.
+   *
+   * \param is_end_of_stream Whether the buffer holds the remainder of the
+   *        stream. When true a stream which ends after the descriptors is
+   *        valid.
+   * \param insufficient_data Set to true if the buffer ended before all
+   *        descriptors could be read. The read position is then restored and
+   *        the call may be retried after more data is available.
+   * \return `absl::OkStatus()` on success or when more data is needed. A
+   *         specific status on failure.
+   */
+  absl::Status ReadDescriptorObus(bool is_end_of_stream,
+                                  bool& insufficient_data);
+
+  /*!\brief Reads the next temporal unit.
+   *
+   * A temporal unit is complete once one audio frame has been read for each
+   * substream of each audio element.
+   *
+   * \param is_end_of_stream Whether the buffer holds the remainder of the
+   *        stream. When true a truncated temporal unit is an error.
+   * \param output_temporal_unit Output temporal unit. `std::nullopt` if the
+   *        stream ended cleanly or more data is needed.
+   * \param insufficient_data Set to true if the buffer ended before the
+   *        temporal unit could be read. The read position is then restored
+   *        and the call may be retried after more data is available.
+   * \return `absl::OkStatus()` on success, at the end of the stream, or when
+   *         more data is needed. `absl::FailedPreconditionError()` if the
+   *         descriptor OBUs have not been read. A specific status on failure.
+   */
+  absl::Status ReadTemporalUnit(
+      bool is_end_of_stream, std::optional<TemporalUnit>& output_temporal_unit,
+      bool& insufficient_data);
+
+  /*!\brief Skips the next temporal unit without parsing its OBUs.
+   *
+   * Only OBU headers and audio frame substream IDs are read, so this is much
+   * cheaper than `ReadTemporalUnit()`. The temporal unit is delimited and
+   * checked by the same rules.
+   *
+   * \param is_end_of_stream Whether the buffer holds the remainder of the
+   *        stream. When true a truncated temporal unit is an error.
+   * \param output_temporal_unit_size Output size of the skipped temporal unit
+   *        in bytes. `std::nullopt` if the stream ended cleanly or more data
+   *        is needed.
+   * \param insufficient_data Set to true if the buffer ended before the
+   *        temporal unit could be skipped. The read position is then restored
+   *        and the call may be retried after more data is available.
+   * \return `absl::OkStatus()` on success, at the end of the stream, or when
+   *         more data is needed. `absl::FailedPreconditionError()` if the
+   *         descriptor OBUs have not been read. A specific status on failure.
+   */
+  absl::Status SkipTemporalUnit(
+      bool is_end_of_stream, std::optional<int64_t>& output_temporal_unit_size,
+      bool& insufficient_data);
+
+  /*!\brief Gets the IA Sequence Header OBU.
+   *
+   * \return IA Sequence Header OBU. `std::nullopt` if the descriptor OBUs have
+   *         not been read.
+   */
+  const std::optional<IASequenceHeaderObu>& GetIaSequenceHeader() const {
+    return ia_sequence_header_;
+  }
+
+  /*!\brief Gets the Codec Config OBUs keyed by `codec_config_id`. */
+  const absl::flat_hash_map<DecodedUleb128, CodecConfigObu>& GetCodecConfigs()
+      const {
+    return codec_configs_;
+  }
+
+  /*!\brief Gets the Audio Element OBUs with data keyed by `audio_element_id`.
+   */
+  const absl::flat_hash_map<DecodedUleb128, AudioElementWithData>&
+  GetAudioElements() const {
+    return audio_elements_;
+  }
+
+  /*!\brief Gets the Mix Presentation OBUs. */
+  const std::list<MixPresentationObu>& GetMixPresentations() const {
+    return mix_presentations_;
+  }
+
+ private:
+  /*!\brief Reads or skips the next temporal unit.
+   *
+   * \param is_end_of_stream Whether the buffer holds the remainder of the
+   *        stream.
+   * \param temporal_unit Temporal unit to fill in, or `nullptr` to skip the
+   *        OBUs.
+   * \param is_complete Set to true if an entire temporal unit was consumed.
+   * \param insufficient_data Set to true if more data is needed.
+   * \return `absl::OkStatus()` on success, at the end of the stream, or when
+   *         more data is needed. A specific status on failure.
+   */
+  absl::Status ProcessTemporalUnit(bool is_end_of_stream,
+                                   TemporalUnit* temporal_unit,
+                                   bool& is_complete, bool& insufficient_data);
+
+  ReadBitBuffer& rb_;
+
+  std::optional<IASequenceHeaderObu> ia_sequence_header_;
+  absl::flat_hash_map<DecodedUleb128, CodecConfigObu> codec_configs_;
+  absl::flat_hash_map<DecodedUleb128, AudioElementWithData> audio_elements_;
+  std::list<MixPresentationObu> mix_presentations_;
+
+  // Metadata to parse parameter blocks. Parameter blocks hold a reference to
+  // their entry, so this map must not change after the descriptors are read.
+  absl::flat_hash_map<DecodedUleb128, PerIdParameterMetadata>
+      parameter_id_to_metadata_;
+
+  // Substreams which contribute one audio frame to each temporal unit.
+  absl::flat_hash_set<DecodedUleb128> substream_ids_;
+};
+
+}  // namespace iamf_tools
+
+#endif  // CLI_IA_SEQUENCE_DEMUXER_H_
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/ia_sequence_validator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "iamf/cli/ia_sequence_demuxer.h"
+#include "iamf/cli/temporal_unit_index.h"
+#include "iamf/common/macros.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/common/thread_pool.h"
+
+namespace iamf_tools {
+
+namespace {
+
+constexpr int64_t kFileBufferCapacity = 64 * 1024;
+
+std::unique_ptr<ReadBitBuffer> CreateReadBitBuffer(
+    const std::filesystem::path& file_path) {
+  std::unique_ptr<ReadBitBuffer> rb =
+      MmapReadBitBuffer::CreateFromFilePath(file_path);
+  if (rb == nullptr) {
+    // Memory mapping is not available on all platforms.
+    rb = FileBasedReadBitBuffer::CreateFromFilePath(kFileBufferCapacity,
+                                                    file_path);
+  }
+  return rb;
+}
+
+absl::Status ReadDescriptorObus(IaSequenceDemuxer& demuxer) {
+  bool unused_insufficient_data;
+  return demuxer.ReadDescriptorObus(/*is_end_of_stream=*/true,
+                                    unused_insufficient_data);
+}
+
+/*!\brief Finds the temporal units by scanning their OBU headers.
+ *
+ * \param file_size Size of the file in bytes.
+ * \param rb Buffer positioned after the descriptor OBUs.
+ * \param demuxer Demuxer which has read the descriptor OBUs.
+ * \param diagnostics Output diagnostics with the location of each temporal
+ *        unit. A temporal unit which cannot be delimited is marked as invalid
+ *        and ends the scan.
+ */
+void ScanTemporalUnits(int64_t file_size, ReadBitBuffer& rb,
+                       IaSequenceDemuxer& demuxer,
+                       std::vector<TemporalUnitDiagnostic>& diagnostics) {
+  while (rb.IsDataAvailable()) {
+    const int64_t offset = rb.Tell() / 8;
+    std::optional<int64_t> temporal_unit_size;
+    bool unused_insufficient_data;
+    const absl::Status status =
+        demuxer.SkipTemporalUnit(/*is_end_of_stream=*/true, temporal_unit_size,
+                                 unused_insufficient_data);
+    if (!status.ok()) {
+      // The following temporal units cannot be found.
+      diagnostics.push_back(
+          {.offset = offset, .size = file_size - offset, .status = status});
+      return;
+    }
+    if (!temporal_unit_size.has_value()) {
+      return;
+    }
+    diagnostics.push_back({.offset = offset,
+                           .size = *temporal_unit_size,
+                           .status = absl::OkStatus()});
+  }
+}
+
+/*!\brief Copies the location of the temporal units from an index.
+ *
+ * \param index Index of the file.
+ * \param first_temporal_unit_offset Offset where the first temporal unit
+ *        starts.
+ * \param file_size Size of the file in bytes.
+ * \param diagnostics Output diagnostics with the location of each temporal
+ *        unit.
+ * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if the
+ *         temporal units in the index do not exactly cover the file.
+ */
+absl::Status CopyTemporalUnitsFromIndex(
+    const TemporalUnitIndex& index, int64_t first_temporal_unit_offset,
+    int64_t file_size, std::vector<TemporalUnitDiagnostic>& diagnostics) {
+  int64_t expected_offset = first_temporal_unit_offset;
+  for (const auto& entry : index.GetTemporalUnits()) {
+    if (entry.offset != expected_offset) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Index does not match the file. Expected a temporal "
+                       "unit at offset= ",
+                       expected_offset, " but got offset= ", entry.offset));
+    }
+    diagnostics.push_back({.offset = entry.offset,
+                           .size = entry.size,
+                           .status = absl::OkStatus()});
+    expected_offset += entry.size;
+  }
+  if (expected_offset != file_size) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Index does not match the file. The temporal units end at offset= ",
+        expected_offset, " but the file size= ", file_size));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ValidateTemporalUnit(int64_t offset, int64_t size,
+                                  ReadBitBuffer& rb,
+                                  IaSequenceDemuxer& demuxer) {
+  RETURN_IF_NOT_OK(rb.Seek(offset * 8));
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  bool unused_insufficient_data;
+  RETURN_IF_NOT_OK(demuxer.ReadTemporalUnit(
+      /*is_end_of_stream=*/true, temporal_unit, unused_insufficient_data));
+  const int64_t end_offset = rb.Tell() / 8;
+  if (!temporal_unit.has_value() || end_offset != offset + size) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Temporal unit at offset= ", offset, " ended at offset= ", end_offset,
+        ". Expected it to end at offset= ", offset + size));
+  }
+  return absl::OkStatus();
+}
+
+/*!\brief Validates a range of temporal units with a dedicated reader.
+ *
+ * \param file_path Path of the file to validate.
+ * \param diagnostics Diagnostics of the temporal units to validate. Temporal
+ *        units which are already marked as invalid are skipped.
+ */
+void ValidateTemporalUnits(const std::filesystem::path& file_path,
+                           absl::Span<TemporalUnitDiagnostic> diagnostics) {
+  // Parameter blocks update the metadata of the demuxer which reads them, so
+  // each range uses its own reader and demuxer.
+  auto rb = CreateReadBitBuffer(file_path);
+  absl::Status status =
+      rb == nullptr ? absl::UnknownError(absl::StrCat(
+                          "Failed to open file_path= ", file_path.string()))
+                    : absl::OkStatus();
+  std::optional<IaSequenceDemuxer> demuxer;
+  if (status.ok()) {
+    demuxer.emplace(*rb);
+    status = ReadDescriptorObus(*demuxer);
+  }
+
+  for (auto& diagnostic : diagnostics) {
+    if (!diagnostic.status.ok()) {
+      continue;
+    }
+    diagnostic.status =
+        status.ok() ? ValidateTemporalUnit(diagnostic.offset, diagnostic.size,
+                                           *rb, *demuxer)
+                    : status;
+  }
+}
+
+}  // namespace
+
+absl::Status ValidateIaSequenceFile(
+    const std::filesystem::path& file_path, int num_threads,
+    const TemporalUnitIndex* index,
+    std::vector<TemporalUnitDiagnostic>& diagnostics) {
+  diagnostics.clear();
+  std::error_code error_code;
+  const auto file_size = std::filesystem::file_size(file_path, error_code);
+  auto rb = CreateReadBitBuffer(file_path);
+  if (error_code || rb == nullptr) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Failed to open file_path= ", file_path.string()));
+  }
+
+  // Parse the descriptors once up front; a file with invalid descriptors has
+  // no temporal units to validate.
+  IaSequenceDemuxer demuxer(*rb);
+  RETURN_IF_NOT_OK(ReadDescriptorObus(demuxer));
+  if (index == nullptr) {
+    ScanTemporalUnits(static_cast<int64_t>(file_size), *rb, demuxer,
+                      diagnostics);
+  } else {
+    RETURN_IF_NOT_OK(CopyTemporalUnitsFromIndex(
+        *index, rb->Tell() / 8, static_cast<int64_t>(file_size),
+        diagnostics));
+  }
+
+  // Split the temporal units into one contiguous range per thread.
+  {
+    ThreadPool thread_pool(num_threads);
+    const size_t num_ranges = std::max(num_threads, 1);
+    const size_t range_size =
+        (diagnostics.size() + num_ranges - 1) / num_ranges;
+    for (size_t first = 0; first < diagnostics.size(); first += range_size) {
+      const auto range = absl::MakeSpan(diagnostics).subspan(first, range_size);
+      thread_pool.Schedule(
+          [&file_path, range]() { ValidateTemporalUnits(file_path, range); });
+    }
+    thread_pool.Wait();
+  }
+
+  for (const auto& diagnostic : diagnostics) {
+    RETURN_IF_NOT_OK(diagnostic.status);
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace iamf_tools
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+
+#ifndef CLI_IA_SEQUENCE_VALIDATOR_H_
+#define CLI_IA_SEQUENCE_VALIDATOR_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "iamf/cli/temporal_unit_index.h"
+
+namespace iamf_tools {
+
+/*!\brief Result of validating a single temporal unit. */
+struct TemporalUnitDiagnostic {
+  // Offset of the first byte of the temporal unit from the start of the file.
+  int64_t offset;
+  // Size of the temporal unit in bytes.
+  int64_t size;
+  absl::Status status;
+};
+
+/*!\brief Validates a standalone .iamf file using multiple threads.
+ *
+ * The descriptor OBUs are parsed first. The byte ranges of the temporal units
+ * are then taken from `index`, or found by a cheap scan of the OBU headers
+ * when there is no index. Finally the temporal units are split into
+ * contiguous ranges which are fully parsed in parallel; each thread reads the
+ * file independently and holds its own copy of the descriptor OBUs.
+ *
+ * A temporal unit which cannot be delimited ends the scan, so it is the last
+ * diagnostic and covers the remainder of the file.
+ *
+ * \param file_path Path of the file to validate.
+ * \param num_threads Number of worker threads. Non-positive values validate on
+ *        the calling thread.
+ * \param index Index of the temporal units in the file, or `nullptr` to scan
+ *        for them.
+ * \param diagnostics Output diagnostics of each temporal unit, in file order.
+ * \return `absl::OkStatus()` if the file is valid. The status of the first
+ *         invalid temporal unit if any are invalid.
+ *         `absl::InvalidArgumentError()` if `index` does not describe the
+ *         file. A specific status on failure.
+ */
+absl::Status ValidateIaSequenceFile(
+    const std::filesystem::path& file_path, int num_threads,
+    const TemporalUnitIndex* index,
+    std::vector<TemporalUnitDiagnostic>& diagnostics);
+
+}  // namespace iamf_tools
+
+#endif  // CLI_IA_SEQUENCE_VALIDATOR_H_
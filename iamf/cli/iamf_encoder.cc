@@ -25,6 +25,7 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_decoder.h"
 #include "iamf/cli/audio_frame_with_data.h"
@@ -35,6 +36,7 @@
 #include "iamf/cli/loudness_calculator_factory_base.h"
 #include "iamf/cli/parameter_block_with_data.h"
 #include "iamf/cli/parameters_manager.h"
+#include "iamf/cli/proto/encoder_control_metadata.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/cli/proto/user_metadata.pb.h"
 #include "iamf/cli/proto_to_obu/arbitrary_obu_generator.h"
@@ -88,6 +90,21 @@ absl::Status InitAudioFrameDecoderForAllAudioElements(
   return absl::OkStatus();
 }
 
+// Decoded audio frames are only consumed when computing recon gains.
+bool ComputesReconGains(
+    bool override_computed_recon_gains,
+    const absl::flat_hash_map<DecodedUleb128, const ParamDefinition*>&
+        param_definitions) {
+  if (override_computed_recon_gains) {
+    return false;
+  }
+  return std::any_of(param_definitions.begin(), param_definitions.end(),
+                     [](const auto& id_and_param_definition) {
+                       return id_and_param_definition.second->GetType() ==
+                              ParamDefinition::kParameterDefinitionReconGain;
+                     });
+}
+
 }  // namespace
 
 absl::StatusOr<IamfEncoder> IamfEncoder::Create(
@@ -178,14 +195,21 @@ absl::StatusOr<IamfEncoder> IamfEncoder::Create(
   auto audio_frame_generator = std::make_unique<AudioFrameGenerator>(
       user_metadata.audio_frame_metadata(),
       user_metadata.codec_config_metadata(), audio_elements, *demixing_module,
-      *parameters_manager, *global_timing_module);
+      *parameters_manager, *global_timing_module,
+      user_metadata.encoder_control_metadata().num_encoding_threads());
   RETURN_IF_NOT_OK(audio_frame_generator->Initialize());
 
   // Initialize the audio frame decoder. It is needed to determine the recon
-  // gain parameters and measure the loudness of the mixes.
-  AudioFrameDecoder audio_frame_decoder;
-  RETURN_IF_NOT_OK(InitAudioFrameDecoderForAllAudioElements(
-      audio_elements, audio_frame_decoder));
+  // gain parameters.
+  std::optional<AudioFrameDecoder> audio_frame_decoder;
+  if (user_metadata.encoder_control_metadata().always_decode_audio_frames() ||
+      ComputesReconGains(user_metadata.test_vector_metadata()
+                             .override_computed_recon_gains(),
+                         param_definitions)) {
+    audio_frame_decoder.emplace();
+    RETURN_IF_NOT_OK(InitAudioFrameDecoderForAllAudioElements(
+        audio_elements, *audio_frame_decoder));
+  }
 
   return IamfEncoder(
       user_metadata.test_vector_metadata().validate_user_loudness(),
@@ -193,10 +217,22 @@ absl::StatusOr<IamfEncoder> IamfEncoder::Create(
       std::move(parameter_block_generator), std::move(parameters_manager),
       std::move(demixing_module), std::move(audio_frame_generator),
       std::move(audio_frame_decoder), std::move(global_timing_module),
-      std::move(*mix_presentation_finalizer));
+      std::move(*mix_presentation_finalizer),
+      user_metadata.encoder_control_metadata().pipeline_queue_depth());
 }
 
 bool IamfEncoder::GeneratingDataObus() const {
+  if (pipeline_ == nullptr) {
+    return GeneratingAudioFrames();
+  }
+
+  // Keep going after an error, so the next `OutputTemporalUnit()` reports it.
+  absl::MutexLock lock(&pipeline_->mutex);
+  return !pipeline_->status.ok() || !pipeline_->queue.empty() ||
+         !pipeline_->input_stage_finished;
+}
+
+bool IamfEncoder::GeneratingAudioFrames() const {
   return (audio_frame_generator_ != nullptr) &&
          (audio_frame_generator_->TakingSamples() ||
           audio_frame_generator_->GeneratingFrames());
@@ -211,8 +247,9 @@ void IamfEncoder::BeginTemporalUnit() {
   }
 }
 
-absl::Status IamfEncoder::GetInputTimestamp(int32_t& input_timestamp) {
-  std::optional<int32_t> timestamp;
+absl::Status IamfEncoder::GetInputTimestamp(
+    InternalTimestamp& input_timestamp) {
+  std::optional<InternalTimestamp> timestamp;
   RETURN_IF_NOT_OK(
       global_timing_module_->GetGlobalAudioFrameTimestamp(timestamp));
   if (!timestamp.has_value()) {
@@ -240,26 +277,120 @@ void IamfEncoder::FinalizeAddSamples() { add_samples_finalized_ = true; }
 absl::Status IamfEncoder::AddParameterBlockMetadata(
     const iamf_tools_cli_proto::ParameterBlockObuMetadata&
         parameter_block_metadata) {
+  absl::MutexLockMaybe lock(GetParameterBlockGeneratorMutex());
+  // Recon gain parameter blocks are generated by the output stage; hold their
+  // metadata until then.
+  const auto per_id_metadata_iter =
+      parameter_id_to_metadata_->find(parameter_block_metadata.parameter_id());
+  if (per_id_metadata_iter != parameter_id_to_metadata_->end() &&
+      per_id_metadata_iter->second.param_definition_type ==
+          ParamDefinition::kParameterDefinitionReconGain) {
+    recon_gain_parameter_block_metadata_.push_back(parameter_block_metadata);
+    return absl::OkStatus();
+  }
+
   RETURN_IF_NOT_OK(
       parameter_block_generator_.AddMetadata(parameter_block_metadata));
   return absl::OkStatus();
 }
 
+absl::Status IamfEncoder::EndTemporalUnit() {
+  if (pipeline_ == nullptr) {
+    return absl::FailedPreconditionError(
+        "`EndTemporalUnit()` is only valid when the encoder is pipelined.");
+  }
+
+  EncodedTemporalUnit encoded_temporal_unit;
+  const absl::Status input_stage_status =
+      RunInputStage(encoded_temporal_unit);
+  const bool input_stage_finished = !GeneratingAudioFrames();
+
+  absl::MutexLock lock(&pipeline_->mutex);
+  if (!input_stage_status.ok()) {
+    if (pipeline_->status.ok()) {
+      pipeline_->status = input_stage_status;
+    }
+    return input_stage_status;
+  }
+
+  // Apply backpressure until the output stage catches up.
+  pipeline_->mutex.Await(absl::Condition(
+      pipeline_.get(), &PipelineState::QueueHasRoomOrAborted));
+  RETURN_IF_NOT_OK(pipeline_->status);
+  pipeline_->queue.push_back(std::move(encoded_temporal_unit));
+  pipeline_->input_stage_finished = input_stage_finished;
+  return absl::OkStatus();
+}
+
+void IamfEncoder::AbortPipeline() {
+  if (pipeline_ == nullptr) {
+    return;
+  }
+
+  absl::MutexLock lock(&pipeline_->mutex);
+  if (pipeline_->status.ok()) {
+    pipeline_->status = absl::CancelledError("The pipeline was aborted.");
+  }
+}
+
 absl::Status IamfEncoder::OutputTemporalUnit(
     std::list<AudioFrameWithData>& audio_frames,
     std::list<ParameterBlockWithData>& parameter_blocks) {
   audio_frames.clear();
   parameter_blocks.clear();
 
+  if (pipeline_ == nullptr) {
+    EncodedTemporalUnit encoded_temporal_unit;
+    RETURN_IF_NOT_OK(RunInputStage(encoded_temporal_unit));
+    return RunOutputStage(encoded_temporal_unit, audio_frames,
+                          parameter_blocks);
+  }
+
+  EncodedTemporalUnit encoded_temporal_unit;
+  {
+    absl::MutexLock lock(&pipeline_->mutex);
+    pipeline_->mutex.Await(absl::Condition(
+        pipeline_.get(), &PipelineState::TemporalUnitAvailableOrDone));
+    RETURN_IF_NOT_OK(pipeline_->status);
+    if (pipeline_->queue.empty()) {
+      // The final temporal unit was already output.
+      return absl::OkStatus();
+    }
+    encoded_temporal_unit = std::move(pipeline_->queue.front());
+    pipeline_->queue.pop_front();
+  }
+
+  const absl::Status output_stage_status =
+      RunOutputStage(encoded_temporal_unit, audio_frames, parameter_blocks);
+  if (!output_stage_status.ok()) {
+    absl::MutexLock lock(&pipeline_->mutex);
+    if (pipeline_->status.ok()) {
+      pipeline_->status = output_stage_status;
+    }
+  }
+  return output_stage_status;
+}
+
+absl::Status IamfEncoder::RunInputStage(
+    EncodedTemporalUnit& encoded_temporal_unit) {
   // Generate mix gain and demixing parameter blocks.
-  RETURN_IF_NOT_OK(parameter_block_generator_.GenerateDemixing(
-      *global_timing_module_, temp_demixing_parameter_blocks_));
-  RETURN_IF_NOT_OK(parameter_block_generator_.GenerateMixGain(
-      *global_timing_module_, temp_mix_gain_parameter_blocks_));
+  {
+    absl::MutexLockMaybe lock(GetParameterBlockGeneratorMutex());
+    RETURN_IF_NOT_OK(parameter_block_generator_.GenerateDemixing(
+        *global_timing_module_,
+        encoded_temporal_unit.demixing_parameter_blocks));
+    RETURN_IF_NOT_OK(parameter_block_generator_.GenerateMixGain(
+        *global_timing_module_,
+        encoded_temporal_unit.mix_gain_parameter_blocks));
+    encoded_temporal_unit.recon_gain_parameter_block_metadata =
+        std::move(recon_gain_parameter_block_metadata_);
+    recon_gain_parameter_block_metadata_.clear();
+  }
 
   // Add the newly generated demixing parameter blocks to the parameters
   // manager so they can be easily queried by the audio frame generator.
-  for (const auto& demixing_parameter_block : temp_demixing_parameter_blocks_) {
+  for (const auto& demixing_parameter_block :
+       encoded_temporal_unit.demixing_parameter_blocks) {
     parameters_manager_->AddDemixingParameterBlock(&demixing_parameter_block);
   }
 
@@ -279,7 +410,31 @@ absl::Status IamfEncoder::OutputTemporalUnit(
     RETURN_IF_NOT_OK(audio_frame_generator_->Finalize());
   }
 
-  RETURN_IF_NOT_OK(audio_frame_generator_->OutputFrames(audio_frames));
+  return audio_frame_generator_->OutputFrames(
+      encoded_temporal_unit.audio_frames);
+}
+
+absl::Status IamfEncoder::RunOutputStage(
+    EncodedTemporalUnit& encoded_temporal_unit,
+    std::list<AudioFrameWithData>& audio_frames,
+    std::list<ParameterBlockWithData>& parameter_blocks) {
+  // Splicing keeps the parameter blocks at the same addresses, which the
+  // parameters manager may still refer to.
+  temp_demixing_parameter_blocks_.splice(
+      temp_demixing_parameter_blocks_.end(),
+      encoded_temporal_unit.demixing_parameter_blocks);
+  temp_mix_gain_parameter_blocks_.splice(
+      temp_mix_gain_parameter_blocks_.end(),
+      encoded_temporal_unit.mix_gain_parameter_blocks);
+  {
+    absl::MutexLockMaybe lock(GetParameterBlockGeneratorMutex());
+    for (const auto& metadata :
+         encoded_temporal_unit.recon_gain_parameter_block_metadata) {
+      RETURN_IF_NOT_OK(parameter_block_generator_.AddMetadata(metadata));
+    }
+  }
+
+  audio_frames = std::move(encoded_temporal_unit.audio_frames);
   if (audio_frames.empty()) {
     // Some audio codec will only output an encoded frame after the next
     // frame "pushes" the old one out. So we wait till the next iteration to
@@ -288,34 +443,50 @@ absl::Status IamfEncoder::OutputTemporalUnit(
   }
   // All generated audio frame should be in the same temporal unit; they all
   // have the same timestamps.
-  const int32_t output_start_timestamp = audio_frames.front().start_timestamp;
-  const int32_t output_end_timestamp = audio_frames.front().end_timestamp;
-
-  // Decode the audio frames. They are required to determine the demixed
-  // frames.
-  std::list<DecodedAudioFrame> decoded_audio_frames;
-  for (const auto& audio_frame : audio_frames) {
-    auto decoded_audio_frame = audio_frame_decoder_.Decode(audio_frame);
-    if (!decoded_audio_frame.ok()) {
-      return decoded_audio_frame.status();
-    }
-    CHECK_EQ(output_start_timestamp, decoded_audio_frame->start_timestamp);
-    CHECK_EQ(output_end_timestamp, decoded_audio_frame->end_timestamp);
-    decoded_audio_frames.emplace_back(*decoded_audio_frame);
-  }
+  const InternalTimestamp output_start_timestamp =
+      audio_frames.front().start_timestamp;
+  const InternalTimestamp output_end_timestamp =
+      audio_frames.front().end_timestamp;
 
-  // Demix the audio frames.
   IdLabeledFrameMap id_to_labeled_frame;
   IdLabeledFrameMap id_to_labeled_decoded_frame;
-  RETURN_IF_NOT_OK(demixing_module_->DemixAudioSamples(
-      audio_frames, decoded_audio_frames, id_to_labeled_frame,
-      id_to_labeled_decoded_frame));
+  if (audio_frame_decoder_.has_value()) {
+    // Decode the audio frames. They are required to determine the demixed
+    // frames.
+    std::list<DecodedAudioFrame> decoded_audio_frames;
+    for (const auto& audio_frame : audio_frames) {
+      auto decoded_audio_frame = audio_frame_decoder_->Decode(audio_frame);
+      if (!decoded_audio_frame.ok()) {
+        return decoded_audio_frame.status();
+      }
+      CHECK_EQ(output_start_timestamp, decoded_audio_frame->start_timestamp);
+      CHECK_EQ(output_end_timestamp, decoded_audio_frame->end_timestamp);
+      decoded_audio_frames.emplace_back(*decoded_audio_frame);
+    }
+
+    // Demix the audio frames.
+    RETURN_IF_NOT_OK(demixing_module_->DemixAudioSamples(
+        audio_frames, decoded_audio_frames, id_to_labeled_frame,
+        id_to_labeled_decoded_frame));
+  } else {
+    // Nothing consumes the decoded frames; only the original frames are
+    // demixed, to be rendered.
+    RETURN_IF_NOT_OK(demixing_module_->DemixOriginalAudioSamples(
+        audio_frames, id_to_labeled_frame));
+  }
 
   // Recon gain parameter blocks are generated based on the original and
   // demixed audio frames.
-  RETURN_IF_NOT_OK(parameter_block_generator_.GenerateReconGain(
-      id_to_labeled_frame, id_to_labeled_decoded_frame, *global_timing_module_,
-      temp_recon_gain_parameter_blocks_));
+  {
+    absl::MutexLockMaybe lock(GetParameterBlockGeneratorMutex());
+    RETURN_IF_NOT_OK(parameter_block_generator_.GenerateReconGain(
+        id_to_labeled_frame, id_to_labeled_decoded_frame,
+        *global_timing_module_, temp_recon_gain_parameter_blocks_));
+  }
+
+  // The original samples were only needed to demix and compute recon gains.
+  // Release them so the output frames only hold the encoded audio.
+  audio_frame_generator_->RecyclePcmSamples(audio_frames);
 
   // Move all generated parameter blocks belonging to this temporal unit to
   // the output.
@@ -337,6 +508,11 @@ absl::Status IamfEncoder::OutputTemporalUnit(
       parameter_blocks);
 }
 
+absl::Mutex* IamfEncoder::GetParameterBlockGeneratorMutex() const {
+  return pipeline_ == nullptr ? nullptr
+                              : &pipeline_->parameter_block_generator_mutex;
+}
+
 absl::Status IamfEncoder::FinalizeMixPresentationObus(
     std::list<MixPresentationObu>& mix_presentation_obus) {
   if (GeneratingDataObus()) {
@@ -348,4 +524,40 @@ absl::Status IamfEncoder::FinalizeMixPresentationObus(
                                               mix_presentation_obus);
 }
 
+absl::Status IamfEncoder::Reset(
+    absl::Nullable<const LoudnessCalculatorFactoryBase*>
+        loudness_calculator_factory,
+    const RenderingMixPresentationFinalizer::WavWriterFactory&
+        wav_writer_factory,
+    const absl::flat_hash_map<DecodedUleb128, AudioElementWithData>&
+        audio_elements,
+    const std::list<MixPresentationObu>& mix_presentation_obus) {
+  RETURN_IF_NOT_OK(mix_presentation_finalizer_.Reset(
+      loudness_calculator_factory, wav_writer_factory, mix_presentation_obus));
+
+  global_timing_module_->Reset();
+  parameter_block_generator_.Reset();
+  RETURN_IF_NOT_OK(parameters_manager_->Reset());
+  if (audio_frame_decoder_.has_value()) {
+    audio_frame_decoder_.emplace();
+    RETURN_IF_NOT_OK(InitAudioFrameDecoderForAllAudioElements(
+        audio_elements, *audio_frame_decoder_));
+  }
+  RETURN_IF_NOT_OK(audio_frame_generator_->Reset());
+
+  temp_mix_gain_parameter_blocks_.clear();
+  temp_demixing_parameter_blocks_.clear();
+  temp_recon_gain_parameter_blocks_.clear();
+  id_to_labeled_samples_.clear();
+  recon_gain_parameter_block_metadata_.clear();
+  add_samples_finalized_ = false;
+  if (pipeline_ != nullptr) {
+    pipeline_ = std::make_unique<PipelineState>(
+        pipeline_->queue_depth,
+        /*input_stage_finished=*/!GeneratingAudioFrames());
+  }
+
+  return absl::OkStatus();
+}
+
 }  // namespace iamf_tools
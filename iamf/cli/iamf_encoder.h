@@ -12,7 +12,9 @@
 #ifndef CLI_IAMF_ENCODER_H_
 #define CLI_IAMF_ENCODER_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <list>
 #include <memory>
 #include <optional>
@@ -20,9 +22,11 @@
 #include <vector>
 
 #include "absl/base/nullability.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_decoder.h"
 #include "iamf/cli/audio_frame_with_data.h"
@@ -83,6 +87,33 @@ namespace iamf_tools {
  *   // Get the final mix presentation OBUs, with measured loudness information.
  *   encoder->FinalizeMixPresentationObus(...);
  *
+ * When `pipeline_queue_depth` in the `EncoderControlMetadata` is positive, the
+ * encoder is pipelined. One thread adds the input and another outputs the
+ * OBUs. A bounded queue of encoded temporal units between them provides
+ * backpressure:
+ *   // Input thread:
+ *   while (encoder->GeneratingAudioFrames()) {
+ *     encoder->BeginTemporalUnit();
+ *     // Add samples, finalize, and add parameter block metadata as above.
+ *     // Then queue the temporal unit; this blocks while the queue is full.
+ *     if (!encoder->EndTemporalUnit().ok()) {
+ *       // Handle error.
+ *     }
+ *   }
+ *
+ *   // Output thread:
+ *   while (encoder->GeneratingDataObus()) {
+ *     // Blocks until a temporal unit is queued.
+ *     encoder->OutputTemporalUnit(...);
+ *   }
+ *   encoder->FinalizeMixPresentationObus(...);
+ *
+ * Either thread may call `AbortPipeline()` to unblock the other after an
+ * error.
+ *
+ * Call `Reset()` to encode another IA Sequence with the same descriptor OBUs,
+ * reusing the codec encoders instead of creating a new `IamfEncoder`.
+ *
  * Note the timestamps corresponding to `AddSamples()` and
  * `AddParameterBlockMetadata()` might be different from that of the output
  * OBUs obtained in `OutputTemporalUnit()`, because some codecs introduce a
@@ -123,11 +154,23 @@ class IamfEncoder {
       std::list<ArbitraryObu>& arbitrary_obus);
 
   /*!\brief Returns whether this encoder is generating data OBUs.
+   *
+   * When pipelined, this remains true until all queued temporal units are
+   * output.
    *
    * \return True if still generating data OBUs.
    */
   bool GeneratingDataObus() const;
 
+  /*!\brief Returns whether this encoder is generating audio frames.
+   *
+   * When pipelined, the thread adding samples should use this instead of
+   * `GeneratingDataObus()` to know when to stop.
+   *
+   * \return True if still generating audio frames.
+   */
+  bool GeneratingAudioFrames() const;
+
   /*!\brief Clears the state, e.g. accumulated samples for next temporal unit.
    */
   void BeginTemporalUnit();
@@ -137,7 +180,7 @@ class IamfEncoder {
    * \param input_timestamp Result of input timestamp.
    * \return `absl::OkStatus()` if successful. A specific status on failure.
    */
-  absl::Status GetInputTimestamp(int32_t& input_timestamp);
+  absl::Status GetInputTimestamp(InternalTimestamp& input_timestamp);
 
   /*!\brief Adds audio samples belonging to the same temporal unit.
    *
@@ -168,10 +211,35 @@ class IamfEncoder {
       const iamf_tools_cli_proto::ParameterBlockObuMetadata&
           parameter_block_metadata);
 
+  /*!\brief Ends the current temporal unit and queues it for output.
+   *
+   * Only valid when pipelined. Encodes the samples and generates the parameter
+   * blocks added since `BeginTemporalUnit()`. Then waits until the queue has
+   * room for the temporal unit.
+   *
+   * \return `absl::OkStatus()` if successful. `absl::FailedPreconditionError`
+   *         if the encoder is not pipelined. A specific status on failure or
+   *         if the pipeline was aborted.
+   */
+  absl::Status EndTemporalUnit();
+
+  /*!\brief Aborts a pipelined encoder.
+   *
+   * Wakes any thread waiting in `EndTemporalUnit()` or `OutputTemporalUnit()`.
+   * All subsequent calls to those functions fail. Does nothing when the encoder
+   * is not pipelined.
+   */
+  void AbortPipeline();
+
   /*!\brief Outputs data OBUs corresponding to one temporal unit.
+   *
+   * When pipelined, this waits until a temporal unit is queued by
+   * `EndTemporalUnit()`. The output lists are empty if the final temporal unit
+   * was already output.
    *
    * \param audio_frames List of generated audio frames corresponding to this
-   *        temporal unit.
+   *        temporal unit. Their `pcm_samples` are released after they are
+   *        used to demix and compute recon gains.
    * \param parameter_blocks List of generated parameter block corresponding
    *        to this temporal unit.
    * \return `absl::OkStatus()` if successful. A specific status on failure.
@@ -191,6 +259,32 @@ class IamfEncoder {
   absl::Status FinalizeMixPresentationObus(
       std::list<MixPresentationObu>& mix_presentation_obus);
 
+  /*!\brief Resets the encoder to encode a new IA Sequence.
+   *
+   * The new IA Sequence has the same descriptor OBUs. The codec encoders, the
+   * renderers and the state derived from the descriptor OBUs are reused
+   * instead of being created again. Anything not yet output is discarded, and
+   * the measured loudness starts over. When pipelined, the threads using the
+   * encoder must be joined first.
+   *
+   * \param loudness_calculator_factory Factory to create loudness calculators
+   *        to measure the loudness of the output layouts.
+   * \param wav_writer_factory Factory to create wav writers.
+   * \param audio_elements Audio Elements generated by `Create()`.
+   * \param mix_presentation_obus Mix Presentation OBUs generated by
+   *        `Create()`, which should be finalized by a future call to
+   *        `FinalizeMixPresentationObus()`.
+   * \return `absl::OkStatus()` if successful. A specific status on failure.
+   */
+  absl::Status Reset(
+      absl::Nullable<const LoudnessCalculatorFactoryBase*>
+          loudness_calculator_factory,
+      const RenderingMixPresentationFinalizer::WavWriterFactory&
+          wav_writer_factory,
+      const absl::flat_hash_map<DecodedUleb128, AudioElementWithData>&
+          audio_elements,
+      const std::list<MixPresentationObu>& mix_presentation_obus);
+
  private:
   /*!\brief Private constructor.
    *
@@ -207,8 +301,12 @@ class IamfEncoder {
    * \param demixing_module Module to demix audio elements.
    * \param audio_frame_generator Audio frame generator.
    * \param audio_frame_decoder Decodes the original audio frames, to facilitate
-   *        recon gain computation.
+   *        recon gain computation. `std::nullopt` to skip decoding when
+   *        nothing consumes the decoded frames.
    * \param global_timing_module Manages global timing information.
+   * \param mix_presentation_finalizer Finalizes the Mix Presentation OBUs.
+   * \param pipeline_queue_depth Maximum number of queued temporal units when
+   *        pipelined. Non-positive values disable pipelining.
    */
   IamfEncoder(bool validate_user_loudness,
               std::unique_ptr<
@@ -220,9 +318,10 @@ class IamfEncoder {
               std::unique_ptr<ParametersManager> parameters_manager,
               std::unique_ptr<DemixingModule> demixing_module,
               std::unique_ptr<AudioFrameGenerator> audio_frame_generator,
-              AudioFrameDecoder&& audio_frame_decoder,
+              std::optional<AudioFrameDecoder>&& audio_frame_decoder,
               std::unique_ptr<GlobalTimingModule> global_timing_module,
-              RenderingMixPresentationFinalizer&& mix_presentation_finalizer)
+              RenderingMixPresentationFinalizer&& mix_presentation_finalizer,
+              int pipeline_queue_depth)
       : validate_user_loudness_(validate_user_loudness),
         parameter_id_to_metadata_(std::move(parameter_id_to_metadata)),
         param_definitions_(std::move(param_definitions)),
@@ -232,7 +331,83 @@ class IamfEncoder {
         audio_frame_generator_(std::move(audio_frame_generator)),
         audio_frame_decoder_(std::move(audio_frame_decoder)),
         global_timing_module_(std::move(global_timing_module)),
-        mix_presentation_finalizer_(std::move(mix_presentation_finalizer)) {}
+        mix_presentation_finalizer_(std::move(mix_presentation_finalizer)),
+        // `audio_frame_generator_` is already initialized here.
+        pipeline_(pipeline_queue_depth > 0
+                      ? std::make_unique<PipelineState>(
+                            pipeline_queue_depth,
+                            /*input_stage_finished=*/!GeneratingAudioFrames())
+                      : nullptr) {}
+
+  // Data produced by the input stage for one temporal unit, which is consumed
+  // by the output stage.
+  struct EncodedTemporalUnit {
+    std::list<AudioFrameWithData> audio_frames;
+    std::list<ParameterBlockWithData> mix_gain_parameter_blocks;
+    std::list<ParameterBlockWithData> demixing_parameter_blocks;
+    std::list<iamf_tools_cli_proto::ParameterBlockObuMetadata>
+        recon_gain_parameter_block_metadata;
+  };
+
+  // State shared between the input and output stages when pipelined.
+  struct PipelineState {
+    /*!\brief Constructor.
+     *
+     * \param queue_depth Maximum number of queued temporal units.
+     * \param input_stage_finished Whether the input stage is already
+     *        finished. When there are no audio frames to generate,
+     *        `EndTemporalUnit()` is never called and the output stage must
+     *        not wait for it.
+     */
+    PipelineState(int queue_depth, bool input_stage_finished)
+        : queue_depth(queue_depth),
+          input_stage_finished(input_stage_finished) {}
+
+    bool QueueHasRoomOrAborted() const ABSL_SHARED_LOCKS_REQUIRED(mutex) {
+      return !status.ok() || queue.size() < queue_depth;
+    }
+
+    bool TemporalUnitAvailableOrDone() const
+        ABSL_SHARED_LOCKS_REQUIRED(mutex) {
+      return !status.ok() || !queue.empty() || input_stage_finished;
+    }
+
+    const size_t queue_depth;
+    mutable absl::Mutex mutex;
+    std::deque<EncodedTemporalUnit> queue ABSL_GUARDED_BY(mutex);
+    bool input_stage_finished ABSL_GUARDED_BY(mutex);
+    // Holds the first error from either stage, or an abort.
+    absl::Status status ABSL_GUARDED_BY(mutex);
+
+    // The parameter block generator and the parameter timing data are used by
+    // both stages.
+    absl::Mutex parameter_block_generator_mutex;
+  };
+
+  /*!\brief Encodes the input added for the current temporal unit.
+   *
+   * \param encoded_temporal_unit Output data for the output stage.
+   * \return `absl::OkStatus()` if successful. A specific status on failure.
+   */
+  absl::Status RunInputStage(EncodedTemporalUnit& encoded_temporal_unit);
+
+  /*!\brief Decodes, demixes, and renders an encoded temporal unit.
+   *
+   * \param encoded_temporal_unit Data from the input stage.
+   * \param audio_frames Output audio frames of the temporal unit.
+   * \param parameter_blocks Output parameter blocks of the temporal unit.
+   * \return `absl::OkStatus()` if successful. A specific status on failure.
+   */
+  absl::Status RunOutputStage(
+      EncodedTemporalUnit& encoded_temporal_unit,
+      std::list<AudioFrameWithData>& audio_frames,
+      std::list<ParameterBlockWithData>& parameter_blocks);
+
+  /*!\brief Gets the mutex guarding the parameter block generator.
+   *
+   * \return Mutex to lock when pipelined. `nullptr` otherwise.
+   */
+  absl::Mutex* GetParameterBlockGeneratorMutex() const;
 
   const bool validate_user_loudness_;
 
@@ -256,6 +431,11 @@ class IamfEncoder {
   // iteration.
   absl::flat_hash_map<DecodedUleb128, LabelSamplesMap> id_to_labeled_samples_;
 
+  // Recon gain parameter block metadata added in the same iteration. They are
+  // handed to the output stage, which computes the recon gains.
+  std::list<iamf_tools_cli_proto::ParameterBlockObuMetadata>
+      recon_gain_parameter_block_metadata_;
+
   // Whether the `FinalizeAddSamples()` has been called.
   bool add_samples_finalized_ = false;
 
@@ -265,11 +445,15 @@ class IamfEncoder {
   absl::Nonnull<std::unique_ptr<ParametersManager>> parameters_manager_;
   absl::Nonnull<std::unique_ptr<DemixingModule>> demixing_module_;
   absl::Nonnull<std::unique_ptr<AudioFrameGenerator>> audio_frame_generator_;
-  AudioFrameDecoder audio_frame_decoder_;
+  std::optional<AudioFrameDecoder> audio_frame_decoder_;
   absl::Nonnull<std::unique_ptr<GlobalTimingModule>> global_timing_module_;
 
   // Modules to render the output layouts and measure their loudness.
   RenderingMixPresentationFinalizer mix_presentation_finalizer_;
+
+  // `nullptr` when not pipelined. Held in `std::unique_ptr` because mutexes
+  // are not movable.
+  std::unique_ptr<PipelineState> pipeline_;
 };
 
 }  // namespace iamf_tools
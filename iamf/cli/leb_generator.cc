@@ -190,6 +190,33 @@ absl::Status LebGenerator::Uleb128ToUint8Vector(
   }
 }
 
+absl::Status LebGenerator::GetUleb128Size(DecodedUleb128 input,
+                                          int8_t& size) const {
+  // Each byte encodes 7 bits of the value.
+  int8_t minimum_size = 1;
+  for (DecodedUleb128 remaining_bits = input >> 7; remaining_bits != 0;
+       remaining_bits >>= 7) {
+    ++minimum_size;
+  }
+
+  switch (generation_mode_) {
+    case GenerationMode::kMinimum:
+      size = minimum_size;
+      return absl::OkStatus();
+    case GenerationMode::kFixedSize:
+      if (minimum_size > fixed_size_) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            input, " requires at least ", static_cast<int>(minimum_size),
+            " bytes. The caller requested it have a fixed size of ",
+            static_cast<int>(fixed_size_)));
+      }
+      size = fixed_size_;
+      return absl::OkStatus();
+    default:
+      return absl::UnknownError("Unknown `generation_mode_`.");
+  }
+}
+
 absl::Status LebGenerator::Sleb128ToUint8Vector(
     DecodedSleb128 input, std::vector<uint8_t>& buffer) const {
   switch (generation_mode_) {
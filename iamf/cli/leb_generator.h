@@ -70,6 +70,17 @@ class LebGenerator {
   absl::Status Uleb128ToUint8Vector(DecodedUleb128 input,
                                     std::vector<uint8_t>& buffer) const;
 
+  /*!\brief Gets the number of bytes `Uleb128ToUint8Vector()` would generate.
+   *
+   * The size is computed without generating the ULEB128.
+   *
+   * \param input Input value.
+   * \param size Number of bytes in the encoded ULEB128.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the generation would fail.
+   */
+  absl::Status GetUleb128Size(DecodedUleb128 input, int8_t& size) const;
+
   /*!\brief Encodes a `DecodedSleb128` to a vector representing a SLEB128.
    *
    * The behavior of the generator is controlled by `generation_mode_`. When
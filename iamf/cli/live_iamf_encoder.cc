@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/live_iamf_encoder.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/cli/audio_frame_with_data.h"
+#include "iamf/cli/channel_label.h"
+#include "iamf/cli/iamf_encoder.h"
+#include "iamf/cli/obu_sequencer.h"
+#include "iamf/cli/parameter_block_with_data.h"
+#include "iamf/cli/proto/parameter_block.pb.h"
+#include "iamf/cli/proto/user_metadata.pb.h"
+#include "iamf/cli/proto_to_obu/audio_frame_generator.h"
+#include "iamf/common/macros.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+
+namespace {
+
+absl::Status ComputeAlgorithmicLatencies(
+    const iamf_tools_cli_proto::UserMetadata& user_metadata,
+    const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+    absl::flat_hash_map<DecodedUleb128, LiveIamfEncoder::AlgorithmicLatency>&
+        codec_config_id_to_latency) {
+  for (const auto& codec_config_metadata :
+       user_metadata.codec_config_metadata()) {
+    const auto codec_config_iter =
+        codec_config_obus.find(codec_config_metadata.codec_config_id());
+    if (codec_config_iter == codec_config_obus.end()) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("No Codec Config OBU found for ID= ",
+                       codec_config_metadata.codec_config_id()));
+    }
+    const CodecConfigObu& codec_config = codec_config_iter->second;
+    const auto codec_delay =
+        AudioFrameGenerator::GetNumberOfSamplesToDelayAtStart(
+            codec_config_metadata.codec_config(), codec_config);
+    if (!codec_delay.ok()) {
+      return codec_delay.status();
+    }
+
+    const uint32_t num_samples_per_frame = codec_config.GetNumSamplesPerFrame();
+    codec_config_id_to_latency[codec_config_iter->first] = {
+        .sample_rate = codec_config.GetOutputSampleRate(),
+        .num_samples_per_frame = num_samples_per_frame,
+        .codec_delay = *codec_delay,
+        .num_samples = num_samples_per_frame + *codec_delay};
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::StatusOr<LiveIamfEncoder> LiveIamfEncoder::Create(
+    const iamf_tools_cli_proto::UserMetadata& user_metadata,
+    const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+    const absl::flat_hash_map<DecodedUleb128, AudioElementWithData>&
+        audio_elements,
+    IamfEncoder&& iamf_encoder, TemporalUnitCallback temporal_unit_callback) {
+  if (user_metadata.encoder_control_metadata().pipeline_queue_depth() > 0) {
+    return absl::InvalidArgumentError(
+        "A live encoder cannot drive a pipelined `IamfEncoder`.");
+  }
+
+  // The channels to expect for each audio element are the same as those read
+  // from wav files.
+  absl::flat_hash_map<DecodedUleb128, AudioElementInput> id_to_input;
+  for (const auto& audio_frame_metadata :
+       user_metadata.audio_frame_metadata()) {
+    const DecodedUleb128 audio_element_id =
+        audio_frame_metadata.audio_element_id();
+    const auto audio_element_iter = audio_elements.find(audio_element_id);
+    if (audio_element_iter == audio_elements.end() ||
+        audio_element_iter->second.codec_config == nullptr) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "No Audio Element with a codec config found for ID= ",
+          audio_element_id));
+    }
+
+    std::vector<ChannelLabel::Label> labels;
+    RETURN_IF_NOT_OK(
+        ChannelLabel::SelectConvertAndFillLabels(audio_frame_metadata, labels));
+    auto& input = id_to_input[audio_element_id];
+    input.num_samples_per_frame =
+        audio_element_iter->second.codec_config->GetNumSamplesPerFrame();
+    for (const auto label : labels) {
+      input.label_to_samples[label].reserve(input.num_samples_per_frame);
+    }
+  }
+
+  absl::flat_hash_map<DecodedUleb128, AlgorithmicLatency>
+      codec_config_id_to_latency;
+  RETURN_IF_NOT_OK(ComputeAlgorithmicLatencies(
+      user_metadata, codec_config_obus, codec_config_id_to_latency));
+
+  return LiveIamfEncoder(std::move(iamf_encoder),
+                         std::move(temporal_unit_callback),
+                         std::move(id_to_input),
+                         std::move(codec_config_id_to_latency));
+}
+
+absl::Status LiveIamfEncoder::PushSamples(
+    DecodedUleb128 audio_element_id, ChannelLabel::Label label,
+    absl::Span<const InternalSampleType> samples) {
+  if (flushed_) {
+    return absl::FailedPreconditionError(
+        "Cannot push samples after `Flush()`.");
+  }
+  const auto input_iter = id_to_input_.find(audio_element_id);
+  if (input_iter == id_to_input_.end()) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "No audio frame metadata found for Audio Element ID= ",
+        audio_element_id));
+  }
+  const auto samples_iter = input_iter->second.label_to_samples.find(label);
+  if (samples_iter == input_iter->second.label_to_samples.end()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Unexpected channel label ",
+                     ChannelLabel::LabelToStringForDebugging(label),
+                     " for Audio Element ID= ", audio_element_id));
+  }
+  samples_iter->second.insert(samples_iter->second.end(), samples.begin(),
+                              samples.end());
+
+  while (TemporalUnitIsBuffered()) {
+    RETURN_IF_NOT_OK(EncodeTemporalUnit(/*flush=*/false));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status LiveIamfEncoder::PushParameterBlockMetadata(
+    const iamf_tools_cli_proto::ParameterBlockObuMetadata&
+        parameter_block_metadata) {
+  if (flushed_) {
+    return absl::FailedPreconditionError(
+        "Cannot push parameter block metadata after `Flush()`.");
+  }
+  time_to_parameter_block_metadata_[parameter_block_metadata.start_timestamp()]
+      .push_back(parameter_block_metadata);
+  return absl::OkStatus();
+}
+
+absl::Status LiveIamfEncoder::Flush() {
+  if (flushed_) {
+    return absl::FailedPreconditionError("`Flush()` was already called.");
+  }
+  flushed_ = true;
+
+  // The first iteration adds the partial final frame, if any. The others
+  // drain the codecs.
+  while (iamf_encoder_.GeneratingDataObus()) {
+    RETURN_IF_NOT_OK(EncodeTemporalUnit(/*flush=*/true));
+  }
+  return absl::OkStatus();
+}
+
+bool LiveIamfEncoder::TemporalUnitIsBuffered() const {
+  return std::all_of(
+      id_to_input_.begin(), id_to_input_.end(), [](const auto& id_and_input) {
+        const auto& input = id_and_input.second;
+        return std::all_of(input.label_to_samples.begin(),
+                           input.label_to_samples.end(),
+                           [&input](const auto& label_and_samples) {
+                             return label_and_samples.second.size() >=
+                                    input.num_samples_per_frame;
+                           });
+      });
+}
+
+absl::Status LiveIamfEncoder::EncodeTemporalUnit(bool flush) {
+  iamf_encoder_.BeginTemporalUnit();
+  InternalTimestamp input_timestamp = 0;
+  RETURN_IF_NOT_OK(iamf_encoder_.GetInputTimestamp(input_timestamp));
+
+  // Move one frame out of each buffer. The remaining samples are fewer than a
+  // frame, so shifting them down is cheap.
+  for (auto& [audio_element_id, input] : id_to_input_) {
+    for (auto& [label, samples] : input.label_to_samples) {
+      const auto frame_end =
+          samples.begin() +
+          std::min<size_t>(samples.size(), input.num_samples_per_frame);
+      if (frame_end == samples.begin()) {
+        // Nothing is left to add while flushing.
+        continue;
+      }
+      frame_samples_.assign(samples.begin(), frame_end);
+      samples.erase(samples.begin(), frame_end);
+      iamf_encoder_.AddSamples(audio_element_id, label, frame_samples_);
+    }
+  }
+  if (flush) {
+    iamf_encoder_.FinalizeAddSamples();
+  }
+
+  // Add the parameter block metadata which starts by this temporal unit.
+  // Late metadata is still added, so the encoder reports the gap.
+  while (!time_to_parameter_block_metadata_.empty() &&
+         time_to_parameter_block_metadata_.begin()->first <= input_timestamp) {
+    for (const auto& metadata :
+         time_to_parameter_block_metadata_.begin()->second) {
+      RETURN_IF_NOT_OK(iamf_encoder_.AddParameterBlockMetadata(metadata));
+    }
+    time_to_parameter_block_metadata_.erase(
+        time_to_parameter_block_metadata_.begin());
+  }
+
+  std::list<AudioFrameWithData> audio_frames;
+  std::list<ParameterBlockWithData> parameter_blocks;
+  RETURN_IF_NOT_OK(
+      iamf_encoder_.OutputTemporalUnit(audio_frames, parameter_blocks));
+  active_parameter_blocks_.splice(active_parameter_blocks_.end(),
+                                  parameter_blocks);
+  if (audio_frames.empty()) {
+    // The codecs have not output this frame yet.
+    return absl::OkStatus();
+  }
+
+  TemporalUnitMap temporal_unit_map;
+  RETURN_IF_NOT_OK(ObuSequencerBase::GenerateTemporalUnitMap(
+      audio_frames, active_parameter_blocks_, /*arbitrary_obus=*/{},
+      temporal_unit_map));
+  for (const auto& [start_timestamp, temporal_unit] : temporal_unit_map) {
+    RETURN_IF_NOT_OK(temporal_unit_callback_(start_timestamp, temporal_unit));
+  }
+
+  // Parameter blocks which end by the end of this temporal unit cannot overlap
+  // any future temporal units.
+  const InternalTimestamp end_timestamp = audio_frames.back().end_timestamp;
+  active_parameter_blocks_.remove_if(
+      [end_timestamp](const ParameterBlockWithData& parameter_block) {
+        return parameter_block.end_timestamp <= end_timestamp;
+      });
+  return absl::OkStatus();
+}
+
+}  // namespace iamf_tools
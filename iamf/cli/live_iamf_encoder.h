@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#ifndef CLI_LIVE_IAMF_ENCODER_H_
+#define CLI_LIVE_IAMF_ENCODER_H_
+
+#include <cstdint>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/span.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/cli/channel_label.h"
+#include "iamf/cli/demixing_module.h"
+#include "iamf/cli/iamf_encoder.h"
+#include "iamf/cli/obu_sequencer.h"
+#include "iamf/cli/parameter_block_with_data.h"
+#include "iamf/cli/proto/parameter_block.pb.h"
+#include "iamf/cli/proto/user_metadata.pb.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+
+/*!\brief Drives an `IamfEncoder` from a live source of audio.
+ *
+ * Samples may be pushed in chunks of any size. Whenever a full frame is
+ * buffered for every channel of every audio element, a temporal unit is
+ * encoded, and its OBUs are handed to a callback as soon as the codecs output
+ * them. The use pattern of this class is:
+ *   // Create an `IamfEncoder`, generating the descriptor OBUs. Pass `nullptr`
+ *   // renderer and loudness calculator factories, so nothing accumulates
+ *   // across the whole programme.
+ *   auto live_encoder = LiveIamfEncoder::Create(
+ *       user_metadata, codec_config_obus, audio_elements,
+ *       std::move(*iamf_encoder),
+ *       [&](InternalTimestamp start_timestamp,
+ *           const TemporalUnit& temporal_unit) {
+ *         return obu_sequencer->PushTemporalUnit(start_timestamp,
+ *                                                temporal_unit);
+ *       });
+ *
+ *   while (capturing) {
+ *     // For each captured block of samples, in any chunk size:
+ *     live_encoder->PushSamples(audio_element_id, label, samples);
+ *     // For parameter blocks as they are decided:
+ *     live_encoder->PushParameterBlockMetadata(metadata);
+ *   }
+ *   // Encode the buffered samples and drain the codecs.
+ *   live_encoder->Flush();
+ *
+ * Only the samples of the frame being filled, parameter blocks which may still
+ * overlap a future temporal unit and the state of the codecs are held. The
+ * encoder must not be pipelined, i.e. `pipeline_queue_depth` must not be
+ * positive.
+ */
+class LiveIamfEncoder {
+ public:
+  /*!\brief Algorithmic latency of a codec config, measured in samples.
+   *
+   * A sample pushed at the start of a frame waits for the rest of the frame to
+   * be buffered, and is then delayed by the codec. Processing time is not
+   * included.
+   */
+  struct AlgorithmicLatency {
+    // Sample rate in which the latency is measured.
+    uint32_t sample_rate;
+    // Samples buffered before a frame is encoded.
+    uint32_t num_samples_per_frame;
+    // Samples of delay added by the encoder, e.g. the Opus pre-skip.
+    uint32_t codec_delay;
+    // Sum of `num_samples_per_frame` and `codec_delay`.
+    uint32_t num_samples;
+  };
+
+  /*!\brief Receives the start timestamp and OBUs of one temporal unit.
+   *
+   * The pointed-to OBUs are only valid during the call. A non-OK status is
+   * returned from the call which encoded the temporal unit.
+   */
+  typedef absl::AnyInvocable<absl::Status(InternalTimestamp start_timestamp,
+                                          const TemporalUnit& temporal_unit)>
+      TemporalUnitCallback;
+
+  /*!\brief Factory function to create a `LiveIamfEncoder`.
+   *
+   * \param user_metadata User metadata which `iamf_encoder` was created from.
+   * \param codec_config_obus Codec Config OBUs generated by `iamf_encoder`.
+   * \param audio_elements Audio Elements generated by `iamf_encoder`.
+   * \param iamf_encoder Encoder to take ownership of.
+   * \param temporal_unit_callback Callback to receive each temporal unit.
+   * \return Created instance on success. A specific status on failure.
+   */
+  static absl::StatusOr<LiveIamfEncoder> Create(
+      const iamf_tools_cli_proto::UserMetadata& user_metadata,
+      const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+      const absl::flat_hash_map<DecodedUleb128, AudioElementWithData>&
+          audio_elements,
+      IamfEncoder&& iamf_encoder, TemporalUnitCallback temporal_unit_callback);
+
+  /*!\brief Pushes samples for one channel of an audio element.
+   *
+   * Encodes and outputs every temporal unit which became complete.
+   *
+   * \param audio_element_id ID of the audio element to push samples to.
+   * \param label Channel label to push samples to.
+   * \param samples Samples to push. May be of any length.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the audio element or label is unknown.
+   *         `absl::FailedPreconditionError()` after `Flush()`. A specific
+   *         status if encoding or the callback fails.
+   */
+  absl::Status PushSamples(DecodedUleb128 audio_element_id,
+                           ChannelLabel::Label label,
+                           absl::Span<const InternalSampleType> samples);
+
+  /*!\brief Pushes parameter block metadata.
+   *
+   * The metadata is used when the temporal unit containing its start
+   * timestamp is encoded. Metadata must be pushed before the samples which
+   * complete that temporal unit.
+   *
+   * \param parameter_block_metadata Parameter block metadata to push.
+   * \return `absl::OkStatus()` on success. `absl::FailedPreconditionError()`
+   *         after `Flush()`.
+   */
+  absl::Status PushParameterBlockMetadata(
+      const iamf_tools_cli_proto::ParameterBlockObuMetadata&
+          parameter_block_metadata);
+
+  /*!\brief Encodes the remaining samples and drains the codecs.
+   *
+   * The final frame may be partial. No more samples may be pushed afterwards.
+   *
+   * \return `absl::OkStatus()` on success. `absl::FailedPreconditionError()`
+   *         if called twice. A specific status if encoding or the callback
+   *         fails.
+   */
+  absl::Status Flush();
+
+  /*!\brief Gets the algorithmic latency of each codec config.
+   *
+   * \return Map of Codec Config ID to its algorithmic latency.
+   */
+  const absl::flat_hash_map<DecodedUleb128, AlgorithmicLatency>&
+  GetAlgorithmicLatencies() const {
+    return codec_config_id_to_latency_;
+  }
+
+ private:
+  // Samples of one audio element which are buffered until a frame is full.
+  struct AudioElementInput {
+    uint32_t num_samples_per_frame;
+    LabelSamplesMap label_to_samples;
+  };
+
+  /*!\brief Private constructor.
+   *
+   * \param iamf_encoder Encoder to take ownership of.
+   * \param temporal_unit_callback Callback to receive each temporal unit.
+   * \param id_to_input Map of Audio Element ID to its buffered input.
+   * \param codec_config_id_to_latency Map of Codec Config ID to its
+   *        algorithmic latency.
+   */
+  LiveIamfEncoder(
+      IamfEncoder&& iamf_encoder, TemporalUnitCallback temporal_unit_callback,
+      absl::flat_hash_map<DecodedUleb128, AudioElementInput>&& id_to_input,
+      absl::flat_hash_map<DecodedUleb128, AlgorithmicLatency>&&
+          codec_config_id_to_latency)
+      : iamf_encoder_(std::move(iamf_encoder)),
+        temporal_unit_callback_(std::move(temporal_unit_callback)),
+        id_to_input_(std::move(id_to_input)),
+        codec_config_id_to_latency_(std::move(codec_config_id_to_latency)) {}
+
+  /*!\brief Checks whether a full frame is buffered for every channel.
+   *
+   * \return True if a temporal unit can be encoded.
+   */
+  bool TemporalUnitIsBuffered() const;
+
+  /*!\brief Encodes one temporal unit and outputs any resulting OBUs.
+   *
+   * \param flush Whether to add all remaining samples and finalize the input.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status EncodeTemporalUnit(bool flush);
+
+  IamfEncoder iamf_encoder_;
+  TemporalUnitCallback temporal_unit_callback_;
+
+  // Buffered samples, keyed by Audio Element ID.
+  absl::flat_hash_map<DecodedUleb128, AudioElementInput> id_to_input_;
+
+  const absl::flat_hash_map<DecodedUleb128, AlgorithmicLatency>
+      codec_config_id_to_latency_;
+
+  // Pushed parameter block metadata, keyed by start timestamp.
+  absl::btree_map<InternalTimestamp,
+                  std::list<iamf_tools_cli_proto::ParameterBlockObuMetadata>>
+      time_to_parameter_block_metadata_;
+
+  // Parameter blocks which may overlap the next temporal unit.
+  std::list<ParameterBlockWithData> active_parameter_blocks_;
+
+  // Scratch buffer of one frame of samples of one channel.
+  std::vector<InternalSampleType> frame_samples_;
+
+  bool flushed_ = false;
+};
+
+}  // namespace iamf_tools
+
+#endif  // CLI_LIVE_IAMF_ENCODER_H_
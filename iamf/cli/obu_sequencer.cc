@@ -17,6 +17,7 @@
 #include <fstream>
 #include <functional>
 #include <ios>
+#include <iterator>
 #include <list>
 #include <optional>
 #include <string>
@@ -30,10 +31,15 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_with_data.h"
+#include "iamf/cli/leb_generator.h"
 #include "iamf/cli/parameter_block_with_data.h"
 #include "iamf/cli/profile_filter.h"
+#include "iamf/common/gather_file_writer.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/arbitrary_obu.h"
@@ -42,9 +48,11 @@
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/ia_sequence_header.h"
 #include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/obu_base.h"
 #include "iamf/obu/obu_header.h"
 #include "iamf/obu/parameter_block.h"
 #include "iamf/obu/temporal_delimiter.h"
+#include "iamf/obu/types.h"
 
 namespace iamf_tools {
 
@@ -65,50 +73,85 @@ std::vector<uint32_t> SortedKeys(const KeyValueMap& map,
   return keys;
 }
 
-// The caller of this function should pre-seed the write buffer with Descriptor
-// OBUs.
-absl::Status WriteIaSequenceToFile(const std::string& iamf_filename,
-                                   bool include_temporal_delimiters,
-                                   const TemporalUnitMap& temporal_unit_map,
-                                   WriteBitBuffer& wb) {
-  std::optional<std::fstream> output_iamf;
-  if (!iamf_filename.empty()) {
-    output_iamf.emplace(iamf_filename, std::fstream::out | std::ios::binary);
-  }
-
-  // Write all Audio Frame and Parameter Block OBUs ordered by temporal unit.
-  int num_samples = 0;
-  for (const auto& temporal_unit : temporal_unit_map) {
-    // The temporal units will typically be the largest part of an IAMF
-    // sequence. Occasionally flush to buffer to avoid keeping it all in memory.
-    RETURN_IF_NOT_OK(wb.MaybeFlushIfCloseToCapacity(output_iamf));
-
-    RETURN_IF_NOT_OK(ObuSequencerBase::WriteTemporalUnit(
-        include_temporal_delimiters, temporal_unit.second, wb, num_samples));
-  }
-  LOG(INFO) << "Wrote " << temporal_unit_map.size()
-            << " temporal units with a total of " << num_samples
-            << " samples excluding padding.";
-
-  // Flush any unwritten bytes before exiting.
-  RETURN_IF_NOT_OK(wb.FlushAndWriteToFile(output_iamf));
-  return absl::OkStatus();
-}
-
 void MaybeRemoveFile(const std::string& filename) {
   if (filename.empty()) {
     return;
   }
   std::error_code error_code;
   std::filesystem::remove(filename, error_code);
-  if (!error_code) {
+  if (error_code) {
     // File clean up failed somehow. Just log the error and move on.
     LOG(ERROR).WithPerror() << "Failed to remove " << filename;
   }
 }
 
+absl::StatusOr<int64_t> GetSerializedObuSize(
+    const ObuBase& obu, const LebGenerator& leb_generator) {
+  // Most descriptor OBUs are small. The buffer resizes as needed.
+  constexpr int64_t kObuBufferStartSize = 1024;
+  WriteBitBuffer wb(kObuBufferStartSize, leb_generator);
+  RETURN_IF_NOT_OK(obu.ValidateAndWriteObu(wb));
+  return wb.bit_offset() / 8;
+}
+
+// Returns the bytes written to the buffer so far.
+absl::Span<const uint8_t> WrittenBytes(const WriteBitBuffer& wb) {
+  return absl::MakeConstSpan(wb.bit_buffer()).first(wb.bit_offset() / 8);
+}
+
+/*!\brief Adds a parameter block to every temporal unit it overlaps.
+ *
+ * Temporal units are keyed by start time, so the overlapping ones are found by
+ * a binary search instead of by visiting every temporal unit.
+ *
+ * \param parameter_block Parameter block to add.
+ * \param temporal_unit_map Map of start timestamp -> `TemporalUnit`.
+ * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if an
+ *         overlapping temporal unit has no audio frames.
+ */
+absl::Status AddParameterBlockToOverlappingTemporalUnits(
+    const ParameterBlockWithData& parameter_block,
+    TemporalUnitMap& temporal_unit_map) {
+  const InternalTimestamp obu_start_time = parameter_block.start_timestamp;
+  const InternalTimestamp obu_end_time = parameter_block.end_timestamp;
+
+  // The last temporal unit which starts at or before the parameter block
+  // overlaps it if it ends after the parameter block starts.
+  auto temporal_unit_iter = temporal_unit_map.upper_bound(obu_start_time);
+  if (temporal_unit_iter != temporal_unit_map.begin()) {
+    TemporalUnit& temporal_unit = std::prev(temporal_unit_iter)->second;
+    if (temporal_unit.audio_frames.empty()) {
+      return absl::InvalidArgumentError("Temporal unit has no audio frames.");
+    }
+    if (obu_start_time < temporal_unit.audio_frames[0]->end_timestamp) {
+      temporal_unit.parameter_blocks.push_back(&parameter_block);
+    }
+  }
+
+  // Every later temporal unit which starts during the parameter block overlaps
+  // it.
+  for (; temporal_unit_iter != temporal_unit_map.end() &&
+         temporal_unit_iter->first < obu_end_time;
+       ++temporal_unit_iter) {
+    TemporalUnit& temporal_unit = temporal_unit_iter->second;
+    if (temporal_unit.audio_frames.empty()) {
+      return absl::InvalidArgumentError("Temporal unit has no audio frames.");
+    }
+    temporal_unit.parameter_blocks.push_back(&parameter_block);
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace
 
+ObuSequencerBase::ObuSequencerBase(const LebGenerator& leb_generator,
+                                   bool include_temporal_delimiters,
+                                   int64_t reserved_mix_presentation_bytes)
+    : leb_generator_(leb_generator),
+      include_temporal_delimiters_(include_temporal_delimiters),
+      reserved_mix_presentation_bytes_(reserved_mix_presentation_bytes),
+      wb_(kBufferStartSize, leb_generator_) {}
+
 absl::Status ObuSequencerBase::GenerateTemporalUnitMap(
     const std::list<AudioFrameWithData>& audio_frames,
     const std::list<ParameterBlockWithData>& parameter_blocks,
@@ -150,26 +193,8 @@ absl::Status ObuSequencerBase::GenerateTemporalUnitMap(
 
   // Put all parameter blocks into every temporal unit they overlap.
   for (const auto& parameter_block : parameter_blocks) {
-    // Get the start and end time of the parameter block.
-    const int32_t obu_start_time = parameter_block.start_timestamp;
-    const int32_t obu_end_time = parameter_block.end_timestamp;
-
-    for (auto& temporal_unit : temporal_unit_map) {
-      const int32_t temporal_unit_start = temporal_unit.first;
-      if (temporal_unit.second.audio_frames.empty()) {
-        return absl::InvalidArgumentError("Temporal unit has no audio frames.");
-      }
-      const int32_t temporal_unit_end =
-          temporal_unit.second.audio_frames[0]->end_timestamp;
-
-      // Check if the temporal unit starts or ends during the parameter block.
-      if ((obu_start_time < temporal_unit_start &&
-           temporal_unit_start < obu_end_time) ||
-          (temporal_unit_start <= obu_start_time &&
-           obu_start_time < temporal_unit_end)) {
-        temporal_unit.second.parameter_blocks.push_back(&parameter_block);
-      }
-    }
+    RETURN_IF_NOT_OK(AddParameterBlockToOverlappingTemporalUnits(
+        parameter_block, temporal_unit_map));
   }
 
   // Sort within each temporal unit by Parameter ID.
@@ -206,7 +231,7 @@ absl::Status WriteObusWithHook(
 }
 
 absl::Status AccumulateNumSamples(const TemporalUnit& temporal_unit,
-                                  int& num_samples) {
+                                  int64_t& num_samples) {
   if (temporal_unit.audio_frames.empty()) {
     // Exit early even when `IGNORE_ERRORS_USE_ONLY_FOR_IAMF_TEST_SUITE` is set.
     return absl::InvalidArgumentError(
@@ -231,9 +256,32 @@ absl::Status AccumulateNumSamples(const TemporalUnit& temporal_unit,
   return absl::OkStatus();
 }
 
-absl::Status ObuSequencerBase::WriteTemporalUnit(
+namespace {
+
+// An audio frame which is output by reference, rather than being copied into
+// the write buffer.
+struct AudioFrameReference {
+  // Offset in the write buffer where the audio frame belongs.
+  int64_t offset;
+  absl::Span<const uint8_t> audio_frame;
+};
+
+/*!\brief Serializes a temporal unit.
+ *
+ * \param include_temporal_delimiters Whether the serialized data should
+ *        include a temporal delimiter.
+ * \param temporal_unit Temporal unit to write out.
+ * \param wb Write buffer to write to.
+ * \param num_samples Number of samples written out.
+ * \param audio_frame_references Output references to the audio frames, which
+ *        are then omitted from `wb`, or `nullptr` to write the audio frames
+ *        to `wb`.
+ * \return `absl::OkStatus()` on success. A specific status on failure.
+ */
+absl::Status SerializeTemporalUnit(
     bool include_temporal_delimiters, const TemporalUnit& temporal_unit,
-    WriteBitBuffer& wb, int& num_samples) {
+    WriteBitBuffer& wb, int64_t& num_samples,
+    std::vector<AudioFrameReference>* audio_frame_references) {
   MAYBE_RETURN_IF_NOT_OK(AccumulateNumSamples(temporal_unit, num_samples));
 
   if (include_temporal_delimiters) {
@@ -258,7 +306,18 @@ absl::Status ObuSequencerBase::WriteTemporalUnit(
 
   // Write Audio Frame OBUs.
   for (const auto& audio_frame : temporal_unit.audio_frames) {
-    RETURN_IF_NOT_OK(audio_frame->obu.ValidateAndWriteObu(wb));
+    if (audio_frame_references == nullptr) {
+      RETURN_IF_NOT_OK(audio_frame->obu.ValidateAndWriteObu(wb));
+    } else {
+      // Only the small header goes through the buffer. The frame itself is
+      // referenced in place.
+      const AudioFrameObu& obu = audio_frame->obu;
+      RETURN_IF_NOT_OK(obu.ValidateAndWriteObuPrefix(wb));
+      audio_frame_references->push_back(
+          {.offset = wb.bit_offset() / 8,
+           .audio_frame = absl::MakeConstSpan(obu.audio_frame_)});
+      RETURN_IF_NOT_OK(wb.WriteUint8Span(absl::MakeConstSpan(obu.footer_)));
+    }
     LOG_FIRST_N(INFO, 10) << "wb.bit_offset= " << wb.bit_offset()
                           << " after Audio Frame";
   }
@@ -274,6 +333,37 @@ absl::Status ObuSequencerBase::WriteTemporalUnit(
   return absl::OkStatus();
 }
 
+/*!\brief Interleaves the written bytes with the referenced audio frames.
+ *
+ * \param written_bytes Bytes written to the write buffer.
+ * \param audio_frame_references References to the audio frames, in order.
+ * \return Spans whose concatenation is the serialized temporal unit.
+ */
+std::vector<absl::Span<const uint8_t>> GatherTemporalUnit(
+    absl::Span<const uint8_t> written_bytes,
+    const std::vector<AudioFrameReference>& audio_frame_references) {
+  std::vector<absl::Span<const uint8_t>> spans;
+  spans.reserve(2 * audio_frame_references.size() + 1);
+  int64_t start = 0;
+  for (const auto& [offset, audio_frame] : audio_frame_references) {
+    spans.push_back(written_bytes.subspan(start, offset - start));
+    spans.push_back(audio_frame);
+    start = offset;
+  }
+  spans.push_back(written_bytes.subspan(start));
+  return spans;
+}
+
+}  // namespace
+
+absl::Status ObuSequencerBase::WriteTemporalUnit(
+    bool include_temporal_delimiters, const TemporalUnit& temporal_unit,
+    WriteBitBuffer& wb, int64_t& num_samples) {
+  return SerializeTemporalUnit(include_temporal_delimiters, temporal_unit, wb,
+                               num_samples,
+                               /*audio_frame_references=*/nullptr);
+}
+
 absl::Status ObuSequencerBase::WriteDescriptorObus(
     const IASequenceHeaderObu& ia_sequence_header_obu,
     const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
@@ -342,7 +432,144 @@ absl::Status ObuSequencerBase::WriteDescriptorObus(
   return absl::OkStatus();
 }
 
-absl::Status ObuSequencerIamf::PickAndPlace(
+absl::Status ObuSequencerBase::PushDescriptorObus(
+    const IASequenceHeaderObu& ia_sequence_header_obu,
+    const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+    const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
+    const std::list<MixPresentationObu>& mix_presentation_obus,
+    const std::list<ArbitraryObu>& arbitrary_obus) {
+  if (state_ != kInitialized) {
+    return absl::FailedPreconditionError(
+        "`PushDescriptorObus` can only be called once, before any other "
+        "OBUs are pushed.");
+  }
+  if (reserved_mix_presentation_bytes_ < 0) {
+    return AbortOnError(absl::InvalidArgumentError(absl::StrCat(
+        "Expected a non-negative number of reserved bytes. Got: ",
+        reserved_mix_presentation_bytes_)));
+  }
+
+  // Write placeholder Mix Presentation OBUs, with space reserved for the
+  // finalized OBUs to grow into.
+  std::list<MixPresentationObu> placeholder_mix_presentation_obus(
+      mix_presentation_obus);
+  for (auto& mix_presentation_obu : placeholder_mix_presentation_obus) {
+    mix_presentation_obu.footer_.resize(
+        mix_presentation_obu.footer_.size() + reserved_mix_presentation_bytes_,
+        0);
+    const auto placeholder_size =
+        GetSerializedObuSize(mix_presentation_obu, leb_generator_);
+    if (!placeholder_size.ok()) {
+      return AbortOnError(placeholder_size.status());
+    }
+    mix_presentation_id_to_size_[mix_presentation_obu.GetMixPresentationId()] =
+        *placeholder_size;
+  }
+
+  RETURN_IF_NOT_OK(AbortOnError(
+      SerializeDescriptorObus(ia_sequence_header_obu, codec_config_obus,
+                              audio_elements,
+                              placeholder_mix_presentation_obus,
+                              arbitrary_obus)));
+  descriptor_obus_size_ = wb_.bit_offset() / 8;
+  RETURN_IF_NOT_OK(
+      AbortOnError(PushSerializedDescriptorObus(WrittenBytes(wb_))));
+  wb_.Reset();
+
+  state_ = kPushDescriptorObusCalled;
+  return absl::OkStatus();
+}
+
+absl::Status ObuSequencerBase::PushTemporalUnit(
+    InternalTimestamp start_timestamp, const TemporalUnit& temporal_unit) {
+  if (state_ != kPushDescriptorObusCalled) {
+    return absl::FailedPreconditionError(
+        "`PushTemporalUnit` must be called after `PushDescriptorObus` and "
+        "before the sequencer is closed.");
+  }
+  if (!temporal_unit.audio_frames.empty() &&
+      temporal_unit.audio_frames.front()->start_timestamp != start_timestamp) {
+    return AbortOnError(absl::InvalidArgumentError(absl::StrCat(
+        "Temporal unit at start_timestamp= ", start_timestamp,
+        " has audio frames starting at ",
+        temporal_unit.audio_frames.front()->start_timestamp, ".")));
+  }
+
+  int64_t num_samples = 0;
+  std::vector<AudioFrameReference> audio_frame_references;
+  audio_frame_references.reserve(temporal_unit.audio_frames.size());
+  RETURN_IF_NOT_OK(AbortOnError(
+      SerializeTemporalUnit(include_temporal_delimiters_, temporal_unit, wb_,
+                            num_samples, &audio_frame_references)));
+  RETURN_IF_NOT_OK(AbortOnError(PushSerializedTemporalUnit(
+      start_timestamp, num_samples,
+      GatherTemporalUnit(WrittenBytes(wb_), audio_frame_references))));
+  wb_.Reset();
+
+  num_temporal_units_++;
+  num_samples_ += num_samples;
+  return absl::OkStatus();
+}
+
+absl::Status ObuSequencerBase::UpdateDescriptorObusAndClose(
+    const IASequenceHeaderObu& ia_sequence_header_obu,
+    const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+    const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
+    const std::list<MixPresentationObu>& mix_presentation_obus,
+    const std::list<ArbitraryObu>& arbitrary_obus) {
+  if (state_ != kPushDescriptorObusCalled) {
+    return absl::FailedPreconditionError(
+        "`UpdateDescriptorObusAndClose` must be called after "
+        "`PushDescriptorObus` and before the sequencer is closed.");
+  }
+  std::list<MixPresentationObu> padded_mix_presentation_obus(
+      mix_presentation_obus);
+  for (auto& mix_presentation_obu : padded_mix_presentation_obus) {
+    RETURN_IF_NOT_OK(AbortOnError(PadToPlaceholderSize(mix_presentation_obu)));
+  }
+
+  RETURN_IF_NOT_OK(AbortOnError(
+      SerializeDescriptorObus(ia_sequence_header_obu, codec_config_obus,
+                              audio_elements, padded_mix_presentation_obus,
+                              arbitrary_obus)));
+  if (wb_.bit_offset() / 8 != descriptor_obus_size_) {
+    return AbortOnError(absl::InvalidArgumentError(absl::StrCat(
+        "Finalized descriptor OBUs have a size of ", wb_.bit_offset() / 8,
+        " bytes, but the original descriptor OBUs have a size of ",
+        descriptor_obus_size_, " bytes.")));
+  }
+  RETURN_IF_NOT_OK(
+      AbortOnError(PushFinalizedDescriptorObus(WrittenBytes(wb_))));
+  wb_.Reset();
+
+  return Close();
+}
+
+absl::Status ObuSequencerBase::Close() {
+  if (state_ != kPushDescriptorObusCalled) {
+    return absl::FailedPreconditionError(
+        "`Close` must be called after `PushDescriptorObus` and at most "
+        "once.");
+  }
+  RETURN_IF_NOT_OK(AbortOnError(CloseDerived()));
+  LOG(INFO) << "Wrote " << num_temporal_units_
+            << " temporal units with a total of " << num_samples_
+            << " samples excluding padding.";
+
+  state_ = kClosed;
+  return absl::OkStatus();
+}
+
+void ObuSequencerBase::Abort() {
+  if (state_ == kClosed) {
+    return;
+  }
+  AbortDerived();
+  wb_.Reset();
+  state_ = kClosed;
+}
+
+absl::Status ObuSequencerBase::PickAndPlace(
     const IASequenceHeaderObu& ia_sequence_header_obu,
     const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
     const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
@@ -350,32 +577,185 @@ absl::Status ObuSequencerIamf::PickAndPlace(
     const std::list<AudioFrameWithData>& audio_frames,
     const std::list<ParameterBlockWithData>& parameter_blocks,
     const std::list<ArbitraryObu>& arbitrary_obus) {
-  // Seed with a reasonable starting size. It is arbitrary because
-  // `WriteBitBuffer`s automatically resize as needed.
-  WriteBitBuffer wb(kBufferStartSize, leb_generator_);
+  RETURN_IF_NOT_OK(PushDescriptorObus(ia_sequence_header_obu,
+                                      codec_config_obus, audio_elements,
+                                      mix_presentation_obus, arbitrary_obus));
+
+  // Map of temporal unit start time -> OBUs that overlap this temporal unit.
+  // Using absl::btree_map for convenience as this allows iterating by
+  // timestamp (which is the key).
+  TemporalUnitMap temporal_unit_map;
+  RETURN_IF_NOT_OK(AbortOnError(ObuSequencerBase::GenerateTemporalUnitMap(
+      audio_frames, parameter_blocks, arbitrary_obus, temporal_unit_map)));
 
+  // Write all Audio Frame and Parameter Block OBUs ordered by temporal unit.
+  for (const auto& [start_timestamp, temporal_unit] : temporal_unit_map) {
+    RETURN_IF_NOT_OK(PushTemporalUnit(start_timestamp, temporal_unit));
+  }
+
+  return Close();
+}
+
+absl::Status ObuSequencerBase::SerializeDescriptorObus(
+    const IASequenceHeaderObu& ia_sequence_header_obu,
+    const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+    const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
+    const std::list<MixPresentationObu>& mix_presentation_obus,
+    const std::list<ArbitraryObu>& arbitrary_obus) {
+  wb_.Reset();
   RETURN_IF_NOT_OK(ArbitraryObu::WriteObusWithHook(
-      ArbitraryObu::kInsertionHookBeforeDescriptors, arbitrary_obus, wb));
-  // Write out the descriptor OBUs.
+      ArbitraryObu::kInsertionHookBeforeDescriptors, arbitrary_obus, wb_));
   RETURN_IF_NOT_OK(ObuSequencerBase::WriteDescriptorObus(
       ia_sequence_header_obu, codec_config_obus, audio_elements,
-      mix_presentation_obus, arbitrary_obus, wb));
+      mix_presentation_obus, arbitrary_obus, wb_));
   RETURN_IF_NOT_OK(ArbitraryObu::WriteObusWithHook(
-      ArbitraryObu::kInsertionHookAfterDescriptors, arbitrary_obus, wb));
+      ArbitraryObu::kInsertionHookAfterDescriptors, arbitrary_obus, wb_));
 
-  // Map of temporal unit start time -> OBUs that overlap this temporal unit.
-  // Using absl::btree_map for convenience as this allows iterating by
-  // timestamp (which is the key).
-  TemporalUnitMap temporal_unit_map;
-  RETURN_IF_NOT_OK(ObuSequencerBase::GenerateTemporalUnitMap(
-      audio_frames, parameter_blocks, arbitrary_obus, temporal_unit_map));
+  return absl::OkStatus();
+}
 
-  const auto write_status = WriteIaSequenceToFile(
-      iamf_filename_, include_temporal_delimiters_, temporal_unit_map, wb);
-  if (!write_status.ok()) {
-    MaybeRemoveFile(iamf_filename_);
+absl::Status ObuSequencerBase::PadToPlaceholderSize(
+    MixPresentationObu& mix_presentation_obu) const {
+  const auto mix_presentation_id = mix_presentation_obu.GetMixPresentationId();
+  const auto placeholder_iter =
+      mix_presentation_id_to_size_.find(mix_presentation_id);
+  if (placeholder_iter == mix_presentation_id_to_size_.end()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("No placeholder for Mix Presentation OBU with ID= ",
+                     mix_presentation_id));
+  }
+  const int64_t placeholder_size = placeholder_iter->second;
+
+  const auto size = GetSerializedObuSize(mix_presentation_obu, leb_generator_);
+  if (!size.ok()) {
+    return size.status();
+  }
+  if (*size > placeholder_size) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Finalized Mix Presentation OBU with ID= ", mix_presentation_id,
+        " has a size of ", *size,
+        " bytes, which exceeds the placeholder size of ", placeholder_size,
+        " bytes."));
+  }
+  if (*size == placeholder_size) {
+    return absl::OkStatus();
+  }
+
+  mix_presentation_obu.footer_.resize(
+      mix_presentation_obu.footer_.size() + (placeholder_size - *size), 0);
+  const auto padded_size =
+      GetSerializedObuSize(mix_presentation_obu, leb_generator_);
+  if (!padded_size.ok()) {
+    return padded_size.status();
+  }
+  if (*padded_size != placeholder_size) {
+    // Possible when the padding changes the number of bytes used to encode
+    // `obu_size`.
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Failed to pad Mix Presentation OBU with ID= ", mix_presentation_id,
+        " to the placeholder size of ", placeholder_size,
+        " bytes. Consider using a fixed-size `LebGenerator`."));
+  }
+
+  return absl::OkStatus();
+}
+
+absl::Status ObuSequencerBase::AbortOnError(absl::Status status) {
+  if (!status.ok()) {
+    Abort();
+  }
+  return status;
+}
+
+absl::Status ObuSequencerIamf::PushSerializedDescriptorObus(
+    absl::Span<const uint8_t> descriptor_obus) {
+  if (iamf_filename_.empty()) {
+    return absl::OkStatus();
+  }
+  output_iamf_ = GatherFileWriter::Create(iamf_filename_);
+  if (output_iamf_ == nullptr) {
+    return absl::UnknownError(
+        absl::StrCat("Failed to open ", iamf_filename_, "."));
+  }
+
+  if (!index_filename_.empty()) {
+    index_builder_.emplace();
+    RETURN_IF_NOT_OK(index_builder_->SetDescriptorObus(
+        /*offset=*/0, descriptor_obus.size()));
+  }
+  return output_iamf_->Write({descriptor_obus});
+}
+
+absl::Status ObuSequencerIamf::PushSerializedTemporalUnit(
+    InternalTimestamp timestamp, int64_t /*num_samples*/,
+    absl::Span<const absl::Span<const uint8_t>> temporal_unit) {
+  if (output_iamf_ == nullptr) {
+    return absl::OkStatus();
+  }
+
+  // One gather write per temporal unit. Batching across temporal units would
+  // require copying, because the audio frames are only borrowed for this call.
+  const int64_t offset = output_iamf_->size();
+  RETURN_IF_NOT_OK(output_iamf_->Write(temporal_unit));
+  if (index_builder_.has_value()) {
+    RETURN_IF_NOT_OK(index_builder_->AddTemporalUnit(
+        timestamp, offset, output_iamf_->size() - offset));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ObuSequencerIamf::PushFinalizedDescriptorObus(
+    absl::Span<const uint8_t> descriptor_obus) {
+  if (output_iamf_ == nullptr) {
+    return absl::OkStatus();
+  }
+
+  // The descriptor OBUs are always at the start of the file.
+  return output_iamf_->Overwrite(/*offset=*/0, descriptor_obus);
+}
+
+absl::Status ObuSequencerIamf::WriteIndex() const {
+  WriteBitBuffer wb(kBufferStartSize);
+  RETURN_IF_NOT_OK(index_builder_->Write(wb));
+  std::optional<std::fstream> output_index;
+  output_index.emplace(index_filename_, std::fstream::out | std::ios::binary);
+  RETURN_IF_NOT_OK(wb.FlushAndWriteToFile(output_index));
+  output_index->close();
+  if (output_index->fail()) {
+    return absl::UnknownError(
+        absl::StrCat("Failed to close ", index_filename_, "."));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ObuSequencerIamf::CloseDerived() {
+  if (output_iamf_ == nullptr) {
+    return absl::OkStatus();
+  }
+
+  if (index_builder_.has_value()) {
+    RETURN_IF_NOT_OK(WriteIndex());
+  }
+  const absl::Status close_status = output_iamf_->Close();
+  if (!close_status.ok()) {
+    // Keep the writer, so `Abort()` still removes the partial outputs.
+    return absl::UnknownError(absl::StrCat("Failed to close ", iamf_filename_,
+                                           ": ", close_status.message()));
+  }
+  output_iamf_.reset();
+  return absl::OkStatus();
+}
+
+void ObuSequencerIamf::AbortDerived() {
+  if (output_iamf_ == nullptr) {
+    return;
+  }
+  output_iamf_.reset();
+  MaybeRemoveFile(iamf_filename_);
+  if (index_builder_.has_value()) {
+    index_builder_.reset();
+    MaybeRemoveFile(index_filename_);
   }
-  return write_status;
 }
 
 }  // namespace iamf_tools
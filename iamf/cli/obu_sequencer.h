@@ -14,21 +14,27 @@
 
 #include <cstdint>
 #include <list>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "absl/container/btree_map.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
+#include "absl/types/span.h"
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/leb_generator.h"
 #include "iamf/cli/parameter_block_with_data.h"
+#include "iamf/cli/temporal_unit_index.h"
+#include "iamf/common/gather_file_writer.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/arbitrary_obu.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/ia_sequence_header.h"
 #include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/types.h"
 
 namespace iamf_tools {
 
@@ -45,16 +51,49 @@ struct TemporalUnit {
 };
 
 /*!\brief Map of start timestamp -> OBUs in that temporal unit.*/
-typedef absl::btree_map<int32_t, TemporalUnit> TemporalUnitMap;
+typedef absl::btree_map<InternalTimestamp, TemporalUnit> TemporalUnitMap;
 
+/*!\brief Base class to serialize and write out an IA Sequence.
+ *
+ * OBUs may be pushed to the sequencer incrementally as they are produced:
+ *   - Call `PushDescriptorObus()` once, with the initial descriptor OBUs.
+ *   - Call `PushTemporalUnit()` for each temporal unit, in order.
+ *   - Call `UpdateDescriptorObusAndClose()` to rewrite the descriptor OBUs
+ *     with their final values (e.g. after loudness has been measured), or call
+ *     `Close()` when the initial descriptor OBUs are already final.
+ *
+ * Memory usage is therefore bounded to a single temporal unit regardless of
+ * the duration of the IA Sequence.
+ *
+ * Descriptor OBUs are rewritten in place, so they must keep their size when
+ * finalized. To allow the Mix Presentation OBUs to change size (e.g. when the
+ * measured loudness signals additional fields), the sequencer may be configured
+ * to write placeholder Mix Presentation OBUs which are padded with reserved
+ * bytes. When finalized, each Mix Presentation OBU is padded back to the size
+ * of its placeholder. Padding is stored after the OBU syntax which parsers
+ * ignore (section 3.2). Using a fixed-size `LebGenerator` ensures `obu_size`
+ * has a fixed width, so the padding can always exactly fill the placeholder.
+ *
+ * `Abort()` may be called at any time to discard any partial output. Any
+ * failure while pushing OBUs automatically aborts the sequencer.
+ *
+ * `PickAndPlace()` is a convenience which pushes an entire IA Sequence in one
+ * call.
+ */
 class ObuSequencerBase {
  public:
   /*!\brief Constructor.
    *
    * \param leb_generator Leb generator to use when writing OBUs.
+   * \param include_temporal_delimiters Whether the serialized data should
+   *        include a temporal delimiter.
+   * \param reserved_mix_presentation_bytes Number of bytes to reserve in each
+   *        placeholder Mix Presentation OBU, or zero to write Mix Presentation
+   *        OBUs without any reserved bytes.
    */
-  ObuSequencerBase(const LebGenerator& leb_generator)
-      : leb_generator_(leb_generator) {}
+  ObuSequencerBase(const LebGenerator& leb_generator,
+                   bool include_temporal_delimiters,
+                   int64_t reserved_mix_presentation_bytes = 0);
 
   /*!\brief Destructor.*/
   virtual ~ObuSequencerBase() = default;
@@ -89,7 +128,8 @@ class ObuSequencerBase {
    */
   static absl::Status WriteTemporalUnit(bool include_temporal_delimiters,
                                         const TemporalUnit& temporal_unit,
-                                        WriteBitBuffer& wb, int& num_samples);
+                                        WriteBitBuffer& wb,
+                                        int64_t& num_samples);
 
   /*!\brief Writes the input descriptor OBUs.
    *
@@ -111,7 +151,79 @@ class ObuSequencerBase {
       const std::list<MixPresentationObu>& mix_presentation_obus,
       const std::list<ArbitraryObu>& arbitrary_obus, WriteBitBuffer& wb);
 
+  /*!\brief Pushes the descriptor OBUs to the sequencer.
+   *
+   * Arbitrary OBUs with descriptor insertion hooks are written around the
+   * descriptor OBUs. Arbitrary OBUs with other hooks are ignored.
+   *
+   * \param ia_sequence_header_obu IA Sequence Header OBU to write.
+   * \param codec_config_obus Codec Config OBUs to write.
+   * \param audio_elements Audio Element OBUs with data to write.
+   * \param mix_presentation_obus Mix Presentation OBUs to write.
+   * \param arbitrary_obus Arbitrary OBUs to write.
+   * \return `absl::OkStatus()` on success. A specific status on failure or if
+   *         the descriptor OBUs were already pushed.
+   */
+  absl::Status PushDescriptorObus(
+      const IASequenceHeaderObu& ia_sequence_header_obu,
+      const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+      const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
+      const std::list<MixPresentationObu>& mix_presentation_obus,
+      const std::list<ArbitraryObu>& arbitrary_obus);
+
+  /*!\brief Pushes a single temporal unit to the sequencer.
+   *
+   * Temporal units must be pushed in order of their start timestamp. The
+   * referenced OBUs may be released as soon as this function returns.
+   *
+   * \param start_timestamp Start timestamp of the temporal unit, i.e. its key
+   *        in a `TemporalUnitMap`. Temporal units which hold only arbitrary
+   *        OBUs have no audio frames to take it from.
+   * \param temporal_unit Temporal unit to write.
+   * \return `absl::OkStatus()` on success. A specific status on failure, if
+   *         the descriptor OBUs have not yet been pushed, or if
+   *         `start_timestamp` does not match the audio frames.
+   */
+  absl::Status PushTemporalUnit(InternalTimestamp start_timestamp,
+                                const TemporalUnit& temporal_unit);
+
+  /*!\brief Rewrites the descriptor OBUs with their final values and closes.
+   *
+   * Each finalized Mix Presentation OBU is padded to the size of its
+   * placeholder; it fails if it does not fit. All other descriptor OBUs must
+   * serialize to the same size as the originally pushed descriptor OBUs.
+   *
+   * \param ia_sequence_header_obu IA Sequence Header OBU to write.
+   * \param codec_config_obus Codec Config OBUs to write.
+   * \param audio_elements Audio Element OBUs with data to write.
+   * \param mix_presentation_obus Finalized Mix Presentation OBUs to write.
+   * \param arbitrary_obus Arbitrary OBUs to write.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status UpdateDescriptorObusAndClose(
+      const IASequenceHeaderObu& ia_sequence_header_obu,
+      const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+      const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
+      const std::list<MixPresentationObu>& mix_presentation_obus,
+      const std::list<ArbitraryObu>& arbitrary_obus);
+
+  /*!\brief Signals that no more OBUs will be pushed.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure or if
+   *         the descriptor OBUs have not yet been pushed.
+   */
+  absl::Status Close();
+
+  /*!\brief Aborts the sequencer and discards any partial output.
+   *
+   * Further calls to push OBUs will fail.
+   */
+  void Abort();
+
   /*!\brief Pick and place OBUs and write to some output.
+   *
+   * Equivalent to pushing the descriptor OBUs, all temporal units, and then
+   * closing the sequencer.
    *
    * \param ia_sequence_header_obu IA Sequence Header OBU to write.
    * \param codec_config_obus Codec Config OBUs to write.
@@ -122,17 +234,109 @@ class ObuSequencerBase {
    * \param arbitrary_obus Arbitrary OBUs to write.
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
-  virtual absl::Status PickAndPlace(
+  absl::Status PickAndPlace(
       const IASequenceHeaderObu& ia_sequence_header_obu,
       const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
       const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
       const std::list<MixPresentationObu>& mix_presentation_obus,
       const std::list<AudioFrameWithData>& audio_frames,
       const std::list<ParameterBlockWithData>& parameter_blocks,
-      const std::list<ArbitraryObu>& arbitrary_obus) = 0;
+      const std::list<ArbitraryObu>& arbitrary_obus);
 
  protected:
+  /*!\brief Pushes the serialized descriptor OBUs to the output.
+   *
+   * \param descriptor_obus Serialized descriptor OBUs.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  virtual absl::Status PushSerializedDescriptorObus(
+      absl::Span<const uint8_t> descriptor_obus) = 0;
+
+  /*!\brief Pushes a serialized temporal unit to the output.
+   *
+   * \param timestamp Start timestamp of the temporal unit.
+   * \param num_samples Number of samples in the temporal unit, excluding
+   *        padding.
+   * \param temporal_unit Serialized temporal unit, as the concatenation of
+   *        the spans. Audio frames are referenced in place rather than copied,
+   *        so the spans are only valid during the call.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  virtual absl::Status PushSerializedTemporalUnit(
+      InternalTimestamp timestamp, int64_t num_samples,
+      absl::Span<const absl::Span<const uint8_t>> temporal_unit) = 0;
+
+  /*!\brief Overwrites the previously pushed descriptor OBUs.
+   *
+   * \param descriptor_obus Serialized descriptor OBUs. Guaranteed to be the
+   *        same size as the originally pushed descriptor OBUs.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  virtual absl::Status PushFinalizedDescriptorObus(
+      absl::Span<const uint8_t> descriptor_obus) = 0;
+
+  /*!\brief Finishes writing the output.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  virtual absl::Status CloseDerived() = 0;
+
+  /*!\brief Discards any partial output.*/
+  virtual void AbortDerived() = 0;
+
   const LebGenerator leb_generator_;
+
+ private:
+  enum State {
+    kInitialized,
+    kPushDescriptorObusCalled,
+    kClosed,
+  };
+
+  /*!\brief Serializes the descriptor OBUs and surrounding arbitrary OBUs.
+   *
+   * \param ia_sequence_header_obu IA Sequence Header OBU to write.
+   * \param codec_config_obus Codec Config OBUs to write.
+   * \param audio_elements Audio Element OBUs with data to write.
+   * \param mix_presentation_obus Mix Presentation OBUs to write.
+   * \param arbitrary_obus Arbitrary OBUs to write.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status SerializeDescriptorObus(
+      const IASequenceHeaderObu& ia_sequence_header_obu,
+      const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
+      const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
+      const std::list<MixPresentationObu>& mix_presentation_obus,
+      const std::list<ArbitraryObu>& arbitrary_obus);
+
+  /*!\brief Pads a finalized Mix Presentation OBU to its placeholder size.
+   *
+   * \param mix_presentation_obu Mix Presentation OBU to pad.
+   * \return `absl::OkStatus()` on success. A specific status if the OBU does
+   *         not correspond to a placeholder or does not fit in it.
+   */
+  absl::Status PadToPlaceholderSize(
+      MixPresentationObu& mix_presentation_obu) const;
+
+  /*!\brief Aborts and returns the input status if it is not OK.
+   *
+   * \param status Status to check.
+   * \return The input status.
+   */
+  absl::Status AbortOnError(absl::Status status);
+
+  const bool include_temporal_delimiters_;
+  const int64_t reserved_mix_presentation_bytes_;
+  State state_ = kInitialized;
+
+  // Size of each placeholder Mix Presentation OBU, keyed by its ID.
+  absl::flat_hash_map<DecodedUleb128, int64_t> mix_presentation_id_to_size_;
+
+  // Scratch buffer reused for each push to avoid reallocating.
+  WriteBitBuffer wb_;
+  int64_t descriptor_obus_size_ = 0;
+  int64_t num_temporal_units_ = 0;
+  int64_t num_samples_ = 0;
 };
 
 class ObuSequencerIamf : public ObuSequencerBase {
@@ -143,39 +347,52 @@ class ObuSequencerIamf : public ObuSequencerBase {
    * \param include_temporal_delimiters Whether the serialized data should
    *        include a temporal delimiter.
    * \param leb_generator Leb generator to use when writing OBUs.
+   * \param reserved_mix_presentation_bytes Number of bytes to reserve in each
+   *        placeholder Mix Presentation OBU, or zero to write Mix Presentation
+   *        OBUs without any reserved bytes.
+   * \param index_filename Name of the output `TemporalUnitIndex` sidecar file
+   *        or an empty string to disable it. Ignored when the .iamf output is
+   *        disabled.
    */
   ObuSequencerIamf(const std::string& iamf_filename,
                    bool include_temporal_delimiters,
-                   const LebGenerator& leb_generator)
-      : ObuSequencerBase(leb_generator),
+                   const LebGenerator& leb_generator,
+                   int64_t reserved_mix_presentation_bytes = 0,
+                   const std::string& index_filename = "")
+      : ObuSequencerBase(leb_generator, include_temporal_delimiters,
+                         reserved_mix_presentation_bytes),
         iamf_filename_(iamf_filename),
-        include_temporal_delimiters_(include_temporal_delimiters) {}
+        index_filename_(index_filename) {}
 
   ~ObuSequencerIamf() override = default;
 
-  /*!\brief Pick and place OBUs and write to the standalone .iamf file.
+ private:
+  absl::Status PushSerializedDescriptorObus(
+      absl::Span<const uint8_t> descriptor_obus) override;
+
+  absl::Status PushSerializedTemporalUnit(
+      InternalTimestamp timestamp, int64_t num_samples,
+      absl::Span<const absl::Span<const uint8_t>> temporal_unit) override;
+
+  absl::Status PushFinalizedDescriptorObus(
+      absl::Span<const uint8_t> descriptor_obus) override;
+
+  absl::Status CloseDerived() override;
+
+  void AbortDerived() override;
+
+  /*!\brief Writes the index of the temporal units written so far.
    *
-   * \param ia_sequence_header_obu IA Sequence Header OBU to write.
-   * \param codec_config_obus Codec Config OBUs to write.
-   * \param audio_elements Audio Element OBUs with data to write.
-   * \param mix_presentation_obus Mix Presentation OBUs to write.
-   * \param audio_frames Data about Audio Frame OBUs to write.
-   * \param parameter_blocks Data about Parameter Block OBUs to write.
-   * \param arbitrary_obus Arbitrary OBUs to write.
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
-  absl::Status PickAndPlace(
-      const IASequenceHeaderObu& ia_sequence_header_obu,
-      const absl::flat_hash_map<uint32_t, CodecConfigObu>& codec_config_obus,
-      const absl::flat_hash_map<uint32_t, AudioElementWithData>& audio_elements,
-      const std::list<MixPresentationObu>& mix_presentation_obus,
-      const std::list<AudioFrameWithData>& audio_frames,
-      const std::list<ParameterBlockWithData>& parameter_blocks,
-      const std::list<ArbitraryObu>& arbitrary_obus) override;
+  absl::Status WriteIndex() const;
 
- private:
   const std::string iamf_filename_;
-  const bool include_temporal_delimiters_;
+  const std::string index_filename_;
+  std::unique_ptr<GatherFileWriter> output_iamf_;
+
+  // Only present when both the .iamf file and the index are enabled.
+  std::optional<TemporalUnitIndexBuilder> index_builder_;
 };
 
 }  // namespace iamf_tools
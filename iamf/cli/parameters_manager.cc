@@ -38,7 +38,7 @@ namespace {
 
 template <typename StateType>
 absl::Status UpdateParameterState(
-    DecodedUleb128 audio_element_id, int32_t expected_next_timestamp,
+    DecodedUleb128 audio_element_id, InternalTimestamp expected_next_timestamp,
     absl::flat_hash_map<DecodedUleb128, StateType>& parameter_states,
     absl::flat_hash_map<DecodedUleb128, const ParameterBlockWithData*>&
         parameter_blocks,
@@ -151,6 +151,14 @@ absl::Status ParametersManager::Initialize() {
   return absl::OkStatus();
 }
 
+absl::Status ParametersManager::Reset() {
+  demixing_parameter_blocks_.clear();
+  recon_gain_parameter_blocks_.clear();
+  demixing_states_.clear();
+  recon_gain_states_.clear();
+  return Initialize();
+}
+
 bool ParametersManager::DemixingParamDefinitionAvailable(
     const DecodedUleb128 audio_element_id) {
   return demixing_states_.find(audio_element_id) != demixing_states_.end();
@@ -286,7 +294,7 @@ void ParametersManager::AddReconGainParameterBlock(
 }
 
 absl::Status ParametersManager::UpdateDemixingState(
-    DecodedUleb128 audio_element_id, int32_t expected_timestamp) {
+    DecodedUleb128 audio_element_id, InternalTimestamp expected_timestamp) {
   std::optional<DemixingState*> demixing_state = std::nullopt;
   RETURN_IF_NOT_OK(UpdateParameterState(
       audio_element_id, expected_timestamp, demixing_states_,
@@ -307,7 +315,7 @@ absl::Status ParametersManager::UpdateDemixingState(
 }
 
 absl::Status ParametersManager::UpdateReconGainState(
-    DecodedUleb128 audio_element_id, int32_t expected_timestamp) {
+    DecodedUleb128 audio_element_id, InternalTimestamp expected_timestamp) {
   std::optional<ReconGainState*> recon_gain_state = std::nullopt;
 
   // No additional updating needed.
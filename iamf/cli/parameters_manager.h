@@ -58,6 +58,12 @@ class ParametersManager {
    */
   absl::Status Initialize();
 
+  /*!\brief Discards all parameter blocks and states to begin a new sequence.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status Reset();
+
   /*!\brief Checks if a `DemixingParamDefinition` exists for an audio element.
    *
    * \param audio_element_id ID of the audio element to query.
@@ -114,7 +120,7 @@ class ParametersManager {
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status UpdateDemixingState(DecodedUleb128 audio_element_id,
-                                   int32_t expected_next_timestamp);
+                                   InternalTimestamp expected_next_timestamp);
 
   /*!\brief Updates the state of recon gain parameters for an audio element.
    *
@@ -127,7 +133,7 @@ class ParametersManager {
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status UpdateReconGainState(DecodedUleb128 audio_element_id,
-                                    int32_t expected_next_timestamp);
+                                    InternalTimestamp expected_next_timestamp);
 
  private:
   // State used when generating demixing parameters for an audio element.
@@ -141,7 +147,7 @@ class ParametersManager {
     int w_idx;
 
     // Timestamp for the next frame to be processed.
-    int32_t next_timestamp;
+    InternalTimestamp next_timestamp;
 
     // Update rule of the currently tracked demixing parameters, because the
     // first frame needs some special treatment.
@@ -152,7 +158,7 @@ class ParametersManager {
     const ReconGainParamDefinition* param_definition;
 
     // Timestamp for the next frame to be processed.
-    int32_t next_timestamp;
+    InternalTimestamp next_timestamp;
   };
 
   // Mapping from Audio Element ID to audio element data.
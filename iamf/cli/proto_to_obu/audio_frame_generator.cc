@@ -17,7 +17,6 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <deque>
 #include <list>
 #include <memory>
 #include <optional>
@@ -49,6 +48,8 @@
 #include "iamf/cli/proto/codec_config.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
+#include "iamf/common/thread_pool.h"
 #include "iamf/obu/audio_frame.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
@@ -171,26 +172,11 @@ absl::Status GetNumSamplesToPadAtEndAndValidate(
   return absl::OkStatus();
 }
 
-void PadSamples(const size_t num_samples_to_pad, const size_t num_channels,
-                std::deque<std::vector<int32_t>>& samples) {
-  samples.insert(samples.end(), num_samples_to_pad,
-                 std::vector<int32_t>(num_channels, 0));
-}
-
-void MoveSamples(const size_t num_samples,
-                 std::deque<std::vector<int32_t>>& source_samples,
-                 std::vector<std::vector<int32_t>>& destination_samples) {
-  CHECK_GE(source_samples.size(), num_samples);
-  std::copy(source_samples.begin(), source_samples.begin() + num_samples,
-            destination_samples.begin());
-  source_samples.erase(source_samples.begin(),
-                       source_samples.begin() + num_samples);
-}
-
 absl::Status InitializeSubstreamData(
     const SubstreamIdLabelsMap& substream_id_to_labels,
     const absl::flat_hash_map<uint32_t, std::unique_ptr<EncoderBase>>&
         substream_id_to_encoder,
+    const size_t num_samples_per_frame,
     bool user_samples_to_trim_at_start_includes_codec_delay,
     const uint32_t user_samples_to_trim_at_start,
     absl::flat_hash_map<uint32_t, SubstreamData>&
@@ -215,18 +201,21 @@ absl::Status InitializeSubstreamData(
     }
 
     // Initialize a `SubstreamData` with virtual samples for any delay
-    // introduced by the encoder.
+    // introduced by the encoder. The queues are sized to hold a frame of
+    // samples on top of the delay, so steady-state encoding never allocates.
+    const size_t queue_capacity =
+        num_samples_per_frame + encoder_required_samples_to_delay;
     auto& substream_data_for_id = substream_id_to_substream_data[substream_id];
     substream_data_for_id = {
         substream_id,
-        /*samples_obu=*/{},
-        /*samples_encode=*/{},
+        /*samples_obu=*/{labels.size(), queue_capacity},
+        /*samples_encode=*/{labels.size(), queue_capacity},
         /*output_gains_linear=*/{},
         /*num_samples_to_trim_at_end=*/0,
         /*num_samples_to_trim_at_start=*/encoder_required_samples_to_delay};
 
-    PadSamples(encoder_required_samples_to_delay, labels.size(),
-               substream_data_for_id.samples_obu);
+    substream_data_for_id.samples_obu.PushZeros(
+        encoder_required_samples_to_delay);
   }
 
   return absl::OkStatus();
@@ -317,7 +306,6 @@ absl::Status GetNextFrameSubstreamData(
   // Padding.
   for (const auto& [substream_id, unused_labels] : substream_id_to_labels) {
     auto& substream_data = substream_id_to_substream_data.at(substream_id);
-    const int num_channels = substream_data.samples_obu.front().size();
     if (substream_data.samples_obu.size() < num_samples_per_frame) {
       uint32_t num_samples_to_pad_at_end;
       auto& trimming_state = substream_id_to_trimming_state.at(substream_id);
@@ -327,10 +315,8 @@ absl::Status GetNextFrameSubstreamData(
           trimming_state.user_samples_left_to_trim_at_end,
           num_samples_to_pad_at_end));
 
-      PadSamples(num_samples_to_pad_at_end, num_channels,
-                 substream_data.samples_obu);
-      PadSamples(num_samples_to_pad_at_end, num_channels,
-                 substream_data.samples_encode);
+      substream_data.samples_obu.PushZeros(num_samples_to_pad_at_end);
+      substream_data.samples_encode.PushZeros(num_samples_to_pad_at_end);
 
       // Record the number of padded samples to be trimmed later.
       substream_data.num_samples_to_trim_at_end = num_samples_to_pad_at_end;
@@ -346,8 +332,7 @@ absl::Status GetNextFrameSubstreamData(
       // need to be added. These samples will be "left in" the decoder
       // after all OBUs are processed, but they should not count as being
       // trimmed.
-      PadSamples(num_samples_to_pad, num_channels,
-                 substream_data.samples_encode);
+      substream_data.samples_encode.PushZeros(num_samples_to_pad);
     }
   }
 
@@ -370,6 +355,18 @@ std::pair<uint32_t, uint32_t> GetNumSamplesToTrimForFrame(
                         frame_samples_to_trim_at_end);
 }
 
+// Takes a sample buffer whose allocations can be reused, or an empty one if
+// none were recycled.
+PlanarSampleBuffer<int32_t> TakeRecycledSamples(
+    std::vector<PlanarSampleBuffer<int32_t>>& recycled_samples) {
+  if (recycled_samples.empty()) {
+    return {};
+  }
+  auto samples = std::move(recycled_samples.back());
+  recycled_samples.pop_back();
+  return samples;
+}
+
 // Encode frames for an audio element if samples are ready.
 absl::Status MaybeEncodeFramesForAudioElement(
     const DecodedUleb128 audio_element_id,
@@ -381,10 +378,12 @@ absl::Status MaybeEncodeFramesForAudioElement(
     absl::flat_hash_map<uint32_t, AudioFrameGenerator::TrimmingState>&
         substream_id_to_trimming_state,
     ParametersManager& parameters_manager,
-    absl::flat_hash_map<uint32_t, std::unique_ptr<EncoderBase>>&
-        substream_id_to_encoder,
+    absl::flat_hash_map<uint32_t,
+                        std::vector<AudioFrameGenerator::PendingAudioFrame>>&
+        substream_id_to_pending_frames,
     absl::flat_hash_map<uint32_t, SubstreamData>&
         substream_id_to_substream_data,
+    std::vector<PlanarSampleBuffer<int32_t>>& recycled_samples,
     GlobalTimingModule& global_timing_module) {
   if (!SamplesReadyForAudioElement(label_to_samples,
                                    channel_labels_for_audio_element)) {
@@ -426,7 +425,7 @@ absl::Status MaybeEncodeFramesForAudioElement(
     label_to_empty_samples[label] = {};
   }
 
-  std::optional<int32_t> encoded_timestamp;
+  std::optional<InternalTimestamp> encoded_timestamp;
   bool more_samples_to_encode = false;
   do {
     RETURN_IF_NOT_OK(GetNextFrameSubstreamData(
@@ -471,16 +470,15 @@ absl::Status MaybeEncodeFramesForAudioElement(
         continue;
       }
 
-      // Pop samples from the queues and arrange in (time, channel) axes.
+      // Pop samples from the queues and arrange in (channel, time) axes.
       const size_t num_samples_to_encode =
           static_cast<size_t>(num_samples_per_frame);
-      std::vector<std::vector<int32_t>> samples_encode(num_samples_to_encode);
-      std::vector<std::vector<int32_t>> samples_obu(num_samples_to_encode);
-
-      MoveSamples(num_samples_to_encode, substream_data.samples_obu,
-                  samples_obu);
-      MoveSamples(num_samples_to_encode, substream_data.samples_encode,
-                  samples_encode);
+      auto samples_encode = TakeRecycledSamples(recycled_samples);
+      auto samples_obu = TakeRecycledSamples(recycled_samples);
+      RETURN_IF_NOT_OK(substream_data.samples_obu.PopFront(
+          num_samples_to_encode, samples_obu));
+      RETURN_IF_NOT_OK(substream_data.samples_encode.PopFront(
+          num_samples_to_encode, samples_encode));
       const auto [frame_samples_to_trim_at_start,
                   frame_samples_to_trim_at_end] =
           GetNumSamplesToTrimForFrame(
@@ -489,10 +487,11 @@ absl::Status MaybeEncodeFramesForAudioElement(
               substream_data.num_samples_to_trim_at_end);
 
       // Both timestamps cover trimmed and regular samples.
-      int32_t start_timestamp;
-      int32_t end_timestamp;
+      InternalTimestamp start_timestamp;
+      InternalTimestamp end_timestamp;
       RETURN_IF_NOT_OK(global_timing_module.GetNextAudioFrameTimestamps(
-          substream_id, samples_obu.size(), start_timestamp, end_timestamp));
+          substream_id, samples_obu.num_ticks(), start_timestamp,
+          end_timestamp));
 
       if (encoded_timestamp.has_value()) {
         // All frames corresponding to the same Audio Element should have
@@ -515,14 +514,16 @@ absl::Status MaybeEncodeFramesForAudioElement(
                   substream_id, {}),
               .start_timestamp = start_timestamp,
               .end_timestamp = end_timestamp,
-              .pcm_samples = samples_obu,
+              .pcm_samples = std::move(samples_obu),
               .down_mixing_params = down_mixing_params,
               .audio_element_with_data = &audio_element_with_data});
 
-      RETURN_IF_NOT_OK(
-          substream_id_to_encoder.at(substream_id)
-              ->EncodeAudioFrame(encoder_input_pcm_bit_depth, samples_encode,
-                                 std::move(partial_audio_frame_with_data)));
+      // Defer encoding, so that substreams can be encoded concurrently.
+      substream_id_to_pending_frames[substream_id].push_back(
+          {.input_bit_depth = encoder_input_pcm_bit_depth,
+           .samples = std::move(samples_encode),
+           .partial_audio_frame_with_data =
+               std::move(partial_audio_frame_with_data)});
       encoded_timestamp = start_timestamp;
     }
 
@@ -644,8 +645,12 @@ AudioFrameGenerator::AudioFrameGenerator(
         audio_elements,
     const DemixingModule& demixing_module,
     ParametersManager& parameters_manager,
-    GlobalTimingModule& global_timing_module)
+    GlobalTimingModule& global_timing_module, int num_encoding_threads)
     : audio_elements_(audio_elements),
+      encoding_thread_pool_(
+          num_encoding_threads > 1
+              ? std::make_unique<ThreadPool>(num_encoding_threads)
+              : nullptr),
       demixing_module_(demixing_module),
       parameters_manager_(parameters_manager),
       global_timing_module_(global_timing_module),
@@ -722,14 +727,6 @@ absl::Status AudioFrameGenerator::Initialize() {
         codec_config_metadata_, audio_element_with_data,
         substream_id_to_encoder_));
 
-    // Intermediate data for all substreams belonging to an Audio Element.
-    RETURN_IF_NOT_OK(InitializeSubstreamData(
-        audio_element_with_data.substream_id_to_labels,
-        substream_id_to_encoder_,
-        audio_frame_metadata.samples_to_trim_at_start_includes_codec_delay(),
-        audio_frame_metadata.samples_to_trim_at_start(),
-        substream_id_to_substream_data_));
-
     // Validate that a `DemixingParamDefinition` is available if down-mixing
     // is needed.
     const std::list<Demixer>* down_mixers = nullptr;
@@ -748,6 +745,59 @@ absl::Status AudioFrameGenerator::Initialize() {
         audio_frame_metadata, common_samples_to_trim_at_end_includes_padding,
         common_samples_to_trim_at_start_includes_codec_delay,
         common_samples_to_trim_at_start, common_samples_to_trim_at_end));
+  }
+
+  return InitializeSubstreamStates();
+}
+
+absl::Status AudioFrameGenerator::Reset() {
+  absl::MutexLock lock(&mutex_);
+  if (audio_frame_metadata_.empty()) {
+    return absl::OkStatus();
+  }
+
+  // Bring back the encoders which finished, then reset all of them.
+  for (auto& [substream_id, encoder] : substream_id_to_finished_encoder_) {
+    substream_id_to_encoder_[substream_id] = std::move(encoder);
+  }
+  substream_id_to_finished_encoder_.clear();
+  for (const auto& [substream_id, encoder] : substream_id_to_encoder_) {
+    RETURN_IF_NOT_OK(encoder->Reset());
+  }
+
+  // Drop anything left from the previous sequence.
+  id_to_labeled_samples_.clear();
+  substream_id_to_pending_frames_.clear();
+  substream_id_to_substream_data_.clear();
+  substream_id_to_trimming_state_.clear();
+
+  return InitializeSubstreamStates();
+}
+
+absl::Status AudioFrameGenerator::InitializeSubstreamStates() {
+  const auto& first_audio_frame_metadata =
+      audio_frame_metadata_.begin()->second;
+  const int64_t common_samples_to_trim_at_start = static_cast<int64_t>(
+      first_audio_frame_metadata.samples_to_trim_at_start());
+  const int64_t common_samples_to_trim_at_end =
+      static_cast<int64_t>(first_audio_frame_metadata.samples_to_trim_at_end());
+  const bool common_samples_to_trim_at_start_includes_codec_delay =
+      first_audio_frame_metadata
+          .samples_to_trim_at_start_includes_codec_delay();
+
+  for (const auto& [audio_element_id, audio_frame_metadata] :
+       audio_frame_metadata_) {
+    const AudioElementWithData& audio_element_with_data =
+        audio_elements_.at(audio_element_id);
+
+    // Intermediate data for all substreams belonging to an Audio Element.
+    RETURN_IF_NOT_OK(InitializeSubstreamData(
+        audio_element_with_data.substream_id_to_labels,
+        substream_id_to_encoder_,
+        audio_element_with_data.codec_config->GetNumSamplesPerFrame(),
+        audio_frame_metadata.samples_to_trim_at_start_includes_codec_delay(),
+        audio_frame_metadata.samples_to_trim_at_start(),
+        substream_id_to_substream_data_));
 
     // Populate the map of trimming states with all substream ID.
     for (const auto& [substream_id, labels] :
@@ -822,8 +872,8 @@ absl::Status AudioFrameGenerator::AddSamples(
       audio_element_id, audio_element_with_data, demixing_module_,
       audio_element_labels_iter->second, labeled_samples,
       substream_id_to_trimming_state_, parameters_manager_,
-      substream_id_to_encoder_, substream_id_to_substream_data_,
-      global_timing_module_));
+      substream_id_to_pending_frames_, substream_id_to_substream_data_,
+      recycled_samples_, global_timing_module_));
 
   return absl::OkStatus();
 }
@@ -857,8 +907,8 @@ absl::Status AudioFrameGenerator::OutputFrames(
           audio_element_id_to_labels_.at(audio_element_id),
           id_to_labeled_samples_[audio_element_id],
           substream_id_to_trimming_state_, parameters_manager_,
-          substream_id_to_encoder_, substream_id_to_substream_data_,
-          global_timing_module_));
+          substream_id_to_pending_frames_, substream_id_to_substream_data_,
+          recycled_samples_, global_timing_module_));
     }
   } else if (state_ == kFinalizedCalled) {
     // The `Finalize()` has just been called, advance the state so that the
@@ -866,6 +916,8 @@ absl::Status AudioFrameGenerator::OutputFrames(
     state_ = kFlushingRemaining;
   }
 
+  RETURN_IF_NOT_OK(EncodePendingFrames());
+
   // Pop encoded audio frames from encoders.
   for (auto substream_id_to_encoder_iter = substream_id_to_encoder_.begin();
        substream_id_to_encoder_iter != substream_id_to_encoder_.end();) {
@@ -891,8 +943,9 @@ absl::Status AudioFrameGenerator::OutputFrames(
           audio_frames.back()));
     }
 
-    // Remove finished encoder or advance the iterator.
+    // Retire finished encoder or advance the iterator.
     if (encoder->Finished()) {
+      substream_id_to_finished_encoder_[substream_id] = std::move(encoder);
       substream_id_to_encoder_.erase(substream_id_to_encoder_iter++);
     } else {
       ++substream_id_to_encoder_iter;
@@ -902,4 +955,71 @@ absl::Status AudioFrameGenerator::OutputFrames(
   return absl::OkStatus();
 }
 
+void AudioFrameGenerator::RecyclePcmSamples(
+    std::list<AudioFrameWithData>& audio_frames) {
+  absl::MutexLock lock(&mutex_);
+  for (auto& audio_frame : audio_frames) {
+    if (audio_frame.pcm_samples.has_value()) {
+      recycled_samples_.push_back(std::move(*audio_frame.pcm_samples));
+      audio_frame.pcm_samples = std::nullopt;
+    }
+  }
+}
+
+absl::Status AudioFrameGenerator::EncodePendingFrames() {
+  // Look up all encoders before scheduling any work.
+  std::vector<std::pair<EncoderBase*, std::vector<PendingAudioFrame>*>>
+      encoders_and_pending_frames;
+  encoders_and_pending_frames.reserve(substream_id_to_pending_frames_.size());
+  for (auto& [substream_id, pending_frames] :
+       substream_id_to_pending_frames_) {
+    const auto encoder_iter = substream_id_to_encoder_.find(substream_id);
+    if (encoder_iter == substream_id_to_encoder_.end()) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("No encoder for substream ID= ", substream_id));
+    }
+    encoders_and_pending_frames.push_back(
+        {encoder_iter->second.get(), &pending_frames});
+  }
+
+  std::vector<absl::Status> statuses(encoders_and_pending_frames.size());
+  for (size_t i = 0; i < encoders_and_pending_frames.size(); ++i) {
+    auto encode_substream = [encoder = encoders_and_pending_frames[i].first,
+                             pending_frames =
+                                 encoders_and_pending_frames[i].second,
+                             &status = statuses[i]]() {
+      for (auto& pending_frame : *pending_frames) {
+        status = encoder->EncodeAudioFrame(
+            pending_frame.input_bit_depth, pending_frame.samples,
+            std::move(pending_frame.partial_audio_frame_with_data));
+        if (!status.ok()) {
+          return;
+        }
+      }
+    };
+    if (encoding_thread_pool_ != nullptr) {
+      encoding_thread_pool_->Schedule(encode_substream);
+    } else {
+      encode_substream();
+    }
+  }
+  if (encoding_thread_pool_ != nullptr) {
+    encoding_thread_pool_->Wait();
+  }
+  // The encoders are done with the input samples; keep their allocations for
+  // later frames.
+  for (auto& [unused_substream_id, pending_frames] :
+       substream_id_to_pending_frames_) {
+    for (auto& pending_frame : pending_frames) {
+      recycled_samples_.push_back(std::move(pending_frame.samples));
+    }
+  }
+  substream_id_to_pending_frames_.clear();
+
+  for (const auto& status : statuses) {
+    RETURN_IF_NOT_OK(status);
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace iamf_tools
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <list>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -33,6 +34,8 @@
 #include "iamf/cli/parameters_manager.h"
 #include "iamf/cli/proto/audio_frame.pb.h"
 #include "iamf/cli/proto/codec_config.pb.h"
+#include "iamf/common/planar_sample_buffer.h"
+#include "iamf/common/thread_pool.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/types.h"
 #include "src/google/protobuf/repeated_ptr_field.h"
@@ -72,6 +75,10 @@ namespace iamf_tools {
  *     - If the output is empty, wait.
  *     - Otherwise, add the output of this round to the final result.
  *
+ * Frames are queued for encoding as samples are added and are encoded at the
+ * start of `OutputFrames()`. Each substream has an independent encoder, so the
+ * frames of different substreams may optionally be encoded concurrently on a
+ * pool of worker threads.
  */
 class AudioFrameGenerator {
  public:
@@ -84,6 +91,15 @@ class AudioFrameGenerator {
     int64_t user_samples_left_to_trim_at_start;
   };
 
+  /*!\brief An audio frame which is ready to be encoded.
+   */
+  struct PendingAudioFrame {
+    int input_bit_depth;
+    // Samples arranged in (channel, time) axes.
+    PlanarSampleBuffer<int32_t> samples;
+    std::unique_ptr<AudioFrameWithData> partial_audio_frame_with_data;
+  };
+
   /*!\brief Constructor.
    *
    * \param audio_frame_metadata Input audio frame metadata.
@@ -92,6 +108,9 @@ class AudioFrameGenerator {
    * \param demixing_module Demixng module.
    * \param parameters_manager Manager of parameters.
    * \param global_timing_module Global Timing Module.
+   * \param num_encoding_threads Number of threads used to encode substreams.
+   *        Values less than or equal to 1 encode all substreams on the thread
+   *        calling `OutputFrames()`.
    */
   AudioFrameGenerator(
       const ::google::protobuf::RepeatedPtrField<
@@ -102,7 +121,7 @@ class AudioFrameGenerator {
           audio_elements,
       const DemixingModule& demixing_module,
       ParametersManager& parameters_manager,
-      GlobalTimingModule& global_timing_module);
+      GlobalTimingModule& global_timing_module, int num_encoding_threads = 1);
 
   /*!\brief Deleted move constructor. */
   AudioFrameGenerator(AudioFrameGenerator&&) = delete;
@@ -175,7 +194,47 @@ class AudioFrameGenerator {
    */
   absl::Status OutputFrames(std::list<AudioFrameWithData>& audio_frames);
 
+  /*!\brief Releases the PCM samples of audio frames which were consumed.
+   *
+   * The PCM samples are only needed to demix and compute recon gains of the
+   * temporal unit. Releasing them afterwards lets the caller keep the audio
+   * frames without holding the uncompressed audio. The allocations are reused
+   * by later frames.
+   *
+   * \param audio_frames Audio frames whose `pcm_samples` will be reset.
+   */
+  void RecyclePcmSamples(std::list<AudioFrameWithData>& audio_frames);
+
+  /*!\brief Resets the generator to take samples of a new IA Sequence.
+   *
+   * The encoders are reset and reused rather than created again. Any samples
+   * and frames which were not output are discarded. The same metadata, audio
+   * elements and modules as in `Initialize()` are used.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status Reset();
+
  private:
+  /*!\brief Initializes the per-sequence state of all substreams.
+   *
+   * Requires the encoders to be initialized.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status InitializeSubstreamStates()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /*!\brief Encodes all pending audio frames.
+   *
+   * Frames of different substreams may be encoded concurrently. Frames of the
+   * same substream are always encoded in order. Returns after all frames have
+   * been encoded.
+   *
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status EncodePendingFrames() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // State of an audio frame generator.
   enum GeneratorState {
     kTakingSamples,
@@ -205,12 +264,29 @@ class AudioFrameGenerator {
   absl::flat_hash_map<uint32_t, std::unique_ptr<EncoderBase>>
       substream_id_to_encoder_ ABSL_GUARDED_BY(mutex_);
 
+  // Mapping from audio substream IDs to encoders which finished, kept to be
+  // reused by `Reset()`.
+  absl::flat_hash_map<uint32_t, std::unique_ptr<EncoderBase>>
+      substream_id_to_finished_encoder_ ABSL_GUARDED_BY(mutex_);
+
+  // Mapping from audio substream IDs to frames waiting to be encoded.
+  absl::flat_hash_map<uint32_t, std::vector<PendingAudioFrame>>
+      substream_id_to_pending_frames_ ABSL_GUARDED_BY(mutex_);
+
+  // Pool used to encode substreams concurrently, or `nullptr` to encode on the
+  // calling thread.
+  std::unique_ptr<ThreadPool> encoding_thread_pool_;
+
   // Mapping from Audio Element ID to labeled samples.
   absl::flat_hash_map<DecodedUleb128, LabelSamplesMap> id_to_labeled_samples_;
 
   // Mapping from substream IDs to substream data.
   absl::flat_hash_map<uint32_t, SubstreamData> substream_id_to_substream_data_;
 
+  // Sample buffers which were released, to be reused by later frames.
+  std::vector<PlanarSampleBuffer<int32_t>> recycled_samples_
+      ABSL_GUARDED_BY(mutex_);
+
   // Mapping from substream IDs to trimming states.
   absl::flat_hash_map<uint32_t, TrimmingState> substream_id_to_trimming_state_
       ABSL_GUARDED_BY(mutex_);
@@ -76,6 +76,12 @@ class ParameterBlockGenerator {
       const absl::flat_hash_map<DecodedUleb128, const ParamDefinition*>&
           param_definitions);
 
+  /*!\brief Discards all metadata which has not been generated yet.
+   *
+   * The state from `Initialize()` is kept.
+   */
+  void Reset() { typed_proto_metadata_.clear(); }
+
   /*!\brief Adds one parameter block metadata.
    *
    * \param parameter_block_metadata parameter block metadata to add.
@@ -55,6 +55,7 @@ namespace {
 
 using ::absl_testing::IsOk;
 using ::absl_testing::IsOkAndHolds;
+using ::testing::ElementsAreArray;
 
 constexpr DecodedUleb128 kCodecConfigId = 99;
 constexpr uint32_t kSampleRate = 48000;
@@ -286,7 +287,7 @@ void InitializeAudioFrameGenerator(
     DemixingModule& demixing_module, GlobalTimingModule& global_timing_module,
     std::optional<ParametersManager>& parameters_manager,
     std::optional<AudioFrameGenerator>& audio_frame_generator,
-    bool expected_initialize_is_ok = true) {
+    bool expected_initialize_is_ok = true, int num_encoding_threads = 1) {
   // Initialize pre-requisite OBUs and the global timing module. This is all
   // derived from the `user_metadata`.
   CodecConfigGenerator codec_config_generator(
@@ -310,10 +311,10 @@ void InitializeAudioFrameGenerator(
   ASSERT_THAT(parameters_manager->Initialize(), IsOk());
 
   // Generate the audio frames.
-  audio_frame_generator.emplace(user_metadata.audio_frame_metadata(),
-                                user_metadata.codec_config_metadata(),
-                                audio_elements, demixing_module,
-                                *parameters_manager, global_timing_module);
+  audio_frame_generator.emplace(
+      user_metadata.audio_frame_metadata(),
+      user_metadata.codec_config_metadata(), audio_elements, demixing_module,
+      *parameters_manager, global_timing_module, num_encoding_threads);
   ASSERT_TRUE(audio_frame_generator.has_value());
 
   // Initialize.
@@ -1239,13 +1240,125 @@ TEST(AudioFrameGenerator, ManyFramesThreaded) {
     // The timestamp should count up by the number of samples in each frame.
     EXPECT_EQ(audio_frame.start_timestamp, kFrameSize * index);
     ASSERT_TRUE(audio_frame.pcm_samples.has_value());
-    EXPECT_EQ((*audio_frame.pcm_samples)[kFirstSample][kLeftChannel],
+    EXPECT_EQ(audio_frame.pcm_samples->Channel(kLeftChannel)[kFirstSample],
               expected_sample);
-    EXPECT_EQ((*audio_frame.pcm_samples)[kFirstSample][kRightChannel],
+    EXPECT_EQ(audio_frame.pcm_samples->Channel(kRightChannel)[kFirstSample],
               expected_sample);
     index++;
   }
 }
 
+void GenerateFramesForTwoStereoSubstreams(
+    int num_encoding_threads, std::list<AudioFrameWithData>& audio_frames) {
+  constexpr int kNumFrames = 50;
+  iamf_tools_cli_proto::UserMetadata user_metadata = {};
+  ConfigureOneStereoSubstreamLittleEndian(user_metadata);
+  AddStereoAudioElementAndAudioFrameMetadata(
+      user_metadata, kSecondAudioElementId, kSecondSubstreamId);
+  absl::flat_hash_map<uint32_t, CodecConfigObu> codec_config_obus = {};
+  absl::flat_hash_map<uint32_t, AudioElementWithData> audio_elements = {};
+  const absl::flat_hash_map<uint32_t, const ParamDefinition*>
+      param_definitions = {};
+  DemixingModule demixing_module;
+  GlobalTimingModule global_timing_module;
+  std::optional<ParametersManager> parameters_manager;
+  std::optional<AudioFrameGenerator> audio_frame_generator;
+  InitializeAudioFrameGenerator(
+      user_metadata, param_definitions, codec_config_obus, audio_elements,
+      demixing_module, global_timing_module, parameters_manager,
+      audio_frame_generator, /*expected_initialize_is_ok=*/true,
+      num_encoding_threads);
+
+  for (int i = 0; i < kNumFrames; ++i) {
+    for (const auto audio_element_id :
+         {kFirstAudioElementId, kSecondAudioElementId}) {
+      EXPECT_THAT(audio_frame_generator->AddSamples(
+                      audio_element_id, ChannelLabel::kL2,
+                      kFrame0L2EightSamples),
+                  IsOk());
+      EXPECT_THAT(audio_frame_generator->AddSamples(
+                      audio_element_id, ChannelLabel::kR2,
+                      kFrame0R2EightSamples),
+                  IsOk());
+    }
+    // Interleave outputting frames with adding samples.
+    std::list<AudioFrameWithData> temp_audio_frames;
+    EXPECT_THAT(audio_frame_generator->OutputFrames(temp_audio_frames),
+                IsOk());
+    audio_frames.splice(audio_frames.end(), temp_audio_frames);
+  }
+  EXPECT_THAT(audio_frame_generator->Finalize(), IsOk());
+  FlushAudioFrameGeneratorExpectOk(*audio_frame_generator, audio_frames);
+  EXPECT_EQ(audio_frames.size(), 2 * kNumFrames);
+}
+
+TEST(AudioFrameGenerator, ConcurrentEncodingMatchesSerialEncoding) {
+  std::list<AudioFrameWithData> serial_audio_frames;
+  GenerateFramesForTwoStereoSubstreams(/*num_encoding_threads=*/1,
+                                       serial_audio_frames);
+  std::list<AudioFrameWithData> concurrent_audio_frames;
+  GenerateFramesForTwoStereoSubstreams(/*num_encoding_threads=*/4,
+                                       concurrent_audio_frames);
+
+  // Frames within a temporal unit may be output in any order. Sort them to
+  // compare.
+  const auto compare_timestamp_and_substream_id =
+      [](const AudioFrameWithData& a, const AudioFrameWithData& b) {
+        if (a.start_timestamp == b.start_timestamp) {
+          return a.obu.GetSubstreamId() < b.obu.GetSubstreamId();
+        }
+        return a.start_timestamp < b.start_timestamp;
+      };
+  serial_audio_frames.sort(compare_timestamp_and_substream_id);
+  concurrent_audio_frames.sort(compare_timestamp_and_substream_id);
+  ValidateAudioFrames(concurrent_audio_frames, serial_audio_frames);
+}
+
+TEST(RecyclePcmSamples, ReleasesPcmSamplesAndKeepsLaterFramesIntact) {
+  constexpr int kNumFrames = 3;
+  iamf_tools_cli_proto::UserMetadata user_metadata = {};
+  ConfigureOneStereoSubstreamLittleEndian(user_metadata);
+  absl::flat_hash_map<uint32_t, CodecConfigObu> codec_config_obus = {};
+  absl::flat_hash_map<uint32_t, AudioElementWithData> audio_elements = {};
+  const absl::flat_hash_map<uint32_t, const ParamDefinition*>
+      param_definitions = {};
+  DemixingModule demixing_module;
+  GlobalTimingModule global_timing_module;
+  std::optional<ParametersManager> parameters_manager;
+  std::optional<AudioFrameGenerator> audio_frame_generator;
+  InitializeAudioFrameGenerator(user_metadata, param_definitions,
+                                codec_config_obus, audio_elements,
+                                demixing_module, global_timing_module,
+                                parameters_manager, audio_frame_generator);
+
+  for (int i = 0; i < kNumFrames; ++i) {
+    EXPECT_THAT(
+        audio_frame_generator->AddSamples(
+            kFirstAudioElementId, ChannelLabel::kL2, kFrame0L2EightSamples),
+        IsOk());
+    EXPECT_THAT(
+        audio_frame_generator->AddSamples(
+            kFirstAudioElementId, ChannelLabel::kR2, kFrame0R2EightSamples),
+        IsOk());
+    std::list<AudioFrameWithData> audio_frames;
+    EXPECT_THAT(audio_frame_generator->OutputFrames(audio_frames), IsOk());
+    ASSERT_EQ(audio_frames.size(), 1);
+
+    // Frames after the first may reuse the released buffers; they still hold
+    // their own samples.
+    const auto& pcm_samples = audio_frames.front().pcm_samples;
+    ASSERT_TRUE(pcm_samples.has_value());
+    ASSERT_EQ(pcm_samples->num_channels(), 2);
+    EXPECT_THAT(pcm_samples->Channel(0),
+                ElementsAreArray(kFrame0L2EightSamplesInt));
+    EXPECT_THAT(pcm_samples->Channel(1),
+                ElementsAreArray(kFrame0R2EightSamplesInt));
+
+    audio_frame_generator->RecyclePcmSamples(audio_frames);
+
+    EXPECT_FALSE(audio_frames.front().pcm_samples.has_value());
+  }
+}
+
 }  // namespace
 }  // namespace iamf_tools
@@ -15,7 +15,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/log/log.h"
@@ -28,8 +30,11 @@
 #include "iamf/cli/proto/mix_presentation.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/cli/renderer/loudspeakers_renderer.h"
+#include "iamf/cli/renderer/mix_matrix.h"
 #include "iamf/cli/renderer/renderer_utils.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
@@ -183,8 +188,35 @@ AudioElementRendererAmbisonicsToChannel::CreateFromAmbisonicsConfig(
     LOG(ERROR) << gains.status();
     return nullptr;
   }
-  const std::string gains_map_key =
-      absl::StrCat("A", ambisonics_order, "->", *output_key);
+  if (const auto status =
+          ValidateEqual(gains->num_input_channels,
+                        static_cast<size_t>(output_channel_count),
+                        "number of input channels of the gains");
+      !status.ok()) {
+    LOG(ERROR) << status;
+    return nullptr;
+  }
+  auto gains_matrix = MixMatrix::CreateFromRowMajor(
+      gains->gains, gains->num_input_channels, gains->num_output_channels);
+  if (!gains_matrix.ok()) {
+    LOG(ERROR) << gains_matrix.status();
+    return nullptr;
+  }
+
+  // Convert the Q15 demixing matrix once, when in projection mode.
+  std::optional<MixMatrix> demixing_matrix;
+  if (!is_mono) {
+    auto projection_matrix = MixMatrix::CreateFromQ15ColumnMajor(
+        absl::MakeConstSpan(std::get<AmbisonicsProjectionConfig>(
+                                ambisonics_config.ambisonics_config)
+                                .demixing_matrix),
+        channel_labels.size(), output_channel_count);
+    if (!projection_matrix.ok()) {
+      LOG(ERROR) << projection_matrix.status();
+      return nullptr;
+    }
+    demixing_matrix = *std::move(projection_matrix);
+  }
 
   int32_t num_output_channels = 0;
   if (!MixPresentationObu::GetNumChannelsFromLayout(playback_layout,
@@ -195,15 +227,16 @@ AudioElementRendererAmbisonicsToChannel::CreateFromAmbisonicsConfig(
 
   return absl::WrapUnique(new AudioElementRendererAmbisonicsToChannel(
       static_cast<size_t>(num_output_channels), num_samples_per_frame,
-      ambisonics_config, channel_labels, *gains));
+      channel_labels, std::move(demixing_matrix), *std::move(gains_matrix)));
 }
 
 absl::Status AudioElementRendererAmbisonicsToChannel::RenderSamples(
-    absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+    const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
     std::vector<InternalSampleType>& rendered_samples) {
   // Render the samples.
   RETURN_IF_NOT_OK(RenderAmbisonicsToLoudspeakers(
-      samples_to_render, ambisonics_config_, gains_, rendered_samples));
+      samples_to_render, demixing_matrix_ ? &*demixing_matrix_ : nullptr,
+      gains_, projected_samples_, rendered_samples));
 
   return absl::OkStatus();
 }
@@ -13,6 +13,8 @@
 #define CLI_INTERNAL_RENDERER_AUDIO_ELEMENT_RENDERER_AMBISONICS_TO_CHANNEL_H_
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -21,6 +23,8 @@
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/renderer/audio_element_renderer_base.h"
+#include "iamf/cli/renderer/mix_matrix.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
@@ -71,34 +75,39 @@ class AudioElementRendererAmbisonicsToChannel
    * Used only by the factory method.
    *
    * \param num_output_channels Number of output channels.
-   * \param ambisonics_config Config for the ambisonics layout.
+   * \param num_samples_per_frame Number of samples per frame.
    * \param ordered_labels Ordered list of channel labels to render.
+   * \param demixing_matrix Matrix projecting the input channels to ambisonics
+   *        channels in projection mode, or `std::nullopt` in mono mode.
    * \param gains Gains matrix.
    */
   AudioElementRendererAmbisonicsToChannel(
       size_t num_output_channels, size_t num_samples_per_frame,
-      const AmbisonicsConfig& ambisonics_config,
       const std::vector<ChannelLabel::Label>& ordered_labels,
-      const std::vector<std::vector<double>>& gains)
+      std::optional<MixMatrix> demixing_matrix, MixMatrix gains)
       : AudioElementRendererBase(ordered_labels, num_samples_per_frame,
                                  num_output_channels),
-        ambisonics_config_(ambisonics_config),
-        gains_(gains) {}
+        demixing_matrix_(std::move(demixing_matrix)),
+        gains_(std::move(gains)),
+        projected_samples_(gains_.num_input_channels(),
+                           num_samples_per_frame) {}
 
   /*!\brief Renders samples.
    *
-   * \param samples_to_render Samples to render arranged in (time, channel).
+   * \param samples_to_render Samples to render arranged in (channel, time).
    * \param rendered_samples Output rendered samples.
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status RenderSamples(
-      absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+      const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
       std::vector<InternalSampleType>& rendered_samples)
       ABSL_SHARED_LOCKS_REQUIRED(mutex_) override;
 
-  const AmbisonicsConfig ambisonics_config_;
+  const std::optional<MixMatrix> demixing_matrix_;
+  const MixMatrix gains_;
 
-  std::vector<std::vector<double>> gains_;
+  // Scratch buffer holding the projected samples in projection mode.
+  PlanarSampleBuffer<InternalSampleType> projected_samples_;
 };
 
 }  // namespace iamf_tools
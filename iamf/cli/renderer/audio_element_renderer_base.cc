@@ -17,10 +17,10 @@
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
-#include "absl/types/span.h"
 #include "iamf/cli/demixing_module.h"
 #include "iamf/cli/renderer/renderer_utils.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/types.h"
 
 namespace iamf_tools {
@@ -31,18 +31,16 @@ absl::StatusOr<size_t> AudioElementRendererBase::RenderLabeledFrame(
     const LabeledFrame& labeled_frame) {
   absl::MutexLock lock(&mutex_);
 
-  size_t num_valid_samples = 0;
   RETURN_IF_NOT_OK(iamf_tools::renderer_utils::ArrangeSamplesToRender(
-      labeled_frame, ordered_labels_, samples_to_render_, num_valid_samples));
+      labeled_frame, ordered_labels_, samples_to_render_));
+  const size_t num_valid_samples = samples_to_render_.num_ticks();
 
   // Render samples in concrete subclasses.
   current_labeled_frame_ = &labeled_frame;
 
   std::vector<InternalSampleType> rendered_samples(
       num_output_channels_ * num_valid_samples, 0);
-  RETURN_IF_NOT_OK(RenderSamples(
-      absl::MakeConstSpan(samples_to_render_).first(num_valid_samples),
-      rendered_samples));
+  RETURN_IF_NOT_OK(RenderSamples(samples_to_render_, rendered_samples));
 
   // Copy rendered samples to the output.
   rendered_samples_.insert(rendered_samples_.end(), rendered_samples.begin(),
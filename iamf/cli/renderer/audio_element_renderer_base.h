@@ -21,6 +21,7 @@
 #include "absl/types/span.h"
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/demixing_module.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/types.h"
 
 namespace iamf_tools {
@@ -96,18 +97,16 @@ class AudioElementRendererBase {
       : ordered_labels_(ordered_labels.begin(), ordered_labels.end()),
         num_samples_per_frame_(num_samples_per_frame),
         num_output_channels_(num_output_channels),
-        samples_to_render_(
-            num_samples_per_frame_,
-            std::vector<InternalSampleType>(ordered_labels_.size(), 0)) {}
+        samples_to_render_(ordered_labels_.size(), num_samples_per_frame_) {}
 
   /*!\brief Renders samples.
    *
-   * \param samples_to_render Samples to render arranged in (time, channel).
+   * \param samples_to_render Samples to render arranged in (channel, time).
    * \param rendered_samples Output rendered samples.
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   virtual absl::Status RenderSamples(
-      absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+      const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
       std::vector<InternalSampleType>& rendered_samples)
       ABSL_SHARED_LOCKS_REQUIRED(mutex_) = 0;
 
@@ -117,7 +116,7 @@ class AudioElementRendererBase {
 
   // Mutex to guard simultaneous access to data members.
   mutable absl::Mutex mutex_;
-  std::vector<std::vector<InternalSampleType>> samples_to_render_
+  PlanarSampleBuffer<InternalSampleType> samples_to_render_
       ABSL_GUARDED_BY(mutex_);
   std::vector<InternalSampleType> rendered_samples_ ABSL_GUARDED_BY(mutex_);
   bool is_finalized_ ABSL_GUARDED_BY(mutex_) = false;
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "absl/base/no_destructor.h"
@@ -31,9 +32,11 @@
 #include "iamf/cli/proto/mix_presentation.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/cli/renderer/loudspeakers_renderer.h"
+#include "iamf/cli/renderer/mix_matrix.h"
 #include "iamf/cli/renderer/renderer_utils.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
@@ -152,6 +155,12 @@ AudioElementRendererChannelToChannel::CreateFromScalableChannelLayoutConfig(
     LOG(ERROR) << gains.status();
     return nullptr;
   }
+  auto gains_matrix = MixMatrix::CreateFromRowMajor(
+      gains->gains, gains->num_input_channels, gains->num_output_channels);
+  if (!gains_matrix.ok()) {
+    LOG(ERROR) << gains_matrix.status();
+    return nullptr;
+  }
 
   int32_t num_output_channels = 0;
   if (!MixPresentationObu::GetNumChannelsFromLayout(playback_layout,
@@ -162,18 +171,40 @@ AudioElementRendererChannelToChannel::CreateFromScalableChannelLayoutConfig(
 
   return absl::WrapUnique(new AudioElementRendererChannelToChannel(
       *input_key, *output_key, static_cast<size_t>(num_output_channels),
-      num_samples_per_frame, *ordered_labels, *gains));
+      num_samples_per_frame, *ordered_labels, *std::move(gains_matrix)));
 }
 
 absl::Status AudioElementRendererChannelToChannel::RenderSamples(
-    absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+    const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
     std::vector<InternalSampleType>& rendered_samples) {
-  // Render the samples.
-  RETURN_IF_NOT_OK(RenderChannelLayoutToLoudspeakers(
-      samples_to_render, current_labeled_frame_->demixing_params,
-      ordered_labels_, input_key_, output_key_, gains_, rendered_samples));
+  const auto& down_mixing_params = current_labeled_frame_->demixing_params;
+  if (!down_mixing_params.in_bitstream) {
+    return gains_.ApplyInterleaved(samples_to_render, rendered_samples);
+  }
+
+  // Compute the gains the first time each set of down-mixing parameters is
+  // seen.
+  // TODO(b/292174366): Find a better solution and strictly follow the spec for
+  //                    which renderer to use.
+  const DownMixingGainsKey key = {
+      down_mixing_params.alpha, down_mixing_params.beta,
+      down_mixing_params.gamma, down_mixing_params.delta,
+      down_mixing_params.w};
+  auto cached_gains = down_mixing_gains_cache_.find(key);
+  if (cached_gains == down_mixing_gains_cache_.end()) {
+    auto computed_gains = ComputeChannelLayoutToLoudspeakersGains(
+        down_mixing_params, ordered_labels_, input_key_, output_key_);
+    if (!computed_gains.ok()) {
+      return computed_gains.status();
+    }
+    cached_gains =
+        down_mixing_gains_cache_.emplace(key, *std::move(computed_gains))
+            .first;
+  }
 
-  return absl::OkStatus();
+  const MixMatrix& gains_to_use =
+      cached_gains->second.has_value() ? *cached_gains->second : gains_;
+  return gains_to_use.ApplyInterleaved(samples_to_render, rendered_samples);
 }
 
 }  // namespace iamf_tools
@@ -13,15 +13,21 @@
 #define CLI_INTERNAL_RENDERER_AUDIO_ELEMENT_RENDERER_CHANNEL_TO_CHANNEL_H_
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/renderer/audio_element_renderer_base.h"
+#include "iamf/cli/renderer/mix_matrix.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
@@ -72,32 +78,45 @@ class AudioElementRendererChannelToChannel : public AudioElementRendererBase {
    * \param num_output_channels Number of output channels.
    * \param num_samples_per_frame Number of samples per frame.
    * \param ordered_labels Ordered list of channel labels to render.
+   * \param gains Precomputed gains matrix.
    */
   AudioElementRendererChannelToChannel(
       absl::string_view input_key, absl::string_view output_key,
       size_t num_output_channels, size_t num_samples_per_frame,
       const std::vector<ChannelLabel::Label>& ordered_labels,
-      const std::vector<std::vector<double>>& gains)
+      MixMatrix gains)
       : AudioElementRendererBase(ordered_labels, num_samples_per_frame,
                                  num_output_channels),
         input_key_(input_key),
         output_key_(output_key),
-        gains_(gains) {}
+        gains_(std::move(gains)) {}
 
   /*!\brief Renders samples.
    *
-   * \param samples_to_render Samples to render arranged in (time, channel).
+   * \param samples_to_render Samples to render arranged in (channel, time).
    * \param rendered_samples Output rendered samples.
    * \return `absl::OkStatus()` on success. A specific status on failure.
    */
   absl::Status RenderSamples(
-      absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+      const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
       std::vector<InternalSampleType>& rendered_samples)
       ABSL_SHARED_LOCKS_REQUIRED(mutex_) override;
 
+  // Down-mixing parameters (alpha, beta, gamma, delta, w) which determine the
+  // computed gains. The layouts are fixed for the lifetime of the renderer,
+  // so they do not need to be part of the key.
+  using DownMixingGainsKey =
+      std::tuple<double, double, double, double, double>;
+
   const std::string input_key_;
   const std::string output_key_;
-  const std::vector<std::vector<double>> gains_;
+  const MixMatrix gains_;
+
+  // Gains computed from the down-mixing parameters in the bitstream, or
+  // `std::nullopt` when those parameters call for `gains_`. Only a few
+  // distinct parameters occur in a stream, so this stays small.
+  absl::flat_hash_map<DownMixingGainsKey, std::optional<MixMatrix>>
+      down_mixing_gains_cache_;
 };
 
 }  // namespace iamf_tools
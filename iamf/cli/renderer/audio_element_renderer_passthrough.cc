@@ -19,7 +19,6 @@
 
 #include "absl/base/no_destructor.h"
 #include "absl/container/flat_hash_map.h"
-#include "absl/functional/any_invocable.h"
 #include "absl/log/log.h"
 #include "absl/memory/memory.h"
 #include "absl/status/status.h"
@@ -31,6 +30,7 @@
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
@@ -178,19 +178,11 @@ AudioElementRendererPassThrough::CreateFromScalableChannelLayoutConfig(
 }
 
 absl::Status AudioElementRendererPassThrough::RenderSamples(
-    absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+    const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
     std::vector<InternalSampleType>& rendered_samples) {
-  // Flatten the (time, channel) axes into interleaved samples.
-  const absl::AnyInvocable<absl::Status(InternalSampleType, InternalSampleType&)
-                               const>
-      kIdentityTransform =
-          [](InternalSampleType input, InternalSampleType& output) {
-            output = input;
-            return absl::OkStatus();
-          };
-
-  return ConvertTimeChannelToInterleaved(samples_to_render, kIdentityTransform,
-                                         rendered_samples);
+  // Flatten the (channel, time) axes into interleaved samples.
+  samples_to_render.ToInterleaved(rendered_samples);
+  return absl::OkStatus();
 }
 
 }  // namespace iamf_tools
@@ -12,14 +12,16 @@
 #ifndef CLI_INTERNAL_RENDERER_LOUDSPEAKERS_RENDERER_H_
 #define CLI_INTERNAL_RENDERER_LOUDSPEAKERS_RENDERER_H_
 
+#include <optional>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
-#include "absl/types/span.h"
 #include "iamf/cli/channel_label.h"
-#include "iamf/obu/audio_element.h"
+#include "iamf/cli/renderer/mix_matrix.h"
+#include "iamf/cli/renderer/precomputed_gains.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/demixing_info_parameter_data.h"
 #include "iamf/obu/types.h"
 
@@ -30,41 +32,45 @@ namespace iamf_tools {
  * \param input_key Key representing the input loudspeaker layout.
  * \param output_key Key representing the output loudspeaker layout.
  * \return Precomputed gains on success. A specific status on failure.
+ *         The gains refer to static tables and are never copied.
  */
-absl::StatusOr<std::vector<std::vector<double>>> LookupPrecomputedGains(
+absl::StatusOr<PrecomputedGainsMatrix> LookupPrecomputedGains(
     absl::string_view input_key, absl::string_view output_key);
 
-/*!\brief Renders channel-based samples to loudspeaker channels.
+/*!\brief Computes gains to render a channel layout to loudspeakers.
+ *
+ * The gains depend only on the layouts and on the down-mixing parameters, so
+ * callers may cache the result.
  *
- * \param input_samples Input samples to render.
  * \param down_mixing_params Down-mixing parameters.
  * \param channel_labels Labels of input channels.
  * \param input_key Key representing the input loudspeaker layout.
  * \param output_key Key representing the output loudspeaker layout.
- * \param gains Gains matrix to apply to the output.
- * \param rendered_samples Output rendered samples.
- * \return `absl::OkStatus()` on success. A specific status on failure.
+ * \return Gains computed from the down-mixing parameters, or `std::nullopt`
+ *         when the precomputed gains should be used instead. A specific
+ *         status on failure.
  */
-absl::Status RenderChannelLayoutToLoudspeakers(
-    absl::Span<const std::vector<InternalSampleType>>& input_samples,
+absl::StatusOr<std::optional<MixMatrix>>
+ComputeChannelLayoutToLoudspeakersGains(
     const DownMixingParams& down_mixing_params,
     const std::vector<ChannelLabel::Label>& channel_labels,
-    absl::string_view input_key, absl::string_view output_key,
-    const std::vector<std::vector<double>>& gains,
-    std::vector<InternalSampleType>& rendered_samples);
+    absl::string_view input_key, absl::string_view output_key);
 
 /*!\brief Renders ambisonics samples to loudspeaker channels.
  *
- * \param input_samples Input samples to render.
- * \param ambisonics_config Config for the ambisonics layout.
- * \param gains Gains matrix to apply to the output.
+ * \param input_samples Input samples to render arranged in (channel, time).
+ * \param demixing_matrix Matrix projecting the input samples to ambisonics
+ *        channels in projection mode, or `nullptr` in mono mode.
+ * \param gains Gains matrix to apply to the ambisonics channels.
+ * \param projected_samples Scratch buffer for the projected samples. Only
+ *        used in projection mode.
  * \param rendered_samples Output rendered samples.
  * \return `absl::OkStatus()` on success. A specific status on failure.
  */
 absl::Status RenderAmbisonicsToLoudspeakers(
-    absl::Span<const std::vector<InternalSampleType>>& input_samples,
-    const AmbisonicsConfig& ambisonics_config,
-    const std::vector<std::vector<double>>& gains,
+    const PlanarSampleBuffer<InternalSampleType>& input_samples,
+    const MixMatrix* demixing_matrix, const MixMatrix& gains,
+    PlanarSampleBuffer<InternalSampleType>& projected_samples,
     std::vector<InternalSampleType>& rendered_samples);
 
 }  // namespace iamf_tools
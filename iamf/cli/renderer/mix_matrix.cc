@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/renderer/mix_matrix.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "iamf/common/macros.h"
+#include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+
+namespace {
+
+// Number of ticks accumulated at once when writing interleaved output. Small
+// enough for the accumulator to stay on the stack and in the L1 cache.
+constexpr size_t kBlockSize = 64;
+
+// Computes `accumulator[t] += input[t] * gain`.
+void AccumulateScaled(const double* input, const double gain,
+                      const size_t num_ticks, double* accumulator) {
+  size_t t = 0;
+#if defined(__AVX__)
+  const __m256d gain_x4 = _mm256_set1_pd(gain);
+  for (; t + 4 <= num_ticks; t += 4) {
+    const __m256d product = _mm256_mul_pd(_mm256_loadu_pd(input + t), gain_x4);
+    _mm256_storeu_pd(accumulator + t,
+                     _mm256_add_pd(_mm256_loadu_pd(accumulator + t), product));
+  }
+#elif defined(__SSE2__)
+  const __m128d gain_x2 = _mm_set1_pd(gain);
+  for (; t + 2 <= num_ticks; t += 2) {
+    const __m128d product = _mm_mul_pd(_mm_loadu_pd(input + t), gain_x2);
+    _mm_storeu_pd(accumulator + t,
+                  _mm_add_pd(_mm_loadu_pd(accumulator + t), product));
+  }
+#endif
+  for (; t < num_ticks; ++t) {
+    accumulator[t] += input[t] * gain;
+  }
+}
+
+// Computes `accumulator[t] += input[t]`, which is what `AccumulateScaled()`
+// computes for a unit gain.
+void Accumulate(const double* input, const size_t num_ticks,
+                double* accumulator) {
+  size_t t = 0;
+#if defined(__AVX__)
+  for (; t + 4 <= num_ticks; t += 4) {
+    _mm256_storeu_pd(accumulator + t,
+                     _mm256_add_pd(_mm256_loadu_pd(accumulator + t),
+                                   _mm256_loadu_pd(input + t)));
+  }
+#elif defined(__SSE2__)
+  for (; t + 2 <= num_ticks; t += 2) {
+    _mm_storeu_pd(accumulator + t, _mm_add_pd(_mm_loadu_pd(accumulator + t),
+                                              _mm_loadu_pd(input + t)));
+  }
+#endif
+  for (; t < num_ticks; ++t) {
+    accumulator[t] += input[t];
+  }
+}
+
+double Q15ToSignedDouble(const int16_t input) {
+  return static_cast<double>(input) / 32768.0;
+}
+
+}  // namespace
+
+template <typename GainAt>
+MixMatrix::MixMatrix(size_t num_input_channels, size_t num_output_channels,
+                     GainAt gain_at)
+    : num_input_channels_(num_input_channels),
+      num_output_channels_(num_output_channels) {
+  term_offsets_.reserve(num_output_channels + 1);
+  for (size_t out = 0; out < num_output_channels; ++out) {
+    for (size_t in = 0; in < num_input_channels; ++in) {
+      const double gain = gain_at(in, out);
+      if (gain != 0.0) {
+        terms_.push_back({.input_channel = in, .gain = gain});
+      }
+    }
+    term_offsets_.push_back(terms_.size());
+  }
+}
+
+absl::StatusOr<MixMatrix> MixMatrix::Create(
+    const std::vector<std::vector<double>>& gains) {
+  if (gains.empty()) {
+    return absl::InvalidArgumentError("Expected at least one input channel.");
+  }
+  const size_t num_output_channels = gains.front().size();
+  for (const auto& row : gains) {
+    RETURN_IF_NOT_OK(
+        ValidateContainerSizeEqual("gains", row, num_output_channels));
+  }
+  return MixMatrix(gains.size(), num_output_channels,
+                   [&gains](size_t in, size_t out) { return gains[in][out]; });
+}
+
+absl::StatusOr<MixMatrix> MixMatrix::CreateFromRowMajor(
+    absl::Span<const double> gains, size_t num_input_channels,
+    size_t num_output_channels) {
+  RETURN_IF_NOT_OK(ValidateContainerSizeEqual(
+      "gains", gains, num_input_channels * num_output_channels));
+  return MixMatrix(num_input_channels, num_output_channels,
+                   [gains, num_output_channels](size_t in, size_t out) {
+                     return gains[in * num_output_channels + out];
+                   });
+}
+
+absl::StatusOr<MixMatrix> MixMatrix::CreateFromQ15ColumnMajor(
+    absl::Span<const int16_t> q15_gains, size_t num_input_channels,
+    size_t num_output_channels) {
+  RETURN_IF_NOT_OK(ValidateContainerSizeEqual(
+      "q15_gains", q15_gains, num_input_channels * num_output_channels));
+  return MixMatrix(num_input_channels, num_output_channels,
+                   [q15_gains, num_output_channels](size_t in, size_t out) {
+                     return Q15ToSignedDouble(
+                         q15_gains[in * num_output_channels + out]);
+                   });
+}
+
+absl::Status MixMatrix::ValidateInput(
+    const PlanarSampleBuffer<InternalSampleType>& input_samples) const {
+  if (input_samples.num_channels() != num_input_channels_) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Expected ", num_input_channels_,
+                     " input channels, got ", input_samples.num_channels()));
+  }
+  return absl::OkStatus();
+}
+
+void MixMatrix::AccumulateOutputChannel(
+    const PlanarSampleBuffer<InternalSampleType>& input_samples,
+    size_t output_channel, size_t start_tick, size_t num_ticks,
+    InternalSampleType* accumulator) const {
+  for (size_t i = term_offsets_[output_channel];
+       i < term_offsets_[output_channel + 1]; ++i) {
+    const auto& term = terms_[i];
+    const InternalSampleType* input =
+        input_samples.Channel(term.input_channel).data() + start_tick;
+    if (term.gain == 1.0) {
+      Accumulate(input, num_ticks, accumulator);
+    } else {
+      AccumulateScaled(input, term.gain, num_ticks, accumulator);
+    }
+  }
+}
+
+absl::Status MixMatrix::Apply(
+    const PlanarSampleBuffer<InternalSampleType>& input_samples,
+    PlanarSampleBuffer<InternalSampleType>& output_samples) const {
+  RETURN_IF_NOT_OK(ValidateInput(input_samples));
+  if (output_samples.num_channels() != num_output_channels_) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Expected ", num_output_channels_,
+                     " output channels, got ", output_samples.num_channels()));
+  }
+  const size_t num_ticks = input_samples.num_ticks();
+  RETURN_IF_NOT_OK(output_samples.SetNumTicks(num_ticks));
+
+  for (size_t out = 0; out < num_output_channels_; ++out) {
+    output_samples.FillChannel(out, 0.0);
+    AccumulateOutputChannel(input_samples, out, 0, num_ticks,
+                            output_samples.Channel(out).data());
+  }
+  return absl::OkStatus();
+}
+
+absl::Status MixMatrix::ApplyInterleaved(
+    const PlanarSampleBuffer<InternalSampleType>& input_samples,
+    std::vector<InternalSampleType>& output_samples) const {
+  RETURN_IF_NOT_OK(ValidateInput(input_samples));
+  const size_t num_ticks = input_samples.num_ticks();
+  output_samples.resize(num_ticks * num_output_channels_);
+
+  // Accumulate each output channel over a block of contiguous ticks, then
+  // scatter the block into the interleaved output.
+  InternalSampleType accumulator[kBlockSize];
+  for (size_t start = 0; start < num_ticks; start += kBlockSize) {
+    const size_t block_size = std::min(kBlockSize, num_ticks - start);
+    for (size_t out = 0; out < num_output_channels_; ++out) {
+      std::fill_n(accumulator, block_size, 0.0);
+      AccumulateOutputChannel(input_samples, out, start, block_size,
+                              accumulator);
+      for (size_t t = 0; t < block_size; ++t) {
+        output_samples[(start + t) * num_output_channels_ + out] =
+            accumulator[t];
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace iamf_tools
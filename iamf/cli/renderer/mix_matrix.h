@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#ifndef CLI_INTERNAL_RENDERER_MIX_MATRIX_H_
+#define CLI_INTERNAL_RENDERER_MIX_MATRIX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/span.h"
+#include "iamf/common/planar_sample_buffer.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+
+/*!\brief Matrix which mixes planar input channels into output channels.
+ *
+ * The matrix is flattened once at creation. Only the non-zero gains of each
+ * output channel are kept, so the mostly-identity matrices used for rendering
+ * skip the channels which do not contribute. Unit gains are accumulated
+ * without a multiplication.
+ *
+ * Mixing vectorizes over time with SSE2 or AVX when available, and falls back
+ * to scalar code otherwise. Each output sample is summed over its input
+ * channels in ascending order without fused multiply-adds, so the result is
+ * identical regardless of which path is used.
+ */
+class MixMatrix {
+ public:
+  /*!\brief Creates an empty matrix without any channels. */
+  MixMatrix() = default;
+
+  /*!\brief Creates a matrix from gains.
+   *
+   * \param gains Gains arranged in (input channel, output channel) axes.
+   * \return Matrix on success. A specific status if `gains` is empty or the
+   *         rows have different sizes.
+   */
+  static absl::StatusOr<MixMatrix> Create(
+      const std::vector<std::vector<double>>& gains);
+
+  /*!\brief Creates a matrix from row-major gains.
+   *
+   * \param gains Gains stored in row major, i.e. the gain of input `i` to
+   *        output `o` is at `i * num_output_channels + o`.
+   * \param num_input_channels Number of input channels.
+   * \param num_output_channels Number of output channels.
+   * \return Matrix on success. A specific status if `gains` does not hold
+   *         exactly one gain per pair of channels.
+   */
+  static absl::StatusOr<MixMatrix> CreateFromRowMajor(
+      absl::Span<const double> gains, size_t num_input_channels,
+      size_t num_output_channels);
+
+  /*!\brief Creates a matrix from column-major Q15 gains.
+   *
+   * \param q15_gains Gains encoded as Q15 and stored in column major, i.e.
+   *        the gain of input `i` to output `o` is at
+   *        `i * num_output_channels + o`.
+   * \param num_input_channels Number of input channels.
+   * \param num_output_channels Number of output channels.
+   * \return Matrix on success. A specific status if `q15_gains` does not hold
+   *         exactly one gain per pair of channels.
+   */
+  static absl::StatusOr<MixMatrix> CreateFromQ15ColumnMajor(
+      absl::Span<const int16_t> q15_gains, size_t num_input_channels,
+      size_t num_output_channels);
+
+  /*!\brief Gets the number of input channels.
+   *
+   * \return Number of input channels.
+   */
+  size_t num_input_channels() const { return num_input_channels_; }
+
+  /*!\brief Gets the number of output channels.
+   *
+   * \return Number of output channels.
+   */
+  size_t num_output_channels() const { return num_output_channels_; }
+
+  /*!\brief Mixes planar samples into planar samples.
+   *
+   * \param input_samples Input samples to mix.
+   * \param output_samples Output samples. Must have `num_output_channels()`
+   *        channels and room for all ticks of `input_samples`. The number of
+   *        ticks is set to match the input.
+   * \return `absl::OkStatus()` on success. A specific status if the buffers do
+   *         not agree with the dimensions of the matrix.
+   */
+  absl::Status Apply(
+      const PlanarSampleBuffer<InternalSampleType>& input_samples,
+      PlanarSampleBuffer<InternalSampleType>& output_samples) const;
+
+  /*!\brief Mixes planar samples into interleaved samples.
+   *
+   * \param input_samples Input samples to mix.
+   * \param output_samples Output samples arranged in (time, channel) order.
+   *        Resized to hold all ticks of `input_samples`.
+   * \return `absl::OkStatus()` on success. A specific status if the input does
+   *         not agree with the dimensions of the matrix.
+   */
+  absl::Status ApplyInterleaved(
+      const PlanarSampleBuffer<InternalSampleType>& input_samples,
+      std::vector<InternalSampleType>& output_samples) const;
+
+ private:
+  /*!\brief Contribution of an input channel to an output channel. */
+  struct Term {
+    size_t input_channel;
+    double gain;
+  };
+
+  /*!\brief Constructor.
+   *
+   * \param num_input_channels Number of input channels.
+   * \param num_output_channels Number of output channels.
+   * \param gain_at Function returning the gain of an (input, output) pair.
+   */
+  template <typename GainAt>
+  MixMatrix(size_t num_input_channels, size_t num_output_channels,
+            GainAt gain_at);
+
+  absl::Status ValidateInput(
+      const PlanarSampleBuffer<InternalSampleType>& input_samples) const;
+
+  /*!\brief Accumulates a block of one output channel.
+   *
+   * \param input_samples Input samples to mix.
+   * \param output_channel Output channel to accumulate.
+   * \param start_tick First tick of the block.
+   * \param num_ticks Number of ticks in the block.
+   * \param accumulator Zero-initialized output of the block.
+   */
+  void AccumulateOutputChannel(
+      const PlanarSampleBuffer<InternalSampleType>& input_samples,
+      size_t output_channel, size_t start_tick, size_t num_ticks,
+      InternalSampleType* accumulator) const;
+
+  size_t num_input_channels_ = 0;
+  size_t num_output_channels_ = 0;
+
+  // Non-zero terms of output channel `o` are in
+  // `[term_offsets_[o], term_offsets_[o + 1])`, in ascending input order.
+  std::vector<Term> terms_;
+  std::vector<size_t> term_offsets_ = {0};
+};
+
+}  // namespace iamf_tools
+
+#endif  // CLI_INTERNAL_RENDERER_MIX_MATRIX_H_
@@ -11,3949 +11,4635 @@
  */
 #include "iamf/cli/renderer/precomputed_gains.h"
 
-#include "absl/container/flat_hash_map.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace iamf_tools {
 
-PrecomputedGains InitPrecomputedGains() {
-  PrecomputedGains gains;
-
-  // Generated on Sun Aug 25 04:53:27 2024, GMT
-
-  // -------------------------------------------------------
-  // Input layout: 0+1+0
-  gains["0+1+0"]["0+2+0"] = {{0.7071067811865476, 0.7071067811865476}};
-  gains["0+1+0"]["0+5+0"] = {{0, 0, 1, 0, 0, 0}};
-  gains["0+1+0"]["2+5+0"] = {{0, 0, 1, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["4+5+0"] = {{0, 0, 1, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["4+5+1"] = {{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["3+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["4+9+0"] = {{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["9+10+3"] = {
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["0+7+0"] = {{0, 0, 1, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["4+7+0"] = {{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["3.1.2"] = {{0, 0, 1, 0, 0, 0}};
-  gains["0+1+0"]["7.1.2"] = {{0, 0, 1, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+1+0"]["9.1.6"] = {{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  // Skipping identity matrix: 0+1+0 to 0+1+0
-
-  // -------------------------------------------------------
-  // Input layout: 0+2+0
-  // Skipping identity matrix: 0+2+0 to 0+2+0
-  gains["0+2+0"]["0+5+0"] = {{1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0}};
-  gains["0+2+0"]["2+5+0"] = {{1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["4+5+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["4+5+1"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["3+7+0"] = {{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["0+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["3.1.2"] = {{1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0}};
-  gains["0+2+0"]["7.1.2"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+2+0"]["0+1+0"] = {{0.5}, {0.5}};
-
-  // -------------------------------------------------------
-  // Input layout: 0+5+0
-  gains["0+5+0"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476}};
-  // Skipping identity matrix: 0+5+0 to 0+5+0
-  gains["0+5+0"]["2+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["0+5+0"]["4+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["0+5+0"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0}};
-  gains["0+5+0"]["3+7+0"] = {{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}};
-  gains["0+5+0"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["0+5+0"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+5+0"]["0+7+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["0+5+0"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["0+5+0"]["3.1.2"] = {{1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0}};
-  gains["0+5+0"]["7.1.2"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["0+5+0"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+5+0"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738}};
-
-  // -------------------------------------------------------
-  // Input layout: 2+5+0
-  gains["2+5+0"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {1, 0},
-                             {0, 1}};
-  gains["2+5+0"]["0+5+0"] = {{1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0}, {0, 0, 0, 1, 0, 0},
-                             {0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 1},
-                             {1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0}};
-  // Skipping identity matrix: 2+5+0 to 2+5+0
-  gains["2+5+0"]["4+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["2+5+0"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}};
-  gains["2+5+0"]["3+7+0"] = {{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0}};
-  gains["2+5+0"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["2+5+0"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["2+5+0"]["0+7+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["2+5+0"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["2+5+0"]["3.1.2"] = {{1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1}};
-  gains["2+5+0"]["7.1.2"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["2+5+0"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["2+5+0"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.5},
-                             {0.5}};
-
-  // -------------------------------------------------------
-  // Input layout: 4+5+0
-  gains["4+5+0"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476}};
-  gains["4+5+0"]["0+5+0"] = {{1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0}, {0, 0, 0, 1, 0, 0},
-                             {0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 1},
-                             {1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 1}};
-  gains["4+5+0"]["2+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0}};
-  // Skipping identity matrix: 4+5+0 to 4+5+0
-  gains["4+5+0"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}};
-  gains["4+5+0"]["3+7+0"] = {
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0.7071067811865476, 0, 0}};
-  gains["4+5+0"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["4+5+0"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["4+5+0"]["0+7+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["4+5+0"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["4+5+0"]["3.1.2"] = {{1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1},
-                             {0, 0, 0, 0, 0.7071067811865476, 0},
-                             {0, 0, 0, 0, 0, 0.7071067811865476}};
-  gains["4+5+0"]["7.1.2"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476}};
-  gains["4+5+0"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["4+5+0"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.5},
-                             {0.5},
-                             {0.3535533905932738},
-                             {0.3535533905932738}};
-
-  // -------------------------------------------------------
-  // Input layout: 0+7+0
-  gains["0+7+0"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476}};
-  gains["0+7+0"]["0+5+0"] = {
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476},
-      {0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1}};
-  gains["0+7+0"]["2+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["0+7+0"]["4+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["0+7+0"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0}};
-  gains["0+7+0"]["3+7+0"] = {{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}};
-  gains["0+7+0"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["0+7+0"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  // Skipping identity matrix: 0+7+0 to 0+7+0
-  gains["0+7+0"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["0+7+0"]["3.1.2"] = {{1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {1.207106781186548, 0, 0, 0, 0, 0},
-                             {0, 1.207106781186548, 0, 0, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0}};
-  gains["0+7+0"]["7.1.2"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["0+7+0"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["0+7+0"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738}};
-
-  // -------------------------------------------------------
-  // Input layout: 4+7+0
-  gains["4+7+0"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476}};
-  gains["4+7+0"]["0+5+0"] = {
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476},
-      {0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1}};
-  gains["4+7+0"]["2+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["4+7+0"]["4+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["4+7+0"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0}};
-  gains["4+7+0"]["3+7+0"] = {
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0.7071067811865476, 0, 0}};
-  gains["4+7+0"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["4+7+0"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["4+7+0"]["0+7+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1}};
-  // Skipping identity matrix: 4+7+0 to 4+7+0
-  gains["4+7+0"]["3.1.2"] = {{1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1},
-                             {0, 0, 0, 0, 0.7071067811865476, 0},
-                             {0, 0, 0, 0, 0, 0.7071067811865476}};
-  gains["4+7+0"]["7.1.2"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476}};
-  gains["4+7+0"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["4+7+0"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.5},
-                             {0.5},
-                             {0.3535533905932738},
-                             {0.3535533905932738}};
-
-  // -------------------------------------------------------
-  // Input layout: 3.1.2
-  gains["3.1.2"]["0+2+0"] = {
-      {1, 0}, {0, 1}, {0.7071067811865476, 0.7071067811865476},
-      {0, 0}, {1, 0}, {0, 1}};
-  gains["3.1.2"]["0+5+0"] = {{1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0}, {0, 0, 0, 1, 0, 0},
-                             {1, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0}};
-  gains["3.1.2"]["2+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["3.1.2"]["4+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["3.1.2"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}};
-  gains["3.1.2"]["3+7+0"] = {{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0}};
-  gains["3.1.2"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["3.1.2"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["3.1.2"]["0+7+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["3.1.2"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  // Skipping identity matrix: 3.1.2 to 3.1.2
-
-  gains["3.1.2"]["7.1.2"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["3.1.2"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["3.1.2"]["0+1+0"] = {{0.5}, {0.5}, {0.7071067811865476},
-                             {0},   {0.5}, {0.5}};
-
-  // -------------------------------------------------------
-  // Input layout: 7.1.2
-  gains["7.1.2"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {1, 0},
-                             {0, 1}};
-  gains["7.1.2"]["0+5+0"] = {
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476},
-      {0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0}};
-  gains["7.1.2"]["2+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1}};
-  gains["7.1.2"]["4+5+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["7.1.2"]["4+5+1"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0}};
-  gains["7.1.2"]["3+7+0"] = {{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0}};
-  gains["7.1.2"]["4+9+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["7.1.2"]["9+10+3"] = {
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-  gains["7.1.2"]["0+7+0"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 0, 0, 0}};
-  gains["7.1.2"]["4+7+0"] = {{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["7.1.2"]["3.1.2"] = {{1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {1.207106781186548, 0, 0, 0, 0, 0},
-                             {0, 1.207106781186548, 0, 0, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1}};
-  // Skipping identity matrix: 7.1.2 to 7.1.2
-
-  gains["7.1.2"]["9.1.6"] = {{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["7.1.2"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.5},
-                             {0.5}};
-
-  // -------------------------------------------------------
-  // Input layout: 9.1.6
-  gains["9.1.6"]["0+2+0"] = {{1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0.7071067811865476},
-                             {0, 0},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {1, 0},
-                             {0, 1},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476},
-                             {0.7071067811865476, 0},
-                             {0, 0.7071067811865476}};
-  gains["9.1.6"]["0+5+0"] = {
-      {0.816496580927726, 0, 0, 0, 0.5773502691896257, 0},
-      {0, 0.816496580927726, 0, 0, 0, 0.5773502691896257},
-      {0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0},
-      {0.5773502691896257, 0, 0, 0, 0.816496580927726, 0},
-      {0, 0.5773502691896257, 0, 0, 0, 0.816496580927726},
-      {1, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 1},
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476}};
-  gains["9.1.6"]["2+5+0"] = {
-      {0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0},
-      {0, 0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0},
-      {0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0},
-      {0, 0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0},
-      {0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476}};
-  gains["9.1.6"]["4+5+0"] = {
-      {0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0},
-      {0, 0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0},
-      {0, 0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476}};
-  gains["9.1.6"]["4+5+1"] = {
-      {0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0, 0},
-      {0, 0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0, 0},
-      {0, 0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0}};
-  gains["9.1.6"]["3+7+0"] = {
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0, 0.816496580927726, 0, 0},
-      {0, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0.816496580927726, 0, 0},
-      {0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0, 0.5773502691896257, 0, 0},
-      {0, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0.5773502691896257, 0, 0}};
-  gains["9.1.6"]["4+9+0"] = {{0.7071067811865476, 0, 0, 0, 0.7071067811865476,
-                              0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0,
-                              0.7071067811865476, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0,
-                              0.7071067811865476, 0, 0, 0},
-                             {0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0,
-                              0.7071067811865476, 0, 0}};
-  gains["9.1.6"]["9+10+3"] = {
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0}};
-  gains["9.1.6"]["0+7+0"] = {
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1},
-      {1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0}};
-  gains["9.1.6"]["4+7+0"] = {
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476}};
-  gains["9.1.6"]["3.1.2"] = {{1.207106781186548, 0, 0, 0, 0, 0},
-                             {0, 1.207106781186548, 0, 0, 0, 0},
-                             {0, 0, 1, 0, 0, 0},
-                             {0, 0, 0, 1, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {1, 0, 0, 0, 0, 0},
-                             {0, 1, 0, 0, 0, 0},
-                             {0.7071067811865476, 0, 0, 0, 0, 0},
-                             {0, 0.7071067811865476, 0, 0, 0, 0},
-                             {0, 0, 0, 0, 1, 0},
-                             {0, 0, 0, 0, 0, 1},
-                             {0, 0, 0, 0, 0.7071067811865476, 0},
-                             {0, 0, 0, 0, 0, 0.7071067811865476},
-                             {0, 0, 0, 0, 1.207106781186548, 0},
-                             {0, 0, 0, 0, 0, 1.207106781186548}};
-  gains["9.1.6"]["7.1.2"] = {
-      {0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0},
-      {0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0},
-      {0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
-      {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476},
-      {0, 0, 0, 0, 0, 0, 0, 0, 1.207106781186548, 0},
-      {0, 0, 0, 0, 0, 0, 0, 0, 0, 1.207106781186548}};
-  // Skipping identity matrix: 9.1.6 to 9.1.6
-
-  gains["9.1.6"]["0+1+0"] = {{0.5},
-                             {0.5},
-                             {0.7071067811865476},
-                             {0},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.5},
-                             {0.5},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.5},
-                             {0.5},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738},
-                             {0.3535533905932738}};
-
-  // -------------------------------------------------------
-  // Input layout: A0
-  gains["A0"]["0+2+0"] = {{0.7071008213968912, 0.707112740925987}};
-  gains["A0"]["0+5+0"] = {{0.3263355531701697, 0.3263383644933828,
-                           0.2151315278709894, 0, 0.6085778645723429,
-                           0.608571924315719}};
-  gains["A0"]["2+5+0"] = {{0.2154513872061713, 0.2154622268603212,
-                           0.1449662018040889, 0, 0.645327082470003,
-                           0.6453189902061011, 0.1631927661554572,
-                           0.1631747758277981}};
-  gains["A0"]["4+5+0"] = {
-      {0.2589132999145944, 0.2589253088681112, 0.1717924582033098, 0,
-       0.5558287092111358, 0.5558131000120811, 0.196782449621433,
-       0.1967602437260952, 0.2656046750564827, 0.2656151602017694}};
-  gains["A0"]["4+5+1"] = {{0.1375100903716531, 0.1375206718313378,
-                           0.05714168131247213, 0, 0.5839449180158363,
-                           0.5839301225470853, 0.1959384400945835,
-                           0.1959163294414141, 0.264465483647113,
-                           0.2644759238211001, 0.2455264263929417}};
-  gains["A0"]["3+7+0"] = {{0.2219895825571791, 0.2422498248350245,
-                           0.2422647599782093, 0.2575044204591602,
-                           0.2574982220440356, 0.360899749398248,
-                           0.3608875769262723, 0.3689694314374973,
-                           0.3689551560194772, 0.4098472300507444, 0, 0}};
-  gains["A0"]["4+9+0"] = {
-      {0.2197345779107386, 0.2197658012546257, 0.1683870145708428, 0,
-       0.3193101735236183, 0.3193129430652121, 0.3759078826756547,
-       0.3758810274295499, 0.2977143280157135, 0.2976931252602669,
-       0.2981130969556019, 0.2981195717502504, 0.1295464157014552,
-       0.1294932671541695}};
-  gains["A0"]["9+10+3"] = {{0.09620442018565725, 0.09621115229239315,
-                            0.057686470561278,   0,
-                            0.3430243634887538,  0.3430203628372547,
-                            0.09762670568249716, 0.09763078265127419,
-                            0.3430201810379803,  0,
-                            0.3133067479574846,  0.3133147585847036,
-                            0.1298650758591156,  0.1298309237069154,
-                            0.1453558637770907,  0.3190762719566893,
-                            0.1416214006119258,  0.1415959491973159,
-                            0.1434756453687651,  0.1434781986519148,
-                            0.1416048272463015,  0.2351645059348485,
-                            0.2196565216015469,  0.2196345111717833}};
-  gains["A0"]["0+7+0"] = {{0.3386498676460261, 0.3386538634292717,
-                           0.2637566389608358, 0, 0.3754678844087531,
-                           0.3754587695554182, 0.4577852745549881,
-                           0.4577657543701992}};
-  gains["A0"]["4+7+0"] = {
-      {0.2507372882764423, 0.250752746687216, 0.2297672082690357, 0,
-       0.3188473884483216, 0.3188501095310373, 0.3739736354306449,
-       0.3739472908142024, 0.2906380377661857, 0.2906211331547076,
-       0.2911221418496587, 0.2911284648059639}};
-  gains["A0"]["3.1.2"] = {{0.671766543304041, 0.6717716608635106,
-                           0.1449662018040889, 0, 0.1631927661554572,
-                           0.1631747758277981}};
-  gains["A0"]["7.1.2"] = {
-      {0.2507372882764423, 0.250752746687216, 0.2297672082690357, 0,
-       0.3188473884483216, 0.3188501095310373, 0.3739736354306449,
-       0.3739472908142024, 0.4964924784216314, 0.4964800448154338}};
-  gains["A0"]["9.1.6"] = {
-      {0.09620442018565725, 0.09621115229239315, 0.2928509764961265, 0,
-       0.5855762595845468, 0.5855722589330478, 0.420065344246053,
-       0.4200474107850664, 0.3133067479574846, 0.3133147585847036,
-       0.2894032118374602, 0.28936905968526, 0.4012892701848798,
-       0.4012638187702699, 0.1434756453687651, 0.1434781986519148}};
-  gains["A0"]["0+1+0"] = {{1}};
-
-  // -------------------------------------------------------
-  // Input layout: A1
-  gains["A1"]["0+2+0"] = {{0.6237526753261383, 0.6237631898637224},
-                          {0.5721035925321385, -0.5720956954375841},
-                          {-8.583228130601764e-07, 4.668628571934903e-07},
-                          {0.07401412616937707, 0.07404156119079325}};
-  gains["A1"]["0+5+0"] = {
-      {0.2506215452023863, 0.2506237042627795, 0.165218271233421, 0,
-       0.4673800427609406, 0.4673754807195712},
-      {0.3106827387441656, -0.3106855590761276, 9.155565816140743e-06, 0,
-       0.4511283309408949, -0.4511052147568972},
-      {1.709057789660855e-05, 9.909121998546576e-06, -4.072812615293027e-05, 0,
-       -4.401372500512637e-06, 1.073760389450532e-05},
-      {0.3075523452703663, 0.3075642303486892, 0.265463909623805, 0,
-       -0.4306128761845321, -0.4306298052991511}};
-  gains["A1"]["2+5+0"] = {
-      {0.1608412473078967, 0.1608493394511706, 0.1082218361088837, 0,
-       0.4817569949861433, 0.4817509538562328, 0.1218285405373234,
-       0.1218151101910272},
-      {0.2283931298562139, -0.2283992405530291, 1.237934076772879e-05, 0,
-       0.4668645722709004, -0.4668415559666158, 0.1043372896418495,
-       -0.1043276013308286},
-      {-0.1952271907091981, -0.1952375336695809, -0.140756774646952, 0,
-       0.00906085188854453, 0.009074527588063772, 0.2373605493064364,
-       0.2373619861653989},
-      {0.2127723002580597, 0.2127980947140542, 0.2031918204312814, 0,
-       -0.4347082494911021, -0.4347268372684167, 0.1539296985579603,
-       0.1538973485815448}};
-  gains["A1"]["4+5+0"] = {
-      {0.1716345900998222, 0.1716425508798015, 0.1138818598955406, 0,
-       0.3684609199397454, 0.3684505725435995, 0.1304478182107854,
-       0.1304330978401232, 0.1760703275843818, 0.1760772782262143},
-      {0.2466977620275643, -0.2467024939684432, 1.302678277876558e-05, 0,
-       0.3698730076115667, -0.3698461125657664, 0.1155948248864342,
-       -0.1155833215305355, 0.1599941725721336, -0.1599999889632932},
-      {-0.2035943869469594, -0.2036053810583457, -0.1481183822603481, 0,
-       -0.2918026810568149, -0.2917903701175891, 0.2521760338830817,
-       0.2521765897869218, 0.3482143664665878, 0.3482181669106747},
-      {0.2256954542522409, 0.2257227572897904, 0.2138187934918574, 0,
-       -0.4127937343615455, -0.4128052277441523, 0.1636160772209112,
-       0.1635814271899589, -0.1040812101154298, -0.1040929523099378}};
-  gains["A1"]["4+5+1"] = {
-      {0.0918824459511635, 0.09188951634428853, 0.03818132495267527, 0,
-       0.3901843655475281, 0.3901744794085973, 0.1309235059266395,
-       0.1309087318770459, 0.1767123811894714, 0.1767193571773387,
-       0.1640575505525399},
-      {0.1875590611254976, -0.1875608070622571, 1.848685982904073e-05, 0,
-       0.4020438447556157, -0.4020301528042481, 0.1160163500523511,
-       -0.1160048047486056, 0.1605776032767992, -0.1605834408778638,
-       -7.22175249556197e-06},
-      {-0.02013931000170021, -0.02015357121639456, 0.01070845203405976, 0,
-       -0.3321050778601112, -0.3321013126632121, 0.2530956126326256,
-       0.2530961705636106, 0.3494841561716517, 0.349487970474342,
-       -0.3261638118313036},
-      {0.154186747667681, 0.1542093270856626, 0.1090486115060445, 0,
-       -0.3875809824931892, -0.3875952450639486, 0.1642127154714987,
-       0.1641779390866195, -0.1044607500248144, -0.104472535038112,
-       0.2292000195962985}};
-  gains["A1"]["3+7+0"] = {
-      {0.1382064044023507, 0.1508200379129243, 0.1508293362431208,
-       0.1603172529963421, 0.1603133939834211, 0.2246891774806315,
-       0.2246815991358953, 0.2297132048537519, 0.2297043172556352,
-       0.2551629286702514, 0, 0},
-      {6.02514266255511e-06, 0.1704133759780043, -0.1704236090854955,
-       0.1789659855865252, -0.1789374211373609, 0.4236176391168636,
-       -0.423610307530364, 0.1924197957914894, -0.1924020369511604,
-       -1.10118796971239e-05, 0, 0},
-      {-0.1615538528318267, -0.2183564581792388, -0.2183871414520327,
-       0.3053155649679399, 0.3053279115028223, -0.1599450948785344,
-       -0.1599419399132976, -0.2527215720239799, -0.25270854802152,
-       0.5025142842980169, 0, 0},
-      {0.2422641164522238, 0.2004359311074826, 0.2004364559422345,
-       0.1778269449482694, 0.1778148715227776, 0.001357598050706869,
-       0.001351532853619586, -0.376625410481799, -0.376622034677538,
-       -0.2383294570385009, 0, 0}};
-  gains["A1"]["4+9+0"] = {
-      {0.1339431265090085, 0.1339621592545149, 0.1026433045248743, 0,
-       0.1946412047413922, 0.1946428929648099, 0.2291413466359956,
-       0.2291249765423095, 0.1814770723848118, 0.1814641478675051,
-       0.1817201490961388, 0.1817240959225644, 0.07896732554371746,
-       0.07893492789988488},
-      {0.1642680631908641, -0.1642961998097429, -9.160575231371364e-06, 0,
-       0.3707675422464824, -0.370776128905981, 0.188657815766759,
-       -0.1886319584318828, 0.1774258290652412, -0.1773906217339204,
-       0.1697302497308936, -0.1697483193023093, 0.02675069263478266,
-       -0.02670300993549553},
-      {-0.1979530519341265, -0.1979557356961659, -0.1215473750657985, 0,
-       -0.2102629234318301, -0.2102467219096768, -0.2583530857101292,
-       -0.2583476048231024, 0.349753375846277, 0.3497508710492567,
-       0.3505408634499179, 0.3505390213033154, -0.143793772581072,
-       -0.1438055419267072},
-      {0.1630592898454297, 0.1630889849985164, 0.161757920551538, 0,
-       0.03362762093723288, 0.03360096431906716, -0.3811337676526063,
-       -0.3811179993988287, 0.177863734221904, 0.1778564838576417,
-       -0.1781427965628869, -0.1781403314113034, 0.09360597412461745,
-       0.09352481742042704}};
-  gains["A1"]["9+10+3"] = {{0.05634513174616869, 0.05634907461532406,
-                            0.03378588818969121, 0,
-                            0.2009029617934434,  0.2009006186865949,
-                            0.05717813779251716, 0.0571805255969697,
-                            0.2009005122101561,  0,
-                            0.1834979095197539,  0.1835026011944726,
-                            0.07605954897277119, 0.07603954669521036,
-                            0.08513221407907143, 0.1868770119479014,
-                            0.0829450087652578,  0.08293010234716865,
-                            0.08403100528092868, 0.08403250069117256,
-                            0.08293530205461218, 0.1377314581112891,
-                            0.1286487213857714,  0.1286358302882269},
-                           {0.1424405160728748,     -0.1424447651561473,
-                            1.779302517704502e-05,  0,
-                            0.253871238955742,      -0.253879197022048,
-                            0.07506554729513466,    -0.07506943384845667,
-                            -1.332484359277458e-05, 0,
-                            0.31314519554074,       -0.3131700230050198,
-                            0.1195393960791561,     -0.1195306481083304,
-                            1.651241848450269e-05,  2.140907784524953e-05,
-                            0.13143439689083,       -0.1314227690105947,
-                            0.189380426713195,      -0.1893811497639748,
-                            1.0735314852914e-05,    -7.40789286300353e-06,
-                            0.1136022751577427,     -0.113578476811769},
-                           {0.0004405167723881627,  0.0004244515093607814,
-                            -3.098906731227431e-05, 0,
-                            -0.2571118440100679,    -0.2570923441647796,
-                            3.790856536726996e-06,  2.034760936260344e-05,
-                            -0.2570837372234621,    0,
-                            -0.2623633093875167,    -0.2623500106959707,
-                            0.1295230344759835,     0.1294877136312351,
-                            0.1366306790061282,     0.4736829748884767,
-                            0.135361270245709,      0.1353236815838757,
-                            0.1359871642773514,     0.1359866000616586,
-                            0.1353372596267004,     -0.2710460679763523,
-                            -0.2638954257778223,    -0.2639133764522598},
-                           {0.0746074410814683,     0.07462281003049163,
-                            0.09841829092408336,    0,
-                            -0.2538738427515864,    -0.2538797785697299,
-                            0.1448482997652191,     0.144848405888255,
-                            -0.3590391167846038,    0,
-                            -0.01998587783523549,   -0.01998387583540835,
-                            0.1195528048604623,     0.1195162140893727,
-                            0.1928926002204532,     -8.707342237149854e-06,
-                            -0.1314509271923652,    -0.1314430986909031,
-                            -9.791909432877099e-05, -0.0001040336505291438,
-                            -0.1858785768193519,    0.1845050591527886,
-                            0.1136289894747571,     0.1135806277385521}};
-  gains["A1"]["0+7+0"] = {
-      {0.250471347095322, 0.250474302446284, 0.1950790092583408, 0,
-       0.277702594282985, 0.2776958527785244, 0.3385859713904875,
-       0.3385715339214466},
-      {0.2517067792357455, -0.2517036899132487, 1.30516353425407e-05, 0,
-       0.4400045172454103, -0.4399995899193188, 0.2594909098760387,
-       -0.2594806176298056},
-      {3.453088266586936e-05, -9.180245107821538e-06, -4.301109171843267e-05, 0,
-       -1.834589524484913e-05, -2.991777279726903e-07, -8.06273718908271e-06,
-       -1.697462609528654e-05},
-      {0.3001861641158459, 0.3001958437064288, 0.2702820155944484, 0,
-       0.04981246797758462, 0.04979268604582358, -0.4754356881629053,
-       -0.4754328730675854}};
-  gains["A1"]["4+7+0"] = {
-      {0.1532499448838317, 0.1532593930222213, 0.140433089331811, 0,
-       0.1948786518429054, 0.1948803149612197, 0.2285716632404736,
-       0.2285555614829507, 0.1776371738522855, 0.1776268417999804,
-       0.1779330569441871, 0.177936921517789},
-      {0.1731589571087019, -0.1731693550848642, 6.122215547293489e-06, 0,
-       0.3622551478103167, -0.3622663261211103, 0.1842739797397464,
-       -0.1842512746663285, 0.1736648215135071, -0.173630948388865,
-       0.1661930300009858, -0.1662107229981336},
-      {-0.2218744647201119, -0.2219056423403379, -0.1641566955217328, 0,
-       -0.2170272771392923, -0.2170114484223909, -0.2638770853647306,
-       -0.2638715434701018, 0.3424311068499599, 0.3424312920356551,
-       0.3432355065067689, 0.3432337027509501},
-      {0.2036652146493657, 0.2036657479398881, 0.2461673064627439, 0,
-       0.03299361214873855, 0.03296760868266777, -0.3723435892970235,
-       -0.3723280143207133, 0.1740053652023914, 0.1740048192374424,
-       -0.1744302573087335, -0.1744278435315092}};
-  gains["A1"]["3.1.2"] = {
-      {0.5014948853466521, 0.5014987057660003, 0.1082218361088837, 0,
-       0.1218285405373234, 0.1218151101910272},
-      {0.5585162348047247, -0.5585060705167022, 1.237934076772879e-05, 0,
-       0.1043372896418495, -0.1043276013308286},
-      {-0.1888202008954813, -0.1888208736759966, -0.140756774646952, 0,
-       0.2373605493064364, 0.2373619861653989},
-      {-0.09461285079483217, -0.09460019988222401, 0.2031918204312814, 0,
-       0.1539296985579603, 0.1538973485815448}};
-  gains["A1"]["7.1.2"] = {
-      {0.1532499448838317, 0.1532593930222213, 0.140433089331811, 0,
-       0.1948786518429054, 0.1948803149612197, 0.2285716632404736,
-       0.2285555614829507, 0.3034548450147723, 0.3034472456286675},
-      {0.1731589571087019, -0.1731693550848642, 6.122215547293489e-06, 0,
-       0.3622551478103167, -0.3622663261211103, 0.1842739797397464,
-       -0.1842512746663285, 0.2911810400131434, -0.2911596777267641},
-      {-0.2218744647201119, -0.2219056423403379, -0.1641566955217328, 0,
-       -0.2170272771392923, -0.2170114484223909, -0.2638770853647306,
-       -0.2638715434701018, 0.5851352610448957, 0.5851341707826196},
-      {0.2036652146493657, 0.2036657479398881, 0.2461673064627439, 0,
-       0.03299361214873855, 0.03296760868266777, -0.3723435892970235,
-       -0.3723280143207133, 0.05066454741527163, 0.05066570824856623}};
-  gains["A1"]["9.1.6"] = {
-      {0.05634513174616869, 0.05634907461532406, 0.1715173463009803, 0,
-       0.3429610763210956, 0.3429587332142471, 0.2460244250510248,
-       0.2460139217579329, 0.1834979095197539, 0.1835026011944726,
-       0.1694980549467219, 0.1694780526691611, 0.2350276292217794,
-       0.2350127228036902, 0.08403100528092868, 0.08403250069117256},
-      {0.1424405160728748, -0.1424447651561473, 1.038513231404149e-05, 0,
-       0.2538618168684794, -0.2538886191093107, 0.1886794984959615,
-       -0.1886362346171415, 0.31314519554074, -0.3131700230050198,
-       0.1195501006180788, -0.1195199435694078, 0.1314526924436833,
-       -0.1314044734577414, 0.189380426713195, -0.1893811497639748},
-      {0.0004405167723881627, 0.0004244515093607814, -0.2710770570436645, 0,
-       -0.4388974979335584, -0.4388779980882701, -0.1672791552779299,
-       -0.1672805491995415, -0.2623633093875167, -0.2623500106959707,
-       0.3663645219202218, 0.3663292010754735, 0.4679006517191915,
-       0.4678630630573583, 0.1359871642773514, 0.1359866000616586},
-      {0.0746074410814683, 0.07462281003049163, 0.282923350076872, 0,
-       -0.5077528369412085, -0.507758772759352, 0.3948729548965643,
-       0.3948246992833954, -0.01998587783523549, -0.01998387583540835,
-       0.1195484511893437, 0.1195118604182541, -0.2628912830097522,
-       -0.26288345450829, -9.791909432877099e-05, -0.0001040336505291438}};
-  gains["A1"]["0+1+0"] = {{0.6237579325949303},
-                          {3.948547277199399e-06},
-                          {-1.957299779333431e-07},
-                          {0.07402784368008516}};
-
-  // -------------------------------------------------------
-  // Input layout: A2
-  gains["A2"]["0+2+0"] = {{0.6118586513784945, 0.6118689654196851},
-                          {0.5611944387933552, -0.5611866922844984},
-                          {-8.419558899235199e-07, 4.579604857514417e-07},
-                          {0.07260278827224946, 0.07262970014913316},
-                          {0.2465018078653151, -0.2464936165381823},
-                          {2.350643989934632e-06, 1.408721032430941e-05},
-                          {0.09240399656598815, 0.09239746853504276},
-                          {-1.441476147919184e-07, 1.732482430331373e-06},
-                          {0.1585288898568444, 0.1585479592316228}};
-  gains["A2"]["0+5+0"] = {
-      {0.2387812870896569, 0.2387833441483155, 0.1574127692173717, 0,
-       0.4452993380132335, 0.4452949914990141},
-      {0.2960049750469942, -0.2960076621363878, 8.723024143222528e-06, 0,
-       0.4298154151818306, -0.4297933910890372},
-      {1.628315787440678e-05, 9.440979636569794e-06, -3.880398381429344e-05, 0,
-       -4.193435922616849e-06, 1.023032108479906e-05},
-      {0.2930224725563674, 0.2930337961410848, 0.2529224451339029, 0,
-       -0.4102691838791785, -0.4102853132018779},
-      {0.3780367396402476, -0.378036479199733, 3.620842392213302e-05, 0,
-       -0.1010753172493527, 0.1010849416062643},
-      {4.667589812392902e-06, 1.39362682666644e-05, -1.347674773059164e-05, 0,
-       2.547691153210508e-06, 1.614233603634477e-06},
-      {0.1243839306872457, 0.1244052690379288, 0.1628615202790054, 0,
-       0.08738859387765373, 0.08737278193171516},
-      {2.623648217638676e-05, 2.066279813515429e-05, -4.441264855642892e-06, 0,
-       -1.579863428514747e-06, 9.751222302484946e-06},
-      {-0.03831091833552695, -0.0382963163067612, 0.2595513522774605, 0,
-       -0.07736700233898075, -0.07738651581810004}};
-  gains["A2"]["2+5+0"] = {
-      {0.1515980545815242, 0.1516056816871222, 0.1020025652122746, 0,
-       0.4540714800671332, 0.4540657861076717, 0.1148273222639815,
-       0.114814663730148},
-      {0.2152678790143128, -0.2152736385428219, 1.166792728109675e-05, 0,
-       0.4400348921307396, -0.4400131985228399, 0.0983412550869769,
-       -0.09833212354188181},
-      {-0.1840079134444613, -0.1840176620176594, -0.1326677923903435, 0,
-       0.008540144659069935, 0.008553034446216325, 0.2237199605917945,
-       0.2237213148776326},
-      {0.2005447441365009, 0.200569056241842, 0.1915148334139307, 0,
-       -0.4097265224960455, -0.4097440420746801, 0.1450836973368931,
-       0.1450532064424711},
-      {0.2830854141580555, -0.2830949265373006, 3.223244089864202e-05, 0,
-       -0.09365529061379821, 0.09366082486360675, 0.1251282027622235,
-       -0.1251021019900302},
-      {-0.1309265544872823, 0.1309477245110413, -9.390242402424657e-06, 0,
-       0.004924277155594055, -0.004921393833860412, 0.1420999094327114,
-       -0.1421055234355264},
-      {-0.002629455876297716, -0.002630630460167377, 0.03592754340539372, 0,
-       0.09136017957201231, 0.09134483548098761, 0.1275855237890106,
-       0.1276223589331018},
-      {-0.1541428513964222, -0.154153180522775, -0.1191927328514673, 0,
-       0.004004749012971985, 0.004014925426875235, 0.2195165951879353,
-       0.2195204713808656},
-      {-0.03801155637226188, -0.03797900342288847, 0.2133238518656626, 0,
-       -0.08492720071659984, -0.08494516160399154, 0.037350700372262,
-       0.03731617243668121}};
-  gains["A2"]["4+5+0"] = {
-      {0.1558928752131017, 0.1559001058586213, 0.103437020261511, 0,
-       0.334666993288848, 0.3346575949191183, 0.1184836077292347,
-       0.1184702374586769, 0.1599217826131563, 0.1599280957668115},
-      {0.2240715196671441, -0.2240758176112155, 1.18320125388314e-05, 0,
-       0.3359495692957308, -0.3359251409679889, 0.1049928781886018,
-       -0.1049824298796414, 0.1453200754294627, -0.1453253583618874},
-      {-0.1849214330278705, -0.1849314187984161, -0.1345334904173425, 0,
-       -0.2650395757544078, -0.2650283939307942, 0.2290473438891668,
-       0.2290478488074814, 0.3162773817760949, 0.3162808336569509},
-      {0.2049954689520673, 0.2050202678520044, 0.1942080933258023, 0,
-       -0.3749337594604207, -0.3749441987108041, 0.1486097918503616,
-       0.148578319797157, -0.0945352512632599, -0.09454591650540076},
-      {0.2909465854848255, -0.290956455616431, 3.268572349501644e-05, 0,
-       -0.09064046776176282, 0.09063822459318234, 0.1303029030156287,
-       -0.130275316293501, -0.0243103772612718, 0.02432074030065022},
-      {-0.1285298032142125, 0.1285515299229943, -9.522296734585154e-06, 0,
-       -0.1764423555790045, 0.1764427330384935, 0.1494439811285427,
-       -0.1494478764369442, 0.2138068443459315, -0.2138052047460068},
-      {-0.006783505920868712, -0.006783578499435862, 0.03643278997382341, 0,
-       -0.1263591751591275, -0.1263630623841589, 0.126405167459336,
-       0.1264426374051533, 0.1865083681681428, 0.1864934594049029},
-      {-0.1550876056148077, -0.1550978377756178, -0.1208689320442548, 0,
-       0.08750179116250913, 0.08751586886126962, 0.2241273335225272,
-       0.2241300211785316, -0.1528708660982268, -0.1528763171851061},
-      {-0.04490616803505294, -0.04487073031585084, 0.2163238105019424, 0,
-       -0.0163972896882772, -0.01639614089855117, 0.03227183648751117,
-       0.03223776806536828, -0.06803789608785757, -0.06806662188949596}};
-  gains["A2"]["4+5+1"] = {
-      {0.083244646815214, 0.08325105252603771, 0.03459192751912285, 0,
-       0.3535034289366458, 0.3534944721861464, 0.1186154863189586,
-       0.1186021011665747, 0.1600997841068763, 0.1601061042874091,
-       0.1486346245111291},
-      {0.1699267758792992, -0.1699283576818666, 1.674892414171061e-05, 0,
-       0.3642480074888358, -0.3642356027074437, 0.1051097408751111,
-       -0.1050992809366243, 0.1454818244424569, -0.1454871132550678,
-       -6.542841014479262e-06},
-      {-0.01824602872549467, -0.01825894925419956, 0.009701758570802136, 0,
-       -0.300884131085259, -0.300880719851668, 0.2293022858281489,
-       0.2293027913084646, 0.3166294154107011, 0.316632871133685,
-       -0.2955013989748601},
-      {0.1396917683275942, 0.1397122250715969, 0.09879703415095258, 0,
-       -0.3511447879509852, -0.3511577097082726, 0.1487752024936057,
-       0.1487436954103233, -0.09464047405192004, -0.09465115116504555,
-       0.2076530993904434},
-      {0.2297553827410623, -0.229773823703602, 4.309716917080635e-05, 0,
-       -0.05103331514275522, 0.05102470762841811, 0.1304479371128845,
-       -0.1304203196852602, -0.02433743601083483, 0.0243478105848301,
-       5.149588608414882e-06},
-      {-0.02937047178734399, 0.02939294863232859, -2.545314017111238e-06, 0,
-       -0.2220553059959653, 0.222088142853139, 0.1496103202690505,
-       -0.1496142199131385, 0.2140448227941407, -0.2140431813692537,
-       7.390566714704431e-06},
-      {-0.1595217249841816, -0.1595171944582119, -0.07346292555006274, 0,
-       -0.1077052184243569, -0.1076919703380743, 0.1265458631685386,
-       0.1265833748204087, 0.1867159619529464, 0.186701036595456,
-       0.1777250701266898},
-      {-0.03018606965678206, -0.03020009908334846, 0.0252814625429958, 0,
-       0.05083469174008814, 0.05083804790949863, 0.2243767992269397,
-       0.2243794898744489, -0.1530410195449126, -0.1530464766991431,
-       -0.3187282322431845},
-      {-0.04073349420481552, -0.04070969719131522, 0.1297185101892533, 0,
-       -0.01371896136608847, -0.01372481913575916, 0.03230775676682522,
-       0.03227365042470713, -0.06811362590361696, -0.0681423836786083,
-       0.1080340194273678}};
-  gains["A2"]["3+7+0"] = {
-      {0.1195978337007338, 0.1305131255751089, 0.1305211719471518,
-       0.1387316039812181, 0.1387282645586524, 0.1944362781080075,
-       0.1944297201368527, 0.1987838536988546, 0.1987761627565559,
-       0.2208069419189511, 0, 0},
-      {5.213897382654187e-06, 0.1474683513309846, -0.1474772066187932,
-       0.1548694090901413, -0.1548446906535705, 0.3665803489706761,
-       -0.3665740045334068, 0.1665117534698578, -0.1664963857389515,
-       -9.529203530359053e-06, 0, 0},
-      {-0.1398017038953153, -0.1889562172298121, -0.1889827692045405,
-       0.2642068601899044, 0.2642175443461997, -0.1384095544721782,
-       -0.1384068243019711, -0.2186942976645291, -0.2186830272571477,
-       0.4348540870128828, 0, 0},
-      {0.2096448687483216, 0.1734485696224125, 0.1734490237916651,
-       0.1538837326779549, 0.1538732848586921, 0.001174806526535458,
-       0.001169557967789256, -0.3259153105462503, -0.3259123892715211,
-       -0.2062399849857609, 0, 0},
-      {7.812211543663557e-06, 0.2475549305072735, -0.2475603904374238,
-       0.1328280687082889, -0.1327817271721859, 0.00180759756506494,
-       -0.001808851149808357, -0.2676487079506361, 0.2676332603094326,
-       -9.610993344569682e-06, 0, 0},
-      {-2.19967133625454e-05, -0.1121153073621469, 0.1121201613121146,
-       0.2367683745602023, -0.2367518488561447, -0.06288225246618108,
-       0.06288877579114273, -0.1009530806669904, 0.1009546778057713,
-       -3.579557657722015e-07, 0, 0},
-      {0.03265076703721635, 0.03875936819806534, 0.03879936287727344,
-       0.1348091700966869, 0.1348354711115782, -0.01015954852589944,
-       -0.01018055501295009, -0.02640818291106803, -0.0264183768364211,
-       0.2544411455113469, 0, 0},
-      {-0.07648159833353092, -0.1380386688018389, -0.1380635949760815,
-       0.2228649642786304, 0.2228806150240878, -0.06613026101324811,
-       -0.06611217463640691, 0.1647605367426007, 0.1647516304124837,
-       -0.3007951338347954, 0, 0},
-      {0.244533793642146, 0.03495045731528188, 0.0349347937350936,
-       0.0109857379362218, 0.01096904079487997, -0.3562471924513201,
-       -0.356257224398994, 0.1860289753637932, 0.1860473274046621,
-       -0.00291279467641446, 0, 0}};
-  gains["A2"]["4+9+0"] = {
-      {0.1145965046718976, 0.1146127883451714, 0.08781760014936386, 0,
-       0.1665274083847115, 0.1665288527626934, 0.1960443815572031,
-       0.1960303759447728, 0.1552646911821167, 0.1552536334701868,
-       0.1554726581171227, 0.1554760348675742, 0.06756135776768844,
-       0.06753363960969419},
-      {0.1405413354273865, -0.140565408018947, -7.837430181447304e-06, 0,
-       0.3172142199053371, -0.3172215663156457, 0.1614082546031307,
-       -0.1613861320778906, 0.1517986057166042, -0.1517684836997949,
-       0.1452145687740127, -0.1452300283931744, 0.02288684722685036,
-       -0.02284605177273455},
-      {-0.1693608954189958, -0.1693631915409179, -0.1039911841511917, 0,
-       -0.1798927404144326, -0.1798788790252182, -0.2210368039422222,
-       -0.2210321147094699, 0.2992353203468352, 0.2992331773403897,
-       0.2999090639662484, 0.2999074878976046, -0.123024332497333,
-       -0.1230344018895237},
-      {0.1395071561907384, 0.1395325622032613, 0.1383937554791514, 0,
-       0.02877047833864942, 0.02874767197786197, -0.3260831572606476,
-       -0.3260696665589237, 0.1521732602557304, 0.1521670571274049,
-       -0.1524120150891861, -0.1524099060018271, 0.08008561342912805,
-       0.08001617892454908},
-      {0.226914718943141, -0.2269526228152504, -1.362609088953571e-05, 0,
-       0.04956764708588871, -0.04952811119314442, -0.2545813732319601,
-       0.2545662629845039, 0.1402114490411463, -0.1401737975289991,
-       -0.1237518865568691, 0.1237452518154433, 0.05623661386119647,
-       -0.05615688249030328},
-      {-0.1089348085389566, 0.1089195759627088, -2.074588436807087e-05, 0,
-       -0.1554963644374321, 0.1554726791847282, -0.1149459838033587,
-       0.1149508587963826, 0.216324251070076, -0.2163004713477907,
-       0.2109474886676003, -0.2109500765113263, -0.01436077296393577,
-       0.01434791874315977},
-      {0.04196999408049309, 0.04197917624535849, 0.04969078526811607, 0,
-       -0.02010332159988387, -0.02013057833315375, -0.03593226121131708,
-       -0.03592919258809248, 0.1611982886564856, 0.1612239182471279,
-       0.1615524983689338, 0.1615386613282233, 0.08271903154756788,
-       0.08275428068319191},
-      {-0.1123634574487665, -0.1123480246165369, -0.01941123845851941, 0,
-       -0.02676869825387498, -0.0267636380337624, 0.18375766344231,
-       0.1837593821423789, 0.2164930971734338, 0.2165204101121711,
-       -0.2179487342613077, -0.2179523748938952, -0.0663142219623301,
-       -0.06632807756003641},
-      {-0.007250550215986229, -0.007248816657661543, 0.1669762796453822, 0,
-       -0.3273690859600049, -0.3273747991566756, 0.1859897708984876,
-       0.1860164367837793, 0.000672163691259792, 0.0006536656670694502,
-       0.0003200986579426941, 0.0002912597365104517, 0.08334965142626859,
-       0.08329357063312666}};
-  gains["A2"]["9+10+3"] = {{0.04527216274130702, 0.04527533075615654,
-                            0.02714627122310898, 0,
-                            0.1614214271873064,  0.1614195445488019,
-                            0.04594146608883792, 0.04594338464095449,
-                            0.1614194589971577,  0,
-                            0.1474368231117466,  0.147440592776575,
-                            0.06111229439728568, 0.06109622297572951,
-                            0.06840199553846246, 0.1501518629085439,
-                            0.06664462073345361, 0.06663264373092102,
-                            0.06751719675679899, 0.06751839828839237,
-                            0.06663682158966934, 0.1106644139959045,
-                            0.1033666205143577,  0.1033562627807282},
-                           {0.1144480459049673,     -0.1144514599566068,
-                            1.429633238066089e-05,  0,
-                            0.20398035622879,       -0.2039867503725562,
-                            0.06031363434768604,    -0.06031675711391347,
-                            -1.070623972186509e-05, 0,
-                            0.2516057699189384,     -0.2516257182794888,
-                            0.09604746365086107,    -0.0960404348349438,
-                            1.326739105430885e-05,  1.720175685661348e-05,
-                            0.1056048538967485,     -0.105595511132431,
-                            0.1521633055505442,     -0.1521638865070804,
-                            8.6256062598228e-06,    -5.952090639789246e-06,
-                            0.09127710823169345,    -0.09125798674668657},
-                           {0.0003539462308771384,  0.0003410381201013221,
-                            -2.489908276162645e-05, 0,
-                            -0.2065841162139589,    -0.2065684484864736,
-                            3.045875814662937e-06,  1.634888860691968e-05,
-                            -0.2065615329848863,    0,
-                            -0.2108035614052352,    -0.210792876178149,
-                            0.1040691132281072,     0.1040407336506343,
-                            0.1097799604637772,     0.380594597303355,
-                            0.1087600164472145,     0.1087298147250248,
-                            0.1092629095203371,     0.1092624561845498,
-                            0.1087407244051589,     -0.2177799806218603,
-                            -0.2120345856376926,    -0.2120490086380347},
-                           {0.05994555535993361,   0.05995790399662652,
-                            0.07907708697015106,   0,
-                            -0.2039824483255792,   -0.2039872176342429,
-                            0.1163826509327227,    0.116382736200415,
-                            -0.2884805984444784,   0,
-                            -0.01605824471155285,  -0.01605663614557433,
-                            0.09605823733282152,   0.09602883739546653,
-                            0.1549852652419794,    -6.996171676026102e-06,
-                            -0.105618135656469,    -0.105611845615409,
-                            -7.86759926998475e-05, -8.358891374227579e-05,
-                            -0.1493496406716707,   0.1482460472750159,
-                            0.09129857263988485,   0.09125971497243304},
-                           {0.1396966859531281,     -0.1397156754568523,
-                            3.706028706589886e-05,  0,
-                            -0.3189740904532463,    0.3189781106668962,
-                            0.1407241425077667,     -0.1407246310450676,
-                            9.669611041511263e-06,  0,
-                            -0.03981754688458117,   0.03980134811870476,
-                            0.1405859222442805,     -0.1405686537365468,
-                            2.255377890019452e-05,  6.371856305476759e-06,
-                            -0.1506847566268255,    0.1506844120223284,
-                            0.0003364439919131474,  -0.0003232377391860551,
-                            -1.554793556383444e-05, -7.559212917254758e-06,
-                            0.135304269889077,      -0.1352510736511721},
-                           {0.0009730688878223274,  -0.0009482936285087621,
-                            -8.160748919071729e-07, 0,
-                            -0.1227573957779788,    0.1227579445056068,
-                            -3.084588987159803e-06, -1.403743555847376e-05,
-                            3.904867928715526e-06,  0,
-                            -0.1845581744187248,    0.1845505638107848,
-                            0.1438345999947781,     -0.1438115613913774,
-                            2.180059659996941e-05,  3.073625642294028e-05,
-                            0.151541506850711,      -0.151507684009504,
-                            0.2159655677028884,     -0.2159523017929593,
-                            1.48152922413142e-05,   8.287980605542593e-06,
-                            -0.1335550544652599,    0.1335624098612611},
-                           {-0.09504508257274258, -0.09506038753696319,
-                            -0.0620921099266234,  0,
-                            0.01960565070425638,  0.01958813529648235,
-                            -0.09655183605235909, -0.09654275569990954,
-                            0.01959334527450319,  0,
-                            0.04875062235541777,  0.04872687052721388,
-                            0.01648513557382058,  0.0164697833227648,
-                            0.002653922577743261, 0.4421309926024963,
-                            0.00644221301634432,  0.00640693398885952,
-                            0.004546269451529577, 0.004546580400237256,
-                            0.006424773140092841, 0.1308612358296462,
-                            0.1446135790073433,   0.1446895365207888},
-                           {0.0001741199594406345,  0.0001555509276145377,
-                            -6.440912552443683e-05, 0,
-                            0.1227468960475624,     0.1227317324745144,
-                            7.840370024516181e-06,  3.562788467157961e-05,
-                            0.1735703491164713,     0,
-                            -0.003192082873676838,  -0.003181476347463243,
-                            0.1438437910052357,     0.1438269476499867,
-                            0.2176063885521262,     -8.348509113818605e-06,
-                            -0.151546647611139,     -0.1515473702437191,
-                            -0.0001944111210222419, -0.0001922690965412609,
-                            -0.2142967754972712,    -0.2030897109023111,
-                            -0.1335795555466304,    -0.1335698709855857},
-                           {-0.09641952342842375,   -0.09640185815983239,
-                            0.1075549205128884,     0,
-                            -1.304686168883046e-06, 8.845522008178281e-06,
-                            0.09899267496157001,    0.0989823548580024,
-                            0.3189855529990175,     0,
-                            -0.2821211420146936,    -0.2821343070980657,
-                            1.886062700767292e-05,  -3.240163414925708e-05,
-                            0.1601259420079839,     2.114316238198158e-06,
-                            2.235701100231544e-05,  1.340600996130431e-05,
-                            -0.1554010663388199,    -0.1554081212648376,
-                            0.150688973741573,      0.1548570822092545,
-                            2.375994218991002e-05,  5.608489817326257e-07}};
-  gains["A2"]["0+7+0"] = {
-      {0.2209366288465176, 0.2209392357126768, 0.1720759646326084, 0,
-       0.244956861191253, 0.2449509146217704, 0.2986610802443155,
-       0.2986483451918795},
-      {0.222026383085632, -0.2220236580453997, 1.151263147244382e-05, 0,
-       0.3881207006102935, -0.3881163542975176, 0.2288926358610951,
-       -0.2288835572410758},
-      {3.045911995829368e-05, -8.097742235302201e-06, -3.793937197799487e-05, 0,
-       -1.618261048847941e-05, -2.638997211089827e-07, -7.11200699996016e-06,
-       -1.497303667231635e-05},
-      {0.2647892459367107, 0.2647977841433232, 0.2384112915740158, 0,
-       0.04393875338285431, 0.04392130406832775, -0.4193739499315302,
-       -0.4193714667825509},
-      {0.357259727950629, -0.357256272507393, 3.42696678937221e-05, 0,
-       0.07058286304617674, -0.07055004425798965, -0.3380292569111507,
-       0.3380346411492054},
-      {1.980020964243926e-06, 2.286192212306864e-05, -2.284620248290742e-05, 0,
-       -7.904137114150914e-06, -9.68145752651212e-06, -1.229667861444472e-06,
-       2.562079482013371e-05},
-      {0.1583973452823449, 0.1584184983755961, 0.1833814259270353, 0,
-       0.1454069359813672, 0.1454158954434713, 0.1271298319056872,
-       0.127095276058015},
-      {1.920291628109819e-05, 8.662380431620887e-06, -1.935899982813849e-05, 0,
-       -1.282912320534406e-05, 1.394413454140164e-05, 7.003463110551722e-06,
-       -5.248448141598118e-06},
-      {0.05317686895192222, 0.05319635205024393, 0.2693360299667868, 0,
-       -0.3866137435522458, -0.386622604045768, 0.2003952893950891,
-       0.2004068177784596}};
-  gains["A2"]["4+7+0"] = {
-      {0.1313810026949889, 0.1313891025732379, 0.1203931270706435, 0,
-       0.1670692456194794, 0.1670706714089105, 0.1959542258038554,
-       0.1959404217855237, 0.1522881462326683, 0.1522792885760293,
-       0.1525418064693751, 0.1525451195639096},
-      {0.1484489761337592, -0.1484578903068457, 5.248568395427391e-06, 0,
-       0.3105609244219836, -0.3105705075750582, 0.1579778723389165,
-       -0.1579584073054107, 0.1488826531101612, -0.148853613719098,
-       0.1424770947813338, -0.1424922629675783},
-      {-0.1902127251624066, -0.1902394537006128, -0.1407313475583288, 0,
-       -0.1860572367862018, -0.1860436668452831, -0.2262215238624017,
-       -0.2262167728024668, 0.29356579675122, 0.293565955510705,
-       0.294255407658155, 0.2942538613003519},
-      {0.1746019558767673, 0.174602413066123, 0.2110389506392054, 0,
-       0.0282853860072622, 0.02826309326550289, -0.3192097337847405,
-       -0.3191963813753407, 0.1491746008256464, 0.1491741327705193,
-       -0.1495388603430689, -0.1495367910146117},
-      {0.2492011040944435, -0.2492066003316582, 7.864160645524177e-06, 0,
-       0.04855799317161622, -0.04852196947308759, -0.2493825365597554,
-       0.2493646604615868, 0.1374404961839927, -0.1374047142217153,
-       -0.1214190106350215, 0.1214125009666669},
-      {-0.1128608439479819, 0.112865730175409, -2.214298557965578e-05, 0,
-       -0.1511144650604089, 0.1510970345646112, -0.1119422346969399,
-       0.1119524821970697, 0.2122138553333601, -0.2121923833756087,
-       0.2069708679406046, -0.2069734070002798},
-      {0.03901710755333613, 0.03905736818638488, 0.03286788584065672, 0,
-       -0.007961562180954904, -0.007988256436743361, -0.02375758851419715,
-       -0.02375472948685919, 0.1582664991770458, 0.1582886609908332,
-       0.1585070342225265, 0.1584934580271252},
-      {-0.1389565887565093, -0.1389816806830947, -0.07699018035540062, 0,
-       -0.02640008411152328, -0.02639537058173121, 0.1786613963785415,
-       0.1786628815574012, 0.2123414305907085, 0.2123737410826162,
-       -0.2138401314068235, -0.2138437034089897},
-      {0.03518286843944747, 0.03516710070067131, 0.2461598774831719, 0,
-       -0.3211431738841052, -0.3211486896047186, 0.1819211163056446,
-       0.1819470766749066, 0.0005325513355549107, 0.0005226083211512367,
-       0.0003140644028496443, 0.000285769130708684}};
-  gains["A2"]["3.1.2"] = {
-      {0.4726750772804064, 0.4726786781486573, 0.1020025652122746, 0,
-       0.1148273222639815, 0.114814663730148},
-      {0.5264195351986497, -0.5264099550299046, 1.166792728109675e-05, 0,
-       0.0983412550869769, -0.09833212354188181},
-      {-0.1779691192437189, -0.1779697533610177, -0.1326677923903435, 0,
-       0.2237199605917945, 0.2237213148776326},
-      {-0.08917565835243543, -0.08916373445995035, 0.1915148334139307, 0,
-       0.1450836973368931, 0.1450532064424711},
-      {0.216861123071042, -0.2168667221447187, 3.223244089864202e-05, 0,
-       0.1251282027622235, -0.1251021019900302},
-      {-0.1274445647181197, 0.127467773558229, -9.390242402424657e-06, 0,
-       0.1420999094327114, -0.1421055234355264},
-      {0.06197194662949289, 0.06195992213480852, 0.03592754340539372, 0,
-       0.1275855237890106, 0.1276223589331018},
-      {-0.1513110662123996, -0.1513141995274732, -0.1191927328514673, 0,
-       0.2195165951879353, 0.2195204713808656},
-      {-0.09806415590616065, -0.09804430322205804, 0.2133238518656626, 0,
-       0.037350700372262, 0.03731617243668121}};
-  gains["A2"]["7.1.2"] = {
-      {0.1313810026949889, 0.1313891025732379, 0.1203931270706435, 0,
-       0.1670692456194794, 0.1670706714089105, 0.1959542258038554,
-       0.1959404217855237, 0.2601514920016094, 0.2601449770565825},
-      {0.1484489761337592, -0.1484578903068457, 5.248568395427391e-06, 0,
-       0.3105609244219836, -0.3105705075750582, 0.1579778723389165,
-       -0.1579584073054107, 0.2496291729938008, -0.2496108591300894},
-      {-0.1902127251624066, -0.1902394537006128, -0.1407313475583288, 0,
-       -0.1860572367862018, -0.1860436668452831, -0.2262215238624017,
-       -0.2262167728024668, 0.5016357909071134, 0.5016348562265096},
-      {0.1746019558767673, 0.174602413066123, 0.2110389506392054, 0,
-       0.0282853860072622, 0.02826309326550289, -0.3192097337847405,
-       -0.3191963813753407, 0.04343465862615428, 0.04343565380721175},
-      {0.2492011040944435, -0.2492066003316582, 7.864160645524177e-06, 0,
-       0.04855799317161622, -0.04852196947308759, -0.2493825365597554,
-       0.2493646604615868, 0.05158429039900753, -0.05155311146736688},
-      {-0.1128608439479819, 0.112865730175409, -2.214298557965578e-05, 0,
-       -0.1511144650604089, 0.1510970345646112, -0.1119422346969399,
-       0.1119524821970697, 0.358564359562227, -0.3585446829907898},
-      {0.03901710755333613, 0.03905736818638488, 0.03286788584065672, 0,
-       -0.007961562180954904, -0.007988256436743361, -0.02375758851419715,
-       -0.02375472948685919, 0.2703478979415624, 0.2703604599355188},
-      {-0.1389565887565093, -0.1389816806830947, -0.07699018035540062, 0,
-       -0.02640008411152328, -0.02639537058173121, 0.1786613963785415,
-       0.1786628815574012, 0.06113362358312122, 0.06116340828807471},
-      {0.03518286843944747, 0.03516710070067131, 0.2461598774831719, 0,
-       -0.3211431738841052, -0.3211486896047186, 0.1819211163056446,
-       0.1819470766749066, 0.000754628404539198, 0.000724677611329132}};
-  gains["A2"]["9.1.6"] = {
-      {0.04527216274130702, 0.04527533075615654, 0.1378106852190135, 0,
-       0.2755622212596605, 0.275560338621156, 0.1976756014951344,
-       0.1976671623136215, 0.1474368231117466, 0.147440592776575,
-       0.1361882258515577, 0.1361721544300015, 0.1888399006104989,
-       0.1888279236079663, 0.06751719675679899, 0.06751839828839237},
-      {0.1144480459049673, -0.1144514599566068, 8.344241740871648e-06, 0,
-       0.2039727857740817, -0.2039943208272645, 0.1516001240415626,
-       -0.1515653623984169, 0.2516057699189384, -0.2516257182794888,
-       0.09605606452928937, -0.0960318339565155, 0.105619553999855,
-       -0.1055808110293245, 0.1521633055505442, -0.1521638865070804},
-      {0.0003539462308771384, 0.0003410381201013221, -0.217804879704622, 0,
-       -0.3526451769198607, -0.3526295091923755, -0.13440538527955,
-       -0.1344065052670999, -0.2108035614052352, -0.210792876178149,
-       0.2943664118797847, 0.2943380323023118, 0.3759486187169174,
-       0.3759184169947277, 0.1092629095203371, 0.1092624561845498},
-      {0.05994555535993361, 0.05995790399662652, 0.227323134245167, 0,
-       -0.4079690357264233, -0.407973805035087, 0.3172723556092069,
-       0.3172335832094474, -0.01605824471155285, -0.01605663614557433,
-       0.09605473924698352, 0.09602533930962852, -0.2112277774290195,
-       -0.2112214873879595, -7.86759926998475e-05, -8.358891374227579e-05},
-      {0.1396966859531281, -0.1397156754568523, 2.950107414864411e-05, 0,
-       -0.3189672530057074, 0.3189849481144351, 0.2760443603268455,
-       -0.275959756766238, -0.03981754688458117, 0.03980134811870476,
-       0.1405891081724333, -0.1405654678083941, -0.1506925647493434,
-       0.1506766038998105, 0.0003364439919131474, -0.0003232377391860551},
-      {0.0009730688878223274, -0.0009482936285087621, 7.47190571363542e-06, 0,
-       -0.1227546346193868, 0.1227607056641989, -0.1335427237045573,
-       0.1335637877753924, -0.1845581744187248, 0.1845505638107848,
-       0.1438499681229896, -0.1437961932631659, 0.1515673509725316,
-       -0.1514818398876834, 0.2159655677028884, -0.2159523017929593},
-      {-0.09504508257274258, -0.09506038753696319, 0.06876912590302281, 0,
-       0.03346023801398698, 0.03344272260621295, 0.04993834960645051,
-       0.05002338747234555, 0.04875062235541777, 0.04872687052721388,
-       0.2375506318750687, 0.2375352796240129, 0.2320507099725373,
-       0.2320154309450525, 0.004546269451529577, 0.004546580400237256},
-      {0.0001741199594406345, 0.0001555509276145377, -0.2031541200278355, 0,
-       0.2454796669207357, 0.2454645033476877, 0.02029923779811735,
-       0.02033670987380903, -0.003192082873676838, -0.003181476347463243,
-       0.1438396167506788, 0.1438227733954298, -0.3030815250062276,
-       -0.3030822476388076, -0.0001944111210222419, -0.0001922690965412609},
-      {-0.09641952342842375, -0.09640185815983239, 0.2624120027221428, 0,
-       0.2255555429399773, 0.2255656931481543, 0.2122425743414892,
-       0.2122090551447134, -0.2821211420146936, -0.2821343070980657,
-       1.9917785126772e-05, -3.1344476030158e-05, 0.1065766093518293,
-       0.1065676583507883, -0.1554010663388199, -0.1554081212648376}};
-  gains["A2"]["0+1+0"] = {
-      {0.6118638083990897},  {3.873254428410355e-06}, {-1.919977020860391e-07},
-      {0.07261624421069131}, {4.095663566378027e-06}, {8.218927157122021e-06},
-      {0.09240073255051545}, {7.941674077697273e-07}, {0.1585384245442336}};
-
-  // -------------------------------------------------------
-  // Input layout: A3
-  gains["A3"]["0+2+0"] = {{0.610506789945564, 0.6105170811985591},
-                          {0.5599545166046754, -0.5599467872112203},
-                          {-8.400956437812909e-07, 4.569486521897216e-07},
-                          {0.07244237718846835, 0.07246922960533074},
-                          {0.2459571783394434, -0.2459490051105089},
-                          {2.345450396699686e-06, 1.405608555996701e-05},
-                          {0.09219983601530413, 0.0921933224076136},
-                          {-1.438291301212399e-07, 1.72865462439038e-06},
-                          {0.158178630705127, 0.1581976579473764},
-                          {0.1059067344883307, -0.1058960721762669},
-                          {-9.212001616405592e-06, 9.84777928747098e-06},
-                          {0.01444512295991118, -0.01446627885428585},
-                          {6.212977027002501e-06, -2.264795855921056e-05},
-                          {0.03964321344961628, 0.03966473439103411},
-                          {-1.752583633019016e-05, -1.304201672743763e-05},
-                          {0.04951994719344013, 0.04952430162219259}};
-  gains["A3"]["0+5+0"] = {
-      {0.2338078348043953, 0.2338098490176399, 0.1541340998277576, 0,
-       0.4360244277501195, 0.4360201717672032},
-      {0.2898396400764882, -0.2898422711978826, 8.54133677195372e-06, 0,
-       0.4208630115620523, -0.4208414461977295},
-      {1.594400437653935e-05, 9.244338340591785e-06, -3.799575564729311e-05, 0,
-       -4.10609300841015e-06, 1.001723900287256e-05},
-      {0.2869192585921119, 0.286930346323723, 0.2476544539605709, 0,
-       -0.4017238986308827, -0.4017396920042378},
-      {0.3701628073501904, -0.3701625523342571, 3.545425733355256e-05, 0,
-       -0.09897007159260826, 0.09897949548875321},
-      {4.570370991345199e-06, 1.364599692210616e-05, -1.319604750229679e-05, 0,
-       2.494626608067496e-06, 1.580611564391814e-06},
-      {0.1217932019418477, 0.1218140958470289, 0.1594693616635412, 0,
-       0.08556842192354483, 0.08555293931647372},
-      {2.569001601973025e-05, 2.023242336894994e-05, -4.348760040399746e-06, 0,
-       -1.546957267924375e-06, 9.548119122015956e-06},
-      {-0.03751295997510168, -0.03749866208446258, 0.2541452910158742, 0,
-       -0.07575556494672743, -0.07577467198965356},
-      {0.1725367876215208, -0.1725375393094964, 4.075325713248351e-05, 0,
-       -0.16352362504694, 0.1635384365195783},
-      {5.779290610335626e-06, 5.107706027881633e-06, -1.497797264048011e-05, 0,
-       -1.51969313496268e-05, 5.108987621172172e-06},
-      {0.0246229266347055, -0.02464846080830347, -1.85696064526809e-06, 0,
-       0.05184473055133972, -0.05183860672775428},
-      {2.480588184524338e-05, 2.240402345659602e-05, -8.993117625814622e-05, 0,
-       9.609916607392161e-06, 2.649687979172444e-06},
-      {0.0999408784476359, 0.09995799057563934, 0.08954947877654947, 0,
-       -0.0399600041652171, -0.03996507658097821},
-      {-1.017789399656191e-05, 3.967957802330902e-07, -2.564557366364079e-05, 0,
-       7.872901518301092e-06, -4.184708644718627e-06},
-      {-0.1791099593082086, -0.1791243430705, 0.2701004619351547, 0,
-       -0.01785417407007995, -0.0178397549009724}};
-  gains["A3"]["2+5+0"] = {
-      {0.1475432207484164, 0.1475506438497748, 0.09927427523765553, 0,
-       0.4419263083819949, 0.4419207667203945, 0.1117560050721716,
-       0.1117436851195383},
-      {0.2095100513072349, -0.20951565678409, 1.135584210010789e-05, 0,
-       0.4282651608285468, -0.428244047465397, 0.0957108951564507,
-       -0.09570200785524186},
-      {-0.17908620442218, -0.1790956922476756, -0.1291192913582355, 0,
-       0.008311719118921529, 0.008324264139473339, 0.2177360627914349,
-       0.2177373808538265},
-      {0.1951807200675815, 0.1952043818905192, 0.1863923347894433, 0,
-       -0.3987674572868994, -0.3987845082646646, 0.1412031047645282,
-       0.1411734294182388},
-      {0.2755136526459698, -0.2755229105950556, 3.137031115535313e-05, 0,
-       -0.09115026743207814, 0.09115565365582247, 0.1217813651564454,
-       -0.1217559625086076},
-      {-0.1274246268124665, 0.1274452305959211, -9.139079069890202e-06, 0,
-       0.004792566193542327, -0.004789759992788563, 0.1382991250358413,
-       -0.138304588879417},
-      {-0.002559125114604843, -0.002560268281564652, 0.03496657976412021, 0,
-       0.08891654434100614, 0.08890161066250024, 0.1241729595585358,
-       0.1242088094631468},
-      {-0.1500199512002471, -0.1500300040506864, -0.1160046528516226, 0,
-       0.003897632916820687, 0.003907537139451374, 0.2136451259296143,
-       0.2136488984449724},
-      {-0.0369948510771128, -0.03696316883020883, 0.2076180215742282, 0,
-       -0.08265563009673002, -0.08267311057944851, 0.03635167116982406,
-       0.03631806676219861},
-      {0.1261164656878066, -0.1261335520518729, 3.945961167825228e-05, 0,
-       -0.1647413932596963, 0.1647454620999331, 0.06785954761722965,
-       -0.06782207605859106},
-      {-0.1527409386831182, 0.1527428834945877, -2.87941414863721e-05, 0,
-       0.007341305651168748, -0.007358045766753297, 0.1732515053364818,
-       -0.173246377527131},
-      {-0.05389082301656458, 0.05387427827121506, 4.179365068804624e-06, 0,
-       0.0455127066351412, -0.04550564660310515, 0.06485935332604253,
-       -0.06488206577719892},
-      {-0.01868360212403054, -0.0186963735952166, -0.06578851052684974, 0,
-       0.00157174238862177, 0.001566640422048306, -0.01129650672322881,
-       -0.01128750313103734},
-      {-0.005840771200524682, -0.005847013818204486, -0.0179100086476445, 0,
-       -0.0406651498682271, -0.04067038145674867, 0.1236321152318951,
-       0.1236767028264234},
-      {0.01144901756054266, 0.01145625992040252, -0.08364789008525689, 0,
-       -0.007742086530535475, -0.007751790271912551, 0.04362752093129507,
-       0.04363237973449083},
-      {-0.1539606498102968, -0.1539356811716762, 0.2217087116645219, 0,
-       -0.02841495002039861, -0.02839981975016615, -0.005882757815817798,
-       -0.005932942836583561}};
-  gains["A3"]["4+5+0"] = {
-      {0.1507561148791148, 0.1507631072706857, 0.1000287106641749, 0,
-       0.3236395224447132, 0.3236304337566978, 0.1145795043789102,
-       0.1145665746664943, 0.154652267451897, 0.1546583725834907},
-      {0.2166882335956738, -0.216692389920004, 1.144214088756047e-05, 0,
-       0.3248798368309256, -0.3248562134307008, 0.1015333021733856,
-       -0.1015231981422439, 0.1405316949587219, -0.14053680381547},
-      {-0.1788281649373109, -0.1788378216709459, -0.1301005341566799, 0,
-       -0.25630636855805, -0.2562955551819868, 0.2215001015338853,
-       0.2215005898148497, 0.3058558592592779, 0.3058591973986647},
-      {0.1982407497763475, 0.1982647315381996, 0.1878088244113537, 0,
-       -0.3625794753994194, -0.3625895706704695, 0.1437130133223149,
-       0.1436825782914521, -0.0914202600990467, -0.09143057391529524},
-      {0.2813597273453217, -0.2813692722503864, 3.160871001568102e-05, 0,
-       -0.08765381196484982, 0.08765164270997049, 0.1260093470548508,
-       -0.1259826693311604, -0.02350933628073144, 0.02351935785197319},
-      {-0.1242946719166249, 0.1243156827177958, -9.208531553926279e-06, 0,
-       -0.1706284779907279, 0.1706288430127087, 0.1445197155816739,
-       -0.1445234825374124, 0.2067617852585948, -0.2067601996844352},
-      {-0.006559985480360759, -0.006560055667422176, 0.03523230848845605, 0,
-       -0.1221955673104338, -0.1221993264491538, 0.1222400441377699,
-       0.1222762794272173, 0.1803628096475682, 0.1803483921366933},
-      {-0.1499773793794768, -0.1499872743846747, -0.1168862308791915, 0,
-       0.08461855657348789, 0.08463217040393826, 0.2167422083522653,
-       0.216744807448451, -0.1478336827110954, -0.1478389541815116},
-      {-0.04342648384551901, -0.04339221381964527, 0.2091958159251261, 0,
-       -0.01585698951650542, -0.01585587858006479, 0.03120846082427222,
-       0.03117551497632822, -0.06579600809038315, -0.06582378736025596},
-      {0.1220631563080472, -0.122083705726115, 3.975948522450083e-05, 0,
-       -0.1200922260048676, 0.1200900139826767, 0.06411375494502482,
-       -0.06407618260800085, -0.06165667322315706, 0.06167622738227458},
-      {-0.1508835219796226, 0.1508848471230224, -2.901296273046139e-05, 0,
-       0.02490646621100791, -0.02492581127511105, 0.1782052284105085,
-       -0.1781972808062727, -0.03967508591054938, 0.03967887029109728},
-      {-0.05919338526472451, 0.05917492583210083, 4.211126177720041e-06, 0,
-       -0.07697468152488809, 0.07696815618806627, 0.06301383412971305,
-       -0.06303601211389422, 0.1041456456425677, -0.1041355714526192},
-      {-0.02348992753946945, -0.02350255487078797, -0.06628847069156088, 0,
-       -0.05429175430441019, -0.05428033279164917, -0.01676588632200045,
-       -0.0167555249583281, -0.02224317968018651, -0.0222583947986621},
-      {-0.007234635364012371, -0.007241012363824861, -0.01804611586152951, 0,
-       0.05025031053748904, 0.0502315395746267, 0.1239382526619867,
-       0.1239820215983242, -0.1029982700744562, -0.1029844087252075},
-      {0.006721944632193005, 0.006729573376782361, -0.08428357270779774, 0,
-       0.09561729478601388, 0.09562694031156403, 0.03806942457289799,
-       0.03807569365626018, -0.08352791170304322, -0.08354990052435046},
-      {-0.1604583939900686, -0.1604331264147497, 0.2233935882959278, 0,
-       -0.03564232286697064, -0.0356466601158704, -0.01044918023893824,
-       -0.01049835854512928, 0.01509586928720979, 0.0151327089577869}};
-  gains["A3"]["4+5+1"] = {
-      {0.08043156126434028, 0.08043775050703959, 0.03342296284447027, 0,
-       0.3415574909553912, 0.3415488368802754, 0.1146071143282116,
-       0.1145941815001539, 0.154689533639134, 0.1546956402418667,
-       0.1436118160715673},
-      {0.1641844419729074, -0.1641859703216358, 1.618292790894006e-05, 0,
-       0.3519389780676897, -0.351926992480956, 0.1015577684105247,
-       -0.1015476619446388, 0.1405655585453563, -0.1405706686331734,
-       -6.321738850872848e-06},
-      {-0.01762944085189299, -0.01764192475729535, 0.009373907136533081, 0,
-       -0.2907163565312748, -0.2907130605734678, 0.2215534758839208,
-       0.2215539642825451, 0.3059295606146248, 0.3059328995583952,
-       -0.2855155230354209},
-      {0.1349711657412122, 0.1349909311906612, 0.09545838692410857, 0,
-       -0.3392785555019217, -0.3392910405943889, 0.1437476435036313,
-       0.1437172011389119, -0.09144228942060943, -0.09145260572215359,
-       0.2006358801957234},
-      {0.2219912612972048, -0.2220090790844744, 4.164078694664874e-05, 0,
-       -0.04930874681393588, 0.04930043017324814, 0.1260397112260222,
-       -0.1260130270738645, -0.02351500126930283, 0.02352502525541865,
-       4.975568609994656e-06},
-      {-0.02837795571612172, 0.02839967300129948, -2.459300244960025e-06, 0,
-       -0.2145513931716522, 0.2145831203732267, 0.1445545401521056,
-       -0.1445583080155584, 0.2068116081517852, -0.2068100221955535,
-       7.14081736464648e-06},
-      {-0.1541310088628245, -0.1541266314368754, -0.07098039361202076, 0,
-       -0.1040655370118593, -0.1040527366180293, 0.1222695000290268,
-       0.1223057440500053, 0.1804062712427046, 0.1803918502576765,
-       0.1717192085376412},
-      {-0.02916599209458569, -0.02917954742487478, 0.02442712632192292, 0,
-       0.0491168354900088, 0.04912007824441863, 0.2167944362041532,
-       0.216797035926637, -0.1478693058402652, -0.1478745785809351,
-       -0.3079574521500319},
-      {-0.03935698762609792, -0.03933399478484644, 0.1253349338194204, 0,
-       -0.013255356636314, -0.01326101645443043, 0.03121598105248236,
-       0.03118302726565613, -0.06581186279718662, -0.06583964876096368,
-       0.1043832268457312},
-      {0.09300677405909748, -0.09302542033324566, 6.571823350923401e-05, 0,
-       -0.09478879711241248, 0.0947943477360117, 0.06412920428330877,
-       -0.06409162289256858, -0.06167153048433145, 0.06169108935536794,
-       8.046451610041976e-06},
-      {-0.04041556177197449, 0.04044546355864951, -7.347990171017178e-06, 0,
-       -0.03795372862789111, 0.03796672175256945, 0.1782481700984512,
-       -0.1782402205791002, -0.03968464632116959, 0.03968843161363061,
-       -1.208677401120326e-05},
-      {-0.1446452154450777, 0.144620063873226, -2.077483520668678e-05, 0,
-       -0.04694421433825624, 0.04689375275035099, 0.06302901842270718,
-       -0.0630512017510642, 0.1041707413698685, -0.1041606647523665,
-       2.202192712738016e-06},
-      {0.04002106654758147, 0.04002199771659949, -0.0261867128941752, 0,
-       -0.05033293969775961, -0.05033217093959726, -0.01676992635755353,
-       -0.01675956249712814, -0.02224853956602825, -0.02226375835085457,
-       0.01591443072323332},
-      {-0.125601429101627, -0.1256006706545738, -0.1034381617372197, 0,
-       0.06956656323528985, 0.06957522607603951, 0.1239681177664926,
-       0.124011897249726, -0.1030230893214089, -0.103009224632024,
-       0.1857902831686884},
-      {-0.00386631951197669, -0.003851463815217882, 0.03193942289727261, 0,
-       0.09209533965978495, 0.0921012238689695, 0.03807859807114352,
-       0.03808486866515175, -0.0835480392242773, -0.08357003334417826,
-       -0.1193812060093712},
-      {-0.1401255418017442, -0.1401216161287253, 0.1389243822636724, 0,
-       -0.05025388388562307, -0.05026582765653269, -0.01045169815292471,
-       -0.01050088830949466, 0.01509950690274968, 0.01513635545049416,
-       0.05157758309419374}};
-  gains["A3"]["3+7+0"] = {
-      {0.1140296126144269, 0.1244367116854927, 0.1244443834355455,
-       0.1322725551947795, 0.1322693712486349, 0.1853837380225979,
-       0.1853774853766495, 0.1895288997290945, 0.189521566860732,
-       0.2105266397433063, 0, 0},
-      {4.97114939592575e-06, 0.1406025381466185, -0.1406109811510373,
-       0.1476590183779028, -0.1476354507792316, 0.3495131466158917,
-       -0.3495070975621448, 0.1587593199340728, -0.1587446676920733,
-       -9.085544056005796e-06, 0, 0},
-      {-0.1332928335299923, -0.1801588171380963, -0.1801841329092834,
-       0.2519059500100627, 0.2519161367347362, -0.1319654996267801,
-       -0.1319628965674984, -0.2085123557176722, -0.2085016100365178,
-       0.4146082044425446, 0, 0},
-      {0.1998842489889246, 0.1653731726618122, 0.165373605685909,
-       0.146719232965685, 0.1467092715746937, 0.001120110030194608,
-       0.001115105833194594, -0.310741385999465, -0.3107386007330817,
-       -0.1966378893816639, 0, 0},
-      {7.448491568960945e-06, 0.2360292988012755, -0.2360345045286761,
-       0.1266438759838149, -0.1265996920111938, 0.0017234396621506,
-       -0.00172463488265124, -0.2551875526502588, 0.2551728242184158,
-       -9.16352591020544e-06, 0, 0},
-      {-2.097259311400261e-05, -0.1068954568077145, 0.1069000847680825,
-       0.2257449419862004, -0.2257291856838196, -0.05995458836640469,
-       0.05996080797921302, -0.09625291967658167, 0.09625444245597357,
-       -3.412901056907204e-07, 0, 0},
-      {0.03113061668101798, 0.03695481434776363, 0.03699294695966486,
-       0.1285327414998427, 0.1285578179953494, -0.009686541527538358,
-       -0.0097065699971741, -0.02517867401122951, -0.02518839332907217,
-       0.2425949062625194, 0, 0},
-      {-0.07292077757802411, -0.1316118816054131, -0.1316356472699313,
-       0.2124888449535887, 0.212503767033583, -0.06305137653496937,
-       -0.06303413222141467, 0.1570896361376864, 0.1570811444673807,
-       -0.2867907513551891, 0, 0},
-      {0.2331488196510621, 0.03332323826475965, 0.03330830394759222,
-       0.01047426531391512, 0.01045834555600595, -0.3396610799142925,
-       -0.3396706447957926, 0.1773678614352857, 0.1773853590441153,
-       -0.002777181143665378, 0, 0},
-      {4.96897681525018e-06, 0.1828683811238352, -0.1828588442067553,
-       0.03836037917082301, -0.03830839125698456, -0.2341485300270633,
-       0.234170460384486, 0.1720658989519885, -0.1720806133986338,
-       2.829694453070151e-05, 0, 0},
-      {-3.862270088430964e-05, -0.1625136973472048, 0.1625187333031836,
-       0.1593661524474496, -0.1593400674367338, -0.09921155113266332,
-       0.09918637602858167, 0.1202568696962665, -0.1202536721850885,
-       -1.323218259297273e-05, 0, 0},
-      {2.55401441415803e-05, -0.03310097778385124, 0.03308417448802252,
-       0.1401506376624334, -0.1401619048305711, -0.04909855471961775,
-       0.04914958127792424, -0.03912840122011578, 0.03909843661013491,
-       1.777916923277307e-05, 0, 0},
-      {-0.08449325429211982, -0.009987335308020972, -0.01002665362386626,
-       -0.03886843206257708, -0.03887085986333175, -0.1025840286112773,
-       -0.1025843922041468, -0.01756304801758939, -0.01755310614936338,
-       -0.02661208079053282, 0, 0},
-      {-0.06060403233620783, -0.0299676476239327, -0.02994126479009979,
-       0.1027693662752704, 0.1027982627449026, -0.0145209104191835,
-       -0.01457449033851963, 0.08061319068377558, 0.08063061276861111,
-       -0.1394217282839001, 0, 0},
-      {-0.06671559495372667, -0.02299881616823778, -0.02303421539378963,
-       0.01440914779058073, 0.01440525535208471, 0.07365207682995809,
-       0.07366255467165685, -0.0447292129248005, -0.04472760818576265,
-       -0.005675315322753874, 0, 0},
-      {0.2383883012634017, -0.1072541246831498, -0.1072833163011304,
-       -0.03031885760262691, -0.03032870268812937, -0.004630033855107604,
-       -0.004620456470552663, -0.002928615206637011, -0.002936578600987761,
-       0.04025744491976422, 0, 0}};
-  gains["A3"]["4+9+0"] = {
-      {0.108791442084178, 0.1088069008828818, 0.08336906424829107, 0,
-       0.1580917058210795, 0.1580930770318683, 0.1861134512188938,
-       0.1861001550823499, 0.1473995189191779, 0.1473890213526906,
-       0.1475969509685228, 0.1476001566644751, 0.06413893304822904,
-       0.06411261899625385},
-      {0.1334219974453638, -0.1334448506026925, -7.440413074682606e-06, 0,
-       0.3011452446295431, -0.3011522188961134, 0.1532318706651699,
-       -0.1532108687905463, 0.1441090133556816, -0.144080417216065,
-       0.1378585009533108, -0.1378731774416338, 0.02172747870188675,
-       -0.02168874980438289},
-      {-0.1607816582019937, -0.1607838380103205, -0.09872335042190709, 0,
-       -0.170779996354986, -0.1707668371358087, -0.2098398439236958,
-       -0.2098353922312568, 0.2840770939415608, 0.2840750594924102,
-       0.2847167080393977, 0.2847152118089405, -0.1167923453001303,
-       -0.1168019046117382},
-      {0.1324402061520728, 0.1324643251838695, 0.1313832064697709, 0,
-       0.02731306541045697, 0.02729141434102982, -0.3095649122921911,
-       -0.3095521049827581, 0.1444646891916211, 0.1444588002923226,
-       -0.144691349530962, -0.1446893472826741, 0.07602875323375759,
-       0.07596283604103715},
-      {0.2154200040797934, -0.2154559878728346, -1.293584025173325e-05, 0,
-       0.04705672151723003, -0.04701918837607488, -0.2416851613491421,
-       0.2416708165345623, 0.1331088219625185, -0.1330730777457567,
-       -0.1174830439873001, 0.1174767453389283, 0.05338786150072659,
-       -0.05331216904532707},
-      {-0.1034165478960125, 0.1034020869493946, -1.969496961688319e-05, 0,
-       -0.147619456408635, 0.1475969709689162, -0.109123217811534,
-       0.1091278458542718, 0.2053660126814028, -0.2053434375576048,
-       0.2002616184663778, -0.2002640752188908, -0.01363330587318669,
-       0.0136211028027781},
-      {0.03984393933614423, 0.03985265636429462, 0.04717362194502663, 0,
-       -0.01908495685619025, -0.01911083285762175, -0.03411205713225551,
-       -0.03410914395487046, 0.1530325408672019, 0.1530568721514237,
-       0.1533688075406731, 0.1533556714365889, 0.07852877149815347,
-       0.07856223503447807},
-      {-0.1066715133102415, -0.1066568622519173, -0.01842793225315581, 0,
-       -0.02541268858149941, -0.02540788469463666, 0.1744491357493417,
-       0.1744507673860094, 0.2055263056251289, 0.2055522349848533,
-       -0.2069082051725403, -0.2069116613832722, -0.06295497282947536,
-       -0.06296812655052228},
-      {-0.006883262418511848, -0.006881616676256273, 0.158517838816133, 0,
-       -0.3107857002911013, -0.3107911240769881, 0.1765681723616684,
-       0.1765934874454368, 0.0006381142033794465, 0.0006205532251180493,
-       0.0003038835670119314, 0.0002765055255982883, 0.07912744635483628,
-       0.07907420642071608},
-      {0.1452159211646373, -0.1452441414805946, -1.198488288560488e-05, 0,
-       -0.2342246366670442, 0.2342160164853273, 0.1532021254167898,
-       -0.1532243546744921, 0.02989283615559745, -0.0298353285411564,
-       0.006001757582677984, -0.005971418972459758, 0.08454962722491799,
-       -0.08446182480570061},
-      {-0.1518097734655808, 0.1517661238541762, -4.410564785314096e-05, 0,
-       -0.03374078919911043, 0.03375069720166626, 0.1461862275715357,
-       -0.1461978094625525, 0.1742725510129213, -0.1742528458239497,
-       -0.1608582731821399, 0.1608436208510615, -0.03144117382739114,
-       0.03144135735266702},
-      {-0.02955387748472402, 0.02954214039642781, 5.54153756513368e-06, 0,
-       -0.08801857276119124, 0.08806723782685717, -0.03589681795002909,
-       0.03587668170909501, 0.09158917645015055, -0.09160158467755915,
-       0.09629468108121175, -0.09626980433806907, -0.007014680174388161,
-       0.007064269593351149},
-      {-0.01398284163897398, -0.01404661548393737, -0.103597851547062, 0,
-       -0.03542999006260448, -0.03544431177601202, 0.003308764837103203,
-       0.00334631381374284, -0.03278794008155136, -0.03277835475189344,
-       -0.03410840484224886, -0.0341166773576065, -0.05582756859981419,
-       -0.05580514637247903},
-      {-0.02122098003427651, -0.02121396373711551, -0.04431289014508982, 0,
-       0.002881387421167521, 0.002845553780591405, 0.08345118826454861,
-       0.08345572181886241, 0.09114938142262531, 0.09119442740356701,
-       -0.09268242435751674, -0.09270156845863912, -0.009835820641094136,
-       -0.009842078665476399},
-      {0.007430328287224736, 0.007430580336662246, -0.00739563482019904, 0,
-       0.1321058991888779, 0.1321119522140984, -0.05626218877568481,
-       -0.05624861404189565, 0.0003404840118726579, 0.0003452417796921722,
-       0.001360104859834168, 0.001351942093688492, -0.05880089924046625,
-       -0.05882669006582358},
-      {-0.1468070946250355, -0.1468373502664167, 0.1754832589699653, 0,
-       -0.04560422611509887, -0.04557018793988977, -0.002974937169475492,
-       -0.003011286942401645, -0.02857033112318806, -0.0286139713183535,
-       0.02900595539614856, 0.02902057322609947, 0.07259603989215703,
-       0.0725710259944142}};
-  gains["A3"]["9+10+3"] = {{0.04045762873091181, 0.0404604598386132,
-                            0.02425936151645559, 0,
-                            0.1442548306710168,  0.144253148244443,
-                            0.04105575404022148, 0.04105746856112202,
-                            0.1442530717909128,  0,
-                            0.1317574396612083,  0.1317608084355463,
-                            0.05461321854110709, 0.05459885625825763,
-                            0.06112768580908988, 0.1341837446008717,
-                            0.05955720158441564, 0.059546498293642,
-                            0.06033698224110145, 0.0603380559940695,
-                            0.05955023185192362, 0.0988956458906952,
-                            0.09237394687405211, 0.09236469064867427},
-                           {0.1022769019598166,     -0.1022799529391676,
-                            1.277596811478931e-05,  0,
-                            0.1822877684872289,     -0.1822934826364738,
-                            0.05389949315640326,    -0.05390228382751312,
-                            -9.567669082797015e-06, 0,
-                            0.2248483882712282,     -0.2248662151943541,
-                            0.08583315639539291,    -0.08582687506913014,
-                            1.18564510507313e-05,   1.537241099792426e-05,
-                            0.09437415207112522,    -0.09436580287667123,
-                            0.1359812774487848,     -0.135981796622653,
-                            7.708303613260619e-06,  -5.319106901372137e-06,
-                            0.08157011136337186,    -0.0815530233805067},
-                           {0.0003163053040200183, 0.0003047699250638685,
-                            -2.2251153581205e-05,  0,
-                            -0.1846146278287255,   -0.1846006263085136,
-                            2.721957719896176e-06, 1.461024226302944e-05,
-                            -0.1845944462460036,   0,
-                            -0.1883853499825255,   -0.188375801091459,
-                            0.09300173197814468,   0.09297637046812586,
-                            0.09810525085617876,   0.340119711149578,
-                            0.09719377426991095,   0.09716678439380609,
-                            0.0976431864475443,    0.09764278132241076,
-                            0.09717653386813455,   -0.1946198517479976,
-                            -0.1894854591520413,   -0.1894983483174288},
-                           {0.05357055806409872,    0.05358159346705726,
-                            0.07066751911194494,    0,
-                            -0.1822896380969413,    -0.1822939002065366,
-                            0.104005768601358,      0.1040058448011335,
-                            -0.2578017095103111,    0,
-                            -0.01435050731555523,   -0.01434906981486589,
-                            0.08584278433447132,    0.08581651097622647,
-                            0.1385031317313397,     -6.252153620841428e-06,
-                            -0.09438602136278536,   -0.09438040024529287,
-                            -7.030907979534407e-05, -7.469952910201021e-05,
-                            -0.1334668358548823,    0.1324806057035446,
-                            0.08158929310784691,    0.08155456781557188},
-                           {0.1248404386493702,     -0.1248574086866941,
-                            3.311905692115521e-05,  0,
-                            -0.2850523267483101,    0.2850559194264907,
-                            0.1257586288419227,     -0.1257590654250136,
-                            8.641282187582408e-06,  0,
-                            -0.0355830919330529,    0.03556861584850019,
-                            0.1256351078134451,     -0.1256196757502892,
-                            2.015526447095465e-05,  5.694231976650993e-06,
-                            -0.1346599669614084,    0.134659659004378,
-                            0.0003006643661215784,  -0.0002888625515537094,
-                            -1.389446773656817e-05, -6.755317422137727e-06,
-                            0.1209151404619052,     -0.1208676014553122},
-                           {0.0008695864612890908,  -0.0008474459629712199,
-                            -7.292882202703929e-07, 0,
-                            -0.1097025819318232,    0.1097030723042133,
-                            -2.756553883742462e-06, -1.254460405181065e-05,
-                            3.489599067885317e-06,  0,
-                            -0.1649310668578867,    0.1649242656111202,
-                            0.1285383002022655,     -0.1285177116726609,
-                            1.948218043820535e-05,  2.74675645173633e-05,
-                            0.1354256048363019,     -0.1353953789343498,
-                            0.1929983952105709,     -0.192986540083133,
-                            1.323973843405882e-05,  7.406583250375533e-06,
-                            -0.1193519478971593,    0.1193585210728718},
-                           {-0.08493737499132918, -0.08495105232686351,
-                            -0.05548883416250435, 0,
-                            0.01752065925706302,  0.0175050065508108,
-                            -0.08628389058007339, -0.08627577589091553,
-                            0.01750966246613933,  0,
-                            0.0435661664967641,   0.04354494059128562,
-                            0.01473199984801797,  0.01471828025443576,
-                            0.002371687320185258, 0.3951119289651346,
-                            0.005757106500743715, 0.005725579272762061,
-                            0.004062789812620283, 0.004063067693035264,
-                            0.005741521293504396, 0.1169446073234201,
-                            0.129234437558451,    0.1293023172596233},
-                           {0.0001556029190375551,  0.0001390086379159411,
-                            -5.755944336568556e-05, 0,
-                            0.1096931988105133,     0.1096796478297017,
-                            7.00657446778934e-06,   3.183898544337352e-05,
-                            0.1551117578229091,     0,
-                            -0.002852616176511631,  -0.002843137616759001,
-                            0.1285465137813446,     0.1285314616572139,
-                            0.1944647205794678,     -7.460674766379748e-06,
-                            -0.1354301988950832,    -0.1354308446782502,
-                            -0.0001737361875204098, -0.0001718219597491577,
-                            -0.1915070731398828,    -0.1814918401337391,
-                            -0.1193738433753863,    -0.1193651887330754},
-                           {-0.08616564893462389,   -0.08614986230472101,
-                            0.09611683601594032,    0,
-                            -1.165937420145925e-06, 7.904832101415411e-06,
-                            0.08846515492445864,    0.08845593232731901,
-                            0.2850625702929752,     0,
-                            -0.2521185587265318,    -0.2521303237499596,
-                            1.685486618938165e-05,  -2.895583522651983e-05,
-                            0.1430971157478105,     1.889466201858984e-06,
-                            1.997942214144097e-05,  1.198032832839424e-05,
-                            -0.1388747138556134,    -0.1388810185152599,
-                            0.1346637356009529,     0.1383885805097154,
-                            2.123315657085484e-05,  5.012046808215774e-07},
-                           {-0.01991138032942086,   0.01987375964669011,
-                            5.347617439096952e-05,  0,
-                            0.1757551666142012,     -0.1757618019515414,
-                            0.168860718024702,      -0.1688480988680872,
-                            -5.849243726420181e-06, 0,
-                            -0.230174604876451,     0.2301898998113466,
-                            0.07782145115758227,    -0.07775899464010727,
-                            2.063847558033506e-05,  -1.088795080723981e-05,
-                            0.07689692988063197,    -0.07688496458299594,
-                            -0.1147054211345813,    0.1147074691828041,
-                            1.87089723828676e-05,   2.64755154323668e-06,
-                            0.07573957250529613,    -0.07567410249994765},
-                           {0.0004595785896556763,  -0.0004238397423141654,
-                            -2.084450603641513e-06, 0,
-                            0.1546494174844756,     -0.1546288961912446,
-                            -6.788929165287806e-06, -2.277053915021491e-05,
-                            1.533501409977587e-05,  0,
-                            -0.007950103612898858,  0.007943530880602553,
-                            0.186713054288172,      -0.1867125905587051,
-                            3.002495632368954e-05,  9.441676883070387e-06,
-                            -0.194510974467317,     0.1945112974691794,
-                            -9.562227360815352e-05, 9.126268922815081e-05,
-                            -1.851178498213168e-05, 1.45602210703999e-05,
-                            -0.175960924990717,     0.1759488422125813},
-                           {-0.1076721321410654,    0.1076889928973513,
-                            -1.414713426330186e-05, 0,
-                            -0.05442147362103429,   0.05441671861267668,
-                            -0.05846447825321615,   0.05846119828357212,
-                            -1.271558114211981e-05, 0,
-                            -0.04265278252441436,   0.0426780775593236,
-                            0.06881907320077044,    -0.06878316666677664,
-                            1.641380240217301e-05,  2.318141909512709e-05,
-                            0.06207827475607939,    -0.06203336541498244,
-                            0.08514320337717771,    -0.08510923729119908,
-                            1.699077543316717e-05,  3.610306262621292e-06,
-                            0.05764896469063468,    -0.0577015222793397},
-                           {-0.001005842290189365,  -0.0009868920936768365,
-                            5.401685314977625e-05,  0,
-                            -0.02909734252938431,   -0.02908917820092171,
-                            -3.245287974347834e-06, -3.511271108375308e-05,
-                            -0.02910963802536305,   0,
-                            -0.01838546196336954,   -0.0183949061842006,
-                            -0.07575879066712944,   -0.07576673062178195,
-                            -0.09055610618017902,   0.2958667501106039,
-                            -0.0876721021777167,    -0.08769882582223869,
-                            -0.08913375561709766,   -0.08910631440756234,
-                            -0.08767461590593632,   -0.000158811294857131,
-                            -0.01485114797577977,   -0.01491496358998882},
-                           {-0.05804247126317359,   -0.05807072442674228,
-                            -0.08689750905651823,   0,
-                            0.05442586788703133,    0.05443693202803863,
-                            -0.1097248579751615,    -0.1096968952990283,
-                            0.07695982137777693,    0,
-                            0.01545359568431271,    0.01543481668290529,
-                            0.06881542096804302,    0.06884204042167315,
-                            0.08245715606962883,    3.75221201571503e-06,
-                            -0.06205944901874826,   -0.06207019875965015,
-                            -6.914849191687309e-05, -6.041012956429971e-05,
-                            -0.08776320097636464,   0.06670490627772332,
-                            0.0576490938014757,     0.05770265901897342},
-                           {-0.001245125857269005,  -0.001235815526948705,
-                            -7.945801001376096e-05, 0,
-                            2.16559686041865e-05,   2.293636751784811e-05,
-                            1.190097021134518e-05,  2.448704392312258e-05,
-                            -0.1546185935008997,    0,
-                            0.1671105038010995,     0.1670985354996284,
-                            1.376783304328339e-05,  -6.820535479088494e-08,
-                            0.2002506695973243,     5.514416288337239e-06,
-                            1.155002195083098e-05,  4.009403433949556e-05,
-                            -0.1973807195345209,    -0.1973925269049314,
-                            0.1945113301414207,     -0.189508027539048,
-                            -1.865705506110532e-05, -1.325483631904966e-05},
-                           {-0.1671954492209584,   -0.1671942658803584,
-                            0.1122004942755956,    0,
-                            0.1757463685937784,    0.1757462933640427,
-                            0.02247862589682756,   0.02246192369198404,
-                            -0.248570194877569,    0,
-                            0.05340361321697736,   0.05337918797502247,
-                            -0.07778358183627122,  -0.07783394308621752,
-                            0.1206675903527339,    -9.919960450372242e-06,
-                            0.0768630055965267,    0.0768851720556151,
-                            -0.001740834595434705, -0.001721109558216102,
-                            -0.1087394200499871,   0.1177585748186244,
-                            -0.07568943655178736,  -0.07568516066694096}};
-  gains["A3"]["0+7+0"] = {
-      {0.2133721105067292, 0.2133746281179425, 0.1661843576270339, 0,
-       0.23656992834715, 0.2365641853787369, 0.2884354004614552,
-       0.2884231014369346},
-      {0.2144245532960823, -0.2144219215568881, 1.111845730418934e-05, 0,
-       0.3748320658866341, -0.3748278683846863, 0.2210557165107208,
-       -0.2210469487281935},
-      {2.941624819573778e-05, -7.82048843646572e-06, -3.664038829825851e-05, 0,
-       -1.562854367545316e-05, -2.548642149069724e-07, -6.868503205841551e-06,
-       -1.446038374056214e-05},
-      {0.2557232838211285, 0.2557315296931433, 0.2302484686100738, 0,
-       0.04243436043756801, 0.04241750855978356, -0.4050152537205439,
-       -0.4050128555906315},
-      {0.3450277237860876, -0.3450243866517254, 3.309632903798802e-05, 0,
-       0.06816621821559735, -0.06813452309045528, -0.3264556734513172,
-       0.326460873341635},
-      {1.912228199524981e-06, 2.207916631618564e-05, -2.206398489147069e-05, 0,
-       -7.633512046354969e-06, -9.349979838101931e-06, -1.18756599206089e-06,
-       2.474357960548729e-05},
-      {0.1529740724207206, 0.1529945012657442, 0.1771027379301922, 0,
-       0.1404284340475498, 0.140437086751939, 0.1227771089099324,
-       0.1227437361994558},
-      {1.854543900743752e-05, 8.365794320104082e-06, -1.869617850238338e-05, 0,
-       -1.238987445661057e-05, 1.34667095801283e-05, 6.763675686355063e-06,
-       -5.068749635153865e-06},
-      {0.05135617764084595, 0.0513749936689071, 0.2601143932065694, 0,
-       -0.3733767046384907, -0.3733852617628248, 0.1935340738069332,
-       0.1935452074768156},
-      {0.2551462876216126, -0.2551611566827833, 3.881567135947996e-05, 0,
-       -0.2699433498323792, 0.2699670232301725, 0.1775324428446776,
-       -0.177534762348146},
-      {1.291797787709621e-05, 4.425981232602145e-06, -1.685171012563813e-05, 0,
-       -5.815250490786544e-07, -3.328253542871047e-06, -1.673026844434246e-06,
-       1.102848642228983e-05},
-      {0.01426444346480944, -0.01426011132202074, 7.329645468407324e-06, 0,
-       0.02438743981922501, -0.02437646722047018, 0.01609307088180723,
-       -0.01606477314341293},
-      {8.545411930387015e-05, 2.623212254511682e-05, -5.085035383605781e-05, 0,
-       -1.392574391780339e-05, 1.121519731594587e-05, 2.023800375624381e-05,
-       1.849547181053276e-05},
-      {0.03087613887795524, 0.0308964355182558, 0.02554305919376208, 0,
-       0.01922731885956907, 0.01922439118602287, -0.03002397996585367,
-       -0.03002565241904382},
-      {1.581300720374881e-05, 3.787242962366299e-05, -4.755726784649949e-06, 0,
-       -2.522318975501566e-06, -8.144478254242895e-07, 1.46102312227597e-05,
-       3.540982374418699e-05},
-      {-0.139695202165987, -0.1396913084502265, 0.2741435700307321, 0,
-       -0.06293893479698767, -0.06292890883237989, 0.03753049624142856,
-       0.03753035378796793}};
-  gains["A3"]["4+7+0"] = {
-      {0.1248431441013129, 0.1248508409086648, 0.1144020535950842, 0,
-       0.1587554477278004, 0.1587568025662607, 0.1862030365690383,
-       0.1861899194743715, 0.1447098940870847, 0.1447014772103559,
-       0.1449509315341612, 0.1449540797605403},
-      {0.1410617710247246, -0.1410702416054963, 4.98738605334857e-06, 0,
-       0.2951066093616399, -0.2951157156322247, 0.1501164847022317,
-       -0.1500979882991518, 0.1414738671128027, -0.1414462727969675,
-       0.1353870659384222, -0.1354014793164771},
-      {-0.1807472478535095, -0.1807726463105044, -0.1337281916137067, 0,
-       -0.1767985473296882, -0.1767856526641368, -0.2149641555707934,
-       -0.2149596409358924, 0.2789572032123575, 0.2789573540715597,
-       0.2796124972964511, 0.2796110278894129},
-      {0.1659133108345941, 0.1659137452730246, 0.2005371064704555, 0,
-       0.02687783202160462, 0.02685664862434944, -0.3033250315949225,
-       -0.3033123436359588, 0.1417512867546591, 0.141750841991166,
-       -0.1420974197761083, -0.1420954534227888},
-      {0.2368002124393554, -0.2368054351695868, 7.472819666206551e-06, 0,
-       0.04614162180561492, -0.04610739073952302, -0.2369726163558042,
-       0.2369556298185283, 0.1306011015176139, -0.130567100158352,
-       -0.1153768865392058, 0.11537070080879},
-      {-0.1072445963675927, 0.1072492394437017, -2.104109333045682e-05, 0,
-       -0.1435946183264212, 0.1435780552171893, -0.106371699489443,
-       0.1063814370474547, 0.2016535448673993, -0.2016331414098163,
-       0.1966714620915909, -0.1966738748010878},
-      {0.03707551533920023, 0.03711377249898903, 0.03123229480777222, 0,
-       -0.007565374249243929, -0.007590740129802876, -0.02257534944578969,
-       -0.02257263269104874, 0.1503907487221809, 0.1504118077067788,
-       0.1506193141215033, 0.1506064135127085},
-      {-0.1320417494013954, -0.1320655926887978, -0.07315894979740444, 0,
-       -0.02508634762571646, -0.02508186865336135, 0.1697707430747047,
-       0.1697721543472219, 0.2017747716498884, 0.2018054742881273,
-       -0.2031988932360615, -0.2032022874861587},
-      {0.03343207788328903, 0.03341709478798754, 0.2339103251323056, 0,
-       -0.3051622587128843, -0.30516749995697, 0.1728682509049199,
-       0.1728929194190446, 0.0005060502033188109, 0.0004966019790357208,
-       0.0002984357456387924, 0.0002715485194430772},
-      {0.1834656617567817, -0.1834560936904357, 4.985206376639017e-06, 0,
-       -0.2297754478794448, 0.2297644962521784, 0.1503354692436369,
-       -0.1503592071664161, 0.02919253919613808, -0.02913851428721089,
-       0.005894162086294869, -0.005864367366392276},
-      {-0.1630444959654104, 0.1630495483697164, -3.874884948959998e-05, 0,
-       -0.03296443049468014, 0.0329816573965238, 0.1426950987233334,
-       -0.1426985259033985, 0.1710706725999493, -0.171055278440254,
-       -0.1579745136313849, 0.1579601239774996},
-      {-0.03320909146014882, 0.03319223328176957, 2.562356279145786e-05, 0,
-       -0.08811699498542354, 0.08815635593107761, -0.03622531387482417,
-       0.03619761273025789, 0.09000165800367751, -0.09001546246676619,
-       0.0945683744339906, -0.09454394366446316},
-      {-0.01001995572013138, -0.01005940245658405, -0.08476922427716131, 0,
-       -0.04431860225799064, -0.0443327007689063, -0.006061572274671271,
-       -0.006024622922253629, -0.03211558942640665, -0.03211180073438326,
-       -0.03349693216957211, -0.0335050563808065},
-      {-0.03006552728705839, -0.03003905828220129, -0.0608019758766407, 0,
-       0.003010201482933947, 0.002975455740394346, 0.08399197483443399,
-       0.08399655383020822, 0.08965318632049535, 0.08969389306909957,
-       -0.09102087583321128, -0.09103967673169097},
-      {-0.02307393438929691, -0.02310944923501072, -0.06693349994384293, 0,
-       0.1295633345495559, 0.1295691181896453, -0.05404997515864856,
-       -0.05403633015231262, 0.0002671235504151517, 0.000277978977089705,
-       0.001335721809450846, 0.001327705379917934},
-      {-0.1076044357160532, -0.1076337226790462, 0.2391669198227754, 0,
-       -0.04457532240774916, -0.04454180845814031, -0.002875517396403541,
-       -0.002911040680991749, -0.0281262986225574, -0.02815811896337869,
-       0.02848595602497726, 0.02850031179624819}};
-  gains["A3"]["3.1.2"] = {
-      {0.4600323101900624, 0.4600358147449242, 0.09927427523765553, 0,
-       0.1117560050721716, 0.1117436851195383},
-      {0.5123392506750477, -0.5123299267496459, 1.135584210010789e-05, 0,
-       0.0957108951564507, -0.09570200785524186},
-      {-0.1732089314698727, -0.173209548626266, -0.1291192913582355, 0,
-       0.2177360627914349, 0.2177373808538265},
-      {-0.08679045309650202, -0.08677884813556791, 0.1863923347894433, 0,
-       0.1412031047645282, 0.1411734294182388},
-      {0.2110606804377801, -0.2110661297515312, 3.137031115535313e-05, 0,
-       0.1217813651564454, -0.1217559625086076},
-      {-0.1240357707577273, 0.1240583588247642, -9.139079069890202e-06, 0,
-       0.1382991250358413, -0.138304588879417},
-      {0.06031436634859495, 0.06030266347629555, 0.03496657976412021, 0,
-       0.1241729595585358, 0.1242088094631468},
-      {-0.1472639085341873, -0.1472669580416421, -0.1160046528516226, 0,
-       0.2136451259296143, 0.2136488984449724},
-      {-0.09544120762175748, -0.09542188594272218, 0.2076180215742282, 0,
-       0.03635167116982406, 0.03631806676219861},
-      {0.009626709371755512, -0.009640918631298873, 3.945961167825228e-05, 0,
-       0.06785954761722965, -0.06782207605859106},
-      {-0.1475498516744137, 0.1475399594366354, -2.87941414863721e-05, 0,
-       0.1732515053364818, -0.173246377527131},
-      {-0.02170847952470226, 0.02169692697588083, 4.179365068804624e-06, 0,
-       0.06485935332604253, -0.06488206577719892},
-      {-0.01757221242275774, -0.01758859152910528, -0.06578851052684974, 0,
-       -0.01129650672322881, -0.01128750313103734},
-      {-0.03459537443031531, -0.03460531633971509, -0.0179100086476445, 0,
-       0.1236321152318951, 0.1236767028264234},
-      {0.005974535674267993, 0.005974916452797245, -0.08364789008525689, 0,
-       0.04362752093129507, 0.04363237973449083},
-      {-0.1740530536567975, -0.1740173863014943, 0.2217087116645219, 0,
-       -0.005882757815817798, -0.005932942836583561}};
-  gains["A3"]["7.1.2"] = {
-      {0.1248431441013129, 0.1248508409086648, 0.1144020535950842, 0,
-       0.1587554477278004, 0.1587568025662607, 0.1862030365690383,
-       0.1861899194743715, 0.247205680714197, 0.2471994899696896},
-      {0.1410617710247246, -0.1410702416054963, 4.98738605334857e-06, 0,
-       0.2951066093616399, -0.2951157156322247, 0.1501164847022317,
-       -0.1500979882991518, 0.2372069795228113, -0.2371895770043385},
-      {-0.1807472478535095, -0.1807726463105044, -0.1337281916137067, 0,
-       -0.1767985473296882, -0.1767856526641368, -0.2149641555707934,
-       -0.2149596409358924, 0.4766730961551832, 0.4766722079867045},
-      {0.1659133108345941, 0.1659137452730246, 0.2005371064704555, 0,
-       0.02687783202160462, 0.02685664862434944, -0.3033250315949225,
-       -0.3033123436359588, 0.04127323764186144, 0.04127418330013484},
-      {0.2368002124393554, -0.2368054351695868, 7.472819666206551e-06, 0,
-       0.04614162180561492, -0.04610739073952302, -0.2369726163558042,
-       0.2369556298185283, 0.04901732265355059, -0.04898769526621227},
-      {-0.1072445963675927, 0.1072492394437017, -2.104109333045682e-05, 0,
-       -0.1435946183264212, 0.1435780552171893, -0.106371699489443,
-       0.1063814370474547, 0.3407212693782362, -0.3407025719638995},
-      {0.03707551533920023, 0.03711377249898903, 0.03123229480777222, 0,
-       -0.007565374249243929, -0.007590740129802876, -0.02257534944578969,
-       -0.02257263269104874, 0.2568946871151627, 0.2569066239918003},
-      {-0.1320417494013954, -0.1320655926887978, -0.07315894979740444, 0,
-       -0.02508634762571646, -0.02508186865336135, 0.1697707430747047,
-       0.1697721543472219, 0.058091456313068, 0.05811975885404616},
-      {0.03343207788328903, 0.03341709478798754, 0.2339103251323056, 0,
-       -0.3051622587128843, -0.30516749995697, 0.1728682509049199,
-       0.1728929194190446, 0.0007170761428084646, 0.0006886157785550878},
-      {0.1834656617567817, -0.1834560936904357, 4.985206376639017e-06, 0,
-       -0.2297754478794448, 0.2297644962521784, 0.1503354692436369,
-       -0.1503592071664161, 0.03336034117676983, -0.03328524821935597},
-      {-0.1630444959654104, 0.1630495483697164, -3.874884948959998e-05, 0,
-       -0.03296443049468014, 0.0329816573965238, 0.1426950987233334,
-       -0.1426985259033985, 0.0593658227565504, -0.05936060361869623},
-      {-0.03320909146014882, 0.03319223328176957, 2.562356279145786e-05, 0,
-       -0.08811699498542354, 0.08815635593107761, -0.03622531387482417,
-       0.03619761273025789, 0.1568715968517408, -0.156868126152027},
-      {-0.01001995572013138, -0.01005940245658405, -0.08476922427716131, 0,
-       -0.04431860225799064, -0.0443327007689063, -0.006061572274671271,
-       -0.006024622922253629, -0.0558014973124569, -0.05580345330528914},
-      {-0.03006552728705839, -0.03003905828220129, -0.0608019758766407, 0,
-       0.003010201482933947, 0.002975455740394346, 0.08399197483443399,
-       0.08399655383020822, 0.02529170778929291, 0.02531912029508973},
-      {-0.02307393438929691, -0.02310944923501072, -0.06693349994384293, 0,
-       0.1295633345495559, 0.1295691181896453, -0.05404997515864856,
-       -0.05403633015231262, 0.001211621499656611, 0.001216808454647537},
-      {-0.1076044357160532, -0.1076337226790462, 0.2391669198227754, 0,
-       -0.04457532240774916, -0.04454180845814031, -0.002875517396403541,
-       -0.002911040680991749, -0.007983685948714188, -0.008005355226320645}};
-  gains["A3"]["9.1.6"] = {
-      {0.04045762873091181, 0.0404604598386132, 0.1231550074071508, 0,
-       0.2462571559413611, 0.2462554735147873, 0.1766535020681217,
-       0.1766459603636444, 0.1317574396612083, 0.1317608084355463,
-       0.1217050908415429, 0.1216907285586935, 0.1687574466485778,
-       0.1687467433578042, 0.06033698224110145, 0.0603380559940695},
-      {0.1022769019598166, -0.1022799529391676, 7.45686121341717e-06, 0,
-       0.1822810031235403, -0.1823002480001624, 0.1354779882967139,
-       -0.135446923431081, 0.2248483882712282, -0.2248662151943541,
-       0.08584084260089186, -0.08581918886363119, 0.09438728887038056,
-       -0.09435266607741589, 0.1359812774487848, -0.135981796622653},
-      {0.0003163053040200183, 0.0003047699250638685, -0.1946421029015789, 0,
-       -0.3151426125386502, -0.3151286110184384, -0.12011184904391,
-       -0.1201128499247544, -0.1883853499825255, -0.188375801091459,
-       0.2630615875529336, 0.2630362260429148, 0.3359678159150621,
-       0.3359408260389573, 0.0976431864475443, 0.09764278132241076},
-      {0.05357055806409872, 0.05358159346705726, 0.2031481248154895, 0,
-       -0.3645829750931668, -0.3645872372027621, 0.2835315653720089,
-       0.2834969162795094, -0.01435050731555523, -0.01434906981486589,
-       0.08583965825766089, 0.08581338489941605, -0.1887644521360949,
-       -0.1887588310186024, -7.030907979534407e-05, -7.469952910201021e-05},
-      {0.1248404386493702, -0.1248574086866941, 2.636373949901749e-05, 0,
-       -0.2850462164390771, 0.2850620297357237, 0.2466880212280119,
-       -0.2466124149561417, -0.0355830919330529, 0.03556861584850019,
-       0.1256379549294334, -0.1256168286343008, -0.1346669447177776,
-       0.1346526812480088, 0.0003006643661215784, -0.0002888625515537094},
-      {0.0008695864612890908, -0.0008474459629712199, 6.67729503010514e-06, 0,
-       -0.1097001144126587, 0.1097055398233778, -0.1193409284691429,
-       0.1193597524507202, -0.1649310668578867, 0.1649242656111202,
-       0.1285520339845242, -0.1285039778904022, 0.1354487005273885,
-       -0.1353722832432633, 0.1929983952105709, -0.192986540083133},
-      {-0.08493737499132918, -0.08495105232686351, 0.06145577316091578, 0,
-       0.02990186032315771, 0.02988620761690549, 0.0446275831653348,
-       0.04470357755566488, 0.0435661664967641, 0.04354494059128562,
-       0.2122879643305853, 0.212274244737003, 0.2073729396242749,
-       0.2073414123962933, 0.004062789812620283, 0.004063067693035264},
-      {0.0001556029190375551, 0.0001390086379159411, -0.1815493995771048, 0,
-       0.2193737746088579, 0.2193602236280462, 0.01814048582237032,
-       0.01817397287565678, -0.002852616176511631, -0.002843137616759001,
-       0.1285427834439614, 0.1285277313198307, -0.2708498792948656,
-       -0.2708505250780326, -0.0001737361875204098, -0.0001718219597491577},
-      {-0.08616564893462389, -0.08614986230472101, 0.2345054165256557, 0,
-       0.2015685105792095, 0.201577581348731, 0.1896713289945426,
-       0.1896413744455129, -0.2521185587265318, -0.2521303237499596,
-       1.779959929031114e-05, -2.801110212559034e-05, 0.09524256477858849,
-       0.09523456568477544, -0.1388747138556134, -0.1388810185152599},
-      {-0.01991138032942086, 0.01987375964669011, 5.61237259342062e-05, 0,
-       0.1757510305742974, -0.1757659379914452, 0.2446148841360343,
-       -0.2445076077619987, -0.230174604876451, 0.2301898998113466,
-       0.07781600718217864, -0.0777644386155109, 0.07690471514646931,
-       -0.07687717931715861, -0.1147054211345813, 0.1147074691828041},
-      {0.0004595785896556763, -0.0004238397423141654, 1.247577046675839e-05, 0,
-       0.1546602609769351, -0.1546180526987851, -0.175946483069661,
-       0.1759473025236524, -0.007950103612898858, 0.007943530880602553,
-       0.1867177751266135, -0.1867078697202635, -0.1945193434375683,
-       0.1945029284989282, -9.562227360815352e-05, 9.126268922815081e-05},
-      {-0.1076721321410654, 0.1076889928973513, -1.053682800068057e-05, 0,
-       -0.05443046489468661, 0.05440772733902435, -0.0008039072515978393,
-       0.0007712823152160528, -0.04265278252441436, 0.0426780775593236,
-       0.068830663910318, -0.06877157595722908, 0.06210187975815337,
-       -0.06200976041290847, 0.08514320337717771, -0.08510923729119908},
-      {-0.001005842290189365, -0.0009868920936768365, -0.0001047944417073547, 0,
-       -0.0496809649750043, -0.04967280064654171, -0.07888723002160775,
-       -0.07898291305892619, -0.01838546196336954, -0.0183949061842006,
-       0.07217458438817252, 0.07216664443352001, -0.001734042567428262,
-       -0.001760766211950246, -0.08913375561709766, -0.08910631440756234},
-      {-0.05804247126317359, -0.05807072442674228, -0.02019260277879491, 0,
-       0.1088446794621628, 0.1088557436031701, 0.006230250040506216,
-       0.006311777934137161, 0.01545359568431271, 0.01543481668290529,
-       0.06881729707405088, 0.068843916527681, -0.1241155274617657,
-       -0.1241262772026676, -6.914849191687309e-05, -6.041012956429971e-05},
-      {-0.001245125857269005, -0.001235815526948705, -0.1895874855490617, 0,
-       -0.1093101999934082, -0.1093089195944945, 0.1415918503245651,
-       0.1416098386170189, 0.1671105038010995, 0.1670985354996284,
-       1.652504118745201e-05, 2.689002789377735e-06, 0.1375545877907088,
-       0.1375831318030975, -0.1973807195345209, -0.1973925269049314},
-      {-0.1671954492209584, -0.1671942658803584, 0.22995906909422, 0,
-       -1.930180501225065e-05, -1.937703474799712e-05, 0.03211406075289877,
-       0.03210163443290166, 0.05340361321697736, 0.05337918797502247,
-       -0.07778854181649641, -0.07783890306644271, -3.233568333682602e-05,
-       -1.01692242484297e-05, -0.001740834595434705, -0.001721109558216102}};
-  gains["A3"]["0+1+0"] = {{0.6105119355720615},     {3.864696727584604e-06},
-                          {-1.915734957957846e-07}, {0.07245580339689955},
-                          {4.086614467227467e-06},  {8.200767978333346e-06},
-                          {0.09219657921145887},    {7.924127471345699e-07},
-                          {0.1581881443262517},     {5.331156031899986e-06},
-                          {3.178888355326942e-07},  {-1.05779471873341e-05},
-                          {-8.217490766104031e-06}, {0.0396539739203252},
-                          {-1.52839265288139e-05},  {0.04952212440781636}};
-
-  // -------------------------------------------------------
-  // Input layout: A4
-  gains["A4"]["0+2+0"] = {{0.6093259846194182, 0.609336255967694},
-                          {0.5588714864295891, -0.5588637719858595},
-                          {-8.384707815733911e-07, 4.560648497305732e-07},
-                          {0.07230226352186944, 0.07232906400241045},
-                          {0.2454814628339485, -0.2454733054131794},
-                          {2.340913968331902e-06, 1.402889912900946e-05},
-                          {0.09202150866624001, 0.09201500765677571},
-                          {-1.435509445126618e-07, 1.725311165118242e-06},
-                          {0.1578726911599899, 0.1578916816008976},
-                          {0.1057018960848632, -0.1056912543951989},
-                          {-9.194184319772273e-06, 9.828732308100954e-06},
-                          {0.01441718407633314, -0.01443829905225584},
-                          {6.200960262429973e-06, -2.260415424690238e-05},
-                          {0.03956653794271322, 0.03958801725962716},
-                          {-1.749193891704969e-05, -1.301679164711246e-05},
-                          {0.04942416870520795, 0.04942851471188756},
-                          {0.1175640100994695, -0.1175386073126057},
-                          {1.011966419271346e-05, -1.047639988119823e-05},
-                          {0.03842790752746169, -0.03840115154723191},
-                          {1.211755634739991e-05, -2.485965912259358e-05},
-                          {0.03073697884395466, 0.03075119829313019},
-                          {1.378359283483081e-05, -2.651643783286786e-05},
-                          {0.01165155292295031, 0.01168257027223622},
-                          {-2.017168442013802e-05, 3.029028291221208e-07},
-                          {0.03186828232848787, 0.03185344082788918}};
-  gains["A4"]["0+5+0"] = {
-      {0.2320670771839111, 0.232069076400836, 0.1529865330275428, 0,
-       0.4327781171807656, 0.4327738928847031},
-      {0.2876817116965276, -0.2876843232285672, 8.477744390255564e-06, 0,
-       0.417729581516094, -0.417708176711285},
-      {1.582529728897441e-05, 9.175511936950598e-06, -3.771286777382037e-05, 0,
-       -4.075522122277157e-06, 9.942658161109702e-06},
-      {0.2847830731803795, 0.2847940783610645, 0.2458106048083841, 0,
-       -0.3987329640522473, -0.3987486398400004},
-      {0.3674068529645996, -0.3674065998473235, 3.519029154864368e-05, 0,
-       -0.09823321473548527, 0.09824256846837395},
-      {4.536343439880638e-06, 1.35443990729531e-05, -1.309779963875059e-05, 0,
-       2.47605349103791e-06, 1.568843517234445e-06},
-      {0.120886421189266, 0.1209071595341141, 0.1582820725088309, 0,
-       0.08493134368935805, 0.08491597635415656},
-      {2.549874744571468e-05, 2.008178793284564e-05, -4.316382437714548e-06, 0,
-       -1.53543978539452e-06, 9.477030994721825e-06},
-      {-0.03723366663577364, -0.03721947519649494, 0.2522531159635875, 0,
-       -0.07519154587916528, -0.07521051066539328},
-      {0.1712522082227282, -0.1712529543141994, 4.044983897298397e-05, 0,
-       -0.1623061508905765, 0.1623208520881083},
-      {5.736262350913306e-06, 5.069677883107672e-06, -1.486645790003041e-05, 0,
-       -1.508378640699915e-05, 5.070949934616649e-06},
-      {0.02443960280719628, -0.02446494687250591, -1.843135110307322e-06, 0,
-       0.05145873360703417, -0.05145265537684205},
-      {2.462119587057935e-05, 2.223721991644005e-05, -8.926161623026503e-05, 0,
-       9.538368382412742e-06, 2.629960391576808e-06},
-      {0.09919679369144647, 0.09921377841539072, 0.08888276058157932, 0,
-       -0.03966249197182386, -0.03966752662218503},
-      {-1.010211703831832e-05, 3.938415367245501e-07, -2.545463597404618e-05, 0,
-       7.814285803713214e-06, -4.153552445573743e-06},
-      {-0.1777764410074587, -0.1777907176790538, 0.2680894966576085, 0,
-       -0.01772124529292436, -0.01770693347812565},
-      {0.03776152288933932, -0.03775257576719374, 2.706873667405318e-05, 0,
-       0.003725004338171489, -0.003681623276580455},
-      {8.372265810105222e-06, 1.078208234864234e-06, -1.004279421028597e-05, 0,
-       -6.094543581766481e-06, 1.45915291980102e-06},
-      {0.1011772937904345, -0.1011600361127936, 3.823799159617584e-05, 0,
-       -0.04459489635160828, 0.04462241042575407},
-      {3.12880915563649e-05, -1.846969039527374e-05, -2.377865620969619e-05, 0,
-       -3.556179257658869e-05, -1.890617633695877e-05},
-      {0.06777801040013576, 0.06779244485676596, 0.09405594013399286, 0,
-       0.01226894056061515, 0.01227095675134491},
-      {7.200853689608807e-05, 2.279458860505782e-05, -1.528934167792003e-05, 0,
-       -2.259680557086394e-05, 1.301895912177105e-05},
-      {-0.0428514136771531, -0.0428428326123805, 0.03350472478136744, 0,
-       -0.003389398028775322, -0.003387139686111333},
-      {4.631260894489612e-06, -3.872573097626475e-06, -8.407500979447779e-08, 0,
-       -1.986548401255291e-05, -8.887364141902815e-06},
-      {-0.107408281281598, -0.1074115818497727, 0.2445097281020831, 0,
-       0.009310075536704239, 0.009319825883693639}};
-  gains["A4"]["2+5+0"] = {
-      {0.1462018099601641, 0.14620916557331, 0.09837170863293987, 0,
-       0.4379084706618402, 0.4379029793830675, 0.110739958993637,
-       0.1107277510496565},
-      {0.2076052600084871, -0.2076108145223289, 1.125259879942959e-05, 0,
-       0.4243715254310414, -0.4243506040231231, 0.09484072554333738,
-       -0.09483191904232836},
-      {-0.1774580159807152, -0.1774674175462565, -0.1279453844208592, 0,
-       0.00823615190791388, 0.00824858287357505, 0.2157564835051861,
-       0.2157577895842205},
-      {0.1934062059812723, 0.1934296526792832, 0.1846977215943009, 0,
-       -0.3951420045789051, -0.39515890053521, 0.1399193360687857,
-       0.1398899305202508},
-      {0.2730087799442937, -0.2730179537233802, 3.108510337961687e-05, 0,
-       -0.09032156143348838, 0.09032689868759111, 0.1206741720492304,
-       -0.1206490003532838},
-      {-0.1262661271658665, 0.1262865436270079, -9.055989794782506e-06, 0,
-       0.004748993876476043, -0.004746213188707194, 0.1370417582968757,
-       -0.1370471724651177},
-      {-0.002535858454030369, -0.00253699122772043, 0.03464867598591916, 0,
-       0.0881081465628628, 0.08809334865608097, 0.1230440229207417,
-       0.1230795468906973},
-      {-0.1486560228545576, -0.1486659843080357, -0.1149499795699002, 0,
-       0.003862197016636663, 0.003872011193577561, 0.2117027399946606,
-       0.2117064782116432},
-      {-0.036658506973379, -0.03662711277026029, 0.2057304319407462, 0,
-       -0.08190415433688743, -0.08192147589323855, 0.03602117463036362,
-       0.03598787574212899},
-      {0.1249698593795552, -0.1249867904004416, 3.91008588427309e-05, 0,
-       -0.1632436227686544, 0.1632476546164346, 0.06724259260704396,
-       -0.06720546172656568},
-      {-0.1513522720814404, 0.1513541992113717, -2.853235533427135e-05, 0,
-       0.007274561096248622, -0.00729114901662198, 0.1716763639158158,
-       -0.1716712827266944},
-      {-0.05340086671077486, 0.05338447238439945, 4.141367759521952e-06, 0,
-       0.04509892120079013, -0.04509192535606877, 0.06426967502141225,
-       -0.06429218097899439},
-      {-0.01851373742048498, -0.01852639277797131, -0.06519038465352181, 0,
-       0.001557452662629916, 0.00155239708133236, -0.01119380287881469,
-       -0.01118488114409955},
-      {-0.005787668974205138, -0.005793854836212536, -0.01774717718242519, 0,
-       -0.04029543670578944, -0.0403006207305582, 0.1225080957594634,
-       0.1225522779793495},
-      {0.01134492714152714, 0.01135210365641223, -0.08288739304848533, 0,
-       -0.007671698217585799, -0.00768131373597775, 0.04323087493871688,
-       0.04323568956739216},
-      {-0.1525608940263695, -0.1525361523937817, 0.2196930144595422, 0,
-       -0.02815661134301536, -0.02814161863184943, -0.005829273862039476,
-       -0.005879002618343052},
-      {0.01412323846151805, -0.014142542713965, 3.659741391940125e-05, 0,
-       -0.004147432031450586, 0.004177806287295372, 0.02993874181069809,
-       -0.02988874161702849},
-      {-0.07385242829535196, 0.07384489318766099, -2.565492320869307e-05, 0,
-       -0.0006966370376751236, 0.0006739799362763605, 0.08941864012551172,
-       -0.08941340311575782},
-      {-0.01628133267900135, 0.01629280671527291, 2.560259841274747e-05, 0,
-       -0.04727029280124824, 0.04729560528764545, 0.1018459070595283,
-       -0.1018616268525024},
-      {0.01266494622276221, -0.01265189964088581, -1.224583094881937e-05, 0,
-       -0.01157573998948768, 0.0115276140846517, -0.0354355013392288,
-       0.03543132505175703},
-      {0.0886331125194126, 0.08865965753588724, 0.08233148717346719, 0,
-       0.02079417282674327, 0.0207982314451996, -0.02958143074967187,
-       -0.02961213650031968},
-      {-0.01434464642095774, -0.01438436757936817, -0.04031561220017205, 0,
-       -0.002072837629405313, -0.002036600895772512, -0.01396867346787669,
-       -0.01398252961382916},
-      {-0.01395984764086068, -0.01397672966124555, -0.03900216490983474, 0,
-       -0.005125663358525838, -0.005121320976400627, 0.007491534145955856,
-       0.007537812674159464},
-      {0.0506447241593551, 0.05065939925705726, -0.09329630807423786, 0,
-       -0.0111187527981465, -0.01110501160603743, -0.00942221053779083,
-       -0.009446864569104436},
-      {-0.09906252610411573, -0.09903145500687446, 0.2033576388710656, 0,
-       0.005345095384925483, 0.005352194077466755, 0.002873839167100622,
-       0.002838434086452182}};
-  gains["A4"]["4+5+0"] = {
-      {0.14880034234777, 0.148807244026421, 0.09873102927447007, 0,
-       0.3194409180394294, 0.3194319472597746, 0.1130930542438754,
-       0.1130802922697725, 0.1526459497855447, 0.1526519757147214},
-      {0.2138771178046369, -0.2138812202086008, 1.129370097276423e-05, 0,
-       0.3206651417164275, -0.3206418247846819, 0.1002161015837666,
-       -0.1002061286331226, 0.1387085647394005, -0.1387136073184941},
-      {-0.1765082111954965, -0.1765177426514644, -0.1284127283172885, 0,
-       -0.2529812831667442, -0.2529706100735736, 0.2186265609506895,
-       0.2186270428971414, 0.3018879639034588, 0.3018912587368655},
-      {0.1956689548390962, 0.1956926254834118, 0.1853723637727758, 0,
-       -0.357875699509571, -0.3578856638137689, 0.1418486115759714,
-       0.1418185713814799, -0.09023425690671528, -0.09024443692090525},
-      {0.2777096224947829, -0.2777190435729424, 3.119864739998226e-05, 0,
-       -0.08651667124026972, 0.0865145301273275, 0.1243746165508166,
-       -0.1243482849196163, -0.0232043475632597, 0.02321423912376345},
-      {-0.1226821860461714, 0.1227029242723437, -9.089068452335792e-06, 0,
-       -0.1684148995193868, 0.1684152598059048, 0.1426448484149321,
-       -0.1426485665016176, 0.204079446167641, -0.2040778811632765},
-      {-0.006474882203330848, -0.006474951479849255, 0.03477523660641105, 0,
-       -0.120610313311354, -0.120614023682432, 0.1206542131368401,
-       0.120689978342644, 0.1780229468229807, 0.178008716351761},
-      {-0.1480317094532608, -0.1480414760896732, -0.1153698553754233, 0,
-       0.08352079248795692, 0.08353422970497, 0.2139303923418946,
-       0.2139329577197736, -0.1459158231530552, -0.1459210262362154},
-      {-0.0428631081953435, -0.04282928275757358, 0.2064818999371299, 0,
-       -0.01565127537647818, -0.01565017885231514, 0.03080359067705063,
-       0.03077107223853199, -0.06494243060599057, -0.06496984949291638},
-      {0.1204796200887174, -0.1204999029173508, 3.924368187466761e-05, 0,
-       -0.1185342588402408, 0.1185320755148111, 0.06328200148080614,
-       -0.06324491657306323, -0.06085679569937869, 0.06087609618064502},
-      {-0.1489260965845935, 0.1489274045367897, -2.86365749759304e-05, 0,
-       0.02458335240227507, -0.0246024465011353, 0.1758933560798453,
-       -0.1758855115805885, -0.03916037748054759, 0.03916411276598893},
-      {-0.05842546419544722, 0.05840724423869023, 4.156494862028362e-06, 0,
-       -0.0759760821124788, 0.07596964142943387, 0.062196350036385,
-       -0.0622182403035983, 0.1027945548880054, -0.1027846113914221},
-      {-0.02318519061333009, -0.02319765412915259, -0.06542850444589736, 0,
-       -0.05358742253098773, -0.05357614919053097, -0.01654838098260834,
-       -0.01653815403783153, -0.02195461692528162, -0.02196963465666747},
-      {-0.00714077979383814, -0.007147074064262997, -0.01781200199007729, 0,
-       0.04959840877470102, 0.04957988132921495, 0.1223303906503293,
-       0.1223735917683498, -0.1016620643255274, -0.1016483828007994},
-      {0.006634740244633631, 0.006642270020838664, -0.08319015439784928, 0,
-       0.09437684308815779, 0.09438636348144423, 0.0375755465307139,
-       0.03758173428469819, -0.08244429665074234, -0.08246600020910856},
-      {-0.1583767529260154, -0.1583518131492059, 0.220495483339999, 0,
-       -0.03517993183180473, -0.03518421281318748, -0.01031362209124537,
-       -0.01036216240288167, 0.01490002922783727, 0.01493639097408052},
-      {0.008637003485200684, -0.008657525171174721, 3.673109266129308e-05, 0,
-       -0.006364791794974473, 0.006408305806287798, 0.02553110560332451,
-       -0.02548229807639642, 0.009882555744988636, -0.00992759414411218},
-      {-0.07824208866990565, 0.07823421055701048, -2.574863250371154e-05, 0,
-       0.07538128275413632, -0.07540854411296632, 0.08484222891938628,
-       -0.08483704209907535, -0.08578534113691431, 0.08578846260626738},
-      {-0.01827596509869978, 0.01828738930617193, 2.569611658188663e-05, 0,
-       -0.01432999289482081, 0.01437154398493451, 0.1020333136154677,
-       -0.1020456523903753, -0.03613910233016258, 0.03613131210519337},
-      {0.005154717348949241, -0.005141999134250314, -1.229056108407755e-05, 0,
-       -0.01489708407225037, 0.01483560243143153, -0.04346714212458838,
-       0.04346193629301039, -0.04327670814390781, 0.04327389434182215},
-      {0.09121044593267616, 0.09123599950078545, 0.08263221797504036, 0,
-       0.07006929214444085, 0.07007513935473279, -0.03032114795448312,
-       -0.03035072537977067, -0.07882437272586448, -0.0788209093173031},
-      {-0.01656136168411658, -0.01660173841477965, -0.04046287234072223, 0,
-       0.0595057033982874, 0.05951708698500908, -0.01625265243785143,
-       -0.01626633827497153, -0.0110682854704349, -0.01104768581979714},
-      {-0.01067114155265424, -0.01069036191694097, -0.03914462744414693, 0,
-       0.06139260628002636, 0.06139154204747432, 0.007956472306490494,
-       0.008003699074299431, -0.02677934108640597, -0.02676784215902006},
-      {0.04627297548266877, 0.04628666155700855, -0.0936370898877847, 0,
-       -0.03072576785106205, -0.03072925629943687, -0.01476259504438766,
-       -0.01478331597536743, 0.01981632621950097, 0.01983371033809042},
-      {-0.0964376468943513, -0.09641069735126705, 0.2041004398071749, 0,
-       0.0003041484389473702, 0.0003133716981199196, 0.005331055552210799,
-       0.005296354388156886, 0.006298857447293235, 0.006299640389632421}};
-  gains["A4"]["4+5+1"] = {
-      {0.07940071261202734, 0.07940682253048634, 0.03299459846035378, 0,
-       0.3371799297878094, 0.3371713866273835, 0.1131382557421843,
-       0.113125488667323, 0.1527069599482573, 0.1527129882859023,
-       0.1417712196100981},
-      {0.1620801770789029, -0.1620816858395965, 1.597551990686756e-05, 0,
-       0.3474283628870999, -0.3474165309132732, 0.1002561563685326,
-       -0.1002461794318585, 0.138764004350581, -0.1387690489451134,
-       -6.240716477661926e-06},
-      {-0.01740349366079623, -0.01741581756660569, 0.009253766741559973, 0,
-       -0.2869903992127208, -0.2869871454974565, 0.2187139425161725,
-       0.2187144246552508, 0.3020086237298389, 0.3020119198801383,
-       -0.2818562220407755},
-      {0.1332413119112192, 0.1332608240373881, 0.09423494741894617, 0,
-       -0.3349302022410867, -0.3349425273187472, 0.1419053062140209,
-       0.1418752540129406, -0.09027032210663619, -0.09028050618961617,
-       0.1980644365552644},
-      {0.2191461170660567, -0.2191637064921992, 4.110709907051604e-05, 0,
-       -0.04867678276398624, 0.04866857271327028, 0.1244243271104728,
-       -0.1243979849549375, -0.02321362197258707, 0.0232235174865905,
-       4.911799386626645e-06},
-      {-0.02801425051202629, 0.02803568945828082, -2.427780698362912e-06, 0,
-       -0.2118016017834684, 0.2118329223543314, 0.1427018612962051,
-       -0.1427055808689508, 0.2041610134822962, -0.2041594478524242,
-       7.049297296640264e-06},
-      {-0.152155593487712, -0.1521512721649092, -0.07007067556172558, 0,
-       -0.1027317842300585, -0.1027191478920857, 0.1207024367103171,
-       0.1207382162109059, 0.1780940997685224, 0.1780798636096092,
-       0.1695183745377205},
-      {-0.02879218704627559, -0.02880556864508738, 0.02411405680228404, 0,
-       0.04848733106569025, 0.04849053225943706, 0.2140158969233414,
-       0.2140184633265612, -0.1459741433910008, -0.1459793485537507,
-       -0.3040105248552197},
-      {-0.03885256999431626, -0.03882987184011355, 0.1237285824620116, 0,
-       -0.01308546976218553, -0.01309105704141566, 0.03081590238320451,
-       0.03078337094758227, -0.06496838706447369, -0.0649958169102933,
-       0.1030454024018621},
-      {0.0918147555754615, -0.09183316287020565, 6.487595777343506e-05, 0,
-       -0.09357393938465361, 0.09357941886885474, 0.063307294292129,
-       -0.06327019456213724, -0.06088111919445344, 0.06090042738981571,
-       7.943324508345513e-06},
-      {-0.03989757695693173, 0.03992709550826964, -7.253814879055514e-06, 0,
-       -0.03746729582226984, 0.03748012242096194, 0.1759636578617765,
-       -0.1759558102271979, -0.03917602926171397, 0.0391797660400896,
-       -1.193186424065547e-05},
-      {-0.1427913744520498, 0.1427665452345517, -2.050857516475557e-05, 0,
-       -0.04634255524667853, 0.04629274039817592, 0.06222120893006141,
-       -0.06224310794646698, 0.1028356402396213, -0.1028256927687803,
-       2.173968376987545e-06},
-      {0.03950813776855264, 0.03950905700327133, -0.02585109168688882, 0,
-       -0.04968784911094556, -0.04968709020554875, -0.01655499510776396,
-       -0.01654476407543968, -0.02196339183711379, -0.02197841557084845,
-       0.01571046390715405},
-      {-0.1239916622155602, -0.1239909134891206, -0.1021124496914955, 0,
-       0.06867496549890556, 0.0686835173126209, 0.1223792841653473,
-       0.1224225025501689, -0.101702697038645, -0.1016890100456288,
-       0.1834091076698336},
-      {-0.003816766945848655, -0.003802101646674355, 0.03153007225765119, 0,
-       0.09091500254733501, 0.09092081134173198, 0.0375905648801105,
-       0.03759675510724183, -0.08247724832722284, -0.08249896056015676,
-       -0.1178511604228905},
-      {-0.1383296270681458, -0.1383257517083955, 0.1371438621546663, 0,
-       -0.04960980651521458, -0.04962159720914855, -0.01031774428225553,
-       -0.01036630399468377, 0.01490598453296584, 0.01494236081242179,
-       0.0509165405732427},
-      {-0.001700991810463474, 0.001703326620911814, 7.764725515023372e-05, 0,
-       0.001473894322794926, -0.001407201074464829, 0.02554130998090073,
-       -0.02549248294637899, 0.009886505645623838, -0.009931562045880476,
-       6.691244324817917e-06},
-      {-0.02449092963547788, 0.02449794070671733, -1.396234191327123e-05, 0,
-       0.03466978590507441, -0.03468181880624065, 0.08487613901132483,
-       -0.08487095011792417, -0.0858196281758333, 0.08582275089278811,
-       -7.525910282803577e-06},
-      {-0.1305546948917367, 0.1305265882281199, -4.080108218621278e-05, 0,
-       0.03712182239709835, -0.03713838763831204, 0.1020740947110325,
-       -0.1020864384175526, -0.0361535465556173, 0.03614575321701885,
-       1.887828670656211e-05},
-      {0.03318585765485356, -0.03317170901616879, 5.778675173527731e-06, 0,
-       -0.01533648640262589, 0.01530753757599962, -0.04348451525120851,
-       0.04347930733894228, -0.04329400515708921, 0.04329119023037152,
-       -1.026148600691253e-05},
-      {0.1020333196338463, 0.1020217122529316, 0.06301998348031534, 0,
-       0.06713667450991241, 0.06714046727099308, -0.03033326683594009,
-       -0.03036285608285495, -0.07885587757622234, -0.07885241278339153,
-       -0.06934076249901731},
-      {0.03951350784429666, 0.03949368289648853, -0.04293617784955551, 0,
-       0.06622376123030099, 0.06621360702846424, -0.01625914836500271,
-       -0.01627283967213463, -0.01107270928841664, -0.01105210140442556,
-       0.01235612792295229},
-      {0.009714210238157956, 0.009690625207039706, -0.09702691891677909, 0,
-       0.06256685641679463, 0.06258634353055262, 0.007959652382153945,
-       0.008006898025752199, -0.02679004436388772, -0.02677854084056308,
-       0.01335090918065808},
-      {0.009947611530178735, 0.009987962225888039, 0.03332283014139732, 0,
-       -0.009377391503039177, -0.009379083367222889, -0.01476849541925502,
-       -0.01478922463206194, 0.01982424649048567, 0.01984163755723134,
-       -0.04317256968314771},
-      {-0.08138675441664024, -0.08137847000235635, 0.1358145743406962, 0,
-       -0.0183892022914231, -0.01837795878099501, 0.005333186290478845,
-       0.005298471256920578, 0.006301375000613864, 0.006302158255882671,
-       0.02586365453993508}};
-  gains["A4"]["3+7+0"] = {
-      {0.1123604110589052, 0.1226151677203144, 0.1226227271688621,
-       0.1303363076725634, 0.13033317033403, 0.1826700321984619,
-       0.1826638710807236, 0.1867545157161114, 0.1867472901885966,
-       0.2074448841670024, 0, 0},
-      {4.898380137886894e-06, 0.1385443536978279, -0.1385526731108761,
-       0.1454975389383767, -0.1454743163296732, 0.3443968625679994,
-       -0.3443909020622156, 0.1564353507675408, -0.1564209130096965,
-       -8.952546986881955e-06, 0, 0},
-      {-0.1313416508506257, -0.177521595359358, -0.177546540550275,
-       0.248218470995083, 0.248228508603257, -0.1300337468811398,
-       -0.1300311819262636, -0.2054600858683804, -0.2054494974859075,
-       0.4085390383380552, 0, 0},
-      {0.1969582800963986, 0.1629523878260165, 0.1629528145113696,
-       0.1445715104024297, 0.1445616948294321, 0.00110371350510004,
-       0.001098782561119352, -0.306192655253276, -0.3061899107585034,
-       -0.1937594417284194, 0, 0},
-      {7.339458192207837e-06, 0.2325742272310514, -0.2325793567553668,
-       0.1247900228491535, -0.1247464856555062, 0.001698211406972387,
-       -0.001699389131457096, -0.2514520364973284, 0.2514375236649317,
-       -9.02938731802151e-06, 0, 0},
-      {-2.066558965896511e-05, -0.1053306872825827, 0.1053352474974022,
-       0.2224404160856463, -0.2224248904290061, -0.05907695412853126,
-       0.05908308269667903, -0.09484393897793704, 0.09484543946640228,
-       -3.362941931181731e-07, 0, 0},
-      {0.03067491686237517, 0.03641385808053609, 0.03645143249519679,
-       0.126651238554003, 0.1266759479718327, -0.009544746867233191,
-       -0.00956448215379215, -0.02481010061295243, -0.02481967765634472,
-       0.2390437252525104, 0, 0},
-      {-0.07185334015916113, -0.1296853052322763, -0.1297087230074764,
-       0.2093783659964527, 0.2093930696423178, -0.06212841053186783,
-       -0.06211141864603211, 0.1547901083309578, 0.1547817409644094,
-       -0.2825926175783955, 0, 0},
-      {0.2297359134462018, 0.03283544215749199, 0.03282072645358541,
-       0.01032093970354011, 0.01030525298408521, -0.3346890135365859,
-       -0.3346984384043236, 0.1747714945493574, 0.1747887360226516,
-       -0.002736527887211316, 0, 0},
-      {4.896239360134794e-06, 0.1801914958899988, -0.1801820985773293,
-       0.03779884780090727, -0.03774762090260381, -0.2307209897453485,
-       0.230742599079259, 0.1695471438707618, -0.1695616429226805,
-       2.78827249017454e-05, 0, 0},
-      {-3.805732956613696e-05, -0.1601347704159805, 0.160139732654042,
-       0.1570333002745472, -0.1570075971044731, -0.09775926105046927,
-       0.09773445446752813, 0.1184965115808888, -0.1184933608758913,
-       -1.303848571669006e-05, 0, 0},
-      {2.516627942914349e-05, -0.03261643519584018, 0.03259987787197341,
-       0.1380990682759398, -0.1381101705117045, -0.0483798345377912,
-       0.04843011415318921, -0.03855562730039249, 0.03852610132185518,
-       1.751891212710723e-05, 0, 0},
-      {-0.08325641529686349, -0.009841137533167213, -0.009879880295062392,
-       -0.03829946365365227, -0.03830185591549119, -0.1010823711364894,
-       -0.1010827294069715, -0.01730595456266561, -0.01729615822665292,
-       -0.02622252473020113, 0, 0},
-      {-0.05971689133197989, -0.02952897171438336, -0.02950297508082125,
-       0.1012649957691045, 0.1012934692430696, -0.01430834873714701,
-       -0.01436114433666787, 0.07943314928751199, 0.07945031634235626,
-       -0.1373808289035617, 0, 0},
-      {-0.06573899096182444, -0.02266215221890921, -0.02269703325939491,
-       0.01419822212527038, 0.01419438666552088, 0.07257393442121668,
-       0.0725842588849528, -0.04407445255089836, -0.04407287130253839,
-       -0.00559223826103615, 0, 0},
-      {0.2348986978686016, -0.1056841048641525, -0.1057128691659911,
-       -0.02987504057026472, -0.02988474154029, -0.004562257954305448,
-       -0.004552820766536503, -0.002885745210445999, -0.00289359203411013,
-       0.03966814370106572, 0, 0},
-      {1.162237139287338e-05, 0.05731464624119724, -0.05726478766179363,
-       -0.002698591113857177, 0.002760654406607841, -0.004769640674724171,
-       0.004740948405141533, -0.01742592192617912, 0.01744806949858832,
-       -4.23574696056098e-05, 0, 0},
-      {-4.013652978638745e-05, -0.1122910473744159, 0.112330479206231,
-       0.03882549206345784, -0.03880391340821208, 0.06884626214103888,
-       -0.06882743927979089, -0.03042821328424646, 0.03043102838621134,
-       5.348076997016931e-06, 0, 0},
-      {4.14857074603169e-05, -0.01183962201012711, 0.01182703320444324,
-       0.05310809939065447, -0.05312609580604974, -0.0426927104638186,
-       0.04273278682022898, 0.01095406238101881, -0.01093931894063078,
-       -2.458649755246717e-06, 0, 0},
-      {-1.652390253964234e-05, 0.03287562285887067, -0.03283880576653393,
-       0.009366155298474293, -0.009374170575931033, -0.04974638686094934,
-       0.04974848811646589, 0.01239104393364177, -0.01237023557369494,
-       1.373104582072606e-05, 0, 0},
-      {0.06431317636992831, 0.06571143022331309, 0.06575218642395238,
-       -0.05583703639501474, -0.05585988159211741, 0.01428727639761995,
-       0.014315878427945, 0.0704724651011573, 0.07043625351100907,
-       -0.09130250135195447, 0, 0},
-      {-0.03978196724434644, 0.03556489713708874, 0.03555500075648275,
-       -0.04532478909595429, -0.04534429896584523, 0.01585742507285647,
-       0.01588398793672761, 0.005494081597965651, 0.005492169414919967,
-       0.06778354357886072, 0, 0},
-      {-0.03113699019777703, -0.006771674969827003, -0.006763829644558271,
-       0.006615100526839154, 0.006611970689073472, -0.02005100570140637,
-       -0.02002862361492016, -0.005702419366895396, -0.005732680846314402,
-       -0.006979851623084773, 0, 0},
-      {-0.07907279038863116, 0.05380232792356915, 0.05376186473130709,
-       -0.02821061832295214, -0.02820181411137643, 0.08345926614593134,
-       0.0834638609017798, -0.05095629601582578, -0.05095912042921961,
-       0.04157369810876777, 0, 0},
-      {0.2036015126271508, -0.1453689621957212, -0.1453853649145353,
-       -0.000483087754422467, -0.0004999256650668462, 0.1056192080169197,
-       0.1056321017128684, -0.04297089056526018, -0.04299877730021609,
-       0.002751182885788377, 0, 0}};
-  gains["A4"]["4+9+0"] = {
-      {0.1067436492781124, 0.1067588170942154, 0.08179979954561375, 0,
-       0.1551159289430734, 0.1551172743434167, 0.1826102180673083,
-       0.1825971722053472, 0.1446250022046494, 0.144614702234965,
-       0.1448187179696745, 0.1448218633244734, 0.0629316391364225,
-       0.0629058203966272},
-      {0.1309105810939922, -0.1309330040839264, -7.300361393441891e-06, 0,
-       0.2954767558797013, -0.2954835988689154, 0.1503475709776512,
-       -0.1503269644235321, 0.1413964341749532, -0.1413683763034932,
-       0.1352635758277781, -0.1352779760590111, 0.02131850007519258,
-       -0.0212805001758174},
-      {-0.1577552480661801, -0.1577573868437445, -0.09686507036869996, 0,
-       -0.1675653864439873, -0.1675524749221826, -0.2058900063759927,
-       -0.2058856384782307, 0.2787298807950395, 0.2787278846405402,
-       0.27935745536915, 0.2793559873023966, -0.11459395064769,
-       -0.1146033300233657},
-      {0.129947270161922, 0.1299709351986355, 0.1289101664962917, 0,
-       0.026798948695138, 0.0267777051660777, -0.30373793924856,
-       -0.3037253730124654, 0.1417454150870625, 0.1417396370351376,
-       -0.1419678089748937, -0.1419658444151368, 0.07459765598066893,
-       0.07453297955422995},
-      {0.2113651305880359, -0.2114004370543397, -1.269234756425315e-05, 0,
-       0.04617096787747727, -0.04613414122660273, -0.237135896027697,
-       0.2371218212270773, 0.1306033005463414, -0.1305682291467473,
-       -0.1152716482405122, 0.115265468152264, 0.05238293614430179,
-       -0.0523086684559857},
-      {-0.1014699272910045, 0.1014557385443124, -1.932424912339137e-05, 0,
-       -0.1448407997875103, 0.1448187375935985, -0.1070691799559068,
-       0.1070737208845072, 0.2015003865317472, -0.2014782363418891,
-       0.1964920728682123, -0.1964944833770133, -0.0133766847166402,
-       0.01336471134591492},
-      {0.03909395265727719, 0.03910250560388594, 0.04628566787617318, 0,
-       -0.01872571869732903, -0.01875110763205228, -0.03346996227757496,
-       -0.03346710393523553, 0.1501519931855257, 0.1501758664794146,
-       0.1504819302758822, 0.1504690414340726, 0.07705061613719544,
-       0.07708344978584102},
-      {-0.1046636241474173, -0.1046492488675115, -0.01808106133779947, 0,
-       -0.02493434285997004, -0.02492962939717713, 0.1711654612399493,
-       0.1711670621641477, 0.2016576622644617, 0.2016831035531091,
-       -0.2030135501707211, -0.2030169413248334, -0.06176996472592895,
-       -0.06178287085309517},
-      {-0.006753698042924442, -0.006752083278649186, 0.1555340407917483, 0,
-       -0.304935748226014, -0.3049410699194062, 0.1732446110022869,
-       0.1732694495775594, 0.0006261029123247919, 0.0006088724862121873,
-       0.0002981635345306351, 0.0002713008328824824, 0.07763802207381247,
-       0.07758578428059601},
-      {0.1424825065412975, -0.1425101956632665, -1.17592901690777e-05, 0,
-       -0.2298158015897505, 0.2298073436666246, 0.1503183856272235,
-       -0.15034019646126, 0.02933016014303974, -0.02927373500049988,
-       0.005888785865729444, -0.005859018322376044, 0.08295814066062794,
-       -0.08287199095562212},
-      {-0.1489522420638671, 0.1489094140737087, -4.327544258469129e-05, 0,
-       -0.03310568275995274, 0.03311540426312987, 0.1434345487682046,
-       -0.1434459126520634, 0.1709922003766753, -0.1709728661005573,
-       -0.1578304209144621, 0.1578160443857594, -0.03084935329128529,
-       0.03084953336204551},
-      {-0.02899758172703261, 0.02898606556718919, 5.437228618188735e-06, 0,
-       -0.0863617898686448, 0.08640953890663919, -0.03522112835395005,
-       0.03520137113960609, 0.08986518370720149, -0.08987735837323489,
-       0.09448211612754652, -0.09445770764196779, -0.006882642108500149,
-       0.006931298100591832},
-      {-0.01371964113378637, -0.01378221455692954, -0.1016478182442791, 0,
-       -0.03476308761716179, -0.03477713975144505, 0.003246483607067298,
-       0.003283325795353323, -0.0321707692219836, -0.03216136431799833,
-       -0.03346637873500889, -0.03347449553593612, -0.05477672037895531,
-       -0.05475472020757376},
-      {-0.02082153528550457, -0.02081465105684617, -0.04347878393308765, 0,
-       0.002827150761375944, 0.002791991621201526, 0.08188037773283845,
-       0.08188482595158052, 0.08943366698793523, 0.08947786506361945,
-       -0.09093785329372681, -0.09095663704341156, -0.009650679950202305,
-       -0.00965682017913058},
-      {0.007290466433003603, 0.007290713738087927, -0.007256426004772428, 0,
-       0.1296192558940084, 0.1296251949824959, -0.0552031596533463,
-       -0.05518984043820516, 0.0003340750453516179, 0.0003387432572048992,
-       0.001334503462388695, 0.001326494344852418, -0.05769408370288343,
-       -0.05771938906481075},
-      {-0.1440437291755738, -0.1440734153118214, 0.1721801190499561, 0,
-       -0.04474581294972851, -0.04471241547868685, -0.00291893961288979,
-       -0.002954605170200503, -0.02803254876255252, -0.02807536751371461,
-       0.02845997323380779, 0.02847431591080143, 0.0712295569648972,
-       0.07120501390639383},
-      {0.005183921173445661, -0.005166305513354875, 7.585090127585083e-06, 0,
-       -0.02447536774197962, 0.02445830910111417, 0.0007159037613538407,
-       -0.0006728544135932543, 0.0009493860001642206, -0.0008644623592217334,
-       0.02572040089300816, -0.02576864822704373, 0.1056496957839705,
-       -0.1055574182979886},
-      {-0.09105605284906766, 0.09102838533096673, -4.838988131591893e-05, 0,
-       0.08123836338863229, -0.08126575074961484, -0.05930850781381035,
-       0.05928898974395878, 0.02617393066196081, -0.0261418393609298,
-       0.004998030457542465, -0.004997057517335301, -0.04855202199597742,
-       0.04857716758926},
-      {-0.00802199043342592, 0.008017305186622194, -1.063523217027803e-06, 0,
-       -0.0004752794453399921, 0.0005335250066670434, 0.01155179304007023,
-       -0.01152622559346053, 0.07646176698704121, -0.07647239513916217,
-       -0.08308106458124725, 0.08306777454867154, -0.00583259687795313,
-       0.005921200282692536},
-      {0.03189637426056129, -0.03182469007793468, 1.120314356029361e-05, 0,
-       -0.01362568027069613, 0.01361971679979899, 0.02555281991889026,
-       -0.0255542591642433, -0.05593368155037827, 0.05591223250030925,
-       -0.04716554406630459, 0.04718437266414582, 0.002395895815042902,
-       -0.002487825626541136},
-      {0.05726760849426569, 0.05728151102822529, 0.05193239330348666, 0,
-       0.07065962600183888, 0.07069325462863649, 0.07474179734420969,
-       0.07470946016557367, -0.05946948520251363, -0.05948203136252837,
-       -0.06152593486512655, -0.06152401558860759, 0.04675914492456439,
-       0.04682221979665322},
-      {0.02621241849136637, 0.02614565027396455, -0.05966350227561072, 0,
-       0.0002944626531748033, 0.0003622922591942466, -0.004321688378867303,
-       -0.004360807694597959, -0.05630590291269544, -0.05631292929099661,
-       0.05762446343983354, 0.05759656782411302, 0.01478886449306507,
-       0.01488154683610292},
-      {-0.004843612540606624, -0.004850836743527341, -0.02864736690545277, 0,
-       0.01727969708339139, 0.01727460493320176, -0.01134953019486973,
-       -0.01136705165324818, -0.0005392161630838837, -0.0005166340672913927,
-       0.00145601036705055, 0.001479684452590578, -0.006323637477637164,
-       -0.006310824264533832},
-      {0.0864102934168704, 0.08638368321116917, -0.02258331288473157, 0,
-       0.02631463089562277, 0.02635347280775973, -0.04966096783714154,
-       -0.04970048137355766, -0.02538880001753369, -0.0254222007672872,
-       0.02512091882415539, 0.02510670652627169, -0.06510379136450765,
-       -0.06512579236117971},
-      {-0.172814457395148, -0.1728483467183413, 0.1672984876747167, 0,
-       0.1221345014399925, 0.1221194462662331, -0.04173497092499592,
-       -0.04173413368135852, 0.005629750970923235, 0.00560944606539949,
-       0.006116801469293687, 0.006115492482099587, 0.04356962501392034,
-       0.04356949911352052}};
-  gains["A4"]["9+10+3"] = {{0.03823210282048346, 0.03823477819232632,
-                            0.02292488296892596, 0,
-                            0.1363195444608907,  0.1363179545825965,
-                            0.03879732596979741, 0.0387989461769478,
-                            0.1363178823346838,  0,
-                            0.124509620027289,   0.1245128034893679,
-                            0.0516090105158786,  0.05159543828508154,
-                            0.05776512470800611, 0.1268024568256103,
-                            0.05628103094771569, 0.05627091643220374,
-                            0.05701791680037214, 0.05701893148746988,
-                            0.05627444461189659, 0.09345551434412917,
-                            0.08729256621321124, 0.0872838191617533},
-                           {0.09665077154906419,    -0.09665365469767941,
-                            1.20731773442431e-05,   0,
-                            0.172260335722428,      -0.1722657355431371,
-                            0.05093454631346386,    -0.05093718347308386,
-                            -9.041363016077392e-06, 0,
-                            0.2124797465660029,     -0.2124965928513465,
-                            0.08111157681883598,    -0.08110564102084039,
-                            1.120424181734717e-05,  1.452679300065655e-05,
-                            0.08918274250765471,    -0.08917485259243114,
-                            0.1285011095351327,     -0.1285016001498655,
-                            7.28427902371139e-06,   -5.026509173806921e-06,
-                            0.07708303681030972,    -0.07706688881700441},
-                           {0.0002989057264425856,  0.0002880048949267783,
-                            -2.102714415738882e-05, 0,
-                            -0.174459197306348,     -0.1744459659930661,
-                            2.572226071681931e-06,  1.380655025897573e-05,
-                            -0.174440125888425,     0,
-                            -0.1780224965310851,    -0.1780134729131291,
-                            0.08788581760736663,    0.08786185120377016,
-                            0.09270859799790881,    0.321410131434827,
-                            0.09184726065170819,    0.0918217554565022,
-                            0.09227195120137768,    0.09227156836169463,
-                            0.09183096862387419,    -0.1839140457891339,
-                            -0.1790620900070751,    -0.1790742701548452},
-                           {0.05062370554832916,    0.05063413390693076,
-                            0.06678018315720176,    0,
-                            -0.1722621024871397,    -0.1722661301431688,
-                            0.09828453529834233,    0.09828460730645903,
-                            -0.2436203449008339,    0,
-                            -0.01356110302122599,   -0.01355974459573535,
-                            0.08112067513646708,    0.08109584704432808,
-                            0.1308842396209364,     -5.908230105904188e-06,
-                            -0.08919395888373484,   -0.0891886469772124,
-                            -6.644146115996523e-05, -7.059039708591902e-05,
-                            -0.1261249843748181,    0.1251930055680179,
-                            0.07710116338989557,    0.07706834829453839},
-                           {0.1179731149925308,     -0.1179891515283385,
-                            3.129721709467359e-05,  0,
-                            -0.2693719381811585,    0.2693753332303967,
-                            0.1188407966375405,     -0.1188412092047162,
-                            8.165935559244452e-06,  0,
-                            -0.03362570847894904,   0.03361202870654473,
-                            0.1187240703535395,     -0.118709487189775,
-                            1.904654740772813e-05,  5.380999066034464e-06,
-                            -0.1272524827619931,    0.1272521917453116,
-                            0.0002841251778859902,  -0.0002729725670637376,
-                            -1.313014963564801e-05, -6.3837154665182e-06,
-                            0.1142637427774075,     -0.1142188188348765},
-                           {0.000821751547042673,   -0.0008008289711345396,
-                            -6.891709449555932e-07, 0,
-                            -0.103667973720996,     0.1036684371185857,
-                            -2.604919141811246e-06, -1.185454034246532e-05,
-                            3.297640384536888e-06,  0,
-                            -0.1558584055517047,    0.1558519784334124,
-                            0.1214675615911321,     -0.121448105611989,
-                            1.841048892496206e-05,  2.595660654856252e-05,
-                            0.1279760038104183,     -0.1279474405992879,
-                            0.1823817836422306,     -0.1823705806512157,
-                            1.251143621129956e-05,  6.999155938184568e-06,
-                            -0.1127865395715281,    0.1127927511646833},
-                           {-0.08026507128158301, -0.08027799624319994,
-                            -0.05243645956612171, 0,
-                            0.01655686868486402,  0.01654207701531675,
-                            -0.08153751665352146, -0.08152984834373733,
-                            0.01654647681429528,  0,
-                            0.04116964363079337,  0.0411495853370632,
-                            0.01392161010441098,  0.013908645209311,
-                            0.002241223628958742, 0.3733772929270274,
-                            0.005440414937535238, 0.005410621984768373,
-                            0.003839300589938719, 0.003839563184483447,
-                            0.005425687053960665, 0.1105116239319767,
-                            0.1221254052615034,   0.1221895509812613},
-                           {0.0001470433880190757,  0.0001313619385131432,
-                            -5.439316702625464e-05, 0,
-                            0.1036591067539999,     0.103646301196483,
-                            6.621151161714635e-06,  3.008756082238878e-05,
-                            0.1465792449971335,     0,
-                            -0.002695697162410267,  -0.002686740006926368,
-                            0.1214753233510208,     0.1214610992262887,
-                            0.1837674482011896,     -7.050271944397974e-06,
-                            -0.1279803451555044,    -0.1279809554149095,
-                            -0.0001641791670267622, -0.0001623702386424741,
-                            -0.180972497420237,     -0.1715081904385126,
-                            -0.1128072306056084,    -0.1127990520448503},
-                           {-0.08142577933998399,   -0.08141086111376636,
-                            0.09082956348683063,    0,
-                            -1.101800593053779e-06, 7.469996714094643e-06,
-                            0.08359879224749796,    0.08359007697442895,
-                            0.269381618240647,      0,
-                            -0.2382498174644657,    -0.2382609353079846,
-                            1.592770009987203e-05,  -2.736300926078357e-05,
-                            0.1352255140550254,     1.785528919298898e-06,
-                            1.888037795506755e-05,  1.132130475369056e-05,
-                            -0.1312353814556686,    -0.1312413393035063,
-                            0.1272560440931704,     0.1307759897254104,
-                            2.006514594860811e-05,  4.736340090203372e-07},
-                           {-0.01881607904198624,   0.01878052782814953,
-                            5.053451380850548e-05,  0,
-                            0.1660870844882535,     -0.1660933548235993,
-                            0.1595718912939753,     -0.1595599663021175,
-                            -5.527483804301651e-06, 0,
-                            -0.2175129743473301,    0.2175274279260965,
-                            0.07354058593213211,    -0.07348156507320348,
-                            1.95031776502148e-05,   -1.028901761730554e-05,
-                            0.07266692146812752,    -0.07265561436724573,
-                            -0.1083956127051377,    0.1083975480926701,
-                            1.767981412269139e-05,  2.501912890070488e-06,
-                            0.0715732289418506,     -0.0715113603634228},
-                           {0.0004342977194900121,  -0.0004005248235218846,
-                            -1.969787461659893e-06, 0,
-                            0.1461423374493725,     -0.1461229450080104,
-                            -6.415478267759876e-06, -2.151795894561911e-05,
-                            1.449145326127919e-05,  0,
-                            -0.007512777893718041,  0.00750656671958732,
-                            0.1764421918286514,     -0.1764417536083895,
-                            2.837331928133377e-05,  8.922301497010977e-06,
-                            -0.1838111577178265,    0.1838114629517416,
-                            -9.036220636732641e-05, 8.624243752522699e-05,
-                            -1.749347376572233e-05, 1.375928067250205e-05,
-                            -0.1662815243418457,    0.1662701062229265},
-                           {-0.1017492165518994,    0.1017651498180887,
-                            -1.336891727805302e-05, 0,
-                            -0.05142781325520159,   0.05142331981418334,
-                            -0.05524841702388382,   0.05524531748145852,
-                            -1.201611218692818e-05, 0,
-                            -0.04030650382154461,   0.04033040740674802,
-                            0.06503341805131382,    -0.06499948669293619,
-                            1.55108987056255e-05,   2.190623687473942e-05,
-                            0.05866342289060696,    -0.05862098395880899,
-                            0.08045957729337808,    -0.0804274796412843,
-                            1.605613313822981e-05,  3.411707620434772e-06,
-                            0.05447776388987324,    -0.05452743034829896},
-                           {-0.0009505121052813532, -0.0009326043364807122,
-                            5.104545047355418e-05,  0,
-                            -0.02749673241566609,   -0.0274890171971762,
-                            -3.066768552911889e-06, -3.318120271923613e-05,
-                            -0.02750835155107353,   0,
-                            -0.01737409962558105,   -0.0173830243310865,
-                            -0.07159138993551928,   -0.07159889312273481,
-                            -0.08557472276811796,   0.2795914730105825,
-                            -0.08284936438663229,   -0.08287461799533731,
-                            -0.08423061401334682,   -0.08420468231202415,
-                            -0.0828517398376602,    -0.0001500752749108316,
-                            -0.01403420403574973,   -0.01409450922912179},
-                           {-0.05484962413511664,   -0.05487632312584955,
-                            -0.08211738070932222,   0,
-                            0.05143196579786633,    0.0514424213136709,
-                            -0.1036890243857546,    -0.1036625999030897,
-                            0.07272635337901318,    0,
-                            0.01460351181426018,    0.01458576582332607,
-                            0.06502996672355342,    0.06505512187278327,
-                            0.0779212862450837,     3.545807307274616e-06,
-                            -0.05864563273463658,   -0.0586557911451106,
-                            -6.534471583667823e-05, -5.708704037655006e-05,
-                            -0.08293545194900269,   0.06303554892954188,
-                            0.05447788589848086,    0.05452850455724099},
-                           {-0.001176632968683588,  -0.001167834788531562,
-                            -7.508711963724248e-05, 0,
-                            2.046469959619307e-05,  2.167466529250052e-05,
-                            1.124631203202514e-05,  2.314004083791536e-05,
-                            -0.1461132090563752,    0,
-                            0.1579179542676681,     0.1579066443281886,
-                            1.30104809658279e-05,   -6.44534595592918e-08,
-                            0.1892351190633662,     5.211074824303143e-06,
-                            1.091466901681311e-05,  3.788850932294967e-05,
-                            -0.1865230415310783,    -0.1865341993921229,
-                            0.1838114938267217,     -0.1790834169340256,
-                            -1.763075271088742e-05, -1.25257035796414e-05},
-                           {-0.1579982269412787,   -0.1579971086948339,
-                            0.1060284788855187,    0,
-                            0.1660787704364424,    0.1660786993450047,
-                            0.02124210349219162,   0.02122632005571902,
-                            -0.2348966448793808,   0,
-                            0.05046594413816482,   0.05044286249964257,
-                            -0.0735047997570269,   -0.07355239069466986,
-                            0.1140298101045362,    -9.374275255632695e-06,
-                            0.0726348633184359,    0.07265581042704353,
-                            -0.001645073360299591, -0.001626433373856112,
-                            -0.1027577942257011,   0.1112808160459328,
-                            -0.0715258509073568,   -0.07152181023383679},
-                           {-0.1471999653599927,    0.1471655073779819,
-                            6.313490902575946e-05,  0,
-                            -4.745284637287271e-06, 1.217026844928918e-05,
-                            0.1495272839660832,     -0.1494980905861834,
-                            6.021729699676263e-06,  0,
-                            0.0567815575884362,     -0.05674420751709491,
-                            3.146416480075032e-05,  6.508062343129738e-05,
-                            1.772074104258577e-05,  3.411200911392786e-06,
-                            -1.705946283291265e-05, -1.821910285580304e-05,
-                            -0.004170522654583586,  0.004145825859231106,
-                            -2.460970620950669e-05, 9.316193398174896e-06,
-                            3.029403206184494e-05,  2.053614090579184e-05},
-                           {-0.001435260168408518,  0.001451474920995584,
-                            -2.939706829499813e-06, 0,
-                            -0.08347527086875761,   0.08345175553836112,
-                            -8.436938036969752e-06, -1.217317543367851e-05,
-                            -2.290011042531959e-05, 0,
-                            0.1296689371482818,     -0.1296862897051884,
-                            0.1077223283735235,     -0.1077128153569085,
-                            1.859002813648809e-05,  -1.85503433841666e-05,
-                            0.1069911850089749,     -0.1070157712709645,
-                            -0.1556882638653323,    0.1557164512710874,
-                            9.871323396646094e-06,  8.298710831576166e-06,
-                            -0.1029645138056101,    0.1029360003092854},
-                           {-0.09115015398808984,   0.09119478511939931,
-                            -2.468954411227046e-05, 0,
-                            0.02410052107281044,    -0.0241098672015466,
-                            -0.09199660339768155,   0.09198164736824258,
-                            7.288971154556309e-06,  0,
-                            0.02589655962907238,    -0.02588834066412029,
-                            0.1182584040807958,     -0.1182805683202678,
-                            2.814537303548743e-05,  6.402724666169303e-06,
-                            -0.1143929810727386,    0.1143969970761103,
-                            -0.000511820040742381,  0.0004935764626349579,
-                            -2.718118781330343e-05, -3.28287136845096e-06,
-                            0.1039135447439871,     -0.1039679547764721},
-                           {-0.001769455222205528, 0.001760133014516096,
-                            3.14936204205116e-06,  0,
-                            0.01226718289379625,   -0.01225797345974758,
-                            7.296870357308185e-06, 2.098831412689642e-05,
-                            3.004284314782851e-05, 0,
-                            0.03415893988974503,   -0.03414091285531259,
-                            -0.02164652532457464,  0.02167838258705325,
-                            5.633267722453271e-06, 6.643564432385106e-06,
-                            -0.03349853107578322,  0.03352495364253879,
-                            -0.05019174075763851,  0.05021590493738465,
-                            1.628034250910981e-05, -2.047314563734292e-05,
-                            0.0295127130892968,    -0.02946744752759814},
-                           {0.0693101448671703,   0.06934109953957814,
-                            0.05729977513088362,  0,
-                            0.06971614474051291,  0.06969043446396303,
-                            0.07061495309236297,  0.07058425048820063,
-                            0.06969664566523706,  0,
-                            0.04904726014318935,  0.04904999545097039,
-                            -0.07110046764385709, -0.07111558060733092,
-                            -0.06479578853302889, 0.111984181110227,
-                            -0.06758562247009578, -0.06760757155016431,
-                            -0.06624477856805051, -0.0661641201820527,
-                            -0.06758254734866895, -0.02243002390900841,
-                            -0.02883047947414198, -0.02881808033600779},
-                           {-0.0003243814881210656, -0.0003074042346021207,
-                            7.685090541746444e-05,  0,
-                            -0.01225517578987187,   -0.01226458296609336,
-                            -2.349790708560969e-06, -4.007479455047275e-05,
-                            -0.01730459619208279,   0,
-                            0.004912720806504982,   0.004940027459897476,
-                            -0.02165136025167383,   -0.02161996543708264,
-                            -0.05302591832660431,   2.067682138896096e-05,
-                            0.03352390101629833,    0.03352038973759733,
-                            0.0002729187748976852,  0.000271808972828073,
-                            0.04738645749914762,    0.06407346265601563,
-                            0.02952708888237025,    0.02948911134511787},
-                           {0.05805360648137974,    0.05803883900336139,
-                            -0.08499523803056933,   0,
-                            -1.119839641380919e-05, -1.068917822440532e-05,
-                            -0.05995021788497781,   -0.05991025779204648,
-                            -0.02409689416041625,   0,
-                            0.001874078398171003,   0.001900912910869614,
-                            -3.997636979973531e-06, 5.841721636757549e-05,
-                            0.1089433456273458,     9.714004175243273e-06,
-                            -1.258790506678577e-05, 4.852323897588597e-05,
-                            -0.1116772413725262,    -0.1116816892320618,
-                            0.1143932153070106,     0.09460085829731524,
-                            -6.33624725172247e-06,  1.205464809915298e-05},
-                           {-0.000837557917019586,  -0.0007982742801704139,
-                            -9.026937298775722e-05, 0,
-                            -0.08349157169292117,   -0.08348711064295238,
-                            1.696006997530147e-05,  7.997203001272921e-06,
-                            0.1180477601948648,     0,
-                            0.01342010433849352,    0.01339413577209284,
-                            -0.1076932745691289,    -0.1077375442778005,
-                            0.1600805598855531,     -1.731948431970422e-05,
-                            0.1069761284412267,     0.1069754591711661,
-                            -0.00086267452442376,   -0.0008676519223302055,
-                            -0.1513162857911967,    -0.1533838892590718,
-                            0.1029173231901619,     0.1029166624662674},
-                           {-0.05678567593879785, -0.05681895653799814,
-                            0.1127034281458242,   0,
-                            -0.1629362987163995,  -0.1629476166637533,
-                            -0.05440139038490015, -0.05441275192939162,
-                            0.162973005457462,    0,
-                            0.1678707648708007,   0.1678703709690277,
-                            -0.08128061254922057, -0.0812704243711071,
-                            0.0801485478268245,   2.593688779903501e-05,
-                            -0.06702440868565651, -0.06703347618531502,
-                            0.07361268414637329,  0.0736016214659572,
-                            0.06704292670170908,  0.07882856398411162,
-                            -0.07987840021045034, -0.07985766070126338}};
-  gains["A4"]["0+7+0"] = {
-      {0.2102367564611581, 0.210239237077834, 0.1637423946321554, 0,
-       0.2330936985805596, 0.2330880400010537, 0.2841970438291144,
-       0.2841849255301637},
-      {0.2112737343392371, -0.2112711412716111, 1.095507934440625e-05, 0,
-       0.3693241706354859, -0.3693200348128958, 0.2178074572447251,
-       -0.2177988182986346},
-      {2.898399698649118e-05, -7.705571824358431e-06, -3.61019833989049e-05, 0,
-       -1.539889314838639e-05, -2.511191633846241e-07, -6.767575351389014e-06,
-       -1.424789850735237e-05},
-      {0.25196560888146, 0.2519737335861483, 0.226865128276472, 0,
-       0.04181081716683226, 0.04179421291561467, -0.3990638376181537,
-       -0.3990614747270843},
-      {0.339957782512892, -0.3399544944153869, 3.261000161264469e-05, 0,
-       0.06716456327791129, -0.06713333389048258, -0.3216586354784328,
-       0.3216637589599965},
-      {1.884129342522548e-06, 2.175472839752847e-05, -2.173977005323994e-05, 0,
-       -7.521342921629081e-06, -9.212588418755789e-06, -1.170115539756003e-06,
-       2.437998999560933e-05},
-      {0.1507262253347413, 0.1507463539921643, 0.1745003369672339, 0,
-       0.1383649363497552, 0.1383734619087005, 0.1209729850991397,
-       0.1209401027773205},
-      {1.827292674198364e-05, 8.242864819131987e-06, -1.842145122539785e-05, 0,
-       -1.220781391032175e-05, 1.32688256942619e-05, 6.664288199041082e-06,
-       -4.994267901637592e-06},
-      {0.05060153450145487, 0.05062007404113353, 0.256292193983275, 0,
-       -0.3678901949037829, -0.3678986262871552, 0.1906902258465537,
-       0.190701195914938},
-      {0.2513970912378535, -0.2514117418085617, 3.824530219577114e-05, 0,
-       -0.2659767209605834, 0.2660000464943407, 0.1749237276683067,
-       -0.1749260130882927},
-      {1.272815722011642e-05, 4.360944531552953e-06, -1.660408602241427e-05, 0,
-       -5.729799448900157e-07, -3.279347183058862e-06, -1.648442884175388e-06,
-       1.086643052173874e-05},
-      {0.01405483743701603, -0.01405056895203803, 7.221941450682623e-06, 0,
-       0.02402908343461251, -0.02401827207052801, 0.01585659445208495,
-       -0.01582871252918006},
-      {8.419843074160296e-05, 2.584665983703175e-05, -5.010314342397549e-05, 0,
-       -1.372111484314794e-05, 1.105039782929825e-05, 1.994062043468069e-05,
-       1.822369377811707e-05},
-      {0.03042243559540013, 0.03044243399075609, 0.02516772179006282, 0,
-       0.01894478684623017, 0.01894190219280069, -0.02958279856296776,
-       -0.02958444644062709},
-      {1.558064611404887e-05, 3.731592073806326e-05, -4.68584470316108e-06, 0,
-       -2.485255260917319e-06, -8.024800838188553e-07, 1.439554408552222e-05,
-       3.488950113095681e-05},
-      {-0.1376424787982618, -0.1376386422979332, 0.2701152218585089, 0,
-       -0.06201409113597203, -0.06200421249590738, 0.03697901182791546,
-       0.03697887146770887},
-      {0.08221257495634793, -0.08219050466583419, 4.749043164359598e-05, 0,
-       -0.03527264633949773, 0.03531432852569068, 0.03291920975743828,
-       -0.03289613966019328},
-      {2.317393335497538e-05, -2.230633888202588e-05, -7.826079789524247e-06, 0,
-       -3.540900822540009e-06, 1.503170052126439e-05, 2.854156844837816e-05,
-       -2.525111829558184e-05},
-      {0.09007508270971396, -0.09007353019682662, 3.176616777450781e-05, 0,
-       0.01983780741474077, -0.019830375026717, -0.08966532410331335,
-       0.0896519571698446},
-      {4.241821996469003e-05, 1.455267863284847e-05, -3.644503798594053e-05, 0,
-       -1.330003020452332e-05, -7.274186551808596e-06, 3.625809185420835e-05,
-       2.468330518621767e-05},
-      {0.04650599848355349, 0.04654454397148984, 0.06121490256794114, 0,
-       0.03968184116251926, 0.03973967531806956, 0.02105680488372549,
-       0.02100321116925812},
-      {5.541431474213017e-05, 9.074631443556908e-06, -3.605281600785673e-05, 0,
-       -3.696387207495957e-05, 3.789690338419637e-05, 2.309231335969978e-05,
-       -1.563770780787512e-05},
-      {0.001196322418300816, 0.001231817275551292, 0.05288871252044154, 0,
-       -0.1077401337847209, -0.1077488538788036, 0.05803508914742916,
-       0.05806093482607456},
-      {-8.871995342568466e-06, -1.251584757504833e-06, -6.738870244779121e-06,
-       0, -1.134667725289451e-05, -2.627393906624774e-06,
-       -2.643949957551264e-06, -4.395519855671975e-06},
-      {-0.1767870760521144, -0.1768005033030041, 0.2419591694273937, 0,
-       0.1374464389356428, 0.1374496857685961, -0.06155915547599888,
-       -0.06156455182365184}};
-  gains["A4"]["4+7+0"] = {
-      {0.1227392522233813, 0.1227468193219647, 0.1124741179194009, 0,
-       0.156080056143775, 0.1560813881501154, 0.1830650904759321,
-       0.1830521944342445, 0.1422712021347329, 0.1422629271015848,
-       0.1425081775507637, 0.1425112727223439},
-      {0.1386845582712175, -0.1386928861033728, 4.903337216824281e-06, 0,
-       0.2901333895422477, -0.290142342351392, 0.1475866793598385,
-       -0.1475684946633604, 0.1390897095997826, -0.1390625803111411,
-       0.1331054849156494, -0.1331196553953919},
-      {-0.1777012442507094, -0.1777262146857431, -0.1314745664089598, 0,
-       -0.1738190883418949, -0.1738064109808844, -0.2113415189878441,
-       -0.2113370804348439, 0.2742561377405305, 0.2742562860574109,
-       0.2749003886238853, 0.274898943979709},
-      {0.1631172929225302, 0.1631177200396817, 0.1971575985882708, 0,
-       0.02642487921515516, 0.02640405280648556, -0.2982133126059484,
-       -0.298200838468048, 0.1393624540875848, 0.1393620168193715,
-       -0.1397027539777255, -0.1397008207619467},
-      {0.2328095884669301, -0.2328147231822385, 7.34688560139142e-06, 0,
-       0.04536403018013771, -0.04533037598562688, -0.2329790869839503,
-       0.2329623867085918, 0.1284001749172005, -0.1283667465584353,
-       -0.1134325227037846, 0.1134264412170424},
-      {-0.1054372801799554, 0.1054418450096362, -2.068650289075415e-05, 0,
-       -0.1411747213157653, 0.141158437332722, -0.1045790936062076,
-       0.1045886670641451, 0.1982552224504442, -0.1982351628376835,
-       0.1933570991388312, -0.1933594711886671},
-      {0.03645070829710129, 0.03648832073644243, 0.03070595936622075, 0,
-       -0.007437880428489298, -0.007462818836074309, -0.02219490328927572,
-       -0.02219223231805195, 0.147856321405164, 0.1478770254978134,
-       0.1480810349559073, 0.1480683517518107},
-      {-0.1298165445964921, -0.1298399860700899, -0.07192605454004165, 0,
-       -0.0246635854196166, -0.02465918192816696, 0.1669097186264945,
-       0.1669111061158492, 0.1983744062850014, 0.1984045915137206,
-       -0.1997745281725133, -0.1997778652217505},
-      {0.03286867107687323, 0.03285394048091991, 0.2299684023559067, 0,
-       -0.3000195782543059, -0.3000247311714679, 0.1699550263810649,
-       0.1699792791744315, 0.0004975221025548306, 0.0004882331024123466,
-       0.0002934064222758339, 0.00026697230719984},
-      {0.1803738466761217, -0.1803644398535286, 4.901194272641442e-06, 0,
-       -0.2259032072208039, 0.2258924401534492, 0.1478019735119846,
-       -0.1478253113965935, 0.0287005782914919, -0.02864746382556834,
-       0.005794832004296093, -0.005765539393417264},
-      {-0.1602968241307063, 0.1603017913904698, -3.809584294841413e-05, 0,
-       -0.03240890461396283, 0.03242584120319757, 0.1402903606707493,
-       -0.1402937300950092, 0.1681877413727187, -0.1681726066397446,
-       -0.1553122825690243, 0.1552981354136451},
-      {-0.03264944248383183, 0.03263286840422967, 2.519174728385681e-05, 0,
-       -0.08663202253145261, 0.08667072015534827, -0.03561483466761262,
-       0.03558760035054801, 0.08848492467693068, -0.08849849650331368,
-       0.0929746815138619, -0.09295066245855352},
-      {-0.009851096600084621, -0.009889878569008151, -0.08334066939944569, 0,
-       -0.04357173267213496, -0.04358559359096802, -0.005959420948957885,
-       -0.005923094277449202, -0.0315743684547979, -0.03157064361088113,
-       -0.03293243242043091, -0.03294041972016604},
-      {-0.02955885454086704, -0.02953283159914571, -0.05977732382922631, 0,
-       0.002959472718479385, 0.002925312520993523, 0.08257651838355994,
-       0.08258102021280581, 0.08814232553684422, 0.08818234628383913,
-       -0.08948696636011828, -0.08950545042055379},
-      {-0.02268508593868297, -0.02272000227819941, -0.06580551772337667, 0,
-       0.127379896690803, 0.1273855828633583, -0.0531391097318182,
-       -0.05312569467497778, 0.0002626219089980898, 0.0002732943969604176,
-       0.001313211848761301, 0.00130533051436001},
-      {-0.1057910554142186, -0.1058198488250505, 0.2351364114299659, 0,
-       -0.04382412650151869, -0.04379117733844167, -0.002827058366164484,
-       -0.002861983002341034, -0.0276523063048034, -0.02768359040026585,
-       0.0280059026592319, 0.02802001650299616},
-      {0.05737264770650954, -0.05732273867105581, 1.163413303872186e-05, 0,
-       -0.02407947916010715, 0.02406225970624835, 0.0006352309963243791,
-       -0.0005937190995778403, 0.000784145063256938, -0.0007064902006429267,
-       0.02531003939632422, -0.02535751695821323},
-      {-0.1124046840400208, 0.1124441557761914, -4.0177147284582e-05, 0,
-       0.07935004750561055, -0.07936996992790579, -0.05806403721807002,
-       0.05805074508431243, 0.02564473091649785, -0.02561857130158901,
-       0.00491828833891995, -0.004917330921690097},
-      {-0.01185160350997692, 0.01183900196463183, 4.152769030379654e-05, 0,
-       -0.0007247565913248916, 0.0007680497605419195, 0.01258895073769764,
-       -0.01257809704516804, 0.0753308963630161, -0.07534522031973065,
-       -0.08175553042066099, 0.08174245242667989},
-      {0.032908892440451, -0.03287203808983136, -1.654062445320034e-05, 0,
-       -0.01217716624955689, 0.01218078784622328, 0.02586900270706318,
-       -0.02586146843594124, -0.05497957869263911, 0.05496008134169412,
-       -0.04641303156327346, 0.04643155975632619},
-      {0.06577792909385798, 0.06581872653909202, 0.06437826023091293, 0,
-       0.07506656282732491, 0.07509963138659463, 0.07901317058697667,
-       0.0789813565774849, -0.05861260117827075, -0.05862518036288985,
-       -0.06054430651410828, -0.06054241785908658},
-      {0.03560088821934984, 0.03559098182377185, -0.03982222593116565, 0,
-       0.0001288473164764401, 0.0001950134685129089, -0.005999623734929281,
-       -0.006038045957869621, -0.05526911477605344, -0.05528488696292017,
-       0.05670508192781333, 0.05667763137850784},
-      {-0.006778527791865122, -0.00677067452725817, -0.03116850031212522, 0,
-       0.01736432879481119, 0.01735949123142044, -0.01281916488467032,
-       -0.01283658358761857, -0.0004303142046064808, -0.0004137353166112321,
-       0.001432780146188299, 0.001456076518596433},
-      {0.05385677498137089, 0.05381627084103366, -0.07915281073263837, 0,
-       0.02538932087372903, 0.02542742733904866, -0.04900199080128059,
-       -0.04904118326101857, -0.02501750875933987, -0.02504374660714441,
-       0.02472012188908278, 0.02470613634426778},
-      {-0.1455160731589958, -0.1455324924770875, 0.2038075539594567, 0,
-       0.1199779504009638, 0.1199630121017072, -0.04109790984756345,
-       -0.04109704100014992, 0.005538562796747306, 0.005533280181741028,
-       0.006019209685390341, 0.006017921582705248}};
-  gains["A4"]["3.1.2"] = {
-      {0.4558498591041816, 0.4558533317968699, 0.09837170863293987, 0,
-       0.110739958993637, 0.1107277510496565},
-      {0.5076812433832559, -0.5076720042276867, 1.125259879942959e-05, 0,
-       0.09484072554333738, -0.09483191904232836},
-      {-0.1716341771157468, -0.1716347886611724, -0.1279453844208592, 0,
-       0.2157564835051861, 0.2157577895842205},
-      {-0.0860013849881173, -0.08598988553538417, 0.1846977215943009, 0,
-       0.1399193360687857, 0.1398899305202508},
-      {0.2091417913673167, -0.2091471911378342, 3.108510337961687e-05, 0,
-       0.1206741720492304, -0.1206490003532838},
-      {-0.122908081391997, 0.1229304640963161, -9.055989794782506e-06, 0,
-       0.1370417582968757, -0.1370471724651177},
-      {0.05976600945834812, 0.05975441298442526, 0.03464867598591916, 0,
-       0.1230440229207417, 0.1230795468906973},
-      {-0.1459250371538154, -0.1459280589362268, -0.1149499795699002, 0,
-       0.2117027399946606, 0.2117064782116432},
-      {-0.09457348991234169, -0.09455434389917955, 0.2057304319407462, 0,
-       0.03602117463036362, 0.03598787574212899},
-      {0.009539186734380978, -0.009553266808361272, 3.91008588427309e-05, 0,
-       0.06724259260704396, -0.06720546172656568},
-      {-0.1462083806001271, 0.1461985782990767, -2.853235533427135e-05, 0,
-       0.1716763639158158, -0.1716712827266944},
-      {-0.0215111137054984, 0.02149966618836559, 4.141367759521952e-06, 0,
-       0.06426967502141225, -0.06429218097899439},
-      {-0.01741245208136232, -0.01742868227466699, -0.06519038465352181, 0,
-       -0.01119380287881469, -0.01118488114409955},
-      {-0.03428084551974217, -0.03429069704081739, -0.01774717718242519, 0,
-       0.1225080957594634, 0.1225522779793495},
-      {0.005920217308655475, 0.005920594625280991, -0.08288739304848533, 0,
-       0.04323087493871688, 0.04323568956739216},
-      {-0.1724706248422497, -0.1724352817619282, 0.2196930144595422, 0,
-       -0.005829273862039476, -0.005879002618343052},
-      {0.01119056114756904, -0.01118838755773465, 3.659741391940125e-05, 0,
-       0.02993874181069809, -0.02988874161702849},
-      {-0.07434502506871775, 0.07432146897098568, -2.565492320869307e-05, 0,
-       0.08941864012551172, -0.08941340311575782},
-      {-0.04970647726743763, 0.04973584993448934, 2.560259841274747e-05, 0,
-       0.1018459070595283, -0.1018616268525024},
-      {0.004479661978943183, -0.004500645550727038, -1.224583094881937e-05, 0,
-       -0.0354355013392288, 0.03543132505175703},
-      {0.1033368131343678, 0.1033662280274752, 0.08233148717346719, 0,
-       -0.02958143074967187, -0.02961213650031968},
-      {-0.01581036396500888, -0.01582446188333951, -0.04031561220017205, 0,
-       -0.01396867346787669, -0.01398252961382916},
-      {-0.01758423895975371, -0.01759805045229135, -0.03900216490983474, 0,
-       0.007491534145955856, 0.007537812674159464},
-      {0.04278257865744881, 0.04280697024527288, -0.09329630807423786, 0,
-       -0.00942221053779083, -0.009446864569104436},
-      {-0.09528297291134599, -0.09524688228047125, 0.2033576388710656, 0,
-       0.002873839167100622, 0.002838434086452182}};
-  gains["A4"]["7.1.2"] = {
-      {0.1227392522233813, 0.1227468193219647, 0.1124741179194009, 0,
-       0.156080056143775, 0.1560813881501154, 0.1830650904759321,
-       0.1830521944342445, 0.2430397008554145, 0.2430336144390797},
-      {0.1386845582712175, -0.1386928861033728, 4.903337216824281e-06, 0,
-       0.2901333895422477, -0.290142342351392, 0.1475866793598385,
-       -0.1475684946633604, 0.233209500596762, -0.2331923913504391},
-      {-0.1777012442507094, -0.1777262146857431, -0.1314745664089598, 0,
-       -0.1738190883418949, -0.1738064109808844, -0.2113415189878441,
-       -0.2113370804348439, 0.4686400666872971, 0.468639193486484},
-      {0.1631172929225302, 0.1631177200396817, 0.1971575985882708, 0,
-       0.02642487921515516, 0.02640405280648556, -0.2982133126059484,
-       -0.298200838468048, 0.04057768939949914, 0.04057861912127256},
-      {0.2328095884669301, -0.2328147231822385, 7.34688560139142e-06, 0,
-       0.04536403018013771, -0.04533037598562688, -0.2329790869839503,
-       0.2329623867085918, 0.04819126890625734, -0.04816214080800724},
-      {-0.1054372801799554, 0.1054418450096362, -2.068650289075415e-05, 0,
-       -0.1411747213157653, 0.141158437332722, -0.1045790936062076,
-       0.1045886670641451, 0.3349793384420713, -0.3349609561218349},
-      {0.03645070829710129, 0.03648832073644243, 0.03070595936622075, 0,
-       -0.007437880428489298, -0.007462818836074309, -0.02219490328927572,
-       -0.02219223231805195, 0.2525654253876082, 0.2525771611006338},
-      {-0.1298165445964921, -0.1298399860700899, -0.07192605454004165, 0,
-       -0.0246635854196166, -0.02465918192816696, 0.1669097186264945,
-       0.1669111061158492, 0.05711248270587421, 0.05714030828444872},
-      {0.03286867107687323, 0.03285394048091991, 0.2299684023559067, 0,
-       -0.3000195782543059, -0.3000247311714679, 0.1699550263810649,
-       0.1699792791744315, 0.0007049917733897565, 0.0006770110312223716},
-      {0.1803738466761217, -0.1803644398535286, 4.901194272641442e-06, 0,
-       -0.2259032072208039, 0.2258924401534492, 0.1478019735119846,
-       -0.1478253113965935, 0.0327981432975665, -0.03272431582785186},
-      {-0.1602968241307063, 0.1603017913904698, -3.809584294841413e-05, 0,
-       -0.03240890461396283, 0.03242584120319757, 0.1402903606707493,
-       -0.1402937300950092, 0.05836537316660033, -0.05836024198312943},
-      {-0.03264944248383183, 0.03263286840422967, 2.519174728385681e-05, 0,
-       -0.08663202253145261, 0.08667072015534827, -0.03561483466761262,
-       0.03558760035054801, 0.154227952454042, -0.1542245402435387},
-      {-0.009851096600084621, -0.009889878569008151, -0.08334066939944569, 0,
-       -0.04357173267213496, -0.04358559359096802, -0.005959420948957885,
-       -0.005923094277449202, -0.05486111474025231, -0.05486303777014162},
-      {-0.02955885454086704, -0.02953283159914571, -0.05977732382922631, 0,
-       0.002959472718479385, 0.002925312520993523, 0.08257651838355994,
-       0.08258102021280581, 0.02486548479579211, 0.02489243533830922},
-      {-0.02268508593868297, -0.02272000227819941, -0.06580551772337667, 0,
-       0.127379896690803, 0.1273855828633583, -0.0531391097318182,
-       -0.05312569467497778, 0.001191202912391729, 0.001196302455354104},
-      {-0.1057910554142186, -0.1058198488250505, 0.2351364114299659, 0,
-       -0.04382412650151869, -0.04379117733844167, -0.002827058366164484,
-       -0.002861983002341034, -0.007849142621210153, -0.007870446722038297},
-      {0.05737264770650954, -0.05732273867105581, 1.163413303872186e-05, 0,
-       -0.02407947916010715, 0.02406225970624835, 0.0006352309963243791,
-       -0.0005937190995778403, 0.01868104555249647, -0.01863696239584837},
-      {-0.1124046840400208, 0.1124441557761914, -4.0177147284582e-05, 0,
-       0.07935004750561055, -0.07936996992790579, -0.05806403721807002,
-       0.05805074508431243, 0.02912248595277887, -0.02909564934165438},
-      {-0.01185160350997692, 0.01183900196463183, 4.152769030379654e-05, 0,
-       -0.0007247565913248916, 0.0007680497605419195, 0.01258895073769764,
-       -0.01257809704516804, 0.01752100640306364, -0.01754457789800654},
-      {0.032908892440451, -0.03287203808983136, -1.654062445320034e-05, 0,
-       -0.01217716624955689, 0.01218078784622328, 0.02586900270706318,
-       -0.02586146843594124, -0.08779854804645504, 0.08779215210646077},
-      {0.06577792909385798, 0.06581872653909202, 0.06437826023091293, 0,
-       0.07506656282732491, 0.07509963138659463, 0.07901317058697667,
-       0.0789813565774849, -0.1014238908766336, -0.1014351345804795},
-      {0.03560088821934984, 0.03559098182377185, -0.03982222593116565, 0,
-       0.0001288473164764401, 0.0001950134685129089, -0.005999623734929281,
-       -0.006038045957869621, -0.01517256681715788, -0.01520774947358582},
-      {-0.006778527791865122, -0.00677067452725817, -0.03116850031212522, 0,
-       0.01736432879481119, 0.01735949123142044, -0.01281916488467032,
-       -0.01283658358761857, 0.0005828143527127185, 0.0006158662636148061},
-      {0.05385677498137089, 0.05381627084103366, -0.07915281073263837, 0,
-       0.02538932087372903, 0.02542742733904866, -0.04900199080128059,
-       -0.04904118326101857, -0.007537742939811427, -0.007573870061193238},
-      {-0.1455160731589958, -0.1455324924770875, 0.2038075539594567, 0,
-       0.1199779504009638, 0.1199630121017072, -0.04109790984756345,
-       -0.04109704100014992, 0.009794786782670562, 0.009788593341520789}};
-  gains["A4"]["9.1.6"] = {
-      {0.03823210282048346, 0.03823477819232632, 0.1163803973130551, 0,
-       0.2327108434567355, 0.2327092535784413, 0.1669360035801264,
-       0.1669288767358188, 0.124509620027289, 0.1245128034893679,
-       0.1150102389286838, 0.1149966666978867, 0.1594743007530997,
-       0.1594641862375878, 0.05701791680037214, 0.05701893148746988},
-      {0.09665077154906419, -0.09665365469767941, 7.046668170436175e-06, 0,
-       0.1722539425133282, -0.172272128752237, 0.1280255057191407,
-       -0.1279961496947212, 0.2124797465660029, -0.2124965928513465,
-       0.0811188402153363, -0.08109837762434007, 0.08919515666724875,
-       -0.0891624384328371, 0.1285011095351327, -0.1285016001498655},
-      {0.0002989057264425856, 0.0002880048949267783, -0.1839350729332913, 0,
-       -0.2978069932330883, -0.2977937619198064, -0.1135046394623845,
-       -0.1135055852859673, -0.1780224965310851, -0.1780134729131291,
-       0.2485908833247801, 0.2485669169211837, 0.3174866270059922,
-       0.3174611218107862, 0.09227195120137768, 0.09227156836169463},
-      {0.05062370554832916, 0.05063413390693076, 0.1919731887252196, 0,
-       -0.3445277004015249, -0.3445317280575539, 0.2679348320746471,
-       0.2679020889874066, -0.01356110302122599, -0.01355974459573535,
-       0.08111772102141412, 0.08109289292927513, -0.1783807447272691,
-       -0.1783754328207466, -6.644146115996523e-05, -7.059039708591902e-05},
-      {0.1179731149925308, -0.1179891515283385, 2.491350162815539e-05, 0,
-       -0.2693661639927498, 0.2693811074188054, 0.2331180073577782,
-       -0.2330465600967624, -0.03362570847894904, 0.03361202870654473,
-       0.1187267608530725, -0.118706796690242, -0.1272590766803055,
-       0.1272455978269993, 0.0002841251778859902, -0.0002729725670637376},
-      {0.000821751547042673, -0.0008008289711345396, 6.309984993228974e-06, 0,
-       -0.1036656419371181, 0.1036707689024635, -0.1127761263091061,
-       0.1127939148059046, -0.1558584055517047, 0.1558519784334124,
-       0.1214805398944064, -0.1214351273087147, 0.1279978290350799,
-       -0.1279256153746262, 0.1823817836422306, -0.1823705806512157},
-      {-0.08026507128158301, -0.08027799624319994, 0.05807516436585497, 0,
-       0.0282569946449982, 0.02824220297545093, 0.0421726730341742,
-       0.0422444870637162, 0.04116964363079337, 0.0411495853370632,
-       0.2006102565679247, 0.2005972916728247, 0.1959656015095006,
-       0.1959358085567337, 0.003839300589938719, 0.003839563184483447},
-      {0.0001470433880190757, 0.0001313619385131432, -0.1715625836055388, 0,
-       0.2073062848726773, 0.2072934793151604, 0.01714259932996209,
-       0.01717424430038088, -0.002695697162410267, -0.002686740006926368,
-       0.1214717982150486, 0.1214575740903165, -0.2559507504255912,
-       -0.2559513606849963, -0.0001641791670267622, -0.0001623702386424741},
-      {-0.08142577933998399, -0.08141086111376636, 0.221605553212241, 0,
-       0.1904804671843742, 0.1904890389816814, 0.1792377353711918,
-       0.1792094285861832, -0.2382498174644657, -0.2382609353079846,
-       1.682046455952148e-05, -2.647024480113412e-05, 0.09000338486766982,
-       0.08999582579446844, -0.1312353814556686, -0.1312413393035063},
-      {-0.01881607904198624, 0.01878052782814953, 5.303642669857597e-05, 0,
-       0.1660831759669725, -0.1660972633448802, 0.2311589110649971,
-       -0.2310575358363691, -0.2175129743473301, 0.2175274279260965,
-       0.07353544142332347, -0.07348670958201213, 0.07267427847577515,
-       -0.0726482573595981, -0.1083956127051377, 0.1083975480926701},
-      {0.0004342977194900121, -0.0004005248235218846, 1.178949321084216e-05, 0,
-       0.1461525844542428, -0.1461126980031401, -0.1662678768536449,
-       0.1662686512304495, -0.007512777893718041, 0.00750656671958732,
-       0.1764466529793999, -0.176437292457641, -0.1838190663210042,
-       0.1838035543485639, -9.036220636732641e-05, 8.624243752522699e-05},
-      {-0.1017492165518994, 0.1017651498180887, -9.95720965761825e-06, 0,
-       -0.05143630992961247, 0.05141482313977246, -0.0007596852723535386,
-       0.0007288549948166051, -0.04030650382154461, 0.04033040740674802,
-       0.06504437116975119, -0.06498853357449882, 0.05868572940966601,
-       -0.05859867743974995, 0.08045957729337808, -0.0804274796412843},
-      {-0.0009505121052813532, -0.0009326043364807122, -9.902982443727742e-05,
-       0, -0.04694807433669368, -0.04694035911820378, -0.0745477375717977,
-       -0.07463815719933609, -0.01737409962558105, -0.0173830243310865,
-       0.06820434656977195, 0.06819684338255642, -0.001638654953654214,
-       -0.001663908562359234, -0.08423061401334682, -0.08420468231202415},
-      {-0.05484962413511664, -0.05487632312584955, -0.01908183177978033, 0,
-       0.1028572634431357, 0.1028677189589403, 0.005887531415403026,
-       0.005964574556828021, 0.01460351181426018, 0.01458576582332607,
-       0.06503173962720706, 0.0650568947764369, -0.1172880803048938,
-       -0.1172982387153678, -6.534471583667823e-05, -5.708704037655006e-05},
-      {-0.001176632968683588, -0.001167834788531562, -0.1791585040536628, 0,
-       -0.1032971762450944, -0.1032959662793981, 0.1338030514876711,
-       0.1338200502656083, 0.1579179542676681, 0.1579066443281886,
-       1.561601837797947e-05, 2.54108395259228e-06, 0.1299878739513332,
-       0.1300148477916393, -0.1865230415310783, -0.1865341993921229},
-      {-0.1579982269412787, -0.1579971086948339, 0.2173092949314515, 0,
-       -1.82400357360557e-05, -1.831112717373684e-05, 0.03034750456716664,
-       0.03033576180421406, 0.05046594413816482, 0.05044286249964257,
-       -0.07350948689465471, -0.07355707783229767, -3.055693595703513e-05,
-       -9.609827349404965e-06, -0.001645073360299591, -0.001626433373856112},
-      {-0.1471999653599927, 0.1471655073779819, 7.245110242393435e-05, 0,
-       -4.872787321737535e-07, 1.64282743544027e-05, 0.1495701084543039,
-       -0.1494650239891187, 0.0567815575884362, -0.05674420751709491,
-       3.316976525644671e-05, 6.678622388699378e-05, -3.275555252096712e-05,
-       -3.391519254385752e-05, -0.004170522654583586, 0.004145825859231106},
-      {-0.001435260168408518, 0.001451474920995584, 5.359004002076352e-06, 0,
-       -0.08349146369212927, 0.08343556271498946, -0.1029598056086893,
-       0.1029369722688095, 0.1296689371482818, -0.1296862897051884,
-       0.1077130532018314, -0.1077220905286006, 0.1069888899169959,
-       -0.1070180663629435, -0.1556882638653323, 0.1557164512710874},
-      {-0.09115015398808984, 0.09119478511939931, -2.797241548072142e-05, 0,
-       0.0241056751537417, -0.02410471312061534, 0.01193684313043793,
-       -0.01196640562409709, 0.02589655962907238, -0.02588834066412029,
-       0.1182616054431289, -0.1182773669579348, -0.114408999712629,
-       0.1143809784362199, -0.000511820040742381, 0.0004935764626349579},
-      {-0.001769455222205528, 0.001760133014516096, -1.732378359529176e-05, 0,
-       0.0122884263919122, -0.01223672996163162, 0.02952399328146089,
-       -0.02944247589166446, 0.03415893988974503, -0.03414091285531259,
-       -0.02164320354235845, 0.02168170436926944, -0.0334836973529788,
-       0.03353978736534322, -0.05019174075763851, 0.05021590493738465},
-      {0.0693101448671703, 0.06934109953957814, 0.03486975122187521, 0,
-       0.118999115516358, 0.1189734052398081, -0.004033067845813275,
-       -0.004051371311841426, 0.04904726014318935, 0.04904999545097039,
-       -0.0151083770887436, -0.01512349005221743, -0.05938160943508703,
-       -0.05940355851515556, -0.06624477856805051, -0.0661641201820527},
-      {-0.0003243814881210656, -0.0003074042346021207, 0.06415031356143309, 0,
-       -0.02449137310298852, -0.02450078027921002, -0.00797024733572425,
-       -0.008045949876818548, 0.004912720806504982, 0.004940027459897476,
-       -0.02164102184097935, -0.02160962702638815, 0.06704152486104822,
-       0.06703801358234722, 0.0002729187748976852, 0.000271808972828073},
-      {0.05805360648137974, 0.05803883900336139, 0.009605620266745912, 0,
-       -0.01705027566277866, -0.01704976644458926, 0.01707802432601647,
-       0.01713637531429868, 0.001874078398171003, 0.001900912910869614,
-       8.593651076481059e-07, 6.327421845519712e-05, 0.08088048736234082,
-       0.08094159850638349, -0.1116772413725262, -0.1116816892320618},
-      {-0.000837557917019586, -0.0007982742801704139, -0.1534741586320595, 0,
-       -1.91999552488914e-05, -1.473890528010113e-05, 0.216128332691351,
-       0.2161187091004825, 0.01342010433849352, 0.01339413577209284,
-       -0.1077019343112887, -0.1077462040199603, -2.930308784994395e-05,
-       -2.997235791059316e-05, -0.00086267452442376, -0.0008676519223302055},
-      {-0.05678567593879785, -0.05681895653799814, 0.1915319921299358, 0,
-       -0.0476969814070759, -0.04770829935442969, -0.07760620892474857,
-       -0.07759683096005307, 0.1678707648708007, 0.1678703709690277,
-       -0.08126764410532106, -0.08125745592720758, -0.01960493214038584,
-       -0.01961399964004435, 0.07361268414637329, 0.0736016214659572}};
-  gains["A4"]["0+1+0"] = {{0.6093311202935561},     {3.857221864800309e-06},
-                          {-1.91202965921409e-07},  {0.07231566376213994},
-                          {4.078710384547435e-06},  {8.18490654867068e-06},
-                          {0.09201825816150785},    {7.908801103027902e-07},
-                          {0.1578821863804438},     {5.320844832186478e-06},
-                          {3.172739941643403e-07},  {-1.055748796135233e-05},
-                          {-8.201596992236202e-06}, {0.03957727760117019},
-                          {-1.525436528208108e-05}, {0.04942634170854775},
-                          {1.270139343188814e-05},  {-1.783678442423883e-07},
-                          {1.337799011488783e-05},  {-6.371051387596834e-06},
-                          {0.03074408856854242},    {-6.366422499018521e-06},
-                          {0.01166706159759326},    {-9.934390795507949e-06},
-                          {0.03186086157818852}};
-
-  return gains;
+namespace {
+
+using enum PrecomputedGainsLayout;
+
+constexpr size_t kLayoutCount =
+    static_cast<size_t>(PrecomputedGainsLayout::kNumLayouts);
+
+constexpr size_t Index(PrecomputedGainsLayout layout) {
+  return static_cast<size_t>(layout);
+}
+
+struct LayoutInfo {
+  absl::string_view key;
+  size_t num_channels;
+};
+
+// Indexed by `PrecomputedGainsLayout`.
+constexpr std::array<LayoutInfo, kLayoutCount> kLayoutInfos = {{
+    {"0+1+0", 1},
+    {"0+2+0", 2},
+    {"0+5+0", 6},
+    {"2+5+0", 8},
+    {"4+5+0", 10},
+    {"0+7+0", 8},
+    {"4+7+0", 12},
+    {"3.1.2", 6},
+    {"7.1.2", 10},
+    {"9.1.6", 16},
+    {"3+7+0", 12},
+    {"4+5+1", 11},
+    {"4+9+0", 14},
+    {"9+10+3", 24},
+    {"A0", 1},
+    {"A1", 4},
+    {"A2", 9},
+    {"A3", 16},
+    {"A4", 25},
+}};
+
+// Each table holds the gains from one layout to another, flattened in
+// row-major (input channel, output channel) order.
+//
+// Generated on Sun Aug 25 04:53:27 2024, GMT
+
+// -------------------------------------------------------
+// Input layout: 0+1+0
+constexpr double kGains0_1_0To0_2_0[] = {
+    0.7071067811865476, 0.7071067811865476,
+};
+
+constexpr double kGains0_1_0To0_5_0[] = {
+    0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To2_5_0[] = {
+    0, 0, 1, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To4_5_0[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To4_5_1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To3_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To4_9_0[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To9_10_3[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To0_7_0[] = {
+    0, 0, 1, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To4_7_0[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To3_1_2Ch[] = {
+    0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To7_1_2Ch[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_1_0To9_1_6Ch[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// Skipping identity matrix: 0+1+0 to 0+1+0
+
+// -------------------------------------------------------
+// Input layout: 0+2+0
+// Skipping identity matrix: 0+2+0 to 0+2+0
+constexpr double kGains0_2_0To0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_2_0To0_1_0[] = {
+    0.5,
+    0.5,
+};
+
+// -------------------------------------------------------
+// Input layout: 0+5+0
+constexpr double kGains0_5_0To0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+};
+
+// Skipping identity matrix: 0+5+0 to 0+5+0
+constexpr double kGains0_5_0To2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains0_5_0To4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains0_5_0To4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains0_5_0To9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_5_0To0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+};
+
+// -------------------------------------------------------
+// Input layout: 2+5+0
+constexpr double kGains2_5_0To0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    1, 0,
+    0, 1,
+};
+
+constexpr double kGains2_5_0To0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+};
+
+// Skipping identity matrix: 2+5+0 to 2+5+0
+constexpr double kGains2_5_0To4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains2_5_0To4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains2_5_0To3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains2_5_0To4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains2_5_0To9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains2_5_0To0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains2_5_0To4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains2_5_0To3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains2_5_0To7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains2_5_0To9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains2_5_0To0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.5,
+    0.5,
+};
+
+// -------------------------------------------------------
+// Input layout: 4+5+0
+constexpr double kGains4_5_0To0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+};
+
+constexpr double kGains4_5_0To0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains4_5_0To2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+// Skipping identity matrix: 4+5+0 to 4+5+0
+constexpr double kGains4_5_0To4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+};
+
+constexpr double kGains4_5_0To3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0,
+    0, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0.7071067811865476, 0, 0,
+};
+
+constexpr double kGains4_5_0To4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains4_5_0To9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains4_5_0To0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains4_5_0To4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains4_5_0To3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0.7071067811865476,
+};
+
+constexpr double kGains4_5_0To7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476,
+};
+
+constexpr double kGains4_5_0To9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains4_5_0To0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.5,
+    0.5,
+    0.3535533905932738,
+    0.3535533905932738,
+};
+
+// -------------------------------------------------------
+// Input layout: 0+7+0
+constexpr double kGains0_7_0To0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+};
+
+constexpr double kGains0_7_0To0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains0_7_0To2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains0_7_0To4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// Skipping identity matrix: 0+7+0 to 0+7+0
+constexpr double kGains0_7_0To4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    1.207106781186548, 0, 0, 0, 0, 0,
+    0, 1.207106781186548, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains0_7_0To9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains0_7_0To0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+};
+
+// -------------------------------------------------------
+// Input layout: 4+7+0
+constexpr double kGains4_7_0To0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+};
+
+constexpr double kGains4_7_0To0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains4_7_0To2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains4_7_0To4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains4_7_0To4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+};
+
+constexpr double kGains4_7_0To3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0,
+    0, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0.7071067811865476, 0, 0,
+};
+
+constexpr double kGains4_7_0To4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains4_7_0To9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains4_7_0To0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+// Skipping identity matrix: 4+7+0 to 4+7+0
+constexpr double kGains4_7_0To3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0.7071067811865476,
+};
+
+constexpr double kGains4_7_0To7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476,
+};
+
+constexpr double kGains4_7_0To9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains4_7_0To0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.5,
+    0.5,
+    0.3535533905932738,
+    0.3535533905932738,
+};
+
+// -------------------------------------------------------
+// Input layout: 3.1.2
+constexpr double kGains3_1_2ChTo0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    1, 0,
+    0, 1,
+};
+
+constexpr double kGains3_1_2ChTo0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains3_1_2ChTo4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+// Skipping identity matrix: 3.1.2 to 3.1.2
+
+constexpr double kGains3_1_2ChTo7_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains3_1_2ChTo9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains3_1_2ChTo0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.5,
+    0.5,
+};
+
+// -------------------------------------------------------
+// Input layout: 7.1.2
+constexpr double kGains7_1_2ChTo0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    1, 0,
+    0, 1,
+};
+
+constexpr double kGains7_1_2ChTo0_5_0[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo2_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+constexpr double kGains7_1_2ChTo4_5_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo4_5_1[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo3_7_0[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo4_9_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo9_10_3[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo0_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo4_7_0[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo3_1_2Ch[] = {
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    1.207106781186548, 0, 0, 0, 0, 0,
+    0, 1.207106781186548, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+};
+
+// Skipping identity matrix: 7.1.2 to 7.1.2
+
+constexpr double kGains7_1_2ChTo9_1_6Ch[] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains7_1_2ChTo0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.5,
+    0.5,
+};
+
+// -------------------------------------------------------
+// Input layout: 9.1.6
+constexpr double kGains9_1_6ChTo0_2_0[] = {
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0.7071067811865476,
+    0, 0,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    1, 0,
+    0, 1,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+    0.7071067811865476, 0,
+    0, 0.7071067811865476,
+};
+
+constexpr double kGains9_1_6ChTo0_5_0[] = {
+    0.816496580927726, 0, 0, 0, 0.5773502691896257, 0,
+    0, 0.816496580927726, 0, 0, 0, 0.5773502691896257,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0.5773502691896257, 0, 0, 0, 0.816496580927726, 0,
+    0, 0.5773502691896257, 0, 0, 0, 0.816496580927726,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476,
+};
+
+constexpr double kGains9_1_6ChTo2_5_0[] = {
+    0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0,
+    0, 0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0,
+    0, 0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476,
+};
+
+constexpr double kGains9_1_6ChTo4_5_0[] = {
+    0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0,
+    0, 0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0,
+    0, 0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476,
+};
+
+constexpr double kGains9_1_6ChTo4_5_1[] = {
+    0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0, 0,
+    0, 0.816496580927726, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0, 0,
+    0, 0.5773502691896257, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0,
+};
+
+constexpr double kGains9_1_6ChTo3_7_0[] = {
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0,
+    0, 0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0, 0.816496580927726, 0, 0,
+    0, 0, 0, 0, 0.5773502691896257, 0, 0, 0, 0, 0.816496580927726, 0, 0,
+    0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0, 0.5773502691896257, 0, 0,
+    0, 0, 0, 0, 0.816496580927726, 0, 0, 0, 0, 0.5773502691896257, 0, 0,
+};
+
+constexpr double kGains9_1_6ChTo4_9_0[] = {
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0, 0,
+};
+
+constexpr double kGains9_1_6ChTo9_10_3[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+};
+
+constexpr double kGains9_1_6ChTo0_7_0[] = {
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+constexpr double kGains9_1_6ChTo4_7_0[] = {
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0, 0.7071067811865476,
+};
+
+constexpr double kGains9_1_6ChTo3_1_2Ch[] = {
+    1.207106781186548, 0, 0, 0, 0, 0,
+    0, 1.207106781186548, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0,
+    0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0.7071067811865476,
+    0, 0, 0, 0, 1.207106781186548, 0,
+    0, 0, 0, 0, 0, 1.207106781186548,
+};
+
+constexpr double kGains9_1_6ChTo7_1_2Ch[] = {
+    0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0, 0,
+    0, 0.7071067811865476, 0, 0, 0, 0.7071067811865476, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0.7071067811865476,
+    0, 0, 0, 0, 0, 0, 0, 0, 1.207106781186548, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1.207106781186548,
+};
+
+// Skipping identity matrix: 9.1.6 to 9.1.6
+
+constexpr double kGains9_1_6ChTo0_1_0[] = {
+    0.5,
+    0.5,
+    0.7071067811865476,
+    0,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.5,
+    0.5,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.5,
+    0.5,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+    0.3535533905932738,
+};
+
+// -------------------------------------------------------
+// Input layout: A0
+constexpr double kGainsA0To0_2_0[] = {
+    0.7071008213968912, 0.707112740925987,
+};
+
+constexpr double kGainsA0To0_5_0[] = {
+    0.3263355531701697, 0.3263383644933828, 0.2151315278709894, 0,
+    0.6085778645723429, 0.608571924315719,
+};
+
+constexpr double kGainsA0To2_5_0[] = {
+    0.2154513872061713, 0.2154622268603212, 0.1449662018040889, 0,
+    0.645327082470003, 0.6453189902061011, 0.1631927661554572,
+    0.1631747758277981,
+};
+
+constexpr double kGainsA0To4_5_0[] = {
+    0.2589132999145944, 0.2589253088681112, 0.1717924582033098, 0,
+    0.5558287092111358, 0.5558131000120811, 0.196782449621433,
+    0.1967602437260952, 0.2656046750564827, 0.2656151602017694,
+};
+
+constexpr double kGainsA0To4_5_1[] = {
+    0.1375100903716531, 0.1375206718313378, 0.05714168131247213, 0,
+    0.5839449180158363, 0.5839301225470853, 0.1959384400945835,
+    0.1959163294414141, 0.264465483647113, 0.2644759238211001,
+    0.2455264263929417,
+};
+
+constexpr double kGainsA0To3_7_0[] = {
+    0.2219895825571791, 0.2422498248350245, 0.2422647599782093,
+    0.2575044204591602, 0.2574982220440356, 0.360899749398248,
+    0.3608875769262723, 0.3689694314374973, 0.3689551560194772,
+    0.4098472300507444, 0, 0,
+};
+
+constexpr double kGainsA0To4_9_0[] = {
+    0.2197345779107386, 0.2197658012546257, 0.1683870145708428, 0,
+    0.3193101735236183, 0.3193129430652121, 0.3759078826756547,
+    0.3758810274295499, 0.2977143280157135, 0.2976931252602669,
+    0.2981130969556019, 0.2981195717502504, 0.1295464157014552,
+    0.1294932671541695,
+};
+
+constexpr double kGainsA0To9_10_3[] = {
+    0.09620442018565725, 0.09621115229239315, 0.057686470561278, 0,
+    0.3430243634887538, 0.3430203628372547, 0.09762670568249716,
+    0.09763078265127419, 0.3430201810379803, 0, 0.3133067479574846,
+    0.3133147585847036, 0.1298650758591156, 0.1298309237069154,
+    0.1453558637770907, 0.3190762719566893, 0.1416214006119258,
+    0.1415959491973159, 0.1434756453687651, 0.1434781986519148,
+    0.1416048272463015, 0.2351645059348485, 0.2196565216015469,
+    0.2196345111717833,
+};
+
+constexpr double kGainsA0To0_7_0[] = {
+    0.3386498676460261, 0.3386538634292717, 0.2637566389608358, 0,
+    0.3754678844087531, 0.3754587695554182, 0.4577852745549881,
+    0.4577657543701992,
+};
+
+constexpr double kGainsA0To4_7_0[] = {
+    0.2507372882764423, 0.250752746687216, 0.2297672082690357, 0,
+    0.3188473884483216, 0.3188501095310373, 0.3739736354306449,
+    0.3739472908142024, 0.2906380377661857, 0.2906211331547076,
+    0.2911221418496587, 0.2911284648059639,
+};
+
+constexpr double kGainsA0To3_1_2Ch[] = {
+    0.671766543304041, 0.6717716608635106, 0.1449662018040889, 0,
+    0.1631927661554572, 0.1631747758277981,
+};
+
+constexpr double kGainsA0To7_1_2Ch[] = {
+    0.2507372882764423, 0.250752746687216, 0.2297672082690357, 0,
+    0.3188473884483216, 0.3188501095310373, 0.3739736354306449,
+    0.3739472908142024, 0.4964924784216314, 0.4964800448154338,
+};
+
+constexpr double kGainsA0To9_1_6Ch[] = {
+    0.09620442018565725, 0.09621115229239315, 0.2928509764961265, 0,
+    0.5855762595845468, 0.5855722589330478, 0.420065344246053,
+    0.4200474107850664, 0.3133067479574846, 0.3133147585847036,
+    0.2894032118374602, 0.28936905968526, 0.4012892701848798,
+    0.4012638187702699, 0.1434756453687651, 0.1434781986519148,
+};
+
+constexpr double kGainsA0To0_1_0[] = {
+    1,
+};
+
+// -------------------------------------------------------
+// Input layout: A1
+constexpr double kGainsA1To0_2_0[] = {
+    0.6237526753261383, 0.6237631898637224,
+    0.5721035925321385, -0.5720956954375841,
+    -8.583228130601764e-07, 4.668628571934903e-07,
+    0.07401412616937707, 0.07404156119079325,
+};
+
+constexpr double kGainsA1To0_5_0[] = {
+    0.2506215452023863, 0.2506237042627795, 0.165218271233421, 0,
+    0.4673800427609406, 0.4673754807195712,
+    0.3106827387441656, -0.3106855590761276, 9.155565816140743e-06, 0,
+    0.4511283309408949, -0.4511052147568972,
+    1.709057789660855e-05, 9.909121998546576e-06, -4.072812615293027e-05, 0,
+    -4.401372500512637e-06, 1.073760389450532e-05,
+    0.3075523452703663, 0.3075642303486892, 0.265463909623805, 0,
+    -0.4306128761845321, -0.4306298052991511,
+};
+
+constexpr double kGainsA1To2_5_0[] = {
+    0.1608412473078967, 0.1608493394511706, 0.1082218361088837, 0,
+    0.4817569949861433, 0.4817509538562328, 0.1218285405373234,
+    0.1218151101910272,
+    0.2283931298562139, -0.2283992405530291, 1.237934076772879e-05, 0,
+    0.4668645722709004, -0.4668415559666158, 0.1043372896418495,
+    -0.1043276013308286,
+    -0.1952271907091981, -0.1952375336695809, -0.140756774646952, 0,
+    0.00906085188854453, 0.009074527588063772, 0.2373605493064364,
+    0.2373619861653989,
+    0.2127723002580597, 0.2127980947140542, 0.2031918204312814, 0,
+    -0.4347082494911021, -0.4347268372684167, 0.1539296985579603,
+    0.1538973485815448,
+};
+
+constexpr double kGainsA1To4_5_0[] = {
+    0.1716345900998222, 0.1716425508798015, 0.1138818598955406, 0,
+    0.3684609199397454, 0.3684505725435995, 0.1304478182107854,
+    0.1304330978401232, 0.1760703275843818, 0.1760772782262143,
+    0.2466977620275643, -0.2467024939684432, 1.302678277876558e-05, 0,
+    0.3698730076115667, -0.3698461125657664, 0.1155948248864342,
+    -0.1155833215305355, 0.1599941725721336, -0.1599999889632932,
+    -0.2035943869469594, -0.2036053810583457, -0.1481183822603481, 0,
+    -0.2918026810568149, -0.2917903701175891, 0.2521760338830817,
+    0.2521765897869218, 0.3482143664665878, 0.3482181669106747,
+    0.2256954542522409, 0.2257227572897904, 0.2138187934918574, 0,
+    -0.4127937343615455, -0.4128052277441523, 0.1636160772209112,
+    0.1635814271899589, -0.1040812101154298, -0.1040929523099378,
+};
+
+constexpr double kGainsA1To4_5_1[] = {
+    0.0918824459511635, 0.09188951634428853, 0.03818132495267527, 0,
+    0.3901843655475281, 0.3901744794085973, 0.1309235059266395,
+    0.1309087318770459, 0.1767123811894714, 0.1767193571773387,
+    0.1640575505525399,
+    0.1875590611254976, -0.1875608070622571, 1.848685982904073e-05, 0,
+    0.4020438447556157, -0.4020301528042481, 0.1160163500523511,
+    -0.1160048047486056, 0.1605776032767992, -0.1605834408778638,
+    -7.22175249556197e-06,
+    -0.02013931000170021, -0.02015357121639456, 0.01070845203405976, 0,
+    -0.3321050778601112, -0.3321013126632121, 0.2530956126326256,
+    0.2530961705636106, 0.3494841561716517, 0.349487970474342,
+    -0.3261638118313036,
+    0.154186747667681, 0.1542093270856626, 0.1090486115060445, 0,
+    -0.3875809824931892, -0.3875952450639486, 0.1642127154714987,
+    0.1641779390866195, -0.1044607500248144, -0.104472535038112,
+    0.2292000195962985,
+};
+
+constexpr double kGainsA1To3_7_0[] = {
+    0.1382064044023507, 0.1508200379129243, 0.1508293362431208,
+    0.1603172529963421, 0.1603133939834211, 0.2246891774806315,
+    0.2246815991358953, 0.2297132048537519, 0.2297043172556352,
+    0.2551629286702514, 0, 0,
+    6.02514266255511e-06, 0.1704133759780043, -0.1704236090854955,
+    0.1789659855865252, -0.1789374211373609, 0.4236176391168636,
+    -0.423610307530364, 0.1924197957914894, -0.1924020369511604,
+    -1.10118796971239e-05, 0, 0,
+    -0.1615538528318267, -0.2183564581792388, -0.2183871414520327,
+    0.3053155649679399, 0.3053279115028223, -0.1599450948785344,
+    -0.1599419399132976, -0.2527215720239799, -0.25270854802152,
+    0.5025142842980169, 0, 0,
+    0.2422641164522238, 0.2004359311074826, 0.2004364559422345,
+    0.1778269449482694, 0.1778148715227776, 0.001357598050706869,
+    0.001351532853619586, -0.376625410481799, -0.376622034677538,
+    -0.2383294570385009, 0, 0,
+};
+
+constexpr double kGainsA1To4_9_0[] = {
+    0.1339431265090085, 0.1339621592545149, 0.1026433045248743, 0,
+    0.1946412047413922, 0.1946428929648099, 0.2291413466359956,
+    0.2291249765423095, 0.1814770723848118, 0.1814641478675051,
+    0.1817201490961388, 0.1817240959225644, 0.07896732554371746,
+    0.07893492789988488,
+    0.1642680631908641, -0.1642961998097429, -9.160575231371364e-06, 0,
+    0.3707675422464824, -0.370776128905981, 0.188657815766759,
+    -0.1886319584318828, 0.1774258290652412, -0.1773906217339204,
+    0.1697302497308936, -0.1697483193023093, 0.02675069263478266,
+    -0.02670300993549553,
+    -0.1979530519341265, -0.1979557356961659, -0.1215473750657985, 0,
+    -0.2102629234318301, -0.2102467219096768, -0.2583530857101292,
+    -0.2583476048231024, 0.349753375846277, 0.3497508710492567,
+    0.3505408634499179, 0.3505390213033154, -0.143793772581072,
+    -0.1438055419267072,
+    0.1630592898454297, 0.1630889849985164, 0.161757920551538, 0,
+    0.03362762093723288, 0.03360096431906716, -0.3811337676526063,
+    -0.3811179993988287, 0.177863734221904, 0.1778564838576417,
+    -0.1781427965628869, -0.1781403314113034, 0.09360597412461745,
+    0.09352481742042704,
+};
+
+constexpr double kGainsA1To9_10_3[] = {
+    0.05634513174616869, 0.05634907461532406, 0.03378588818969121, 0,
+    0.2009029617934434, 0.2009006186865949, 0.05717813779251716,
+    0.0571805255969697, 0.2009005122101561, 0, 0.1834979095197539,
+    0.1835026011944726, 0.07605954897277119, 0.07603954669521036,
+    0.08513221407907143, 0.1868770119479014, 0.0829450087652578,
+    0.08293010234716865, 0.08403100528092868, 0.08403250069117256,
+    0.08293530205461218, 0.1377314581112891, 0.1286487213857714,
+    0.1286358302882269,
+    0.1424405160728748, -0.1424447651561473, 1.779302517704502e-05, 0,
+    0.253871238955742, -0.253879197022048, 0.07506554729513466,
+    -0.07506943384845667, -1.332484359277458e-05, 0, 0.31314519554074,
+    -0.3131700230050198, 0.1195393960791561, -0.1195306481083304,
+    1.651241848450269e-05, 2.140907784524953e-05, 0.13143439689083,
+    -0.1314227690105947, 0.189380426713195, -0.1893811497639748,
+    1.0735314852914e-05, -7.40789286300353e-06, 0.1136022751577427,
+    -0.113578476811769,
+    0.0004405167723881627, 0.0004244515093607814, -3.098906731227431e-05, 0,
+    -0.2571118440100679, -0.2570923441647796, 3.790856536726996e-06,
+    2.034760936260344e-05, -0.2570837372234621, 0, -0.2623633093875167,
+    -0.2623500106959707, 0.1295230344759835, 0.1294877136312351,
+    0.1366306790061282, 0.4736829748884767, 0.135361270245709,
+    0.1353236815838757, 0.1359871642773514, 0.1359866000616586,
+    0.1353372596267004, -0.2710460679763523, -0.2638954257778223,
+    -0.2639133764522598,
+    0.0746074410814683, 0.07462281003049163, 0.09841829092408336, 0,
+    -0.2538738427515864, -0.2538797785697299, 0.1448482997652191,
+    0.144848405888255, -0.3590391167846038, 0, -0.01998587783523549,
+    -0.01998387583540835, 0.1195528048604623, 0.1195162140893727,
+    0.1928926002204532, -8.707342237149854e-06, -0.1314509271923652,
+    -0.1314430986909031, -9.791909432877099e-05, -0.0001040336505291438,
+    -0.1858785768193519, 0.1845050591527886, 0.1136289894747571,
+    0.1135806277385521,
+};
+
+constexpr double kGainsA1To0_7_0[] = {
+    0.250471347095322, 0.250474302446284, 0.1950790092583408, 0,
+    0.277702594282985, 0.2776958527785244, 0.3385859713904875,
+    0.3385715339214466,
+    0.2517067792357455, -0.2517036899132487, 1.30516353425407e-05, 0,
+    0.4400045172454103, -0.4399995899193188, 0.2594909098760387,
+    -0.2594806176298056,
+    3.453088266586936e-05, -9.180245107821538e-06, -4.301109171843267e-05, 0,
+    -1.834589524484913e-05, -2.991777279726903e-07, -8.06273718908271e-06,
+    -1.697462609528654e-05,
+    0.3001861641158459, 0.3001958437064288, 0.2702820155944484, 0,
+    0.04981246797758462, 0.04979268604582358, -0.4754356881629053,
+    -0.4754328730675854,
+};
+
+constexpr double kGainsA1To4_7_0[] = {
+    0.1532499448838317, 0.1532593930222213, 0.140433089331811, 0,
+    0.1948786518429054, 0.1948803149612197, 0.2285716632404736,
+    0.2285555614829507, 0.1776371738522855, 0.1776268417999804,
+    0.1779330569441871, 0.177936921517789,
+    0.1731589571087019, -0.1731693550848642, 6.122215547293489e-06, 0,
+    0.3622551478103167, -0.3622663261211103, 0.1842739797397464,
+    -0.1842512746663285, 0.1736648215135071, -0.173630948388865,
+    0.1661930300009858, -0.1662107229981336,
+    -0.2218744647201119, -0.2219056423403379, -0.1641566955217328, 0,
+    -0.2170272771392923, -0.2170114484223909, -0.2638770853647306,
+    -0.2638715434701018, 0.3424311068499599, 0.3424312920356551,
+    0.3432355065067689, 0.3432337027509501,
+    0.2036652146493657, 0.2036657479398881, 0.2461673064627439, 0,
+    0.03299361214873855, 0.03296760868266777, -0.3723435892970235,
+    -0.3723280143207133, 0.1740053652023914, 0.1740048192374424,
+    -0.1744302573087335, -0.1744278435315092,
+};
+
+constexpr double kGainsA1To3_1_2Ch[] = {
+    0.5014948853466521, 0.5014987057660003, 0.1082218361088837, 0,
+    0.1218285405373234, 0.1218151101910272,
+    0.5585162348047247, -0.5585060705167022, 1.237934076772879e-05, 0,
+    0.1043372896418495, -0.1043276013308286,
+    -0.1888202008954813, -0.1888208736759966, -0.140756774646952, 0,
+    0.2373605493064364, 0.2373619861653989,
+    -0.09461285079483217, -0.09460019988222401, 0.2031918204312814, 0,
+    0.1539296985579603, 0.1538973485815448,
+};
+
+constexpr double kGainsA1To7_1_2Ch[] = {
+    0.1532499448838317, 0.1532593930222213, 0.140433089331811, 0,
+    0.1948786518429054, 0.1948803149612197, 0.2285716632404736,
+    0.2285555614829507, 0.3034548450147723, 0.3034472456286675,
+    0.1731589571087019, -0.1731693550848642, 6.122215547293489e-06, 0,
+    0.3622551478103167, -0.3622663261211103, 0.1842739797397464,
+    -0.1842512746663285, 0.2911810400131434, -0.2911596777267641,
+    -0.2218744647201119, -0.2219056423403379, -0.1641566955217328, 0,
+    -0.2170272771392923, -0.2170114484223909, -0.2638770853647306,
+    -0.2638715434701018, 0.5851352610448957, 0.5851341707826196,
+    0.2036652146493657, 0.2036657479398881, 0.2461673064627439, 0,
+    0.03299361214873855, 0.03296760868266777, -0.3723435892970235,
+    -0.3723280143207133, 0.05066454741527163, 0.05066570824856623,
+};
+
+constexpr double kGainsA1To9_1_6Ch[] = {
+    0.05634513174616869, 0.05634907461532406, 0.1715173463009803, 0,
+    0.3429610763210956, 0.3429587332142471, 0.2460244250510248,
+    0.2460139217579329, 0.1834979095197539, 0.1835026011944726,
+    0.1694980549467219, 0.1694780526691611, 0.2350276292217794,
+    0.2350127228036902, 0.08403100528092868, 0.08403250069117256,
+    0.1424405160728748, -0.1424447651561473, 1.038513231404149e-05, 0,
+    0.2538618168684794, -0.2538886191093107, 0.1886794984959615,
+    -0.1886362346171415, 0.31314519554074, -0.3131700230050198,
+    0.1195501006180788, -0.1195199435694078, 0.1314526924436833,
+    -0.1314044734577414, 0.189380426713195, -0.1893811497639748,
+    0.0004405167723881627, 0.0004244515093607814, -0.2710770570436645, 0,
+    -0.4388974979335584, -0.4388779980882701, -0.1672791552779299,
+    -0.1672805491995415, -0.2623633093875167, -0.2623500106959707,
+    0.3663645219202218, 0.3663292010754735, 0.4679006517191915,
+    0.4678630630573583, 0.1359871642773514, 0.1359866000616586,
+    0.0746074410814683, 0.07462281003049163, 0.282923350076872, 0,
+    -0.5077528369412085, -0.507758772759352, 0.3948729548965643,
+    0.3948246992833954, -0.01998587783523549, -0.01998387583540835,
+    0.1195484511893437, 0.1195118604182541, -0.2628912830097522,
+    -0.26288345450829, -9.791909432877099e-05, -0.0001040336505291438,
+};
+
+constexpr double kGainsA1To0_1_0[] = {
+    0.6237579325949303,
+    3.948547277199399e-06,
+    -1.957299779333431e-07,
+    0.07402784368008516,
+};
+
+// -------------------------------------------------------
+// Input layout: A2
+constexpr double kGainsA2To0_2_0[] = {
+    0.6118586513784945, 0.6118689654196851,
+    0.5611944387933552, -0.5611866922844984,
+    -8.419558899235199e-07, 4.579604857514417e-07,
+    0.07260278827224946, 0.07262970014913316,
+    0.2465018078653151, -0.2464936165381823,
+    2.350643989934632e-06, 1.408721032430941e-05,
+    0.09240399656598815, 0.09239746853504276,
+    -1.441476147919184e-07, 1.732482430331373e-06,
+    0.1585288898568444, 0.1585479592316228,
+};
+
+constexpr double kGainsA2To0_5_0[] = {
+    0.2387812870896569, 0.2387833441483155, 0.1574127692173717, 0,
+    0.4452993380132335, 0.4452949914990141,
+    0.2960049750469942, -0.2960076621363878, 8.723024143222528e-06, 0,
+    0.4298154151818306, -0.4297933910890372,
+    1.628315787440678e-05, 9.440979636569794e-06, -3.880398381429344e-05, 0,
+    -4.193435922616849e-06, 1.023032108479906e-05,
+    0.2930224725563674, 0.2930337961410848, 0.2529224451339029, 0,
+    -0.4102691838791785, -0.4102853132018779,
+    0.3780367396402476, -0.378036479199733, 3.620842392213302e-05, 0,
+    -0.1010753172493527, 0.1010849416062643,
+    4.667589812392902e-06, 1.39362682666644e-05, -1.347674773059164e-05, 0,
+    2.547691153210508e-06, 1.614233603634477e-06,
+    0.1243839306872457, 0.1244052690379288, 0.1628615202790054, 0,
+    0.08738859387765373, 0.08737278193171516,
+    2.623648217638676e-05, 2.066279813515429e-05, -4.441264855642892e-06, 0,
+    -1.579863428514747e-06, 9.751222302484946e-06,
+    -0.03831091833552695, -0.0382963163067612, 0.2595513522774605, 0,
+    -0.07736700233898075, -0.07738651581810004,
+};
+
+constexpr double kGainsA2To2_5_0[] = {
+    0.1515980545815242, 0.1516056816871222, 0.1020025652122746, 0,
+    0.4540714800671332, 0.4540657861076717, 0.1148273222639815,
+    0.114814663730148,
+    0.2152678790143128, -0.2152736385428219, 1.166792728109675e-05, 0,
+    0.4400348921307396, -0.4400131985228399, 0.0983412550869769,
+    -0.09833212354188181,
+    -0.1840079134444613, -0.1840176620176594, -0.1326677923903435, 0,
+    0.008540144659069935, 0.008553034446216325, 0.2237199605917945,
+    0.2237213148776326,
+    0.2005447441365009, 0.200569056241842, 0.1915148334139307, 0,
+    -0.4097265224960455, -0.4097440420746801, 0.1450836973368931,
+    0.1450532064424711,
+    0.2830854141580555, -0.2830949265373006, 3.223244089864202e-05, 0,
+    -0.09365529061379821, 0.09366082486360675, 0.1251282027622235,
+    -0.1251021019900302,
+    -0.1309265544872823, 0.1309477245110413, -9.390242402424657e-06, 0,
+    0.004924277155594055, -0.004921393833860412, 0.1420999094327114,
+    -0.1421055234355264,
+    -0.002629455876297716, -0.002630630460167377, 0.03592754340539372, 0,
+    0.09136017957201231, 0.09134483548098761, 0.1275855237890106,
+    0.1276223589331018,
+    -0.1541428513964222, -0.154153180522775, -0.1191927328514673, 0,
+    0.004004749012971985, 0.004014925426875235, 0.2195165951879353,
+    0.2195204713808656,
+    -0.03801155637226188, -0.03797900342288847, 0.2133238518656626, 0,
+    -0.08492720071659984, -0.08494516160399154, 0.037350700372262,
+    0.03731617243668121,
+};
+
+constexpr double kGainsA2To4_5_0[] = {
+    0.1558928752131017, 0.1559001058586213, 0.103437020261511, 0,
+    0.334666993288848, 0.3346575949191183, 0.1184836077292347,
+    0.1184702374586769, 0.1599217826131563, 0.1599280957668115,
+    0.2240715196671441, -0.2240758176112155, 1.18320125388314e-05, 0,
+    0.3359495692957308, -0.3359251409679889, 0.1049928781886018,
+    -0.1049824298796414, 0.1453200754294627, -0.1453253583618874,
+    -0.1849214330278705, -0.1849314187984161, -0.1345334904173425, 0,
+    -0.2650395757544078, -0.2650283939307942, 0.2290473438891668,
+    0.2290478488074814, 0.3162773817760949, 0.3162808336569509,
+    0.2049954689520673, 0.2050202678520044, 0.1942080933258023, 0,
+    -0.3749337594604207, -0.3749441987108041, 0.1486097918503616,
+    0.148578319797157, -0.0945352512632599, -0.09454591650540076,
+    0.2909465854848255, -0.290956455616431, 3.268572349501644e-05, 0,
+    -0.09064046776176282, 0.09063822459318234, 0.1303029030156287,
+    -0.130275316293501, -0.0243103772612718, 0.02432074030065022,
+    -0.1285298032142125, 0.1285515299229943, -9.522296734585154e-06, 0,
+    -0.1764423555790045, 0.1764427330384935, 0.1494439811285427,
+    -0.1494478764369442, 0.2138068443459315, -0.2138052047460068,
+    -0.006783505920868712, -0.006783578499435862, 0.03643278997382341, 0,
+    -0.1263591751591275, -0.1263630623841589, 0.126405167459336,
+    0.1264426374051533, 0.1865083681681428, 0.1864934594049029,
+    -0.1550876056148077, -0.1550978377756178, -0.1208689320442548, 0,
+    0.08750179116250913, 0.08751586886126962, 0.2241273335225272,
+    0.2241300211785316, -0.1528708660982268, -0.1528763171851061,
+    -0.04490616803505294, -0.04487073031585084, 0.2163238105019424, 0,
+    -0.0163972896882772, -0.01639614089855117, 0.03227183648751117,
+    0.03223776806536828, -0.06803789608785757, -0.06806662188949596,
+};
+
+constexpr double kGainsA2To4_5_1[] = {
+    0.083244646815214, 0.08325105252603771, 0.03459192751912285, 0,
+    0.3535034289366458, 0.3534944721861464, 0.1186154863189586,
+    0.1186021011665747, 0.1600997841068763, 0.1601061042874091,
+    0.1486346245111291,
+    0.1699267758792992, -0.1699283576818666, 1.674892414171061e-05, 0,
+    0.3642480074888358, -0.3642356027074437, 0.1051097408751111,
+    -0.1050992809366243, 0.1454818244424569, -0.1454871132550678,
+    -6.542841014479262e-06,
+    -0.01824602872549467, -0.01825894925419956, 0.009701758570802136, 0,
+    -0.300884131085259, -0.300880719851668, 0.2293022858281489,
+    0.2293027913084646, 0.3166294154107011, 0.316632871133685,
+    -0.2955013989748601,
+    0.1396917683275942, 0.1397122250715969, 0.09879703415095258, 0,
+    -0.3511447879509852, -0.3511577097082726, 0.1487752024936057,
+    0.1487436954103233, -0.09464047405192004, -0.09465115116504555,
+    0.2076530993904434,
+    0.2297553827410623, -0.229773823703602, 4.309716917080635e-05, 0,
+    -0.05103331514275522, 0.05102470762841811, 0.1304479371128845,
+    -0.1304203196852602, -0.02433743601083483, 0.0243478105848301,
+    5.149588608414882e-06,
+    -0.02937047178734399, 0.02939294863232859, -2.545314017111238e-06, 0,
+    -0.2220553059959653, 0.222088142853139, 0.1496103202690505,
+    -0.1496142199131385, 0.2140448227941407, -0.2140431813692537,
+    7.390566714704431e-06,
+    -0.1595217249841816, -0.1595171944582119, -0.07346292555006274, 0,
+    -0.1077052184243569, -0.1076919703380743, 0.1265458631685386,
+    0.1265833748204087, 0.1867159619529464, 0.186701036595456,
+    0.1777250701266898,
+    -0.03018606965678206, -0.03020009908334846, 0.0252814625429958, 0,
+    0.05083469174008814, 0.05083804790949863, 0.2243767992269397,
+    0.2243794898744489, -0.1530410195449126, -0.1530464766991431,
+    -0.3187282322431845,
+    -0.04073349420481552, -0.04070969719131522, 0.1297185101892533, 0,
+    -0.01371896136608847, -0.01372481913575916, 0.03230775676682522,
+    0.03227365042470713, -0.06811362590361696, -0.0681423836786083,
+    0.1080340194273678,
+};
+
+constexpr double kGainsA2To3_7_0[] = {
+    0.1195978337007338, 0.1305131255751089, 0.1305211719471518,
+    0.1387316039812181, 0.1387282645586524, 0.1944362781080075,
+    0.1944297201368527, 0.1987838536988546, 0.1987761627565559,
+    0.2208069419189511, 0, 0,
+    5.213897382654187e-06, 0.1474683513309846, -0.1474772066187932,
+    0.1548694090901413, -0.1548446906535705, 0.3665803489706761,
+    -0.3665740045334068, 0.1665117534698578, -0.1664963857389515,
+    -9.529203530359053e-06, 0, 0,
+    -0.1398017038953153, -0.1889562172298121, -0.1889827692045405,
+    0.2642068601899044, 0.2642175443461997, -0.1384095544721782,
+    -0.1384068243019711, -0.2186942976645291, -0.2186830272571477,
+    0.4348540870128828, 0, 0,
+    0.2096448687483216, 0.1734485696224125, 0.1734490237916651,
+    0.1538837326779549, 0.1538732848586921, 0.001174806526535458,
+    0.001169557967789256, -0.3259153105462503, -0.3259123892715211,
+    -0.2062399849857609, 0, 0,
+    7.812211543663557e-06, 0.2475549305072735, -0.2475603904374238,
+    0.1328280687082889, -0.1327817271721859, 0.00180759756506494,
+    -0.001808851149808357, -0.2676487079506361, 0.2676332603094326,
+    -9.610993344569682e-06, 0, 0,
+    -2.19967133625454e-05, -0.1121153073621469, 0.1121201613121146,
+    0.2367683745602023, -0.2367518488561447, -0.06288225246618108,
+    0.06288877579114273, -0.1009530806669904, 0.1009546778057713,
+    -3.579557657722015e-07, 0, 0,
+    0.03265076703721635, 0.03875936819806534, 0.03879936287727344,
+    0.1348091700966869, 0.1348354711115782, -0.01015954852589944,
+    -0.01018055501295009, -0.02640818291106803, -0.0264183768364211,
+    0.2544411455113469, 0, 0,
+    -0.07648159833353092, -0.1380386688018389, -0.1380635949760815,
+    0.2228649642786304, 0.2228806150240878, -0.06613026101324811,
+    -0.06611217463640691, 0.1647605367426007, 0.1647516304124837,
+    -0.3007951338347954, 0, 0,
+    0.244533793642146, 0.03495045731528188, 0.0349347937350936,
+    0.0109857379362218, 0.01096904079487997, -0.3562471924513201,
+    -0.356257224398994, 0.1860289753637932, 0.1860473274046621,
+    -0.00291279467641446, 0, 0,
+};
+
+constexpr double kGainsA2To4_9_0[] = {
+    0.1145965046718976, 0.1146127883451714, 0.08781760014936386, 0,
+    0.1665274083847115, 0.1665288527626934, 0.1960443815572031,
+    0.1960303759447728, 0.1552646911821167, 0.1552536334701868,
+    0.1554726581171227, 0.1554760348675742, 0.06756135776768844,
+    0.06753363960969419,
+    0.1405413354273865, -0.140565408018947, -7.837430181447304e-06, 0,
+    0.3172142199053371, -0.3172215663156457, 0.1614082546031307,
+    -0.1613861320778906, 0.1517986057166042, -0.1517684836997949,
+    0.1452145687740127, -0.1452300283931744, 0.02288684722685036,
+    -0.02284605177273455,
+    -0.1693608954189958, -0.1693631915409179, -0.1039911841511917, 0,
+    -0.1798927404144326, -0.1798788790252182, -0.2210368039422222,
+    -0.2210321147094699, 0.2992353203468352, 0.2992331773403897,
+    0.2999090639662484, 0.2999074878976046, -0.123024332497333,
+    -0.1230344018895237,
+    0.1395071561907384, 0.1395325622032613, 0.1383937554791514, 0,
+    0.02877047833864942, 0.02874767197786197, -0.3260831572606476,
+    -0.3260696665589237, 0.1521732602557304, 0.1521670571274049,
+    -0.1524120150891861, -0.1524099060018271, 0.08008561342912805,
+    0.08001617892454908,
+    0.226914718943141, -0.2269526228152504, -1.362609088953571e-05, 0,
+    0.04956764708588871, -0.04952811119314442, -0.2545813732319601,
+    0.2545662629845039, 0.1402114490411463, -0.1401737975289991,
+    -0.1237518865568691, 0.1237452518154433, 0.05623661386119647,
+    -0.05615688249030328,
+    -0.1089348085389566, 0.1089195759627088, -2.074588436807087e-05, 0,
+    -0.1554963644374321, 0.1554726791847282, -0.1149459838033587,
+    0.1149508587963826, 0.216324251070076, -0.2163004713477907,
+    0.2109474886676003, -0.2109500765113263, -0.01436077296393577,
+    0.01434791874315977,
+    0.04196999408049309, 0.04197917624535849, 0.04969078526811607, 0,
+    -0.02010332159988387, -0.02013057833315375, -0.03593226121131708,
+    -0.03592919258809248, 0.1611982886564856, 0.1612239182471279,
+    0.1615524983689338, 0.1615386613282233, 0.08271903154756788,
+    0.08275428068319191,
+    -0.1123634574487665, -0.1123480246165369, -0.01941123845851941, 0,
+    -0.02676869825387498, -0.0267636380337624, 0.18375766344231,
+    0.1837593821423789, 0.2164930971734338, 0.2165204101121711,
+    -0.2179487342613077, -0.2179523748938952, -0.0663142219623301,
+    -0.06632807756003641,
+    -0.007250550215986229, -0.007248816657661543, 0.1669762796453822, 0,
+    -0.3273690859600049, -0.3273747991566756, 0.1859897708984876,
+    0.1860164367837793, 0.000672163691259792, 0.0006536656670694502,
+    0.0003200986579426941, 0.0002912597365104517, 0.08334965142626859,
+    0.08329357063312666,
+};
+
+constexpr double kGainsA2To9_10_3[] = {
+    0.04527216274130702, 0.04527533075615654, 0.02714627122310898, 0,
+    0.1614214271873064, 0.1614195445488019, 0.04594146608883792,
+    0.04594338464095449, 0.1614194589971577, 0, 0.1474368231117466,
+    0.147440592776575, 0.06111229439728568, 0.06109622297572951,
+    0.06840199553846246, 0.1501518629085439, 0.06664462073345361,
+    0.06663264373092102, 0.06751719675679899, 0.06751839828839237,
+    0.06663682158966934, 0.1106644139959045, 0.1033666205143577,
+    0.1033562627807282,
+    0.1144480459049673, -0.1144514599566068, 1.429633238066089e-05, 0,
+    0.20398035622879, -0.2039867503725562, 0.06031363434768604,
+    -0.06031675711391347, -1.070623972186509e-05, 0, 0.2516057699189384,
+    -0.2516257182794888, 0.09604746365086107, -0.0960404348349438,
+    1.326739105430885e-05, 1.720175685661348e-05, 0.1056048538967485,
+    -0.105595511132431, 0.1521633055505442, -0.1521638865070804,
+    8.6256062598228e-06, -5.952090639789246e-06, 0.09127710823169345,
+    -0.09125798674668657,
+    0.0003539462308771384, 0.0003410381201013221, -2.489908276162645e-05, 0,
+    -0.2065841162139589, -0.2065684484864736, 3.045875814662937e-06,
+    1.634888860691968e-05, -0.2065615329848863, 0, -0.2108035614052352,
+    -0.210792876178149, 0.1040691132281072, 0.1040407336506343,
+    0.1097799604637772, 0.380594597303355, 0.1087600164472145,
+    0.1087298147250248, 0.1092629095203371, 0.1092624561845498,
+    0.1087407244051589, -0.2177799806218603, -0.2120345856376926,
+    -0.2120490086380347,
+    0.05994555535993361, 0.05995790399662652, 0.07907708697015106, 0,
+    -0.2039824483255792, -0.2039872176342429, 0.1163826509327227,
+    0.116382736200415, -0.2884805984444784, 0, -0.01605824471155285,
+    -0.01605663614557433, 0.09605823733282152, 0.09602883739546653,
+    0.1549852652419794, -6.996171676026102e-06, -0.105618135656469,
+    -0.105611845615409, -7.86759926998475e-05, -8.358891374227579e-05,
+    -0.1493496406716707, 0.1482460472750159, 0.09129857263988485,
+    0.09125971497243304,
+    0.1396966859531281, -0.1397156754568523, 3.706028706589886e-05, 0,
+    -0.3189740904532463, 0.3189781106668962, 0.1407241425077667,
+    -0.1407246310450676, 9.669611041511263e-06, 0, -0.03981754688458117,
+    0.03980134811870476, 0.1405859222442805, -0.1405686537365468,
+    2.255377890019452e-05, 6.371856305476759e-06, -0.1506847566268255,
+    0.1506844120223284, 0.0003364439919131474, -0.0003232377391860551,
+    -1.554793556383444e-05, -7.559212917254758e-06, 0.135304269889077,
+    -0.1352510736511721,
+    0.0009730688878223274, -0.0009482936285087621, -8.160748919071729e-07, 0,
+    -0.1227573957779788, 0.1227579445056068, -3.084588987159803e-06,
+    -1.403743555847376e-05, 3.904867928715526e-06, 0, -0.1845581744187248,
+    0.1845505638107848, 0.1438345999947781, -0.1438115613913774,
+    2.180059659996941e-05, 3.073625642294028e-05, 0.151541506850711,
+    -0.151507684009504, 0.2159655677028884, -0.2159523017929593,
+    1.48152922413142e-05, 8.287980605542593e-06, -0.1335550544652599,
+    0.1335624098612611,
+    -0.09504508257274258, -0.09506038753696319, -0.0620921099266234, 0,
+    0.01960565070425638, 0.01958813529648235, -0.09655183605235909,
+    -0.09654275569990954, 0.01959334527450319, 0, 0.04875062235541777,
+    0.04872687052721388, 0.01648513557382058, 0.0164697833227648,
+    0.002653922577743261, 0.4421309926024963, 0.00644221301634432,
+    0.00640693398885952, 0.004546269451529577, 0.004546580400237256,
+    0.006424773140092841, 0.1308612358296462, 0.1446135790073433,
+    0.1446895365207888,
+    0.0001741199594406345, 0.0001555509276145377, -6.440912552443683e-05, 0,
+    0.1227468960475624, 0.1227317324745144, 7.840370024516181e-06,
+    3.562788467157961e-05, 0.1735703491164713, 0, -0.003192082873676838,
+    -0.003181476347463243, 0.1438437910052357, 0.1438269476499867,
+    0.2176063885521262, -8.348509113818605e-06, -0.151546647611139,
+    -0.1515473702437191, -0.0001944111210222419, -0.0001922690965412609,
+    -0.2142967754972712, -0.2030897109023111, -0.1335795555466304,
+    -0.1335698709855857,
+    -0.09641952342842375, -0.09640185815983239, 0.1075549205128884, 0,
+    -1.304686168883046e-06, 8.845522008178281e-06, 0.09899267496157001,
+    0.0989823548580024, 0.3189855529990175, 0, -0.2821211420146936,
+    -0.2821343070980657, 1.886062700767292e-05, -3.240163414925708e-05,
+    0.1601259420079839, 2.114316238198158e-06, 2.235701100231544e-05,
+    1.340600996130431e-05, -0.1554010663388199, -0.1554081212648376,
+    0.150688973741573, 0.1548570822092545, 2.375994218991002e-05,
+    5.608489817326257e-07,
+};
+
+constexpr double kGainsA2To0_7_0[] = {
+    0.2209366288465176, 0.2209392357126768, 0.1720759646326084, 0,
+    0.244956861191253, 0.2449509146217704, 0.2986610802443155,
+    0.2986483451918795,
+    0.222026383085632, -0.2220236580453997, 1.151263147244382e-05, 0,
+    0.3881207006102935, -0.3881163542975176, 0.2288926358610951,
+    -0.2288835572410758,
+    3.045911995829368e-05, -8.097742235302201e-06, -3.793937197799487e-05, 0,
+    -1.618261048847941e-05, -2.638997211089827e-07, -7.11200699996016e-06,
+    -1.497303667231635e-05,
+    0.2647892459367107, 0.2647977841433232, 0.2384112915740158, 0,
+    0.04393875338285431, 0.04392130406832775, -0.4193739499315302,
+    -0.4193714667825509,
+    0.357259727950629, -0.357256272507393, 3.42696678937221e-05, 0,
+    0.07058286304617674, -0.07055004425798965, -0.3380292569111507,
+    0.3380346411492054,
+    1.980020964243926e-06, 2.286192212306864e-05, -2.284620248290742e-05, 0,
+    -7.904137114150914e-06, -9.68145752651212e-06, -1.229667861444472e-06,
+    2.562079482013371e-05,
+    0.1583973452823449, 0.1584184983755961, 0.1833814259270353, 0,
+    0.1454069359813672, 0.1454158954434713, 0.1271298319056872,
+    0.127095276058015,
+    1.920291628109819e-05, 8.662380431620887e-06, -1.935899982813849e-05, 0,
+    -1.282912320534406e-05, 1.394413454140164e-05, 7.003463110551722e-06,
+    -5.248448141598118e-06,
+    0.05317686895192222, 0.05319635205024393, 0.2693360299667868, 0,
+    -0.3866137435522458, -0.386622604045768, 0.2003952893950891,
+    0.2004068177784596,
+};
+
+constexpr double kGainsA2To4_7_0[] = {
+    0.1313810026949889, 0.1313891025732379, 0.1203931270706435, 0,
+    0.1670692456194794, 0.1670706714089105, 0.1959542258038554,
+    0.1959404217855237, 0.1522881462326683, 0.1522792885760293,
+    0.1525418064693751, 0.1525451195639096,
+    0.1484489761337592, -0.1484578903068457, 5.248568395427391e-06, 0,
+    0.3105609244219836, -0.3105705075750582, 0.1579778723389165,
+    -0.1579584073054107, 0.1488826531101612, -0.148853613719098,
+    0.1424770947813338, -0.1424922629675783,
+    -0.1902127251624066, -0.1902394537006128, -0.1407313475583288, 0,
+    -0.1860572367862018, -0.1860436668452831, -0.2262215238624017,
+    -0.2262167728024668, 0.29356579675122, 0.293565955510705, 0.294255407658155,
+    0.2942538613003519,
+    0.1746019558767673, 0.174602413066123, 0.2110389506392054, 0,
+    0.0282853860072622, 0.02826309326550289, -0.3192097337847405,
+    -0.3191963813753407, 0.1491746008256464, 0.1491741327705193,
+    -0.1495388603430689, -0.1495367910146117,
+    0.2492011040944435, -0.2492066003316582, 7.864160645524177e-06, 0,
+    0.04855799317161622, -0.04852196947308759, -0.2493825365597554,
+    0.2493646604615868, 0.1374404961839927, -0.1374047142217153,
+    -0.1214190106350215, 0.1214125009666669,
+    -0.1128608439479819, 0.112865730175409, -2.214298557965578e-05, 0,
+    -0.1511144650604089, 0.1510970345646112, -0.1119422346969399,
+    0.1119524821970697, 0.2122138553333601, -0.2121923833756087,
+    0.2069708679406046, -0.2069734070002798,
+    0.03901710755333613, 0.03905736818638488, 0.03286788584065672, 0,
+    -0.007961562180954904, -0.007988256436743361, -0.02375758851419715,
+    -0.02375472948685919, 0.1582664991770458, 0.1582886609908332,
+    0.1585070342225265, 0.1584934580271252,
+    -0.1389565887565093, -0.1389816806830947, -0.07699018035540062, 0,
+    -0.02640008411152328, -0.02639537058173121, 0.1786613963785415,
+    0.1786628815574012, 0.2123414305907085, 0.2123737410826162,
+    -0.2138401314068235, -0.2138437034089897,
+    0.03518286843944747, 0.03516710070067131, 0.2461598774831719, 0,
+    -0.3211431738841052, -0.3211486896047186, 0.1819211163056446,
+    0.1819470766749066, 0.0005325513355549107, 0.0005226083211512367,
+    0.0003140644028496443, 0.000285769130708684,
+};
+
+constexpr double kGainsA2To3_1_2Ch[] = {
+    0.4726750772804064, 0.4726786781486573, 0.1020025652122746, 0,
+    0.1148273222639815, 0.114814663730148,
+    0.5264195351986497, -0.5264099550299046, 1.166792728109675e-05, 0,
+    0.0983412550869769, -0.09833212354188181,
+    -0.1779691192437189, -0.1779697533610177, -0.1326677923903435, 0,
+    0.2237199605917945, 0.2237213148776326,
+    -0.08917565835243543, -0.08916373445995035, 0.1915148334139307, 0,
+    0.1450836973368931, 0.1450532064424711,
+    0.216861123071042, -0.2168667221447187, 3.223244089864202e-05, 0,
+    0.1251282027622235, -0.1251021019900302,
+    -0.1274445647181197, 0.127467773558229, -9.390242402424657e-06, 0,
+    0.1420999094327114, -0.1421055234355264,
+    0.06197194662949289, 0.06195992213480852, 0.03592754340539372, 0,
+    0.1275855237890106, 0.1276223589331018,
+    -0.1513110662123996, -0.1513141995274732, -0.1191927328514673, 0,
+    0.2195165951879353, 0.2195204713808656,
+    -0.09806415590616065, -0.09804430322205804, 0.2133238518656626, 0,
+    0.037350700372262, 0.03731617243668121,
+};
+
+constexpr double kGainsA2To7_1_2Ch[] = {
+    0.1313810026949889, 0.1313891025732379, 0.1203931270706435, 0,
+    0.1670692456194794, 0.1670706714089105, 0.1959542258038554,
+    0.1959404217855237, 0.2601514920016094, 0.2601449770565825,
+    0.1484489761337592, -0.1484578903068457, 5.248568395427391e-06, 0,
+    0.3105609244219836, -0.3105705075750582, 0.1579778723389165,
+    -0.1579584073054107, 0.2496291729938008, -0.2496108591300894,
+    -0.1902127251624066, -0.1902394537006128, -0.1407313475583288, 0,
+    -0.1860572367862018, -0.1860436668452831, -0.2262215238624017,
+    -0.2262167728024668, 0.5016357909071134, 0.5016348562265096,
+    0.1746019558767673, 0.174602413066123, 0.2110389506392054, 0,
+    0.0282853860072622, 0.02826309326550289, -0.3192097337847405,
+    -0.3191963813753407, 0.04343465862615428, 0.04343565380721175,
+    0.2492011040944435, -0.2492066003316582, 7.864160645524177e-06, 0,
+    0.04855799317161622, -0.04852196947308759, -0.2493825365597554,
+    0.2493646604615868, 0.05158429039900753, -0.05155311146736688,
+    -0.1128608439479819, 0.112865730175409, -2.214298557965578e-05, 0,
+    -0.1511144650604089, 0.1510970345646112, -0.1119422346969399,
+    0.1119524821970697, 0.358564359562227, -0.3585446829907898,
+    0.03901710755333613, 0.03905736818638488, 0.03286788584065672, 0,
+    -0.007961562180954904, -0.007988256436743361, -0.02375758851419715,
+    -0.02375472948685919, 0.2703478979415624, 0.2703604599355188,
+    -0.1389565887565093, -0.1389816806830947, -0.07699018035540062, 0,
+    -0.02640008411152328, -0.02639537058173121, 0.1786613963785415,
+    0.1786628815574012, 0.06113362358312122, 0.06116340828807471,
+    0.03518286843944747, 0.03516710070067131, 0.2461598774831719, 0,
+    -0.3211431738841052, -0.3211486896047186, 0.1819211163056446,
+    0.1819470766749066, 0.000754628404539198, 0.000724677611329132,
+};
+
+constexpr double kGainsA2To9_1_6Ch[] = {
+    0.04527216274130702, 0.04527533075615654, 0.1378106852190135, 0,
+    0.2755622212596605, 0.275560338621156, 0.1976756014951344,
+    0.1976671623136215, 0.1474368231117466, 0.147440592776575,
+    0.1361882258515577, 0.1361721544300015, 0.1888399006104989,
+    0.1888279236079663, 0.06751719675679899, 0.06751839828839237,
+    0.1144480459049673, -0.1144514599566068, 8.344241740871648e-06, 0,
+    0.2039727857740817, -0.2039943208272645, 0.1516001240415626,
+    -0.1515653623984169, 0.2516057699189384, -0.2516257182794888,
+    0.09605606452928937, -0.0960318339565155, 0.105619553999855,
+    -0.1055808110293245, 0.1521633055505442, -0.1521638865070804,
+    0.0003539462308771384, 0.0003410381201013221, -0.217804879704622, 0,
+    -0.3526451769198607, -0.3526295091923755, -0.13440538527955,
+    -0.1344065052670999, -0.2108035614052352, -0.210792876178149,
+    0.2943664118797847, 0.2943380323023118, 0.3759486187169174,
+    0.3759184169947277, 0.1092629095203371, 0.1092624561845498,
+    0.05994555535993361, 0.05995790399662652, 0.227323134245167, 0,
+    -0.4079690357264233, -0.407973805035087, 0.3172723556092069,
+    0.3172335832094474, -0.01605824471155285, -0.01605663614557433,
+    0.09605473924698352, 0.09602533930962852, -0.2112277774290195,
+    -0.2112214873879595, -7.86759926998475e-05, -8.358891374227579e-05,
+    0.1396966859531281, -0.1397156754568523, 2.950107414864411e-05, 0,
+    -0.3189672530057074, 0.3189849481144351, 0.2760443603268455,
+    -0.275959756766238, -0.03981754688458117, 0.03980134811870476,
+    0.1405891081724333, -0.1405654678083941, -0.1506925647493434,
+    0.1506766038998105, 0.0003364439919131474, -0.0003232377391860551,
+    0.0009730688878223274, -0.0009482936285087621, 7.47190571363542e-06, 0,
+    -0.1227546346193868, 0.1227607056641989, -0.1335427237045573,
+    0.1335637877753924, -0.1845581744187248, 0.1845505638107848,
+    0.1438499681229896, -0.1437961932631659, 0.1515673509725316,
+    -0.1514818398876834, 0.2159655677028884, -0.2159523017929593,
+    -0.09504508257274258, -0.09506038753696319, 0.06876912590302281, 0,
+    0.03346023801398698, 0.03344272260621295, 0.04993834960645051,
+    0.05002338747234555, 0.04875062235541777, 0.04872687052721388,
+    0.2375506318750687, 0.2375352796240129, 0.2320507099725373,
+    0.2320154309450525, 0.004546269451529577, 0.004546580400237256,
+    0.0001741199594406345, 0.0001555509276145377, -0.2031541200278355, 0,
+    0.2454796669207357, 0.2454645033476877, 0.02029923779811735,
+    0.02033670987380903, -0.003192082873676838, -0.003181476347463243,
+    0.1438396167506788, 0.1438227733954298, -0.3030815250062276,
+    -0.3030822476388076, -0.0001944111210222419, -0.0001922690965412609,
+    -0.09641952342842375, -0.09640185815983239, 0.2624120027221428, 0,
+    0.2255555429399773, 0.2255656931481543, 0.2122425743414892,
+    0.2122090551447134, -0.2821211420146936, -0.2821343070980657,
+    1.9917785126772e-05, -3.1344476030158e-05, 0.1065766093518293,
+    0.1065676583507883, -0.1554010663388199, -0.1554081212648376,
+};
+
+constexpr double kGainsA2To0_1_0[] = {
+    0.6118638083990897,
+    3.873254428410355e-06,
+    -1.919977020860391e-07,
+    0.07261624421069131,
+    4.095663566378027e-06,
+    8.218927157122021e-06,
+    0.09240073255051545,
+    7.941674077697273e-07,
+    0.1585384245442336,
+};
+
+// -------------------------------------------------------
+// Input layout: A3
+constexpr double kGainsA3To0_2_0[] = {
+    0.610506789945564, 0.6105170811985591,
+    0.5599545166046754, -0.5599467872112203,
+    -8.400956437812909e-07, 4.569486521897216e-07,
+    0.07244237718846835, 0.07246922960533074,
+    0.2459571783394434, -0.2459490051105089,
+    2.345450396699686e-06, 1.405608555996701e-05,
+    0.09219983601530413, 0.0921933224076136,
+    -1.438291301212399e-07, 1.72865462439038e-06,
+    0.158178630705127, 0.1581976579473764,
+    0.1059067344883307, -0.1058960721762669,
+    -9.212001616405592e-06, 9.84777928747098e-06,
+    0.01444512295991118, -0.01446627885428585,
+    6.212977027002501e-06, -2.264795855921056e-05,
+    0.03964321344961628, 0.03966473439103411,
+    -1.752583633019016e-05, -1.304201672743763e-05,
+    0.04951994719344013, 0.04952430162219259,
+};
+
+constexpr double kGainsA3To0_5_0[] = {
+    0.2338078348043953, 0.2338098490176399, 0.1541340998277576, 0,
+    0.4360244277501195, 0.4360201717672032,
+    0.2898396400764882, -0.2898422711978826, 8.54133677195372e-06, 0,
+    0.4208630115620523, -0.4208414461977295,
+    1.594400437653935e-05, 9.244338340591785e-06, -3.799575564729311e-05, 0,
+    -4.10609300841015e-06, 1.001723900287256e-05,
+    0.2869192585921119, 0.286930346323723, 0.2476544539605709, 0,
+    -0.4017238986308827, -0.4017396920042378,
+    0.3701628073501904, -0.3701625523342571, 3.545425733355256e-05, 0,
+    -0.09897007159260826, 0.09897949548875321,
+    4.570370991345199e-06, 1.364599692210616e-05, -1.319604750229679e-05, 0,
+    2.494626608067496e-06, 1.580611564391814e-06,
+    0.1217932019418477, 0.1218140958470289, 0.1594693616635412, 0,
+    0.08556842192354483, 0.08555293931647372,
+    2.569001601973025e-05, 2.023242336894994e-05, -4.348760040399746e-06, 0,
+    -1.546957267924375e-06, 9.548119122015956e-06,
+    -0.03751295997510168, -0.03749866208446258, 0.2541452910158742, 0,
+    -0.07575556494672743, -0.07577467198965356,
+    0.1725367876215208, -0.1725375393094964, 4.075325713248351e-05, 0,
+    -0.16352362504694, 0.1635384365195783,
+    5.779290610335626e-06, 5.107706027881633e-06, -1.497797264048011e-05, 0,
+    -1.51969313496268e-05, 5.108987621172172e-06,
+    0.0246229266347055, -0.02464846080830347, -1.85696064526809e-06, 0,
+    0.05184473055133972, -0.05183860672775428,
+    2.480588184524338e-05, 2.240402345659602e-05, -8.993117625814622e-05, 0,
+    9.609916607392161e-06, 2.649687979172444e-06,
+    0.0999408784476359, 0.09995799057563934, 0.08954947877654947, 0,
+    -0.0399600041652171, -0.03996507658097821,
+    -1.017789399656191e-05, 3.967957802330902e-07, -2.564557366364079e-05, 0,
+    7.872901518301092e-06, -4.184708644718627e-06,
+    -0.1791099593082086, -0.1791243430705, 0.2701004619351547, 0,
+    -0.01785417407007995, -0.0178397549009724,
+};
+
+constexpr double kGainsA3To2_5_0[] = {
+    0.1475432207484164, 0.1475506438497748, 0.09927427523765553, 0,
+    0.4419263083819949, 0.4419207667203945, 0.1117560050721716,
+    0.1117436851195383,
+    0.2095100513072349, -0.20951565678409, 1.135584210010789e-05, 0,
+    0.4282651608285468, -0.428244047465397, 0.0957108951564507,
+    -0.09570200785524186,
+    -0.17908620442218, -0.1790956922476756, -0.1291192913582355, 0,
+    0.008311719118921529, 0.008324264139473339, 0.2177360627914349,
+    0.2177373808538265,
+    0.1951807200675815, 0.1952043818905192, 0.1863923347894433, 0,
+    -0.3987674572868994, -0.3987845082646646, 0.1412031047645282,
+    0.1411734294182388,
+    0.2755136526459698, -0.2755229105950556, 3.137031115535313e-05, 0,
+    -0.09115026743207814, 0.09115565365582247, 0.1217813651564454,
+    -0.1217559625086076,
+    -0.1274246268124665, 0.1274452305959211, -9.139079069890202e-06, 0,
+    0.004792566193542327, -0.004789759992788563, 0.1382991250358413,
+    -0.138304588879417,
+    -0.002559125114604843, -0.002560268281564652, 0.03496657976412021, 0,
+    0.08891654434100614, 0.08890161066250024, 0.1241729595585358,
+    0.1242088094631468,
+    -0.1500199512002471, -0.1500300040506864, -0.1160046528516226, 0,
+    0.003897632916820687, 0.003907537139451374, 0.2136451259296143,
+    0.2136488984449724,
+    -0.0369948510771128, -0.03696316883020883, 0.2076180215742282, 0,
+    -0.08265563009673002, -0.08267311057944851, 0.03635167116982406,
+    0.03631806676219861,
+    0.1261164656878066, -0.1261335520518729, 3.945961167825228e-05, 0,
+    -0.1647413932596963, 0.1647454620999331, 0.06785954761722965,
+    -0.06782207605859106,
+    -0.1527409386831182, 0.1527428834945877, -2.87941414863721e-05, 0,
+    0.007341305651168748, -0.007358045766753297, 0.1732515053364818,
+    -0.173246377527131,
+    -0.05389082301656458, 0.05387427827121506, 4.179365068804624e-06, 0,
+    0.0455127066351412, -0.04550564660310515, 0.06485935332604253,
+    -0.06488206577719892,
+    -0.01868360212403054, -0.0186963735952166, -0.06578851052684974, 0,
+    0.00157174238862177, 0.001566640422048306, -0.01129650672322881,
+    -0.01128750313103734,
+    -0.005840771200524682, -0.005847013818204486, -0.0179100086476445, 0,
+    -0.0406651498682271, -0.04067038145674867, 0.1236321152318951,
+    0.1236767028264234,
+    0.01144901756054266, 0.01145625992040252, -0.08364789008525689, 0,
+    -0.007742086530535475, -0.007751790271912551, 0.04362752093129507,
+    0.04363237973449083,
+    -0.1539606498102968, -0.1539356811716762, 0.2217087116645219, 0,
+    -0.02841495002039861, -0.02839981975016615, -0.005882757815817798,
+    -0.005932942836583561,
+};
+
+constexpr double kGainsA3To4_5_0[] = {
+    0.1507561148791148, 0.1507631072706857, 0.1000287106641749, 0,
+    0.3236395224447132, 0.3236304337566978, 0.1145795043789102,
+    0.1145665746664943, 0.154652267451897, 0.1546583725834907,
+    0.2166882335956738, -0.216692389920004, 1.144214088756047e-05, 0,
+    0.3248798368309256, -0.3248562134307008, 0.1015333021733856,
+    -0.1015231981422439, 0.1405316949587219, -0.14053680381547,
+    -0.1788281649373109, -0.1788378216709459, -0.1301005341566799, 0,
+    -0.25630636855805, -0.2562955551819868, 0.2215001015338853,
+    0.2215005898148497, 0.3058558592592779, 0.3058591973986647,
+    0.1982407497763475, 0.1982647315381996, 0.1878088244113537, 0,
+    -0.3625794753994194, -0.3625895706704695, 0.1437130133223149,
+    0.1436825782914521, -0.0914202600990467, -0.09143057391529524,
+    0.2813597273453217, -0.2813692722503864, 3.160871001568102e-05, 0,
+    -0.08765381196484982, 0.08765164270997049, 0.1260093470548508,
+    -0.1259826693311604, -0.02350933628073144, 0.02351935785197319,
+    -0.1242946719166249, 0.1243156827177958, -9.208531553926279e-06, 0,
+    -0.1706284779907279, 0.1706288430127087, 0.1445197155816739,
+    -0.1445234825374124, 0.2067617852585948, -0.2067601996844352,
+    -0.006559985480360759, -0.006560055667422176, 0.03523230848845605, 0,
+    -0.1221955673104338, -0.1221993264491538, 0.1222400441377699,
+    0.1222762794272173, 0.1803628096475682, 0.1803483921366933,
+    -0.1499773793794768, -0.1499872743846747, -0.1168862308791915, 0,
+    0.08461855657348789, 0.08463217040393826, 0.2167422083522653,
+    0.216744807448451, -0.1478336827110954, -0.1478389541815116,
+    -0.04342648384551901, -0.04339221381964527, 0.2091958159251261, 0,
+    -0.01585698951650542, -0.01585587858006479, 0.03120846082427222,
+    0.03117551497632822, -0.06579600809038315, -0.06582378736025596,
+    0.1220631563080472, -0.122083705726115, 3.975948522450083e-05, 0,
+    -0.1200922260048676, 0.1200900139826767, 0.06411375494502482,
+    -0.06407618260800085, -0.06165667322315706, 0.06167622738227458,
+    -0.1508835219796226, 0.1508848471230224, -2.901296273046139e-05, 0,
+    0.02490646621100791, -0.02492581127511105, 0.1782052284105085,
+    -0.1781972808062727, -0.03967508591054938, 0.03967887029109728,
+    -0.05919338526472451, 0.05917492583210083, 4.211126177720041e-06, 0,
+    -0.07697468152488809, 0.07696815618806627, 0.06301383412971305,
+    -0.06303601211389422, 0.1041456456425677, -0.1041355714526192,
+    -0.02348992753946945, -0.02350255487078797, -0.06628847069156088, 0,
+    -0.05429175430441019, -0.05428033279164917, -0.01676588632200045,
+    -0.0167555249583281, -0.02224317968018651, -0.0222583947986621,
+    -0.007234635364012371, -0.007241012363824861, -0.01804611586152951, 0,
+    0.05025031053748904, 0.0502315395746267, 0.1239382526619867,
+    0.1239820215983242, -0.1029982700744562, -0.1029844087252075,
+    0.006721944632193005, 0.006729573376782361, -0.08428357270779774, 0,
+    0.09561729478601388, 0.09562694031156403, 0.03806942457289799,
+    0.03807569365626018, -0.08352791170304322, -0.08354990052435046,
+    -0.1604583939900686, -0.1604331264147497, 0.2233935882959278, 0,
+    -0.03564232286697064, -0.0356466601158704, -0.01044918023893824,
+    -0.01049835854512928, 0.01509586928720979, 0.0151327089577869,
+};
+
+constexpr double kGainsA3To4_5_1[] = {
+    0.08043156126434028, 0.08043775050703959, 0.03342296284447027, 0,
+    0.3415574909553912, 0.3415488368802754, 0.1146071143282116,
+    0.1145941815001539, 0.154689533639134, 0.1546956402418667,
+    0.1436118160715673,
+    0.1641844419729074, -0.1641859703216358, 1.618292790894006e-05, 0,
+    0.3519389780676897, -0.351926992480956, 0.1015577684105247,
+    -0.1015476619446388, 0.1405655585453563, -0.1405706686331734,
+    -6.321738850872848e-06,
+    -0.01762944085189299, -0.01764192475729535, 0.009373907136533081, 0,
+    -0.2907163565312748, -0.2907130605734678, 0.2215534758839208,
+    0.2215539642825451, 0.3059295606146248, 0.3059328995583952,
+    -0.2855155230354209,
+    0.1349711657412122, 0.1349909311906612, 0.09545838692410857, 0,
+    -0.3392785555019217, -0.3392910405943889, 0.1437476435036313,
+    0.1437172011389119, -0.09144228942060943, -0.09145260572215359,
+    0.2006358801957234,
+    0.2219912612972048, -0.2220090790844744, 4.164078694664874e-05, 0,
+    -0.04930874681393588, 0.04930043017324814, 0.1260397112260222,
+    -0.1260130270738645, -0.02351500126930283, 0.02352502525541865,
+    4.975568609994656e-06,
+    -0.02837795571612172, 0.02839967300129948, -2.459300244960025e-06, 0,
+    -0.2145513931716522, 0.2145831203732267, 0.1445545401521056,
+    -0.1445583080155584, 0.2068116081517852, -0.2068100221955535,
+    7.14081736464648e-06,
+    -0.1541310088628245, -0.1541266314368754, -0.07098039361202076, 0,
+    -0.1040655370118593, -0.1040527366180293, 0.1222695000290268,
+    0.1223057440500053, 0.1804062712427046, 0.1803918502576765,
+    0.1717192085376412,
+    -0.02916599209458569, -0.02917954742487478, 0.02442712632192292, 0,
+    0.0491168354900088, 0.04912007824441863, 0.2167944362041532,
+    0.216797035926637, -0.1478693058402652, -0.1478745785809351,
+    -0.3079574521500319,
+    -0.03935698762609792, -0.03933399478484644, 0.1253349338194204, 0,
+    -0.013255356636314, -0.01326101645443043, 0.03121598105248236,
+    0.03118302726565613, -0.06581186279718662, -0.06583964876096368,
+    0.1043832268457312,
+    0.09300677405909748, -0.09302542033324566, 6.571823350923401e-05, 0,
+    -0.09478879711241248, 0.0947943477360117, 0.06412920428330877,
+    -0.06409162289256858, -0.06167153048433145, 0.06169108935536794,
+    8.046451610041976e-06,
+    -0.04041556177197449, 0.04044546355864951, -7.347990171017178e-06, 0,
+    -0.03795372862789111, 0.03796672175256945, 0.1782481700984512,
+    -0.1782402205791002, -0.03968464632116959, 0.03968843161363061,
+    -1.208677401120326e-05,
+    -0.1446452154450777, 0.144620063873226, -2.077483520668678e-05, 0,
+    -0.04694421433825624, 0.04689375275035099, 0.06302901842270718,
+    -0.0630512017510642, 0.1041707413698685, -0.1041606647523665,
+    2.202192712738016e-06,
+    0.04002106654758147, 0.04002199771659949, -0.0261867128941752, 0,
+    -0.05033293969775961, -0.05033217093959726, -0.01676992635755353,
+    -0.01675956249712814, -0.02224853956602825, -0.02226375835085457,
+    0.01591443072323332,
+    -0.125601429101627, -0.1256006706545738, -0.1034381617372197, 0,
+    0.06956656323528985, 0.06957522607603951, 0.1239681177664926,
+    0.124011897249726, -0.1030230893214089, -0.103009224632024,
+    0.1857902831686884,
+    -0.00386631951197669, -0.003851463815217882, 0.03193942289727261, 0,
+    0.09209533965978495, 0.0921012238689695, 0.03807859807114352,
+    0.03808486866515175, -0.0835480392242773, -0.08357003334417826,
+    -0.1193812060093712,
+    -0.1401255418017442, -0.1401216161287253, 0.1389243822636724, 0,
+    -0.05025388388562307, -0.05026582765653269, -0.01045169815292471,
+    -0.01050088830949466, 0.01509950690274968, 0.01513635545049416,
+    0.05157758309419374,
+};
+
+constexpr double kGainsA3To3_7_0[] = {
+    0.1140296126144269, 0.1244367116854927, 0.1244443834355455,
+    0.1322725551947795, 0.1322693712486349, 0.1853837380225979,
+    0.1853774853766495, 0.1895288997290945, 0.189521566860732,
+    0.2105266397433063, 0, 0,
+    4.97114939592575e-06, 0.1406025381466185, -0.1406109811510373,
+    0.1476590183779028, -0.1476354507792316, 0.3495131466158917,
+    -0.3495070975621448, 0.1587593199340728, -0.1587446676920733,
+    -9.085544056005796e-06, 0, 0,
+    -0.1332928335299923, -0.1801588171380963, -0.1801841329092834,
+    0.2519059500100627, 0.2519161367347362, -0.1319654996267801,
+    -0.1319628965674984, -0.2085123557176722, -0.2085016100365178,
+    0.4146082044425446, 0, 0,
+    0.1998842489889246, 0.1653731726618122, 0.165373605685909,
+    0.146719232965685, 0.1467092715746937, 0.001120110030194608,
+    0.001115105833194594, -0.310741385999465, -0.3107386007330817,
+    -0.1966378893816639, 0, 0,
+    7.448491568960945e-06, 0.2360292988012755, -0.2360345045286761,
+    0.1266438759838149, -0.1265996920111938, 0.0017234396621506,
+    -0.00172463488265124, -0.2551875526502588, 0.2551728242184158,
+    -9.16352591020544e-06, 0, 0,
+    -2.097259311400261e-05, -0.1068954568077145, 0.1069000847680825,
+    0.2257449419862004, -0.2257291856838196, -0.05995458836640469,
+    0.05996080797921302, -0.09625291967658167, 0.09625444245597357,
+    -3.412901056907204e-07, 0, 0,
+    0.03113061668101798, 0.03695481434776363, 0.03699294695966486,
+    0.1285327414998427, 0.1285578179953494, -0.009686541527538358,
+    -0.0097065699971741, -0.02517867401122951, -0.02518839332907217,
+    0.2425949062625194, 0, 0,
+    -0.07292077757802411, -0.1316118816054131, -0.1316356472699313,
+    0.2124888449535887, 0.212503767033583, -0.06305137653496937,
+    -0.06303413222141467, 0.1570896361376864, 0.1570811444673807,
+    -0.2867907513551891, 0, 0,
+    0.2331488196510621, 0.03332323826475965, 0.03330830394759222,
+    0.01047426531391512, 0.01045834555600595, -0.3396610799142925,
+    -0.3396706447957926, 0.1773678614352857, 0.1773853590441153,
+    -0.002777181143665378, 0, 0,
+    4.96897681525018e-06, 0.1828683811238352, -0.1828588442067553,
+    0.03836037917082301, -0.03830839125698456, -0.2341485300270633,
+    0.234170460384486, 0.1720658989519885, -0.1720806133986338,
+    2.829694453070151e-05, 0, 0,
+    -3.862270088430964e-05, -0.1625136973472048, 0.1625187333031836,
+    0.1593661524474496, -0.1593400674367338, -0.09921155113266332,
+    0.09918637602858167, 0.1202568696962665, -0.1202536721850885,
+    -1.323218259297273e-05, 0, 0,
+    2.55401441415803e-05, -0.03310097778385124, 0.03308417448802252,
+    0.1401506376624334, -0.1401619048305711, -0.04909855471961775,
+    0.04914958127792424, -0.03912840122011578, 0.03909843661013491,
+    1.777916923277307e-05, 0, 0,
+    -0.08449325429211982, -0.009987335308020972, -0.01002665362386626,
+    -0.03886843206257708, -0.03887085986333175, -0.1025840286112773,
+    -0.1025843922041468, -0.01756304801758939, -0.01755310614936338,
+    -0.02661208079053282, 0, 0,
+    -0.06060403233620783, -0.0299676476239327, -0.02994126479009979,
+    0.1027693662752704, 0.1027982627449026, -0.0145209104191835,
+    -0.01457449033851963, 0.08061319068377558, 0.08063061276861111,
+    -0.1394217282839001, 0, 0,
+    -0.06671559495372667, -0.02299881616823778, -0.02303421539378963,
+    0.01440914779058073, 0.01440525535208471, 0.07365207682995809,
+    0.07366255467165685, -0.0447292129248005, -0.04472760818576265,
+    -0.005675315322753874, 0, 0,
+    0.2383883012634017, -0.1072541246831498, -0.1072833163011304,
+    -0.03031885760262691, -0.03032870268812937, -0.004630033855107604,
+    -0.004620456470552663, -0.002928615206637011, -0.002936578600987761,
+    0.04025744491976422, 0, 0,
+};
+
+constexpr double kGainsA3To4_9_0[] = {
+    0.108791442084178, 0.1088069008828818, 0.08336906424829107, 0,
+    0.1580917058210795, 0.1580930770318683, 0.1861134512188938,
+    0.1861001550823499, 0.1473995189191779, 0.1473890213526906,
+    0.1475969509685228, 0.1476001566644751, 0.06413893304822904,
+    0.06411261899625385,
+    0.1334219974453638, -0.1334448506026925, -7.440413074682606e-06, 0,
+    0.3011452446295431, -0.3011522188961134, 0.1532318706651699,
+    -0.1532108687905463, 0.1441090133556816, -0.144080417216065,
+    0.1378585009533108, -0.1378731774416338, 0.02172747870188675,
+    -0.02168874980438289,
+    -0.1607816582019937, -0.1607838380103205, -0.09872335042190709, 0,
+    -0.170779996354986, -0.1707668371358087, -0.2098398439236958,
+    -0.2098353922312568, 0.2840770939415608, 0.2840750594924102,
+    0.2847167080393977, 0.2847152118089405, -0.1167923453001303,
+    -0.1168019046117382,
+    0.1324402061520728, 0.1324643251838695, 0.1313832064697709, 0,
+    0.02731306541045697, 0.02729141434102982, -0.3095649122921911,
+    -0.3095521049827581, 0.1444646891916211, 0.1444588002923226,
+    -0.144691349530962, -0.1446893472826741, 0.07602875323375759,
+    0.07596283604103715,
+    0.2154200040797934, -0.2154559878728346, -1.293584025173325e-05, 0,
+    0.04705672151723003, -0.04701918837607488, -0.2416851613491421,
+    0.2416708165345623, 0.1331088219625185, -0.1330730777457567,
+    -0.1174830439873001, 0.1174767453389283, 0.05338786150072659,
+    -0.05331216904532707,
+    -0.1034165478960125, 0.1034020869493946, -1.969496961688319e-05, 0,
+    -0.147619456408635, 0.1475969709689162, -0.109123217811534,
+    0.1091278458542718, 0.2053660126814028, -0.2053434375576048,
+    0.2002616184663778, -0.2002640752188908, -0.01363330587318669,
+    0.0136211028027781,
+    0.03984393933614423, 0.03985265636429462, 0.04717362194502663, 0,
+    -0.01908495685619025, -0.01911083285762175, -0.03411205713225551,
+    -0.03410914395487046, 0.1530325408672019, 0.1530568721514237,
+    0.1533688075406731, 0.1533556714365889, 0.07852877149815347,
+    0.07856223503447807,
+    -0.1066715133102415, -0.1066568622519173, -0.01842793225315581, 0,
+    -0.02541268858149941, -0.02540788469463666, 0.1744491357493417,
+    0.1744507673860094, 0.2055263056251289, 0.2055522349848533,
+    -0.2069082051725403, -0.2069116613832722, -0.06295497282947536,
+    -0.06296812655052228,
+    -0.006883262418511848, -0.006881616676256273, 0.158517838816133, 0,
+    -0.3107857002911013, -0.3107911240769881, 0.1765681723616684,
+    0.1765934874454368, 0.0006381142033794465, 0.0006205532251180493,
+    0.0003038835670119314, 0.0002765055255982883, 0.07912744635483628,
+    0.07907420642071608,
+    0.1452159211646373, -0.1452441414805946, -1.198488288560488e-05, 0,
+    -0.2342246366670442, 0.2342160164853273, 0.1532021254167898,
+    -0.1532243546744921, 0.02989283615559745, -0.0298353285411564,
+    0.006001757582677984, -0.005971418972459758, 0.08454962722491799,
+    -0.08446182480570061,
+    -0.1518097734655808, 0.1517661238541762, -4.410564785314096e-05, 0,
+    -0.03374078919911043, 0.03375069720166626, 0.1461862275715357,
+    -0.1461978094625525, 0.1742725510129213, -0.1742528458239497,
+    -0.1608582731821399, 0.1608436208510615, -0.03144117382739114,
+    0.03144135735266702,
+    -0.02955387748472402, 0.02954214039642781, 5.54153756513368e-06, 0,
+    -0.08801857276119124, 0.08806723782685717, -0.03589681795002909,
+    0.03587668170909501, 0.09158917645015055, -0.09160158467755915,
+    0.09629468108121175, -0.09626980433806907, -0.007014680174388161,
+    0.007064269593351149,
+    -0.01398284163897398, -0.01404661548393737, -0.103597851547062, 0,
+    -0.03542999006260448, -0.03544431177601202, 0.003308764837103203,
+    0.00334631381374284, -0.03278794008155136, -0.03277835475189344,
+    -0.03410840484224886, -0.0341166773576065, -0.05582756859981419,
+    -0.05580514637247903,
+    -0.02122098003427651, -0.02121396373711551, -0.04431289014508982, 0,
+    0.002881387421167521, 0.002845553780591405, 0.08345118826454861,
+    0.08345572181886241, 0.09114938142262531, 0.09119442740356701,
+    -0.09268242435751674, -0.09270156845863912, -0.009835820641094136,
+    -0.009842078665476399,
+    0.007430328287224736, 0.007430580336662246, -0.00739563482019904, 0,
+    0.1321058991888779, 0.1321119522140984, -0.05626218877568481,
+    -0.05624861404189565, 0.0003404840118726579, 0.0003452417796921722,
+    0.001360104859834168, 0.001351942093688492, -0.05880089924046625,
+    -0.05882669006582358,
+    -0.1468070946250355, -0.1468373502664167, 0.1754832589699653, 0,
+    -0.04560422611509887, -0.04557018793988977, -0.002974937169475492,
+    -0.003011286942401645, -0.02857033112318806, -0.0286139713183535,
+    0.02900595539614856, 0.02902057322609947, 0.07259603989215703,
+    0.0725710259944142,
+};
+
+constexpr double kGainsA3To9_10_3[] = {
+    0.04045762873091181, 0.0404604598386132, 0.02425936151645559, 0,
+    0.1442548306710168, 0.144253148244443, 0.04105575404022148,
+    0.04105746856112202, 0.1442530717909128, 0, 0.1317574396612083,
+    0.1317608084355463, 0.05461321854110709, 0.05459885625825763,
+    0.06112768580908988, 0.1341837446008717, 0.05955720158441564,
+    0.059546498293642, 0.06033698224110145, 0.0603380559940695,
+    0.05955023185192362, 0.0988956458906952, 0.09237394687405211,
+    0.09236469064867427,
+    0.1022769019598166, -0.1022799529391676, 1.277596811478931e-05, 0,
+    0.1822877684872289, -0.1822934826364738, 0.05389949315640326,
+    -0.05390228382751312, -9.567669082797015e-06, 0, 0.2248483882712282,
+    -0.2248662151943541, 0.08583315639539291, -0.08582687506913014,
+    1.18564510507313e-05, 1.537241099792426e-05, 0.09437415207112522,
+    -0.09436580287667123, 0.1359812774487848, -0.135981796622653,
+    7.708303613260619e-06, -5.319106901372137e-06, 0.08157011136337186,
+    -0.0815530233805067,
+    0.0003163053040200183, 0.0003047699250638685, -2.2251153581205e-05, 0,
+    -0.1846146278287255, -0.1846006263085136, 2.721957719896176e-06,
+    1.461024226302944e-05, -0.1845944462460036, 0, -0.1883853499825255,
+    -0.188375801091459, 0.09300173197814468, 0.09297637046812586,
+    0.09810525085617876, 0.340119711149578, 0.09719377426991095,
+    0.09716678439380609, 0.0976431864475443, 0.09764278132241076,
+    0.09717653386813455, -0.1946198517479976, -0.1894854591520413,
+    -0.1894983483174288,
+    0.05357055806409872, 0.05358159346705726, 0.07066751911194494, 0,
+    -0.1822896380969413, -0.1822939002065366, 0.104005768601358,
+    0.1040058448011335, -0.2578017095103111, 0, -0.01435050731555523,
+    -0.01434906981486589, 0.08584278433447132, 0.08581651097622647,
+    0.1385031317313397, -6.252153620841428e-06, -0.09438602136278536,
+    -0.09438040024529287, -7.030907979534407e-05, -7.469952910201021e-05,
+    -0.1334668358548823, 0.1324806057035446, 0.08158929310784691,
+    0.08155456781557188,
+    0.1248404386493702, -0.1248574086866941, 3.311905692115521e-05, 0,
+    -0.2850523267483101, 0.2850559194264907, 0.1257586288419227,
+    -0.1257590654250136, 8.641282187582408e-06, 0, -0.0355830919330529,
+    0.03556861584850019, 0.1256351078134451, -0.1256196757502892,
+    2.015526447095465e-05, 5.694231976650993e-06, -0.1346599669614084,
+    0.134659659004378, 0.0003006643661215784, -0.0002888625515537094,
+    -1.389446773656817e-05, -6.755317422137727e-06, 0.1209151404619052,
+    -0.1208676014553122,
+    0.0008695864612890908, -0.0008474459629712199, -7.292882202703929e-07, 0,
+    -0.1097025819318232, 0.1097030723042133, -2.756553883742462e-06,
+    -1.254460405181065e-05, 3.489599067885317e-06, 0, -0.1649310668578867,
+    0.1649242656111202, 0.1285383002022655, -0.1285177116726609,
+    1.948218043820535e-05, 2.74675645173633e-05, 0.1354256048363019,
+    -0.1353953789343498, 0.1929983952105709, -0.192986540083133,
+    1.323973843405882e-05, 7.406583250375533e-06, -0.1193519478971593,
+    0.1193585210728718,
+    -0.08493737499132918, -0.08495105232686351, -0.05548883416250435, 0,
+    0.01752065925706302, 0.0175050065508108, -0.08628389058007339,
+    -0.08627577589091553, 0.01750966246613933, 0, 0.0435661664967641,
+    0.04354494059128562, 0.01473199984801797, 0.01471828025443576,
+    0.002371687320185258, 0.3951119289651346, 0.005757106500743715,
+    0.005725579272762061, 0.004062789812620283, 0.004063067693035264,
+    0.005741521293504396, 0.1169446073234201, 0.129234437558451,
+    0.1293023172596233,
+    0.0001556029190375551, 0.0001390086379159411, -5.755944336568556e-05, 0,
+    0.1096931988105133, 0.1096796478297017, 7.00657446778934e-06,
+    3.183898544337352e-05, 0.1551117578229091, 0, -0.002852616176511631,
+    -0.002843137616759001, 0.1285465137813446, 0.1285314616572139,
+    0.1944647205794678, -7.460674766379748e-06, -0.1354301988950832,
+    -0.1354308446782502, -0.0001737361875204098, -0.0001718219597491577,
+    -0.1915070731398828, -0.1814918401337391, -0.1193738433753863,
+    -0.1193651887330754,
+    -0.08616564893462389, -0.08614986230472101, 0.09611683601594032, 0,
+    -1.165937420145925e-06, 7.904832101415411e-06, 0.08846515492445864,
+    0.08845593232731901, 0.2850625702929752, 0, -0.2521185587265318,
+    -0.2521303237499596, 1.685486618938165e-05, -2.895583522651983e-05,
+    0.1430971157478105, 1.889466201858984e-06, 1.997942214144097e-05,
+    1.198032832839424e-05, -0.1388747138556134, -0.1388810185152599,
+    0.1346637356009529, 0.1383885805097154, 2.123315657085484e-05,
+    5.012046808215774e-07,
+    -0.01991138032942086, 0.01987375964669011, 5.347617439096952e-05, 0,
+    0.1757551666142012, -0.1757618019515414, 0.168860718024702,
+    -0.1688480988680872, -5.849243726420181e-06, 0, -0.230174604876451,
+    0.2301898998113466, 0.07782145115758227, -0.07775899464010727,
+    2.063847558033506e-05, -1.088795080723981e-05, 0.07689692988063197,
+    -0.07688496458299594, -0.1147054211345813, 0.1147074691828041,
+    1.87089723828676e-05, 2.64755154323668e-06, 0.07573957250529613,
+    -0.07567410249994765,
+    0.0004595785896556763, -0.0004238397423141654, -2.084450603641513e-06, 0,
+    0.1546494174844756, -0.1546288961912446, -6.788929165287806e-06,
+    -2.277053915021491e-05, 1.533501409977587e-05, 0, -0.007950103612898858,
+    0.007943530880602553, 0.186713054288172, -0.1867125905587051,
+    3.002495632368954e-05, 9.441676883070387e-06, -0.194510974467317,
+    0.1945112974691794, -9.562227360815352e-05, 9.126268922815081e-05,
+    -1.851178498213168e-05, 1.45602210703999e-05, -0.175960924990717,
+    0.1759488422125813,
+    -0.1076721321410654, 0.1076889928973513, -1.414713426330186e-05, 0,
+    -0.05442147362103429, 0.05441671861267668, -0.05846447825321615,
+    0.05846119828357212, -1.271558114211981e-05, 0, -0.04265278252441436,
+    0.0426780775593236, 0.06881907320077044, -0.06878316666677664,
+    1.641380240217301e-05, 2.318141909512709e-05, 0.06207827475607939,
+    -0.06203336541498244, 0.08514320337717771, -0.08510923729119908,
+    1.699077543316717e-05, 3.610306262621292e-06, 0.05764896469063468,
+    -0.0577015222793397,
+    -0.001005842290189365, -0.0009868920936768365, 5.401685314977625e-05, 0,
+    -0.02909734252938431, -0.02908917820092171, -3.245287974347834e-06,
+    -3.511271108375308e-05, -0.02910963802536305, 0, -0.01838546196336954,
+    -0.0183949061842006, -0.07575879066712944, -0.07576673062178195,
+    -0.09055610618017902, 0.2958667501106039, -0.0876721021777167,
+    -0.08769882582223869, -0.08913375561709766, -0.08910631440756234,
+    -0.08767461590593632, -0.000158811294857131, -0.01485114797577977,
+    -0.01491496358998882,
+    -0.05804247126317359, -0.05807072442674228, -0.08689750905651823, 0,
+    0.05442586788703133, 0.05443693202803863, -0.1097248579751615,
+    -0.1096968952990283, 0.07695982137777693, 0, 0.01545359568431271,
+    0.01543481668290529, 0.06881542096804302, 0.06884204042167315,
+    0.08245715606962883, 3.75221201571503e-06, -0.06205944901874826,
+    -0.06207019875965015, -6.914849191687309e-05, -6.041012956429971e-05,
+    -0.08776320097636464, 0.06670490627772332, 0.0576490938014757,
+    0.05770265901897342,
+    -0.001245125857269005, -0.001235815526948705, -7.945801001376096e-05, 0,
+    2.16559686041865e-05, 2.293636751784811e-05, 1.190097021134518e-05,
+    2.448704392312258e-05, -0.1546185935008997, 0, 0.1671105038010995,
+    0.1670985354996284, 1.376783304328339e-05, -6.820535479088494e-08,
+    0.2002506695973243, 5.514416288337239e-06, 1.155002195083098e-05,
+    4.009403433949556e-05, -0.1973807195345209, -0.1973925269049314,
+    0.1945113301414207, -0.189508027539048, -1.865705506110532e-05,
+    -1.325483631904966e-05,
+    -0.1671954492209584, -0.1671942658803584, 0.1122004942755956, 0,
+    0.1757463685937784, 0.1757462933640427, 0.02247862589682756,
+    0.02246192369198404, -0.248570194877569, 0, 0.05340361321697736,
+    0.05337918797502247, -0.07778358183627122, -0.07783394308621752,
+    0.1206675903527339, -9.919960450372242e-06, 0.0768630055965267,
+    0.0768851720556151, -0.001740834595434705, -0.001721109558216102,
+    -0.1087394200499871, 0.1177585748186244, -0.07568943655178736,
+    -0.07568516066694096,
+};
+
+constexpr double kGainsA3To0_7_0[] = {
+    0.2133721105067292, 0.2133746281179425, 0.1661843576270339, 0,
+    0.23656992834715, 0.2365641853787369, 0.2884354004614552,
+    0.2884231014369346,
+    0.2144245532960823, -0.2144219215568881, 1.111845730418934e-05, 0,
+    0.3748320658866341, -0.3748278683846863, 0.2210557165107208,
+    -0.2210469487281935,
+    2.941624819573778e-05, -7.82048843646572e-06, -3.664038829825851e-05, 0,
+    -1.562854367545316e-05, -2.548642149069724e-07, -6.868503205841551e-06,
+    -1.446038374056214e-05,
+    0.2557232838211285, 0.2557315296931433, 0.2302484686100738, 0,
+    0.04243436043756801, 0.04241750855978356, -0.4050152537205439,
+    -0.4050128555906315,
+    0.3450277237860876, -0.3450243866517254, 3.309632903798802e-05, 0,
+    0.06816621821559735, -0.06813452309045528, -0.3264556734513172,
+    0.326460873341635,
+    1.912228199524981e-06, 2.207916631618564e-05, -2.206398489147069e-05, 0,
+    -7.633512046354969e-06, -9.349979838101931e-06, -1.18756599206089e-06,
+    2.474357960548729e-05,
+    0.1529740724207206, 0.1529945012657442, 0.1771027379301922, 0,
+    0.1404284340475498, 0.140437086751939, 0.1227771089099324,
+    0.1227437361994558,
+    1.854543900743752e-05, 8.365794320104082e-06, -1.869617850238338e-05, 0,
+    -1.238987445661057e-05, 1.34667095801283e-05, 6.763675686355063e-06,
+    -5.068749635153865e-06,
+    0.05135617764084595, 0.0513749936689071, 0.2601143932065694, 0,
+    -0.3733767046384907, -0.3733852617628248, 0.1935340738069332,
+    0.1935452074768156,
+    0.2551462876216126, -0.2551611566827833, 3.881567135947996e-05, 0,
+    -0.2699433498323792, 0.2699670232301725, 0.1775324428446776,
+    -0.177534762348146,
+    1.291797787709621e-05, 4.425981232602145e-06, -1.685171012563813e-05, 0,
+    -5.815250490786544e-07, -3.328253542871047e-06, -1.673026844434246e-06,
+    1.102848642228983e-05,
+    0.01426444346480944, -0.01426011132202074, 7.329645468407324e-06, 0,
+    0.02438743981922501, -0.02437646722047018, 0.01609307088180723,
+    -0.01606477314341293,
+    8.545411930387015e-05, 2.623212254511682e-05, -5.085035383605781e-05, 0,
+    -1.392574391780339e-05, 1.121519731594587e-05, 2.023800375624381e-05,
+    1.849547181053276e-05,
+    0.03087613887795524, 0.0308964355182558, 0.02554305919376208, 0,
+    0.01922731885956907, 0.01922439118602287, -0.03002397996585367,
+    -0.03002565241904382,
+    1.581300720374881e-05, 3.787242962366299e-05, -4.755726784649949e-06, 0,
+    -2.522318975501566e-06, -8.144478254242895e-07, 1.46102312227597e-05,
+    3.540982374418699e-05,
+    -0.139695202165987, -0.1396913084502265, 0.2741435700307321, 0,
+    -0.06293893479698767, -0.06292890883237989, 0.03753049624142856,
+    0.03753035378796793,
+};
+
+constexpr double kGainsA3To4_7_0[] = {
+    0.1248431441013129, 0.1248508409086648, 0.1144020535950842, 0,
+    0.1587554477278004, 0.1587568025662607, 0.1862030365690383,
+    0.1861899194743715, 0.1447098940870847, 0.1447014772103559,
+    0.1449509315341612, 0.1449540797605403,
+    0.1410617710247246, -0.1410702416054963, 4.98738605334857e-06, 0,
+    0.2951066093616399, -0.2951157156322247, 0.1501164847022317,
+    -0.1500979882991518, 0.1414738671128027, -0.1414462727969675,
+    0.1353870659384222, -0.1354014793164771,
+    -0.1807472478535095, -0.1807726463105044, -0.1337281916137067, 0,
+    -0.1767985473296882, -0.1767856526641368, -0.2149641555707934,
+    -0.2149596409358924, 0.2789572032123575, 0.2789573540715597,
+    0.2796124972964511, 0.2796110278894129,
+    0.1659133108345941, 0.1659137452730246, 0.2005371064704555, 0,
+    0.02687783202160462, 0.02685664862434944, -0.3033250315949225,
+    -0.3033123436359588, 0.1417512867546591, 0.141750841991166,
+    -0.1420974197761083, -0.1420954534227888,
+    0.2368002124393554, -0.2368054351695868, 7.472819666206551e-06, 0,
+    0.04614162180561492, -0.04610739073952302, -0.2369726163558042,
+    0.2369556298185283, 0.1306011015176139, -0.130567100158352,
+    -0.1153768865392058, 0.11537070080879,
+    -0.1072445963675927, 0.1072492394437017, -2.104109333045682e-05, 0,
+    -0.1435946183264212, 0.1435780552171893, -0.106371699489443,
+    0.1063814370474547, 0.2016535448673993, -0.2016331414098163,
+    0.1966714620915909, -0.1966738748010878,
+    0.03707551533920023, 0.03711377249898903, 0.03123229480777222, 0,
+    -0.007565374249243929, -0.007590740129802876, -0.02257534944578969,
+    -0.02257263269104874, 0.1503907487221809, 0.1504118077067788,
+    0.1506193141215033, 0.1506064135127085,
+    -0.1320417494013954, -0.1320655926887978, -0.07315894979740444, 0,
+    -0.02508634762571646, -0.02508186865336135, 0.1697707430747047,
+    0.1697721543472219, 0.2017747716498884, 0.2018054742881273,
+    -0.2031988932360615, -0.2032022874861587,
+    0.03343207788328903, 0.03341709478798754, 0.2339103251323056, 0,
+    -0.3051622587128843, -0.30516749995697, 0.1728682509049199,
+    0.1728929194190446, 0.0005060502033188109, 0.0004966019790357208,
+    0.0002984357456387924, 0.0002715485194430772,
+    0.1834656617567817, -0.1834560936904357, 4.985206376639017e-06, 0,
+    -0.2297754478794448, 0.2297644962521784, 0.1503354692436369,
+    -0.1503592071664161, 0.02919253919613808, -0.02913851428721089,
+    0.005894162086294869, -0.005864367366392276,
+    -0.1630444959654104, 0.1630495483697164, -3.874884948959998e-05, 0,
+    -0.03296443049468014, 0.0329816573965238, 0.1426950987233334,
+    -0.1426985259033985, 0.1710706725999493, -0.171055278440254,
+    -0.1579745136313849, 0.1579601239774996,
+    -0.03320909146014882, 0.03319223328176957, 2.562356279145786e-05, 0,
+    -0.08811699498542354, 0.08815635593107761, -0.03622531387482417,
+    0.03619761273025789, 0.09000165800367751, -0.09001546246676619,
+    0.0945683744339906, -0.09454394366446316,
+    -0.01001995572013138, -0.01005940245658405, -0.08476922427716131, 0,
+    -0.04431860225799064, -0.0443327007689063, -0.006061572274671271,
+    -0.006024622922253629, -0.03211558942640665, -0.03211180073438326,
+    -0.03349693216957211, -0.0335050563808065,
+    -0.03006552728705839, -0.03003905828220129, -0.0608019758766407, 0,
+    0.003010201482933947, 0.002975455740394346, 0.08399197483443399,
+    0.08399655383020822, 0.08965318632049535, 0.08969389306909957,
+    -0.09102087583321128, -0.09103967673169097,
+    -0.02307393438929691, -0.02310944923501072, -0.06693349994384293, 0,
+    0.1295633345495559, 0.1295691181896453, -0.05404997515864856,
+    -0.05403633015231262, 0.0002671235504151517, 0.000277978977089705,
+    0.001335721809450846, 0.001327705379917934,
+    -0.1076044357160532, -0.1076337226790462, 0.2391669198227754, 0,
+    -0.04457532240774916, -0.04454180845814031, -0.002875517396403541,
+    -0.002911040680991749, -0.0281262986225574, -0.02815811896337869,
+    0.02848595602497726, 0.02850031179624819,
+};
+
+constexpr double kGainsA3To3_1_2Ch[] = {
+    0.4600323101900624, 0.4600358147449242, 0.09927427523765553, 0,
+    0.1117560050721716, 0.1117436851195383,
+    0.5123392506750477, -0.5123299267496459, 1.135584210010789e-05, 0,
+    0.0957108951564507, -0.09570200785524186,
+    -0.1732089314698727, -0.173209548626266, -0.1291192913582355, 0,
+    0.2177360627914349, 0.2177373808538265,
+    -0.08679045309650202, -0.08677884813556791, 0.1863923347894433, 0,
+    0.1412031047645282, 0.1411734294182388,
+    0.2110606804377801, -0.2110661297515312, 3.137031115535313e-05, 0,
+    0.1217813651564454, -0.1217559625086076,
+    -0.1240357707577273, 0.1240583588247642, -9.139079069890202e-06, 0,
+    0.1382991250358413, -0.138304588879417,
+    0.06031436634859495, 0.06030266347629555, 0.03496657976412021, 0,
+    0.1241729595585358, 0.1242088094631468,
+    -0.1472639085341873, -0.1472669580416421, -0.1160046528516226, 0,
+    0.2136451259296143, 0.2136488984449724,
+    -0.09544120762175748, -0.09542188594272218, 0.2076180215742282, 0,
+    0.03635167116982406, 0.03631806676219861,
+    0.009626709371755512, -0.009640918631298873, 3.945961167825228e-05, 0,
+    0.06785954761722965, -0.06782207605859106,
+    -0.1475498516744137, 0.1475399594366354, -2.87941414863721e-05, 0,
+    0.1732515053364818, -0.173246377527131,
+    -0.02170847952470226, 0.02169692697588083, 4.179365068804624e-06, 0,
+    0.06485935332604253, -0.06488206577719892,
+    -0.01757221242275774, -0.01758859152910528, -0.06578851052684974, 0,
+    -0.01129650672322881, -0.01128750313103734,
+    -0.03459537443031531, -0.03460531633971509, -0.0179100086476445, 0,
+    0.1236321152318951, 0.1236767028264234,
+    0.005974535674267993, 0.005974916452797245, -0.08364789008525689, 0,
+    0.04362752093129507, 0.04363237973449083,
+    -0.1740530536567975, -0.1740173863014943, 0.2217087116645219, 0,
+    -0.005882757815817798, -0.005932942836583561,
+};
+
+constexpr double kGainsA3To7_1_2Ch[] = {
+    0.1248431441013129, 0.1248508409086648, 0.1144020535950842, 0,
+    0.1587554477278004, 0.1587568025662607, 0.1862030365690383,
+    0.1861899194743715, 0.247205680714197, 0.2471994899696896,
+    0.1410617710247246, -0.1410702416054963, 4.98738605334857e-06, 0,
+    0.2951066093616399, -0.2951157156322247, 0.1501164847022317,
+    -0.1500979882991518, 0.2372069795228113, -0.2371895770043385,
+    -0.1807472478535095, -0.1807726463105044, -0.1337281916137067, 0,
+    -0.1767985473296882, -0.1767856526641368, -0.2149641555707934,
+    -0.2149596409358924, 0.4766730961551832, 0.4766722079867045,
+    0.1659133108345941, 0.1659137452730246, 0.2005371064704555, 0,
+    0.02687783202160462, 0.02685664862434944, -0.3033250315949225,
+    -0.3033123436359588, 0.04127323764186144, 0.04127418330013484,
+    0.2368002124393554, -0.2368054351695868, 7.472819666206551e-06, 0,
+    0.04614162180561492, -0.04610739073952302, -0.2369726163558042,
+    0.2369556298185283, 0.04901732265355059, -0.04898769526621227,
+    -0.1072445963675927, 0.1072492394437017, -2.104109333045682e-05, 0,
+    -0.1435946183264212, 0.1435780552171893, -0.106371699489443,
+    0.1063814370474547, 0.3407212693782362, -0.3407025719638995,
+    0.03707551533920023, 0.03711377249898903, 0.03123229480777222, 0,
+    -0.007565374249243929, -0.007590740129802876, -0.02257534944578969,
+    -0.02257263269104874, 0.2568946871151627, 0.2569066239918003,
+    -0.1320417494013954, -0.1320655926887978, -0.07315894979740444, 0,
+    -0.02508634762571646, -0.02508186865336135, 0.1697707430747047,
+    0.1697721543472219, 0.058091456313068, 0.05811975885404616,
+    0.03343207788328903, 0.03341709478798754, 0.2339103251323056, 0,
+    -0.3051622587128843, -0.30516749995697, 0.1728682509049199,
+    0.1728929194190446, 0.0007170761428084646, 0.0006886157785550878,
+    0.1834656617567817, -0.1834560936904357, 4.985206376639017e-06, 0,
+    -0.2297754478794448, 0.2297644962521784, 0.1503354692436369,
+    -0.1503592071664161, 0.03336034117676983, -0.03328524821935597,
+    -0.1630444959654104, 0.1630495483697164, -3.874884948959998e-05, 0,
+    -0.03296443049468014, 0.0329816573965238, 0.1426950987233334,
+    -0.1426985259033985, 0.0593658227565504, -0.05936060361869623,
+    -0.03320909146014882, 0.03319223328176957, 2.562356279145786e-05, 0,
+    -0.08811699498542354, 0.08815635593107761, -0.03622531387482417,
+    0.03619761273025789, 0.1568715968517408, -0.156868126152027,
+    -0.01001995572013138, -0.01005940245658405, -0.08476922427716131, 0,
+    -0.04431860225799064, -0.0443327007689063, -0.006061572274671271,
+    -0.006024622922253629, -0.0558014973124569, -0.05580345330528914,
+    -0.03006552728705839, -0.03003905828220129, -0.0608019758766407, 0,
+    0.003010201482933947, 0.002975455740394346, 0.08399197483443399,
+    0.08399655383020822, 0.02529170778929291, 0.02531912029508973,
+    -0.02307393438929691, -0.02310944923501072, -0.06693349994384293, 0,
+    0.1295633345495559, 0.1295691181896453, -0.05404997515864856,
+    -0.05403633015231262, 0.001211621499656611, 0.001216808454647537,
+    -0.1076044357160532, -0.1076337226790462, 0.2391669198227754, 0,
+    -0.04457532240774916, -0.04454180845814031, -0.002875517396403541,
+    -0.002911040680991749, -0.007983685948714188, -0.008005355226320645,
+};
+
+constexpr double kGainsA3To9_1_6Ch[] = {
+    0.04045762873091181, 0.0404604598386132, 0.1231550074071508, 0,
+    0.2462571559413611, 0.2462554735147873, 0.1766535020681217,
+    0.1766459603636444, 0.1317574396612083, 0.1317608084355463,
+    0.1217050908415429, 0.1216907285586935, 0.1687574466485778,
+    0.1687467433578042, 0.06033698224110145, 0.0603380559940695,
+    0.1022769019598166, -0.1022799529391676, 7.45686121341717e-06, 0,
+    0.1822810031235403, -0.1823002480001624, 0.1354779882967139,
+    -0.135446923431081, 0.2248483882712282, -0.2248662151943541,
+    0.08584084260089186, -0.08581918886363119, 0.09438728887038056,
+    -0.09435266607741589, 0.1359812774487848, -0.135981796622653,
+    0.0003163053040200183, 0.0003047699250638685, -0.1946421029015789, 0,
+    -0.3151426125386502, -0.3151286110184384, -0.12011184904391,
+    -0.1201128499247544, -0.1883853499825255, -0.188375801091459,
+    0.2630615875529336, 0.2630362260429148, 0.3359678159150621,
+    0.3359408260389573, 0.0976431864475443, 0.09764278132241076,
+    0.05357055806409872, 0.05358159346705726, 0.2031481248154895, 0,
+    -0.3645829750931668, -0.3645872372027621, 0.2835315653720089,
+    0.2834969162795094, -0.01435050731555523, -0.01434906981486589,
+    0.08583965825766089, 0.08581338489941605, -0.1887644521360949,
+    -0.1887588310186024, -7.030907979534407e-05, -7.469952910201021e-05,
+    0.1248404386493702, -0.1248574086866941, 2.636373949901749e-05, 0,
+    -0.2850462164390771, 0.2850620297357237, 0.2466880212280119,
+    -0.2466124149561417, -0.0355830919330529, 0.03556861584850019,
+    0.1256379549294334, -0.1256168286343008, -0.1346669447177776,
+    0.1346526812480088, 0.0003006643661215784, -0.0002888625515537094,
+    0.0008695864612890908, -0.0008474459629712199, 6.67729503010514e-06, 0,
+    -0.1097001144126587, 0.1097055398233778, -0.1193409284691429,
+    0.1193597524507202, -0.1649310668578867, 0.1649242656111202,
+    0.1285520339845242, -0.1285039778904022, 0.1354487005273885,
+    -0.1353722832432633, 0.1929983952105709, -0.192986540083133,
+    -0.08493737499132918, -0.08495105232686351, 0.06145577316091578, 0,
+    0.02990186032315771, 0.02988620761690549, 0.0446275831653348,
+    0.04470357755566488, 0.0435661664967641, 0.04354494059128562,
+    0.2122879643305853, 0.212274244737003, 0.2073729396242749,
+    0.2073414123962933, 0.004062789812620283, 0.004063067693035264,
+    0.0001556029190375551, 0.0001390086379159411, -0.1815493995771048, 0,
+    0.2193737746088579, 0.2193602236280462, 0.01814048582237032,
+    0.01817397287565678, -0.002852616176511631, -0.002843137616759001,
+    0.1285427834439614, 0.1285277313198307, -0.2708498792948656,
+    -0.2708505250780326, -0.0001737361875204098, -0.0001718219597491577,
+    -0.08616564893462389, -0.08614986230472101, 0.2345054165256557, 0,
+    0.2015685105792095, 0.201577581348731, 0.1896713289945426,
+    0.1896413744455129, -0.2521185587265318, -0.2521303237499596,
+    1.779959929031114e-05, -2.801110212559034e-05, 0.09524256477858849,
+    0.09523456568477544, -0.1388747138556134, -0.1388810185152599,
+    -0.01991138032942086, 0.01987375964669011, 5.61237259342062e-05, 0,
+    0.1757510305742974, -0.1757659379914452, 0.2446148841360343,
+    -0.2445076077619987, -0.230174604876451, 0.2301898998113466,
+    0.07781600718217864, -0.0777644386155109, 0.07690471514646931,
+    -0.07687717931715861, -0.1147054211345813, 0.1147074691828041,
+    0.0004595785896556763, -0.0004238397423141654, 1.247577046675839e-05, 0,
+    0.1546602609769351, -0.1546180526987851, -0.175946483069661,
+    0.1759473025236524, -0.007950103612898858, 0.007943530880602553,
+    0.1867177751266135, -0.1867078697202635, -0.1945193434375683,
+    0.1945029284989282, -9.562227360815352e-05, 9.126268922815081e-05,
+    -0.1076721321410654, 0.1076889928973513, -1.053682800068057e-05, 0,
+    -0.05443046489468661, 0.05440772733902435, -0.0008039072515978393,
+    0.0007712823152160528, -0.04265278252441436, 0.0426780775593236,
+    0.068830663910318, -0.06877157595722908, 0.06210187975815337,
+    -0.06200976041290847, 0.08514320337717771, -0.08510923729119908,
+    -0.001005842290189365, -0.0009868920936768365, -0.0001047944417073547, 0,
+    -0.0496809649750043, -0.04967280064654171, -0.07888723002160775,
+    -0.07898291305892619, -0.01838546196336954, -0.0183949061842006,
+    0.07217458438817252, 0.07216664443352001, -0.001734042567428262,
+    -0.001760766211950246, -0.08913375561709766, -0.08910631440756234,
+    -0.05804247126317359, -0.05807072442674228, -0.02019260277879491, 0,
+    0.1088446794621628, 0.1088557436031701, 0.006230250040506216,
+    0.006311777934137161, 0.01545359568431271, 0.01543481668290529,
+    0.06881729707405088, 0.068843916527681, -0.1241155274617657,
+    -0.1241262772026676, -6.914849191687309e-05, -6.041012956429971e-05,
+    -0.001245125857269005, -0.001235815526948705, -0.1895874855490617, 0,
+    -0.1093101999934082, -0.1093089195944945, 0.1415918503245651,
+    0.1416098386170189, 0.1671105038010995, 0.1670985354996284,
+    1.652504118745201e-05, 2.689002789377735e-06, 0.1375545877907088,
+    0.1375831318030975, -0.1973807195345209, -0.1973925269049314,
+    -0.1671954492209584, -0.1671942658803584, 0.22995906909422, 0,
+    -1.930180501225065e-05, -1.937703474799712e-05, 0.03211406075289877,
+    0.03210163443290166, 0.05340361321697736, 0.05337918797502247,
+    -0.07778854181649641, -0.07783890306644271, -3.233568333682602e-05,
+    -1.01692242484297e-05, -0.001740834595434705, -0.001721109558216102,
+};
+
+constexpr double kGainsA3To0_1_0[] = {
+    0.6105119355720615,
+    3.864696727584604e-06,
+    -1.915734957957846e-07,
+    0.07245580339689955,
+    4.086614467227467e-06,
+    8.200767978333346e-06,
+    0.09219657921145887,
+    7.924127471345699e-07,
+    0.1581881443262517,
+    5.331156031899986e-06,
+    3.178888355326942e-07,
+    -1.05779471873341e-05,
+    -8.217490766104031e-06,
+    0.0396539739203252,
+    -1.52839265288139e-05,
+    0.04952212440781636,
+};
+
+// -------------------------------------------------------
+// Input layout: A4
+constexpr double kGainsA4To0_2_0[] = {
+    0.6093259846194182, 0.609336255967694,
+    0.5588714864295891, -0.5588637719858595,
+    -8.384707815733911e-07, 4.560648497305732e-07,
+    0.07230226352186944, 0.07232906400241045,
+    0.2454814628339485, -0.2454733054131794,
+    2.340913968331902e-06, 1.402889912900946e-05,
+    0.09202150866624001, 0.09201500765677571,
+    -1.435509445126618e-07, 1.725311165118242e-06,
+    0.1578726911599899, 0.1578916816008976,
+    0.1057018960848632, -0.1056912543951989,
+    -9.194184319772273e-06, 9.828732308100954e-06,
+    0.01441718407633314, -0.01443829905225584,
+    6.200960262429973e-06, -2.260415424690238e-05,
+    0.03956653794271322, 0.03958801725962716,
+    -1.749193891704969e-05, -1.301679164711246e-05,
+    0.04942416870520795, 0.04942851471188756,
+    0.1175640100994695, -0.1175386073126057,
+    1.011966419271346e-05, -1.047639988119823e-05,
+    0.03842790752746169, -0.03840115154723191,
+    1.211755634739991e-05, -2.485965912259358e-05,
+    0.03073697884395466, 0.03075119829313019,
+    1.378359283483081e-05, -2.651643783286786e-05,
+    0.01165155292295031, 0.01168257027223622,
+    -2.017168442013802e-05, 3.029028291221208e-07,
+    0.03186828232848787, 0.03185344082788918,
+};
+
+constexpr double kGainsA4To0_5_0[] = {
+    0.2320670771839111, 0.232069076400836, 0.1529865330275428, 0,
+    0.4327781171807656, 0.4327738928847031,
+    0.2876817116965276, -0.2876843232285672, 8.477744390255564e-06, 0,
+    0.417729581516094, -0.417708176711285,
+    1.582529728897441e-05, 9.175511936950598e-06, -3.771286777382037e-05, 0,
+    -4.075522122277157e-06, 9.942658161109702e-06,
+    0.2847830731803795, 0.2847940783610645, 0.2458106048083841, 0,
+    -0.3987329640522473, -0.3987486398400004,
+    0.3674068529645996, -0.3674065998473235, 3.519029154864368e-05, 0,
+    -0.09823321473548527, 0.09824256846837395,
+    4.536343439880638e-06, 1.35443990729531e-05, -1.309779963875059e-05, 0,
+    2.47605349103791e-06, 1.568843517234445e-06,
+    0.120886421189266, 0.1209071595341141, 0.1582820725088309, 0,
+    0.08493134368935805, 0.08491597635415656,
+    2.549874744571468e-05, 2.008178793284564e-05, -4.316382437714548e-06, 0,
+    -1.53543978539452e-06, 9.477030994721825e-06,
+    -0.03723366663577364, -0.03721947519649494, 0.2522531159635875, 0,
+    -0.07519154587916528, -0.07521051066539328,
+    0.1712522082227282, -0.1712529543141994, 4.044983897298397e-05, 0,
+    -0.1623061508905765, 0.1623208520881083,
+    5.736262350913306e-06, 5.069677883107672e-06, -1.486645790003041e-05, 0,
+    -1.508378640699915e-05, 5.070949934616649e-06,
+    0.02443960280719628, -0.02446494687250591, -1.843135110307322e-06, 0,
+    0.05145873360703417, -0.05145265537684205,
+    2.462119587057935e-05, 2.223721991644005e-05, -8.926161623026503e-05, 0,
+    9.538368382412742e-06, 2.629960391576808e-06,
+    0.09919679369144647, 0.09921377841539072, 0.08888276058157932, 0,
+    -0.03966249197182386, -0.03966752662218503,
+    -1.010211703831832e-05, 3.938415367245501e-07, -2.545463597404618e-05, 0,
+    7.814285803713214e-06, -4.153552445573743e-06,
+    -0.1777764410074587, -0.1777907176790538, 0.2680894966576085, 0,
+    -0.01772124529292436, -0.01770693347812565,
+    0.03776152288933932, -0.03775257576719374, 2.706873667405318e-05, 0,
+    0.003725004338171489, -0.003681623276580455,
+    8.372265810105222e-06, 1.078208234864234e-06, -1.004279421028597e-05, 0,
+    -6.094543581766481e-06, 1.45915291980102e-06,
+    0.1011772937904345, -0.1011600361127936, 3.823799159617584e-05, 0,
+    -0.04459489635160828, 0.04462241042575407,
+    3.12880915563649e-05, -1.846969039527374e-05, -2.377865620969619e-05, 0,
+    -3.556179257658869e-05, -1.890617633695877e-05,
+    0.06777801040013576, 0.06779244485676596, 0.09405594013399286, 0,
+    0.01226894056061515, 0.01227095675134491,
+    7.200853689608807e-05, 2.279458860505782e-05, -1.528934167792003e-05, 0,
+    -2.259680557086394e-05, 1.301895912177105e-05,
+    -0.0428514136771531, -0.0428428326123805, 0.03350472478136744, 0,
+    -0.003389398028775322, -0.003387139686111333,
+    4.631260894489612e-06, -3.872573097626475e-06, -8.407500979447779e-08, 0,
+    -1.986548401255291e-05, -8.887364141902815e-06,
+    -0.107408281281598, -0.1074115818497727, 0.2445097281020831, 0,
+    0.009310075536704239, 0.009319825883693639,
+};
+
+constexpr double kGainsA4To2_5_0[] = {
+    0.1462018099601641, 0.14620916557331, 0.09837170863293987, 0,
+    0.4379084706618402, 0.4379029793830675, 0.110739958993637,
+    0.1107277510496565,
+    0.2076052600084871, -0.2076108145223289, 1.125259879942959e-05, 0,
+    0.4243715254310414, -0.4243506040231231, 0.09484072554333738,
+    -0.09483191904232836,
+    -0.1774580159807152, -0.1774674175462565, -0.1279453844208592, 0,
+    0.00823615190791388, 0.00824858287357505, 0.2157564835051861,
+    0.2157577895842205,
+    0.1934062059812723, 0.1934296526792832, 0.1846977215943009, 0,
+    -0.3951420045789051, -0.39515890053521, 0.1399193360687857,
+    0.1398899305202508,
+    0.2730087799442937, -0.2730179537233802, 3.108510337961687e-05, 0,
+    -0.09032156143348838, 0.09032689868759111, 0.1206741720492304,
+    -0.1206490003532838,
+    -0.1262661271658665, 0.1262865436270079, -9.055989794782506e-06, 0,
+    0.004748993876476043, -0.004746213188707194, 0.1370417582968757,
+    -0.1370471724651177,
+    -0.002535858454030369, -0.00253699122772043, 0.03464867598591916, 0,
+    0.0881081465628628, 0.08809334865608097, 0.1230440229207417,
+    0.1230795468906973,
+    -0.1486560228545576, -0.1486659843080357, -0.1149499795699002, 0,
+    0.003862197016636663, 0.003872011193577561, 0.2117027399946606,
+    0.2117064782116432,
+    -0.036658506973379, -0.03662711277026029, 0.2057304319407462, 0,
+    -0.08190415433688743, -0.08192147589323855, 0.03602117463036362,
+    0.03598787574212899,
+    0.1249698593795552, -0.1249867904004416, 3.91008588427309e-05, 0,
+    -0.1632436227686544, 0.1632476546164346, 0.06724259260704396,
+    -0.06720546172656568,
+    -0.1513522720814404, 0.1513541992113717, -2.853235533427135e-05, 0,
+    0.007274561096248622, -0.00729114901662198, 0.1716763639158158,
+    -0.1716712827266944,
+    -0.05340086671077486, 0.05338447238439945, 4.141367759521952e-06, 0,
+    0.04509892120079013, -0.04509192535606877, 0.06426967502141225,
+    -0.06429218097899439,
+    -0.01851373742048498, -0.01852639277797131, -0.06519038465352181, 0,
+    0.001557452662629916, 0.00155239708133236, -0.01119380287881469,
+    -0.01118488114409955,
+    -0.005787668974205138, -0.005793854836212536, -0.01774717718242519, 0,
+    -0.04029543670578944, -0.0403006207305582, 0.1225080957594634,
+    0.1225522779793495,
+    0.01134492714152714, 0.01135210365641223, -0.08288739304848533, 0,
+    -0.007671698217585799, -0.00768131373597775, 0.04323087493871688,
+    0.04323568956739216,
+    -0.1525608940263695, -0.1525361523937817, 0.2196930144595422, 0,
+    -0.02815661134301536, -0.02814161863184943, -0.005829273862039476,
+    -0.005879002618343052,
+    0.01412323846151805, -0.014142542713965, 3.659741391940125e-05, 0,
+    -0.004147432031450586, 0.004177806287295372, 0.02993874181069809,
+    -0.02988874161702849,
+    -0.07385242829535196, 0.07384489318766099, -2.565492320869307e-05, 0,
+    -0.0006966370376751236, 0.0006739799362763605, 0.08941864012551172,
+    -0.08941340311575782,
+    -0.01628133267900135, 0.01629280671527291, 2.560259841274747e-05, 0,
+    -0.04727029280124824, 0.04729560528764545, 0.1018459070595283,
+    -0.1018616268525024,
+    0.01266494622276221, -0.01265189964088581, -1.224583094881937e-05, 0,
+    -0.01157573998948768, 0.0115276140846517, -0.0354355013392288,
+    0.03543132505175703,
+    0.0886331125194126, 0.08865965753588724, 0.08233148717346719, 0,
+    0.02079417282674327, 0.0207982314451996, -0.02958143074967187,
+    -0.02961213650031968,
+    -0.01434464642095774, -0.01438436757936817, -0.04031561220017205, 0,
+    -0.002072837629405313, -0.002036600895772512, -0.01396867346787669,
+    -0.01398252961382916,
+    -0.01395984764086068, -0.01397672966124555, -0.03900216490983474, 0,
+    -0.005125663358525838, -0.005121320976400627, 0.007491534145955856,
+    0.007537812674159464,
+    0.0506447241593551, 0.05065939925705726, -0.09329630807423786, 0,
+    -0.0111187527981465, -0.01110501160603743, -0.00942221053779083,
+    -0.009446864569104436,
+    -0.09906252610411573, -0.09903145500687446, 0.2033576388710656, 0,
+    0.005345095384925483, 0.005352194077466755, 0.002873839167100622,
+    0.002838434086452182,
+};
+
+constexpr double kGainsA4To4_5_0[] = {
+    0.14880034234777, 0.148807244026421, 0.09873102927447007, 0,
+    0.3194409180394294, 0.3194319472597746, 0.1130930542438754,
+    0.1130802922697725, 0.1526459497855447, 0.1526519757147214,
+    0.2138771178046369, -0.2138812202086008, 1.129370097276423e-05, 0,
+    0.3206651417164275, -0.3206418247846819, 0.1002161015837666,
+    -0.1002061286331226, 0.1387085647394005, -0.1387136073184941,
+    -0.1765082111954965, -0.1765177426514644, -0.1284127283172885, 0,
+    -0.2529812831667442, -0.2529706100735736, 0.2186265609506895,
+    0.2186270428971414, 0.3018879639034588, 0.3018912587368655,
+    0.1956689548390962, 0.1956926254834118, 0.1853723637727758, 0,
+    -0.357875699509571, -0.3578856638137689, 0.1418486115759714,
+    0.1418185713814799, -0.09023425690671528, -0.09024443692090525,
+    0.2777096224947829, -0.2777190435729424, 3.119864739998226e-05, 0,
+    -0.08651667124026972, 0.0865145301273275, 0.1243746165508166,
+    -0.1243482849196163, -0.0232043475632597, 0.02321423912376345,
+    -0.1226821860461714, 0.1227029242723437, -9.089068452335792e-06, 0,
+    -0.1684148995193868, 0.1684152598059048, 0.1426448484149321,
+    -0.1426485665016176, 0.204079446167641, -0.2040778811632765,
+    -0.006474882203330848, -0.006474951479849255, 0.03477523660641105, 0,
+    -0.120610313311354, -0.120614023682432, 0.1206542131368401,
+    0.120689978342644, 0.1780229468229807, 0.178008716351761,
+    -0.1480317094532608, -0.1480414760896732, -0.1153698553754233, 0,
+    0.08352079248795692, 0.08353422970497, 0.2139303923418946,
+    0.2139329577197736, -0.1459158231530552, -0.1459210262362154,
+    -0.0428631081953435, -0.04282928275757358, 0.2064818999371299, 0,
+    -0.01565127537647818, -0.01565017885231514, 0.03080359067705063,
+    0.03077107223853199, -0.06494243060599057, -0.06496984949291638,
+    0.1204796200887174, -0.1204999029173508, 3.924368187466761e-05, 0,
+    -0.1185342588402408, 0.1185320755148111, 0.06328200148080614,
+    -0.06324491657306323, -0.06085679569937869, 0.06087609618064502,
+    -0.1489260965845935, 0.1489274045367897, -2.86365749759304e-05, 0,
+    0.02458335240227507, -0.0246024465011353, 0.1758933560798453,
+    -0.1758855115805885, -0.03916037748054759, 0.03916411276598893,
+    -0.05842546419544722, 0.05840724423869023, 4.156494862028362e-06, 0,
+    -0.0759760821124788, 0.07596964142943387, 0.062196350036385,
+    -0.0622182403035983, 0.1027945548880054, -0.1027846113914221,
+    -0.02318519061333009, -0.02319765412915259, -0.06542850444589736, 0,
+    -0.05358742253098773, -0.05357614919053097, -0.01654838098260834,
+    -0.01653815403783153, -0.02195461692528162, -0.02196963465666747,
+    -0.00714077979383814, -0.007147074064262997, -0.01781200199007729, 0,
+    0.04959840877470102, 0.04957988132921495, 0.1223303906503293,
+    0.1223735917683498, -0.1016620643255274, -0.1016483828007994,
+    0.006634740244633631, 0.006642270020838664, -0.08319015439784928, 0,
+    0.09437684308815779, 0.09438636348144423, 0.0375755465307139,
+    0.03758173428469819, -0.08244429665074234, -0.08246600020910856,
+    -0.1583767529260154, -0.1583518131492059, 0.220495483339999, 0,
+    -0.03517993183180473, -0.03518421281318748, -0.01031362209124537,
+    -0.01036216240288167, 0.01490002922783727, 0.01493639097408052,
+    0.008637003485200684, -0.008657525171174721, 3.673109266129308e-05, 0,
+    -0.006364791794974473, 0.006408305806287798, 0.02553110560332451,
+    -0.02548229807639642, 0.009882555744988636, -0.00992759414411218,
+    -0.07824208866990565, 0.07823421055701048, -2.574863250371154e-05, 0,
+    0.07538128275413632, -0.07540854411296632, 0.08484222891938628,
+    -0.08483704209907535, -0.08578534113691431, 0.08578846260626738,
+    -0.01827596509869978, 0.01828738930617193, 2.569611658188663e-05, 0,
+    -0.01432999289482081, 0.01437154398493451, 0.1020333136154677,
+    -0.1020456523903753, -0.03613910233016258, 0.03613131210519337,
+    0.005154717348949241, -0.005141999134250314, -1.229056108407755e-05, 0,
+    -0.01489708407225037, 0.01483560243143153, -0.04346714212458838,
+    0.04346193629301039, -0.04327670814390781, 0.04327389434182215,
+    0.09121044593267616, 0.09123599950078545, 0.08263221797504036, 0,
+    0.07006929214444085, 0.07007513935473279, -0.03032114795448312,
+    -0.03035072537977067, -0.07882437272586448, -0.0788209093173031,
+    -0.01656136168411658, -0.01660173841477965, -0.04046287234072223, 0,
+    0.0595057033982874, 0.05951708698500908, -0.01625265243785143,
+    -0.01626633827497153, -0.0110682854704349, -0.01104768581979714,
+    -0.01067114155265424, -0.01069036191694097, -0.03914462744414693, 0,
+    0.06139260628002636, 0.06139154204747432, 0.007956472306490494,
+    0.008003699074299431, -0.02677934108640597, -0.02676784215902006,
+    0.04627297548266877, 0.04628666155700855, -0.0936370898877847, 0,
+    -0.03072576785106205, -0.03072925629943687, -0.01476259504438766,
+    -0.01478331597536743, 0.01981632621950097, 0.01983371033809042,
+    -0.0964376468943513, -0.09641069735126705, 0.2041004398071749, 0,
+    0.0003041484389473702, 0.0003133716981199196, 0.005331055552210799,
+    0.005296354388156886, 0.006298857447293235, 0.006299640389632421,
+};
+
+constexpr double kGainsA4To4_5_1[] = {
+    0.07940071261202734, 0.07940682253048634, 0.03299459846035378, 0,
+    0.3371799297878094, 0.3371713866273835, 0.1131382557421843,
+    0.113125488667323, 0.1527069599482573, 0.1527129882859023,
+    0.1417712196100981,
+    0.1620801770789029, -0.1620816858395965, 1.597551990686756e-05, 0,
+    0.3474283628870999, -0.3474165309132732, 0.1002561563685326,
+    -0.1002461794318585, 0.138764004350581, -0.1387690489451134,
+    -6.240716477661926e-06,
+    -0.01740349366079623, -0.01741581756660569, 0.009253766741559973, 0,
+    -0.2869903992127208, -0.2869871454974565, 0.2187139425161725,
+    0.2187144246552508, 0.3020086237298389, 0.3020119198801383,
+    -0.2818562220407755,
+    0.1332413119112192, 0.1332608240373881, 0.09423494741894617, 0,
+    -0.3349302022410867, -0.3349425273187472, 0.1419053062140209,
+    0.1418752540129406, -0.09027032210663619, -0.09028050618961617,
+    0.1980644365552644,
+    0.2191461170660567, -0.2191637064921992, 4.110709907051604e-05, 0,
+    -0.04867678276398624, 0.04866857271327028, 0.1244243271104728,
+    -0.1243979849549375, -0.02321362197258707, 0.0232235174865905,
+    4.911799386626645e-06,
+    -0.02801425051202629, 0.02803568945828082, -2.427780698362912e-06, 0,
+    -0.2118016017834684, 0.2118329223543314, 0.1427018612962051,
+    -0.1427055808689508, 0.2041610134822962, -0.2041594478524242,
+    7.049297296640264e-06,
+    -0.152155593487712, -0.1521512721649092, -0.07007067556172558, 0,
+    -0.1027317842300585, -0.1027191478920857, 0.1207024367103171,
+    0.1207382162109059, 0.1780940997685224, 0.1780798636096092,
+    0.1695183745377205,
+    -0.02879218704627559, -0.02880556864508738, 0.02411405680228404, 0,
+    0.04848733106569025, 0.04849053225943706, 0.2140158969233414,
+    0.2140184633265612, -0.1459741433910008, -0.1459793485537507,
+    -0.3040105248552197,
+    -0.03885256999431626, -0.03882987184011355, 0.1237285824620116, 0,
+    -0.01308546976218553, -0.01309105704141566, 0.03081590238320451,
+    0.03078337094758227, -0.06496838706447369, -0.0649958169102933,
+    0.1030454024018621,
+    0.0918147555754615, -0.09183316287020565, 6.487595777343506e-05, 0,
+    -0.09357393938465361, 0.09357941886885474, 0.063307294292129,
+    -0.06327019456213724, -0.06088111919445344, 0.06090042738981571,
+    7.943324508345513e-06,
+    -0.03989757695693173, 0.03992709550826964, -7.253814879055514e-06, 0,
+    -0.03746729582226984, 0.03748012242096194, 0.1759636578617765,
+    -0.1759558102271979, -0.03917602926171397, 0.0391797660400896,
+    -1.193186424065547e-05,
+    -0.1427913744520498, 0.1427665452345517, -2.050857516475557e-05, 0,
+    -0.04634255524667853, 0.04629274039817592, 0.06222120893006141,
+    -0.06224310794646698, 0.1028356402396213, -0.1028256927687803,
+    2.173968376987545e-06,
+    0.03950813776855264, 0.03950905700327133, -0.02585109168688882, 0,
+    -0.04968784911094556, -0.04968709020554875, -0.01655499510776396,
+    -0.01654476407543968, -0.02196339183711379, -0.02197841557084845,
+    0.01571046390715405,
+    -0.1239916622155602, -0.1239909134891206, -0.1021124496914955, 0,
+    0.06867496549890556, 0.0686835173126209, 0.1223792841653473,
+    0.1224225025501689, -0.101702697038645, -0.1016890100456288,
+    0.1834091076698336,
+    -0.003816766945848655, -0.003802101646674355, 0.03153007225765119, 0,
+    0.09091500254733501, 0.09092081134173198, 0.0375905648801105,
+    0.03759675510724183, -0.08247724832722284, -0.08249896056015676,
+    -0.1178511604228905,
+    -0.1383296270681458, -0.1383257517083955, 0.1371438621546663, 0,
+    -0.04960980651521458, -0.04962159720914855, -0.01031774428225553,
+    -0.01036630399468377, 0.01490598453296584, 0.01494236081242179,
+    0.0509165405732427,
+    -0.001700991810463474, 0.001703326620911814, 7.764725515023372e-05, 0,
+    0.001473894322794926, -0.001407201074464829, 0.02554130998090073,
+    -0.02549248294637899, 0.009886505645623838, -0.009931562045880476,
+    6.691244324817917e-06,
+    -0.02449092963547788, 0.02449794070671733, -1.396234191327123e-05, 0,
+    0.03466978590507441, -0.03468181880624065, 0.08487613901132483,
+    -0.08487095011792417, -0.0858196281758333, 0.08582275089278811,
+    -7.525910282803577e-06,
+    -0.1305546948917367, 0.1305265882281199, -4.080108218621278e-05, 0,
+    0.03712182239709835, -0.03713838763831204, 0.1020740947110325,
+    -0.1020864384175526, -0.0361535465556173, 0.03614575321701885,
+    1.887828670656211e-05,
+    0.03318585765485356, -0.03317170901616879, 5.778675173527731e-06, 0,
+    -0.01533648640262589, 0.01530753757599962, -0.04348451525120851,
+    0.04347930733894228, -0.04329400515708921, 0.04329119023037152,
+    -1.026148600691253e-05,
+    0.1020333196338463, 0.1020217122529316, 0.06301998348031534, 0,
+    0.06713667450991241, 0.06714046727099308, -0.03033326683594009,
+    -0.03036285608285495, -0.07885587757622234, -0.07885241278339153,
+    -0.06934076249901731,
+    0.03951350784429666, 0.03949368289648853, -0.04293617784955551, 0,
+    0.06622376123030099, 0.06621360702846424, -0.01625914836500271,
+    -0.01627283967213463, -0.01107270928841664, -0.01105210140442556,
+    0.01235612792295229,
+    0.009714210238157956, 0.009690625207039706, -0.09702691891677909, 0,
+    0.06256685641679463, 0.06258634353055262, 0.007959652382153945,
+    0.008006898025752199, -0.02679004436388772, -0.02677854084056308,
+    0.01335090918065808,
+    0.009947611530178735, 0.009987962225888039, 0.03332283014139732, 0,
+    -0.009377391503039177, -0.009379083367222889, -0.01476849541925502,
+    -0.01478922463206194, 0.01982424649048567, 0.01984163755723134,
+    -0.04317256968314771,
+    -0.08138675441664024, -0.08137847000235635, 0.1358145743406962, 0,
+    -0.0183892022914231, -0.01837795878099501, 0.005333186290478845,
+    0.005298471256920578, 0.006301375000613864, 0.006302158255882671,
+    0.02586365453993508,
+};
+
+constexpr double kGainsA4To3_7_0[] = {
+    0.1123604110589052, 0.1226151677203144, 0.1226227271688621,
+    0.1303363076725634, 0.13033317033403, 0.1826700321984619,
+    0.1826638710807236, 0.1867545157161114, 0.1867472901885966,
+    0.2074448841670024, 0, 0,
+    4.898380137886894e-06, 0.1385443536978279, -0.1385526731108761,
+    0.1454975389383767, -0.1454743163296732, 0.3443968625679994,
+    -0.3443909020622156, 0.1564353507675408, -0.1564209130096965,
+    -8.952546986881955e-06, 0, 0,
+    -0.1313416508506257, -0.177521595359358, -0.177546540550275,
+    0.248218470995083, 0.248228508603257, -0.1300337468811398,
+    -0.1300311819262636, -0.2054600858683804, -0.2054494974859075,
+    0.4085390383380552, 0, 0,
+    0.1969582800963986, 0.1629523878260165, 0.1629528145113696,
+    0.1445715104024297, 0.1445616948294321, 0.00110371350510004,
+    0.001098782561119352, -0.306192655253276, -0.3061899107585034,
+    -0.1937594417284194, 0, 0,
+    7.339458192207837e-06, 0.2325742272310514, -0.2325793567553668,
+    0.1247900228491535, -0.1247464856555062, 0.001698211406972387,
+    -0.001699389131457096, -0.2514520364973284, 0.2514375236649317,
+    -9.02938731802151e-06, 0, 0,
+    -2.066558965896511e-05, -0.1053306872825827, 0.1053352474974022,
+    0.2224404160856463, -0.2224248904290061, -0.05907695412853126,
+    0.05908308269667903, -0.09484393897793704, 0.09484543946640228,
+    -3.362941931181731e-07, 0, 0,
+    0.03067491686237517, 0.03641385808053609, 0.03645143249519679,
+    0.126651238554003, 0.1266759479718327, -0.009544746867233191,
+    -0.00956448215379215, -0.02481010061295243, -0.02481967765634472,
+    0.2390437252525104, 0, 0,
+    -0.07185334015916113, -0.1296853052322763, -0.1297087230074764,
+    0.2093783659964527, 0.2093930696423178, -0.06212841053186783,
+    -0.06211141864603211, 0.1547901083309578, 0.1547817409644094,
+    -0.2825926175783955, 0, 0,
+    0.2297359134462018, 0.03283544215749199, 0.03282072645358541,
+    0.01032093970354011, 0.01030525298408521, -0.3346890135365859,
+    -0.3346984384043236, 0.1747714945493574, 0.1747887360226516,
+    -0.002736527887211316, 0, 0,
+    4.896239360134794e-06, 0.1801914958899988, -0.1801820985773293,
+    0.03779884780090727, -0.03774762090260381, -0.2307209897453485,
+    0.230742599079259, 0.1695471438707618, -0.1695616429226805,
+    2.78827249017454e-05, 0, 0,
+    -3.805732956613696e-05, -0.1601347704159805, 0.160139732654042,
+    0.1570333002745472, -0.1570075971044731, -0.09775926105046927,
+    0.09773445446752813, 0.1184965115808888, -0.1184933608758913,
+    -1.303848571669006e-05, 0, 0,
+    2.516627942914349e-05, -0.03261643519584018, 0.03259987787197341,
+    0.1380990682759398, -0.1381101705117045, -0.0483798345377912,
+    0.04843011415318921, -0.03855562730039249, 0.03852610132185518,
+    1.751891212710723e-05, 0, 0,
+    -0.08325641529686349, -0.009841137533167213, -0.009879880295062392,
+    -0.03829946365365227, -0.03830185591549119, -0.1010823711364894,
+    -0.1010827294069715, -0.01730595456266561, -0.01729615822665292,
+    -0.02622252473020113, 0, 0,
+    -0.05971689133197989, -0.02952897171438336, -0.02950297508082125,
+    0.1012649957691045, 0.1012934692430696, -0.01430834873714701,
+    -0.01436114433666787, 0.07943314928751199, 0.07945031634235626,
+    -0.1373808289035617, 0, 0,
+    -0.06573899096182444, -0.02266215221890921, -0.02269703325939491,
+    0.01419822212527038, 0.01419438666552088, 0.07257393442121668,
+    0.0725842588849528, -0.04407445255089836, -0.04407287130253839,
+    -0.00559223826103615, 0, 0,
+    0.2348986978686016, -0.1056841048641525, -0.1057128691659911,
+    -0.02987504057026472, -0.02988474154029, -0.004562257954305448,
+    -0.004552820766536503, -0.002885745210445999, -0.00289359203411013,
+    0.03966814370106572, 0, 0,
+    1.162237139287338e-05, 0.05731464624119724, -0.05726478766179363,
+    -0.002698591113857177, 0.002760654406607841, -0.004769640674724171,
+    0.004740948405141533, -0.01742592192617912, 0.01744806949858832,
+    -4.23574696056098e-05, 0, 0,
+    -4.013652978638745e-05, -0.1122910473744159, 0.112330479206231,
+    0.03882549206345784, -0.03880391340821208, 0.06884626214103888,
+    -0.06882743927979089, -0.03042821328424646, 0.03043102838621134,
+    5.348076997016931e-06, 0, 0,
+    4.14857074603169e-05, -0.01183962201012711, 0.01182703320444324,
+    0.05310809939065447, -0.05312609580604974, -0.0426927104638186,
+    0.04273278682022898, 0.01095406238101881, -0.01093931894063078,
+    -2.458649755246717e-06, 0, 0,
+    -1.652390253964234e-05, 0.03287562285887067, -0.03283880576653393,
+    0.009366155298474293, -0.009374170575931033, -0.04974638686094934,
+    0.04974848811646589, 0.01239104393364177, -0.01237023557369494,
+    1.373104582072606e-05, 0, 0,
+    0.06431317636992831, 0.06571143022331309, 0.06575218642395238,
+    -0.05583703639501474, -0.05585988159211741, 0.01428727639761995,
+    0.014315878427945, 0.0704724651011573, 0.07043625351100907,
+    -0.09130250135195447, 0, 0,
+    -0.03978196724434644, 0.03556489713708874, 0.03555500075648275,
+    -0.04532478909595429, -0.04534429896584523, 0.01585742507285647,
+    0.01588398793672761, 0.005494081597965651, 0.005492169414919967,
+    0.06778354357886072, 0, 0,
+    -0.03113699019777703, -0.006771674969827003, -0.006763829644558271,
+    0.006615100526839154, 0.006611970689073472, -0.02005100570140637,
+    -0.02002862361492016, -0.005702419366895396, -0.005732680846314402,
+    -0.006979851623084773, 0, 0,
+    -0.07907279038863116, 0.05380232792356915, 0.05376186473130709,
+    -0.02821061832295214, -0.02820181411137643, 0.08345926614593134,
+    0.0834638609017798, -0.05095629601582578, -0.05095912042921961,
+    0.04157369810876777, 0, 0,
+    0.2036015126271508, -0.1453689621957212, -0.1453853649145353,
+    -0.000483087754422467, -0.0004999256650668462, 0.1056192080169197,
+    0.1056321017128684, -0.04297089056526018, -0.04299877730021609,
+    0.002751182885788377, 0, 0,
+};
+
+constexpr double kGainsA4To4_9_0[] = {
+    0.1067436492781124, 0.1067588170942154, 0.08179979954561375, 0,
+    0.1551159289430734, 0.1551172743434167, 0.1826102180673083,
+    0.1825971722053472, 0.1446250022046494, 0.144614702234965,
+    0.1448187179696745, 0.1448218633244734, 0.0629316391364225,
+    0.0629058203966272,
+    0.1309105810939922, -0.1309330040839264, -7.300361393441891e-06, 0,
+    0.2954767558797013, -0.2954835988689154, 0.1503475709776512,
+    -0.1503269644235321, 0.1413964341749532, -0.1413683763034932,
+    0.1352635758277781, -0.1352779760590111, 0.02131850007519258,
+    -0.0212805001758174,
+    -0.1577552480661801, -0.1577573868437445, -0.09686507036869996, 0,
+    -0.1675653864439873, -0.1675524749221826, -0.2058900063759927,
+    -0.2058856384782307, 0.2787298807950395, 0.2787278846405402,
+    0.27935745536915, 0.2793559873023966, -0.11459395064769,
+    -0.1146033300233657,
+    0.129947270161922, 0.1299709351986355, 0.1289101664962917, 0,
+    0.026798948695138, 0.0267777051660777, -0.30373793924856,
+    -0.3037253730124654, 0.1417454150870625, 0.1417396370351376,
+    -0.1419678089748937, -0.1419658444151368, 0.07459765598066893,
+    0.07453297955422995,
+    0.2113651305880359, -0.2114004370543397, -1.269234756425315e-05, 0,
+    0.04617096787747727, -0.04613414122660273, -0.237135896027697,
+    0.2371218212270773, 0.1306033005463414, -0.1305682291467473,
+    -0.1152716482405122, 0.115265468152264, 0.05238293614430179,
+    -0.0523086684559857,
+    -0.1014699272910045, 0.1014557385443124, -1.932424912339137e-05, 0,
+    -0.1448407997875103, 0.1448187375935985, -0.1070691799559068,
+    0.1070737208845072, 0.2015003865317472, -0.2014782363418891,
+    0.1964920728682123, -0.1964944833770133, -0.0133766847166402,
+    0.01336471134591492,
+    0.03909395265727719, 0.03910250560388594, 0.04628566787617318, 0,
+    -0.01872571869732903, -0.01875110763205228, -0.03346996227757496,
+    -0.03346710393523553, 0.1501519931855257, 0.1501758664794146,
+    0.1504819302758822, 0.1504690414340726, 0.07705061613719544,
+    0.07708344978584102,
+    -0.1046636241474173, -0.1046492488675115, -0.01808106133779947, 0,
+    -0.02493434285997004, -0.02492962939717713, 0.1711654612399493,
+    0.1711670621641477, 0.2016576622644617, 0.2016831035531091,
+    -0.2030135501707211, -0.2030169413248334, -0.06176996472592895,
+    -0.06178287085309517,
+    -0.006753698042924442, -0.006752083278649186, 0.1555340407917483, 0,
+    -0.304935748226014, -0.3049410699194062, 0.1732446110022869,
+    0.1732694495775594, 0.0006261029123247919, 0.0006088724862121873,
+    0.0002981635345306351, 0.0002713008328824824, 0.07763802207381247,
+    0.07758578428059601,
+    0.1424825065412975, -0.1425101956632665, -1.17592901690777e-05, 0,
+    -0.2298158015897505, 0.2298073436666246, 0.1503183856272235,
+    -0.15034019646126, 0.02933016014303974, -0.02927373500049988,
+    0.005888785865729444, -0.005859018322376044, 0.08295814066062794,
+    -0.08287199095562212,
+    -0.1489522420638671, 0.1489094140737087, -4.327544258469129e-05, 0,
+    -0.03310568275995274, 0.03311540426312987, 0.1434345487682046,
+    -0.1434459126520634, 0.1709922003766753, -0.1709728661005573,
+    -0.1578304209144621, 0.1578160443857594, -0.03084935329128529,
+    0.03084953336204551,
+    -0.02899758172703261, 0.02898606556718919, 5.437228618188735e-06, 0,
+    -0.0863617898686448, 0.08640953890663919, -0.03522112835395005,
+    0.03520137113960609, 0.08986518370720149, -0.08987735837323489,
+    0.09448211612754652, -0.09445770764196779, -0.006882642108500149,
+    0.006931298100591832,
+    -0.01371964113378637, -0.01378221455692954, -0.1016478182442791, 0,
+    -0.03476308761716179, -0.03477713975144505, 0.003246483607067298,
+    0.003283325795353323, -0.0321707692219836, -0.03216136431799833,
+    -0.03346637873500889, -0.03347449553593612, -0.05477672037895531,
+    -0.05475472020757376,
+    -0.02082153528550457, -0.02081465105684617, -0.04347878393308765, 0,
+    0.002827150761375944, 0.002791991621201526, 0.08188037773283845,
+    0.08188482595158052, 0.08943366698793523, 0.08947786506361945,
+    -0.09093785329372681, -0.09095663704341156, -0.009650679950202305,
+    -0.00965682017913058,
+    0.007290466433003603, 0.007290713738087927, -0.007256426004772428, 0,
+    0.1296192558940084, 0.1296251949824959, -0.0552031596533463,
+    -0.05518984043820516, 0.0003340750453516179, 0.0003387432572048992,
+    0.001334503462388695, 0.001326494344852418, -0.05769408370288343,
+    -0.05771938906481075,
+    -0.1440437291755738, -0.1440734153118214, 0.1721801190499561, 0,
+    -0.04474581294972851, -0.04471241547868685, -0.00291893961288979,
+    -0.002954605170200503, -0.02803254876255252, -0.02807536751371461,
+    0.02845997323380779, 0.02847431591080143, 0.0712295569648972,
+    0.07120501390639383,
+    0.005183921173445661, -0.005166305513354875, 7.585090127585083e-06, 0,
+    -0.02447536774197962, 0.02445830910111417, 0.0007159037613538407,
+    -0.0006728544135932543, 0.0009493860001642206, -0.0008644623592217334,
+    0.02572040089300816, -0.02576864822704373, 0.1056496957839705,
+    -0.1055574182979886,
+    -0.09105605284906766, 0.09102838533096673, -4.838988131591893e-05, 0,
+    0.08123836338863229, -0.08126575074961484, -0.05930850781381035,
+    0.05928898974395878, 0.02617393066196081, -0.0261418393609298,
+    0.004998030457542465, -0.004997057517335301, -0.04855202199597742,
+    0.04857716758926,
+    -0.00802199043342592, 0.008017305186622194, -1.063523217027803e-06, 0,
+    -0.0004752794453399921, 0.0005335250066670434, 0.01155179304007023,
+    -0.01152622559346053, 0.07646176698704121, -0.07647239513916217,
+    -0.08308106458124725, 0.08306777454867154, -0.00583259687795313,
+    0.005921200282692536,
+    0.03189637426056129, -0.03182469007793468, 1.120314356029361e-05, 0,
+    -0.01362568027069613, 0.01361971679979899, 0.02555281991889026,
+    -0.0255542591642433, -0.05593368155037827, 0.05591223250030925,
+    -0.04716554406630459, 0.04718437266414582, 0.002395895815042902,
+    -0.002487825626541136,
+    0.05726760849426569, 0.05728151102822529, 0.05193239330348666, 0,
+    0.07065962600183888, 0.07069325462863649, 0.07474179734420969,
+    0.07470946016557367, -0.05946948520251363, -0.05948203136252837,
+    -0.06152593486512655, -0.06152401558860759, 0.04675914492456439,
+    0.04682221979665322,
+    0.02621241849136637, 0.02614565027396455, -0.05966350227561072, 0,
+    0.0002944626531748033, 0.0003622922591942466, -0.004321688378867303,
+    -0.004360807694597959, -0.05630590291269544, -0.05631292929099661,
+    0.05762446343983354, 0.05759656782411302, 0.01478886449306507,
+    0.01488154683610292,
+    -0.004843612540606624, -0.004850836743527341, -0.02864736690545277, 0,
+    0.01727969708339139, 0.01727460493320176, -0.01134953019486973,
+    -0.01136705165324818, -0.0005392161630838837, -0.0005166340672913927,
+    0.00145601036705055, 0.001479684452590578, -0.006323637477637164,
+    -0.006310824264533832,
+    0.0864102934168704, 0.08638368321116917, -0.02258331288473157, 0,
+    0.02631463089562277, 0.02635347280775973, -0.04966096783714154,
+    -0.04970048137355766, -0.02538880001753369, -0.0254222007672872,
+    0.02512091882415539, 0.02510670652627169, -0.06510379136450765,
+    -0.06512579236117971,
+    -0.172814457395148, -0.1728483467183413, 0.1672984876747167, 0,
+    0.1221345014399925, 0.1221194462662331, -0.04173497092499592,
+    -0.04173413368135852, 0.005629750970923235, 0.00560944606539949,
+    0.006116801469293687, 0.006115492482099587, 0.04356962501392034,
+    0.04356949911352052,
+};
+
+constexpr double kGainsA4To9_10_3[] = {
+    0.03823210282048346, 0.03823477819232632, 0.02292488296892596, 0,
+    0.1363195444608907, 0.1363179545825965, 0.03879732596979741,
+    0.0387989461769478, 0.1363178823346838, 0, 0.124509620027289,
+    0.1245128034893679, 0.0516090105158786, 0.05159543828508154,
+    0.05776512470800611, 0.1268024568256103, 0.05628103094771569,
+    0.05627091643220374, 0.05701791680037214, 0.05701893148746988,
+    0.05627444461189659, 0.09345551434412917, 0.08729256621321124,
+    0.0872838191617533,
+    0.09665077154906419, -0.09665365469767941, 1.20731773442431e-05, 0,
+    0.172260335722428, -0.1722657355431371, 0.05093454631346386,
+    -0.05093718347308386, -9.041363016077392e-06, 0, 0.2124797465660029,
+    -0.2124965928513465, 0.08111157681883598, -0.08110564102084039,
+    1.120424181734717e-05, 1.452679300065655e-05, 0.08918274250765471,
+    -0.08917485259243114, 0.1285011095351327, -0.1285016001498655,
+    7.28427902371139e-06, -5.026509173806921e-06, 0.07708303681030972,
+    -0.07706688881700441,
+    0.0002989057264425856, 0.0002880048949267783, -2.102714415738882e-05, 0,
+    -0.174459197306348, -0.1744459659930661, 2.572226071681931e-06,
+    1.380655025897573e-05, -0.174440125888425, 0, -0.1780224965310851,
+    -0.1780134729131291, 0.08788581760736663, 0.08786185120377016,
+    0.09270859799790881, 0.321410131434827, 0.09184726065170819,
+    0.0918217554565022, 0.09227195120137768, 0.09227156836169463,
+    0.09183096862387419, -0.1839140457891339, -0.1790620900070751,
+    -0.1790742701548452,
+    0.05062370554832916, 0.05063413390693076, 0.06678018315720176, 0,
+    -0.1722621024871397, -0.1722661301431688, 0.09828453529834233,
+    0.09828460730645903, -0.2436203449008339, 0, -0.01356110302122599,
+    -0.01355974459573535, 0.08112067513646708, 0.08109584704432808,
+    0.1308842396209364, -5.908230105904188e-06, -0.08919395888373484,
+    -0.0891886469772124, -6.644146115996523e-05, -7.059039708591902e-05,
+    -0.1261249843748181, 0.1251930055680179, 0.07710116338989557,
+    0.07706834829453839,
+    0.1179731149925308, -0.1179891515283385, 3.129721709467359e-05, 0,
+    -0.2693719381811585, 0.2693753332303967, 0.1188407966375405,
+    -0.1188412092047162, 8.165935559244452e-06, 0, -0.03362570847894904,
+    0.03361202870654473, 0.1187240703535395, -0.118709487189775,
+    1.904654740772813e-05, 5.380999066034464e-06, -0.1272524827619931,
+    0.1272521917453116, 0.0002841251778859902, -0.0002729725670637376,
+    -1.313014963564801e-05, -6.3837154665182e-06, 0.1142637427774075,
+    -0.1142188188348765,
+    0.000821751547042673, -0.0008008289711345396, -6.891709449555932e-07, 0,
+    -0.103667973720996, 0.1036684371185857, -2.604919141811246e-06,
+    -1.185454034246532e-05, 3.297640384536888e-06, 0, -0.1558584055517047,
+    0.1558519784334124, 0.1214675615911321, -0.121448105611989,
+    1.841048892496206e-05, 2.595660654856252e-05, 0.1279760038104183,
+    -0.1279474405992879, 0.1823817836422306, -0.1823705806512157,
+    1.251143621129956e-05, 6.999155938184568e-06, -0.1127865395715281,
+    0.1127927511646833,
+    -0.08026507128158301, -0.08027799624319994, -0.05243645956612171, 0,
+    0.01655686868486402, 0.01654207701531675, -0.08153751665352146,
+    -0.08152984834373733, 0.01654647681429528, 0, 0.04116964363079337,
+    0.0411495853370632, 0.01392161010441098, 0.013908645209311,
+    0.002241223628958742, 0.3733772929270274, 0.005440414937535238,
+    0.005410621984768373, 0.003839300589938719, 0.003839563184483447,
+    0.005425687053960665, 0.1105116239319767, 0.1221254052615034,
+    0.1221895509812613,
+    0.0001470433880190757, 0.0001313619385131432, -5.439316702625464e-05, 0,
+    0.1036591067539999, 0.103646301196483, 6.621151161714635e-06,
+    3.008756082238878e-05, 0.1465792449971335, 0, -0.002695697162410267,
+    -0.002686740006926368, 0.1214753233510208, 0.1214610992262887,
+    0.1837674482011896, -7.050271944397974e-06, -0.1279803451555044,
+    -0.1279809554149095, -0.0001641791670267622, -0.0001623702386424741,
+    -0.180972497420237, -0.1715081904385126, -0.1128072306056084,
+    -0.1127990520448503,
+    -0.08142577933998399, -0.08141086111376636, 0.09082956348683063, 0,
+    -1.101800593053779e-06, 7.469996714094643e-06, 0.08359879224749796,
+    0.08359007697442895, 0.269381618240647, 0, -0.2382498174644657,
+    -0.2382609353079846, 1.592770009987203e-05, -2.736300926078357e-05,
+    0.1352255140550254, 1.785528919298898e-06, 1.888037795506755e-05,
+    1.132130475369056e-05, -0.1312353814556686, -0.1312413393035063,
+    0.1272560440931704, 0.1307759897254104, 2.006514594860811e-05,
+    4.736340090203372e-07,
+    -0.01881607904198624, 0.01878052782814953, 5.053451380850548e-05, 0,
+    0.1660870844882535, -0.1660933548235993, 0.1595718912939753,
+    -0.1595599663021175, -5.527483804301651e-06, 0, -0.2175129743473301,
+    0.2175274279260965, 0.07354058593213211, -0.07348156507320348,
+    1.95031776502148e-05, -1.028901761730554e-05, 0.07266692146812752,
+    -0.07265561436724573, -0.1083956127051377, 0.1083975480926701,
+    1.767981412269139e-05, 2.501912890070488e-06, 0.0715732289418506,
+    -0.0715113603634228,
+    0.0004342977194900121, -0.0004005248235218846, -1.969787461659893e-06, 0,
+    0.1461423374493725, -0.1461229450080104, -6.415478267759876e-06,
+    -2.151795894561911e-05, 1.449145326127919e-05, 0, -0.007512777893718041,
+    0.00750656671958732, 0.1764421918286514, -0.1764417536083895,
+    2.837331928133377e-05, 8.922301497010977e-06, -0.1838111577178265,
+    0.1838114629517416, -9.036220636732641e-05, 8.624243752522699e-05,
+    -1.749347376572233e-05, 1.375928067250205e-05, -0.1662815243418457,
+    0.1662701062229265,
+    -0.1017492165518994, 0.1017651498180887, -1.336891727805302e-05, 0,
+    -0.05142781325520159, 0.05142331981418334, -0.05524841702388382,
+    0.05524531748145852, -1.201611218692818e-05, 0, -0.04030650382154461,
+    0.04033040740674802, 0.06503341805131382, -0.06499948669293619,
+    1.55108987056255e-05, 2.190623687473942e-05, 0.05866342289060696,
+    -0.05862098395880899, 0.08045957729337808, -0.0804274796412843,
+    1.605613313822981e-05, 3.411707620434772e-06, 0.05447776388987324,
+    -0.05452743034829896,
+    -0.0009505121052813532, -0.0009326043364807122, 5.104545047355418e-05, 0,
+    -0.02749673241566609, -0.0274890171971762, -3.066768552911889e-06,
+    -3.318120271923613e-05, -0.02750835155107353, 0, -0.01737409962558105,
+    -0.0173830243310865, -0.07159138993551928, -0.07159889312273481,
+    -0.08557472276811796, 0.2795914730105825, -0.08284936438663229,
+    -0.08287461799533731, -0.08423061401334682, -0.08420468231202415,
+    -0.0828517398376602, -0.0001500752749108316, -0.01403420403574973,
+    -0.01409450922912179,
+    -0.05484962413511664, -0.05487632312584955, -0.08211738070932222, 0,
+    0.05143196579786633, 0.0514424213136709, -0.1036890243857546,
+    -0.1036625999030897, 0.07272635337901318, 0, 0.01460351181426018,
+    0.01458576582332607, 0.06502996672355342, 0.06505512187278327,
+    0.0779212862450837, 3.545807307274616e-06, -0.05864563273463658,
+    -0.0586557911451106, -6.534471583667823e-05, -5.708704037655006e-05,
+    -0.08293545194900269, 0.06303554892954188, 0.05447788589848086,
+    0.05452850455724099,
+    -0.001176632968683588, -0.001167834788531562, -7.508711963724248e-05, 0,
+    2.046469959619307e-05, 2.167466529250052e-05, 1.124631203202514e-05,
+    2.314004083791536e-05, -0.1461132090563752, 0, 0.1579179542676681,
+    0.1579066443281886, 1.30104809658279e-05, -6.44534595592918e-08,
+    0.1892351190633662, 5.211074824303143e-06, 1.091466901681311e-05,
+    3.788850932294967e-05, -0.1865230415310783, -0.1865341993921229,
+    0.1838114938267217, -0.1790834169340256, -1.763075271088742e-05,
+    -1.25257035796414e-05,
+    -0.1579982269412787, -0.1579971086948339, 0.1060284788855187, 0,
+    0.1660787704364424, 0.1660786993450047, 0.02124210349219162,
+    0.02122632005571902, -0.2348966448793808, 0, 0.05046594413816482,
+    0.05044286249964257, -0.0735047997570269, -0.07355239069466986,
+    0.1140298101045362, -9.374275255632695e-06, 0.0726348633184359,
+    0.07265581042704353, -0.001645073360299591, -0.001626433373856112,
+    -0.1027577942257011, 0.1112808160459328, -0.0715258509073568,
+    -0.07152181023383679,
+    -0.1471999653599927, 0.1471655073779819, 6.313490902575946e-05, 0,
+    -4.745284637287271e-06, 1.217026844928918e-05, 0.1495272839660832,
+    -0.1494980905861834, 6.021729699676263e-06, 0, 0.0567815575884362,
+    -0.05674420751709491, 3.146416480075032e-05, 6.508062343129738e-05,
+    1.772074104258577e-05, 3.411200911392786e-06, -1.705946283291265e-05,
+    -1.821910285580304e-05, -0.004170522654583586, 0.004145825859231106,
+    -2.460970620950669e-05, 9.316193398174896e-06, 3.029403206184494e-05,
+    2.053614090579184e-05,
+    -0.001435260168408518, 0.001451474920995584, -2.939706829499813e-06, 0,
+    -0.08347527086875761, 0.08345175553836112, -8.436938036969752e-06,
+    -1.217317543367851e-05, -2.290011042531959e-05, 0, 0.1296689371482818,
+    -0.1296862897051884, 0.1077223283735235, -0.1077128153569085,
+    1.859002813648809e-05, -1.85503433841666e-05, 0.1069911850089749,
+    -0.1070157712709645, -0.1556882638653323, 0.1557164512710874,
+    9.871323396646094e-06, 8.298710831576166e-06, -0.1029645138056101,
+    0.1029360003092854,
+    -0.09115015398808984, 0.09119478511939931, -2.468954411227046e-05, 0,
+    0.02410052107281044, -0.0241098672015466, -0.09199660339768155,
+    0.09198164736824258, 7.288971154556309e-06, 0, 0.02589655962907238,
+    -0.02588834066412029, 0.1182584040807958, -0.1182805683202678,
+    2.814537303548743e-05, 6.402724666169303e-06, -0.1143929810727386,
+    0.1143969970761103, -0.000511820040742381, 0.0004935764626349579,
+    -2.718118781330343e-05, -3.28287136845096e-06, 0.1039135447439871,
+    -0.1039679547764721,
+    -0.001769455222205528, 0.001760133014516096, 3.14936204205116e-06, 0,
+    0.01226718289379625, -0.01225797345974758, 7.296870357308185e-06,
+    2.098831412689642e-05, 3.004284314782851e-05, 0, 0.03415893988974503,
+    -0.03414091285531259, -0.02164652532457464, 0.02167838258705325,
+    5.633267722453271e-06, 6.643564432385106e-06, -0.03349853107578322,
+    0.03352495364253879, -0.05019174075763851, 0.05021590493738465,
+    1.628034250910981e-05, -2.047314563734292e-05, 0.0295127130892968,
+    -0.02946744752759814,
+    0.0693101448671703, 0.06934109953957814, 0.05729977513088362, 0,
+    0.06971614474051291, 0.06969043446396303, 0.07061495309236297,
+    0.07058425048820063, 0.06969664566523706, 0, 0.04904726014318935,
+    0.04904999545097039, -0.07110046764385709, -0.07111558060733092,
+    -0.06479578853302889, 0.111984181110227, -0.06758562247009578,
+    -0.06760757155016431, -0.06624477856805051, -0.0661641201820527,
+    -0.06758254734866895, -0.02243002390900841, -0.02883047947414198,
+    -0.02881808033600779,
+    -0.0003243814881210656, -0.0003074042346021207, 7.685090541746444e-05, 0,
+    -0.01225517578987187, -0.01226458296609336, -2.349790708560969e-06,
+    -4.007479455047275e-05, -0.01730459619208279, 0, 0.004912720806504982,
+    0.004940027459897476, -0.02165136025167383, -0.02161996543708264,
+    -0.05302591832660431, 2.067682138896096e-05, 0.03352390101629833,
+    0.03352038973759733, 0.0002729187748976852, 0.000271808972828073,
+    0.04738645749914762, 0.06407346265601563, 0.02952708888237025,
+    0.02948911134511787,
+    0.05805360648137974, 0.05803883900336139, -0.08499523803056933, 0,
+    -1.119839641380919e-05, -1.068917822440532e-05, -0.05995021788497781,
+    -0.05991025779204648, -0.02409689416041625, 0, 0.001874078398171003,
+    0.001900912910869614, -3.997636979973531e-06, 5.841721636757549e-05,
+    0.1089433456273458, 9.714004175243273e-06, -1.258790506678577e-05,
+    4.852323897588597e-05, -0.1116772413725262, -0.1116816892320618,
+    0.1143932153070106, 0.09460085829731524, -6.33624725172247e-06,
+    1.205464809915298e-05,
+    -0.000837557917019586, -0.0007982742801704139, -9.026937298775722e-05, 0,
+    -0.08349157169292117, -0.08348711064295238, 1.696006997530147e-05,
+    7.997203001272921e-06, 0.1180477601948648, 0, 0.01342010433849352,
+    0.01339413577209284, -0.1076932745691289, -0.1077375442778005,
+    0.1600805598855531, -1.731948431970422e-05, 0.1069761284412267,
+    0.1069754591711661, -0.00086267452442376, -0.0008676519223302055,
+    -0.1513162857911967, -0.1533838892590718, 0.1029173231901619,
+    0.1029166624662674,
+    -0.05678567593879785, -0.05681895653799814, 0.1127034281458242, 0,
+    -0.1629362987163995, -0.1629476166637533, -0.05440139038490015,
+    -0.05441275192939162, 0.162973005457462, 0, 0.1678707648708007,
+    0.1678703709690277, -0.08128061254922057, -0.0812704243711071,
+    0.0801485478268245, 2.593688779903501e-05, -0.06702440868565651,
+    -0.06703347618531502, 0.07361268414637329, 0.0736016214659572,
+    0.06704292670170908, 0.07882856398411162, -0.07987840021045034,
+    -0.07985766070126338,
+};
+
+constexpr double kGainsA4To0_7_0[] = {
+    0.2102367564611581, 0.210239237077834, 0.1637423946321554, 0,
+    0.2330936985805596, 0.2330880400010537, 0.2841970438291144,
+    0.2841849255301637,
+    0.2112737343392371, -0.2112711412716111, 1.095507934440625e-05, 0,
+    0.3693241706354859, -0.3693200348128958, 0.2178074572447251,
+    -0.2177988182986346,
+    2.898399698649118e-05, -7.705571824358431e-06, -3.61019833989049e-05, 0,
+    -1.539889314838639e-05, -2.511191633846241e-07, -6.767575351389014e-06,
+    -1.424789850735237e-05,
+    0.25196560888146, 0.2519737335861483, 0.226865128276472, 0,
+    0.04181081716683226, 0.04179421291561467, -0.3990638376181537,
+    -0.3990614747270843,
+    0.339957782512892, -0.3399544944153869, 3.261000161264469e-05, 0,
+    0.06716456327791129, -0.06713333389048258, -0.3216586354784328,
+    0.3216637589599965,
+    1.884129342522548e-06, 2.175472839752847e-05, -2.173977005323994e-05, 0,
+    -7.521342921629081e-06, -9.212588418755789e-06, -1.170115539756003e-06,
+    2.437998999560933e-05,
+    0.1507262253347413, 0.1507463539921643, 0.1745003369672339, 0,
+    0.1383649363497552, 0.1383734619087005, 0.1209729850991397,
+    0.1209401027773205,
+    1.827292674198364e-05, 8.242864819131987e-06, -1.842145122539785e-05, 0,
+    -1.220781391032175e-05, 1.32688256942619e-05, 6.664288199041082e-06,
+    -4.994267901637592e-06,
+    0.05060153450145487, 0.05062007404113353, 0.256292193983275, 0,
+    -0.3678901949037829, -0.3678986262871552, 0.1906902258465537,
+    0.190701195914938,
+    0.2513970912378535, -0.2514117418085617, 3.824530219577114e-05, 0,
+    -0.2659767209605834, 0.2660000464943407, 0.1749237276683067,
+    -0.1749260130882927,
+    1.272815722011642e-05, 4.360944531552953e-06, -1.660408602241427e-05, 0,
+    -5.729799448900157e-07, -3.279347183058862e-06, -1.648442884175388e-06,
+    1.086643052173874e-05,
+    0.01405483743701603, -0.01405056895203803, 7.221941450682623e-06, 0,
+    0.02402908343461251, -0.02401827207052801, 0.01585659445208495,
+    -0.01582871252918006,
+    8.419843074160296e-05, 2.584665983703175e-05, -5.010314342397549e-05, 0,
+    -1.372111484314794e-05, 1.105039782929825e-05, 1.994062043468069e-05,
+    1.822369377811707e-05,
+    0.03042243559540013, 0.03044243399075609, 0.02516772179006282, 0,
+    0.01894478684623017, 0.01894190219280069, -0.02958279856296776,
+    -0.02958444644062709,
+    1.558064611404887e-05, 3.731592073806326e-05, -4.68584470316108e-06, 0,
+    -2.485255260917319e-06, -8.024800838188553e-07, 1.439554408552222e-05,
+    3.488950113095681e-05,
+    -0.1376424787982618, -0.1376386422979332, 0.2701152218585089, 0,
+    -0.06201409113597203, -0.06200421249590738, 0.03697901182791546,
+    0.03697887146770887,
+    0.08221257495634793, -0.08219050466583419, 4.749043164359598e-05, 0,
+    -0.03527264633949773, 0.03531432852569068, 0.03291920975743828,
+    -0.03289613966019328,
+    2.317393335497538e-05, -2.230633888202588e-05, -7.826079789524247e-06, 0,
+    -3.540900822540009e-06, 1.503170052126439e-05, 2.854156844837816e-05,
+    -2.525111829558184e-05,
+    0.09007508270971396, -0.09007353019682662, 3.176616777450781e-05, 0,
+    0.01983780741474077, -0.019830375026717, -0.08966532410331335,
+    0.0896519571698446,
+    4.241821996469003e-05, 1.455267863284847e-05, -3.644503798594053e-05, 0,
+    -1.330003020452332e-05, -7.274186551808596e-06, 3.625809185420835e-05,
+    2.468330518621767e-05,
+    0.04650599848355349, 0.04654454397148984, 0.06121490256794114, 0,
+    0.03968184116251926, 0.03973967531806956, 0.02105680488372549,
+    0.02100321116925812,
+    5.541431474213017e-05, 9.074631443556908e-06, -3.605281600785673e-05, 0,
+    -3.696387207495957e-05, 3.789690338419637e-05, 2.309231335969978e-05,
+    -1.563770780787512e-05,
+    0.001196322418300816, 0.001231817275551292, 0.05288871252044154, 0,
+    -0.1077401337847209, -0.1077488538788036, 0.05803508914742916,
+    0.05806093482607456,
+    -8.871995342568466e-06, -1.251584757504833e-06, -6.738870244779121e-06, 0,
+    -1.134667725289451e-05, -2.627393906624774e-06, -2.643949957551264e-06,
+    -4.395519855671975e-06,
+    -0.1767870760521144, -0.1768005033030041, 0.2419591694273937, 0,
+    0.1374464389356428, 0.1374496857685961, -0.06155915547599888,
+    -0.06156455182365184,
+};
+
+constexpr double kGainsA4To4_7_0[] = {
+    0.1227392522233813, 0.1227468193219647, 0.1124741179194009, 0,
+    0.156080056143775, 0.1560813881501154, 0.1830650904759321,
+    0.1830521944342445, 0.1422712021347329, 0.1422629271015848,
+    0.1425081775507637, 0.1425112727223439,
+    0.1386845582712175, -0.1386928861033728, 4.903337216824281e-06, 0,
+    0.2901333895422477, -0.290142342351392, 0.1475866793598385,
+    -0.1475684946633604, 0.1390897095997826, -0.1390625803111411,
+    0.1331054849156494, -0.1331196553953919,
+    -0.1777012442507094, -0.1777262146857431, -0.1314745664089598, 0,
+    -0.1738190883418949, -0.1738064109808844, -0.2113415189878441,
+    -0.2113370804348439, 0.2742561377405305, 0.2742562860574109,
+    0.2749003886238853, 0.274898943979709,
+    0.1631172929225302, 0.1631177200396817, 0.1971575985882708, 0,
+    0.02642487921515516, 0.02640405280648556, -0.2982133126059484,
+    -0.298200838468048, 0.1393624540875848, 0.1393620168193715,
+    -0.1397027539777255, -0.1397008207619467,
+    0.2328095884669301, -0.2328147231822385, 7.34688560139142e-06, 0,
+    0.04536403018013771, -0.04533037598562688, -0.2329790869839503,
+    0.2329623867085918, 0.1284001749172005, -0.1283667465584353,
+    -0.1134325227037846, 0.1134264412170424,
+    -0.1054372801799554, 0.1054418450096362, -2.068650289075415e-05, 0,
+    -0.1411747213157653, 0.141158437332722, -0.1045790936062076,
+    0.1045886670641451, 0.1982552224504442, -0.1982351628376835,
+    0.1933570991388312, -0.1933594711886671,
+    0.03645070829710129, 0.03648832073644243, 0.03070595936622075, 0,
+    -0.007437880428489298, -0.007462818836074309, -0.02219490328927572,
+    -0.02219223231805195, 0.147856321405164, 0.1478770254978134,
+    0.1480810349559073, 0.1480683517518107,
+    -0.1298165445964921, -0.1298399860700899, -0.07192605454004165, 0,
+    -0.0246635854196166, -0.02465918192816696, 0.1669097186264945,
+    0.1669111061158492, 0.1983744062850014, 0.1984045915137206,
+    -0.1997745281725133, -0.1997778652217505,
+    0.03286867107687323, 0.03285394048091991, 0.2299684023559067, 0,
+    -0.3000195782543059, -0.3000247311714679, 0.1699550263810649,
+    0.1699792791744315, 0.0004975221025548306, 0.0004882331024123466,
+    0.0002934064222758339, 0.00026697230719984,
+    0.1803738466761217, -0.1803644398535286, 4.901194272641442e-06, 0,
+    -0.2259032072208039, 0.2258924401534492, 0.1478019735119846,
+    -0.1478253113965935, 0.0287005782914919, -0.02864746382556834,
+    0.005794832004296093, -0.005765539393417264,
+    -0.1602968241307063, 0.1603017913904698, -3.809584294841413e-05, 0,
+    -0.03240890461396283, 0.03242584120319757, 0.1402903606707493,
+    -0.1402937300950092, 0.1681877413727187, -0.1681726066397446,
+    -0.1553122825690243, 0.1552981354136451,
+    -0.03264944248383183, 0.03263286840422967, 2.519174728385681e-05, 0,
+    -0.08663202253145261, 0.08667072015534827, -0.03561483466761262,
+    0.03558760035054801, 0.08848492467693068, -0.08849849650331368,
+    0.0929746815138619, -0.09295066245855352,
+    -0.009851096600084621, -0.009889878569008151, -0.08334066939944569, 0,
+    -0.04357173267213496, -0.04358559359096802, -0.005959420948957885,
+    -0.005923094277449202, -0.0315743684547979, -0.03157064361088113,
+    -0.03293243242043091, -0.03294041972016604,
+    -0.02955885454086704, -0.02953283159914571, -0.05977732382922631, 0,
+    0.002959472718479385, 0.002925312520993523, 0.08257651838355994,
+    0.08258102021280581, 0.08814232553684422, 0.08818234628383913,
+    -0.08948696636011828, -0.08950545042055379,
+    -0.02268508593868297, -0.02272000227819941, -0.06580551772337667, 0,
+    0.127379896690803, 0.1273855828633583, -0.0531391097318182,
+    -0.05312569467497778, 0.0002626219089980898, 0.0002732943969604176,
+    0.001313211848761301, 0.00130533051436001,
+    -0.1057910554142186, -0.1058198488250505, 0.2351364114299659, 0,
+    -0.04382412650151869, -0.04379117733844167, -0.002827058366164484,
+    -0.002861983002341034, -0.0276523063048034, -0.02768359040026585,
+    0.0280059026592319, 0.02802001650299616,
+    0.05737264770650954, -0.05732273867105581, 1.163413303872186e-05, 0,
+    -0.02407947916010715, 0.02406225970624835, 0.0006352309963243791,
+    -0.0005937190995778403, 0.000784145063256938, -0.0007064902006429267,
+    0.02531003939632422, -0.02535751695821323,
+    -0.1124046840400208, 0.1124441557761914, -4.0177147284582e-05, 0,
+    0.07935004750561055, -0.07936996992790579, -0.05806403721807002,
+    0.05805074508431243, 0.02564473091649785, -0.02561857130158901,
+    0.00491828833891995, -0.004917330921690097,
+    -0.01185160350997692, 0.01183900196463183, 4.152769030379654e-05, 0,
+    -0.0007247565913248916, 0.0007680497605419195, 0.01258895073769764,
+    -0.01257809704516804, 0.0753308963630161, -0.07534522031973065,
+    -0.08175553042066099, 0.08174245242667989,
+    0.032908892440451, -0.03287203808983136, -1.654062445320034e-05, 0,
+    -0.01217716624955689, 0.01218078784622328, 0.02586900270706318,
+    -0.02586146843594124, -0.05497957869263911, 0.05496008134169412,
+    -0.04641303156327346, 0.04643155975632619,
+    0.06577792909385798, 0.06581872653909202, 0.06437826023091293, 0,
+    0.07506656282732491, 0.07509963138659463, 0.07901317058697667,
+    0.0789813565774849, -0.05861260117827075, -0.05862518036288985,
+    -0.06054430651410828, -0.06054241785908658,
+    0.03560088821934984, 0.03559098182377185, -0.03982222593116565, 0,
+    0.0001288473164764401, 0.0001950134685129089, -0.005999623734929281,
+    -0.006038045957869621, -0.05526911477605344, -0.05528488696292017,
+    0.05670508192781333, 0.05667763137850784,
+    -0.006778527791865122, -0.00677067452725817, -0.03116850031212522, 0,
+    0.01736432879481119, 0.01735949123142044, -0.01281916488467032,
+    -0.01283658358761857, -0.0004303142046064808, -0.0004137353166112321,
+    0.001432780146188299, 0.001456076518596433,
+    0.05385677498137089, 0.05381627084103366, -0.07915281073263837, 0,
+    0.02538932087372903, 0.02542742733904866, -0.04900199080128059,
+    -0.04904118326101857, -0.02501750875933987, -0.02504374660714441,
+    0.02472012188908278, 0.02470613634426778,
+    -0.1455160731589958, -0.1455324924770875, 0.2038075539594567, 0,
+    0.1199779504009638, 0.1199630121017072, -0.04109790984756345,
+    -0.04109704100014992, 0.005538562796747306, 0.005533280181741028,
+    0.006019209685390341, 0.006017921582705248,
+};
+
+constexpr double kGainsA4To3_1_2Ch[] = {
+    0.4558498591041816, 0.4558533317968699, 0.09837170863293987, 0,
+    0.110739958993637, 0.1107277510496565,
+    0.5076812433832559, -0.5076720042276867, 1.125259879942959e-05, 0,
+    0.09484072554333738, -0.09483191904232836,
+    -0.1716341771157468, -0.1716347886611724, -0.1279453844208592, 0,
+    0.2157564835051861, 0.2157577895842205,
+    -0.0860013849881173, -0.08598988553538417, 0.1846977215943009, 0,
+    0.1399193360687857, 0.1398899305202508,
+    0.2091417913673167, -0.2091471911378342, 3.108510337961687e-05, 0,
+    0.1206741720492304, -0.1206490003532838,
+    -0.122908081391997, 0.1229304640963161, -9.055989794782506e-06, 0,
+    0.1370417582968757, -0.1370471724651177,
+    0.05976600945834812, 0.05975441298442526, 0.03464867598591916, 0,
+    0.1230440229207417, 0.1230795468906973,
+    -0.1459250371538154, -0.1459280589362268, -0.1149499795699002, 0,
+    0.2117027399946606, 0.2117064782116432,
+    -0.09457348991234169, -0.09455434389917955, 0.2057304319407462, 0,
+    0.03602117463036362, 0.03598787574212899,
+    0.009539186734380978, -0.009553266808361272, 3.91008588427309e-05, 0,
+    0.06724259260704396, -0.06720546172656568,
+    -0.1462083806001271, 0.1461985782990767, -2.853235533427135e-05, 0,
+    0.1716763639158158, -0.1716712827266944,
+    -0.0215111137054984, 0.02149966618836559, 4.141367759521952e-06, 0,
+    0.06426967502141225, -0.06429218097899439,
+    -0.01741245208136232, -0.01742868227466699, -0.06519038465352181, 0,
+    -0.01119380287881469, -0.01118488114409955,
+    -0.03428084551974217, -0.03429069704081739, -0.01774717718242519, 0,
+    0.1225080957594634, 0.1225522779793495,
+    0.005920217308655475, 0.005920594625280991, -0.08288739304848533, 0,
+    0.04323087493871688, 0.04323568956739216,
+    -0.1724706248422497, -0.1724352817619282, 0.2196930144595422, 0,
+    -0.005829273862039476, -0.005879002618343052,
+    0.01119056114756904, -0.01118838755773465, 3.659741391940125e-05, 0,
+    0.02993874181069809, -0.02988874161702849,
+    -0.07434502506871775, 0.07432146897098568, -2.565492320869307e-05, 0,
+    0.08941864012551172, -0.08941340311575782,
+    -0.04970647726743763, 0.04973584993448934, 2.560259841274747e-05, 0,
+    0.1018459070595283, -0.1018616268525024,
+    0.004479661978943183, -0.004500645550727038, -1.224583094881937e-05, 0,
+    -0.0354355013392288, 0.03543132505175703,
+    0.1033368131343678, 0.1033662280274752, 0.08233148717346719, 0,
+    -0.02958143074967187, -0.02961213650031968,
+    -0.01581036396500888, -0.01582446188333951, -0.04031561220017205, 0,
+    -0.01396867346787669, -0.01398252961382916,
+    -0.01758423895975371, -0.01759805045229135, -0.03900216490983474, 0,
+    0.007491534145955856, 0.007537812674159464,
+    0.04278257865744881, 0.04280697024527288, -0.09329630807423786, 0,
+    -0.00942221053779083, -0.009446864569104436,
+    -0.09528297291134599, -0.09524688228047125, 0.2033576388710656, 0,
+    0.002873839167100622, 0.002838434086452182,
+};
+
+constexpr double kGainsA4To7_1_2Ch[] = {
+    0.1227392522233813, 0.1227468193219647, 0.1124741179194009, 0,
+    0.156080056143775, 0.1560813881501154, 0.1830650904759321,
+    0.1830521944342445, 0.2430397008554145, 0.2430336144390797,
+    0.1386845582712175, -0.1386928861033728, 4.903337216824281e-06, 0,
+    0.2901333895422477, -0.290142342351392, 0.1475866793598385,
+    -0.1475684946633604, 0.233209500596762, -0.2331923913504391,
+    -0.1777012442507094, -0.1777262146857431, -0.1314745664089598, 0,
+    -0.1738190883418949, -0.1738064109808844, -0.2113415189878441,
+    -0.2113370804348439, 0.4686400666872971, 0.468639193486484,
+    0.1631172929225302, 0.1631177200396817, 0.1971575985882708, 0,
+    0.02642487921515516, 0.02640405280648556, -0.2982133126059484,
+    -0.298200838468048, 0.04057768939949914, 0.04057861912127256,
+    0.2328095884669301, -0.2328147231822385, 7.34688560139142e-06, 0,
+    0.04536403018013771, -0.04533037598562688, -0.2329790869839503,
+    0.2329623867085918, 0.04819126890625734, -0.04816214080800724,
+    -0.1054372801799554, 0.1054418450096362, -2.068650289075415e-05, 0,
+    -0.1411747213157653, 0.141158437332722, -0.1045790936062076,
+    0.1045886670641451, 0.3349793384420713, -0.3349609561218349,
+    0.03645070829710129, 0.03648832073644243, 0.03070595936622075, 0,
+    -0.007437880428489298, -0.007462818836074309, -0.02219490328927572,
+    -0.02219223231805195, 0.2525654253876082, 0.2525771611006338,
+    -0.1298165445964921, -0.1298399860700899, -0.07192605454004165, 0,
+    -0.0246635854196166, -0.02465918192816696, 0.1669097186264945,
+    0.1669111061158492, 0.05711248270587421, 0.05714030828444872,
+    0.03286867107687323, 0.03285394048091991, 0.2299684023559067, 0,
+    -0.3000195782543059, -0.3000247311714679, 0.1699550263810649,
+    0.1699792791744315, 0.0007049917733897565, 0.0006770110312223716,
+    0.1803738466761217, -0.1803644398535286, 4.901194272641442e-06, 0,
+    -0.2259032072208039, 0.2258924401534492, 0.1478019735119846,
+    -0.1478253113965935, 0.0327981432975665, -0.03272431582785186,
+    -0.1602968241307063, 0.1603017913904698, -3.809584294841413e-05, 0,
+    -0.03240890461396283, 0.03242584120319757, 0.1402903606707493,
+    -0.1402937300950092, 0.05836537316660033, -0.05836024198312943,
+    -0.03264944248383183, 0.03263286840422967, 2.519174728385681e-05, 0,
+    -0.08663202253145261, 0.08667072015534827, -0.03561483466761262,
+    0.03558760035054801, 0.154227952454042, -0.1542245402435387,
+    -0.009851096600084621, -0.009889878569008151, -0.08334066939944569, 0,
+    -0.04357173267213496, -0.04358559359096802, -0.005959420948957885,
+    -0.005923094277449202, -0.05486111474025231, -0.05486303777014162,
+    -0.02955885454086704, -0.02953283159914571, -0.05977732382922631, 0,
+    0.002959472718479385, 0.002925312520993523, 0.08257651838355994,
+    0.08258102021280581, 0.02486548479579211, 0.02489243533830922,
+    -0.02268508593868297, -0.02272000227819941, -0.06580551772337667, 0,
+    0.127379896690803, 0.1273855828633583, -0.0531391097318182,
+    -0.05312569467497778, 0.001191202912391729, 0.001196302455354104,
+    -0.1057910554142186, -0.1058198488250505, 0.2351364114299659, 0,
+    -0.04382412650151869, -0.04379117733844167, -0.002827058366164484,
+    -0.002861983002341034, -0.007849142621210153, -0.007870446722038297,
+    0.05737264770650954, -0.05732273867105581, 1.163413303872186e-05, 0,
+    -0.02407947916010715, 0.02406225970624835, 0.0006352309963243791,
+    -0.0005937190995778403, 0.01868104555249647, -0.01863696239584837,
+    -0.1124046840400208, 0.1124441557761914, -4.0177147284582e-05, 0,
+    0.07935004750561055, -0.07936996992790579, -0.05806403721807002,
+    0.05805074508431243, 0.02912248595277887, -0.02909564934165438,
+    -0.01185160350997692, 0.01183900196463183, 4.152769030379654e-05, 0,
+    -0.0007247565913248916, 0.0007680497605419195, 0.01258895073769764,
+    -0.01257809704516804, 0.01752100640306364, -0.01754457789800654,
+    0.032908892440451, -0.03287203808983136, -1.654062445320034e-05, 0,
+    -0.01217716624955689, 0.01218078784622328, 0.02586900270706318,
+    -0.02586146843594124, -0.08779854804645504, 0.08779215210646077,
+    0.06577792909385798, 0.06581872653909202, 0.06437826023091293, 0,
+    0.07506656282732491, 0.07509963138659463, 0.07901317058697667,
+    0.0789813565774849, -0.1014238908766336, -0.1014351345804795,
+    0.03560088821934984, 0.03559098182377185, -0.03982222593116565, 0,
+    0.0001288473164764401, 0.0001950134685129089, -0.005999623734929281,
+    -0.006038045957869621, -0.01517256681715788, -0.01520774947358582,
+    -0.006778527791865122, -0.00677067452725817, -0.03116850031212522, 0,
+    0.01736432879481119, 0.01735949123142044, -0.01281916488467032,
+    -0.01283658358761857, 0.0005828143527127185, 0.0006158662636148061,
+    0.05385677498137089, 0.05381627084103366, -0.07915281073263837, 0,
+    0.02538932087372903, 0.02542742733904866, -0.04900199080128059,
+    -0.04904118326101857, -0.007537742939811427, -0.007573870061193238,
+    -0.1455160731589958, -0.1455324924770875, 0.2038075539594567, 0,
+    0.1199779504009638, 0.1199630121017072, -0.04109790984756345,
+    -0.04109704100014992, 0.009794786782670562, 0.009788593341520789,
+};
+
+constexpr double kGainsA4To9_1_6Ch[] = {
+    0.03823210282048346, 0.03823477819232632, 0.1163803973130551, 0,
+    0.2327108434567355, 0.2327092535784413, 0.1669360035801264,
+    0.1669288767358188, 0.124509620027289, 0.1245128034893679,
+    0.1150102389286838, 0.1149966666978867, 0.1594743007530997,
+    0.1594641862375878, 0.05701791680037214, 0.05701893148746988,
+    0.09665077154906419, -0.09665365469767941, 7.046668170436175e-06, 0,
+    0.1722539425133282, -0.172272128752237, 0.1280255057191407,
+    -0.1279961496947212, 0.2124797465660029, -0.2124965928513465,
+    0.0811188402153363, -0.08109837762434007, 0.08919515666724875,
+    -0.0891624384328371, 0.1285011095351327, -0.1285016001498655,
+    0.0002989057264425856, 0.0002880048949267783, -0.1839350729332913, 0,
+    -0.2978069932330883, -0.2977937619198064, -0.1135046394623845,
+    -0.1135055852859673, -0.1780224965310851, -0.1780134729131291,
+    0.2485908833247801, 0.2485669169211837, 0.3174866270059922,
+    0.3174611218107862, 0.09227195120137768, 0.09227156836169463,
+    0.05062370554832916, 0.05063413390693076, 0.1919731887252196, 0,
+    -0.3445277004015249, -0.3445317280575539, 0.2679348320746471,
+    0.2679020889874066, -0.01356110302122599, -0.01355974459573535,
+    0.08111772102141412, 0.08109289292927513, -0.1783807447272691,
+    -0.1783754328207466, -6.644146115996523e-05, -7.059039708591902e-05,
+    0.1179731149925308, -0.1179891515283385, 2.491350162815539e-05, 0,
+    -0.2693661639927498, 0.2693811074188054, 0.2331180073577782,
+    -0.2330465600967624, -0.03362570847894904, 0.03361202870654473,
+    0.1187267608530725, -0.118706796690242, -0.1272590766803055,
+    0.1272455978269993, 0.0002841251778859902, -0.0002729725670637376,
+    0.000821751547042673, -0.0008008289711345396, 6.309984993228974e-06, 0,
+    -0.1036656419371181, 0.1036707689024635, -0.1127761263091061,
+    0.1127939148059046, -0.1558584055517047, 0.1558519784334124,
+    0.1214805398944064, -0.1214351273087147, 0.1279978290350799,
+    -0.1279256153746262, 0.1823817836422306, -0.1823705806512157,
+    -0.08026507128158301, -0.08027799624319994, 0.05807516436585497, 0,
+    0.0282569946449982, 0.02824220297545093, 0.0421726730341742,
+    0.0422444870637162, 0.04116964363079337, 0.0411495853370632,
+    0.2006102565679247, 0.2005972916728247, 0.1959656015095006,
+    0.1959358085567337, 0.003839300589938719, 0.003839563184483447,
+    0.0001470433880190757, 0.0001313619385131432, -0.1715625836055388, 0,
+    0.2073062848726773, 0.2072934793151604, 0.01714259932996209,
+    0.01717424430038088, -0.002695697162410267, -0.002686740006926368,
+    0.1214717982150486, 0.1214575740903165, -0.2559507504255912,
+    -0.2559513606849963, -0.0001641791670267622, -0.0001623702386424741,
+    -0.08142577933998399, -0.08141086111376636, 0.221605553212241, 0,
+    0.1904804671843742, 0.1904890389816814, 0.1792377353711918,
+    0.1792094285861832, -0.2382498174644657, -0.2382609353079846,
+    1.682046455952148e-05, -2.647024480113412e-05, 0.09000338486766982,
+    0.08999582579446844, -0.1312353814556686, -0.1312413393035063,
+    -0.01881607904198624, 0.01878052782814953, 5.303642669857597e-05, 0,
+    0.1660831759669725, -0.1660972633448802, 0.2311589110649971,
+    -0.2310575358363691, -0.2175129743473301, 0.2175274279260965,
+    0.07353544142332347, -0.07348670958201213, 0.07267427847577515,
+    -0.0726482573595981, -0.1083956127051377, 0.1083975480926701,
+    0.0004342977194900121, -0.0004005248235218846, 1.178949321084216e-05, 0,
+    0.1461525844542428, -0.1461126980031401, -0.1662678768536449,
+    0.1662686512304495, -0.007512777893718041, 0.00750656671958732,
+    0.1764466529793999, -0.176437292457641, -0.1838190663210042,
+    0.1838035543485639, -9.036220636732641e-05, 8.624243752522699e-05,
+    -0.1017492165518994, 0.1017651498180887, -9.95720965761825e-06, 0,
+    -0.05143630992961247, 0.05141482313977246, -0.0007596852723535386,
+    0.0007288549948166051, -0.04030650382154461, 0.04033040740674802,
+    0.06504437116975119, -0.06498853357449882, 0.05868572940966601,
+    -0.05859867743974995, 0.08045957729337808, -0.0804274796412843,
+    -0.0009505121052813532, -0.0009326043364807122, -9.902982443727742e-05, 0,
+    -0.04694807433669368, -0.04694035911820378, -0.0745477375717977,
+    -0.07463815719933609, -0.01737409962558105, -0.0173830243310865,
+    0.06820434656977195, 0.06819684338255642, -0.001638654953654214,
+    -0.001663908562359234, -0.08423061401334682, -0.08420468231202415,
+    -0.05484962413511664, -0.05487632312584955, -0.01908183177978033, 0,
+    0.1028572634431357, 0.1028677189589403, 0.005887531415403026,
+    0.005964574556828021, 0.01460351181426018, 0.01458576582332607,
+    0.06503173962720706, 0.0650568947764369, -0.1172880803048938,
+    -0.1172982387153678, -6.534471583667823e-05, -5.708704037655006e-05,
+    -0.001176632968683588, -0.001167834788531562, -0.1791585040536628, 0,
+    -0.1032971762450944, -0.1032959662793981, 0.1338030514876711,
+    0.1338200502656083, 0.1579179542676681, 0.1579066443281886,
+    1.561601837797947e-05, 2.54108395259228e-06, 0.1299878739513332,
+    0.1300148477916393, -0.1865230415310783, -0.1865341993921229,
+    -0.1579982269412787, -0.1579971086948339, 0.2173092949314515, 0,
+    -1.82400357360557e-05, -1.831112717373684e-05, 0.03034750456716664,
+    0.03033576180421406, 0.05046594413816482, 0.05044286249964257,
+    -0.07350948689465471, -0.07355707783229767, -3.055693595703513e-05,
+    -9.609827349404965e-06, -0.001645073360299591, -0.001626433373856112,
+    -0.1471999653599927, 0.1471655073779819, 7.245110242393435e-05, 0,
+    -4.872787321737535e-07, 1.64282743544027e-05, 0.1495701084543039,
+    -0.1494650239891187, 0.0567815575884362, -0.05674420751709491,
+    3.316976525644671e-05, 6.678622388699378e-05, -3.275555252096712e-05,
+    -3.391519254385752e-05, -0.004170522654583586, 0.004145825859231106,
+    -0.001435260168408518, 0.001451474920995584, 5.359004002076352e-06, 0,
+    -0.08349146369212927, 0.08343556271498946, -0.1029598056086893,
+    0.1029369722688095, 0.1296689371482818, -0.1296862897051884,
+    0.1077130532018314, -0.1077220905286006, 0.1069888899169959,
+    -0.1070180663629435, -0.1556882638653323, 0.1557164512710874,
+    -0.09115015398808984, 0.09119478511939931, -2.797241548072142e-05, 0,
+    0.0241056751537417, -0.02410471312061534, 0.01193684313043793,
+    -0.01196640562409709, 0.02589655962907238, -0.02588834066412029,
+    0.1182616054431289, -0.1182773669579348, -0.114408999712629,
+    0.1143809784362199, -0.000511820040742381, 0.0004935764626349579,
+    -0.001769455222205528, 0.001760133014516096, -1.732378359529176e-05, 0,
+    0.0122884263919122, -0.01223672996163162, 0.02952399328146089,
+    -0.02944247589166446, 0.03415893988974503, -0.03414091285531259,
+    -0.02164320354235845, 0.02168170436926944, -0.0334836973529788,
+    0.03353978736534322, -0.05019174075763851, 0.05021590493738465,
+    0.0693101448671703, 0.06934109953957814, 0.03486975122187521, 0,
+    0.118999115516358, 0.1189734052398081, -0.004033067845813275,
+    -0.004051371311841426, 0.04904726014318935, 0.04904999545097039,
+    -0.0151083770887436, -0.01512349005221743, -0.05938160943508703,
+    -0.05940355851515556, -0.06624477856805051, -0.0661641201820527,
+    -0.0003243814881210656, -0.0003074042346021207, 0.06415031356143309, 0,
+    -0.02449137310298852, -0.02450078027921002, -0.00797024733572425,
+    -0.008045949876818548, 0.004912720806504982, 0.004940027459897476,
+    -0.02164102184097935, -0.02160962702638815, 0.06704152486104822,
+    0.06703801358234722, 0.0002729187748976852, 0.000271808972828073,
+    0.05805360648137974, 0.05803883900336139, 0.009605620266745912, 0,
+    -0.01705027566277866, -0.01704976644458926, 0.01707802432601647,
+    0.01713637531429868, 0.001874078398171003, 0.001900912910869614,
+    8.593651076481059e-07, 6.327421845519712e-05, 0.08088048736234082,
+    0.08094159850638349, -0.1116772413725262, -0.1116816892320618,
+    -0.000837557917019586, -0.0007982742801704139, -0.1534741586320595, 0,
+    -1.91999552488914e-05, -1.473890528010113e-05, 0.216128332691351,
+    0.2161187091004825, 0.01342010433849352, 0.01339413577209284,
+    -0.1077019343112887, -0.1077462040199603, -2.930308784994395e-05,
+    -2.997235791059316e-05, -0.00086267452442376, -0.0008676519223302055,
+    -0.05678567593879785, -0.05681895653799814, 0.1915319921299358, 0,
+    -0.0476969814070759, -0.04770829935442969, -0.07760620892474857,
+    -0.07759683096005307, 0.1678707648708007, 0.1678703709690277,
+    -0.08126764410532106, -0.08125745592720758, -0.01960493214038584,
+    -0.01961399964004435, 0.07361268414637329, 0.0736016214659572,
+};
+
+constexpr double kGainsA4To0_1_0[] = {
+    0.6093311202935561,
+    3.857221864800309e-06,
+    -1.91202965921409e-07,
+    0.07231566376213994,
+    4.078710384547435e-06,
+    8.18490654867068e-06,
+    0.09201825816150785,
+    7.908801103027902e-07,
+    0.1578821863804438,
+    5.320844832186478e-06,
+    3.172739941643403e-07,
+    -1.055748796135233e-05,
+    -8.201596992236202e-06,
+    0.03957727760117019,
+    -1.525436528208108e-05,
+    0.04942634170854775,
+    1.270139343188814e-05,
+    -1.783678442423883e-07,
+    1.337799011488783e-05,
+    -6.371051387596834e-06,
+    0.03074408856854242,
+    -6.366422499018521e-06,
+    0.01166706159759326,
+    -9.934390795507949e-06,
+    0.03186086157818852,
+};
+
+struct PrecomputedGainsEntry {
+  PrecomputedGainsLayout input_layout;
+  PrecomputedGainsLayout output_layout;
+  absl::Span<const double> gains;
+};
+
+constexpr PrecomputedGainsEntry kPrecomputedGains[] = {
+    {k0_1_0, k0_2_0, kGains0_1_0To0_2_0},
+    {k0_1_0, k0_5_0, kGains0_1_0To0_5_0},
+    {k0_1_0, k2_5_0, kGains0_1_0To2_5_0},
+    {k0_1_0, k4_5_0, kGains0_1_0To4_5_0},
+    {k0_1_0, k4_5_1, kGains0_1_0To4_5_1},
+    {k0_1_0, k3_7_0, kGains0_1_0To3_7_0},
+    {k0_1_0, k4_9_0, kGains0_1_0To4_9_0},
+    {k0_1_0, k9_10_3, kGains0_1_0To9_10_3},
+    {k0_1_0, k0_7_0, kGains0_1_0To0_7_0},
+    {k0_1_0, k4_7_0, kGains0_1_0To4_7_0},
+    {k0_1_0, k3_1_2Ch, kGains0_1_0To3_1_2Ch},
+    {k0_1_0, k7_1_2Ch, kGains0_1_0To7_1_2Ch},
+    {k0_1_0, k9_1_6Ch, kGains0_1_0To9_1_6Ch},
+    {k0_2_0, k0_5_0, kGains0_2_0To0_5_0},
+    {k0_2_0, k2_5_0, kGains0_2_0To2_5_0},
+    {k0_2_0, k4_5_0, kGains0_2_0To4_5_0},
+    {k0_2_0, k4_5_1, kGains0_2_0To4_5_1},
+    {k0_2_0, k3_7_0, kGains0_2_0To3_7_0},
+    {k0_2_0, k4_9_0, kGains0_2_0To4_9_0},
+    {k0_2_0, k9_10_3, kGains0_2_0To9_10_3},
+    {k0_2_0, k0_7_0, kGains0_2_0To0_7_0},
+    {k0_2_0, k4_7_0, kGains0_2_0To4_7_0},
+    {k0_2_0, k3_1_2Ch, kGains0_2_0To3_1_2Ch},
+    {k0_2_0, k7_1_2Ch, kGains0_2_0To7_1_2Ch},
+    {k0_2_0, k9_1_6Ch, kGains0_2_0To9_1_6Ch},
+    {k0_2_0, k0_1_0, kGains0_2_0To0_1_0},
+    {k0_5_0, k0_2_0, kGains0_5_0To0_2_0},
+    {k0_5_0, k2_5_0, kGains0_5_0To2_5_0},
+    {k0_5_0, k4_5_0, kGains0_5_0To4_5_0},
+    {k0_5_0, k4_5_1, kGains0_5_0To4_5_1},
+    {k0_5_0, k3_7_0, kGains0_5_0To3_7_0},
+    {k0_5_0, k4_9_0, kGains0_5_0To4_9_0},
+    {k0_5_0, k9_10_3, kGains0_5_0To9_10_3},
+    {k0_5_0, k0_7_0, kGains0_5_0To0_7_0},
+    {k0_5_0, k4_7_0, kGains0_5_0To4_7_0},
+    {k0_5_0, k3_1_2Ch, kGains0_5_0To3_1_2Ch},
+    {k0_5_0, k7_1_2Ch, kGains0_5_0To7_1_2Ch},
+    {k0_5_0, k9_1_6Ch, kGains0_5_0To9_1_6Ch},
+    {k0_5_0, k0_1_0, kGains0_5_0To0_1_0},
+    {k2_5_0, k0_2_0, kGains2_5_0To0_2_0},
+    {k2_5_0, k0_5_0, kGains2_5_0To0_5_0},
+    {k2_5_0, k4_5_0, kGains2_5_0To4_5_0},
+    {k2_5_0, k4_5_1, kGains2_5_0To4_5_1},
+    {k2_5_0, k3_7_0, kGains2_5_0To3_7_0},
+    {k2_5_0, k4_9_0, kGains2_5_0To4_9_0},
+    {k2_5_0, k9_10_3, kGains2_5_0To9_10_3},
+    {k2_5_0, k0_7_0, kGains2_5_0To0_7_0},
+    {k2_5_0, k4_7_0, kGains2_5_0To4_7_0},
+    {k2_5_0, k3_1_2Ch, kGains2_5_0To3_1_2Ch},
+    {k2_5_0, k7_1_2Ch, kGains2_5_0To7_1_2Ch},
+    {k2_5_0, k9_1_6Ch, kGains2_5_0To9_1_6Ch},
+    {k2_5_0, k0_1_0, kGains2_5_0To0_1_0},
+    {k4_5_0, k0_2_0, kGains4_5_0To0_2_0},
+    {k4_5_0, k0_5_0, kGains4_5_0To0_5_0},
+    {k4_5_0, k2_5_0, kGains4_5_0To2_5_0},
+    {k4_5_0, k4_5_1, kGains4_5_0To4_5_1},
+    {k4_5_0, k3_7_0, kGains4_5_0To3_7_0},
+    {k4_5_0, k4_9_0, kGains4_5_0To4_9_0},
+    {k4_5_0, k9_10_3, kGains4_5_0To9_10_3},
+    {k4_5_0, k0_7_0, kGains4_5_0To0_7_0},
+    {k4_5_0, k4_7_0, kGains4_5_0To4_7_0},
+    {k4_5_0, k3_1_2Ch, kGains4_5_0To3_1_2Ch},
+    {k4_5_0, k7_1_2Ch, kGains4_5_0To7_1_2Ch},
+    {k4_5_0, k9_1_6Ch, kGains4_5_0To9_1_6Ch},
+    {k4_5_0, k0_1_0, kGains4_5_0To0_1_0},
+    {k0_7_0, k0_2_0, kGains0_7_0To0_2_0},
+    {k0_7_0, k0_5_0, kGains0_7_0To0_5_0},
+    {k0_7_0, k2_5_0, kGains0_7_0To2_5_0},
+    {k0_7_0, k4_5_0, kGains0_7_0To4_5_0},
+    {k0_7_0, k4_5_1, kGains0_7_0To4_5_1},
+    {k0_7_0, k3_7_0, kGains0_7_0To3_7_0},
+    {k0_7_0, k4_9_0, kGains0_7_0To4_9_0},
+    {k0_7_0, k9_10_3, kGains0_7_0To9_10_3},
+    {k0_7_0, k4_7_0, kGains0_7_0To4_7_0},
+    {k0_7_0, k3_1_2Ch, kGains0_7_0To3_1_2Ch},
+    {k0_7_0, k7_1_2Ch, kGains0_7_0To7_1_2Ch},
+    {k0_7_0, k9_1_6Ch, kGains0_7_0To9_1_6Ch},
+    {k0_7_0, k0_1_0, kGains0_7_0To0_1_0},
+    {k4_7_0, k0_2_0, kGains4_7_0To0_2_0},
+    {k4_7_0, k0_5_0, kGains4_7_0To0_5_0},
+    {k4_7_0, k2_5_0, kGains4_7_0To2_5_0},
+    {k4_7_0, k4_5_0, kGains4_7_0To4_5_0},
+    {k4_7_0, k4_5_1, kGains4_7_0To4_5_1},
+    {k4_7_0, k3_7_0, kGains4_7_0To3_7_0},
+    {k4_7_0, k4_9_0, kGains4_7_0To4_9_0},
+    {k4_7_0, k9_10_3, kGains4_7_0To9_10_3},
+    {k4_7_0, k0_7_0, kGains4_7_0To0_7_0},
+    {k4_7_0, k3_1_2Ch, kGains4_7_0To3_1_2Ch},
+    {k4_7_0, k7_1_2Ch, kGains4_7_0To7_1_2Ch},
+    {k4_7_0, k9_1_6Ch, kGains4_7_0To9_1_6Ch},
+    {k4_7_0, k0_1_0, kGains4_7_0To0_1_0},
+    {k3_1_2Ch, k0_2_0, kGains3_1_2ChTo0_2_0},
+    {k3_1_2Ch, k0_5_0, kGains3_1_2ChTo0_5_0},
+    {k3_1_2Ch, k2_5_0, kGains3_1_2ChTo2_5_0},
+    {k3_1_2Ch, k4_5_0, kGains3_1_2ChTo4_5_0},
+    {k3_1_2Ch, k4_5_1, kGains3_1_2ChTo4_5_1},
+    {k3_1_2Ch, k3_7_0, kGains3_1_2ChTo3_7_0},
+    {k3_1_2Ch, k4_9_0, kGains3_1_2ChTo4_9_0},
+    {k3_1_2Ch, k9_10_3, kGains3_1_2ChTo9_10_3},
+    {k3_1_2Ch, k0_7_0, kGains3_1_2ChTo0_7_0},
+    {k3_1_2Ch, k4_7_0, kGains3_1_2ChTo4_7_0},
+    {k3_1_2Ch, k7_1_2Ch, kGains3_1_2ChTo7_1_2Ch},
+    {k3_1_2Ch, k9_1_6Ch, kGains3_1_2ChTo9_1_6Ch},
+    {k3_1_2Ch, k0_1_0, kGains3_1_2ChTo0_1_0},
+    {k7_1_2Ch, k0_2_0, kGains7_1_2ChTo0_2_0},
+    {k7_1_2Ch, k0_5_0, kGains7_1_2ChTo0_5_0},
+    {k7_1_2Ch, k2_5_0, kGains7_1_2ChTo2_5_0},
+    {k7_1_2Ch, k4_5_0, kGains7_1_2ChTo4_5_0},
+    {k7_1_2Ch, k4_5_1, kGains7_1_2ChTo4_5_1},
+    {k7_1_2Ch, k3_7_0, kGains7_1_2ChTo3_7_0},
+    {k7_1_2Ch, k4_9_0, kGains7_1_2ChTo4_9_0},
+    {k7_1_2Ch, k9_10_3, kGains7_1_2ChTo9_10_3},
+    {k7_1_2Ch, k0_7_0, kGains7_1_2ChTo0_7_0},
+    {k7_1_2Ch, k4_7_0, kGains7_1_2ChTo4_7_0},
+    {k7_1_2Ch, k3_1_2Ch, kGains7_1_2ChTo3_1_2Ch},
+    {k7_1_2Ch, k9_1_6Ch, kGains7_1_2ChTo9_1_6Ch},
+    {k7_1_2Ch, k0_1_0, kGains7_1_2ChTo0_1_0},
+    {k9_1_6Ch, k0_2_0, kGains9_1_6ChTo0_2_0},
+    {k9_1_6Ch, k0_5_0, kGains9_1_6ChTo0_5_0},
+    {k9_1_6Ch, k2_5_0, kGains9_1_6ChTo2_5_0},
+    {k9_1_6Ch, k4_5_0, kGains9_1_6ChTo4_5_0},
+    {k9_1_6Ch, k4_5_1, kGains9_1_6ChTo4_5_1},
+    {k9_1_6Ch, k3_7_0, kGains9_1_6ChTo3_7_0},
+    {k9_1_6Ch, k4_9_0, kGains9_1_6ChTo4_9_0},
+    {k9_1_6Ch, k9_10_3, kGains9_1_6ChTo9_10_3},
+    {k9_1_6Ch, k0_7_0, kGains9_1_6ChTo0_7_0},
+    {k9_1_6Ch, k4_7_0, kGains9_1_6ChTo4_7_0},
+    {k9_1_6Ch, k3_1_2Ch, kGains9_1_6ChTo3_1_2Ch},
+    {k9_1_6Ch, k7_1_2Ch, kGains9_1_6ChTo7_1_2Ch},
+    {k9_1_6Ch, k0_1_0, kGains9_1_6ChTo0_1_0},
+    {kA0, k0_2_0, kGainsA0To0_2_0},
+    {kA0, k0_5_0, kGainsA0To0_5_0},
+    {kA0, k2_5_0, kGainsA0To2_5_0},
+    {kA0, k4_5_0, kGainsA0To4_5_0},
+    {kA0, k4_5_1, kGainsA0To4_5_1},
+    {kA0, k3_7_0, kGainsA0To3_7_0},
+    {kA0, k4_9_0, kGainsA0To4_9_0},
+    {kA0, k9_10_3, kGainsA0To9_10_3},
+    {kA0, k0_7_0, kGainsA0To0_7_0},
+    {kA0, k4_7_0, kGainsA0To4_7_0},
+    {kA0, k3_1_2Ch, kGainsA0To3_1_2Ch},
+    {kA0, k7_1_2Ch, kGainsA0To7_1_2Ch},
+    {kA0, k9_1_6Ch, kGainsA0To9_1_6Ch},
+    {kA0, k0_1_0, kGainsA0To0_1_0},
+    {kA1, k0_2_0, kGainsA1To0_2_0},
+    {kA1, k0_5_0, kGainsA1To0_5_0},
+    {kA1, k2_5_0, kGainsA1To2_5_0},
+    {kA1, k4_5_0, kGainsA1To4_5_0},
+    {kA1, k4_5_1, kGainsA1To4_5_1},
+    {kA1, k3_7_0, kGainsA1To3_7_0},
+    {kA1, k4_9_0, kGainsA1To4_9_0},
+    {kA1, k9_10_3, kGainsA1To9_10_3},
+    {kA1, k0_7_0, kGainsA1To0_7_0},
+    {kA1, k4_7_0, kGainsA1To4_7_0},
+    {kA1, k3_1_2Ch, kGainsA1To3_1_2Ch},
+    {kA1, k7_1_2Ch, kGainsA1To7_1_2Ch},
+    {kA1, k9_1_6Ch, kGainsA1To9_1_6Ch},
+    {kA1, k0_1_0, kGainsA1To0_1_0},
+    {kA2, k0_2_0, kGainsA2To0_2_0},
+    {kA2, k0_5_0, kGainsA2To0_5_0},
+    {kA2, k2_5_0, kGainsA2To2_5_0},
+    {kA2, k4_5_0, kGainsA2To4_5_0},
+    {kA2, k4_5_1, kGainsA2To4_5_1},
+    {kA2, k3_7_0, kGainsA2To3_7_0},
+    {kA2, k4_9_0, kGainsA2To4_9_0},
+    {kA2, k9_10_3, kGainsA2To9_10_3},
+    {kA2, k0_7_0, kGainsA2To0_7_0},
+    {kA2, k4_7_0, kGainsA2To4_7_0},
+    {kA2, k3_1_2Ch, kGainsA2To3_1_2Ch},
+    {kA2, k7_1_2Ch, kGainsA2To7_1_2Ch},
+    {kA2, k9_1_6Ch, kGainsA2To9_1_6Ch},
+    {kA2, k0_1_0, kGainsA2To0_1_0},
+    {kA3, k0_2_0, kGainsA3To0_2_0},
+    {kA3, k0_5_0, kGainsA3To0_5_0},
+    {kA3, k2_5_0, kGainsA3To2_5_0},
+    {kA3, k4_5_0, kGainsA3To4_5_0},
+    {kA3, k4_5_1, kGainsA3To4_5_1},
+    {kA3, k3_7_0, kGainsA3To3_7_0},
+    {kA3, k4_9_0, kGainsA3To4_9_0},
+    {kA3, k9_10_3, kGainsA3To9_10_3},
+    {kA3, k0_7_0, kGainsA3To0_7_0},
+    {kA3, k4_7_0, kGainsA3To4_7_0},
+    {kA3, k3_1_2Ch, kGainsA3To3_1_2Ch},
+    {kA3, k7_1_2Ch, kGainsA3To7_1_2Ch},
+    {kA3, k9_1_6Ch, kGainsA3To9_1_6Ch},
+    {kA3, k0_1_0, kGainsA3To0_1_0},
+    {kA4, k0_2_0, kGainsA4To0_2_0},
+    {kA4, k0_5_0, kGainsA4To0_5_0},
+    {kA4, k2_5_0, kGainsA4To2_5_0},
+    {kA4, k4_5_0, kGainsA4To4_5_0},
+    {kA4, k4_5_1, kGainsA4To4_5_1},
+    {kA4, k3_7_0, kGainsA4To3_7_0},
+    {kA4, k4_9_0, kGainsA4To4_9_0},
+    {kA4, k9_10_3, kGainsA4To9_10_3},
+    {kA4, k0_7_0, kGainsA4To0_7_0},
+    {kA4, k4_7_0, kGainsA4To4_7_0},
+    {kA4, k3_1_2Ch, kGainsA4To3_1_2Ch},
+    {kA4, k7_1_2Ch, kGainsA4To7_1_2Ch},
+    {kA4, k9_1_6Ch, kGainsA4To9_1_6Ch},
+    {kA4, k0_1_0, kGainsA4To0_1_0},
+};
+
+constexpr bool AllGainsHaveOneGainPerPairOfChannels() {
+  for (const auto& entry : kPrecomputedGains) {
+    if (entry.gains.size() !=
+        kLayoutInfos[Index(entry.input_layout)].num_channels *
+            kLayoutInfos[Index(entry.output_layout)].num_channels) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(AllGainsHaveOneGainPerPairOfChannels());
+
+// Index into `kPrecomputedGains` for each (input, output) pair of layouts, or
+// -1 when there are no precomputed gains for the pair.
+constexpr auto kEntryIndices = [] {
+  std::array<std::array<int16_t, kLayoutCount>, kLayoutCount> entry_indices{};
+  for (auto& row : entry_indices) {
+    row.fill(-1);
+  }
+  for (size_t i = 0; i < std::size(kPrecomputedGains); ++i) {
+    const auto& entry = kPrecomputedGains[i];
+    entry_indices[Index(entry.input_layout)][Index(entry.output_layout)] =
+        static_cast<int16_t>(i);
+  }
+  return entry_indices;
+}();
+
+}  // namespace
+
+std::optional<PrecomputedGainsLayout> LookupPrecomputedGainsLayout(
+    absl::string_view key) {
+  for (size_t i = 0; i < kLayoutCount; ++i) {
+    if (kLayoutInfos[i].key == key) {
+      return static_cast<PrecomputedGainsLayout>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<PrecomputedGainsMatrix> GetPrecomputedGains(
+    PrecomputedGainsLayout input_layout, PrecomputedGainsLayout output_layout) {
+  if (Index(input_layout) >= kLayoutCount ||
+      Index(output_layout) >= kLayoutCount) {
+    return std::nullopt;
+  }
+  const int16_t entry_index =
+      kEntryIndices[Index(input_layout)][Index(output_layout)];
+  if (entry_index < 0) {
+    return std::nullopt;
+  }
+  return PrecomputedGainsMatrix{
+      .num_input_channels = kLayoutInfos[Index(input_layout)].num_channels,
+      .num_output_channels = kLayoutInfos[Index(output_layout)].num_channels,
+      .gains = kPrecomputedGains[entry_index].gains};
 }
 
 }  // namespace iamf_tools
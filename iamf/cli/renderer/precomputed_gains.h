@@ -13,24 +13,73 @@
 #ifndef CLI_RENDERER_PRECOMPUTED_GAINS_H_
 #define CLI_RENDERER_PRECOMPUTED_GAINS_H_
 
-#include <string>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 
-#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace iamf_tools {
 
-typedef absl::flat_hash_map<
-    std::string,
-    absl::flat_hash_map<std::string, std::vector<std::vector<double>>>>
-    PrecomputedGains;
+/*!\brief Layouts which have precomputed gains to or from them.
+ *
+ * Names follow the layout keys, e.g. `k4_7_0` is "4+7+0" and `k3_1_2Ch` is
+ * "3.1.2".
+ */
+enum class PrecomputedGainsLayout : uint8_t {
+  k0_1_0,
+  k0_2_0,
+  k0_5_0,
+  k2_5_0,
+  k4_5_0,
+  k0_7_0,
+  k4_7_0,
+  k3_1_2Ch,
+  k7_1_2Ch,
+  k9_1_6Ch,
+  k3_7_0,
+  k4_5_1,
+  k4_9_0,
+  k9_10_3,
+  kA0,
+  kA1,
+  kA2,
+  kA3,
+  kA4,
+  kNumLayouts,
+};
+
+/*!\brief Precomputed gains from an input layout to an output layout. */
+struct PrecomputedGainsMatrix {
+  size_t num_input_channels;
+  size_t num_output_channels;
+
+  // Gains arranged in row-major (input channel, output channel) order.
+  absl::Span<const double> gains;
+};
 
-/*!\brief Fills precomputed gains matrices.
+/*!\brief Looks up the layout represented by a key.
+ *
+ * \param key Key representing the layout, e.g. "0+2+0" or "A1".
+ * \return Layout on success. `std::nullopt` if there are no precomputed gains
+ *         to or from the layout.
+ */
+std::optional<PrecomputedGainsLayout> LookupPrecomputedGainsLayout(
+    absl::string_view key);
+
+/*!\brief Gets the precomputed gains between two layouts.
+ *
+ * The gains are stored in static tables, so the returned span is valid for the
+ * lifetime of the program.
  *
- * \return Map from input layout name to output layout name to precomputed
- *         gains.
+ * \param input_layout Input layout.
+ * \param output_layout Output layout.
+ * \return Gains on success. `std::nullopt` if there are no precomputed gains
+ *         between the layouts.
  */
-PrecomputedGains InitPrecomputedGains();
+std::optional<PrecomputedGainsMatrix> GetPrecomputedGains(
+    PrecomputedGainsLayout input_layout, PrecomputedGainsLayout output_layout);
 
 }  // namespace iamf_tools
 
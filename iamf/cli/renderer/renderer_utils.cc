@@ -9,6 +9,7 @@
  * source code in the PATENTS file, you can obtain it at
  * www.aomedia.org/license/patent.
  */
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -23,6 +24,7 @@
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/demixing_module.h"
 #include "iamf/common/macros.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/common/obu_util.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
@@ -78,10 +80,9 @@ absl::StatusOr<size_t> GetCommonNumTrimmedTimeTicks(
 absl::Status ArrangeSamplesToRender(
     const LabeledFrame& labeled_frame,
     const std::vector<ChannelLabel::Label>& ordered_labels,
-    std::vector<std::vector<InternalSampleType>>& samples_to_render,
-    size_t& num_valid_samples) {
+    PlanarSampleBuffer<InternalSampleType>& samples_to_render) {
   if (ordered_labels.empty()) {
-    return absl::OkStatus();
+    return samples_to_render.SetNumTicks(0);
   }
 
   const auto common_num_trimmed_time_ticks =
@@ -89,20 +90,23 @@ absl::Status ArrangeSamplesToRender(
   if (!common_num_trimmed_time_ticks.ok()) {
     return common_num_trimmed_time_ticks.status();
   }
-  num_valid_samples = *common_num_trimmed_time_ticks;
 
   const auto num_channels = ordered_labels.size();
-  if (num_valid_samples > samples_to_render.size()) [[unlikely]] {
+  if (num_channels != samples_to_render.num_channels()) [[unlikely]] {
     return absl::InvalidArgumentError(absl::StrCat(
-        "Number of time samples to render= ", num_valid_samples,
-        "does not fit into the output of size ", samples_to_render.size()));
+        "Number of channels to render= ", num_channels,
+        " does not match the output with ", samples_to_render.num_channels(),
+        " channels"));
   }
+  RETURN_IF_NOT_OK(
+      samples_to_render.SetNumTicks(*common_num_trimmed_time_ticks));
 
   for (int channel = 0; channel < num_channels; ++channel) {
     const auto& channel_label = ordered_labels[channel];
     if (channel_label == ChannelLabel::kOmitted) {
-      // Missing channels for mixed-order ambisonics representation will not be
-      // updated and will thus have the initialized zeros.
+      // Missing channels for mixed-order ambisonics representation are zeroed
+      // out.
+      samples_to_render.FillChannel(channel, 0);
       continue;
     }
 
@@ -115,10 +119,11 @@ absl::Status ArrangeSamplesToRender(
 
     // Grab the entire time axes for this label, Skip over any samples that
     // should be trimmed.
-    for (int time = 0; time < num_valid_samples; ++time) {
-      samples_to_render[time][channel] =
-          (*channel_samples)[time + labeled_frame.samples_to_trim_at_start];
-    }
+    const auto first_valid_sample =
+        channel_samples->begin() + labeled_frame.samples_to_trim_at_start;
+    const auto output_channel = samples_to_render.Channel(channel);
+    std::copy(first_valid_sample, first_valid_sample + output_channel.size(),
+              output_channel.begin());
   }
 
   return absl::OkStatus();
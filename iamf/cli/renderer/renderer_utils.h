@@ -19,6 +19,7 @@
 #include "absl/status/statusor.h"
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/demixing_module.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
 
@@ -26,7 +27,7 @@ namespace iamf_tools {
 
 namespace renderer_utils {
 
-/*!\brief Arranges the samples to be rendered in (time, channel) axes.
+/*!\brief Arranges the samples to be rendered in (channel, time) axes.
  *
  * \param labeled_frame Labeled frame determine which original or demixed
  *        samples to trim and render.
@@ -34,15 +35,16 @@ namespace renderer_utils {
  *        based on the original or demixed label samples in each time tick.
  *        Slots corresponding with `ChannelLabel::Label::kOmitted` will create
  *        zeroed-out samples.
- * \param samples_to_render Output samples to render in (time, channel) axes.
- *        Samples which should be trimmed are omitted from the output.
+ * \param samples_to_render Output samples to render. Must have one channel per
+ *        label in `ordered_labels`. Samples which should be trimmed are
+ *        omitted from the output; the number of valid ticks is updated to the
+ *        number of samples to render.
  * \return `absl::OkStatus()` on success. A specific status on failure.
  */
 absl::Status ArrangeSamplesToRender(
     const LabeledFrame& labeled_frame,
     const std::vector<ChannelLabel::Label>& ordered_labels,
-    std::vector<std::vector<InternalSampleType>>& samples_to_render,
-    size_t& num_valid_samples);
+    PlanarSampleBuffer<InternalSampleType>& samples_to_render);
 
 /*!\brief Gets a key associated with the playback layout.
  *
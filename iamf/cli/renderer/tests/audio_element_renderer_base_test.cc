@@ -17,9 +17,9 @@
 
 #include "absl/status/status.h"
 #include "absl/status/status_matchers.h"
-#include "absl/types/span.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/types.h"
 
 namespace iamf_tools {
@@ -38,7 +38,7 @@ class MockAudioElementRenderer : public AudioElementRendererBase {
   MockAudioElementRenderer() : AudioElementRendererBase({}, 0, 0) {};
 
   absl::Status RenderSamples(
-      absl::Span<const std::vector<InternalSampleType>>,
+      const PlanarSampleBuffer<InternalSampleType>&,
       std::vector<InternalSampleType>& rendered_samples) override {
     rendered_samples.insert(rendered_samples.end(), kSamplesToRender.begin(),
                             kSamplesToRender.end());
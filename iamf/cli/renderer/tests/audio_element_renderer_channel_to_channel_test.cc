@@ -22,6 +22,7 @@
 #include "iamf/cli/demixing_module.h"
 #include "iamf/cli/tests/cli_test_utils.h"
 #include "iamf/obu/audio_element.h"
+#include "iamf/obu/demixing_info_parameter_data.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
 
@@ -43,6 +44,7 @@ constexpr InternalSampleType kArbitrarySample5 = 987654321.0;
 constexpr InternalSampleType kArbitrarySample6 = 1024.0;
 
 constexpr int kStereoL2ChannelIndex = 0;
+constexpr int k3_1_2L3ChannelIndex = 0;
 constexpr int kStereoR2ChannelIndex = 1;
 constexpr int k3_1_2LFEChannelIndex = 3;
 constexpr int k5_1LFEChannelIndex = 3;
@@ -353,6 +355,51 @@ TEST(RenderLabeledFrame,
                    rendered_samples[kStereoR2ChannelIndex]);
 }
 
+LabeledFrame Get7_1_4FrameWithOnlyLss7(
+    InternalSampleType lss7_sample, const DownMixingParams& demixing_params) {
+  LabeledFrame labeled_frame = {.demixing_params = demixing_params};
+  for (const auto label : {kL7, kR7, kCentre, kLFE, kLss7, kRss7, kLrs7, kRrs7,
+                           kLtf4, kRtf4, kLtb4, kRtb4}) {
+    labeled_frame.label_to_samples[label] = {label == kLss7 ? lss7_sample
+                                                            : 0.0};
+  }
+  return labeled_frame;
+}
+
+TEST(RenderLabeledFrame, UsesDownMixingParamsOfEachFrame) {
+  auto renderer = AudioElementRendererChannelToChannel::
+      CreateFromScalableChannelLayoutConfig(k7_1_4ScalableChannelLayoutConfig,
+                                            k3_1_2Layout, kOneSamplePerFrame);
+  ASSERT_NE(renderer, nullptr);
+  const DownMixingParams kFirstParams = {.alpha = 1,
+                                         .beta = 0.866,
+                                         .gamma = 0.866,
+                                         .delta = 0.866,
+                                         .w = 0.25,
+                                         .in_bitstream = true};
+  const DownMixingParams kSecondParams = {.alpha = 0.5,
+                                          .beta = 0.5,
+                                          .gamma = 0.5,
+                                          .delta = 0.5,
+                                          .w = 0.5,
+                                          .in_bitstream = true};
+
+  // Switch back to the first parameters, to make sure gains are not mixed up
+  // when they are reused.
+  for (const auto& params : {kFirstParams, kSecondParams, kFirstParams}) {
+    EXPECT_THAT(renderer->RenderLabeledFrame(
+                    Get7_1_4FrameWithOnlyLss7(kArbitrarySample1, params)),
+                IsOk());
+    std::vector<InternalSampleType> rendered_samples;
+    EXPECT_THAT(renderer->Flush(rendered_samples), IsOk());
+
+    ASSERT_EQ(rendered_samples.size(), 6);
+    // Lss7 is mixed into L3 with a gain of `alpha * delta`.
+    EXPECT_DOUBLE_EQ(rendered_samples[k3_1_2L3ChannelIndex],
+                     kArbitrarySample1 * params.alpha * params.delta);
+  }
+}
+
 TEST(RenderLabeledFrame, PassThroughLFE) {
   auto renderer = AudioElementRendererChannelToChannel::
       CreateFromScalableChannelLayoutConfig(
@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "iamf/obu/demixing_info_parameter_data.h"
 
 namespace iamf_tools {
 namespace {
@@ -33,6 +34,20 @@ constexpr size_t kExpectedStereoColumns = 2;
 constexpr absl::string_view kUnknownInputKey = "UNKNOWN";
 constexpr absl::string_view kUnknownOutputKey = "UNKNOWN";
 
+constexpr absl::string_view k7_1_4InputKey = "4+7+0";
+constexpr absl::string_view k3_1_2OutputKey = "3.1.2";
+constexpr size_t kExpected7_1_4MatrixRows = 12;
+constexpr size_t kExpected3_1_2Columns = 6;
+
+const DownMixingParams kDownMixingParamsInBitstream = {.alpha = 1,
+                                                       .beta = 0.866,
+                                                       .gamma = 0.866,
+                                                       .delta = 0.866,
+                                                       .w_idx_offset = 0,
+                                                       .w_idx_used = 0,
+                                                       .w = 0.25,
+                                                       .in_bitstream = true};
+
 TEST(LookupPrecomputedGains, SucceedsForKnownPrecomputedGains) {
   EXPECT_THAT(LookupPrecomputedGains(kFOAInputKey, kStereoOutputKey), IsOk());
 }
@@ -41,15 +56,22 @@ TEST(LookupPrecomputedGains, FirstDimensionAgreesWithInputKey) {
   const auto gains = LookupPrecomputedGains(kFOAInputKey, kStereoOutputKey);
   ASSERT_THAT(gains, IsOk());
 
-  EXPECT_EQ(gains->size(), kExpectedFOAMatrixRows);
+  EXPECT_EQ(gains->num_input_channels, kExpectedFOAMatrixRows);
 }
 
 TEST(LookupPrecomputedGains, SecondDimensionAgreesWithOutputKey) {
   const auto gains = LookupPrecomputedGains(kFOAInputKey, kStereoOutputKey);
   ASSERT_THAT(gains, IsOk());
-  ASSERT_FALSE(gains->empty());
 
-  EXPECT_EQ(gains->at(0).size(), kExpectedStereoColumns);
+  EXPECT_EQ(gains->num_output_channels, kExpectedStereoColumns);
+}
+
+TEST(LookupPrecomputedGains, HasOneGainPerPairOfChannels) {
+  const auto gains = LookupPrecomputedGains(kFOAInputKey, kStereoOutputKey);
+  ASSERT_THAT(gains, IsOk());
+
+  EXPECT_EQ(gains->gains.size(),
+            kExpectedFOAMatrixRows * kExpectedStereoColumns);
 }
 
 TEST(LookupPrecomputedGains, ReturnsErrorWhenInputKeyIsUnknown) {
@@ -60,5 +82,45 @@ TEST(LookupPrecomputedGains, ReturnsErrorWhenOutputKeyIsUnknown) {
   EXPECT_FALSE(LookupPrecomputedGains(kFOAInputKey, kUnknownOutputKey).ok());
 }
 
+TEST(ComputeChannelLayoutToLoudspeakersGains,
+     ReturnsNulloptWhenDownMixingParamsAreNotInBitstream) {
+  DownMixingParams down_mixing_params = kDownMixingParamsInBitstream;
+  down_mixing_params.in_bitstream = false;
+
+  const auto gains = ComputeChannelLayoutToLoudspeakersGains(
+      down_mixing_params, {}, k7_1_4InputKey, k3_1_2OutputKey);
+  ASSERT_THAT(gains, IsOk());
+
+  EXPECT_FALSE(gains->has_value());
+}
+
+TEST(ComputeChannelLayoutToLoudspeakersGains,
+     ReturnsNulloptWhenOnlyInputHasHeightChannels) {
+  const auto gains = ComputeChannelLayoutToLoudspeakersGains(
+      kDownMixingParamsInBitstream, {}, k7_1_4InputKey, kStereoOutputKey);
+  ASSERT_THAT(gains, IsOk());
+
+  EXPECT_FALSE(gains->has_value());
+}
+
+TEST(ComputeChannelLayoutToLoudspeakersGains,
+     ComputesGainsFromDownMixingParams) {
+  const auto gains = ComputeChannelLayoutToLoudspeakersGains(
+      kDownMixingParamsInBitstream, {}, k7_1_4InputKey, k3_1_2OutputKey);
+  ASSERT_THAT(gains, IsOk());
+  ASSERT_TRUE(gains->has_value());
+
+  EXPECT_EQ((*gains)->num_input_channels(), kExpected7_1_4MatrixRows);
+  EXPECT_EQ((*gains)->num_output_channels(), kExpected3_1_2Columns);
+}
+
+TEST(ComputeChannelLayoutToLoudspeakersGains,
+     ReturnsErrorWhenLayoutIsUnknown) {
+  EXPECT_FALSE(ComputeChannelLayoutToLoudspeakersGains(
+                   kDownMixingParamsInBitstream, {}, kUnknownInputKey,
+                   k3_1_2OutputKey)
+                   .ok());
+}
+
 }  // namespace
 }  // namespace iamf_tools
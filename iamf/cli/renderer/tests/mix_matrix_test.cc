@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/renderer/mix_matrix.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "absl/status/status_matchers.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/common/planar_sample_buffer.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::testing::ElementsAre;
+using ::testing::Not;
+
+// Mixes samples the straightforward way, summing the input channels of each
+// output sample in ascending order.
+std::vector<InternalSampleType> ReferenceMix(
+    const PlanarSampleBuffer<InternalSampleType>& input_samples,
+    const std::vector<std::vector<double>>& gains) {
+  const size_t num_output_channels = gains.front().size();
+  std::vector<InternalSampleType> output(
+      input_samples.num_ticks() * num_output_channels, 0.0);
+  for (size_t t = 0; t < input_samples.num_ticks(); ++t) {
+    for (size_t out = 0; out < num_output_channels; ++out) {
+      for (size_t in = 0; in < input_samples.num_channels(); ++in) {
+        output[t * num_output_channels + out] +=
+            input_samples.Channel(in)[t] * gains[in][out];
+      }
+    }
+  }
+  return output;
+}
+
+PlanarSampleBuffer<InternalSampleType> RandomSamples(size_t num_channels,
+                                                     size_t num_ticks,
+                                                     std::mt19937& rng) {
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  PlanarSampleBuffer<InternalSampleType> samples(num_channels, num_ticks);
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    for (auto& sample : samples.Channel(channel)) {
+      sample = distribution(rng);
+    }
+  }
+  return samples;
+}
+
+TEST(Create, FailsWithoutInputChannels) {
+  EXPECT_THAT(MixMatrix::Create({}), Not(IsOk()));
+}
+
+TEST(Create, FailsWithRaggedGains) {
+  EXPECT_THAT(MixMatrix::Create({{1, 0}, {1}}), Not(IsOk()));
+}
+
+TEST(Create, SetsDimensions) {
+  const auto matrix = MixMatrix::Create({{1, 0}, {0, 1}, {0.5, 0.5}});
+  ASSERT_THAT(matrix, IsOk());
+
+  EXPECT_EQ(matrix->num_input_channels(), 3);
+  EXPECT_EQ(matrix->num_output_channels(), 2);
+}
+
+TEST(CreateFromRowMajor, FailsWhenSizeDoesNotMatchDimensions) {
+  const std::vector<double> kGains = {1, 0, 0};
+
+  EXPECT_THAT(
+      MixMatrix::CreateFromRowMajor(absl::MakeConstSpan(kGains), 2, 2),
+      Not(IsOk()));
+}
+
+TEST(CreateFromRowMajor, IsEquivalentToCreateFromNestedGains) {
+  std::mt19937 rng(99);
+  const std::vector<std::vector<double>> kNestedGains = {
+      {0.5, 0.25, 0}, {0, 1, -0.75}};
+  const std::vector<double> kRowMajorGains = {0.5, 0.25, 0, 0, 1, -0.75};
+  const auto matrix = MixMatrix::CreateFromRowMajor(
+      absl::MakeConstSpan(kRowMajorGains), 2, 3);
+  ASSERT_THAT(matrix, IsOk());
+  EXPECT_EQ(matrix->num_input_channels(), 2);
+  EXPECT_EQ(matrix->num_output_channels(), 3);
+  const auto input = RandomSamples(2, 10, rng);
+
+  std::vector<InternalSampleType> output;
+  EXPECT_THAT(matrix->ApplyInterleaved(input, output), IsOk());
+
+  EXPECT_EQ(output, ReferenceMix(input, kNestedGains));
+}
+
+TEST(CreateFromQ15ColumnMajor, FailsWhenSizeDoesNotMatchDimensions) {
+  const std::vector<int16_t> kQ15Gains = {0, 0, 0};
+
+  EXPECT_THAT(MixMatrix::CreateFromQ15ColumnMajor(
+                  absl::MakeConstSpan(kQ15Gains), 2, 2),
+              Not(IsOk()));
+}
+
+TEST(CreateFromQ15ColumnMajor, ConvertsColumnMajorQ15Gains) {
+  // Input 0 goes to output 1 at half gain. Input 1 goes to output 0 at minus
+  // full gain.
+  const std::vector<int16_t> kQ15Gains = {0, 16384, -32768, 0};
+  const auto matrix = MixMatrix::CreateFromQ15ColumnMajor(
+      absl::MakeConstSpan(kQ15Gains), 2, 2);
+  ASSERT_THAT(matrix, IsOk());
+  PlanarSampleBuffer<InternalSampleType> input(2, 1);
+  input.FillChannel(0, 0.5);
+  input.FillChannel(1, 0.25);
+
+  std::vector<InternalSampleType> output;
+  EXPECT_THAT(matrix->ApplyInterleaved(input, output), IsOk());
+
+  EXPECT_THAT(output, ElementsAre(-0.25, 0.25));
+}
+
+TEST(ApplyInterleaved, FailsWithWrongNumberOfInputChannels) {
+  const auto matrix = MixMatrix::Create({{1, 0}, {0, 1}});
+  ASSERT_THAT(matrix, IsOk());
+  const PlanarSampleBuffer<InternalSampleType> input(3, 1);
+
+  std::vector<InternalSampleType> output;
+  EXPECT_THAT(matrix->ApplyInterleaved(input, output), Not(IsOk()));
+}
+
+TEST(ApplyInterleaved, InterleavesOutputChannels) {
+  const auto matrix = MixMatrix::Create({{1, 0, 0.5}, {0, 1, 0.5}});
+  ASSERT_THAT(matrix, IsOk());
+  const std::vector<std::vector<InternalSampleType>> kTimeChannelSamples = {
+      {0.5, 0.25}, {-0.5, 0.125}};
+  const auto input = PlanarSampleBuffer<InternalSampleType>::FromTimeChannel(
+      absl::MakeConstSpan(kTimeChannelSamples));
+  ASSERT_THAT(input, IsOk());
+
+  std::vector<InternalSampleType> output;
+  EXPECT_THAT(matrix->ApplyInterleaved(*input, output), IsOk());
+
+  EXPECT_THAT(output, ElementsAre(0.5, 0.25, 0.375, -0.5, 0.125, -0.1875));
+}
+
+TEST(ApplyInterleaved, OutputChannelWithoutGainsIsSilent) {
+  const auto matrix = MixMatrix::Create({{1, 0}});
+  ASSERT_THAT(matrix, IsOk());
+  PlanarSampleBuffer<InternalSampleType> input(1, 2);
+  input.FillChannel(0, 0.5);
+
+  std::vector<InternalSampleType> output = {9, 9, 9, 9};
+  EXPECT_THAT(matrix->ApplyInterleaved(input, output), IsOk());
+
+  EXPECT_THAT(output, ElementsAre(0.5, 0, 0.5, 0));
+}
+
+TEST(ApplyInterleaved, OnlyMixesValidTicks) {
+  const auto matrix = MixMatrix::Create({{1}});
+  ASSERT_THAT(matrix, IsOk());
+  PlanarSampleBuffer<InternalSampleType> input(1, 4);
+  input.FillChannel(0, 0.5);
+  EXPECT_THAT(input.SetNumTicks(3), IsOk());
+
+  std::vector<InternalSampleType> output;
+  EXPECT_THAT(matrix->ApplyInterleaved(input, output), IsOk());
+
+  EXPECT_THAT(output, ElementsAre(0.5, 0.5, 0.5));
+}
+
+TEST(ApplyInterleaved, MatchesReferenceExactlyForDenseGains) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  for (const size_t num_ticks : {1, 3, 64, 65, 130, 1024}) {
+    std::vector<std::vector<double>> gains(12, std::vector<double>(10));
+    for (auto& row : gains) {
+      for (auto& gain : row) {
+        gain = distribution(rng);
+      }
+    }
+    const auto input = RandomSamples(gains.size(), num_ticks, rng);
+    const auto matrix = MixMatrix::Create(gains);
+    ASSERT_THAT(matrix, IsOk());
+
+    std::vector<InternalSampleType> output;
+    EXPECT_THAT(matrix->ApplyInterleaved(input, output), IsOk());
+
+    EXPECT_EQ(output, ReferenceMix(input, gains));
+  }
+}
+
+TEST(ApplyInterleaved, MatchesReferenceExactlyForSparseGains) {
+  std::mt19937 rng(5678);
+  // Mostly identity, with a few mixed channels and unit gains.
+  const std::vector<std::vector<double>> kGains = {
+      {1, 0, 0, 0, 0}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0},
+      {0, 0, 0, 1, 0}, {0.707, 0, 0, 0, 1}, {0, 0.707, 0, 0, 1},
+      {0, 0, 0, 0, 0}};
+  const auto input = RandomSamples(kGains.size(), 257, rng);
+  const auto matrix = MixMatrix::Create(kGains);
+  ASSERT_THAT(matrix, IsOk());
+
+  std::vector<InternalSampleType> output;
+  EXPECT_THAT(matrix->ApplyInterleaved(input, output), IsOk());
+
+  EXPECT_EQ(output, ReferenceMix(input, kGains));
+}
+
+TEST(Apply, FailsWithWrongNumberOfOutputChannels) {
+  const auto matrix = MixMatrix::Create({{1, 0}, {0, 1}});
+  ASSERT_THAT(matrix, IsOk());
+  const PlanarSampleBuffer<InternalSampleType> input(2, 1);
+
+  PlanarSampleBuffer<InternalSampleType> output(3, 1);
+  EXPECT_THAT(matrix->Apply(input, output), Not(IsOk()));
+}
+
+TEST(Apply, FailsWhenOutputIsTooShort) {
+  const auto matrix = MixMatrix::Create({{1}});
+  ASSERT_THAT(matrix, IsOk());
+  const PlanarSampleBuffer<InternalSampleType> input(1, 4);
+
+  PlanarSampleBuffer<InternalSampleType> output(1, 2);
+  EXPECT_THAT(matrix->Apply(input, output), Not(IsOk()));
+}
+
+TEST(Apply, MatchesInterleavedOutput) {
+  std::mt19937 rng(42);
+  const std::vector<std::vector<double>> kGains = {
+      {0.5, 0.25}, {0, 1}, {-0.75, 0}};
+  const auto input = RandomSamples(kGains.size(), 100, rng);
+  const auto matrix = MixMatrix::Create(kGains);
+  ASSERT_THAT(matrix, IsOk());
+
+  // Reuse a longer buffer with stale samples.
+  PlanarSampleBuffer<InternalSampleType> output(2, 128);
+  output.FillChannel(0, 9);
+  output.FillChannel(1, 9);
+  EXPECT_THAT(matrix->Apply(input, output), IsOk());
+
+  EXPECT_EQ(output.num_ticks(), 100);
+  std::vector<InternalSampleType> interleaved;
+  output.ToInterleaved(interleaved);
+  EXPECT_EQ(interleaved, ReferenceMix(input, kGains));
+}
+
+}  // namespace
+}  // namespace iamf_tools
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/renderer/precomputed_gains.h"
+
+#include <optional>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::testing::DoubleEq;
+using ::testing::ElementsAre;
+using ::testing::Optional;
+
+TEST(LookupPrecomputedGainsLayout, LooksUpChannelBasedLayouts) {
+  EXPECT_THAT(LookupPrecomputedGainsLayout("0+2+0"),
+              Optional(PrecomputedGainsLayout::k0_2_0));
+  EXPECT_THAT(LookupPrecomputedGainsLayout("3.1.2"),
+              Optional(PrecomputedGainsLayout::k3_1_2Ch));
+  EXPECT_THAT(LookupPrecomputedGainsLayout("9+10+3"),
+              Optional(PrecomputedGainsLayout::k9_10_3));
+}
+
+TEST(LookupPrecomputedGainsLayout, LooksUpAmbisonicsLayouts) {
+  EXPECT_THAT(LookupPrecomputedGainsLayout("A0"),
+              Optional(PrecomputedGainsLayout::kA0));
+  EXPECT_THAT(LookupPrecomputedGainsLayout("A4"),
+              Optional(PrecomputedGainsLayout::kA4));
+}
+
+TEST(LookupPrecomputedGainsLayout, ReturnsNulloptForUnknownKey) {
+  EXPECT_EQ(LookupPrecomputedGainsLayout("UNKNOWN"), std::nullopt);
+}
+
+TEST(GetPrecomputedGains, GetsStereoToMonoGains) {
+  const auto gains = GetPrecomputedGains(PrecomputedGainsLayout::k0_2_0,
+                                         PrecomputedGainsLayout::k0_1_0);
+  ASSERT_TRUE(gains.has_value());
+
+  EXPECT_EQ(gains->num_input_channels, 2);
+  EXPECT_EQ(gains->num_output_channels, 1);
+  EXPECT_THAT(gains->gains, ElementsAre(DoubleEq(0.5), DoubleEq(0.5)));
+}
+
+TEST(GetPrecomputedGains, GetsRowMajorGains) {
+  const auto gains = GetPrecomputedGains(PrecomputedGainsLayout::k0_2_0,
+                                         PrecomputedGainsLayout::k0_5_0);
+  ASSERT_TRUE(gains.has_value());
+
+  EXPECT_EQ(gains->num_input_channels, 2);
+  EXPECT_EQ(gains->num_output_channels, 6);
+  EXPECT_THAT(gains->gains, ElementsAre(1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0));
+}
+
+TEST(GetPrecomputedGains, ReturnsNulloptForIdentity) {
+  EXPECT_EQ(GetPrecomputedGains(PrecomputedGainsLayout::k0_2_0,
+                                PrecomputedGainsLayout::k0_2_0),
+            std::nullopt);
+}
+
+TEST(GetPrecomputedGains, ReturnsNulloptForAmbisonicsOutput) {
+  EXPECT_EQ(GetPrecomputedGains(PrecomputedGainsLayout::k0_2_0,
+                                PrecomputedGainsLayout::kA1),
+            std::nullopt);
+}
+
+TEST(GetPrecomputedGains, ReturnsSameTableForEachLookup) {
+  const auto first = GetPrecomputedGains(PrecomputedGainsLayout::kA1,
+                                         PrecomputedGainsLayout::k0_2_0);
+  const auto second = GetPrecomputedGains(PrecomputedGainsLayout::kA1,
+                                          PrecomputedGainsLayout::k0_2_0);
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+
+  EXPECT_EQ(first->gains.data(), second->gains.data());
+}
+
+}  // namespace
+}  // namespace iamf_tools
@@ -16,11 +16,11 @@
 #include <vector>
 
 #include "absl/status/status_matchers.h"
-#include "absl/types/span.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "iamf/cli/channel_label.h"
 #include "iamf/cli/demixing_module.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/mix_presentation.h"
 #include "iamf/obu/types.h"
 
@@ -36,33 +36,27 @@ using testing::Pointwise;
 constexpr size_t kNumSamplesPerFrame = 8;
 
 TEST(ArrangeSamplesToRender, SucceedsOnEmptyFrame) {
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame, std::vector<InternalSampleType>(0));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(ArrangeSamplesToRender({}, {}, samples, num_valid_samples),
-              IsOk());
+  PlanarSampleBuffer<InternalSampleType> samples(0, kNumSamplesPerFrame);
+  EXPECT_THAT(ArrangeSamplesToRender({}, {}, samples), IsOk());
 
-  // `samples` remains the same size, but `num_valid_samples` is zero.
-  EXPECT_EQ(samples.size(), kNumSamplesPerFrame);
-  EXPECT_EQ(num_valid_samples, 0);
+  // `samples` keeps its capacity, but has no valid ticks.
+  EXPECT_EQ(samples.max_num_ticks(), kNumSamplesPerFrame);
+  EXPECT_EQ(samples.num_ticks(), 0);
 }
 
-TEST(ArrangeSamplesToRender, ArrangesSamplesInTimeChannelAxes) {
+TEST(ArrangeSamplesToRender, ArrangesSamplesInChannelTimeAxes) {
   const LabeledFrame kStereoLabeledFrame = {
       .label_to_samples = {{kL2, {0, 1, 2}}, {kR2, {10, 11, 12}}}};
   const std::vector<ChannelLabel::Label> kStereoArrangement = {kL2, kR2};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kStereoArrangement.size()));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(ArrangeSamplesToRender(kStereoLabeledFrame, kStereoArrangement,
-                                     samples, num_valid_samples),
-              IsOk());
-  EXPECT_THAT(absl::MakeConstSpan(samples).first(num_valid_samples),
-              testing::ElementsAreArray({Pointwise(DoubleEq(), {0.0, 10.0}),
-                                         Pointwise(DoubleEq(), {1.0, 11.0}),
-                                         Pointwise(DoubleEq(), {2.0, 12.0})}));
+  PlanarSampleBuffer<InternalSampleType> samples(kStereoArrangement.size(),
+                                                 kNumSamplesPerFrame);
+  EXPECT_THAT(
+      ArrangeSamplesToRender(kStereoLabeledFrame, kStereoArrangement, samples),
+      IsOk());
+  EXPECT_EQ(samples.num_ticks(), 3);
+  EXPECT_THAT(samples.Channel(0), Pointwise(DoubleEq(), {0.0, 1.0, 2.0}));
+  EXPECT_THAT(samples.Channel(1), Pointwise(DoubleEq(), {10.0, 11.0, 12.0}));
 }
 
 TEST(ArrangeSamplesToRender, FindsDemixedLabels) {
@@ -70,16 +64,13 @@ TEST(ArrangeSamplesToRender, FindsDemixedLabels) {
       .label_to_samples = {{kMono, {75}}, {kL2, {50}}, {kDemixedR2, {100}}}};
   const std::vector<ChannelLabel::Label> kStereoArrangement = {kL2, kR2};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kStereoArrangement.size()));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(
-      ArrangeSamplesToRender(kDemixedTwoLayerStereoFrame, kStereoArrangement,
-                             samples, num_valid_samples),
-      IsOk());
+  PlanarSampleBuffer<InternalSampleType> samples(kStereoArrangement.size(),
+                                                 kNumSamplesPerFrame);
+  EXPECT_THAT(ArrangeSamplesToRender(kDemixedTwoLayerStereoFrame,
+                                     kStereoArrangement, samples),
+              IsOk());
   EXPECT_THAT(
-      absl::MakeConstSpan(samples).first(num_valid_samples),
+      samples.ToTimeChannel(),
       testing::ElementsAreArray({Pointwise(DoubleEq(), {50.0, 100.0})}));
 }
 
@@ -88,15 +79,12 @@ TEST(ArrangeSamplesToRender, IgnoresExtraLabels) {
       .label_to_samples = {{kL2, {0}}, {kR2, {10}}, {kLFE, {999}}}};
   const std::vector<ChannelLabel::Label> kStereoArrangement = {kL2, kR2};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kStereoArrangement.size()));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(
-      ArrangeSamplesToRender(kStereoLabeledFrameWithExtraLabel,
-                             kStereoArrangement, samples, num_valid_samples),
-      IsOk());
-  EXPECT_THAT(absl::MakeConstSpan(samples).first(num_valid_samples),
+  PlanarSampleBuffer<InternalSampleType> samples(kStereoArrangement.size(),
+                                                 kNumSamplesPerFrame);
+  EXPECT_THAT(ArrangeSamplesToRender(kStereoLabeledFrameWithExtraLabel,
+                                     kStereoArrangement, samples),
+              IsOk());
+  EXPECT_THAT(samples.ToTimeChannel(),
               testing::ElementsAreArray({Pointwise(DoubleEq(), {0.0, 10.0})}));
 }
 
@@ -107,15 +95,13 @@ TEST(ArrangeSamplesToRender, LeavesOmittedLabelsZeroForMixedOrderAmbisonics) {
   const std::vector<ChannelLabel::Label> kMixedFirstOrderAmbisonicsArrangement =
       {kA0, kOmitted, kA2, kA3};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame, std::vector<InternalSampleType>(
-                               kMixedFirstOrderAmbisonicsArrangement.size()));
-  size_t num_valid_samples = 0;
+  PlanarSampleBuffer<InternalSampleType> samples(
+      kMixedFirstOrderAmbisonicsArrangement.size(), kNumSamplesPerFrame);
   EXPECT_THAT(ArrangeSamplesToRender(kMixedFirstOrderAmbisonicsFrame,
                                      kMixedFirstOrderAmbisonicsArrangement,
-                                     samples, num_valid_samples),
+                                     samples),
               IsOk());
-  EXPECT_THAT(absl::MakeConstSpan(samples).first(num_valid_samples),
+  EXPECT_THAT(samples.ToTimeChannel(),
               testing::ElementsAreArray(
                   {Pointwise(DoubleEq(), {1.0, 0.0, 201.0, 301.0}),
                    Pointwise(DoubleEq(), {2.0, 0.0, 202.0, 302.0})}));
@@ -126,16 +112,13 @@ TEST(ArrangeSamplesToRender, LeavesOmittedLabelsZeroForChannelBasedLayout) {
   const std::vector<ChannelLabel::Label> kLFEAsSecondChannelArrangement = {
       kOmitted, kOmitted, kLFE, kOmitted};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kLFEAsSecondChannelArrangement.size()));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(
-      ArrangeSamplesToRender(kLFEOnlyFrame, kLFEAsSecondChannelArrangement,
-                             samples, num_valid_samples),
-      IsOk());
+  PlanarSampleBuffer<InternalSampleType> samples(
+      kLFEAsSecondChannelArrangement.size(), kNumSamplesPerFrame);
+  EXPECT_THAT(ArrangeSamplesToRender(kLFEOnlyFrame,
+                                     kLFEAsSecondChannelArrangement, samples),
+              IsOk());
   EXPECT_THAT(
-      absl::MakeConstSpan(samples).first(num_valid_samples),
+      samples.ToTimeChannel(),
       testing::ElementsAreArray({Pointwise(DoubleEq(), {0.0, 0.0, 1.0, 0.0}),
                                  Pointwise(DoubleEq(), {0.0, 0.0, 2.0, 0.0})}));
 }
@@ -147,33 +130,44 @@ TEST(ArrangeSamplesToRender, ExcludesSamplesToBeTrimmed) {
       .label_to_samples = {{kMono, {999, 100, 999, 999}}}};
   const std::vector<ChannelLabel::Label> kMonoArrangement = {kMono};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kMonoArrangement.size()));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(
-      ArrangeSamplesToRender(kMonoLabeledFrameWithSamplesToTrim,
-                             kMonoArrangement, samples, num_valid_samples),
-      IsOk());
-  EXPECT_THAT(absl::MakeConstSpan(samples).first(num_valid_samples),
+  PlanarSampleBuffer<InternalSampleType> samples(kMonoArrangement.size(),
+                                                 kNumSamplesPerFrame);
+  EXPECT_THAT(ArrangeSamplesToRender(kMonoLabeledFrameWithSamplesToTrim,
+                                     kMonoArrangement, samples),
+              IsOk());
+  EXPECT_THAT(samples.ToTimeChannel(),
               testing::ElementsAreArray({Pointwise(DoubleEq(), {100.0})}));
 }
 
-TEST(ArrangeSamplesToRender, OverwritesInputVector) {
+TEST(ArrangeSamplesToRender, OverwritesInputBuffer) {
   const LabeledFrame kMonoLabeledFrame = {
       .label_to_samples = {{kMono, {1, 2}}}};
   const std::vector<ChannelLabel::Label> kMonoArrangement = {kMono};
 
-  std::vector<std::vector<InternalSampleType>> samples = {{999}, {999}};
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(ArrangeSamplesToRender(kMonoLabeledFrame, kMonoArrangement,
-                                     samples, num_valid_samples),
-              IsOk());
-  EXPECT_THAT(absl::MakeConstSpan(samples).first(num_valid_samples),
+  PlanarSampleBuffer<InternalSampleType> samples(kMonoArrangement.size(), 2);
+  samples.FillChannel(0, 999);
+  EXPECT_THAT(
+      ArrangeSamplesToRender(kMonoLabeledFrame, kMonoArrangement, samples),
+      IsOk());
+  EXPECT_THAT(samples.ToTimeChannel(),
               testing::ElementsAreArray({Pointwise(DoubleEq(), {1.0}),
                                          Pointwise(DoubleEq(), {2.0})}));
 }
 
+TEST(ArrangeSamplesToRender, ZeroesOmittedLabelsWhenReusingBuffer) {
+  const LabeledFrame kLFEOnlyFrame = {.label_to_samples = {{kLFE, {1, 2}}}};
+  const std::vector<ChannelLabel::Label> kLFEAsSecondChannelArrangement = {
+      kOmitted, kLFE};
+
+  PlanarSampleBuffer<InternalSampleType> samples(
+      kLFEAsSecondChannelArrangement.size(), kNumSamplesPerFrame);
+  samples.FillChannel(0, 999);
+  EXPECT_THAT(ArrangeSamplesToRender(kLFEOnlyFrame,
+                                     kLFEAsSecondChannelArrangement, samples),
+              IsOk());
+  EXPECT_THAT(samples.Channel(0), Pointwise(DoubleEq(), {0.0, 0.0}));
+}
+
 TEST(ArrangeSamplesToRender, TrimmingAllFramesFromStartIsResultsInEmptyOutput) {
   const LabeledFrame kMonoLabeledFrameWithSamplesToTrim = {
       .samples_to_trim_at_end = 0,
@@ -181,15 +175,12 @@ TEST(ArrangeSamplesToRender, TrimmingAllFramesFromStartIsResultsInEmptyOutput) {
       .label_to_samples = {{kMono, {999, 999, 999, 999}}}};
   const std::vector<ChannelLabel::Label> kMonoArrangement = {kMono};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kMonoArrangement.size()));
-  size_t num_valid_samples = 0;
-  EXPECT_THAT(
-      ArrangeSamplesToRender(kMonoLabeledFrameWithSamplesToTrim,
-                             kMonoArrangement, samples, num_valid_samples),
-      IsOk());
-  EXPECT_TRUE(absl::MakeConstSpan(samples).first(num_valid_samples).empty());
+  PlanarSampleBuffer<InternalSampleType> samples(kMonoArrangement.size(),
+                                                 kNumSamplesPerFrame);
+  EXPECT_THAT(ArrangeSamplesToRender(kMonoLabeledFrameWithSamplesToTrim,
+                                     kMonoArrangement, samples),
+              IsOk());
+  EXPECT_TRUE(samples.ToTimeChannel().empty());
 }
 
 TEST(ArrangeSamplesToRender,
@@ -198,13 +189,10 @@ TEST(ArrangeSamplesToRender,
       .label_to_samples = {{kL2, {0, 1}}, {kR2, {10}}}};
   const std::vector<ChannelLabel::Label> kStereoArrangement = {kL2, kR2};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kStereoArrangement.size()));
-  size_t num_valid_samples = 0;
+  PlanarSampleBuffer<InternalSampleType> samples(kStereoArrangement.size(),
+                                                 kNumSamplesPerFrame);
   EXPECT_FALSE(ArrangeSamplesToRender(kStereoLabeledFrameWithMissingSample,
-                                      kStereoArrangement, samples,
-                                      num_valid_samples)
+                                      kStereoArrangement, samples)
                    .ok());
 }
 
@@ -215,13 +203,32 @@ TEST(ArrangeSamplesToRender, InvalidWhenTrimIsImplausible) {
       .label_to_samples = {{kL2, {0, 1}}, {kR2, {10, 11}}}};
   const std::vector<ChannelLabel::Label> kStereoArrangement = {kL2, kR2};
 
-  std::vector<std::vector<InternalSampleType>> samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kStereoArrangement.size()));
-  size_t num_valid_samples = 0;
+  PlanarSampleBuffer<InternalSampleType> samples(kStereoArrangement.size(),
+                                                 kNumSamplesPerFrame);
   EXPECT_FALSE(ArrangeSamplesToRender(kFrameWithExcessSamplesTrimmed,
-                                      kStereoArrangement, samples,
-                                      num_valid_samples)
+                                      kStereoArrangement, samples)
+                   .ok());
+}
+
+TEST(ArrangeSamplesToRender, InvalidWhenFrameDoesNotFitIntoOutput) {
+  const LabeledFrame kMonoLabeledFrame = {
+      .label_to_samples = {{kMono, {1, 2, 3}}}};
+  const std::vector<ChannelLabel::Label> kMonoArrangement = {kMono};
+
+  PlanarSampleBuffer<InternalSampleType> samples(kMonoArrangement.size(), 2);
+  EXPECT_FALSE(
+      ArrangeSamplesToRender(kMonoLabeledFrame, kMonoArrangement, samples)
+          .ok());
+}
+
+TEST(ArrangeSamplesToRender, InvalidWhenOutputHasWrongNumberOfChannels) {
+  const LabeledFrame kStereoLabeledFrame = {
+      .label_to_samples = {{kL2, {0}}, {kR2, {10}}}};
+  const std::vector<ChannelLabel::Label> kStereoArrangement = {kL2, kR2};
+
+  PlanarSampleBuffer<InternalSampleType> mono_samples(1, kNumSamplesPerFrame);
+  EXPECT_FALSE(ArrangeSamplesToRender(kStereoLabeledFrame, kStereoArrangement,
+                                      mono_samples)
                    .ok());
 }
 
@@ -230,12 +237,10 @@ TEST(ArrangeSamplesToRender, InvalidMissingLabel) {
       .label_to_samples = {{kL2, {0}}, {kR2, {10}}}};
   const std::vector<ChannelLabel::Label> kMonoArrangement = {kMono};
 
-  std::vector<std::vector<InternalSampleType>> unused_samples(
-      kNumSamplesPerFrame,
-      std::vector<InternalSampleType>(kMonoArrangement.size()));
-  size_t num_valid_samples = 0;
+  PlanarSampleBuffer<InternalSampleType> unused_samples(kMonoArrangement.size(),
+                                                        kNumSamplesPerFrame);
   EXPECT_FALSE(ArrangeSamplesToRender(kStereoLabeledFrame, kMonoArrangement,
-                                      unused_samples, num_valid_samples)
+                                      unused_samples)
                    .ok());
 }
 
@@ -200,7 +200,7 @@ absl::Status GetParameterBlockLinearMixGainsPerTick(
   std::fill(linear_mix_gain_per_tick.begin(), linear_mix_gain_per_tick.end(),
             std::pow(10.0f, Q7_8ToFloat(default_mix_gain) / 20.0f));
 
-  int32_t cur_tick = parameter_block.start_timestamp;
+  InternalTimestamp cur_tick = parameter_block.start_timestamp;
   // Process as many ticks as possible until all are found or the parameter
   // block ends.
   while (cur_tick < parameter_block.end_timestamp &&
@@ -221,7 +221,8 @@ absl::Status GetParameterBlockLinearMixGainsPerTick(
 // TODO(b/379961928): Remove this function once the new
 //                    `GetParameterBlockLinearMixGainsPerTick()` is in use.
 absl::Status GetParameterBlockLinearMixGainsPerTick(
-    uint32_t common_sample_rate, int32_t start_timestamp, int32_t end_timestamp,
+    uint32_t common_sample_rate, InternalTimestamp start_timestamp,
+    InternalTimestamp end_timestamp,
     const std::list<ParameterBlockWithData>& parameter_blocks,
     const MixGainParamDefinition& mix_gain,
     std::vector<float>& linear_mix_gain_per_tick) {
@@ -238,7 +239,7 @@ absl::Status GetParameterBlockLinearMixGainsPerTick(
   std::fill(linear_mix_gain_per_tick.begin(), linear_mix_gain_per_tick.end(),
             std::pow(10.0f, Q7_8ToFloat(default_mix_gain) / 20.0f));
 
-  int32_t cur_tick = start_timestamp;
+  InternalTimestamp cur_tick = start_timestamp;
 
   // Find the mix gain at each tick. May terminate early if there are samples to
   // trim at the end.
@@ -309,7 +310,8 @@ absl::Status GetAndApplyMixGain(  // NOLINT
 
 // TODO(b/379961928): Remove once the new GetAndApplyMixGain is in use.
 absl::Status GetAndApplyMixGain(
-    uint32_t common_sample_rate, int32_t start_timestamp, int32_t end_timestamp,
+    uint32_t common_sample_rate, InternalTimestamp start_timestamp,
+    InternalTimestamp end_timestamp,
     const std::list<ParameterBlockWithData>& parameter_blocks,
     const MixGainParamDefinition& mix_gain, int32_t num_channels,
     std::vector<float>& linear_mix_gain_per_tick,
@@ -380,7 +382,8 @@ absl::StatusOr<absl::Span<const std::vector<int32_t>>> RenderAllFramesForLayout(
     const MixGainParamDefinition& output_mix_gain,
     const IdLabeledFrameMap& id_to_labeled_frame,
     const std::vector<AudioElementRenderingMetadata>& rendering_metadata_array,
-    const int32_t start_timestamp, const int32_t end_timestamp,
+    const InternalTimestamp start_timestamp,
+    const InternalTimestamp end_timestamp,
     const std::list<ParameterBlockWithData>& parameter_blocks,
     const uint32_t common_sample_rate,
     std::vector<std::vector<int32_t>>& rendered_samples) {
@@ -503,6 +506,27 @@ using LayoutRenderingMetadata =
 using SubmixRenderingMetadata =
     RenderingMixPresentationFinalizer::SubmixRenderingMetadata;
 
+// Optionally creates a loudness calculator and a wav writer for a layout.
+void CreateLoudnessCalculatorAndWavWriter(
+    const LoudnessCalculatorFactoryBase* loudness_calculator_factory,
+    const RenderingMixPresentationFinalizer::WavWriterFactory&
+        wav_writer_factory,
+    const DecodedUleb128 mix_presentation_id, int sub_mix_index,
+    int layout_index, const MixPresentationLayout& layout,
+    uint32_t common_sample_rate, uint8_t loudness_calculator_bit_depth,
+    uint8_t wav_file_bit_depth, uint32_t common_num_samples_per_frame,
+    LayoutRenderingMetadata& layout_rendering_metadata) {
+  if (loudness_calculator_factory != nullptr) {
+    layout_rendering_metadata.loudness_calculator =
+        loudness_calculator_factory->CreateLoudnessCalculator(
+            layout, common_sample_rate, loudness_calculator_bit_depth);
+  }
+  layout_rendering_metadata.wav_writer = wav_writer_factory(
+      mix_presentation_id, sub_mix_index, layout_index, layout.loudness_layout,
+      layout_rendering_metadata.num_channels, common_sample_rate,
+      wav_file_bit_depth, common_num_samples_per_frame);
+}
+
 // Generates rendering metadata for all layouts within a submix. This includes
 // optionally creating a wav writer and/or a loudness calculator for each
 // layout.
@@ -540,17 +564,11 @@ absl::Status GenerateRenderingMetadataForLayouts(
     } else {
       layout_rendering_metadata.can_render = true;
     }
-    if (loudness_calculator_factory != nullptr) {
-      // Optionally create a loudness calculator.
-      layout_rendering_metadata.loudness_calculator =
-          loudness_calculator_factory->CreateLoudnessCalculator(
-              layout, common_sample_rate, loudness_calculator_bit_depth);
-    }
-    // Optionally create a wav writer.
-    layout_rendering_metadata.wav_writer = wav_writer_factory(
-        mix_presentation_id, sub_mix_index, layout_index,
-        layout.loudness_layout, num_channels, common_sample_rate,
-        wav_file_bit_depth, common_num_samples_per_frame);
+    CreateLoudnessCalculatorAndWavWriter(
+        loudness_calculator_factory, wav_writer_factory, mix_presentation_id,
+        sub_mix_index, layout_index, layout, common_sample_rate,
+        loudness_calculator_bit_depth, wav_file_bit_depth,
+        common_num_samples_per_frame, layout_rendering_metadata);
 
     // Pre-allocate a buffer to store a frame's worth of rendered samples.
     layout_rendering_metadata.rendered_samples.resize(
@@ -600,11 +618,11 @@ absl::Status GenerateRenderingMetadataForSubmixes(
 
     // Data common to all audio elements and layouts.
     bool requires_resampling;
-    uint32_t common_num_samples_per_frame;
     RETURN_IF_NOT_OK(GetCommonCodecConfigPropertiesFromAudioElementIds(
         audio_elements_in_sub_mix, submix_rendering_metadata.common_sample_rate,
         submix_rendering_metadata.loudness_calculator_bit_depth,
-        common_num_samples_per_frame, requires_resampling));
+        submix_rendering_metadata.common_num_samples_per_frame,
+        requires_resampling));
     if (requires_resampling) {
       // TODO(b/274689885): Convert to a common sample rate and/or bit-depth.
       return absl::UnimplementedError(
@@ -625,7 +643,8 @@ absl::Status GenerateRenderingMetadataForSubmixes(
         submix_rendering_metadata.common_sample_rate,
         submix_rendering_metadata.loudness_calculator_bit_depth,
         submix_rendering_metadata.wav_file_bit_depth,
-        common_num_samples_per_frame, layout_rendering_metadata));
+        submix_rendering_metadata.common_num_samples_per_frame,
+        layout_rendering_metadata));
   }
   return absl::OkStatus();
 }
@@ -687,8 +706,9 @@ const absl::AnyInvocable<absl::Status(int32_t, int32_t&) const>
 // then optionally writes the rendered samples to a wav file and/or calculates
 // the loudness of the rendered samples.
 absl::Status RenderWriteAndCalculateLoudnessForTemporalUnit(
-    const IdLabeledFrameMap& id_to_labeled_frame, const int32_t start_timestamp,
-    const int32_t end_timestamp,
+    const IdLabeledFrameMap& id_to_labeled_frame,
+    const InternalTimestamp start_timestamp,
+    const InternalTimestamp end_timestamp,
     const std::list<ParameterBlockWithData>& parameter_blocks,
     std::vector<SubmixRenderingMetadata>& rendering_metadata) {
   for (auto& submix_rendering_metadata : rendering_metadata) {
@@ -775,9 +795,15 @@ RenderingMixPresentationFinalizer::Create(
 }
 
 absl::Status RenderingMixPresentationFinalizer::PushTemporalUnit(
-    const IdLabeledFrameMap& id_to_labeled_frame, const int32_t start_timestamp,
-    const int32_t end_timestamp,
+    const IdLabeledFrameMap& id_to_labeled_frame,
+    const InternalTimestamp start_timestamp,
+    const InternalTimestamp end_timestamp,
     const std::list<ParameterBlockWithData>& parameter_blocks) {
+  if (finalized_) {
+    return absl::FailedPreconditionError(
+        "`PushTemporalUnit` cannot be called after `Finalize` until the "
+        "finalizer is reset.");
+  }
   for (auto& mix_presentation_rendering_metadata : rendering_metadata_) {
     if (!CanRenderAnyLayout(
             mix_presentation_rendering_metadata.submix_rendering_metadata)) {
@@ -798,6 +824,10 @@ absl::Status RenderingMixPresentationFinalizer::Finalize(
     LOG(INFO) << "Renderer is disabled; so rendering is safely aborted.";
     return absl::OkStatus();
   }
+  if (finalized_) {
+    return absl::FailedPreconditionError(
+        "`Finalize` cannot be called again until the finalizer is reset.");
+  }
   if (rendering_metadata_.size() != mix_presentation_obus.size()) {
     return absl::InvalidArgumentError(
         "Size mismatch between rendering metadata and mix presentation OBUs.");
@@ -815,9 +845,80 @@ absl::Status RenderingMixPresentationFinalizer::Finalize(
         mix_presentation_obu));
     i++;
   }
-  // Clearing rendering metadata closes all renderers, wav writers, and loudness
-  // calculators.
-  rendering_metadata_.clear();
+  // Releasing the wav writers closes their files. The renderers are kept so
+  // that they can be reused after a `Reset`.
+  for (auto& mix_presentation_rendering_metadata : rendering_metadata_) {
+    for (auto& submix_rendering_metadata :
+         mix_presentation_rendering_metadata.submix_rendering_metadata) {
+      for (auto& layout_rendering_metadata :
+           submix_rendering_metadata.layout_rendering_metadata) {
+        layout_rendering_metadata.wav_writer.reset();
+        layout_rendering_metadata.loudness_calculator.reset();
+      }
+    }
+  }
+  finalized_ = true;
+  return absl::OkStatus();
+}
+
+absl::Status RenderingMixPresentationFinalizer::Reset(
+    absl::Nullable<const LoudnessCalculatorFactoryBase*>
+        loudness_calculator_factory,
+    const WavWriterFactory& wav_writer_factory,
+    const std::list<MixPresentationObu>& mix_presentation_obus) {
+  if (rendering_is_disabled_) {
+    finalized_ = false;
+    return absl::OkStatus();
+  }
+  if (rendering_metadata_.size() != mix_presentation_obus.size()) {
+    return absl::InvalidArgumentError(
+        "Size mismatch between rendering metadata and mix presentation OBUs.");
+  }
+  int i = 0;
+  for (const auto& mix_presentation_obu : mix_presentation_obus) {
+    auto& mix_presentation_rendering_metadata = rendering_metadata_[i++];
+    const auto mix_presentation_id =
+        mix_presentation_obu.GetMixPresentationId();
+    auto& submix_rendering_metadata =
+        mix_presentation_rendering_metadata.submix_rendering_metadata;
+    if (mix_presentation_rendering_metadata.mix_presentation_id !=
+            mix_presentation_id ||
+        submix_rendering_metadata.size() !=
+            mix_presentation_obu.sub_mixes_.size()) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Mix presentation OBU with ID= ", mix_presentation_id,
+          " does not match the rendering metadata."));
+    }
+    for (int sub_mix_index = 0;
+         sub_mix_index < submix_rendering_metadata.size(); ++sub_mix_index) {
+      auto& submix = submix_rendering_metadata[sub_mix_index];
+      const auto& layouts =
+          mix_presentation_obu.sub_mixes_[sub_mix_index].layouts;
+      if (submix.layout_rendering_metadata.size() != layouts.size()) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Mix presentation OBU with ID= ", mix_presentation_id,
+            " does not match the rendering metadata."));
+      }
+      for (int layout_index = 0; layout_index < layouts.size();
+           ++layout_index) {
+        auto& layout_rendering_metadata =
+            submix.layout_rendering_metadata[layout_index];
+        // Close the previous file before the factory may reuse its path.
+        layout_rendering_metadata.wav_writer.reset();
+        layout_rendering_metadata.loudness_calculator.reset();
+        if (!layout_rendering_metadata.can_render) {
+          continue;
+        }
+        CreateLoudnessCalculatorAndWavWriter(
+            loudness_calculator_factory, wav_writer_factory,
+            mix_presentation_id, sub_mix_index, layout_index,
+            layouts[layout_index], submix.common_sample_rate,
+            submix.loudness_calculator_bit_depth, submix.wav_file_bit_depth,
+            submix.common_num_samples_per_frame, layout_rendering_metadata);
+      }
+    }
+  }
+  finalized_ = false;
   return absl::OkStatus();
 }
 
@@ -72,7 +72,7 @@ class RenderingMixPresentationFinalizer {
     int32_t num_channels;
     // The start time stamp of the current frames to be rendered within this
     // layout.
-    int32_t start_timestamp;
+    InternalTimestamp start_timestamp;
 
     // Reusable buffer for storing rendered samples.
     std::vector<std::vector<int32_t>> rendered_samples;
@@ -91,6 +91,7 @@ class RenderingMixPresentationFinalizer {
     uint32_t common_sample_rate;
     uint8_t wav_file_bit_depth;
     uint8_t loudness_calculator_bit_depth;
+    uint32_t common_num_samples_per_frame;
     std::vector<SubMixAudioElement> audio_elements_in_sub_mix;
     // Mix gain applied to the entire submix.
     std::unique_ptr<MixGainParamDefinition> mix_gain;
@@ -184,29 +185,50 @@ class RenderingMixPresentationFinalizer {
    * \param end_timestamp End timestamp of this temporal unit.
    * \param parameter_blocks Parameter Block OBUs associated with this temporal
    *        unit.
-   * \param mix_presentation_obus Output list of OBUs to finalize with initial
-   *        user-provided loudness information.
-   * \return `absl::OkStatus()` on success. A specific status on failure.
+   * \return `absl::OkStatus()` on success. A specific status on failure or if
+   *         called after `Finalize()` without a `Reset()`.
    */
   absl::Status PushTemporalUnit(
-      const IdLabeledFrameMap& id_to_labeled_frame, int32_t start_timestamp,
-      int32_t end_timestamp,
+      const IdLabeledFrameMap& id_to_labeled_frame,
+      InternalTimestamp start_timestamp, InternalTimestamp end_timestamp,
       const std::list<ParameterBlockWithData>& parameter_blocks);
 
   /*!\brief Validates and updates loudness for all mix presentations.
    *
    * Will update the loudness information for each mix presentation. Should be
-   * called after all temporal units have been pushed to PushTemporalUnit.
+   * called after all temporal units have been pushed to PushTemporalUnit. Wav
+   * writers and loudness calculators are released, which closes the wav files.
    *
    * \param validate_loudness If true, validate the loudness against the user
    *        provided loudness.
    * \param mix_presentation_obus Output list of OBUs to finalize with
    *        calculated loudness information.
-   * \return `absl::OkStatus()` on success. A specific status on failure.
+   * \return `absl::OkStatus()` on success. A specific status on failure or if
+   *         called again without a `Reset()`.
    */
   absl::Status Finalize(bool validate_loudness,
                         std::list<MixPresentationObu>& mix_presentation_obus);
 
+  /*!\brief Resets the finalizer to render another IA Sequence.
+   *
+   * The renderers are kept, since they depend only on the descriptor OBUs.
+   * Any wav writers and loudness calculators of the previous IA Sequence are
+   * released and new ones are created, so the loudness is measured from
+   * scratch.
+   *
+   * \param loudness_calculator_factory Factory to create loudness calculators
+   *        or `nullptr` to disable loudness calculation.
+   * \param wav_writer_factory Factory to create wav writers.
+   * \param mix_presentation_obus Mix presentation OBUs this finalizer was
+   *        created with.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status Reset(
+      absl::Nullable<const LoudnessCalculatorFactoryBase*>
+          loudness_calculator_factory,
+      const WavWriterFactory& wav_writer_factory,
+      const std::list<MixPresentationObu>& mix_presentation_obus);
+
  private:
   /*!\brief  Metadata for all sub mixes within a single mix presentation. */
   struct MixPresentationRenderingMetadata {
@@ -226,6 +248,7 @@ class RenderingMixPresentationFinalizer {
         rendering_metadata_(std::move(rendering_metadata)) {}
 
   const bool rendering_is_disabled_;
+  bool finalized_ = false;
 
   std::vector<MixPresentationRenderingMetadata> rendering_metadata_;
 };
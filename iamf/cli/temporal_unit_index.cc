@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/temporal_unit_index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "iamf/common/macros.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/common/write_bit_buffer.h"
+
+namespace iamf_tools {
+
+namespace {
+
+absl::Status ReadInt64(ReadBitBuffer& rb, int64_t& output) {
+  uint64_t value;
+  RETURN_IF_NOT_OK(rb.ReadUnsignedLiteral(64, value));
+  output = static_cast<int64_t>(value);
+  return absl::OkStatus();
+}
+
+absl::Status WriteInt64(int64_t value, WriteBitBuffer& wb) {
+  return wb.WriteUnsignedLiteral64(static_cast<uint64_t>(value), 64);
+}
+
+}  // namespace
+
+absl::StatusOr<TemporalUnitIndex> TemporalUnitIndex::CreateFromBuffer(
+    ReadBitBuffer& rb) {
+  uint32_t index_code;
+  RETURN_IF_NOT_OK(rb.ReadUnsignedLiteral(32, index_code));
+  if (index_code != kIndexCode) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Unexpected index_code= ", index_code));
+  }
+  uint8_t version;
+  RETURN_IF_NOT_OK(rb.ReadUnsignedLiteral(8, version));
+  if (version != kVersion) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Unsupported index version= ", version));
+  }
+
+  // Rebuild the index through the builder, which validates each entry.
+  TemporalUnitIndexBuilder builder;
+  int64_t descriptor_obus_offset;
+  int64_t descriptor_obus_size;
+  RETURN_IF_NOT_OK(ReadInt64(rb, descriptor_obus_offset));
+  RETURN_IF_NOT_OK(ReadInt64(rb, descriptor_obus_size));
+  RETURN_IF_NOT_OK(
+      builder.SetDescriptorObus(descriptor_obus_offset, descriptor_obus_size));
+
+  int64_t num_temporal_units;
+  RETURN_IF_NOT_OK(ReadInt64(rb, num_temporal_units));
+  if (num_temporal_units < 0) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Invalid num_temporal_units= ", num_temporal_units));
+  }
+  for (int64_t i = 0; i < num_temporal_units; ++i) {
+    TemporalUnitIndexEntry entry;
+    RETURN_IF_NOT_OK(ReadInt64(rb, entry.start_timestamp));
+    RETURN_IF_NOT_OK(ReadInt64(rb, entry.offset));
+    RETURN_IF_NOT_OK(ReadInt64(rb, entry.size));
+    RETURN_IF_NOT_OK(builder.AddTemporalUnit(entry.start_timestamp,
+                                             entry.offset, entry.size));
+  }
+
+  return builder.GetIndex();
+}
+
+absl::StatusOr<TemporalUnitIndexEntry> TemporalUnitIndex::FindTemporalUnit(
+    int64_t timestamp) const {
+  // Find the first temporal unit which starts after `timestamp`; the one
+  // before it covers `timestamp`.
+  const auto next_temporal_unit = std::upper_bound(
+      temporal_units_.begin(), temporal_units_.end(), timestamp,
+      [](int64_t target, const TemporalUnitIndexEntry& entry) {
+        return target < entry.start_timestamp;
+      });
+  if (next_temporal_unit == temporal_units_.begin()) {
+    return absl::NotFoundError(absl::StrCat(
+        "No temporal unit starts at or before timestamp= ", timestamp));
+  }
+  return *std::prev(next_temporal_unit);
+}
+
+absl::Status TemporalUnitIndexBuilder::SetDescriptorObus(int64_t offset,
+                                                         int64_t size) {
+  if (offset < 0 || size < 0) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Invalid descriptor OBUs offset= ", offset, " size= ", size));
+  }
+  index_.descriptor_obus_offset_ = offset;
+  index_.descriptor_obus_size_ = size;
+  return absl::OkStatus();
+}
+
+absl::Status TemporalUnitIndexBuilder::AddTemporalUnit(int64_t start_timestamp,
+                                                       int64_t offset,
+                                                       int64_t size) {
+  if (offset < 0 || size < 0) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Invalid temporal unit offset= ", offset, " size= ", size));
+  }
+  if (!index_.temporal_units_.empty()) {
+    const TemporalUnitIndexEntry& previous = index_.temporal_units_.back();
+    if (start_timestamp <= previous.start_timestamp) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Temporal units must be added in increasing order of timestamp. "
+          "start_timestamp= ",
+          start_timestamp, " previous start_timestamp= ",
+          previous.start_timestamp));
+    }
+    if (offset < previous.offset + previous.size) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Temporal unit at offset= ", offset,
+          " overlaps the previous temporal unit which ends at offset= ",
+          previous.offset + previous.size));
+    }
+  }
+
+  index_.temporal_units_.push_back({.start_timestamp = start_timestamp,
+                                    .offset = offset,
+                                    .size = size});
+  return absl::OkStatus();
+}
+
+absl::Status TemporalUnitIndexBuilder::Write(WriteBitBuffer& wb) const {
+  RETURN_IF_NOT_OK(wb.WriteUnsignedLiteral(TemporalUnitIndex::kIndexCode, 32));
+  RETURN_IF_NOT_OK(wb.WriteUnsignedLiteral(TemporalUnitIndex::kVersion, 8));
+  RETURN_IF_NOT_OK(WriteInt64(index_.descriptor_obus_offset_, wb));
+  RETURN_IF_NOT_OK(WriteInt64(index_.descriptor_obus_size_, wb));
+  RETURN_IF_NOT_OK(WriteInt64(index_.temporal_units_.size(), wb));
+  for (const auto& entry : index_.temporal_units_) {
+    RETURN_IF_NOT_OK(WriteInt64(entry.start_timestamp, wb));
+    RETURN_IF_NOT_OK(WriteInt64(entry.offset, wb));
+    RETURN_IF_NOT_OK(WriteInt64(entry.size, wb));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace iamf_tools
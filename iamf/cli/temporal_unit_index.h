@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+
+#ifndef CLI_TEMPORAL_UNIT_INDEX_H_
+#define CLI_TEMPORAL_UNIT_INDEX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/common/write_bit_buffer.h"
+
+namespace iamf_tools {
+
+/*!\brief Location of a temporal unit within a standalone .iamf file. */
+struct TemporalUnitIndexEntry {
+  friend bool operator==(const TemporalUnitIndexEntry& lhs,
+                         const TemporalUnitIndexEntry& rhs) = default;
+
+  int64_t start_timestamp;
+  // Offset of the first byte of the temporal unit from the start of the file.
+  int64_t offset;
+  // Size of the temporal unit in bytes.
+  int64_t size;
+};
+
+/*!\brief Sidecar index of the temporal units in a standalone .iamf file.
+ *
+ * The index allows a parser to jump to the temporal unit which covers a given
+ * timestamp without parsing any of the preceding OBUs.
+ *
+ * The serialized index is byte-aligned and uses fixed-width big-endian fields:
+ *   - `index_code` (32 bits): "iaix".
+ *   - `version` (8 bits): 0.
+ *   - `descriptor_obus_offset` (64 bits).
+ *   - `descriptor_obus_size` (64 bits).
+ *   - `num_temporal_units` (64 bits).
+ *   - For each temporal unit, in increasing order of `start_timestamp`:
+ *     - `start_timestamp` (64 bits, two's complement).
+ *     - `offset` (64 bits).
+ *     - `size` (64 bits).
+ */
+class TemporalUnitIndex {
+ public:
+  static constexpr uint32_t kIndexCode = 0x69616978;  // "iaix".
+  static constexpr uint8_t kVersion = 0;
+
+  /*!\brief Creates a `TemporalUnitIndex` from a `ReadBitBuffer`.
+   *
+   * \param rb Buffer holding a serialized index. Data read from the buffer is
+   *        consumed.
+   * \return `TemporalUnitIndex` on success. `absl::InvalidArgumentError()` if
+   *         the index is malformed. A specific status on failure.
+   */
+  static absl::StatusOr<TemporalUnitIndex> CreateFromBuffer(ReadBitBuffer& rb);
+
+  /*!\brief Finds the temporal unit which covers the requested timestamp.
+   *
+   * Runs in O(log n) in the number of temporal units.
+   *
+   * \param timestamp Timestamp to look up.
+   * \return The last temporal unit which starts at or before `timestamp`.
+   *         `absl::NotFoundError()` if `timestamp` is before the first
+   *         temporal unit.
+   */
+  absl::StatusOr<TemporalUnitIndexEntry> FindTemporalUnit(
+      int64_t timestamp) const;
+
+  /*!\brief Gets the offset of the descriptor OBUs in bytes. */
+  int64_t GetDescriptorObusOffset() const { return descriptor_obus_offset_; }
+
+  /*!\brief Gets the size of the descriptor OBUs in bytes. */
+  int64_t GetDescriptorObusSize() const { return descriptor_obus_size_; }
+
+  /*!\brief Gets all temporal units in increasing order of `start_timestamp`.
+   */
+  const std::vector<TemporalUnitIndexEntry>& GetTemporalUnits() const {
+    return temporal_units_;
+  }
+
+ private:
+  friend class TemporalUnitIndexBuilder;
+
+  TemporalUnitIndex() = default;
+
+  int64_t descriptor_obus_offset_ = 0;
+  int64_t descriptor_obus_size_ = 0;
+  std::vector<TemporalUnitIndexEntry> temporal_units_;
+};
+
+/*!\brief Builds a `TemporalUnitIndex` as an IA Sequence is written.
+ *
+ * Adding a temporal unit only appends a fixed-size entry, so an index can be
+ * built while writing a file at negligible cost.
+ */
+class TemporalUnitIndexBuilder {
+ public:
+  /*!\brief Records the location of the descriptor OBUs.
+   *
+   * \param offset Offset of the descriptor OBUs in bytes.
+   * \param size Size of the descriptor OBUs in bytes.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the arguments are negative.
+   */
+  absl::Status SetDescriptorObus(int64_t offset, int64_t size);
+
+  /*!\brief Records the location of the next temporal unit.
+   *
+   * \param start_timestamp Start timestamp of the temporal unit.
+   * \param offset Offset of the temporal unit in bytes.
+   * \param size Size of the temporal unit in bytes.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the temporal unit does not start after the previous one, either
+   *         in time or in the file.
+   */
+  absl::Status AddTemporalUnit(int64_t start_timestamp, int64_t offset,
+                               int64_t size);
+
+  /*!\brief Gets the index built so far. */
+  const TemporalUnitIndex& GetIndex() const { return index_; }
+
+  /*!\brief Writes the index built so far.
+   *
+   * \param wb Buffer to write to.
+   * \return `absl::OkStatus()` on success. A specific status on failure.
+   */
+  absl::Status Write(WriteBitBuffer& wb) const;
+
+ private:
+  TemporalUnitIndex index_;
+};
+
+}  // namespace iamf_tools
+
+#endif  // CLI_TEMPORAL_UNIT_INDEX_H_
@@ -12,6 +12,7 @@
 #include "iamf/cli/audio_frame_decoder.h"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -156,11 +157,12 @@ TEST(Decode, DecodesLpcmFrame) {
   // For LPCM, the input bytes are all zeros, but we expect the decoder to
   // combine kBytesPerSample bytes each into one int32_t sample.
   // There are kNumSamplesPerFrame samples in the frame.
-  EXPECT_EQ(decoded_audio_frame->decoded_samples.size(), kNumSamplesPerFrame);
-  for (const std::vector<int32_t>& samples_for_one_time_tick :
-       decoded_audio_frame->decoded_samples) {
-    EXPECT_EQ(samples_for_one_time_tick.size(), kNumChannels);
-    for (int32_t sample : samples_for_one_time_tick) {
+  EXPECT_EQ(decoded_audio_frame->decoded_samples.num_ticks(),
+            kNumSamplesPerFrame);
+  EXPECT_EQ(decoded_audio_frame->decoded_samples.num_channels(), kNumChannels);
+  for (size_t c = 0; c < decoded_audio_frame->decoded_samples.num_channels();
+       ++c) {
+    for (int32_t sample : decoded_audio_frame->decoded_samples.Channel(c)) {
       EXPECT_EQ(sample, 0);
     }
   }
@@ -207,7 +209,8 @@ TEST(Decode, DecodesFlacFrame) {
       {0x00000000, 0x00000000},
       {0x00000000, 0x00000000},
       {0x00000000, 0x00000000}};
-  EXPECT_EQ(decoded_audio_frame->decoded_samples, kExpectedDecodedSamples);
+  EXPECT_EQ(decoded_audio_frame->decoded_samples.ToTimeChannel(),
+            kExpectedDecodedSamples);
 }
 
 TEST(Decode, DecodesMultipleFlacFrames) {
@@ -48,6 +48,7 @@
 #include "iamf/cli/user_metadata_builder/audio_element_metadata_builder.h"
 #include "iamf/cli/user_metadata_builder/iamf_input_layout.h"
 #include "iamf/cli/wav_reader.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/decoder_config/aac_decoder_config.h"
@@ -357,6 +358,14 @@ WavReader CreateWavReaderExpectOk(const std::string& filename,
   return std::move(*wav_reader);
 }
 
+PlanarSampleBuffer<int32_t> MakePlanarSamplesExpectOk(
+    const std::vector<std::vector<int32_t>>& time_channel_samples) {
+  auto samples = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+      absl::MakeConstSpan(time_channel_samples));
+  EXPECT_THAT(samples, IsOk());
+  return std::move(*samples);
+}
+
 void RenderAndFlushExpectOk(const LabeledFrame& labeled_frame,
                             AudioElementRendererBase* renderer,
                             std::vector<InternalSampleType>& output_samples) {
@@ -38,6 +38,7 @@
 #include "iamf/cli/user_metadata_builder/iamf_input_layout.h"
 #include "iamf/cli/wav_reader.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/mix_presentation.h"
@@ -195,6 +196,15 @@ void AddReconGainParamDefinition(
 WavReader CreateWavReaderExpectOk(const std::string& filename,
                                   int num_samples_per_frame = 1);
 
+/*!\brief Creates a planar buffer from samples in (time, channel) axes.
+ *
+ * \param time_channel_samples Samples to copy. All ticks must have the same
+ *        number of channels.
+ * \return Unwrapped buffer created by `PlanarSampleBuffer::FromTimeChannel`.
+ */
+PlanarSampleBuffer<int32_t> MakePlanarSamplesExpectOk(
+    const std::vector<std::vector<int32_t>>& time_channel_samples);
+
 /*!\brief Renders the `LabeledFrame` flushes to the output vector.
  *
  * \param labeled_frame Labeled frame to render.
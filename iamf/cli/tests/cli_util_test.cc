@@ -62,8 +62,9 @@ constexpr std::array<DecodedUleb128, 1> kZerothOrderAmbisonicsSubstreamId{
 
 TEST(WritePcmFrameToBuffer, ResizesOutputBuffer) {
   const size_t kExpectedSize = 12;  // 3 bytes per sample * 4 samples.
-  std::vector<std::vector<int32_t>> frame_to_write = {{0x7f000000, 0x7e000000},
-                                                      {0x7f000000, 0x7e000000}};
+  const auto frame_to_write =
+      MakePlanarSamplesExpectOk({{0x7f000000, 0x7e000000},
+                                 {0x7f000000, 0x7e000000}});
   const uint8_t kBitDepth = 24;
   const uint32_t kSamplesToTrimAtStart = 0;
   const uint32_t kSamplesToTrimAtEnd = 0;
@@ -78,8 +79,9 @@ TEST(WritePcmFrameToBuffer, ResizesOutputBuffer) {
 }
 
 TEST(WritePcmFrameToBuffer, WritesBigEndian) {
-  std::vector<std::vector<int32_t>> frame_to_write = {{0x7f001200, 0x7e003400},
-                                                      {0x7f005600, 0x7e007800}};
+  const auto frame_to_write =
+      MakePlanarSamplesExpectOk({{0x7f001200, 0x7e003400},
+                                 {0x7f005600, 0x7e007800}});
   const uint8_t kBitDepth = 24;
   const uint32_t kSamplesToTrimAtStart = 0;
   const uint32_t kSamplesToTrimAtEnd = 0;
@@ -96,8 +98,9 @@ TEST(WritePcmFrameToBuffer, WritesBigEndian) {
 }
 
 TEST(WritePcmFrameToBuffer, WritesLittleEndian) {
-  std::vector<std::vector<int32_t>> frame_to_write = {{0x7f001200, 0x7e003400},
-                                                      {0x7f005600, 0x7e007800}};
+  const auto frame_to_write =
+      MakePlanarSamplesExpectOk({{0x7f001200, 0x7e003400},
+                                 {0x7f005600, 0x7e007800}});
   const uint8_t kBitDepth = 24;
   const uint32_t kSamplesToTrimAtStart = 0;
   const uint32_t kSamplesToTrimAtEnd = 0;
@@ -114,8 +117,9 @@ TEST(WritePcmFrameToBuffer, WritesLittleEndian) {
 }
 
 TEST(WritePcmFrameToBuffer, TrimsSamples) {
-  std::vector<std::vector<int32_t>> frame_to_write = {{0x7f001200, 0x7e003400},
-                                                      {0x7f005600, 0x7e007800}};
+  const auto frame_to_write =
+      MakePlanarSamplesExpectOk({{0x7f001200, 0x7e003400},
+                                 {0x7f005600, 0x7e007800}});
   const uint8_t kBitDepth = 24;
   const uint32_t kSamplesToTrimAtStart = 1;
   const uint32_t kSamplesToTrimAtEnd = 0;
@@ -132,8 +136,9 @@ TEST(WritePcmFrameToBuffer, TrimsSamples) {
 }
 
 TEST(WritePcmFrameToBuffer, RequiresBitDepthIsMultipleOfEight) {
-  std::vector<std::vector<int32_t>> frame_to_write = {{0x7f001200, 0x7e003400},
-                                                      {0x7f005600, 0x7e007800}};
+  const auto frame_to_write =
+      MakePlanarSamplesExpectOk({{0x7f001200, 0x7e003400},
+                                 {0x7f005600, 0x7e007800}});
   const uint8_t kBitDepth = 23;
   const uint32_t kSamplesToTrimAtStart = 0;
   const uint32_t kSamplesToTrimAtEnd = 0;
@@ -14,7 +14,6 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
-#include <iterator>
 #include <list>
 #include <optional>
 #include <utility>
@@ -33,6 +32,7 @@
 #include "iamf/cli/proto/user_metadata.pb.h"
 #include "iamf/cli/tests/cli_test_utils.h"
 #include "iamf/common/obu_util.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/audio_frame.h"
 #include "iamf/obu/codec_config.h"
@@ -306,7 +306,7 @@ TEST(DemixAudioSamples, OutputContainsOriginalAndDemixedSamples) {
                         .end_timestamp = kEndTimestamp,
                         .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                         .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                        .decoded_samples = {{0}},
+                        .decoded_samples = MakePlanarSamplesExpectOk({{0}}),
                         .down_mixing_params = DownMixingParams()});
   decoded_audio_frames.push_back(
       DecodedAudioFrame{.substream_id = kL2SubstreamId,
@@ -314,7 +314,7 @@ TEST(DemixAudioSamples, OutputContainsOriginalAndDemixedSamples) {
                         .end_timestamp = kEndTimestamp,
                         .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                         .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                        .decoded_samples = {{0}},
+                        .decoded_samples = MakePlanarSamplesExpectOk({{0}}),
                         .down_mixing_params = DownMixingParams()});
   DemixingModule demixing_module;
   EXPECT_THAT(demixing_module.InitializeForReconstruction(audio_elements),
@@ -356,7 +356,7 @@ TEST(DemixAudioSamples, OutputEchoesTimingInformation) {
       .end_timestamp = kExpectedEndTimestamp,
       .samples_to_trim_at_end = kExpectedNumSamplesToTrimAtEnd,
       .samples_to_trim_at_start = kExpectedNumSamplesToTrimAtStart,
-      .decoded_samples = {{0}},
+      .decoded_samples = MakePlanarSamplesExpectOk({{0}}),
       .down_mixing_params = DownMixingParams()});
   decoded_audio_frames.push_back(DecodedAudioFrame{
       .substream_id = kL2SubstreamId,
@@ -364,7 +364,7 @@ TEST(DemixAudioSamples, OutputEchoesTimingInformation) {
       .end_timestamp = kExpectedEndTimestamp,
       .samples_to_trim_at_end = kExpectedNumSamplesToTrimAtEnd,
       .samples_to_trim_at_start = kExpectedNumSamplesToTrimAtStart,
-      .decoded_samples = {{0}},
+      .decoded_samples = MakePlanarSamplesExpectOk({{0}}),
       .down_mixing_params = DownMixingParams()});
   DemixingModule demixing_module;
   EXPECT_THAT(demixing_module.InitializeForReconstruction(audio_elements),
@@ -398,7 +398,8 @@ TEST(DemixAudioSamples, OutputEchoesOriginalLabels) {
                         .end_timestamp = kEndTimestamp,
                         .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                         .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                        .decoded_samples = {{1}, {2}, {3}},
+                        .decoded_samples =
+                            MakePlanarSamplesExpectOk({{1}, {2}, {3}}),
                         .down_mixing_params = DownMixingParams()});
   decoded_audio_frames.push_back(
       DecodedAudioFrame{.substream_id = kL2SubstreamId,
@@ -406,7 +407,8 @@ TEST(DemixAudioSamples, OutputEchoesOriginalLabels) {
                         .end_timestamp = kEndTimestamp,
                         .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                         .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                        .decoded_samples = {{9}, {10}, {11}},
+                        .decoded_samples =
+                            MakePlanarSamplesExpectOk({{9}, {10}, {11}}),
                         .down_mixing_params = DownMixingParams()});
   DemixingModule demixing_module;
   EXPECT_THAT(demixing_module.InitializeForReconstruction(audio_elements),
@@ -446,7 +448,7 @@ TEST(DemixAudioSamples, OutputHasReconstructedLayers) {
                         .end_timestamp = kEndTimestamp,
                         .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                         .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                        .decoded_samples = {{750}},
+                        .decoded_samples = MakePlanarSamplesExpectOk({{750}}),
                         .down_mixing_params = DownMixingParams()});
   decoded_audio_frames.push_back(
       DecodedAudioFrame{.substream_id = kL2SubstreamId,
@@ -454,7 +456,7 @@ TEST(DemixAudioSamples, OutputHasReconstructedLayers) {
                         .end_timestamp = kEndTimestamp,
                         .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                         .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                        .decoded_samples = {{1000}},
+                        .decoded_samples = MakePlanarSamplesExpectOk({{1000}}),
                         .down_mixing_params = DownMixingParams()});
   DemixingModule demixing_module;
   EXPECT_THAT(demixing_module.InitializeForReconstruction(audio_elements),
@@ -491,7 +493,7 @@ TEST(DemixAudioSamples, OutputContainsReconGainAndLayerInfo) {
       .end_timestamp = kEndTimestamp,
       .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
       .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-      .decoded_samples = {{0}},
+      .decoded_samples = MakePlanarSamplesExpectOk({{0}}),
       .down_mixing_params = DownMixingParams(),
       .recon_gain_info_parameter_data = recon_gain_info_parameter_data,
       .audio_element_with_data = &audio_elements.at(kAudioElementId)});
@@ -501,7 +503,7 @@ TEST(DemixAudioSamples, OutputContainsReconGainAndLayerInfo) {
       .end_timestamp = kEndTimestamp,
       .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
       .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-      .decoded_samples = {{0}},
+      .decoded_samples = MakePlanarSamplesExpectOk({{0}}),
       .down_mixing_params = DownMixingParams(),
       .recon_gain_info_parameter_data = recon_gain_info_parameter_data,
       .audio_element_with_data = &audio_elements.at(kAudioElementId)});
@@ -598,14 +600,14 @@ class DownMixingModuleTest : public DemixingModuleTestBase,
                     input_label_to_samples_, substream_id_to_substream_data_),
                 IsOk());
 
-    for (const auto& [substream_id, substream_data] :
+    for (auto& [substream_id, substream_data] :
          substream_id_to_substream_data_) {
-      // Copy the output queue to a vector for comparison.
-      std::vector<std::vector<int32_t>> output_samples;
-      std::copy(substream_data.samples_obu.begin(),
-                substream_data.samples_obu.end(),
-                std::back_inserter(output_samples));
-      EXPECT_EQ(output_samples,
+      // Pop the output queue to a vector for comparison.
+      PlanarSampleBuffer<int32_t> output_samples;
+      EXPECT_THAT(substream_data.samples_obu.PopFront(
+                      substream_data.samples_obu.size(), output_samples),
+                  IsOk());
+      EXPECT_EQ(output_samples.ToTimeChannel(),
                 substream_id_to_expected_samples_[substream_id]);
     }
   }
@@ -628,8 +630,10 @@ class DownMixingModuleTest : public DemixingModuleTestBase,
     const uint32_t substream_id = substream_id_to_labels_.size();
 
     substream_id_to_labels_[substream_id] = requested_output_labels;
-    substream_id_to_substream_data_[substream_id] = {.substream_id =
-                                                         substream_id};
+    substream_id_to_substream_data_[substream_id] = {
+        .substream_id = substream_id,
+        .samples_obu = {requested_output_labels.size(), 0},
+        .samples_encode = {requested_output_labels.size(), 0}};
 
     substream_id_to_expected_samples_[substream_id] = expected_output_smples;
   }
@@ -965,7 +969,7 @@ class DemixingModuleTest : public DemixingModuleTestBase,
         .obu = AudioFrameObu(ObuHeader(), substream_id, {}),
         .start_timestamp = kStartTimestamp,
         .end_timestamp = kEndTimestamp,
-        .pcm_samples = pcm_samples,
+        .pcm_samples = MakePlanarSamplesExpectOk(pcm_samples),
         .down_mixing_params = down_mixing_params,
     });
 
@@ -975,7 +979,8 @@ class DemixingModuleTest : public DemixingModuleTestBase,
                           .end_timestamp = kEndTimestamp,
                           .samples_to_trim_at_end = kZeroSamplesToTrimAtEnd,
                           .samples_to_trim_at_start = kZeroSamplesToTrimAtStart,
-                          .decoded_samples = pcm_samples,
+                          .decoded_samples =
+                              MakePlanarSamplesExpectOk(pcm_samples),
                           .down_mixing_params = down_mixing_params});
 
     auto& expected_label_to_samples =
@@ -1094,6 +1099,29 @@ TEST_F(DemixingModuleTest, S1ToS2Demixer) {
   TestDemixing(1);
 }
 
+TEST_F(DemixingModuleTest,
+       DemixOriginalAudioSamplesMatchesOriginalOutputOfDemixAudioSamples) {
+  ConfigureAudioFrameMetadata({kL2, kR2});
+  ConfigureLosslessAudioFrameAndDecodedAudioFrame({kMono}, {{750}, {1500}});
+  ConfigureLosslessAudioFrameAndDecodedAudioFrame({kL2}, {{1000}, {2000}});
+  TestCreateDemixingModule(1);
+  IdLabeledFrameMap expected_id_to_labeled_frame,
+      unused_id_to_labeled_decoded_frame;
+  ASSERT_THAT(demixing_module_.DemixAudioSamples(
+                  audio_frames_, decoded_audio_frames_,
+                  expected_id_to_labeled_frame,
+                  unused_id_to_labeled_decoded_frame),
+              IsOk());
+
+  IdLabeledFrameMap id_to_labeled_frame;
+  EXPECT_THAT(demixing_module_.DemixOriginalAudioSamples(audio_frames_,
+                                                         id_to_labeled_frame),
+              IsOk());
+
+  EXPECT_EQ(id_to_labeled_frame.at(kAudioElementId).label_to_samples,
+            expected_id_to_labeled_frame.at(kAudioElementId).label_to_samples);
+}
+
 TEST_F(DemixingModuleTest,
        DemixAudioSamplesReturnsErrorIfAudioFrameIsMissingPcmSamples) {
   ConfigureAudioFrameMetadata({kL2, kR2});
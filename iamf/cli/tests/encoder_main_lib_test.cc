@@ -14,16 +14,21 @@
 #include <cstdint>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 // [internal] Placeholder for get runfiles header.
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/status_matchers.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "iamf/cli/proto/arbitrary_obu.pb.h"
 #include "iamf/cli/proto/codec_config.pb.h"
+#include "iamf/cli/proto/encoder_control_metadata.pb.h"
 #include "iamf/cli/proto/ia_sequence_header.pb.h"
+#include "iamf/cli/proto/obu_header.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
 #include "iamf/cli/proto/user_metadata.pb.h"
 #include "iamf/cli/tests/cli_test_utils.h"
@@ -33,6 +38,9 @@ namespace iamf_tools {
 namespace {
 
 using ::absl_testing::IsOk;
+using ::absl_testing::StatusIs;
+using ::testing::HasSubstr;
+using ::testing::SizeIs;
 constexpr absl::string_view kIgnoredOutputPath = "";
 
 void AddIaSequenceHeader(iamf_tools_cli_proto::UserMetadata& user_metadata) {
@@ -166,6 +174,243 @@ TEST(EncoderMainLibTest, CreatesAndWritesToOutputIamfDirectory) {
   EXPECT_TRUE(std::filesystem::exists(output_iamf_directory / "empty.iamf"));
 }
 
+TEST(ParseEncoderJobManifest, ParsesOneJobPerLine) {
+  const auto jobs = ParseEncoderJobManifest(
+      "# Comment.\n"
+      "a.textproto\twav_a\tout_a\n"
+      "\n"
+      "b.binpb\twav_b\tout_b\r\n");
+  ASSERT_THAT(jobs, IsOk());
+
+  ASSERT_THAT(*jobs, SizeIs(2));
+  EXPECT_EQ((*jobs)[0].user_metadata_filename, "a.textproto");
+  EXPECT_EQ((*jobs)[0].input_wav_directory, "wav_a");
+  EXPECT_EQ((*jobs)[0].output_iamf_directory, "out_a");
+  EXPECT_EQ((*jobs)[1].user_metadata_filename, "b.binpb");
+  EXPECT_EQ((*jobs)[1].input_wav_directory, "wav_b");
+  EXPECT_EQ((*jobs)[1].output_iamf_directory, "out_b");
+}
+
+TEST(ParseEncoderJobManifest, KeepsSpacesInPaths) {
+  const auto jobs = ParseEncoderJobManifest(
+      "my programme/a.textproto\tinput wavs\t output iamf \n");
+  ASSERT_THAT(jobs, IsOk());
+
+  ASSERT_THAT(*jobs, SizeIs(1));
+  EXPECT_EQ((*jobs)[0].user_metadata_filename, "my programme/a.textproto");
+  EXPECT_EQ((*jobs)[0].input_wav_directory, "input wavs");
+  EXPECT_EQ((*jobs)[0].output_iamf_directory, " output iamf ");
+}
+
+TEST(ParseEncoderJobManifest, InvalidWhenALineDoesNotHaveThreeFields) {
+  EXPECT_THAT(ParseEncoderJobManifest("a.textproto\twav_a\tout_a\n"
+                                      "b.textproto\twav_b\n"),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(
+      ParseEncoderJobManifest("a.textproto\twav_a\tout_a\textra\n"),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+  // Spaces do not separate fields.
+  EXPECT_THAT(ParseEncoderJobManifest("a.textproto wav_a out_a\n"),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ParseEncoderJobManifest, InvalidWhenAFieldIsEmpty) {
+  EXPECT_THAT(ParseEncoderJobManifest("a.textproto\t\tout_a\n"),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(BatchMain, ReportsResultOfEachJobInOrder) {
+  const auto testdata_dir =
+      std::filesystem::current_path() / std::string("iamf/cli/testdata");
+  const std::filesystem::path output_directory =
+      GetAndCreateOutputDirectory("");
+  const std::vector<EncoderJob> jobs = {
+      {(testdata_dir / "test_000002.textproto").string(),
+       testdata_dir.string(), (output_directory / "valid_0").string()},
+      {(testdata_dir / "missing.textproto").string(), testdata_dir.string(),
+       (output_directory / "missing").string()},
+      {(testdata_dir / "test_000000_3.textproto").string(),
+       testdata_dir.string(), (output_directory / "invalid").string()},
+      {(testdata_dir / "test_000012.textproto").string(),
+       testdata_dir.string(), (output_directory / "valid_1").string()}};
+
+  const auto results = BatchMain(jobs, /*num_workers=*/2);
+
+  ASSERT_THAT(results, SizeIs(jobs.size()));
+  EXPECT_THAT(results[0].status, IsOk());
+  EXPECT_TRUE(results[0].expected_to_succeed);
+  EXPECT_THAT(results[1].status,
+              StatusIs(absl::StatusCode::kFailedPrecondition));
+  EXPECT_FALSE(results[1].expected_to_succeed);
+  EXPECT_FALSE(results[2].status.ok());
+  EXPECT_FALSE(results[2].expected_to_succeed);
+  EXPECT_THAT(results[3].status, IsOk());
+  EXPECT_TRUE(results[3].expected_to_succeed);
+}
+
+// Encoding concurrently with other jobs must not change the output file.
+TEST(BatchMain, WritesSameFileAsTestMain) {
+  const auto testdata_dir =
+      std::filesystem::current_path() / std::string("iamf/cli/testdata");
+  const auto user_metadata_filename = testdata_dir / "test_000002.textproto";
+  iamf_tools_cli_proto::UserMetadata user_metadata;
+  ParseUserMetadataAssertSuccess(user_metadata_filename.string(),
+                                 user_metadata);
+  const std::string output_iamf_filename = absl::StrCat(
+      user_metadata.test_vector_metadata().file_name_prefix(), ".iamf");
+  const std::filesystem::path output_directory =
+      GetAndCreateOutputDirectory("");
+  ASSERT_THAT(TestMain(user_metadata, testdata_dir.string(),
+                       (output_directory / "test_main").string()),
+              IsOk());
+  std::vector<EncoderJob> jobs;
+  for (int i = 0; i < 4; ++i) {
+    jobs.push_back({user_metadata_filename.string(), testdata_dir.string(),
+                    (output_directory / absl::StrCat("batch_", i)).string()});
+  }
+
+  const auto results = BatchMain(jobs, /*num_workers=*/4);
+
+  std::vector<uint8_t> expected_bytes;
+  ASSERT_THAT(ReadFileToBytes(output_directory / "test_main" /
+                                  output_iamf_filename,
+                              expected_bytes),
+              IsOk());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_THAT(results[i].status, IsOk());
+    std::vector<uint8_t> batch_bytes;
+    ASSERT_THAT(ReadFileToBytes(output_directory / absl::StrCat("batch_", i) /
+                                    output_iamf_filename,
+                                batch_bytes),
+                IsOk());
+    EXPECT_EQ(batch_bytes, expected_bytes);
+  }
+}
+
+// Resetting an encoder for a later job must not change the output file.
+TEST(BatchMain, ReusesEncoderForJobsWithTheSameUserMetadata) {
+  const auto testdata_dir =
+      std::filesystem::current_path() / std::string("iamf/cli/testdata");
+  const auto user_metadata_filename = testdata_dir / "test_000012.textproto";
+  iamf_tools_cli_proto::UserMetadata user_metadata;
+  ParseUserMetadataAssertSuccess(user_metadata_filename.string(),
+                                 user_metadata);
+  const std::string output_iamf_filename = absl::StrCat(
+      user_metadata.test_vector_metadata().file_name_prefix(), ".iamf");
+  const std::filesystem::path output_directory =
+      GetAndCreateOutputDirectory("");
+  ASSERT_THAT(TestMain(user_metadata, testdata_dir.string(),
+                       (output_directory / "test_main").string()),
+              IsOk());
+  const std::vector<EncoderJob> jobs = {
+      {user_metadata_filename.string(), testdata_dir.string(),
+       (output_directory / "batch_0").string()},
+      {user_metadata_filename.string(), testdata_dir.string(),
+       (output_directory / "batch_1").string()},
+      {user_metadata_filename.string(), testdata_dir.string(),
+       (output_directory / "batch_2").string()},
+      {(testdata_dir / "test_000002.textproto").string(),
+       testdata_dir.string(), (output_directory / "other").string()}};
+
+  // With one worker the jobs run in order.
+  const auto results = BatchMain(jobs, /*num_workers=*/1);
+
+  ASSERT_THAT(results, SizeIs(jobs.size()));
+  for (const auto& result : results) {
+    EXPECT_THAT(result.status, IsOk());
+  }
+  EXPECT_FALSE(results[0].reused_encoder);
+  EXPECT_TRUE(results[1].reused_encoder);
+  EXPECT_TRUE(results[2].reused_encoder);
+  // Different user metadata needs a new encoder.
+  EXPECT_FALSE(results[3].reused_encoder);
+  std::vector<uint8_t> expected_bytes;
+  ASSERT_THAT(ReadFileToBytes(output_directory / "test_main" /
+                                  output_iamf_filename,
+                              expected_bytes),
+              IsOk());
+  for (const auto* batch_directory : {"batch_0", "batch_1", "batch_2"}) {
+    std::vector<uint8_t> batch_bytes;
+    ASSERT_THAT(ReadFileToBytes(output_directory / batch_directory /
+                                    output_iamf_filename,
+                                batch_bytes),
+                IsOk());
+    EXPECT_EQ(batch_bytes, expected_bytes);
+  }
+}
+
+using PipelinedTestVector = ::testing::TestWithParam<absl::string_view>;
+
+// Pipelining the encoder must not change the output file.
+TEST_P(PipelinedTestVector, WritesSameFileAsSingleThreadedEncoder) {
+  const auto textproto_filename = GetParam();
+  const auto input_wav_dir =
+      std::filesystem::current_path() / std::string("iamf/cli/testdata");
+  iamf_tools_cli_proto::UserMetadata user_metadata;
+  ParseUserMetadataAssertSuccess(
+      (input_wav_dir / textproto_filename).string(), user_metadata);
+  const std::string output_iamf_filename = absl::StrCat(
+      user_metadata.test_vector_metadata().file_name_prefix(), ".iamf");
+  const std::filesystem::path single_threaded_directory =
+      GetAndCreateOutputDirectory("_single_threaded");
+  const std::filesystem::path pipelined_directory =
+      GetAndCreateOutputDirectory("_pipelined");
+
+  ASSERT_THAT(TestMain(user_metadata, input_wav_dir.string().c_str(),
+                       single_threaded_directory.string()),
+              IsOk());
+  user_metadata.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      2);
+  ASSERT_THAT(TestMain(user_metadata, input_wav_dir.string().c_str(),
+                       pipelined_directory.string()),
+              IsOk());
+
+  std::vector<uint8_t> single_threaded_bytes;
+  ASSERT_THAT(
+      ReadFileToBytes(single_threaded_directory / output_iamf_filename,
+                      single_threaded_bytes),
+      IsOk());
+  std::vector<uint8_t> pipelined_bytes;
+  ASSERT_THAT(ReadFileToBytes(pipelined_directory / output_iamf_filename,
+                              pipelined_bytes),
+              IsOk());
+  EXPECT_EQ(pipelined_bytes, single_threaded_bytes);
+}
+
+TEST(TestMain, PipelinedEncoderReturnsTheErrorOfTheOutputStage) {
+  const auto input_wav_dir =
+      std::filesystem::current_path() / std::string("iamf/cli/testdata");
+  iamf_tools_cli_proto::UserMetadata user_metadata;
+  ParseUserMetadataAssertSuccess(
+      (input_wav_dir / "test_000002.textproto").string(), user_metadata);
+  user_metadata.mutable_test_vector_metadata()->clear_file_name_prefix();
+  user_metadata.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      1);
+  // The output stage fails to write this OBU with the first temporal unit,
+  // while the input stage still has more temporal units to add.
+  auto& arbitrary_obu_metadata = *user_metadata.add_arbitrary_obu_metadata();
+  arbitrary_obu_metadata.set_insertion_hook(
+      iamf_tools_cli_proto::INSERTION_HOOK_AFTER_AUDIO_FRAMES_AT_TICK);
+  arbitrary_obu_metadata.set_insertion_tick(0);
+  arbitrary_obu_metadata.set_obu_type(iamf_tools_cli_proto::OBU_IA_RESERVED_24);
+  arbitrary_obu_metadata.mutable_obu_header()->set_obu_trimming_status_flag(
+      true);
+
+  EXPECT_THAT(TestMain(user_metadata, input_wav_dir.string(),
+                       std::string(kIgnoredOutputPath)),
+              StatusIs(absl::StatusCode::kInvalidArgument,
+                       HasSubstr("trimming status flag")));
+}
+
+INSTANTIATE_TEST_SUITE_P(NopParamBlock, PipelinedTestVector,
+                         testing::Values("test_000002.textproto"));
+
+INSTANTIATE_TEST_SUITE_P(UserRequestedTrimAtEnd, PipelinedTestVector,
+                         testing::Values("test_000012.textproto"));
+
+INSTANTIATE_TEST_SUITE_P(ParameterBlockStream, PipelinedTestVector,
+                         testing::Values("test_000019.textproto"));
+
 using TestVector = ::testing::TestWithParam<absl::string_view>;
 
 // Validate the "is_valid" field in a test vector textproto file is consistent
@@ -12,6 +12,7 @@
 #include "iamf/cli/global_timing_module.h"
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -74,10 +75,11 @@ class GlobalTimingModuleTest : public ::testing::Test {
 
   void TestGetNextAudioFrameStamps(
       DecodedUleb128 substream_id, uint32_t duration,
-      int32_t expected_start_timestamp, int32_t expected_end_timestamp,
+      InternalTimestamp expected_start_timestamp,
+      InternalTimestamp expected_end_timestamp,
       absl::StatusCode expected_status_code = absl::StatusCode::kOk) {
-    int32_t start_timestamp;
-    int32_t end_timestamp;
+    InternalTimestamp start_timestamp;
+    InternalTimestamp end_timestamp;
     EXPECT_EQ(global_timing_module_
                   ->GetNextAudioFrameTimestamps(substream_id, duration,
                                                 start_timestamp, end_timestamp)
@@ -87,13 +89,12 @@ class GlobalTimingModuleTest : public ::testing::Test {
     EXPECT_EQ(end_timestamp, expected_end_timestamp);
   }
 
-  void TestGetNextParameterBlockTimestamps(DecodedUleb128 parameter_id,
-                                           int32_t input_start_timestamp,
-                                           uint32_t duration,
-                                           int32_t expected_start_timestamp,
-                                           int32_t expected_end_timestamp) {
-    int32_t start_timestamp;
-    int32_t end_timestamp;
+  void TestGetNextParameterBlockTimestamps(
+      DecodedUleb128 parameter_id, InternalTimestamp input_start_timestamp,
+      uint32_t duration, InternalTimestamp expected_start_timestamp,
+      InternalTimestamp expected_end_timestamp) {
+    InternalTimestamp start_timestamp;
+    InternalTimestamp end_timestamp;
     EXPECT_THAT(global_timing_module_->GetNextParameterBlockTimestamps(
                     parameter_id, input_start_timestamp, duration,
                     start_timestamp, end_timestamp),
@@ -125,6 +126,26 @@ TEST_F(GlobalTimingModuleTest, OneSubstream) {
   TestGetNextAudioFrameStamps(kFirstAudioFrameId, 128, 256, 384);
 }
 
+TEST_F(GlobalTimingModuleTest, TimestampsDoNotOverflowPast32Bits) {
+  AddLpcmCodecConfigWithIdAndSampleRate(kCodecConfigId, kSampleRate,
+                                        codec_config_obus_);
+  AddAmbisonicsMonoAudioElementWithSubstreamIds(
+      kFirstAudioElementId, kCodecConfigId, {kFirstAudioFrameId},
+      codec_config_obus_, audio_elements_);
+  EXPECT_THAT(Initialize(), IsOk());
+  constexpr uint32_t kMaxDuration = std::numeric_limits<uint32_t>::max();
+  constexpr InternalTimestamp kMaxDurationTimestamp = kMaxDuration;
+
+  // A single session may run for longer than 32-bit timestamps allow.
+  TestGetNextAudioFrameStamps(kFirstAudioFrameId, kMaxDuration, 0,
+                              kMaxDurationTimestamp);
+  TestGetNextAudioFrameStamps(kFirstAudioFrameId, kMaxDuration,
+                              kMaxDurationTimestamp, 2 * kMaxDurationTimestamp);
+  TestGetNextAudioFrameStamps(kFirstAudioFrameId, 128,
+                              2 * kMaxDurationTimestamp,
+                              2 * kMaxDurationTimestamp + 128);
+}
+
 TEST_F(GlobalTimingModuleTest, InvalidUnknownSubstreamId) {
   constexpr DecodedUleb128 kSubstreamId = 9999;
   constexpr DecodedUleb128 kUnknownSubstreamId = 10000;
@@ -189,6 +210,25 @@ TEST_F(GlobalTimingModuleTest, OneParameterId) {
   TestGetNextParameterBlockTimestamps(kFirstParameterId, 128, 64, 128, 192);
 }
 
+TEST_F(GlobalTimingModuleTest, ResetStartsAllTimestampsOverAtZero) {
+  AddLpcmCodecConfigWithIdAndSampleRate(kCodecConfigId, kSampleRate,
+                                        codec_config_obus_);
+  AddAmbisonicsMonoAudioElementWithSubstreamIds(
+      kFirstAudioElementId, kCodecConfigId, {kFirstAudioFrameId},
+      codec_config_obus_, audio_elements_);
+  AddParamDefinitionWithMode0AndOneSubblock(kFirstParameterId,
+                                            /*parameter_rate=*/kSampleRate, 64,
+                                            param_definitions_);
+  EXPECT_THAT(Initialize(), IsOk());
+  TestGetNextAudioFrameStamps(kFirstAudioFrameId, 128, 0, 128);
+  TestGetNextParameterBlockTimestamps(kFirstParameterId, 0, 64, 0, 64);
+
+  global_timing_module_->Reset();
+
+  TestGetNextAudioFrameStamps(kFirstAudioFrameId, 128, 0, 128);
+  TestGetNextParameterBlockTimestamps(kFirstParameterId, 0, 64, 0, 64);
+}
+
 TEST_F(GlobalTimingModuleTest,
        FailsWhenGettingTimestampForStrayParameterBlock) {
   AddLpcmCodecConfigWithIdAndSampleRate(kCodecConfigId, kSampleRate,
@@ -196,8 +236,8 @@ TEST_F(GlobalTimingModuleTest,
 
   EXPECT_THAT(Initialize(), IsOk());
 
-  int32_t start_timestamp;
-  int32_t end_timestamp;
+  InternalTimestamp start_timestamp;
+  InternalTimestamp end_timestamp;
   const auto kStrayParameterBlockId = kFirstParameterId + 1;
   EXPECT_FALSE(global_timing_module_
                    ->GetNextParameterBlockTimestamps(kStrayParameterBlockId, 0,
@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/ia_sequence_demuxer.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status_matchers.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/cli/tests/cli_test_utils.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/common/write_bit_buffer.h"
+#include "iamf/obu/audio_frame.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/ia_sequence_header.h"
+#include "iamf/obu/mix_gain_parameter_data.h"
+#include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/obu_base.h"
+#include "iamf/obu/obu_header.h"
+#include "iamf/obu/param_definitions.h"
+#include "iamf/obu/parameter_block.h"
+#include "iamf/obu/temporal_delimiter.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+
+constexpr DecodedUleb128 kCodecConfigId = 1;
+constexpr uint32_t kNumSamplesPerFrame = 8;
+constexpr uint32_t kSampleRate = 48000;
+constexpr DecodedUleb128 kFirstAudioElementId = 1;
+constexpr DecodedUleb128 kSecondAudioElementId = 2;
+constexpr DecodedUleb128 kFirstSubstreamId = 1;
+constexpr DecodedUleb128 kSecondSubstreamId = 2;
+constexpr DecodedUleb128 kUnknownSubstreamId = 3;
+constexpr DecodedUleb128 kMixPresentationId = 100;
+constexpr DecodedUleb128 kCommonMixGainParameterId = 999;
+constexpr uint32_t kCommonMixGainParameterRate = kSampleRate;
+constexpr int64_t kBufferCapacity = 1024;
+
+constexpr bool kIsEndOfStream = true;
+constexpr bool kIsNotEndOfStream = false;
+
+void AppendObu(const ObuBase& obu, std::vector<uint8_t>& stream) {
+  WriteBitBuffer wb(kBufferCapacity);
+  ASSERT_THAT(obu.ValidateAndWriteObu(wb), IsOk());
+  stream.insert(stream.end(), wb.bit_buffer().begin(), wb.bit_buffer().end());
+}
+
+class IaSequenceDemuxerTest : public ::testing::Test {
+ public:
+  IaSequenceDemuxerTest()
+      : ia_sequence_header_(ObuHeader(), IASequenceHeaderObu::kIaCode,
+                            ProfileVersion::kIamfSimpleProfile,
+                            ProfileVersion::kIamfSimpleProfile) {
+    AddLpcmCodecConfigWithIdAndSampleRate(kCodecConfigId, kSampleRate,
+                                          codec_configs_);
+    AddAmbisonicsMonoAudioElementWithSubstreamIds(
+        kFirstAudioElementId, kCodecConfigId, {kFirstSubstreamId},
+        codec_configs_, audio_elements_);
+    AddAmbisonicsMonoAudioElementWithSubstreamIds(
+        kSecondAudioElementId, kCodecConfigId, {kSecondSubstreamId},
+        codec_configs_, audio_elements_);
+    AddMixPresentationObuWithAudioElementIds(
+        kMixPresentationId, {kFirstAudioElementId, kSecondAudioElementId},
+        kCommonMixGainParameterId, kCommonMixGainParameterRate,
+        mix_presentations_);
+
+    MixGainParamDefinition mix_gain_param_definition;
+    mix_gain_param_definition.parameter_id_ = kCommonMixGainParameterId;
+    mix_gain_param_definition.parameter_rate_ = kCommonMixGainParameterRate;
+    mix_gain_param_definition.param_definition_mode_ = true;
+    mix_gain_param_definition.reserved_ = 0;
+    mix_gain_metadata_ = PerIdParameterMetadata{
+        .param_definition_type = ParamDefinition::kParameterDefinitionMixGain,
+        .param_definition = mix_gain_param_definition};
+  }
+
+ protected:
+  void AppendDescriptorObus(std::vector<uint8_t>& stream) {
+    AppendObu(ia_sequence_header_, stream);
+    AppendObu(codec_configs_.at(kCodecConfigId), stream);
+    AppendObu(audio_elements_.at(kFirstAudioElementId).obu, stream);
+    AppendObu(audio_elements_.at(kSecondAudioElementId).obu, stream);
+    AppendObu(mix_presentations_.front(), stream);
+  }
+
+  void AppendTemporalUnit(std::vector<uint8_t>& stream,
+                          bool include_temporal_delimiter = true) {
+    if (include_temporal_delimiter) {
+      AppendObu(TemporalDelimiterObu(ObuHeader()), stream);
+    }
+    ParameterBlockObu parameter_block(ObuHeader(), kCommonMixGainParameterId,
+                                      mix_gain_metadata_);
+    ASSERT_THAT(parameter_block.InitializeSubblocks(kNumSamplesPerFrame,
+                                                    kNumSamplesPerFrame, 1),
+                IsOk());
+    parameter_block.subblocks_[0].param_data =
+        std::make_unique<MixGainParameterData>(
+            MixGainParameterData::kAnimateStep, AnimationStepInt16{0});
+    AppendObu(parameter_block, stream);
+    AppendObu(AudioFrameObu(ObuHeader(), kFirstSubstreamId, kAudioFrameData),
+              stream);
+    AppendObu(AudioFrameObu(ObuHeader(), kSecondSubstreamId, kAudioFrameData),
+              stream);
+  }
+
+  const std::vector<uint8_t> kAudioFrameData = {1, 2, 3, 4};
+
+  IASequenceHeaderObu ia_sequence_header_;
+  absl::flat_hash_map<uint32_t, CodecConfigObu> codec_configs_;
+  absl::flat_hash_map<DecodedUleb128, AudioElementWithData> audio_elements_;
+  std::list<MixPresentationObu> mix_presentations_;
+  PerIdParameterMetadata mix_gain_metadata_;
+};
+
+TEST_F(IaSequenceDemuxerTest, ReadsDescriptorObus) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+
+  bool insufficient_data = true;
+  EXPECT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  EXPECT_FALSE(insufficient_data);
+  EXPECT_EQ(demuxer.GetIaSequenceHeader(), ia_sequence_header_);
+  EXPECT_EQ(demuxer.GetCodecConfigs().size(), 1);
+  EXPECT_TRUE(demuxer.GetCodecConfigs().contains(kCodecConfigId));
+  ASSERT_EQ(demuxer.GetAudioElements().size(), 2);
+  const auto& audio_element =
+      demuxer.GetAudioElements().at(kFirstAudioElementId);
+  EXPECT_EQ(audio_element.codec_config,
+            &demuxer.GetCodecConfigs().at(kCodecConfigId));
+  EXPECT_EQ(audio_element.substream_id_to_labels,
+            audio_elements_.at(kFirstAudioElementId).substream_id_to_labels);
+  EXPECT_EQ(demuxer.GetMixPresentations(), mix_presentations_);
+}
+
+TEST_F(IaSequenceDemuxerTest, LeavesFirstTemporalUnitUnread) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  const int64_t kDescriptorsSize = stream.size();
+  AppendTemporalUnit(stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+
+  bool insufficient_data;
+  EXPECT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  EXPECT_EQ(rb->Tell(), kDescriptorsSize * 8);
+}
+
+TEST_F(IaSequenceDemuxerTest, ReadDescriptorObusFailsWhenCalledTwice) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  EXPECT_FALSE(
+      demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data).ok());
+}
+
+TEST_F(IaSequenceDemuxerTest,
+       ReadDescriptorObusFailsWhenFirstObuIsNotIaSequenceHeader) {
+  std::vector<uint8_t> stream;
+  AppendObu(codec_configs_.at(kCodecConfigId), stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+
+  bool insufficient_data;
+  EXPECT_FALSE(
+      demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data).ok());
+}
+
+TEST_F(IaSequenceDemuxerTest,
+       ReadDescriptorObusFailsWhenStreamEndsWithinDescriptors) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  stream.pop_back();
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+
+  bool insufficient_data;
+  EXPECT_FALSE(
+      demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data).ok());
+}
+
+TEST_F(IaSequenceDemuxerTest,
+       ReadDescriptorObusRequestsMoreDataUntilDescriptorsAreComplete) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendTemporalUnit(stream);
+  auto rb = StreamBasedReadBitBuffer::Create(kBufferCapacity);
+  IaSequenceDemuxer demuxer(*rb);
+
+  // Descriptors are only complete once the first OBU of the temporal unit is
+  // available.
+  ASSERT_THAT(rb->PushBytes(absl::MakeConstSpan(stream).first(
+                  stream.size() / 2)),
+              IsOk());
+  bool insufficient_data = false;
+  EXPECT_THAT(demuxer.ReadDescriptorObus(kIsNotEndOfStream, insufficient_data),
+              IsOk());
+  EXPECT_TRUE(insufficient_data);
+  EXPECT_FALSE(demuxer.GetIaSequenceHeader().has_value());
+
+  ASSERT_THAT(rb->PushBytes(absl::MakeConstSpan(stream).subspan(
+                  stream.size() / 2)),
+              IsOk());
+  EXPECT_THAT(demuxer.ReadDescriptorObus(kIsNotEndOfStream, insufficient_data),
+              IsOk());
+  EXPECT_FALSE(insufficient_data);
+  EXPECT_TRUE(demuxer.GetIaSequenceHeader().has_value());
+}
+
+TEST_F(IaSequenceDemuxerTest, ReadTemporalUnitFailsBeforeDescriptorsAreRead) {
+  std::vector<uint8_t> stream;
+  AppendTemporalUnit(stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  bool insufficient_data;
+  EXPECT_FALSE(
+      demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit, insufficient_data)
+          .ok());
+}
+
+TEST_F(IaSequenceDemuxerTest, ReadsTemporalUnitsUntilEndOfStream) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendTemporalUnit(stream);
+  AppendTemporalUnit(stream, /*include_temporal_delimiter=*/false);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  EXPECT_THAT(demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit,
+                                       insufficient_data),
+              IsOk());
+  ASSERT_TRUE(temporal_unit.has_value());
+  EXPECT_TRUE(temporal_unit->temporal_delimiter.has_value());
+  ASSERT_EQ(temporal_unit->parameter_blocks.size(), 1);
+  EXPECT_EQ(temporal_unit->parameter_blocks.front()->parameter_id_,
+            kCommonMixGainParameterId);
+  ASSERT_EQ(temporal_unit->audio_frames.size(), 2);
+  EXPECT_EQ(temporal_unit->audio_frames.front().GetSubstreamId(),
+            kFirstSubstreamId);
+  EXPECT_EQ(temporal_unit->audio_frames.front().audio_frame_, kAudioFrameData);
+  EXPECT_EQ(temporal_unit->audio_frames.back().GetSubstreamId(),
+            kSecondSubstreamId);
+
+  EXPECT_THAT(demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit,
+                                       insufficient_data),
+              IsOk());
+  ASSERT_TRUE(temporal_unit.has_value());
+  EXPECT_FALSE(temporal_unit->temporal_delimiter.has_value());
+  EXPECT_EQ(temporal_unit->audio_frames.size(), 2);
+
+  // The stream ends cleanly after the last temporal unit.
+  EXPECT_THAT(demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit,
+                                       insufficient_data),
+              IsOk());
+  EXPECT_FALSE(temporal_unit.has_value());
+  EXPECT_FALSE(insufficient_data);
+}
+
+TEST_F(IaSequenceDemuxerTest, SkipsRedundantDescriptorObus) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendTemporalUnit(stream);
+  AppendObu(IASequenceHeaderObu(ObuHeader{.obu_redundant_copy = true},
+                                IASequenceHeaderObu::kIaCode,
+                                ProfileVersion::kIamfSimpleProfile,
+                                ProfileVersion::kIamfSimpleProfile),
+            stream);
+  AppendTemporalUnit(stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_THAT(demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit,
+                                         insufficient_data),
+                IsOk());
+    EXPECT_TRUE(temporal_unit.has_value());
+  }
+  EXPECT_FALSE(rb->IsDataAvailable());
+}
+
+TEST_F(IaSequenceDemuxerTest,
+       ReadTemporalUnitFailsWhenStreamEndsWithinTemporalUnit) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendTemporalUnit(stream);
+  stream.pop_back();
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  EXPECT_FALSE(
+      demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit, insufficient_data)
+          .ok());
+}
+
+TEST_F(IaSequenceDemuxerTest,
+       ReadTemporalUnitFailsWithMultipleFramesForTheSameSubstream) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendObu(AudioFrameObu(ObuHeader(), kFirstSubstreamId, kAudioFrameData),
+            stream);
+  AppendObu(AudioFrameObu(ObuHeader(), kFirstSubstreamId, kAudioFrameData),
+            stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  EXPECT_FALSE(
+      demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit, insufficient_data)
+          .ok());
+}
+
+TEST_F(IaSequenceDemuxerTest, ReadTemporalUnitFailsForUnknownSubstream) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendObu(AudioFrameObu(ObuHeader(), kUnknownSubstreamId, kAudioFrameData),
+            stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  EXPECT_FALSE(
+      demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit, insufficient_data)
+          .ok());
+}
+
+TEST_F(IaSequenceDemuxerTest, SkipTemporalUnitReportsTemporalUnitSizes) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  const int64_t descriptor_obus_size = stream.size();
+  AppendTemporalUnit(stream);
+  const int64_t first_temporal_unit_size = stream.size() - descriptor_obus_size;
+  AppendTemporalUnit(stream, /*include_temporal_delimiter=*/false);
+  const int64_t second_temporal_unit_size =
+      stream.size() - descriptor_obus_size - first_temporal_unit_size;
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<int64_t> temporal_unit_size;
+  EXPECT_THAT(demuxer.SkipTemporalUnit(kIsEndOfStream, temporal_unit_size,
+                                       insufficient_data),
+              IsOk());
+  EXPECT_EQ(temporal_unit_size, first_temporal_unit_size);
+  EXPECT_THAT(demuxer.SkipTemporalUnit(kIsEndOfStream, temporal_unit_size,
+                                       insufficient_data),
+              IsOk());
+  EXPECT_EQ(temporal_unit_size, second_temporal_unit_size);
+
+  // The stream ends cleanly after the last temporal unit.
+  EXPECT_THAT(demuxer.SkipTemporalUnit(kIsEndOfStream, temporal_unit_size,
+                                       insufficient_data),
+              IsOk());
+  EXPECT_FALSE(temporal_unit_size.has_value());
+  EXPECT_FALSE(insufficient_data);
+}
+
+TEST_F(IaSequenceDemuxerTest, SkipTemporalUnitFailsForUnknownSubstream) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendObu(AudioFrameObu(ObuHeader(), kUnknownSubstreamId, kAudioFrameData),
+            stream);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<int64_t> temporal_unit_size;
+  EXPECT_FALSE(demuxer
+                   .SkipTemporalUnit(kIsEndOfStream, temporal_unit_size,
+                                     insufficient_data)
+                   .ok());
+}
+
+TEST_F(IaSequenceDemuxerTest, SkipTemporalUnitFailsForTruncatedTemporalUnit) {
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendTemporalUnit(stream);
+  stream.pop_back();
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(stream));
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<int64_t> temporal_unit_size;
+  EXPECT_FALSE(demuxer
+                   .SkipTemporalUnit(kIsEndOfStream, temporal_unit_size,
+                                     insufficient_data)
+                   .ok());
+}
+
+TEST_F(IaSequenceDemuxerTest, ReadsStreamPushedOneByteAtATime) {
+  constexpr int kNumTemporalUnits = 3;
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    AppendTemporalUnit(stream);
+  }
+  auto rb = StreamBasedReadBitBuffer::Create(kBufferCapacity);
+  IaSequenceDemuxer demuxer(*rb);
+
+  bool descriptors_read = false;
+  int num_temporal_units = 0;
+  for (const uint8_t byte : stream) {
+    ASSERT_THAT(rb->PushBytes({byte}), IsOk());
+    bool insufficient_data = false;
+    if (!descriptors_read) {
+      ASSERT_THAT(
+          demuxer.ReadDescriptorObus(kIsNotEndOfStream, insufficient_data),
+          IsOk());
+      descriptors_read = !insufficient_data;
+    }
+    while (descriptors_read && !insufficient_data) {
+      std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+      ASSERT_THAT(demuxer.ReadTemporalUnit(kIsNotEndOfStream, temporal_unit,
+                                           insufficient_data),
+                  IsOk());
+      if (temporal_unit.has_value()) {
+        ++num_temporal_units;
+      }
+    }
+    // Release everything that was consumed.
+    ASSERT_THAT(rb->Flush(rb->Tell() / 8), IsOk());
+  }
+
+  EXPECT_TRUE(descriptors_read);
+  EXPECT_EQ(num_temporal_units, kNumTemporalUnits);
+}
+
+TEST_F(IaSequenceDemuxerTest, ReadsFileBasedBuffer) {
+  const std::string kInputFilename = GetAndCleanupOutputFileName(".iamf");
+  std::vector<uint8_t> stream;
+  AppendDescriptorObus(stream);
+  AppendTemporalUnit(stream);
+  std::ofstream(kInputFilename, std::ios::binary)
+      .write(reinterpret_cast<const char*>(stream.data()), stream.size());
+  auto rb = FileBasedReadBitBuffer::CreateFromFilePath(
+      kBufferCapacity, std::filesystem::path(kInputFilename));
+  ASSERT_NE(rb, nullptr);
+  IaSequenceDemuxer demuxer(*rb);
+  bool insufficient_data;
+  ASSERT_THAT(demuxer.ReadDescriptorObus(kIsEndOfStream, insufficient_data),
+              IsOk());
+
+  std::optional<IaSequenceDemuxer::TemporalUnit> temporal_unit;
+  EXPECT_THAT(demuxer.ReadTemporalUnit(kIsEndOfStream, temporal_unit,
+                                       insufficient_data),
+              IsOk());
+  EXPECT_TRUE(temporal_unit.has_value());
+}
+
+}  // namespace
+}  // namespace iamf_tools
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/ia_sequence_validator.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/status_matchers.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/cli/temporal_unit_index.h"
+#include "iamf/cli/tests/cli_test_utils.h"
+#include "iamf/common/write_bit_buffer.h"
+#include "iamf/obu/audio_frame.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/ia_sequence_header.h"
+#include "iamf/obu/mix_gain_parameter_data.h"
+#include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/obu_base.h"
+#include "iamf/obu/obu_header.h"
+#include "iamf/obu/param_definitions.h"
+#include "iamf/obu/parameter_block.h"
+#include "iamf/obu/temporal_delimiter.h"
+#include "iamf/obu/types.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::absl_testing::StatusIs;
+
+constexpr DecodedUleb128 kCodecConfigId = 1;
+constexpr uint32_t kNumSamplesPerFrame = 8;
+constexpr uint32_t kSampleRate = 48000;
+constexpr DecodedUleb128 kFirstAudioElementId = 1;
+constexpr DecodedUleb128 kSecondAudioElementId = 2;
+constexpr DecodedUleb128 kFirstSubstreamId = 1;
+constexpr DecodedUleb128 kSecondSubstreamId = 2;
+constexpr DecodedUleb128 kMixPresentationId = 100;
+constexpr DecodedUleb128 kCommonMixGainParameterId = 999;
+constexpr DecodedUleb128 kUnknownParameterId = 1000;
+constexpr uint32_t kCommonMixGainParameterRate = kSampleRate;
+constexpr int64_t kBufferCapacity = 1024;
+
+constexpr int kNumTemporalUnits = 10;
+constexpr int kNumThreads = 4;
+
+void AppendObu(const ObuBase& obu, std::vector<uint8_t>& stream) {
+  WriteBitBuffer wb(kBufferCapacity);
+  ASSERT_THAT(obu.ValidateAndWriteObu(wb), IsOk());
+  stream.insert(stream.end(), wb.bit_buffer().begin(), wb.bit_buffer().end());
+}
+
+class ValidateIaSequenceFileTest : public ::testing::Test {
+ public:
+  ValidateIaSequenceFileTest()
+      : ia_sequence_header_(ObuHeader(), IASequenceHeaderObu::kIaCode,
+                            ProfileVersion::kIamfSimpleProfile,
+                            ProfileVersion::kIamfSimpleProfile),
+        file_path_(GetAndCleanupOutputFileName(".iamf")) {
+    AddLpcmCodecConfigWithIdAndSampleRate(kCodecConfigId, kSampleRate,
+                                          codec_configs_);
+    AddAmbisonicsMonoAudioElementWithSubstreamIds(
+        kFirstAudioElementId, kCodecConfigId, {kFirstSubstreamId},
+        codec_configs_, audio_elements_);
+    AddAmbisonicsMonoAudioElementWithSubstreamIds(
+        kSecondAudioElementId, kCodecConfigId, {kSecondSubstreamId},
+        codec_configs_, audio_elements_);
+    AddMixPresentationObuWithAudioElementIds(
+        kMixPresentationId, {kFirstAudioElementId, kSecondAudioElementId},
+        kCommonMixGainParameterId, kCommonMixGainParameterRate,
+        mix_presentations_);
+
+    MixGainParamDefinition mix_gain_param_definition;
+    mix_gain_param_definition.parameter_id_ = kCommonMixGainParameterId;
+    mix_gain_param_definition.parameter_rate_ = kCommonMixGainParameterRate;
+    mix_gain_param_definition.param_definition_mode_ = true;
+    mix_gain_param_definition.reserved_ = 0;
+    mix_gain_metadata_ = PerIdParameterMetadata{
+        .param_definition_type = ParamDefinition::kParameterDefinitionMixGain,
+        .param_definition = mix_gain_param_definition};
+  }
+
+ protected:
+  void AppendDescriptorObus() {
+    AppendObu(ia_sequence_header_, stream_);
+    AppendObu(codec_configs_.at(kCodecConfigId), stream_);
+    AppendObu(audio_elements_.at(kFirstAudioElementId).obu, stream_);
+    AppendObu(audio_elements_.at(kSecondAudioElementId).obu, stream_);
+    AppendObu(mix_presentations_.front(), stream_);
+  }
+
+  void AppendTemporalUnit(
+      DecodedUleb128 parameter_id = kCommonMixGainParameterId) {
+    AppendObu(TemporalDelimiterObu(ObuHeader()), stream_);
+    ParameterBlockObu parameter_block(ObuHeader(), parameter_id,
+                                      mix_gain_metadata_);
+    ASSERT_THAT(parameter_block.InitializeSubblocks(kNumSamplesPerFrame,
+                                                    kNumSamplesPerFrame, 1),
+                IsOk());
+    parameter_block.subblocks_[0].param_data =
+        std::make_unique<MixGainParameterData>(
+            MixGainParameterData::kAnimateStep, AnimationStepInt16{0});
+    AppendObu(parameter_block, stream_);
+    AppendObu(AudioFrameObu(ObuHeader(), kFirstSubstreamId, kAudioFrameData),
+              stream_);
+    AppendObu(AudioFrameObu(ObuHeader(), kSecondSubstreamId, kAudioFrameData),
+              stream_);
+  }
+
+  void WriteFile() {
+    std::ofstream(file_path_, std::ios::binary)
+        .write(reinterpret_cast<const char*>(stream_.data()), stream_.size());
+  }
+
+  const std::vector<uint8_t> kAudioFrameData = {1, 2, 3, 4};
+
+  IASequenceHeaderObu ia_sequence_header_;
+  absl::flat_hash_map<uint32_t, CodecConfigObu> codec_configs_;
+  absl::flat_hash_map<DecodedUleb128, AudioElementWithData> audio_elements_;
+  std::list<MixPresentationObu> mix_presentations_;
+  PerIdParameterMetadata mix_gain_metadata_;
+
+  const std::string file_path_;
+  std::vector<uint8_t> stream_;
+  std::vector<TemporalUnitDiagnostic> diagnostics_;
+};
+
+TEST_F(ValidateIaSequenceFileTest, ValidatesEachTemporalUnitInFileOrder) {
+  AppendDescriptorObus();
+  const int64_t descriptor_obus_size = stream_.size();
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    AppendTemporalUnit();
+  }
+  WriteFile();
+
+  EXPECT_THAT(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                     /*index=*/nullptr, diagnostics_),
+              IsOk());
+
+  ASSERT_EQ(diagnostics_.size(), kNumTemporalUnits);
+  int64_t expected_offset = descriptor_obus_size;
+  for (const auto& diagnostic : diagnostics_) {
+    EXPECT_EQ(diagnostic.offset, expected_offset);
+    EXPECT_THAT(diagnostic.status, IsOk());
+    expected_offset += diagnostic.size;
+  }
+  EXPECT_EQ(expected_offset, stream_.size());
+}
+
+TEST_F(ValidateIaSequenceFileTest, ValidatesOnCallingThread) {
+  AppendDescriptorObus();
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    AppendTemporalUnit();
+  }
+  WriteFile();
+
+  EXPECT_THAT(ValidateIaSequenceFile(file_path_, /*num_threads=*/0,
+                                     /*index=*/nullptr, diagnostics_),
+              IsOk());
+
+  EXPECT_EQ(diagnostics_.size(), kNumTemporalUnits);
+}
+
+TEST_F(ValidateIaSequenceFileTest, ValidatesFileWithoutTemporalUnits) {
+  AppendDescriptorObus();
+  WriteFile();
+
+  EXPECT_THAT(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                     /*index=*/nullptr, diagnostics_),
+              IsOk());
+
+  EXPECT_TRUE(diagnostics_.empty());
+}
+
+TEST_F(ValidateIaSequenceFileTest, ReportsOnlyTheInvalidTemporalUnit) {
+  constexpr int kInvalidTemporalUnit = 6;
+  AppendDescriptorObus();
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    AppendTemporalUnit(i == kInvalidTemporalUnit ? kUnknownParameterId
+                                                 : kCommonMixGainParameterId);
+  }
+  WriteFile();
+
+  EXPECT_FALSE(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                      /*index=*/nullptr, diagnostics_)
+                   .ok());
+
+  ASSERT_EQ(diagnostics_.size(), kNumTemporalUnits);
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    EXPECT_EQ(diagnostics_[i].status.ok(), i != kInvalidTemporalUnit);
+  }
+}
+
+TEST_F(ValidateIaSequenceFileTest, TruncatedTemporalUnitIsTheLastDiagnostic) {
+  AppendDescriptorObus();
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    AppendTemporalUnit();
+  }
+  stream_.pop_back();
+  WriteFile();
+
+  EXPECT_FALSE(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                      /*index=*/nullptr, diagnostics_)
+                   .ok());
+
+  ASSERT_EQ(diagnostics_.size(), kNumTemporalUnits);
+  EXPECT_THAT(diagnostics_.front().status, IsOk());
+  EXPECT_FALSE(diagnostics_.back().status.ok());
+}
+
+TEST_F(ValidateIaSequenceFileTest, UsesTemporalUnitsFromIndex) {
+  AppendDescriptorObus();
+  TemporalUnitIndexBuilder builder;
+  ASSERT_THAT(builder.SetDescriptorObus(0, stream_.size()), IsOk());
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    const int64_t offset = stream_.size();
+    AppendTemporalUnit();
+    ASSERT_THAT(builder.AddTemporalUnit(i * kNumSamplesPerFrame, offset,
+                                        stream_.size() - offset),
+                IsOk());
+  }
+  WriteFile();
+
+  EXPECT_THAT(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                     &builder.GetIndex(), diagnostics_),
+              IsOk());
+
+  ASSERT_EQ(diagnostics_.size(), kNumTemporalUnits);
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    EXPECT_EQ(diagnostics_[i].offset,
+              builder.GetIndex().GetTemporalUnits()[i].offset);
+  }
+}
+
+TEST_F(ValidateIaSequenceFileTest, FailsWhenIndexDoesNotCoverTheFile) {
+  AppendDescriptorObus();
+  TemporalUnitIndexBuilder builder;
+  const int64_t offset = stream_.size();
+  AppendTemporalUnit();
+  ASSERT_THAT(builder.AddTemporalUnit(0, offset, stream_.size() - offset),
+              IsOk());
+  AppendTemporalUnit();
+  WriteFile();
+
+  EXPECT_THAT(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                     &builder.GetIndex(), diagnostics_),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST_F(ValidateIaSequenceFileTest, FailsForMissingFile) {
+  EXPECT_FALSE(ValidateIaSequenceFile(file_path_, kNumThreads,
+                                      /*index=*/nullptr, diagnostics_)
+                   .ok());
+}
+
+}  // namespace
+}  // namespace iamf_tools
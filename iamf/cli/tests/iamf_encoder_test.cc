@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -27,6 +28,7 @@
 #include "iamf/cli/proto/arbitrary_obu.pb.h"
 #include "iamf/cli/proto/audio_element.pb.h"
 #include "iamf/cli/proto/codec_config.pb.h"
+#include "iamf/cli/proto/encoder_control_metadata.pb.h"
 #include "iamf/cli/proto/ia_sequence_header.pb.h"
 #include "iamf/cli/proto/mix_presentation.pb.h"
 #include "iamf/cli/proto/test_vector_metadata.pb.h"
@@ -192,6 +194,37 @@ void AddParameterBlockAtTimestamp(const int32_t start_timestamp,
   metadata->set_start_timestamp(start_timestamp);
 }
 
+// Encodes two temporal units of distinct samples and returns the audio frames
+// and parameter blocks.
+void EncodeTwoTemporalUnits(
+    const UserMetadata& user_metadata, IamfEncoder& iamf_encoder,
+    std::list<AudioFrameWithData>& audio_frames,
+    std::list<ParameterBlockWithData>& parameter_blocks) {
+  int iteration = 0;
+  while (iamf_encoder.GeneratingDataObus()) {
+    iamf_encoder.BeginTemporalUnit();
+    const std::vector<InternalSampleType> samples(kNumSamplesPerFrame,
+                                                  0.25 * (iteration + 1));
+    iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kL2, samples);
+    iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kR2, samples);
+    if (iteration == 1) {
+      iamf_encoder.FinalizeAddSamples();
+    }
+    EXPECT_THAT(iamf_encoder.AddParameterBlockMetadata(
+                    user_metadata.parameter_block_metadata(iteration)),
+                IsOk());
+
+    std::list<AudioFrameWithData> temp_audio_frames;
+    std::list<ParameterBlockWithData> temp_parameter_blocks;
+    EXPECT_THAT(iamf_encoder.OutputTemporalUnit(temp_audio_frames,
+                                                temp_parameter_blocks),
+                IsOk());
+    audio_frames.splice(audio_frames.end(), temp_audio_frames);
+    parameter_blocks.splice(parameter_blocks.end(), temp_parameter_blocks);
+    iteration++;
+  }
+}
+
 std::string GetFirstSubmixFirstLayoutExpectedPath(
     absl::string_view output_directory) {
   return (std::filesystem::path(output_directory) /
@@ -326,6 +359,47 @@ TEST_F(IamfEncoderTest, GenerateDataObusTwoIterationsSucceeds) {
   EXPECT_EQ(iteration, 2);
 }
 
+TEST_F(IamfEncoderTest, ResetEncodesSameDataObusAgain) {
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  AddParameterBlockAtTimestamp(0, user_metadata_);
+  AddParameterBlockAtTimestamp(8, user_metadata_);
+  auto iamf_encoder = CreateExpectOk();
+  std::list<AudioFrameWithData> first_audio_frames;
+  std::list<ParameterBlockWithData> first_parameter_blocks;
+  EncodeTwoTemporalUnits(user_metadata_, iamf_encoder, first_audio_frames,
+                         first_parameter_blocks);
+  EXPECT_THAT(iamf_encoder.FinalizeMixPresentationObus(mix_presentation_obus_),
+              IsOk());
+
+  EXPECT_THAT(iamf_encoder.Reset(loudness_calculator_factory_.get(),
+                                 wav_writer_factory_, audio_elements_,
+                                 mix_presentation_obus_),
+              IsOk());
+  EXPECT_TRUE(iamf_encoder.GeneratingDataObus());
+  std::list<AudioFrameWithData> second_audio_frames;
+  std::list<ParameterBlockWithData> second_parameter_blocks;
+  EncodeTwoTemporalUnits(user_metadata_, iamf_encoder, second_audio_frames,
+                         second_parameter_blocks);
+
+  // The second IA Sequence starts over at timestamp 0 and is encoded the same.
+  ASSERT_EQ(first_audio_frames.size(), 2);
+  ASSERT_EQ(second_audio_frames.size(), first_audio_frames.size());
+  for (auto first_iter = first_audio_frames.begin(),
+            second_iter = second_audio_frames.begin();
+       first_iter != first_audio_frames.end(); ++first_iter, ++second_iter) {
+    EXPECT_EQ(second_iter->start_timestamp, first_iter->start_timestamp);
+    EXPECT_EQ(second_iter->end_timestamp, first_iter->end_timestamp);
+    EXPECT_EQ(second_iter->obu.audio_frame_, first_iter->obu.audio_frame_);
+  }
+  ASSERT_EQ(second_parameter_blocks.size(), first_parameter_blocks.size());
+  EXPECT_EQ(second_parameter_blocks.front().start_timestamp, 0);
+  EXPECT_EQ(second_parameter_blocks.back().start_timestamp,
+            first_parameter_blocks.back().start_timestamp);
+  EXPECT_THAT(iamf_encoder.FinalizeMixPresentationObus(mix_presentation_obus_),
+              IsOk());
+}
+
 TEST_F(IamfEncoderTest, SafeToUseAfterMove) {
   SetupDescriptorObus();
   AddAudioFrame(user_metadata_);
@@ -356,6 +430,198 @@ TEST_F(IamfEncoderTest, SafeToUseAfterMove) {
   EXPECT_EQ(temp_parameter_blocks.size(), 1);
 }
 
+TEST_F(IamfEncoderTest, OutputTemporalUnitSucceedsWhenAlwaysDecodingFrames) {
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  AddParameterBlockAtTimestamp(0, user_metadata_);
+  user_metadata_.mutable_encoder_control_metadata()
+      ->set_always_decode_audio_frames(true);
+  auto iamf_encoder = CreateExpectOk();
+
+  iamf_encoder.BeginTemporalUnit();
+  const std::vector<InternalSampleType> kZeroSamples(kNumSamplesPerFrame, 0.0);
+  iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kL2, kZeroSamples);
+  iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kR2, kZeroSamples);
+  iamf_encoder.FinalizeAddSamples();
+  EXPECT_THAT(iamf_encoder.AddParameterBlockMetadata(
+                  user_metadata_.parameter_block_metadata(0)),
+              IsOk());
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  EXPECT_THAT(
+      iamf_encoder.OutputTemporalUnit(temp_audio_frames, temp_parameter_blocks),
+      IsOk());
+  EXPECT_EQ(temp_audio_frames.size(), 1);
+  EXPECT_EQ(temp_parameter_blocks.size(), 1);
+}
+
+TEST_F(IamfEncoderTest, OutputTemporalUnitReleasesPcmSamples) {
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  AddParameterBlockAtTimestamp(0, user_metadata_);
+  auto iamf_encoder = CreateExpectOk();
+
+  iamf_encoder.BeginTemporalUnit();
+  const std::vector<InternalSampleType> kZeroSamples(kNumSamplesPerFrame, 0.0);
+  iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kL2, kZeroSamples);
+  iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kR2, kZeroSamples);
+  iamf_encoder.FinalizeAddSamples();
+  EXPECT_THAT(iamf_encoder.AddParameterBlockMetadata(
+                  user_metadata_.parameter_block_metadata(0)),
+              IsOk());
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  EXPECT_THAT(
+      iamf_encoder.OutputTemporalUnit(temp_audio_frames, temp_parameter_blocks),
+      IsOk());
+
+  // The samples were consumed when demixing; only the encoded audio is kept.
+  ASSERT_EQ(temp_audio_frames.size(), 1);
+  EXPECT_FALSE(temp_audio_frames.front().pcm_samples.has_value());
+  EXPECT_FALSE(temp_audio_frames.front().obu.audio_frame_.empty());
+}
+
+TEST_F(IamfEncoderTest, EndTemporalUnitFailsWhenNotPipelined) {
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  auto iamf_encoder = CreateExpectOk();
+
+  EXPECT_FALSE(iamf_encoder.EndTemporalUnit().ok());
+}
+
+TEST_F(IamfEncoderTest, PipelinedGenerateDataObusOnTwoThreadsSucceeds) {
+  constexpr int kNumFrames = 20;
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  for (int i = 0; i < kNumFrames; ++i) {
+    AddParameterBlockAtTimestamp(i * kNumSamplesPerFrame, user_metadata_);
+  }
+  user_metadata_.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      2);
+  auto iamf_encoder = CreateExpectOk();
+
+  std::thread input_thread([&]() {
+    const std::vector<InternalSampleType> zero_samples(kNumSamplesPerFrame,
+                                                       0.0);
+    int iteration = 0;
+    while (iamf_encoder.GeneratingAudioFrames()) {
+      iamf_encoder.BeginTemporalUnit();
+      iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kL2,
+                              zero_samples);
+      iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kR2,
+                              zero_samples);
+      if (iteration == kNumFrames - 1) {
+        iamf_encoder.FinalizeAddSamples();
+      }
+      EXPECT_THAT(iamf_encoder.AddParameterBlockMetadata(
+                      user_metadata_.parameter_block_metadata(iteration)),
+                  IsOk());
+      EXPECT_THAT(iamf_encoder.EndTemporalUnit(), IsOk());
+      iteration++;
+    }
+  });
+
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  int num_audio_frames = 0;
+  while (iamf_encoder.GeneratingDataObus()) {
+    EXPECT_THAT(iamf_encoder.OutputTemporalUnit(temp_audio_frames,
+                                                temp_parameter_blocks),
+                IsOk());
+    for (const auto& audio_frame : temp_audio_frames) {
+      EXPECT_EQ(audio_frame.start_timestamp,
+                num_audio_frames * kNumSamplesPerFrame);
+      EXPECT_EQ(temp_parameter_blocks.size(), 1);
+      num_audio_frames++;
+    }
+  }
+  input_thread.join();
+
+  EXPECT_EQ(num_audio_frames, kNumFrames);
+  EXPECT_THAT(iamf_encoder.FinalizeMixPresentationObus(mix_presentation_obus_),
+              IsOk());
+}
+
+TEST_F(IamfEncoderTest, PipelinedEncoderMayAlternateStagesOnOneThread) {
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  AddParameterBlockAtTimestamp(0, user_metadata_);
+  user_metadata_.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      1);
+  auto iamf_encoder = CreateExpectOk();
+
+  iamf_encoder.BeginTemporalUnit();
+  const std::vector<InternalSampleType> kZeroSamples(kNumSamplesPerFrame, 0.0);
+  iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kL2, kZeroSamples);
+  iamf_encoder.AddSamples(kAudioElementId, ChannelLabel::kR2, kZeroSamples);
+  iamf_encoder.FinalizeAddSamples();
+  EXPECT_THAT(iamf_encoder.AddParameterBlockMetadata(
+                  user_metadata_.parameter_block_metadata(0)),
+              IsOk());
+  EXPECT_THAT(iamf_encoder.EndTemporalUnit(), IsOk());
+  EXPECT_FALSE(iamf_encoder.GeneratingAudioFrames());
+  EXPECT_TRUE(iamf_encoder.GeneratingDataObus());
+
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  EXPECT_THAT(
+      iamf_encoder.OutputTemporalUnit(temp_audio_frames, temp_parameter_blocks),
+      IsOk());
+  EXPECT_EQ(temp_audio_frames.size(), 1);
+  EXPECT_EQ(temp_parameter_blocks.size(), 1);
+  EXPECT_FALSE(iamf_encoder.GeneratingDataObus());
+}
+
+TEST_F(IamfEncoderTest, PipelinedEncoderWithNoAudioFramesDoesNotBlock) {
+  SetupDescriptorObus();
+  user_metadata_.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      1);
+  auto iamf_encoder = CreateExpectOk();
+
+  // The input stage never calls `EndTemporalUnit()`, so the output stage must
+  // already know it is finished.
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  for (int sequence = 0; sequence < 2; ++sequence) {
+    std::thread input_thread([&]() {
+      while (iamf_encoder.GeneratingAudioFrames()) {
+        EXPECT_THAT(iamf_encoder.EndTemporalUnit(), IsOk());
+      }
+    });
+    EXPECT_FALSE(iamf_encoder.GeneratingDataObus());
+    EXPECT_THAT(iamf_encoder.OutputTemporalUnit(temp_audio_frames,
+                                                temp_parameter_blocks),
+                IsOk());
+    EXPECT_TRUE(temp_audio_frames.empty());
+    input_thread.join();
+
+    // `Reset()` must restore the same state for the next IA Sequence.
+    EXPECT_THAT(iamf_encoder.Reset(loudness_calculator_factory_.get(),
+                                   wav_writer_factory_, audio_elements_,
+                                   mix_presentation_obus_),
+                IsOk());
+  }
+}
+
+TEST_F(IamfEncoderTest, AbortPipelineUnblocksOutputTemporalUnit) {
+  SetupDescriptorObus();
+  AddAudioFrame(user_metadata_);
+  user_metadata_.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      1);
+  auto iamf_encoder = CreateExpectOk();
+
+  // Nothing is ever queued, so only aborting wakes the output stage.
+  std::thread abort_thread([&]() { iamf_encoder.AbortPipeline(); });
+  std::list<AudioFrameWithData> temp_audio_frames;
+  std::list<ParameterBlockWithData> temp_parameter_blocks;
+  EXPECT_FALSE(
+      iamf_encoder.OutputTemporalUnit(temp_audio_frames, temp_parameter_blocks)
+          .ok());
+  abort_thread.join();
+
+  EXPECT_FALSE(iamf_encoder.EndTemporalUnit().ok());
+}
+
 TEST_F(IamfEncoderTest, FinalizeMixPresentationObusSucceeds) {
   SetupDescriptorObus();
   auto iamf_encoder = CreateExpectOk();
@@ -137,6 +137,14 @@ class LebGeneratorTest : public testing::Test {
     if (expected_status_code == absl::StatusCode::kOk) {
       EXPECT_EQ(output_buffer, expected_result);
     }
+
+    // The size is consistent with the generated ULEB128.
+    int8_t size = 0;
+    EXPECT_EQ(leb_generator_->GetUleb128Size(input, size).code(),
+              expected_status_code);
+    if (expected_status_code == absl::StatusCode::kOk) {
+      EXPECT_EQ(size, expected_result.size());
+    }
   }
 
   void TestSleb128ToUint8Vector(
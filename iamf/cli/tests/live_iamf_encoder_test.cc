@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/live_iamf_encoder.h"
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/status_matchers.h"
+#include "absl/status/statusor.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/cli/audio_element_with_data.h"
+#include "iamf/cli/channel_label.h"
+#include "iamf/cli/iamf_encoder.h"
+#include "iamf/cli/obu_sequencer.h"
+#include "iamf/cli/proto/parameter_block.pb.h"
+#include "iamf/cli/proto/user_metadata.pb.h"
+#include "iamf/cli/rendering_mix_presentation_finalizer.h"
+#include "iamf/cli/user_metadata_builder/audio_element_metadata_builder.h"
+#include "iamf/cli/user_metadata_builder/iamf_input_layout.h"
+#include "iamf/common/macros.h"
+#include "iamf/obu/arbitrary_obu.h"
+#include "iamf/obu/codec_config.h"
+#include "iamf/obu/ia_sequence_header.h"
+#include "iamf/obu/mix_presentation.h"
+#include "iamf/obu/types.h"
+#include "src/google/protobuf/text_format.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::absl_testing::StatusIs;
+using ::iamf_tools_cli_proto::UserMetadata;
+using ::testing::ElementsAre;
+
+constexpr DecodedUleb128 kCodecConfigId = 200;
+constexpr DecodedUleb128 kAudioElementId = 300;
+constexpr DecodedUleb128 kParameterId = 100;
+constexpr uint32_t kNumSamplesPerFrame = 8;
+constexpr uint32_t kSampleRate = 48000;
+
+void AddIaSequenceHeader(UserMetadata& user_metadata) {
+  ASSERT_TRUE(google::protobuf::TextFormat::ParseFromString(
+      R"pb(
+        primary_profile: PROFILE_VERSION_SIMPLE
+        additional_profile: PROFILE_VERSION_BASE
+      )pb",
+      user_metadata.add_ia_sequence_header_metadata()));
+}
+
+void AddCodecConfig(UserMetadata& user_metadata) {
+  ASSERT_TRUE(google::protobuf::TextFormat::ParseFromString(
+      R"pb(
+        codec_config_id: 200
+        codec_config {
+          codec_id: CODEC_ID_LPCM
+          num_samples_per_frame: 8
+          audio_roll_distance: 0
+          decoder_config_lpcm {
+            sample_format_flags: LPCM_LITTLE_ENDIAN
+            sample_size: 16
+            sample_rate: 48000
+          }
+        }
+      )pb",
+      user_metadata.add_codec_config_metadata()));
+}
+
+void AddAudioElement(UserMetadata& user_metadata) {
+  AudioElementMetadataBuilder builder;
+  ASSERT_THAT(builder.PopulateAudioElementMetadata(
+                  kAudioElementId, kCodecConfigId, IamfInputLayout::kStereo,
+                  *user_metadata.add_audio_element_metadata()),
+              IsOk());
+}
+
+void AddMixPresentation(UserMetadata& user_metadata) {
+  ASSERT_TRUE(google::protobuf::TextFormat::ParseFromString(
+      R"pb(
+        mix_presentation_id: 42
+        count_label: 0
+        num_sub_mixes: 1
+        sub_mixes {
+          num_audio_elements: 1
+          audio_elements {
+            audio_element_id: 300
+            rendering_config {
+              headphones_rendering_mode: HEADPHONES_RENDERING_MODE_STEREO
+            }
+            element_mix_gain {
+              param_definition {
+                parameter_id: 100
+                parameter_rate: 48000
+                param_definition_mode: 1
+                reserved: 0
+              }
+              default_mix_gain: 0
+            }
+          }
+          output_mix_gain {
+            param_definition {
+              parameter_id: 100
+              parameter_rate: 48000
+              param_definition_mode: 1
+              reserved: 0
+            }
+            default_mix_gain: 0
+          }
+          num_layouts: 1
+          layouts {
+            loudness_layout {
+              layout_type: LAYOUT_TYPE_LOUDSPEAKERS_SS_CONVENTION
+              ss_layout { sound_system: SOUND_SYSTEM_A_0_2_0 reserved: 0 }
+            }
+            loudness {
+              info_type_bit_masks: []
+              integrated_loudness: 0
+              digital_peak: 0
+            }
+          }
+        }
+      )pb",
+      user_metadata.add_mix_presentation_metadata()));
+}
+
+void AddAudioFrame(UserMetadata& user_metadata) {
+  ASSERT_TRUE(google::protobuf::TextFormat::ParseFromString(
+      R"pb(
+        samples_to_trim_at_end: 0
+        samples_to_trim_at_start: 0
+        audio_element_id: 300
+        channel_ids: [ 0, 1 ]
+        channel_labels: [ "L2", "R2" ]
+      )pb",
+      user_metadata.add_audio_frame_metadata()));
+}
+
+iamf_tools_cli_proto::ParameterBlockObuMetadata GetParameterBlockMetadata(
+    int32_t start_timestamp) {
+  iamf_tools_cli_proto::ParameterBlockObuMetadata metadata;
+  EXPECT_TRUE(google::protobuf::TextFormat::ParseFromString(
+      R"pb(
+        parameter_id: 100
+        duration: 8
+        num_subblocks: 1
+        constant_subblock_duration: 8
+        subblocks:
+        [ {
+          mix_gain_parameter_data {
+            animation_type: ANIMATE_STEP
+            param_data { step { start_point_value: 0 } }
+          }
+        }]
+      )pb",
+      &metadata));
+  metadata.set_start_timestamp(start_timestamp);
+  return metadata;
+}
+
+class LiveIamfEncoderTest : public ::testing::Test {
+ protected:
+  LiveIamfEncoderTest() {
+    AddIaSequenceHeader(user_metadata_);
+    AddCodecConfig(user_metadata_);
+    AddAudioElement(user_metadata_);
+    AddMixPresentation(user_metadata_);
+    AddAudioFrame(user_metadata_);
+  }
+
+  absl::StatusOr<LiveIamfEncoder> Create() {
+    // Nothing is rendered, so no state is kept for the whole programme.
+    auto iamf_encoder = IamfEncoder::Create(
+        user_metadata_, /*renderer_factory=*/nullptr,
+        /*loudness_calculator_factory=*/nullptr,
+        RenderingMixPresentationFinalizer::ProduceNoWavWriters,
+        ia_sequence_header_obu_, codec_config_obus_, audio_elements_,
+        mix_presentation_obus_, arbitrary_obus_);
+    if (!iamf_encoder.ok()) {
+      return iamf_encoder.status();
+    }
+    return LiveIamfEncoder::Create(
+        user_metadata_, codec_config_obus_, audio_elements_,
+        std::move(*iamf_encoder),
+        [this](InternalTimestamp start_timestamp,
+               const TemporalUnit& temporal_unit) {
+          EXPECT_FALSE(temporal_unit.audio_frames.empty());
+          EXPECT_EQ(temporal_unit.audio_frames.front()->start_timestamp,
+                    start_timestamp);
+          start_timestamps_.push_back(start_timestamp);
+          num_parameter_blocks_.push_back(
+              temporal_unit.parameter_blocks.size());
+          return callback_status_;
+        });
+  }
+
+  LiveIamfEncoder CreateExpectOk() {
+    auto live_encoder = Create();
+    EXPECT_THAT(live_encoder, IsOk());
+    return std::move(*live_encoder);
+  }
+
+  // Pushes the same number of samples to both channels.
+  absl::Status PushStereoSamples(LiveIamfEncoder& live_encoder,
+                                 int num_samples) {
+    const std::vector<InternalSampleType> samples(num_samples, 0.0);
+    RETURN_IF_NOT_OK(
+        live_encoder.PushSamples(kAudioElementId, ChannelLabel::kL2, samples));
+    return live_encoder.PushSamples(kAudioElementId, ChannelLabel::kR2,
+                                    samples);
+  }
+
+  UserMetadata user_metadata_;
+  std::optional<IASequenceHeaderObu> ia_sequence_header_obu_;
+  absl::flat_hash_map<uint32_t, CodecConfigObu> codec_config_obus_;
+  absl::flat_hash_map<DecodedUleb128, AudioElementWithData> audio_elements_;
+  std::list<MixPresentationObu> mix_presentation_obus_;
+  std::list<ArbitraryObu> arbitrary_obus_;
+
+  absl::Status callback_status_ = absl::OkStatus();
+  std::vector<InternalTimestamp> start_timestamps_;
+  std::vector<size_t> num_parameter_blocks_;
+};
+
+TEST_F(LiveIamfEncoderTest, CreateFailsWhenPipelined) {
+  user_metadata_.mutable_encoder_control_metadata()->set_pipeline_queue_depth(
+      2);
+
+  EXPECT_THAT(Create(), StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST_F(LiveIamfEncoderTest, ReportsAlgorithmicLatencyPerCodecConfig) {
+  auto live_encoder = CreateExpectOk();
+
+  const auto& latencies = live_encoder.GetAlgorithmicLatencies();
+  ASSERT_TRUE(latencies.contains(kCodecConfigId));
+  const auto& latency = latencies.at(kCodecConfigId);
+  EXPECT_EQ(latency.sample_rate, kSampleRate);
+  EXPECT_EQ(latency.num_samples_per_frame, kNumSamplesPerFrame);
+  // LPCM has no codec delay.
+  EXPECT_EQ(latency.codec_delay, 0);
+  EXPECT_EQ(latency.num_samples, kNumSamplesPerFrame);
+}
+
+TEST_F(LiveIamfEncoderTest, OutputsTemporalUnitsAsSoonAsFramesAreFull) {
+  auto live_encoder = CreateExpectOk();
+
+  // Chunks which do not align with the frames.
+  EXPECT_THAT(PushStereoSamples(live_encoder, 3), IsOk());
+  EXPECT_THAT(PushStereoSamples(live_encoder, 3), IsOk());
+  EXPECT_TRUE(start_timestamps_.empty());
+  EXPECT_THAT(PushStereoSamples(live_encoder, 3), IsOk());
+  EXPECT_THAT(start_timestamps_, ElementsAre(0));
+  EXPECT_THAT(PushStereoSamples(live_encoder, 11), IsOk());
+  EXPECT_THAT(start_timestamps_, ElementsAre(0, 8));
+}
+
+TEST_F(LiveIamfEncoderTest, WaitsForEveryChannel) {
+  auto live_encoder = CreateExpectOk();
+  const std::vector<InternalSampleType> kFrame(kNumSamplesPerFrame, 0.0);
+
+  EXPECT_THAT(
+      live_encoder.PushSamples(kAudioElementId, ChannelLabel::kL2, kFrame),
+      IsOk());
+  EXPECT_TRUE(start_timestamps_.empty());
+
+  EXPECT_THAT(
+      live_encoder.PushSamples(kAudioElementId, ChannelLabel::kR2, kFrame),
+      IsOk());
+  EXPECT_THAT(start_timestamps_, ElementsAre(0));
+}
+
+TEST_F(LiveIamfEncoderTest, FlushOutputsPartialFinalFrame) {
+  // The final frame is padded with 5 samples.
+  user_metadata_.mutable_audio_frame_metadata(0)->set_samples_to_trim_at_end(5);
+  auto live_encoder = CreateExpectOk();
+  EXPECT_THAT(PushStereoSamples(live_encoder, kNumSamplesPerFrame + 3),
+              IsOk());
+  EXPECT_THAT(start_timestamps_, ElementsAre(0));
+
+  EXPECT_THAT(live_encoder.Flush(), IsOk());
+
+  EXPECT_THAT(start_timestamps_, ElementsAre(0, 8));
+}
+
+TEST_F(LiveIamfEncoderTest, AddsParameterBlocksToTheirTemporalUnits) {
+  auto live_encoder = CreateExpectOk();
+
+  // Metadata may be pushed ahead of the samples it applies to.
+  EXPECT_THAT(live_encoder.PushParameterBlockMetadata(
+                  GetParameterBlockMetadata(0)),
+              IsOk());
+  EXPECT_THAT(live_encoder.PushParameterBlockMetadata(
+                  GetParameterBlockMetadata(8)),
+              IsOk());
+  EXPECT_THAT(PushStereoSamples(live_encoder, 2 * kNumSamplesPerFrame),
+              IsOk());
+  EXPECT_THAT(live_encoder.PushParameterBlockMetadata(
+                  GetParameterBlockMetadata(16)),
+              IsOk());
+  EXPECT_THAT(PushStereoSamples(live_encoder, kNumSamplesPerFrame), IsOk());
+
+  EXPECT_THAT(start_timestamps_, ElementsAre(0, 8, 16));
+  EXPECT_THAT(num_parameter_blocks_, ElementsAre(1, 1, 1));
+}
+
+TEST_F(LiveIamfEncoderTest, PushSamplesFailsForUnknownChannels) {
+  auto live_encoder = CreateExpectOk();
+  const std::vector<InternalSampleType> kFrame(kNumSamplesPerFrame, 0.0);
+
+  EXPECT_THAT(
+      live_encoder.PushSamples(kAudioElementId + 1, ChannelLabel::kL2, kFrame),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+  EXPECT_THAT(
+      live_encoder.PushSamples(kAudioElementId, ChannelLabel::kL3, kFrame),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST_F(LiveIamfEncoderTest, PushesFailAfterFlush) {
+  auto live_encoder = CreateExpectOk();
+  EXPECT_THAT(live_encoder.Flush(), IsOk());
+
+  EXPECT_THAT(PushStereoSamples(live_encoder, kNumSamplesPerFrame),
+              StatusIs(absl::StatusCode::kFailedPrecondition));
+  EXPECT_THAT(live_encoder.PushParameterBlockMetadata(
+                  GetParameterBlockMetadata(0)),
+              StatusIs(absl::StatusCode::kFailedPrecondition));
+  EXPECT_THAT(live_encoder.Flush(),
+              StatusIs(absl::StatusCode::kFailedPrecondition));
+}
+
+TEST_F(LiveIamfEncoderTest, ReturnsCallbackError) {
+  callback_status_ = absl::UnavailableError("Connection lost.");
+  auto live_encoder = CreateExpectOk();
+
+  EXPECT_THAT(PushStereoSamples(live_encoder, kNumSamplesPerFrame),
+              StatusIs(absl::StatusCode::kUnavailable));
+}
+
+}  // namespace
+}  // namespace iamf_tools
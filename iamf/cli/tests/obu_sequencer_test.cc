@@ -11,25 +11,33 @@
  */
 #include "iamf/cli/obu_sequencer.h"
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 #include <cstdint>
 #include <filesystem>
 #include <list>
 #include <memory>
 #include <optional>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/status/status_matchers.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "iamf/cli/audio_element_with_data.h"
 #include "iamf/cli/audio_frame_with_data.h"
 #include "iamf/cli/leb_generator.h"
 #include "iamf/cli/parameter_block_with_data.h"
+#include "iamf/cli/temporal_unit_index.h"
 #include "iamf/cli/tests/cli_test_utils.h"
+#include "iamf/common/read_bit_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/arbitrary_obu.h"
 #include "iamf/obu/audio_frame.h"
@@ -49,6 +57,7 @@ namespace iamf_tools {
 namespace {
 
 using ::absl_testing::IsOk;
+using ::testing::ElementsAre;
 
 constexpr DecodedUleb128 kCodecConfigId = 1;
 constexpr uint32_t kNumSamplesPerFrame = 8;
@@ -229,6 +238,63 @@ TEST(GenerateTemporalUnitMap, ParameterBlocksAreOrderedByAscendingParameterId) {
             expected_output_in_ascending_parameter_id_order);
 }
 
+TEST(GenerateTemporalUnitMap,
+     AddsParameterBlocksToEveryOverlappingTemporalUnit) {
+  constexpr int kNumTemporalUnits = 4;
+  const std::list<ArbitraryObu> kNoArbitraryObus;
+  absl::flat_hash_map<uint32_t, CodecConfigObu> codec_config_obus = {};
+  absl::flat_hash_map<uint32_t, AudioElementWithData> audio_elements = {};
+  AddLpcmCodecConfigWithIdAndSampleRate(kCodecConfigId, kSampleRate,
+                                        codec_config_obus);
+  AddAmbisonicsMonoAudioElementWithSubstreamIds(
+      kFirstAudioElementId, kCodecConfigId, {kFirstSubstreamId},
+      codec_config_obus, audio_elements);
+  std::list<AudioFrameWithData> audio_frames;
+  for (int i = 0; i < kNumTemporalUnits; ++i) {
+    AddEmptyAudioFrameWithAudioElementIdSubstreamIdAndTimestamps(
+        kFirstAudioElementId, kFirstSubstreamId, i * kNumSamplesPerFrame,
+        (i + 1) * kNumSamplesPerFrame, audio_elements, audio_frames);
+  }
+  PerIdParameterMetadata per_id_metadata =
+      CreatePerIdMetadataForDemixing(kFirstDemixingParameterId);
+  std::list<ParameterBlockWithData> parameter_blocks;
+  auto add_parameter_block = [&](DecodedUleb128 parameter_id,
+                                 int32_t start_timestamp,
+                                 int32_t end_timestamp) {
+    auto obu = std::make_unique<ParameterBlockObu>(ObuHeader(), parameter_id,
+                                                   per_id_metadata);
+    EXPECT_THAT(obu->InitializeSubblocks(), IsOk());
+    return &parameter_blocks.emplace_back(
+        ParameterBlockWithData{.obu = std::move(obu),
+                               .start_timestamp = start_timestamp,
+                               .end_timestamp = end_timestamp});
+  };
+  // Starts before the first temporal unit and ends during it.
+  const auto* early_block = add_parameter_block(1, -4, 4);
+  // Starts during the first temporal unit and ends during the third.
+  const auto* spanning_block = add_parameter_block(2, 4, 20);
+  // Exactly covers the last temporal unit.
+  const auto* aligned_block = add_parameter_block(3, 24, 32);
+  // Entirely after the last temporal unit.
+  add_parameter_block(4, 32, 40);
+
+  TemporalUnitMap temporal_unit_map;
+  EXPECT_THAT(
+      ObuSequencerBase::GenerateTemporalUnitMap(
+          audio_frames, parameter_blocks, kNoArbitraryObus, temporal_unit_map),
+      IsOk());
+
+  ASSERT_EQ(temporal_unit_map.size(), kNumTemporalUnits);
+  EXPECT_THAT(temporal_unit_map[0].parameter_blocks,
+              ElementsAre(early_block, spanning_block));
+  EXPECT_THAT(temporal_unit_map[8].parameter_blocks,
+              ElementsAre(spanning_block));
+  EXPECT_THAT(temporal_unit_map[16].parameter_blocks,
+              ElementsAre(spanning_block));
+  EXPECT_THAT(temporal_unit_map[24].parameter_blocks,
+              ElementsAre(aligned_block));
+}
+
 TEST(GenerateTemporalUnitMap, OmitsArbitraryObusWithNoInsertionTick) {
   const std::list<AudioFrameWithData> kNoAudioFrames;
   const std::list<ParameterBlockWithData> kNoParameterBlocks;
@@ -293,7 +359,7 @@ void ValidateWriteTemporalUnitSequence(
   }
 
   WriteBitBuffer result_wb(128);
-  int unused_num_samples;
+  int64_t unused_num_samples;
   EXPECT_THAT(ObuSequencerBase::WriteTemporalUnit(include_temporal_delimiters,
                                                   temporal_unit, result_wb,
                                                   unused_num_samples),
@@ -444,7 +510,7 @@ TEST(WriteTemporalUnit, AddsNumberOfUntrimmedSamplesToNumSamples) {
   };
 
   WriteBitBuffer undefined_wb(128);
-  int num_samples = 0;
+  int64_t num_samples = 0;
   EXPECT_THAT(ObuSequencerBase::WriteTemporalUnit(
                   kDoNotIncludeTemporalDelimiters, temporal_unit, undefined_wb,
                   num_samples),
@@ -477,7 +543,7 @@ TEST(WriteTemporalUnit, FailsWhenAudioFrameHasNoAudioElement) {
   };
 
   WriteBitBuffer undefined_wb(128);
-  int unused_num_samples;
+  int64_t unused_num_samples;
   EXPECT_FALSE(ObuSequencerBase::WriteTemporalUnit(
                    kDoNotIncludeTemporalDelimiters, temporal_unit, undefined_wb,
                    unused_num_samples)
@@ -504,7 +570,7 @@ TEST(WriteTemporalUnit, FailsWhenAudioElementHasNoCodecConfig) {
   };
 
   WriteBitBuffer undefined_wb(128);
-  int unused_num_samples;
+  int64_t unused_num_samples;
   EXPECT_FALSE(ObuSequencerBase::WriteTemporalUnit(
                    kDoNotIncludeTemporalDelimiters, temporal_unit, undefined_wb,
                    unused_num_samples)
@@ -1030,5 +1096,506 @@ TEST_F(ObuSequencerTest,
                    .ok());
 }
 
+TEST_F(ObuSequencerTest, PushTemporalUnitFailsBeforePushDescriptorObus) {
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(std::string(kOmitOutputIamfFile),
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+
+  EXPECT_FALSE(sequencer
+                   .PushTemporalUnit(audio_frames_.front().start_timestamp,
+                                     temporal_unit)
+                   .ok());
+}
+
+TEST_F(ObuSequencerTest, PushDescriptorObusFailsWhenCalledTwice) {
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(std::string(kOmitOutputIamfFile),
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create());
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+
+  EXPECT_FALSE(sequencer
+                   .PushDescriptorObus(*ia_sequence_header_obu_,
+                                       codec_config_obus_, audio_elements_,
+                                       mix_presentation_obus_, arbitrary_obus_)
+                   .ok());
+}
+
+TEST_F(ObuSequencerTest, PushTemporalUnitFailsAfterClose) {
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(std::string(kOmitOutputIamfFile),
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create());
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  EXPECT_THAT(sequencer.Close(), IsOk());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+
+  EXPECT_FALSE(sequencer
+                   .PushTemporalUnit(audio_frames_.front().start_timestamp,
+                                     temporal_unit)
+                   .ok());
+}
+
+TEST_F(ObuSequencerTest, PushTemporalUnitWritesSameFileAsPickAndPlace) {
+  const std::string kPickAndPlaceFilename =
+      GetAndCleanupOutputFileName("_pick_and_place.iamf");
+  const std::string kPushFilename = GetAndCleanupOutputFileName("_push.iamf");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf pick_and_place_sequencer(kPickAndPlaceFilename,
+                                            kIncludeTemporalDelimiters,
+                                            *LebGenerator::Create());
+  ASSERT_THAT(pick_and_place_sequencer.PickAndPlace(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, audio_frames_,
+                  parameter_blocks_, arbitrary_obus_),
+              IsOk());
+
+  ObuSequencerIamf push_sequencer(kPushFilename, kIncludeTemporalDelimiters,
+                                  *LebGenerator::Create());
+  EXPECT_THAT(push_sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+  EXPECT_THAT(push_sequencer.PushTemporalUnit(
+                  audio_frames_.front().start_timestamp, temporal_unit),
+              IsOk());
+  EXPECT_THAT(push_sequencer.Close(), IsOk());
+
+  std::vector<uint8_t> pick_and_place_bytes;
+  ASSERT_THAT(ReadFileToBytes(kPickAndPlaceFilename, pick_and_place_bytes),
+              IsOk());
+  std::vector<uint8_t> push_bytes;
+  ASSERT_THAT(ReadFileToBytes(kPushFilename, push_bytes), IsOk());
+  EXPECT_EQ(push_bytes, pick_and_place_bytes);
+}
+
+TEST_F(ObuSequencerTest, PushTemporalUnitWritesSameBytesAsWriteTemporalUnit) {
+  const std::string kPushFilename = GetAndCleanupOutputFileName(".iamf");
+  InitObusForOneFrameIaSequence();
+  // Audio frames are written by reference; the footer must still follow them.
+  audio_frames_.front().obu.footer_ = {0xaa, 0xbb};
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+  WriteBitBuffer expected_wb(0);
+  int64_t unused_num_samples = 0;
+  ASSERT_THAT(ObuSequencerBase::WriteTemporalUnit(kIncludeTemporalDelimiters,
+                                                  temporal_unit, expected_wb,
+                                                  unused_num_samples),
+              IsOk());
+  const std::vector<uint8_t>& expected_temporal_unit = expected_wb.bit_buffer();
+
+  ObuSequencerIamf push_sequencer(kPushFilename, kIncludeTemporalDelimiters,
+                                  *LebGenerator::Create());
+  EXPECT_THAT(push_sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  EXPECT_THAT(push_sequencer.PushTemporalUnit(
+                  audio_frames_.front().start_timestamp, temporal_unit),
+              IsOk());
+  EXPECT_THAT(push_sequencer.Close(), IsOk());
+
+  std::vector<uint8_t> push_bytes;
+  ASSERT_THAT(ReadFileToBytes(kPushFilename, push_bytes), IsOk());
+  ASSERT_GE(push_bytes.size(), expected_temporal_unit.size());
+  EXPECT_EQ(std::vector<uint8_t>(push_bytes.end() -
+                                     expected_temporal_unit.size(),
+                                 push_bytes.end()),
+            expected_temporal_unit);
+}
+
+TEST_F(ObuSequencerTest,
+       UpdateDescriptorObusAndCloseRewritesFinalizedDescriptorObus) {
+  const std::string kExpectedFilename =
+      GetAndCleanupOutputFileName("_expected.iamf");
+  const std::string kPushFilename = GetAndCleanupOutputFileName("_push.iamf");
+  InitObusForOneFrameIaSequence();
+  std::list<MixPresentationObu> finalized_mix_presentation_obus =
+      mix_presentation_obus_;
+  finalized_mix_presentation_obus.front()
+      .sub_mixes_[0]
+      .layouts[0]
+      .loudness.integrated_loudness = 123;
+  ObuSequencerIamf expected_sequencer(kExpectedFilename,
+                                      kDoNotIncludeTemporalDelimiters,
+                                      *LebGenerator::Create());
+  ASSERT_THAT(expected_sequencer.PickAndPlace(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, finalized_mix_presentation_obus,
+                  audio_frames_, parameter_blocks_, arbitrary_obus_),
+              IsOk());
+
+  ObuSequencerIamf push_sequencer(kPushFilename,
+                                  kDoNotIncludeTemporalDelimiters,
+                                  *LebGenerator::Create());
+  EXPECT_THAT(push_sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+  EXPECT_THAT(push_sequencer.PushTemporalUnit(
+                  audio_frames_.front().start_timestamp, temporal_unit),
+              IsOk());
+  EXPECT_THAT(push_sequencer.UpdateDescriptorObusAndClose(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, finalized_mix_presentation_obus,
+                  arbitrary_obus_),
+              IsOk());
+
+  std::vector<uint8_t> expected_bytes;
+  ASSERT_THAT(ReadFileToBytes(kExpectedFilename, expected_bytes), IsOk());
+  std::vector<uint8_t> push_bytes;
+  ASSERT_THAT(ReadFileToBytes(kPushFilename, push_bytes), IsOk());
+  EXPECT_EQ(push_bytes, expected_bytes);
+}
+
+TEST_F(ObuSequencerTest,
+       UpdateDescriptorObusAndCloseLeavesNoFileWhenDescriptorSizeChanges) {
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(kOutputIamfFilename,
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create());
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  // Signalling true peak adds an extra field to the loudness info.
+  auto& loudness =
+      mix_presentation_obus_.front().sub_mixes_[0].layouts[0].loudness;
+  loudness.info_type |= LoudnessInfo::kTruePeak;
+
+  EXPECT_FALSE(sequencer
+                   .UpdateDescriptorObusAndClose(
+                       *ia_sequence_header_obu_, codec_config_obus_,
+                       audio_elements_, mix_presentation_obus_,
+                       arbitrary_obus_)
+                   .ok());
+
+  EXPECT_FALSE(std::filesystem::exists(kOutputIamfFilename));
+}
+
+TEST_F(ObuSequencerTest,
+       UpdateDescriptorObusAndCloseFillsReservedBytesWhenMixPresentationGrows) {
+  constexpr int64_t kReservedMixPresentationBytes = 2;
+  const std::string kExpectedFilename =
+      GetAndCleanupOutputFileName("_expected.iamf");
+  const std::string kPushFilename = GetAndCleanupOutputFileName("_push.iamf");
+  InitObusForOneFrameIaSequence();
+  const auto leb_generator =
+      LebGenerator::Create(LebGenerator::GenerationMode::kFixedSize, 4);
+  ASSERT_NE(leb_generator, nullptr);
+  // Signalling true peak adds two bytes to the loudness info, which exactly
+  // uses up the reserved bytes.
+  std::list<MixPresentationObu> finalized_mix_presentation_obus =
+      mix_presentation_obus_;
+  auto& loudness = finalized_mix_presentation_obus.front()
+                       .sub_mixes_[0]
+                       .layouts[0]
+                       .loudness;
+  loudness.info_type |= LoudnessInfo::kTruePeak;
+  loudness.true_peak = 123;
+  ObuSequencerIamf expected_sequencer(
+      kExpectedFilename, kDoNotIncludeTemporalDelimiters, *leb_generator);
+  ASSERT_THAT(expected_sequencer.PickAndPlace(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, finalized_mix_presentation_obus,
+                  audio_frames_, parameter_blocks_, arbitrary_obus_),
+              IsOk());
+
+  ObuSequencerIamf push_sequencer(
+      kPushFilename, kDoNotIncludeTemporalDelimiters, *leb_generator,
+      kReservedMixPresentationBytes);
+  EXPECT_THAT(push_sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+  EXPECT_THAT(push_sequencer.PushTemporalUnit(
+                  audio_frames_.front().start_timestamp, temporal_unit),
+              IsOk());
+  EXPECT_THAT(push_sequencer.UpdateDescriptorObusAndClose(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, finalized_mix_presentation_obus,
+                  arbitrary_obus_),
+              IsOk());
+
+  std::vector<uint8_t> expected_bytes;
+  ASSERT_THAT(ReadFileToBytes(kExpectedFilename, expected_bytes), IsOk());
+  std::vector<uint8_t> push_bytes;
+  ASSERT_THAT(ReadFileToBytes(kPushFilename, push_bytes), IsOk());
+  EXPECT_EQ(push_bytes, expected_bytes);
+}
+
+TEST_F(ObuSequencerTest,
+       UpdateDescriptorObusAndClosePadsUnusedReservedBytesInFooter) {
+  constexpr int64_t kReservedMixPresentationBytes = 4;
+  const std::string kExpectedFilename =
+      GetAndCleanupOutputFileName("_expected.iamf");
+  const std::string kPushFilename = GetAndCleanupOutputFileName("_push.iamf");
+  InitObusForOneFrameIaSequence();
+  const auto leb_generator =
+      LebGenerator::Create(LebGenerator::GenerationMode::kFixedSize, 4);
+  ASSERT_NE(leb_generator, nullptr);
+  // The unused reserved bytes are expected to be written as zero padding.
+  std::list<MixPresentationObu> padded_mix_presentation_obus =
+      mix_presentation_obus_;
+  padded_mix_presentation_obus.front().footer_ =
+      std::vector<uint8_t>(kReservedMixPresentationBytes, 0);
+  ObuSequencerIamf expected_sequencer(
+      kExpectedFilename, kDoNotIncludeTemporalDelimiters, *leb_generator);
+  ASSERT_THAT(expected_sequencer.PickAndPlace(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, padded_mix_presentation_obus,
+                  audio_frames_, parameter_blocks_, arbitrary_obus_),
+              IsOk());
+
+  ObuSequencerIamf push_sequencer(
+      kPushFilename, kDoNotIncludeTemporalDelimiters, *leb_generator,
+      kReservedMixPresentationBytes);
+  EXPECT_THAT(push_sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+      .parameter_blocks = {&parameter_blocks_.front()},
+  };
+  EXPECT_THAT(push_sequencer.PushTemporalUnit(
+                  audio_frames_.front().start_timestamp, temporal_unit),
+              IsOk());
+  EXPECT_THAT(push_sequencer.UpdateDescriptorObusAndClose(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+
+  std::vector<uint8_t> expected_bytes;
+  ASSERT_THAT(ReadFileToBytes(kExpectedFilename, expected_bytes), IsOk());
+  std::vector<uint8_t> push_bytes;
+  ASSERT_THAT(ReadFileToBytes(kPushFilename, push_bytes), IsOk());
+  EXPECT_EQ(push_bytes, expected_bytes);
+}
+
+TEST_F(ObuSequencerTest,
+       UpdateDescriptorObusAndCloseFailsWhenMixPresentationExceedsReserve) {
+  constexpr int64_t kReservedMixPresentationBytes = 1;
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(
+      kOutputIamfFilename, kDoNotIncludeTemporalDelimiters,
+      *LebGenerator::Create(LebGenerator::GenerationMode::kFixedSize, 4),
+      kReservedMixPresentationBytes);
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  // Signalling true peak adds two bytes, but only one byte is reserved.
+  mix_presentation_obus_.front().sub_mixes_[0].layouts[0].loudness.info_type |=
+      LoudnessInfo::kTruePeak;
+
+  EXPECT_FALSE(sequencer
+                   .UpdateDescriptorObusAndClose(
+                       *ia_sequence_header_obu_, codec_config_obus_,
+                       audio_elements_, mix_presentation_obus_,
+                       arbitrary_obus_)
+                   .ok());
+
+  EXPECT_FALSE(std::filesystem::exists(kOutputIamfFilename));
+}
+
+TEST_F(ObuSequencerTest, AbortLeavesNoFile) {
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(kOutputIamfFilename,
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create());
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  EXPECT_TRUE(std::filesystem::exists(kOutputIamfFilename));
+
+  sequencer.Abort();
+
+  EXPECT_FALSE(std::filesystem::exists(kOutputIamfFilename));
+}
+
+TEST_F(ObuSequencerTest, CloseWritesIndexWhichLocatesTheTemporalUnits) {
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  const std::string kIndexFilename = GetAndCleanupOutputFileName(".iaix");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(kOutputIamfFilename, kIncludeTemporalDelimiters,
+                             *LebGenerator::Create(),
+                             /*reserved_mix_presentation_bytes=*/0,
+                             kIndexFilename);
+  ASSERT_THAT(
+      sequencer.PickAndPlace(*ia_sequence_header_obu_, codec_config_obus_,
+                             audio_elements_, mix_presentation_obus_,
+                             audio_frames_, parameter_blocks_, arbitrary_obus_),
+      IsOk());
+
+  std::vector<uint8_t> iamf_bytes;
+  ASSERT_THAT(ReadFileToBytes(kOutputIamfFilename, iamf_bytes), IsOk());
+  std::vector<uint8_t> index_bytes;
+  ASSERT_THAT(ReadFileToBytes(kIndexFilename, index_bytes), IsOk());
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      index_bytes.size(), absl::MakeConstSpan(index_bytes));
+  const auto index = TemporalUnitIndex::CreateFromBuffer(*rb);
+  ASSERT_THAT(index, IsOk());
+  EXPECT_EQ(index->GetDescriptorObusOffset(), 0);
+  const int64_t descriptor_obus_size = index->GetDescriptorObusSize();
+  EXPECT_GT(descriptor_obus_size, 0);
+  EXPECT_THAT(index->GetTemporalUnits(),
+              ElementsAre(TemporalUnitIndexEntry{
+                  .start_timestamp = audio_frames_.front().start_timestamp,
+                  .offset = descriptor_obus_size,
+                  .size = static_cast<int64_t>(iamf_bytes.size()) -
+                          descriptor_obus_size}));
+}
+
+TEST_F(ObuSequencerTest, CloseWritesIndexWithArbitraryObuOnlyTemporalUnit) {
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  const std::string kIndexFilename = GetAndCleanupOutputFileName(".iaix");
+  InitObusForOneFrameIaSequence();
+  AddEmptyAudioFrameWithAudioElementIdSubstreamIdAndTimestamps(
+      kFirstAudioElementId, kFirstSubstreamId, 16, 32, audio_elements_,
+      audio_frames_);
+  // The arbitrary OBU starts a temporal unit between the two audio frames.
+  constexpr InternalTimestamp kArbitraryObuTick = 8;
+  arbitrary_obus_.emplace_back(
+      ArbitraryObu(kObuIaReserved25, ObuHeader(), {},
+                   ArbitraryObu::kInsertionHookAfterAudioFramesAtTick,
+                   kArbitraryObuTick));
+  ObuSequencerIamf sequencer(kOutputIamfFilename, kIncludeTemporalDelimiters,
+                             *LebGenerator::Create(),
+                             /*reserved_mix_presentation_bytes=*/0,
+                             kIndexFilename);
+  ASSERT_THAT(
+      sequencer.PickAndPlace(*ia_sequence_header_obu_, codec_config_obus_,
+                             audio_elements_, mix_presentation_obus_,
+                             audio_frames_, parameter_blocks_, arbitrary_obus_),
+      IsOk());
+
+  std::vector<uint8_t> index_bytes;
+  ASSERT_THAT(ReadFileToBytes(kIndexFilename, index_bytes), IsOk());
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      index_bytes.size(), absl::MakeConstSpan(index_bytes));
+  const auto index = TemporalUnitIndex::CreateFromBuffer(*rb);
+  ASSERT_THAT(index, IsOk());
+  const auto& temporal_units = index->GetTemporalUnits();
+  ASSERT_EQ(temporal_units.size(), 3);
+  EXPECT_EQ(temporal_units[0].start_timestamp, 0);
+  EXPECT_EQ(temporal_units[1].start_timestamp, kArbitraryObuTick);
+  EXPECT_EQ(temporal_units[2].start_timestamp, 16);
+  EXPECT_TRUE(std::filesystem::exists(kOutputIamfFilename));
+}
+
+TEST_F(ObuSequencerTest,
+       PushTemporalUnitFailsWhenStartTimestampDoesNotMatchAudioFrames) {
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(std::string(kOmitOutputIamfFile),
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create());
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  const TemporalUnit temporal_unit = {
+      .audio_frames = {&audio_frames_.front()},
+  };
+
+  EXPECT_FALSE(sequencer
+                   .PushTemporalUnit(audio_frames_.front().start_timestamp + 1,
+                                     temporal_unit)
+                   .ok());
+}
+
+TEST_F(ObuSequencerTest, AbortLeavesNoIndexFile) {
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  const std::string kIndexFilename = GetAndCleanupOutputFileName(".iaix");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(kOutputIamfFilename,
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create(),
+                             /*reserved_mix_presentation_bytes=*/0,
+                             kIndexFilename);
+  EXPECT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+
+  sequencer.Abort();
+
+  EXPECT_FALSE(std::filesystem::exists(kOutputIamfFilename));
+  EXPECT_FALSE(std::filesystem::exists(kIndexFilename));
+}
+
+#ifdef __linux__
+// Closes the file descriptor open on `file_path` behind the back of its owner,
+// so the owner fails to close it later.
+void CloseFileDescriptorOf(const std::filesystem::path& file_path) {
+  const std::filesystem::path canonical_path =
+      std::filesystem::weakly_canonical(file_path);
+  for (const auto& entry :
+       std::filesystem::directory_iterator("/proc/self/fd")) {
+    std::error_code error_code;
+    const auto target = std::filesystem::read_symlink(entry.path(), error_code);
+    if (!error_code && target == canonical_path) {
+      ASSERT_EQ(close(std::stoi(entry.path().filename().string())), 0);
+      return;
+    }
+  }
+  FAIL() << "No file descriptor is open on " << file_path;
+}
+
+TEST_F(ObuSequencerTest, CloseRemovesOutputFilesWhenClosingTheIamfFileFails) {
+  const std::string kOutputIamfFilename = GetAndCleanupOutputFileName(".iamf");
+  const std::string kIndexFilename = GetAndCleanupOutputFileName(".iaix");
+  InitObusForOneFrameIaSequence();
+  ObuSequencerIamf sequencer(kOutputIamfFilename,
+                             kDoNotIncludeTemporalDelimiters,
+                             *LebGenerator::Create(),
+                             /*reserved_mix_presentation_bytes=*/0,
+                             kIndexFilename);
+  ASSERT_THAT(sequencer.PushDescriptorObus(
+                  *ia_sequence_header_obu_, codec_config_obus_,
+                  audio_elements_, mix_presentation_obus_, arbitrary_obus_),
+              IsOk());
+  CloseFileDescriptorOf(kOutputIamfFilename);
+
+  // The index is written before the .iamf file fails to close.
+  EXPECT_FALSE(sequencer.Close().ok());
+
+  EXPECT_FALSE(std::filesystem::exists(kOutputIamfFilename));
+  EXPECT_FALSE(std::filesystem::exists(kIndexFilename));
+}
+#endif
+
 }  // namespace
 }  // namespace iamf_tools
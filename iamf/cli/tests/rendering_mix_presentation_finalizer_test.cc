@@ -48,6 +48,7 @@
 #include "iamf/cli/user_metadata_builder/iamf_input_layout.h"
 #include "iamf/cli/wav_reader.h"
 #include "iamf/cli/wav_writer.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/obu/audio_element.h"
 #include "iamf/obu/codec_config.h"
 #include "iamf/obu/mix_presentation.h"
@@ -61,6 +62,7 @@ namespace {
 using ::absl_testing::IsOk;
 using ::testing::_;
 using testing::Return;
+using testing::ResultOf;
 using enum ChannelLabel::Label;
 
 constexpr int64_t kStartTime = 0;
@@ -100,7 +102,7 @@ class MockRenderer : public AudioElementRendererBase {
 
   MOCK_METHOD(
       absl::Status, RenderSamples,
-      (absl::Span<const std::vector<InternalSampleType>> samples_to_render,
+      (const PlanarSampleBuffer<InternalSampleType>& samples_to_render,
        std::vector<InternalSampleType>& rendered_samples),
       (override));
 };
@@ -410,9 +412,14 @@ TEST_F(FinalizerTest, ForwardsOrderedSamplesToRenderer) {
   std::vector<InternalSampleType> rendered_samples;
   const std::vector<std::vector<InternalSampleType>>
       kExpectedTimeChannelOrderedSamples = {{0, 2}, {1, 3}};
+  auto to_time_channel =
+      [](const PlanarSampleBuffer<InternalSampleType>& samples) {
+        return samples.ToTimeChannel();
+      };
   EXPECT_CALL(*mock_renderer,
-              RenderSamples(
-                  absl::MakeConstSpan(kExpectedTimeChannelOrderedSamples), _));
+              RenderSamples(ResultOf(to_time_channel,
+                                     kExpectedTimeChannelOrderedSamples),
+                            _));
   auto mock_renderer_factory = std::make_unique<MockRendererFactory>();
   ASSERT_NE(mock_renderer_factory, nullptr);
   EXPECT_CALL(*mock_renderer_factory,
@@ -824,6 +831,78 @@ TEST_F(FinalizerTest, FinalizeFailsIfCalledTwice) {
   EXPECT_FALSE(finalizer.Finalize(validate_loudness_, obus_to_finalize_).ok());
 }
 
+TEST_F(FinalizerTest, FinalizeSucceedsAgainAfterReset) {
+  InitPrerequisiteObusForStereoInput(kAudioElementId);
+  AddMixPresentationObuForStereoOutput(kMixPresentationId);
+  renderer_factory_ = std::make_unique<RendererFactory>();
+  auto finalizer = CreateFinalizerExpectOk();
+  EXPECT_THAT(finalizer.Finalize(validate_loudness_, obus_to_finalize_),
+              IsOk());
+
+  EXPECT_THAT(finalizer.Reset(loudness_calculator_factory_.get(),
+                              wav_writer_factory_, obus_to_finalize_),
+              IsOk());
+
+  EXPECT_THAT(finalizer.Finalize(validate_loudness_, obus_to_finalize_),
+              IsOk());
+}
+
+TEST_F(FinalizerTest, ResetReusesRenderers) {
+  InitPrerequisiteObusForStereoInput(kAudioElementId);
+  AddMixPresentationObuForStereoOutput(kMixPresentationId);
+  const LabelSamplesMap kLabelToSamples = {{kL2, {0}}, {kR2, {2}}};
+  AddLabeledFrame(kAudioElementId, kLabelToSamples, kEndTime);
+  // The one renderer is used to render both IA Sequences.
+  auto mock_renderer = std::make_unique<MockRenderer>();
+  EXPECT_CALL(*mock_renderer, RenderSamples(_, _)).Times(2);
+  auto mock_renderer_factory = std::make_unique<MockRendererFactory>();
+  EXPECT_CALL(*mock_renderer_factory,
+              CreateRendererForLayout(_, _, _, _, _, _, _))
+      .WillOnce(Return(std::move(mock_renderer)));
+  renderer_factory_ = std::move(mock_renderer_factory);
+  auto finalizer = CreateFinalizerExpectOk();
+  IterativeRenderingExpectOk(finalizer, parameter_blocks_);
+
+  EXPECT_THAT(finalizer.Reset(loudness_calculator_factory_.get(),
+                              wav_writer_factory_, obus_to_finalize_),
+              IsOk());
+
+  IterativeRenderingExpectOk(finalizer, parameter_blocks_);
+}
+
+TEST_F(FinalizerTest, ResetCreatesNewLoudnessCalculators) {
+  PrepareObusForOneSamplePassThroughMono();
+  auto mock_loudness_calculator_factory =
+      std::make_unique<MockLoudnessCalculatorFactory>();
+  EXPECT_CALL(*mock_loudness_calculator_factory,
+              CreateLoudnessCalculator(_, _, _))
+      .Times(2);
+  renderer_factory_ = std::make_unique<RendererFactory>();
+  loudness_calculator_factory_ = std::move(mock_loudness_calculator_factory);
+  auto finalizer = CreateFinalizerExpectOk();
+  IterativeRenderingExpectOk(finalizer, parameter_blocks_);
+
+  EXPECT_THAT(finalizer.Reset(loudness_calculator_factory_.get(),
+                              wav_writer_factory_, obus_to_finalize_),
+              IsOk());
+}
+
+TEST_F(FinalizerTest, ResetCreatesNewWavFiles) {
+  PrepareObusForOneSamplePassThroughMono();
+  ConfigureWavWriterFactoryToProduceFirstSubMixFirstLayout();
+  renderer_factory_ = std::make_unique<RendererFactory>();
+  auto finalizer = CreateFinalizerExpectOk();
+  IterativeRenderingExpectOk(finalizer, parameter_blocks_);
+  ASSERT_TRUE(std::filesystem::remove(GetFirstSubmixFirstLayoutExpectedPath()));
+
+  EXPECT_THAT(finalizer.Reset(loudness_calculator_factory_.get(),
+                              wav_writer_factory_, obus_to_finalize_),
+              IsOk());
+  IterativeRenderingExpectOk(finalizer, parameter_blocks_);
+
+  EXPECT_TRUE(std::filesystem::exists(GetFirstSubmixFirstLayoutExpectedPath()));
+}
+
 // =========== Tests for PushTemporalUnit ===========
 // TODO(b/380110994): Add more tests for PushTemporalUnit. Check that rendered
 // output is written to wav file appropriately.
@@ -850,6 +929,20 @@ TEST_F(FinalizerTest, PushTemporalUnitSucceedsWithValidInput) {
       IsOk());
 }
 
+TEST_F(FinalizerTest, PushTemporalUnitFailsAfterFinalize) {
+  PrepareObusForOneSamplePassThroughMono();
+  renderer_factory_ = std::make_unique<RendererFactory>();
+  auto finalizer = CreateFinalizerExpectOk();
+  EXPECT_THAT(finalizer.Finalize(validate_loudness_, obus_to_finalize_),
+              IsOk());
+
+  EXPECT_FALSE(finalizer
+                   .PushTemporalUnit(ordered_labeled_frames_.front(),
+                                     /*start_timestamp=*/0, kEndTime,
+                                     parameter_blocks_)
+                   .ok());
+}
+
 TEST_F(FinalizerTest, FullIterativeRenderingSucceedsWithValidInput) {
   InitPrerequisiteObusForStereoInput(kAudioElementId);
   AddMixPresentationObuForStereoOutput(kMixPresentationId);
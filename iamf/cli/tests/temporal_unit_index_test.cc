@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/cli/temporal_unit_index.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/status_matchers.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/common/read_bit_buffer.h"
+#include "iamf/common/write_bit_buffer.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::absl_testing::StatusIs;
+using ::testing::ElementsAreArray;
+
+constexpr int64_t kBufferCapacity = 1024;
+constexpr int64_t kDescriptorObusSize = 100;
+constexpr int64_t kTemporalUnitSize = 50;
+constexpr int64_t kTemporalUnitDuration = 1024;
+
+std::vector<uint8_t> WriteIndex(const TemporalUnitIndexBuilder& builder) {
+  WriteBitBuffer wb(kBufferCapacity);
+  EXPECT_THAT(builder.Write(wb), IsOk());
+  return wb.bit_buffer();
+}
+
+TemporalUnitIndexBuilder BuildIndexWithThreeTemporalUnits() {
+  TemporalUnitIndexBuilder builder;
+  EXPECT_THAT(builder.SetDescriptorObus(0, kDescriptorObusSize), IsOk());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_THAT(
+        builder.AddTemporalUnit(i * kTemporalUnitDuration,
+                                kDescriptorObusSize + i * kTemporalUnitSize,
+                                kTemporalUnitSize),
+        IsOk());
+  }
+  return builder;
+}
+
+TEST(TemporalUnitIndexBuilder, AddTemporalUnitFailsWithNegativeSize) {
+  TemporalUnitIndexBuilder builder;
+
+  EXPECT_FALSE(builder.AddTemporalUnit(0, kDescriptorObusSize, -1).ok());
+}
+
+TEST(TemporalUnitIndexBuilder,
+     AddTemporalUnitFailsWhenTimestampsAreNotIncreasing) {
+  TemporalUnitIndexBuilder builder;
+  ASSERT_THAT(builder.AddTemporalUnit(kTemporalUnitDuration,
+                                      kDescriptorObusSize, kTemporalUnitSize),
+              IsOk());
+
+  EXPECT_FALSE(builder
+                   .AddTemporalUnit(kTemporalUnitDuration,
+                                    kDescriptorObusSize + kTemporalUnitSize,
+                                    kTemporalUnitSize)
+                   .ok());
+}
+
+TEST(TemporalUnitIndexBuilder, AddTemporalUnitFailsWhenTemporalUnitsOverlap) {
+  TemporalUnitIndexBuilder builder;
+  ASSERT_THAT(
+      builder.AddTemporalUnit(0, kDescriptorObusSize, kTemporalUnitSize),
+      IsOk());
+
+  EXPECT_FALSE(builder
+                   .AddTemporalUnit(kTemporalUnitDuration,
+                                    kDescriptorObusSize + kTemporalUnitSize - 1,
+                                    kTemporalUnitSize)
+                   .ok());
+}
+
+TEST(TemporalUnitIndex, CreateFromBufferReadsWrittenIndex) {
+  const TemporalUnitIndexBuilder builder = BuildIndexWithThreeTemporalUnits();
+  const std::vector<uint8_t> index_bytes = WriteIndex(builder);
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(index_bytes));
+
+  const auto index = TemporalUnitIndex::CreateFromBuffer(*rb);
+  ASSERT_THAT(index, IsOk());
+
+  EXPECT_EQ(index->GetDescriptorObusOffset(), 0);
+  EXPECT_EQ(index->GetDescriptorObusSize(), kDescriptorObusSize);
+  EXPECT_THAT(index->GetTemporalUnits(),
+              ElementsAreArray(builder.GetIndex().GetTemporalUnits()));
+}
+
+TEST(TemporalUnitIndex, CreateFromBufferFailsWithUnknownIndexCode) {
+  std::vector<uint8_t> index_bytes =
+      WriteIndex(BuildIndexWithThreeTemporalUnits());
+  index_bytes[0] ^= 0xff;
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(index_bytes));
+
+  EXPECT_THAT(TemporalUnitIndex::CreateFromBuffer(*rb),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(TemporalUnitIndex, CreateFromBufferFailsWhenIndexIsTruncated) {
+  std::vector<uint8_t> index_bytes =
+      WriteIndex(BuildIndexWithThreeTemporalUnits());
+  index_bytes.pop_back();
+  auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
+      kBufferCapacity, absl::MakeConstSpan(index_bytes));
+
+  EXPECT_FALSE(TemporalUnitIndex::CreateFromBuffer(*rb).ok());
+}
+
+TEST(FindTemporalUnit, FindsTemporalUnitWhichStartsAtTimestamp) {
+  const TemporalUnitIndexBuilder builder = BuildIndexWithThreeTemporalUnits();
+
+  const auto entry =
+      builder.GetIndex().FindTemporalUnit(kTemporalUnitDuration);
+  ASSERT_THAT(entry, IsOk());
+
+  EXPECT_EQ(entry->start_timestamp, kTemporalUnitDuration);
+  EXPECT_EQ(entry->offset, kDescriptorObusSize + kTemporalUnitSize);
+  EXPECT_EQ(entry->size, kTemporalUnitSize);
+}
+
+TEST(FindTemporalUnit, FindsTemporalUnitWhichCoversTimestamp) {
+  const TemporalUnitIndexBuilder builder = BuildIndexWithThreeTemporalUnits();
+
+  const auto entry =
+      builder.GetIndex().FindTemporalUnit(2 * kTemporalUnitDuration - 1);
+  ASSERT_THAT(entry, IsOk());
+
+  EXPECT_EQ(entry->start_timestamp, kTemporalUnitDuration);
+}
+
+TEST(FindTemporalUnit, FindsLastTemporalUnitForLaterTimestamps) {
+  const TemporalUnitIndexBuilder builder = BuildIndexWithThreeTemporalUnits();
+
+  const auto entry =
+      builder.GetIndex().FindTemporalUnit(100 * kTemporalUnitDuration);
+  ASSERT_THAT(entry, IsOk());
+
+  EXPECT_EQ(entry->start_timestamp, 2 * kTemporalUnitDuration);
+}
+
+TEST(FindTemporalUnit, ReturnsNotFoundBeforeTheFirstTemporalUnit) {
+  const TemporalUnitIndexBuilder builder = BuildIndexWithThreeTemporalUnits();
+
+  EXPECT_THAT(builder.GetIndex().FindTemporalUnit(-1),
+              StatusIs(absl::StatusCode::kNotFound));
+}
+
+}  // namespace
+}  // namespace iamf_tools
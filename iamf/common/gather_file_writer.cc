@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/common/gather_file_writer.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/log/log.h"
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "iamf/common/macros.h"
+
+namespace iamf_tools {
+
+namespace {
+
+absl::Status ValidateOverwrite(int64_t offset, int64_t num_bytes,
+                               int64_t size) {
+  if (offset < 0 || offset + num_bytes > size) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Cannot overwrite ", num_bytes, " bytes at offset= ", offset,
+        " in a file of size= ", size));
+  }
+  return absl::OkStatus();
+}
+
+#ifndef _WIN32
+absl::Status SystemCallError(absl::string_view operation) {
+  return absl::UnknownError(absl::StrCat("Failed to ", operation,
+                                         " the output file with error: ",
+                                         std::strerror(errno), "."));
+}
+
+// Neither call reports an error when it writes nothing, but retrying would not
+// make progress either.
+absl::Status NoProgressError(absl::string_view operation) {
+  return absl::UnknownError(absl::StrCat(
+      "Failed to ", operation, " the output file: no bytes were written."));
+}
+#endif
+
+}  // namespace
+
+#ifdef _WIN32
+
+std::unique_ptr<GatherFileWriter> GatherFileWriter::Create(
+    const std::filesystem::path& file_path) {
+  std::fstream file(file_path, std::fstream::out | std::ios::binary);
+  if (!file) {
+    LOG(ERROR) << "Error opening " << file_path;
+    return nullptr;
+  }
+  return absl::WrapUnique(new GatherFileWriter(std::move(file)));
+}
+
+GatherFileWriter::GatherFileWriter(std::fstream file)
+    : file_(std::move(file)) {}
+
+GatherFileWriter::~GatherFileWriter() {
+  if (is_open_) {
+    file_.close();
+  }
+}
+
+absl::Status GatherFileWriter::Write(
+    absl::Span<const absl::Span<const uint8_t>> spans) {
+  if (!is_open_) {
+    return absl::FailedPreconditionError("The file is closed.");
+  }
+  for (const auto& span : spans) {
+    file_.write(reinterpret_cast<const char*>(span.data()), span.size());
+    if (!file_) {
+      return absl::UnknownError("Failed to write to the output file.");
+    }
+    size_ += span.size();
+  }
+  return absl::OkStatus();
+}
+
+absl::Status GatherFileWriter::Overwrite(int64_t offset,
+                                         absl::Span<const uint8_t> bytes) {
+  if (!is_open_) {
+    return absl::FailedPreconditionError("The file is closed.");
+  }
+  RETURN_IF_NOT_OK(ValidateOverwrite(offset, bytes.size(), size_));
+  file_.seekp(offset, std::ios::beg);
+  file_.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  file_.seekp(0, std::ios::end);
+  if (!file_) {
+    return absl::UnknownError("Failed to overwrite the output file.");
+  }
+  return absl::OkStatus();
+}
+
+absl::Status GatherFileWriter::Close() {
+  if (!is_open_) {
+    return absl::FailedPreconditionError("The file is already closed.");
+  }
+  is_open_ = false;
+  file_.close();
+  if (file_.fail()) {
+    return absl::UnknownError("Failed to close the output file.");
+  }
+  return absl::OkStatus();
+}
+
+#else
+
+std::unique_ptr<GatherFileWriter> GatherFileWriter::Create(
+    const std::filesystem::path& file_path) {
+  const int fd = open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    LOG(ERROR) << "Error opening " << file_path;
+    return nullptr;
+  }
+  return absl::WrapUnique(new GatherFileWriter(fd));
+}
+
+GatherFileWriter::GatherFileWriter(int fd) : fd_(fd) {}
+
+GatherFileWriter::~GatherFileWriter() {
+  if (is_open_) {
+    close(fd_);
+  }
+}
+
+absl::Status GatherFileWriter::Write(
+    absl::Span<const absl::Span<const uint8_t>> spans) {
+  if (!is_open_) {
+    return absl::FailedPreconditionError("The file is closed.");
+  }
+  std::vector<struct iovec> iovecs;
+  iovecs.reserve(spans.size());
+  for (const auto& span : spans) {
+    if (!span.empty()) {
+      iovecs.push_back({.iov_base = const_cast<uint8_t*>(span.data()),
+                        .iov_len = span.size()});
+    }
+  }
+
+  absl::Span<struct iovec> remaining_iovecs = absl::MakeSpan(iovecs);
+  while (!remaining_iovecs.empty()) {
+    const int num_iovecs = static_cast<int>(
+        std::min(remaining_iovecs.size(), static_cast<size_t>(IOV_MAX)));
+    const ssize_t num_bytes_written =
+        writev(fd_, remaining_iovecs.data(), num_iovecs);
+    if (num_bytes_written < 0) [[unlikely]] {
+      if (errno == EINTR) {
+        continue;
+      }
+      return SystemCallError("write to");
+    }
+    if (num_bytes_written == 0) [[unlikely]] {
+      return NoProgressError("write to");
+    }
+    size_ += num_bytes_written;
+
+    // Drop what was written. A short write may end partway through a span.
+    size_t num_bytes_to_drop = static_cast<size_t>(num_bytes_written);
+    while (!remaining_iovecs.empty() &&
+           num_bytes_to_drop >= remaining_iovecs.front().iov_len) {
+      num_bytes_to_drop -= remaining_iovecs.front().iov_len;
+      remaining_iovecs.remove_prefix(1);
+    }
+    if (num_bytes_to_drop > 0) {
+      auto& partially_written_iovec = remaining_iovecs.front();
+      partially_written_iovec.iov_base =
+          static_cast<uint8_t*>(partially_written_iovec.iov_base) +
+          num_bytes_to_drop;
+      partially_written_iovec.iov_len -= num_bytes_to_drop;
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::Status GatherFileWriter::Overwrite(int64_t offset,
+                                         absl::Span<const uint8_t> bytes) {
+  if (!is_open_) {
+    return absl::FailedPreconditionError("The file is closed.");
+  }
+  RETURN_IF_NOT_OK(ValidateOverwrite(offset, bytes.size(), size_));
+  // `pwrite()` does not move the file offset, so `Write()` still appends.
+  while (!bytes.empty()) {
+    const ssize_t num_bytes_written =
+        pwrite(fd_, bytes.data(), bytes.size(), offset);
+    if (num_bytes_written < 0) [[unlikely]] {
+      if (errno == EINTR) {
+        continue;
+      }
+      return SystemCallError("overwrite");
+    }
+    if (num_bytes_written == 0) [[unlikely]] {
+      return NoProgressError("overwrite");
+    }
+    bytes.remove_prefix(num_bytes_written);
+    offset += num_bytes_written;
+  }
+  return absl::OkStatus();
+}
+
+absl::Status GatherFileWriter::Close() {
+  if (!is_open_) {
+    return absl::FailedPreconditionError("The file is already closed.");
+  }
+  is_open_ = false;
+  if (close(fd_) != 0) {
+    return SystemCallError("close");
+  }
+  return absl::OkStatus();
+}
+
+#endif
+
+}  // namespace iamf_tools
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#ifndef COMMON_GATHER_FILE_WRITER_H_
+#define COMMON_GATHER_FILE_WRITER_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/types/span.h"
+
+namespace iamf_tools {
+
+/*!\brief Writes a file from byte spans which are scattered in memory.
+ *
+ * On POSIX platforms the spans are handed to the kernel by reference with
+ * `writev()`, so they are never copied into an intermediate buffer. Elsewhere
+ * each span is written through `std::fstream`.
+ */
+class GatherFileWriter {
+ public:
+  /*!\brief Creates a writer which truncates or creates the file.
+   *
+   * \param file_path Path of the file to write.
+   * \return Unique pointer of the created instance. `nullptr` if the file
+   *         cannot be opened.
+   */
+  static std::unique_ptr<GatherFileWriter> Create(
+      const std::filesystem::path& file_path);
+
+  /*!\brief Destructor. Closes the file if it is still open.*/
+  ~GatherFileWriter();
+
+  GatherFileWriter(const GatherFileWriter&) = delete;
+  GatherFileWriter& operator=(const GatherFileWriter&) = delete;
+
+  /*!\brief Appends the concatenation of the spans to the file.
+   *
+   * The spans are not referenced after the call returns, so they only need to
+   * outlive the call. On POSIX platforms all of them are handed to a single
+   * `writev()` when possible; pass everything which is ready together to
+   * minimize the number of system calls.
+   *
+   * \param spans Spans to write, in order.
+   * \return `absl::OkStatus()` on success. `absl::UnknownError()` if the write
+   *         fails. `absl::FailedPreconditionError()` if the file is closed.
+   */
+  absl::Status Write(absl::Span<const absl::Span<const uint8_t>> spans);
+
+  /*!\brief Overwrites previously written bytes.
+   *
+   * Subsequent calls to `Write()` still append to the end of the file.
+   *
+   * \param offset Offset of the first byte to overwrite.
+   * \param bytes Bytes to write.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the bytes do not lie within the written part of the file.
+   *         `absl::UnknownError()` if the write fails.
+   *         `absl::FailedPreconditionError()` if the file is closed.
+   */
+  absl::Status Overwrite(int64_t offset, absl::Span<const uint8_t> bytes);
+
+  /*!\brief Closes the file.
+   *
+   * \return `absl::OkStatus()` on success. `absl::UnknownError()` if the file
+   *         cannot be closed. `absl::FailedPreconditionError()` if the file
+   *         is already closed.
+   */
+  absl::Status Close();
+
+  /*!\brief Gets the number of bytes written to the file.
+   *
+   * \return Size of the file in bytes.
+   */
+  int64_t size() const { return size_; }
+
+ private:
+#ifdef _WIN32
+  explicit GatherFileWriter(std::fstream file);
+
+  std::fstream file_;
+#else
+  explicit GatherFileWriter(int fd);
+
+  int fd_;
+#endif
+  bool is_open_ = true;
+  int64_t size_ = 0;
+};
+
+}  // namespace iamf_tools
+
+#endif  // COMMON_GATHER_FILE_WRITER_H_
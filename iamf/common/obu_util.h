@@ -33,6 +33,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
+#include "iamf/common/planar_sample_buffer.h"
 
 namespace iamf_tools {
 
@@ -378,6 +379,82 @@ absl::Status ConvertTimeChannelToInterleaved(
   return absl::OkStatus();
 }
 
+/*!\brief Arranges interleaved samples in a planar buffer.
+ *
+ * \param samples Interleaved samples to arrange.
+ * \param transform_samples Function to transform each sample to the output
+ *        type.
+ * \param output Output buffer. The number of channels and the maximum number
+ *        of ticks are not modified. The number of valid ticks is set to the
+ *        number of input ticks.
+ * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if the
+ *         number of samples is not a multiple of the number of channels, or
+ *         if the ticks do not fit into `output`. An error propagated from
+ *         `transform_samples` if it fails.
+ */
+template <typename InputType, typename OutputType>
+absl::Status ConvertInterleavedToPlanar(
+    absl::Span<const InputType> samples,
+    const absl::AnyInvocable<absl::Status(InputType, OutputType&) const>&
+        transform_samples,
+    PlanarSampleBuffer<OutputType>& output) {
+  const size_t num_channels = output.num_channels();
+  if (num_channels == 0 || samples.size() % num_channels != 0) [[unlikely]] {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Number of samples must be a multiple of the number of "
+        "channels. Found ",
+        samples.size(), " samples and ", num_channels, " channels."));
+  }
+  const auto set_num_ticks_status =
+      output.SetNumTicks(samples.size() / num_channels);
+  if (!set_num_ticks_status.ok()) [[unlikely]] {
+    return set_num_ticks_status;
+  }
+
+  for (size_t c = 0; c < num_channels; ++c) {
+    const auto channel = output.Channel(c);
+    for (size_t t = 0; t < channel.size(); ++t) {
+      const auto status =
+          transform_samples(samples[t * num_channels + c], channel[t]);
+      if (!status.ok()) [[unlikely]] {
+        return status;
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
+/*!\brief Interleaves the valid samples of a planar buffer.
+ *
+ * \param input Samples to interleave.
+ * \param transform_samples Function to transform each sample to the output
+ *        type.
+ * \param output Output vector to write the interleaved samples to. Resized to
+ *        hold exactly `num_channels() * num_ticks()` samples.
+ * \return `absl::OkStatus()` on success. An error propagated from
+ *         `transform_samples` if it fails.
+ */
+template <typename InputType, typename OutputType>
+absl::Status ConvertPlanarToInterleaved(
+    const PlanarSampleBuffer<InputType>& input,
+    const absl::AnyInvocable<absl::Status(InputType, OutputType&) const>&
+        transform_samples,
+    std::vector<OutputType>& output) {
+  const size_t num_channels = input.num_channels();
+  output.resize(num_channels * input.num_ticks());
+  for (size_t c = 0; c < num_channels; ++c) {
+    const auto channel = input.Channel(c);
+    for (size_t t = 0; t < channel.size(); ++t) {
+      const auto status =
+          transform_samples(channel[t], output[t * num_channels + c]);
+      if (!status.ok()) [[unlikely]] {
+        return status;
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
 /*!\brief Looks up a key in a map and returns a status or value.
  *
  * When lookup fails the error message will contain the `context` string
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#ifndef COMMON_PLANAR_SAMPLE_BUFFER_H_
+#define COMMON_PLANAR_SAMPLE_BUFFER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+
+namespace iamf_tools {
+
+/*!\brief Contiguous buffer of samples arranged in (channel, time) axes.
+ *
+ * All channels are stored back to back in a single allocation. Each channel
+ * occupies `max_num_ticks()` slots, of which the first `num_ticks()` are
+ * valid. Shrinking the number of valid ticks, for example after trimming,
+ * never reallocates, so a buffer sized for a full frame can be reused for
+ * every frame of a stream.
+ *
+ * Per-channel views are contiguous, which keeps inner loops over time free of
+ * indirection and friendly to auto-vectorization.
+ *
+ * \tparam T Type of each sample.
+ */
+template <typename T>
+class PlanarSampleBuffer {
+ public:
+  /*!\brief Creates an empty buffer. */
+  PlanarSampleBuffer() = default;
+
+  /*!\brief Constructor.
+   *
+   * All samples are value-initialized and all ticks are valid.
+   *
+   * \param num_channels Number of channels.
+   * \param max_num_ticks Maximum number of ticks in each channel.
+   */
+  PlanarSampleBuffer(size_t num_channels, size_t max_num_ticks)
+      : num_channels_(num_channels),
+        max_num_ticks_(max_num_ticks),
+        num_ticks_(max_num_ticks),
+        samples_(num_channels * max_num_ticks) {}
+
+  /*!\brief Compares the shape and the valid samples of two buffers.
+   *
+   * Slots beyond `num_ticks()` and the maximum number of ticks are ignored.
+   */
+  friend bool operator==(const PlanarSampleBuffer& lhs,
+                         const PlanarSampleBuffer& rhs) {
+    if (lhs.num_channels_ != rhs.num_channels_ ||
+        lhs.num_ticks_ != rhs.num_ticks_) {
+      return false;
+    }
+    for (size_t channel = 0; channel < lhs.num_channels_; ++channel) {
+      if (lhs.Channel(channel) != rhs.Channel(channel)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!\brief Creates a buffer from samples arranged in (time, channel) axes.
+   *
+   * \param time_channel_samples Samples to copy. All ticks must have the same
+   *        number of channels.
+   * \return Buffer holding a copy of the samples. A specific status on
+   *         failure.
+   */
+  static absl::StatusOr<PlanarSampleBuffer> FromTimeChannel(
+      absl::Span<const std::vector<T>> time_channel_samples) {
+    const size_t num_channels =
+        time_channel_samples.empty() ? 0 : time_channel_samples[0].size();
+    PlanarSampleBuffer buffer(num_channels, time_channel_samples.size());
+    for (size_t time = 0; time < time_channel_samples.size(); ++time) {
+      const auto& tick = time_channel_samples[time];
+      if (tick.size() != num_channels) [[unlikely]] {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Expected ", num_channels, " channels at tick ", time,
+                         ", got ", tick.size(), "."));
+      }
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        buffer.Channel(channel)[time] = tick[channel];
+      }
+    }
+    return buffer;
+  }
+
+  /*!\brief Gets the number of channels.
+   *
+   * \return Number of channels.
+   */
+  size_t num_channels() const { return num_channels_; }
+
+  /*!\brief Gets the number of valid ticks in each channel.
+   *
+   * \return Number of valid ticks.
+   */
+  size_t num_ticks() const { return num_ticks_; }
+
+  /*!\brief Gets the number of ticks each channel can hold.
+   *
+   * \return Maximum number of ticks.
+   */
+  size_t max_num_ticks() const { return max_num_ticks_; }
+
+  /*!\brief Changes the shape of the buffer.
+   *
+   * All ticks become valid. Samples are left unspecified. The allocation is
+   * reused when it is large enough, so recycled buffers do not allocate when
+   * they are resized to the same shape.
+   *
+   * \param num_channels Number of channels.
+   * \param max_num_ticks Maximum number of ticks in each channel.
+   */
+  void Resize(size_t num_channels, size_t max_num_ticks) {
+    num_channels_ = num_channels;
+    max_num_ticks_ = max_num_ticks;
+    num_ticks_ = max_num_ticks;
+    samples_.resize(num_channels * max_num_ticks);
+  }
+
+  /*!\brief Sets the number of valid ticks in each channel.
+   *
+   * Samples are not modified. Ticks which become valid keep their previous
+   * values.
+   *
+   * \param num_ticks Number of valid ticks.
+   * \return `absl::OkStatus()` on success. A specific status if `num_ticks`
+   *         exceeds `max_num_ticks()`.
+   */
+  absl::Status SetNumTicks(size_t num_ticks) {
+    if (num_ticks > max_num_ticks_) [[unlikely]] {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Number of ticks= ", num_ticks,
+                       " does not fit into a buffer of size ", max_num_ticks_));
+    }
+    num_ticks_ = num_ticks;
+    return absl::OkStatus();
+  }
+
+  /*!\brief Gets a view of the valid ticks of one channel.
+   *
+   * \param channel Index of the channel. Must be less than `num_channels()`.
+   * \return Contiguous view of the channel.
+   */
+  absl::Span<T> Channel(size_t channel) {
+    return absl::MakeSpan(samples_).subspan(channel * max_num_ticks_,
+                                            num_ticks_);
+  }
+  absl::Span<const T> Channel(size_t channel) const {
+    return absl::MakeConstSpan(samples_).subspan(channel * max_num_ticks_,
+                                                 num_ticks_);
+  }
+
+  /*!\brief Sets all valid samples of one channel to `value`.
+   *
+   * \param channel Index of the channel. Must be less than `num_channels()`.
+   * \param value Value to fill.
+   */
+  void FillChannel(size_t channel, const T& value) {
+    const auto channel_samples = Channel(channel);
+    std::fill(channel_samples.begin(), channel_samples.end(), value);
+  }
+
+  /*!\brief Copies the valid samples into (time, channel) axes.
+   *
+   * \return Samples arranged in (time, channel) axes.
+   */
+  std::vector<std::vector<T>> ToTimeChannel() const {
+    std::vector<std::vector<T>> time_channel_samples(
+        num_ticks_, std::vector<T>(num_channels_));
+    for (size_t channel = 0; channel < num_channels_; ++channel) {
+      const auto channel_samples = Channel(channel);
+      for (size_t time = 0; time < num_ticks_; ++time) {
+        time_channel_samples[time][channel] = channel_samples[time];
+      }
+    }
+    return time_channel_samples;
+  }
+
+  /*!\brief Copies the valid samples in interleaved order.
+   *
+   * \param output Output samples. Resized to hold exactly
+   *        `num_channels() * num_ticks()` samples.
+   */
+  void ToInterleaved(std::vector<T>& output) const {
+    output.resize(num_channels_ * num_ticks_);
+    for (size_t channel = 0; channel < num_channels_; ++channel) {
+      const auto channel_samples = Channel(channel);
+      for (size_t time = 0; time < num_ticks_; ++time) {
+        output[time * num_channels_ + channel] = channel_samples[time];
+      }
+    }
+  }
+
+ private:
+  size_t num_channels_ = 0;
+  size_t max_num_ticks_ = 0;
+  size_t num_ticks_ = 0;
+  std::vector<T> samples_;
+};
+
+}  // namespace iamf_tools
+
+#endif  // COMMON_PLANAR_SAMPLE_BUFFER_H_
@@ -12,6 +12,13 @@
 
 #include "iamf/common/read_bit_buffer.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
@@ -40,59 +47,45 @@ namespace iamf_tools {
 
 namespace {
 
-bool CanReadByteAligned(const int64_t& buffer_bit_offset,
-                        const int64_t& num_bits) {
-  const bool buffer_bit_offset_is_aligned = (buffer_bit_offset % 8 == 0);
-  const bool num_bits_to_read_is_aligned = (num_bits % 8 == 0);
-  return buffer_bit_offset_is_aligned && num_bits_to_read_is_aligned;
-}
-
-// Reads one bit from source_data at position `offset`. Reads in order of most
-// significant to least significant - that is, offset = 0 refers to the bit in
-// position 2^7, offset = 1 refers to the bit in position 2^6, etc. Caller
-// should ensure that offset/8 is < data.size().
-uint8_t GetUpperBit(const int64_t& offset,
-                    const std::vector<uint8_t>& source_data) {
-  int64_t byte_index = offset / 8;
-  uint8_t bit_index = 7 - (offset % 8);
-  return (source_data.at(byte_index) >> bit_index) & 0x01;
+// Maximum number of bits extracted from one word. Reads may start anywhere
+// within a byte, so this many bits are always within the eight bytes loaded
+// from the byte holding the first bit.
+constexpr int kMaxBitsPerWord = 56;
+
+// Loads the eight bytes starting at `byte_index` as a big-endian word. Bytes
+// past the end of `bit_buffer` are read as zero.
+uint64_t LoadBigEndianWord(absl::Span<const uint8_t> bit_buffer,
+                           const int64_t byte_index) {
+  const uint8_t* data = bit_buffer.data() + byte_index;
+  const int64_t num_bytes = std::min(
+      int64_t{8}, static_cast<int64_t>(bit_buffer.size()) - byte_index);
+  uint64_t word = 0;
+  if (num_bytes == 8) [[likely]] {
+    // Compilers fold this into a single byte-swapping load.
+    for (int i = 0; i < 8; ++i) {
+      word = (word << 8) | data[i];
+    }
+    return word;
+  }
+  for (int i = 0; i < num_bytes; ++i) {
+    word |= static_cast<uint64_t>(data[i]) << (56 - 8 * i);
+  }
+  return word;
 }
 
-// Read unsigned literal bit by bit. Data is read into the lower
-// `remaining_bits_to_read` of `output` from the upper `remaining_bits_to_read`
-// of bit_offer[buffer_bit_offset].
+// Extracts `num_bits` bits starting at bit `bit_offset` of `bit_buffer`. Bits
+// are read in order of most significant to least significant - that is,
+// `bit_offset = 0` refers to the bit in position 2^7 of the first byte.
 //
-// Ex: Input: bit_buffer = 10000111, buffer_bit_offset = 0,
-//        remaining_bits_to_read = 5, output = 0
-//     Output: output = {59 leading zeroes} + 10000, buffer_bit_offset = 5,
-//        remaining_bits_to_read = 0.
-void ReadUnsignedLiteralBits(const std::vector<uint8_t>& bit_buffer,
-                             const int64_t buffer_size,
-                             int64_t& buffer_bit_offset,
-                             int64_t& remaining_bits_to_read,
-                             uint64_t& output) {
-  while (((buffer_bit_offset / 8) < bit_buffer.size()) &&
-         remaining_bits_to_read > 0 && (buffer_bit_offset < buffer_size)) {
-    uint8_t upper_bit = GetUpperBit(buffer_bit_offset, bit_buffer);
-    output <<= 1;
-    output |= static_cast<uint64_t>(upper_bit);
-    remaining_bits_to_read--;
-    buffer_bit_offset++;
-  }
-}
-
-// Read unsigned literal byte by byte.
-void ReadUnsignedLiteralBytes(const std::vector<uint8_t>& bit_buffer,
-                              int64_t& buffer_bit_offset,
-                              int64_t& remaining_bits_to_read,
-                              uint64_t& output) {
-  while (((buffer_bit_offset / 8) < bit_buffer.size()) &&
-         remaining_bits_to_read > 0) {
-    output <<= 8;
-    output |= static_cast<uint64_t>(bit_buffer.at(buffer_bit_offset / 8));
-    remaining_bits_to_read -= 8;
-    buffer_bit_offset += 8;
-  }
+// Ex: Input: bit_buffer = 10000111, bit_offset = 0, num_bits = 5
+//     Output: {59 leading zeroes} + 10000.
+//
+// Caller should ensure that `0 < num_bits <= kMaxBitsPerWord` and that
+// `bit_offset / 8 < bit_buffer.size()`.
+uint64_t ExtractBits(absl::Span<const uint8_t> bit_buffer,
+                     const int64_t bit_offset, const int num_bits) {
+  const uint64_t word = LoadBigEndianWord(bit_buffer, bit_offset / 8);
+  return (word << (bit_offset % 8)) >> (64 - num_bits);
 }
 
 typedef absl::AnyInvocable<void(uint64_t, int, uint64_t&) const>
@@ -234,8 +227,28 @@ absl::Status ReadBitBuffer::ReadIso14496_1Expanded(uint32_t max_class_size,
 }
 
 absl::Status ReadBitBuffer::ReadUint8Span(absl::Span<uint8_t> output) {
-  for (auto& byte : output) {
-    RETURN_IF_NOT_OK(ReadUnsignedLiteral(8, byte));
+  if (buffer_bit_offset_ < 0 || buffer_bit_offset_ % 8 != 0) {
+    for (auto& byte : output) {
+      RETURN_IF_NOT_OK(ReadUnsignedLiteral(8, byte));
+    }
+    return absl::OkStatus();
+  }
+
+  // Byte-aligned data is copied directly from the buffer, refilling it as
+  // needed.
+  while (!output.empty()) {
+    RETURN_IF_NOT_OK(Seek(Tell()));
+    const int64_t num_bytes_in_buffer = (buffer_size_ - buffer_bit_offset_) / 8;
+    if (num_bytes_in_buffer <= 0) {
+      return absl::ResourceExhaustedError(
+          "Unable to load more data into the buffer.");
+    }
+    const size_t num_bytes = std::min(
+        output.size(), static_cast<size_t>(num_bytes_in_buffer));
+    const auto first_byte = buffer_view_.begin() + buffer_bit_offset_ / 8;
+    std::copy(first_byte, first_byte + num_bytes, output.begin());
+    buffer_bit_offset_ += num_bytes * 8;
+    output.remove_prefix(num_bytes);
   }
   return absl::OkStatus();
 }
@@ -308,6 +321,7 @@ absl::Status ReadBitBuffer::Seek(const int64_t position) {
       std::min(static_cast<int64_t>(bit_buffer_.capacity()),
                source_size_ / 8 - starting_byte);
 
+  buffer_view_ = absl::MakeConstSpan(bit_buffer_).first(num_bytes);
   RETURN_IF_NOT_OK(LoadBytesToBuffer(starting_byte, num_bytes));
 
   // Update other bookkeeping data.
@@ -339,47 +353,27 @@ absl::Status ReadBitBuffer::ReadUnsignedLiteralInternal(const int num_bits,
 
   // Now at least one bit is needed, make sure the buffer has some data in it.
   RETURN_IF_NOT_OK(Seek(Tell()));
-  int64_t remaining_bits_to_read = num_bits;
-  const int64_t expected_final_position = Tell() + remaining_bits_to_read;
-
-  // If the final position and the current position lies within the same byte.
-  if (expected_final_position / 8 == Tell() / 8) {
-    ReadUnsignedLiteralBits(bit_buffer_, buffer_size_, buffer_bit_offset_,
-                            remaining_bits_to_read, output);
-    CHECK_EQ(remaining_bits_to_read, 0) << remaining_bits_to_read;
-    return absl::OkStatus();
-  }
-
-  // Read the first several bits so that the `buffer_bit_offset_` is byte
-  // aligned.
-  if (buffer_bit_offset_ % 8 != 0) {
-    int64_t num_bits_to_byte_aligned = 8 - (buffer_bit_offset_ % 8);
-    remaining_bits_to_read -= num_bits_to_byte_aligned;
-    ReadUnsignedLiteralBits(bit_buffer_, buffer_size_, buffer_bit_offset_,
-                            num_bits_to_byte_aligned, output);
-  }
-
-  // Read consecutive complete bytes.
-  while (remaining_bits_to_read >= 8) {
-    // Make sure the reading position has some buffer to read if possible.
-    RETURN_IF_NOT_OK(Seek(Tell()));
-
-    // Read as much as possible from the buffer.
-    int64_t num_bits_from_buffer = std::min(buffer_size_ - buffer_bit_offset_,
-                                            (remaining_bits_to_read / 8) * 8);
+  int remaining_bits_to_read = num_bits;
+  while (remaining_bits_to_read > 0) {
+    // Refill the buffer when all of it was consumed.
+    if (buffer_bit_offset_ >= buffer_size_) {
+      RETURN_IF_NOT_OK(Seek(Tell()));
+      if (buffer_bit_offset_ >= buffer_size_) {
+        return absl::ResourceExhaustedError(
+            "Unable to load more data into the buffer.");
+      }
+    }
 
-    CHECK(CanReadByteAligned(buffer_bit_offset_, num_bits_from_buffer));
-    remaining_bits_to_read -= num_bits_from_buffer;
-    ReadUnsignedLiteralBytes(bit_buffer_, buffer_bit_offset_,
-                             num_bits_from_buffer, output);
+    // Extract as many bits as possible from one word of the buffer.
+    const int num_bits_from_word = static_cast<int>(
+        std::min({static_cast<int64_t>(remaining_bits_to_read),
+                  static_cast<int64_t>(kMaxBitsPerWord),
+                  buffer_size_ - buffer_bit_offset_}));
+    output = (output << num_bits_from_word) |
+             ExtractBits(buffer_view_, buffer_bit_offset_, num_bits_from_word);
+    buffer_bit_offset_ += num_bits_from_word;
+    remaining_bits_to_read -= num_bits_from_word;
   }
-
-  // Read the final several bits in the last byte.
-  int64_t num_bits_in_final_byte = expected_final_position % 8;
-  remaining_bits_to_read -= num_bits_in_final_byte;
-  ReadUnsignedLiteralBits(bit_buffer_, buffer_size_, buffer_bit_offset_,
-                          num_bits_in_final_byte, output);
-  CHECK_EQ(remaining_bits_to_read, 0) << remaining_bits_to_read;
   return absl::OkStatus();
 }
 
@@ -458,6 +452,78 @@ FileBasedReadBitBuffer::FileBasedReadBitBuffer(size_t capacity,
                                                std::ifstream&& ifs)
     : ReadBitBuffer(capacity, source_size), source_ifs_(std::move(ifs)) {}
 
+// ----- MmapReadBitBuffer -----
+
+std::unique_ptr<MmapReadBitBuffer> MmapReadBitBuffer::CreateFromFilePath(
+    const std::filesystem::path& file_path) {
+#ifdef _WIN32
+  LOG(ERROR) << "MmapReadBitBuffer is not supported on this platform.";
+  return nullptr;
+#else
+  const int fd = open(file_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LOG(ERROR) << "Error opening " << file_path;
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    LOG(ERROR) << "Error accessing " << file_path;
+    close(fd);
+    return nullptr;
+  }
+  const auto file_size = static_cast<size_t>(file_stat.st_size);
+
+  // Mapping zero bytes is not allowed, but an empty file has nothing to read.
+  void* mapped_data = nullptr;
+  if (file_size > 0) {
+    mapped_data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  // The mapping stays valid after the file is closed.
+  close(fd);
+  if (mapped_data == MAP_FAILED) {
+    LOG(ERROR) << "Error mapping " << file_path;
+    return nullptr;
+  }
+  if (file_size > 0 && madvise(mapped_data, file_size, MADV_SEQUENTIAL) != 0) {
+    // The advice is only a hint, reading works regardless.
+    LOG(WARNING) << "Error advising the kernel about " << file_path;
+  }
+
+  return absl::WrapUnique(new MmapReadBitBuffer(
+      static_cast<const uint8_t*>(mapped_data), file_size));
+#endif
+}
+
+MmapReadBitBuffer::~MmapReadBitBuffer() {
+#ifndef _WIN32
+  if (!mapped_source_.empty()) {
+    munmap(const_cast<uint8_t*>(mapped_source_.data()), mapped_source_.size());
+  }
+#endif
+}
+
+absl::Status MmapReadBitBuffer::LoadBytesToBuffer(int64_t starting_byte,
+                                                  int64_t num_bytes) {
+  if (starting_byte > mapped_source_.size() ||
+      (starting_byte + num_bytes) > mapped_source_.size()) {
+    return absl::InvalidArgumentError(
+        "Invalid starting or ending position to read from the mapping");
+  }
+
+  buffer_view_ = mapped_source_.subspan(starting_byte, num_bytes);
+  return absl::OkStatus();
+}
+
+MmapReadBitBuffer::MmapReadBitBuffer(const uint8_t* mapped_data,
+                                     size_t mapped_size)
+    : ReadBitBuffer(/*capacity=*/0, static_cast<int64_t>(mapped_size) * 8),
+      mapped_source_(mapped_data, mapped_size) {
+  // Expose the whole mapping as the buffer, so seeking never needs to load.
+  buffer_view_ = mapped_source_;
+  buffer_size_ = source_size_;
+  source_bit_offset_ = source_size_;
+}
+
 // ----- StreamBasedReadBitBuffer -----
 std::unique_ptr<StreamBasedReadBitBuffer> StreamBasedReadBitBuffer::Create(
     int64_t capacity) {
@@ -465,42 +531,49 @@ std::unique_ptr<StreamBasedReadBitBuffer> StreamBasedReadBitBuffer::Create(
     LOG(ERROR) << "StreamBasedReadBitBuffer capacity must be >= 0.";
     return nullptr;
   }
-  // Since this is a stream based buffer, we do not initialize with any data,
-  // hence the source size is initially set to 0.
-  return absl::WrapUnique(
-      new StreamBasedReadBitBuffer(capacity, /*source_size=*/0));
+  // The stream may hold up to two of the largest OBUs at once.
+  return absl::WrapUnique(new StreamBasedReadBitBuffer(
+      capacity,
+      /*max_source_size=*/int64_t{kEntireObuSizeMaxTwoMegabytes} * 2 * 8));
 }
 
 absl::Status StreamBasedReadBitBuffer::PushBytes(
-    const std::vector<uint8_t>& bytes) {
-  if (bytes.size() > ((max_source_size_ / 8) - source_vector_.size())) {
+    absl::Span<const uint8_t> bytes) {
+  const int64_t num_source_bytes = source_size_ / 8;
+  const int64_t required_ring_size =
+      num_source_bytes + static_cast<int64_t>(bytes.size());
+  if (required_ring_size > max_source_size_ / 8) {
     return absl::InvalidArgumentError(
         "Cannot push more bytes than the available space in the source.");
   }
-  // Copy the bytes to the source vector; this is added to the end in case there
-  // are already some bytes in the source.
-  source_vector_.insert(source_vector_.end(), bytes.begin(), bytes.end());
+  if (bytes.empty()) {
+    return absl::OkStatus();
+  }
+  if (required_ring_size > ring_size_) {
+    GrowRing(required_ring_size);
+  }
+  // Copy the bytes after the end of the source, wrapping around to the start
+  // of the ring if needed.
+  const int64_t ring_end = (ring_begin_ + num_source_bytes) % ring_size_;
+  const size_t num_bytes_before_wrap =
+      std::min(bytes.size(), static_cast<size_t>(ring_size_ - ring_end));
+  std::copy(bytes.begin(), bytes.begin() + num_bytes_before_wrap,
+            ring_.get() + ring_end);
+  std::copy(bytes.begin() + num_bytes_before_wrap, bytes.end(), ring_.get());
   // The source grows as bytes are pushed.
-  source_size_ += bytes.size() * 8;
+  source_size_ += static_cast<int64_t>(bytes.size()) * 8;
   return absl::OkStatus();
 }
 
-// Flush should be called in a reasonable manner, i.e. not every time a read
-// operation is performed, as the removal of elements from the source vector
-// is an O(n) operation, where n is the number of elements in the source vector.
-// In general, it is a trade-off: the more often it is called, the more
-// space-efficient the buffer is (since it holds less data in the source vector)
-// while simultaneously being less time-efficient (since it takes time to remove
-// elements from the source vector).
 absl::Status StreamBasedReadBitBuffer::Flush(int64_t num_bytes) {
-  if (num_bytes > source_vector_.size()) {
+  if (num_bytes < 0 || num_bytes > source_size_ / 8) {
     return absl::InvalidArgumentError(
         "Cannot flush more bytes than are in the source.");
   }
-  source_vector_.erase(source_vector_.begin(),
-                       source_vector_.begin() + num_bytes);
-  // Offset needs to be moved back as erase moves the elements of a vector that
-  // are not removed to the beginning of the vector.
+  if (num_bytes > 0) {
+    ring_begin_ = (ring_begin_ + num_bytes) % ring_size_;
+  }
+  // Offsets are relative to the start of the source, which moved forward.
   source_bit_offset_ -= num_bytes * 8;
   source_size_ -= num_bytes * 8;
   // Disable seeking as the position returned by a previous Tell() call is no
@@ -509,10 +582,62 @@ absl::Status StreamBasedReadBitBuffer::Flush(int64_t num_bytes) {
   return absl::OkStatus();
 }
 
-StreamBasedReadBitBuffer::StreamBasedReadBitBuffer(size_t capacity,
-                                                   int64_t source_size)
-    : MemoryBasedReadBitBuffer(capacity, absl::Span<const uint8_t>()) {
-  max_source_size_ = kEntireObuSizeMaxTwoMegabytes * 2 * 8;
+absl::Status StreamBasedReadBitBuffer::LoadBytesToBuffer(int64_t starting_byte,
+                                                         int64_t num_bytes) {
+  const int64_t num_source_bytes = source_size_ / 8;
+  if (starting_byte < 0 || num_bytes < 0 ||
+      starting_byte + num_bytes > num_source_bytes) {
+    return absl::InvalidArgumentError(
+        "Invalid starting or ending position to read from the stream");
+  }
+
+  const int64_t first_byte = (ring_begin_ + starting_byte) % ring_size_;
+  if (first_byte + num_bytes <= ring_size_) {
+    // The bytes are contiguous in the ring. Serve them without a copy.
+    buffer_view_ = absl::MakeConstSpan(ring_.get() + first_byte, num_bytes);
+    return absl::OkStatus();
+  }
+
+  // The bytes wrap around the end of the ring. Copy them into the buffer.
+  const int64_t num_bytes_before_wrap = ring_size_ - first_byte;
+  std::copy(ring_.get() + first_byte, ring_.get() + ring_size_,
+            bit_buffer_.begin());
+  std::copy(ring_.get(), ring_.get() + num_bytes - num_bytes_before_wrap,
+            bit_buffer_.begin() + num_bytes_before_wrap);
+  return absl::OkStatus();
+}
+
+void StreamBasedReadBitBuffer::GrowRing(int64_t min_ring_size) {
+  // Grow geometrically, so a stream of small pushes reallocates only a
+  // logarithmic number of times.
+  const int64_t new_ring_size =
+      std::min(std::max(min_ring_size, 2 * ring_size_), max_source_size_ / 8);
+  auto new_ring = std::make_unique<uint8_t[]>(new_ring_size);
+
+  // Unwrap the source to the start of the new ring.
+  const int64_t num_source_bytes = source_size_ / 8;
+  const int64_t num_bytes_before_wrap =
+      std::min(num_source_bytes, ring_size_ - ring_begin_);
+  std::copy(ring_.get() + ring_begin_,
+            ring_.get() + ring_begin_ + num_bytes_before_wrap, new_ring.get());
+  std::copy(ring_.get(), ring_.get() + num_source_bytes - num_bytes_before_wrap,
+            new_ring.get() + num_bytes_before_wrap);
+
+  // Loaded bytes may be served straight from the old ring. They always fit in
+  // `bit_buffer_`, so move them there before the old ring is released.
+  if (buffer_view_.data() != bit_buffer_.data()) {
+    std::copy(buffer_view_.begin(), buffer_view_.end(), bit_buffer_.begin());
+    buffer_view_ = absl::MakeConstSpan(bit_buffer_).first(buffer_view_.size());
+  }
+
+  ring_ = std::move(new_ring);
+  ring_size_ = new_ring_size;
+  ring_begin_ = 0;
 }
 
+StreamBasedReadBitBuffer::StreamBasedReadBitBuffer(size_t capacity,
+                                                   int64_t max_source_size)
+    : ReadBitBuffer(capacity, /*source_size=*/0),
+      max_source_size_(max_source_size) {}
+
 }  // namespace iamf_tools
@@ -31,6 +31,9 @@ namespace iamf_tools {
  * Concrete subclasses should hold the actual storage of the data and
  * implement `LoadBytesToBuffer()` to handle how data are loaded from the
  * storage to the internal buffer.
+ *
+ * Literals are extracted from the internal buffer up to 56 bits at a time,
+ * by loading the surrounding bytes as one 64-bit word.
  */
 class ReadBitBuffer {
  public:
@@ -237,7 +240,10 @@ class ReadBitBuffer {
                                            uint64_t& output);
   /*!\brief Load bytes from source to the buffer.
    *
-   * Subclasses of this class should implement the actual loading logic.
+   * Subclasses of this class should implement the actual loading logic. By
+   * default the bytes are expected to be copied to the start of
+   * `bit_buffer_`. Subclasses which can serve the bytes without a copy may
+   * instead point `buffer_view_` at them.
    *
    * \param starting_byte Starting byte to load from source.
    * \param num_bytes Number of bytes to load.
@@ -250,6 +256,10 @@ class ReadBitBuffer {
   // Read buffer.
   std::vector<uint8_t> bit_buffer_;
 
+  // Bytes which were loaded into the buffer. Refers to `bit_buffer_` unless a
+  // subclass serves bytes directly from its source.
+  absl::Span<const uint8_t> buffer_view_;
+
   // Specifies the next bit to consume in the `bit_buffer_`.
   int64_t buffer_bit_offset_ = 0;
 
@@ -362,14 +372,70 @@ class FileBasedReadBitBuffer : public ReadBitBuffer {
   std::ifstream source_ifs_;
 };
 
+/*!\brief Memory-mapped read bit buffer.
+ *
+ * The file is mapped read-only and all reads are served directly from the
+ * mapping, without an intermediate copy into the buffer. The kernel is advised
+ * that the mapping will be scanned sequentially.
+ *
+ * NOTICE: Only available on POSIX platforms. On other platforms use the
+ * `FileBasedReadBitBuffer`.
+ */
+class MmapReadBitBuffer : public ReadBitBuffer {
+ public:
+  /*!\brief Creates an instance of a memory-mapped read bit buffer.
+   *
+   * \param file_path Path to the file to map.
+   * \return Unique pointer of the created instance. `nullptr` if the creation
+   *         fails.
+   */
+  static std::unique_ptr<MmapReadBitBuffer> CreateFromFilePath(
+      const std::filesystem::path& file_path);
+
+  /*!\brief Destructor. Unmaps the file.*/
+  ~MmapReadBitBuffer() override;
+
+  MmapReadBitBuffer(const MmapReadBitBuffer&) = delete;
+  MmapReadBitBuffer& operator=(const MmapReadBitBuffer&) = delete;
+
+ private:
+  /*!\brief Private constructor. Called by the factory method only.
+   *
+   * \param mapped_data Start of the mapping. Owned by the constructed instance.
+   * \param mapped_size Size of the mapping in bytes.
+   */
+  MmapReadBitBuffer(const uint8_t* mapped_data, size_t mapped_size);
+
+  /*!\brief Points the buffer at bytes of the mapping.
+   *
+   * The whole mapping is exposed as the buffer on construction, so this is
+   * only needed if the buffer is ever reloaded.
+   *
+   * \param starting_byte Starting byte to load from source.
+   * \param num_bytes Number of bytes to load.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the start/ending position is invalid.
+   */
+  absl::Status LoadBytesToBuffer(int64_t starting_byte,
+                                 int64_t num_bytes) override;
+
+  // Source data mapped from the file.
+  absl::Span<const uint8_t> mapped_source_;
+};
+
 /*!\brief Stream-based read bit buffer.
  *
  * The buffer is loaded from a stream. The user should Create() the stream
  * and push data to the buffer using PushBytes() as needed; calls to Read*()
  * methods will read data from the stream and provide it to the caller, or else
  * will instruct the caller to push more data if necessary.
+ *
+ * Pushed bytes are held in a ring which grows on demand, up to the maximum
+ * source size. Flushing consumed bytes only advances the start of the ring,
+ * and reads which do not wrap around the end of the ring are served from it
+ * directly.
  */
-class StreamBasedReadBitBuffer : public MemoryBasedReadBitBuffer {
+class StreamBasedReadBitBuffer : public ReadBitBuffer {
  public:
   /*!\brief Creates an instance of a stream-based read bit buffer.
    *
@@ -385,12 +451,12 @@ class StreamBasedReadBitBuffer : public MemoryBasedReadBitBuffer {
    * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
    *         the stream push fails.
    */
-  absl::Status PushBytes(const std::vector<uint8_t>& bytes);
+  absl::Status PushBytes(absl::Span<const uint8_t> bytes);
 
   /*!\brief Flush already processed data from StreamBasedReadBitBuffer.
    *
    * Should be called whenever the caller no longer needs the first `num_bytes`
-   * of data.
+   * of data. The space is reclaimed in constant time.
    *
    * \param num_bytes Bytes to flush from StreamBasedReadBitBuffer
    * \return `absl::OkStatus()` on success. Specific statuses on failure.
@@ -404,13 +470,36 @@ class StreamBasedReadBitBuffer : public MemoryBasedReadBitBuffer {
   /*!\brief Private constructor.
    *
    * \param capacity Capacity of the internal buffer in bytes.
-   * \param source_size Size of the source data in bits.
+   * \param max_source_size Maximum size of the source data in bits.
+   */
+  StreamBasedReadBitBuffer(size_t capacity, int64_t max_source_size);
+
+  /*!\brief Load bytes from the ring to the buffer.
    *
+   * \param starting_byte Starting byte to load from source.
+   * \param num_bytes Number of bytes to load.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         the start/ending position is invalid.
    */
-  StreamBasedReadBitBuffer(size_t capacity, int64_t source_size);
+  absl::Status LoadBytesToBuffer(int64_t starting_byte,
+                                 int64_t num_bytes) override;
+
+  /*!\brief Reallocates the ring to hold at least `min_ring_size` bytes.
+   *
+   * \param min_ring_size Minimum size of the new ring in bytes. Must not
+   *        exceed `max_source_size_ / 8`.
+   */
+  void GrowRing(int64_t min_ring_size);
 
   // Specifies the maximum size of the source data in bits.
   int64_t max_source_size_;
+
+  // Ring holding `ring_size_` bytes. The source data is the
+  // `source_size_ / 8` bytes starting at `ring_begin_`, wrapping around to
+  // the start of the ring.
+  std::unique_ptr<uint8_t[]> ring_;
+  int64_t ring_size_ = 0;
+  int64_t ring_begin_ = 0;
 };
 
 }  // namespace iamf_tools
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#ifndef COMMON_SAMPLE_RING_BUFFER_H_
+#define COMMON_SAMPLE_RING_BUFFER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "iamf/common/planar_sample_buffer.h"
+
+namespace iamf_tools {
+
+/*!\brief FIFO queue of multi-channel ticks backed by a single ring buffer.
+ *
+ * Ticks are stored channel-planar in one allocation; each channel occupies a
+ * contiguous run of `capacity()` samples. Pushing and popping ticks does not
+ * allocate as long as the number of queued ticks stays within `capacity()`.
+ * Pushing beyond the capacity grows the buffer, so callers should size it for
+ * the largest backlog they expect, e.g. a frame of samples plus any codec
+ * delay.
+ *
+ * \tparam T Type of each sample.
+ */
+template <typename T>
+class SampleRingBuffer {
+ public:
+  /*!\brief Creates an empty buffer without any channels. */
+  SampleRingBuffer() = default;
+
+  /*!\brief Constructor.
+   *
+   * \param num_channels Number of channels in each tick.
+   * \param capacity Number of ticks which can be queued without allocating.
+   */
+  SampleRingBuffer(size_t num_channels, size_t capacity)
+      : num_channels_(num_channels),
+        capacity_(capacity),
+        samples_(num_channels * capacity) {}
+
+  /*!\brief Gets the number of channels in each tick.
+   *
+   * \return Number of channels.
+   */
+  size_t num_channels() const { return num_channels_; }
+
+  /*!\brief Gets the number of queued ticks.
+   *
+   * \return Number of queued ticks.
+   */
+  size_t size() const { return size_; }
+
+  /*!\brief Checks if there are no queued ticks.
+   *
+   * \return `true` if the queue is empty. `false` otherwise.
+   */
+  bool empty() const { return size_ == 0; }
+
+  /*!\brief Gets the number of ticks which can be queued without allocating.
+   *
+   * \return Capacity in ticks.
+   */
+  size_t capacity() const { return capacity_; }
+
+  /*!\brief Pushes a tick to the back of the queue.
+   *
+   * \param tick Samples of the tick; one per channel.
+   * \return `absl::OkStatus()` on success. A specific status if the tick does
+   *         not have `num_channels()` samples.
+   */
+  absl::Status PushBack(absl::Span<const T> tick) {
+    if (tick.size() != num_channels_) [[unlikely]] {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Expected a tick with ", num_channels_,
+                       " channels, got ", tick.size(), "."));
+    }
+    Reserve(size_ + 1);
+    const size_t position = PositionOf(size_);
+    for (size_t c = 0; c < num_channels_; ++c) {
+      ChannelData(c)[position] = tick[c];
+    }
+    ++size_;
+    return absl::OkStatus();
+  }
+
+  /*!\brief Pushes ticks of value-initialized samples to the back of the queue.
+   *
+   * \param num_ticks Number of ticks to push.
+   */
+  void PushZeros(size_t num_ticks) {
+    if (num_ticks == 0) {
+      return;
+    }
+    Reserve(size_ + num_ticks);
+    const size_t position = PositionOf(size_);
+    const size_t first_run = std::min(num_ticks, capacity_ - position);
+    for (size_t c = 0; c < num_channels_; ++c) {
+      T* channel = ChannelData(c);
+      std::fill_n(channel + position, first_run, T{});
+      std::fill_n(channel, num_ticks - first_run, T{});
+    }
+    size_ += num_ticks;
+  }
+
+  /*!\brief Views ticks at the front of the queue for one channel.
+   *
+   * The queued ticks may wrap around the end of the underlying storage, so the
+   * view is split in two. The second span is empty when they do not wrap. The
+   * view is invalidated by any push or pop.
+   *
+   * \param channel Index of the channel to view.
+   * \param num_ticks Number of ticks to view.
+   * \return Pair of spans which together hold the `num_ticks` oldest samples
+   *         of the channel, in order. A specific status if `channel` is out of
+   *         range or fewer than `num_ticks` ticks are queued.
+   */
+  absl::StatusOr<std::pair<absl::Span<const T>, absl::Span<const T>>> Front(
+      size_t channel, size_t num_ticks) const {
+    if (channel >= num_channels_) [[unlikely]] {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Channel ", channel, " is out of range for a queue with ",
+          num_channels_, " channels."));
+    }
+    if (num_ticks > size_) [[unlikely]] {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Cannot view ", num_ticks, " ticks from a queue of ", size_, "."));
+    }
+    return FrontUnchecked(channel, num_ticks);
+  }
+
+  /*!\brief Discards ticks from the front of the queue.
+   *
+   * \param num_ticks Number of ticks to discard.
+   * \return `absl::OkStatus()` on success. A specific status if fewer than
+   *         `num_ticks` ticks are queued.
+   */
+  absl::Status DropFront(size_t num_ticks) {
+    if (num_ticks > size_) [[unlikely]] {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Cannot drop ", num_ticks, " ticks from a queue of ", size_, "."));
+    }
+    if (num_ticks > 0) {
+      head_ = PositionOf(num_ticks);
+      size_ -= num_ticks;
+    }
+    return absl::OkStatus();
+  }
+
+  /*!\brief Pops ticks from the front of the queue.
+   *
+   * Each channel is copied in at most two contiguous runs.
+   *
+   * \param num_ticks Number of ticks to pop.
+   * \param ticks Output ticks arranged in (channel, time) axes. Resized to
+   *        hold `num_channels()` channels of `num_ticks` ticks; the allocation
+   *        is reused when it is large enough.
+   * \return `absl::OkStatus()` on success. A specific status if fewer than
+   *         `num_ticks` ticks are queued.
+   */
+  absl::Status PopFront(size_t num_ticks, PlanarSampleBuffer<T>& ticks) {
+    if (num_ticks > size_) [[unlikely]] {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Cannot pop ", num_ticks, " ticks from a queue of ", size_, "."));
+    }
+    ticks.Resize(num_channels_, num_ticks);
+    for (size_t c = 0; c < num_channels_; ++c) {
+      const auto [first, second] = FrontUnchecked(c, num_ticks);
+      const auto output = ticks.Channel(c);
+      std::copy(first.begin(), first.end(), output.begin());
+      std::copy(second.begin(), second.end(), output.begin() + first.size());
+    }
+    return DropFront(num_ticks);
+  }
+
+ private:
+  size_t PositionOf(size_t index) const {
+    return (head_ + index) % capacity_;
+  }
+
+  T* ChannelData(size_t channel) {
+    return samples_.data() + channel * capacity_;
+  }
+
+  const T* ChannelData(size_t channel) const {
+    return samples_.data() + channel * capacity_;
+  }
+
+  std::pair<absl::Span<const T>, absl::Span<const T>> FrontUnchecked(
+      size_t channel, size_t num_ticks) const {
+    if (num_ticks == 0) {
+      return {};
+    }
+    const T* data = ChannelData(channel);
+    const size_t first_run = std::min(num_ticks, capacity_ - head_);
+    return {absl::MakeConstSpan(data + head_, first_run),
+            absl::MakeConstSpan(data, num_ticks - first_run)};
+  }
+
+  // Grows the buffer, preserving the queued ticks, if it cannot hold
+  // `min_capacity` ticks.
+  void Reserve(size_t min_capacity) {
+    if (min_capacity <= capacity_) {
+      return;
+    }
+    const size_t new_capacity = std::max(min_capacity, 2 * capacity_);
+    std::vector<T> new_samples(new_capacity * num_channels_);
+    for (size_t c = 0; c < num_channels_; ++c) {
+      const auto [first, second] = FrontUnchecked(c, size_);
+      auto output = new_samples.begin() + c * new_capacity;
+      output = std::copy(first.begin(), first.end(), output);
+      std::copy(second.begin(), second.end(), output);
+    }
+    samples_ = std::move(new_samples);
+    capacity_ = new_capacity;
+    head_ = 0;
+  }
+
+  size_t num_channels_ = 0;
+  size_t capacity_ = 0;
+  size_t head_ = 0;
+  size_t size_ = 0;
+  std::vector<T> samples_;
+};
+
+}  // namespace iamf_tools
+
+#endif  // COMMON_SAMPLE_RING_BUFFER_H_
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/common/gather_file_writer.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/status_matchers.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/cli/tests/cli_test_utils.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::absl_testing::StatusIs;
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::HasSubstr;
+
+std::vector<uint8_t> ReadBytes(const std::filesystem::path& file_path) {
+  std::vector<uint8_t> bytes;
+  EXPECT_THAT(ReadFileToBytes(file_path, bytes), IsOk());
+  return bytes;
+}
+
+TEST(GatherFileWriter, WritesConcatenationOfSpans) {
+  const std::filesystem::path file_path(GetAndCleanupOutputFileName(".bin"));
+  const std::vector<uint8_t> kFirst = {1, 2, 3};
+  const std::vector<uint8_t> kEmpty = {};
+  const std::vector<uint8_t> kSecond = {4, 5};
+  auto writer = GatherFileWriter::Create(file_path);
+  ASSERT_NE(writer, nullptr);
+
+  EXPECT_THAT(writer->Write({absl::MakeConstSpan(kFirst),
+                             absl::MakeConstSpan(kEmpty),
+                             absl::MakeConstSpan(kSecond)}),
+              IsOk());
+  EXPECT_THAT(writer->Write({absl::MakeConstSpan(kFirst)}), IsOk());
+  EXPECT_EQ(writer->size(), 8);
+  EXPECT_THAT(writer->Close(), IsOk());
+
+  EXPECT_THAT(ReadBytes(file_path), ElementsAre(1, 2, 3, 4, 5, 1, 2, 3));
+}
+
+TEST(GatherFileWriter, WritesManySpans) {
+  const std::filesystem::path file_path(GetAndCleanupOutputFileName(".bin"));
+  // More spans than a single gather call may accept on some platforms.
+  constexpr int kNumSpans = 5000;
+  std::vector<uint8_t> bytes(kNumSpans);
+  std::vector<absl::Span<const uint8_t>> spans;
+  for (int i = 0; i < kNumSpans; ++i) {
+    bytes[i] = static_cast<uint8_t>(i);
+    spans.push_back(absl::MakeConstSpan(bytes).subspan(i, 1));
+  }
+  auto writer = GatherFileWriter::Create(file_path);
+  ASSERT_NE(writer, nullptr);
+
+  EXPECT_THAT(writer->Write(spans), IsOk());
+  EXPECT_THAT(writer->Close(), IsOk());
+
+  EXPECT_THAT(ReadBytes(file_path), ElementsAreArray(bytes));
+}
+
+TEST(GatherFileWriter, OverwriteReplacesBytesAndWriteStillAppends) {
+  const std::filesystem::path file_path(GetAndCleanupOutputFileName(".bin"));
+  const std::vector<uint8_t> kOriginal = {1, 2, 3, 4};
+  const std::vector<uint8_t> kReplacement = {9, 9};
+  auto writer = GatherFileWriter::Create(file_path);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_THAT(writer->Write({absl::MakeConstSpan(kOriginal)}), IsOk());
+
+  EXPECT_THAT(writer->Overwrite(1, absl::MakeConstSpan(kReplacement)), IsOk());
+  EXPECT_THAT(writer->Write({absl::MakeConstSpan(kOriginal)}), IsOk());
+  EXPECT_THAT(writer->Close(), IsOk());
+
+  EXPECT_THAT(ReadBytes(file_path), ElementsAre(1, 9, 9, 4, 1, 2, 3, 4));
+}
+
+TEST(GatherFileWriter, OverwriteFailsPastTheEndOfTheFile) {
+  const std::filesystem::path file_path(GetAndCleanupOutputFileName(".bin"));
+  const std::vector<uint8_t> kBytes = {1, 2, 3, 4};
+  auto writer = GatherFileWriter::Create(file_path);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_THAT(writer->Write({absl::MakeConstSpan(kBytes)}), IsOk());
+
+  EXPECT_THAT(writer->Overwrite(1, absl::MakeConstSpan(kBytes)),
+              StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(GatherFileWriter, WriteFailsAfterClose) {
+  const std::filesystem::path file_path(GetAndCleanupOutputFileName(".bin"));
+  const std::vector<uint8_t> kBytes = {1, 2, 3, 4};
+  auto writer = GatherFileWriter::Create(file_path);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  EXPECT_THAT(writer->Write({absl::MakeConstSpan(kBytes)}),
+              StatusIs(absl::StatusCode::kFailedPrecondition));
+  EXPECT_THAT(writer->Close(), StatusIs(absl::StatusCode::kFailedPrecondition));
+}
+
+TEST(GatherFileWriter, WriteReportsTheSystemError) {
+  // Writes to `/dev/full` fail with `ENOSPC`.
+  const std::filesystem::path file_path("/dev/full");
+  if (!std::filesystem::exists(file_path)) {
+    GTEST_SKIP() << file_path << " is not available on this platform.";
+  }
+  const std::vector<uint8_t> kBytes = {1, 2, 3, 4};
+  auto writer = GatherFileWriter::Create(file_path);
+  ASSERT_NE(writer, nullptr);
+
+  EXPECT_THAT(writer->Write({absl::MakeConstSpan(kBytes)}),
+              StatusIs(absl::StatusCode::kUnknown,
+                       HasSubstr(std::strerror(ENOSPC))));
+}
+
+TEST(GatherFileWriter, CreateFailsForInvalidPath) {
+  const std::filesystem::path file_path(
+      std::filesystem::path(GetAndCleanupOutputFileName("")) / "missing" /
+      "file.bin");
+
+  EXPECT_EQ(GatherFileWriter::Create(file_path), nullptr);
+}
+
+}  // namespace
+}  // namespace iamf_tools
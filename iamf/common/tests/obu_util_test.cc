@@ -32,6 +32,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "iamf/cli/tests/cli_test_utils.h"
+#include "iamf/common/planar_sample_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/types.h"
 
@@ -1161,6 +1162,99 @@ TEST(ConvertTimeChannelToInterleaved, AppliesTransform) {
   EXPECT_THAT(result, ElementsAreArray(kExpectedResult));
 }
 
+TEST(ConvertInterleavedToPlanar, FailsIfSamplesIsNotAMultipleOfChannels) {
+  constexpr std::array<int32_t, 4> kFourTestValues = {1, 2, 3, 4};
+  PlanarSampleBuffer<int32_t> undefined_result(/*num_channels=*/3,
+                                               /*max_num_ticks=*/2);
+
+  EXPECT_THAT(
+      ConvertInterleavedToPlanar(absl::MakeConstSpan(kFourTestValues),
+                                 kIdentityTransform, undefined_result),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ConvertInterleavedToPlanar, FailsIfTooFewTicksInResult) {
+  constexpr std::array<int32_t, 4> kFourTestValues = {1, 2, 3, 4};
+  PlanarSampleBuffer<int32_t> undefined_result(/*num_channels=*/2,
+                                               /*max_num_ticks=*/1);
+
+  EXPECT_THAT(
+      ConvertInterleavedToPlanar(absl::MakeConstSpan(kFourTestValues),
+                                 kIdentityTransform, undefined_result),
+      StatusIs(absl::StatusCode::kInvalidArgument));
+}
+
+TEST(ConvertInterleavedToPlanar, PropagatesError) {
+  const absl::Status kError = absl::InternalError("Test error");
+  constexpr std::array<int32_t, 4> kSamples{1, 2, 3, 4};
+  const absl::AnyInvocable<absl::Status(int32_t, int32_t&) const>
+      kAlwaysErrorTransform =
+          [kError](int32_t input, int32_t& output) { return kError; };
+  PlanarSampleBuffer<int32_t> undefined_result(/*num_channels=*/2,
+                                               /*max_num_ticks=*/2);
+
+  EXPECT_EQ(ConvertInterleavedToPlanar(absl::MakeConstSpan(kSamples),
+                                       kAlwaysErrorTransform, undefined_result),
+            kError);
+}
+
+TEST(ConvertInterleavedToPlanar, SetsNumberOfValidTicks) {
+  constexpr std::array<int32_t, 2> kOneTickOfTwoChannels{1, 2};
+  PlanarSampleBuffer<int32_t> result(/*num_channels=*/2, /*max_num_ticks=*/4);
+
+  EXPECT_THAT(ConvertInterleavedToPlanar(
+                  absl::MakeConstSpan(kOneTickOfTwoChannels),
+                  kIdentityTransform, result),
+              IsOk());
+
+  EXPECT_EQ(result.num_ticks(), 1);
+  EXPECT_EQ(result.max_num_ticks(), 4);
+}
+
+TEST(ConvertInterleavedToPlanar, DeinterleavesResults) {
+  constexpr std::array<int32_t, 6> kTwoTicksOfThreeChannels{1, 2, 3, 4, 5, 6};
+  PlanarSampleBuffer<int32_t> result(/*num_channels=*/3, /*max_num_ticks=*/2);
+
+  EXPECT_THAT(ConvertInterleavedToPlanar(
+                  absl::MakeConstSpan(kTwoTicksOfThreeChannels),
+                  kIdentityTransform, result),
+              IsOk());
+
+  EXPECT_THAT(result.Channel(0), ElementsAreArray({1, 4}));
+  EXPECT_THAT(result.Channel(1), ElementsAreArray({2, 5}));
+  EXPECT_THAT(result.Channel(2), ElementsAreArray({3, 6}));
+}
+
+TEST(ConvertPlanarToInterleaved, InterleavesValidTicks) {
+  auto input = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+      std::vector<std::vector<int32_t>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+  ASSERT_THAT(input, IsOk());
+  ASSERT_THAT(input->SetNumTicks(2), IsOk());
+  std::vector<int32_t> result = {99};
+
+  EXPECT_THAT(ConvertPlanarToInterleaved(*input, kIdentityTransform, result),
+              IsOk());
+
+  EXPECT_THAT(result, ElementsAreArray({1, 2, 3, 4, 5, 6}));
+}
+
+TEST(ConvertPlanarToInterleaved, AppliesTransform) {
+  const auto input = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+      std::vector<std::vector<int32_t>>{{1, 2}, {3, 4}});
+  ASSERT_THAT(input, IsOk());
+  std::vector<int32_t> result;
+  const absl::AnyInvocable<absl::Status(int32_t, int32_t&) const>
+      kDoublingTransform = [](int32_t input, int32_t& output) {
+        output = input * 2;
+        return absl::OkStatus();
+      };
+
+  EXPECT_THAT(ConvertPlanarToInterleaved(*input, kDoublingTransform, result),
+              IsOk());
+
+  EXPECT_THAT(result, ElementsAreArray({2, 4, 6, 8}));
+}
+
 TEST(CopyFromMap, ReturnsOkWhenLookupSucceeds) {
   const absl::flat_hash_map<int, bool> kIntegerToIsPrime = {
       {1, false}, {2, true}, {3, true}, {4, false}};
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/common/planar_sample_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/status/status_matchers.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::Not;
+
+constexpr size_t kNumChannels = 2;
+constexpr size_t kMaxNumTicks = 4;
+
+TEST(PlanarSampleBuffer, DefaultConstructedBufferIsEmpty) {
+  const PlanarSampleBuffer<int32_t> buffer;
+
+  EXPECT_EQ(buffer.num_channels(), 0);
+  EXPECT_EQ(buffer.num_ticks(), 0);
+  EXPECT_EQ(buffer.max_num_ticks(), 0);
+}
+
+TEST(PlanarSampleBuffer, ConstructorZeroInitializesAllTicks) {
+  const PlanarSampleBuffer<double> buffer(kNumChannels, kMaxNumTicks);
+
+  EXPECT_EQ(buffer.num_channels(), kNumChannels);
+  EXPECT_EQ(buffer.num_ticks(), kMaxNumTicks);
+  EXPECT_EQ(buffer.max_num_ticks(), kMaxNumTicks);
+  for (size_t channel = 0; channel < kNumChannels; ++channel) {
+    EXPECT_THAT(buffer.Channel(channel), ElementsAre(0, 0, 0, 0));
+  }
+}
+
+TEST(PlanarSampleBuffer, ChannelsAreIndependent) {
+  PlanarSampleBuffer<int32_t> buffer(kNumChannels, kMaxNumTicks);
+
+  buffer.FillChannel(1, 7);
+  buffer.Channel(0)[2] = 5;
+
+  EXPECT_THAT(buffer.Channel(0), ElementsAre(0, 0, 5, 0));
+  EXPECT_THAT(buffer.Channel(1), ElementsAre(7, 7, 7, 7));
+}
+
+TEST(PlanarSampleBuffer, SetNumTicksShrinksChannelViews) {
+  PlanarSampleBuffer<int32_t> buffer(kNumChannels, kMaxNumTicks);
+  buffer.FillChannel(0, 1);
+  buffer.FillChannel(1, 2);
+
+  EXPECT_THAT(buffer.SetNumTicks(2), IsOk());
+
+  EXPECT_EQ(buffer.num_ticks(), 2);
+  EXPECT_EQ(buffer.max_num_ticks(), kMaxNumTicks);
+  EXPECT_THAT(buffer.Channel(0), ElementsAre(1, 1));
+  EXPECT_THAT(buffer.Channel(1), ElementsAre(2, 2));
+}
+
+TEST(PlanarSampleBuffer, SetNumTicksKeepsSamplesWhenGrowingAgain) {
+  PlanarSampleBuffer<int32_t> buffer(1, kMaxNumTicks);
+  buffer.FillChannel(0, 3);
+  EXPECT_THAT(buffer.SetNumTicks(1), IsOk());
+
+  EXPECT_THAT(buffer.SetNumTicks(kMaxNumTicks), IsOk());
+
+  EXPECT_THAT(buffer.Channel(0), ElementsAre(3, 3, 3, 3));
+}
+
+TEST(PlanarSampleBuffer, SetNumTicksFailsWhenExceedingMaxNumTicks) {
+  PlanarSampleBuffer<int32_t> buffer(kNumChannels, kMaxNumTicks);
+
+  EXPECT_THAT(buffer.SetNumTicks(kMaxNumTicks + 1), Not(IsOk()));
+  EXPECT_EQ(buffer.num_ticks(), kMaxNumTicks);
+}
+
+TEST(PlanarSampleBuffer, ResizeChangesShapeAndValidatesAllTicks) {
+  PlanarSampleBuffer<int32_t> buffer(1, kMaxNumTicks);
+  EXPECT_THAT(buffer.SetNumTicks(1), IsOk());
+
+  buffer.Resize(kNumChannels, kMaxNumTicks - 1);
+
+  EXPECT_EQ(buffer.num_channels(), kNumChannels);
+  EXPECT_EQ(buffer.num_ticks(), kMaxNumTicks - 1);
+  EXPECT_EQ(buffer.max_num_ticks(), kMaxNumTicks - 1);
+  EXPECT_EQ(buffer.Channel(1).size(), kMaxNumTicks - 1);
+}
+
+TEST(PlanarSampleBuffer, EqualityIgnoresInvalidTicks) {
+  PlanarSampleBuffer<int32_t> lhs(kNumChannels, kMaxNumTicks);
+  PlanarSampleBuffer<int32_t> rhs(kNumChannels, kMaxNumTicks + 1);
+  rhs.FillChannel(0, 9);
+  EXPECT_THAT(lhs.SetNumTicks(1), IsOk());
+  EXPECT_THAT(rhs.SetNumTicks(1), IsOk());
+  EXPECT_FALSE(lhs == rhs);
+
+  rhs.Channel(0)[0] = 0;
+
+  EXPECT_TRUE(lhs == rhs);
+}
+
+TEST(PlanarSampleBuffer, EqualityComparesShape) {
+  EXPECT_FALSE(PlanarSampleBuffer<int32_t>(1, 2) ==
+               PlanarSampleBuffer<int32_t>(2, 1));
+}
+
+TEST(PlanarSampleBuffer, FromTimeChannelTransposesSamples) {
+  const std::vector<std::vector<int32_t>> kTimeChannelSamples = {
+      {0, 10}, {1, 11}, {2, 12}};
+
+  const auto buffer = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+      absl::MakeConstSpan(kTimeChannelSamples));
+  ASSERT_THAT(buffer, IsOk());
+
+  EXPECT_EQ(buffer->num_channels(), 2);
+  EXPECT_EQ(buffer->num_ticks(), 3);
+  EXPECT_THAT(buffer->Channel(0), ElementsAre(0, 1, 2));
+  EXPECT_THAT(buffer->Channel(1), ElementsAre(10, 11, 12));
+}
+
+TEST(PlanarSampleBuffer, FromTimeChannelFailsWhenTicksHaveDifferentSizes) {
+  const std::vector<std::vector<int32_t>> kRaggedSamples = {{0, 10}, {1}};
+
+  EXPECT_THAT(PlanarSampleBuffer<int32_t>::FromTimeChannel(
+                  absl::MakeConstSpan(kRaggedSamples)),
+              Not(IsOk()));
+}
+
+TEST(PlanarSampleBuffer, ToTimeChannelIsInverseOfFromTimeChannel) {
+  const std::vector<std::vector<int32_t>> kTimeChannelSamples = {
+      {0, 10}, {1, 11}, {2, 12}};
+  const auto buffer = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+      absl::MakeConstSpan(kTimeChannelSamples));
+  ASSERT_THAT(buffer, IsOk());
+
+  EXPECT_EQ(buffer->ToTimeChannel(), kTimeChannelSamples);
+}
+
+TEST(PlanarSampleBuffer, ToTimeChannelOmitsInvalidTicks) {
+  PlanarSampleBuffer<int32_t> buffer(kNumChannels, kMaxNumTicks);
+  buffer.FillChannel(1, 1);
+  EXPECT_THAT(buffer.SetNumTicks(1), IsOk());
+
+  EXPECT_EQ(buffer.ToTimeChannel(),
+            (std::vector<std::vector<int32_t>>{{0, 1}}));
+}
+
+TEST(PlanarSampleBuffer, ToInterleavedInterleavesValidTicks) {
+  const std::vector<std::vector<int32_t>> kTimeChannelSamples = {
+      {0, 10}, {1, 11}, {2, 12}};
+  auto buffer = PlanarSampleBuffer<int32_t>::FromTimeChannel(
+      absl::MakeConstSpan(kTimeChannelSamples));
+  ASSERT_THAT(buffer, IsOk());
+  EXPECT_THAT(buffer->SetNumTicks(2), IsOk());
+
+  std::vector<int32_t> interleaved = {99, 99, 99, 99, 99, 99, 99};
+  buffer->ToInterleaved(interleaved);
+
+  EXPECT_THAT(interleaved, ElementsAreArray({0, 10, 1, 11}));
+}
+
+}  // namespace
+}  // namespace iamf_tools
@@ -1,18 +1,25 @@
 #include <sys/types.h>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/status/status_matchers.h"
 #include "absl/types/span.h"
 #include "fuzztest/fuzztest.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
 #include "iamf/common/read_bit_buffer.h"
 #include "iamf/obu/types.h"
 
 namespace iamf_tools {
 namespace {
 
+using ::absl_testing::IsOk;
+using ::absl_testing::StatusIs;
+
 void ReadUnsignedLiteral64NoUndefinedBehavior(std::vector<uint8_t> data,
                                               int num_bits) {
   std::unique_ptr<MemoryBasedReadBitBuffer> rb =
@@ -109,5 +116,49 @@ void ReadBooleanNoUndefinedBehavior(std::vector<uint8_t> data) {
 
 FUZZ_TEST(ReadBitBufferFuzzTest, ReadBooleanNoUndefinedBehavior);
 
+// Reads `num_bits` from `data` one bit at a time, most significant bit first.
+// Returns false if there are not enough bits left.
+bool ReferenceReadUnsignedLiteral(const std::vector<uint8_t>& data,
+                                  int num_bits, int64_t& bit_offset,
+                                  uint64_t& output) {
+  if (bit_offset + num_bits > static_cast<int64_t>(data.size()) * 8) {
+    return false;
+  }
+  output = 0;
+  for (int i = 0; i < num_bits; ++i, ++bit_offset) {
+    const uint8_t byte = data[bit_offset / 8];
+    output = (output << 1) | ((byte >> (7 - bit_offset % 8)) & 1);
+  }
+  return true;
+}
+
+void ReadUnsignedLiteralMatchesBitByBitReference(
+    std::vector<uint8_t> data, int64_t capacity,
+    std::vector<int> num_bits_per_read) {
+  std::unique_ptr<MemoryBasedReadBitBuffer> rb =
+      MemoryBasedReadBitBuffer::CreateFromSpan(capacity,
+                                               absl::MakeConstSpan(data));
+  int64_t reference_bit_offset = 0;
+  for (const int num_bits : num_bits_per_read) {
+    uint64_t expected_data;
+    const bool reference_ok = ReferenceReadUnsignedLiteral(
+        data, num_bits, reference_bit_offset, expected_data);
+    uint64_t read_data;
+    const absl::Status status = rb->ReadUnsignedLiteral(num_bits, read_data);
+    if (!reference_ok) {
+      EXPECT_THAT(status, StatusIs(absl::StatusCode::kResourceExhausted));
+      return;
+    }
+    ASSERT_THAT(status, IsOk());
+    EXPECT_EQ(read_data, expected_data);
+    EXPECT_EQ(rb->Tell(), reference_bit_offset);
+  }
+}
+
+FUZZ_TEST(ReadBitBufferFuzzTest, ReadUnsignedLiteralMatchesBitByBitReference)
+    .WithDomains(fuzztest::Arbitrary<std::vector<uint8_t>>(),
+                 fuzztest::InRange<int64_t>(1, 512),
+                 fuzztest::VectorOf(fuzztest::InRange(0, 64)));
+
 }  // namespace
 }  // namespace iamf_tools
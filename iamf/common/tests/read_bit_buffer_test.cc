@@ -14,10 +14,12 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <fstream>
 #include <ios>
 #include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -56,6 +58,14 @@ TEST(FileBasedReadBitBufferTest, CreateFromFilePathFailsWithNegativeCapacity) {
               ::testing::IsNull());
 }
 
+#ifndef _WIN32
+TEST(MmapReadBitBufferTest, CreateFromFilePathFailsWhenFileDoesNotExist) {
+  const auto file_path = GetAndCleanupOutputFileName(".iamf");
+  EXPECT_THAT(MmapReadBitBuffer::CreateFromFilePath(file_path),
+              ::testing::IsNull());
+}
+#endif
+
 TEST(StreamBasedReadBitBufferTest, CreateFromStreamFailsWithNegativeCapacity) {
   EXPECT_THAT(StreamBasedReadBitBuffer::Create(-1), ::testing::IsNull());
 }
@@ -87,17 +97,30 @@ std::unique_ptr<MemoryBasedReadBitBuffer> CreateConcreteReadBitBuffer(
       capacity, absl::MakeConstSpan(source_data));
 }
 
-template <>
-std::unique_ptr<FileBasedReadBitBuffer> CreateConcreteReadBitBuffer(
-    int64_t capacity, std::vector<uint8_t>& source_data) {
-  // First write the content of `source_data` into a temporary file.
+std::filesystem::path WriteTemporaryFile(
+    const std::vector<uint8_t>& source_data) {
   const auto output_filename = GetAndCleanupOutputFileName(".iamf");
   std::ofstream ofs(output_filename, std::ios::binary | std::ios::out);
-  ofs.write(reinterpret_cast<char*>(source_data.data()), source_data.size());
+  ofs.write(reinterpret_cast<const char*>(source_data.data()),
+            source_data.size());
   ofs.close();
+  return output_filename;
+}
 
-  // Then create a `FileBasedReadBitBuffer` from the temporary file.
-  return FileBasedReadBitBuffer::CreateFromFilePath(capacity, output_filename);
+template <>
+std::unique_ptr<FileBasedReadBitBuffer> CreateConcreteReadBitBuffer(
+    int64_t capacity, std::vector<uint8_t>& source_data) {
+  // First write the content of `source_data` into a temporary file. Then
+  // create a `FileBasedReadBitBuffer` from the temporary file.
+  return FileBasedReadBitBuffer::CreateFromFilePath(
+      capacity, WriteTemporaryFile(source_data));
+}
+
+template <>
+std::unique_ptr<MmapReadBitBuffer> CreateConcreteReadBitBuffer(
+    int64_t /*capacity*/, std::vector<uint8_t>& source_data) {
+  // The whole file is mapped, so there is no capacity to configure.
+  return MmapReadBitBuffer::CreateFromFilePath(WriteTemporaryFile(source_data));
 }
 
 template <>
@@ -125,9 +148,15 @@ class ReadBitBufferTest : public ::testing::Test {
   std::unique_ptr<ReadBitBuffer> rb_;
 };
 
+#ifdef _WIN32
 using BufferReaderTypes =
     ::testing::Types<MemoryBasedReadBitBuffer, FileBasedReadBitBuffer,
                      StreamBasedReadBitBuffer>;
+#else
+using BufferReaderTypes =
+    ::testing::Types<MemoryBasedReadBitBuffer, FileBasedReadBitBuffer,
+                     StreamBasedReadBitBuffer, MmapReadBitBuffer>;
+#endif
 TYPED_TEST_SUITE(ReadBitBufferTest, BufferReaderTypes);
 
 TYPED_TEST(ReadBitBufferTest, CreateReadBitBufferSucceeds) {
@@ -288,6 +317,83 @@ TYPED_TEST(ReadBitBufferTest, ReadUnsignedLiteralAfterSeek) {
   EXPECT_EQ(output_literal, 0b0000000);
 }
 
+// Reads `num_bits` from `source_data` one bit at a time, most significant bit
+// first. Returns false if there are not enough bits left.
+bool ReferenceReadUnsignedLiteral(const std::vector<uint8_t>& source_data,
+                                  int num_bits, int64_t& bit_offset,
+                                  uint64_t& output) {
+  if (bit_offset + num_bits >
+      static_cast<int64_t>(source_data.size()) * kBitsPerByte) {
+    return false;
+  }
+  output = 0;
+  for (int i = 0; i < num_bits; ++i, ++bit_offset) {
+    const uint8_t byte = source_data[bit_offset / kBitsPerByte];
+    output = (output << 1) | ((byte >> (7 - bit_offset % kBitsPerByte)) & 1);
+  }
+  return true;
+}
+
+TYPED_TEST(ReadBitBufferTest, RandomReadsMatchBitByBitReference) {
+  for (const int64_t capacity : {1, 3, 8, 9, 1024}) {
+    std::mt19937 rng(capacity);
+    std::uniform_int_distribution<int> byte_distribution(0, 255);
+    std::uniform_int_distribution<int> num_bits_distribution(0, 64);
+    std::uniform_int_distribution<int> span_size_distribution(0, 9);
+    std::bernoulli_distribution read_span_distribution(0.25);
+    const std::vector<uint8_t> source_data = [&] {
+      std::vector<uint8_t> result(std::uniform_int_distribution<>(0, 80)(rng));
+      for (auto& byte : result) {
+        byte = byte_distribution(rng);
+      }
+      return result;
+    }();
+    this->source_data_ = source_data;
+    this->rb_capacity_ = capacity;
+    this->CreateReadBitBuffer();
+
+    // Read until the source is exhausted, mixing literals of all sizes with
+    // byte spans.
+    int64_t reference_bit_offset = 0;
+    while (true) {
+      if (read_span_distribution(rng)) {
+        std::vector<uint8_t> output(span_size_distribution(rng));
+        std::vector<uint8_t> expected_output(output.size());
+        bool reference_ok = true;
+        for (auto& byte : expected_output) {
+          uint64_t value = 0;
+          reference_ok = reference_ok &&
+                         ReferenceReadUnsignedLiteral(
+                             source_data, kBitsPerByte, reference_bit_offset,
+                             value);
+          byte = static_cast<uint8_t>(value);
+        }
+        const auto status = this->rb_->ReadUint8Span(absl::MakeSpan(output));
+        if (!reference_ok) {
+          EXPECT_THAT(status, StatusIs(kResourceExhausted));
+          break;
+        }
+        ASSERT_THAT(status, IsOk());
+        EXPECT_EQ(output, expected_output);
+      } else {
+        const int num_bits = num_bits_distribution(rng);
+        uint64_t expected_output = 0;
+        const bool reference_ok = ReferenceReadUnsignedLiteral(
+            source_data, num_bits, reference_bit_offset, expected_output);
+        uint64_t output = 0;
+        const auto status = this->rb_->ReadUnsignedLiteral(num_bits, output);
+        if (!reference_ok) {
+          EXPECT_THAT(status, StatusIs(kResourceExhausted));
+          break;
+        }
+        ASSERT_THAT(status, IsOk());
+        EXPECT_EQ(output, expected_output);
+      }
+      EXPECT_EQ(this->rb_->Tell(), reference_bit_offset);
+    }
+  }
+}
+
 // ---- ReadULeb128 Tests -----
 
 // Successful Uleb128 reads.
@@ -893,6 +999,110 @@ TEST(StreamBasedReadBitBufferTest, PushBytesCanReadBytesSucceeds) {
   EXPECT_TRUE(rb->CanReadBytes(3));
 }
 
+TEST(StreamBasedReadBitBufferTest, PushBytesAcceptsSpans) {
+  const std::vector<uint8_t> source_data = {0x01, 0x23, 0x45, 0x67};
+  auto rb = StreamBasedReadBitBuffer::Create(1024);
+  ASSERT_NE(rb, nullptr);
+
+  EXPECT_THAT(rb->PushBytes(absl::MakeConstSpan(source_data).subspan(1, 2)),
+              IsOk());
+
+  std::vector<uint8_t> output(2);
+  EXPECT_THAT(rb->ReadUint8Span(absl::MakeSpan(output)), IsOk());
+  EXPECT_EQ(output, std::vector<uint8_t>({0x23, 0x45}));
+  EXPECT_FALSE(rb->CanReadBytes(1));
+}
+
+TEST(StreamBasedReadBitBufferTest, FlushFailsWithNegativeNumBytes) {
+  auto rb = StreamBasedReadBitBuffer::Create(1024);
+  ASSERT_NE(rb, nullptr);
+
+  EXPECT_THAT(rb->Flush(-1), StatusIs(kInvalidArgument));
+}
+
+TEST(StreamBasedReadBitBufferTest, FlushFailsWithMoreBytesThanPushed) {
+  const std::vector<uint8_t> source_data = {0x01, 0x23, 0x45};
+  auto rb = StreamBasedReadBitBuffer::Create(1024);
+  ASSERT_NE(rb, nullptr);
+  EXPECT_THAT(rb->PushBytes(source_data), IsOk());
+
+  EXPECT_THAT(rb->Flush(4), StatusIs(kInvalidArgument));
+}
+
+TEST(StreamBasedReadBitBufferTest, ReadsDataWhichWrapsAroundTheRing) {
+  // Fill most of the ring, then consume and flush it, so the next push wraps
+  // around the end of the ring. The ring doubles from 64 to 128 bytes on the
+  // second push.
+  constexpr int64_t kRingSize = 128;
+  constexpr int64_t kNumBytesBeforeWrap = 5;
+  const std::vector<uint8_t> filler(kRingSize - kNumBytesBeforeWrap, 0xff);
+  auto rb = StreamBasedReadBitBuffer::Create(16);
+  ASSERT_NE(rb, nullptr);
+  const auto filler_span = absl::MakeConstSpan(filler);
+  ASSERT_THAT(rb->PushBytes(filler_span.first(kRingSize / 2)), IsOk());
+  ASSERT_THAT(rb->PushBytes(filler_span.subspan(kRingSize / 2)), IsOk());
+  std::vector<uint8_t> consumed(filler.size());
+  ASSERT_THAT(rb->ReadUint8Span(absl::MakeSpan(consumed)), IsOk());
+  ASSERT_THAT(rb->Flush(filler.size()), IsOk());
+  std::vector<uint8_t> source_data(64);
+  for (int i = 0; i < source_data.size(); ++i) {
+    source_data[i] = static_cast<uint8_t>(i);
+  }
+
+  EXPECT_THAT(rb->PushBytes(source_data), IsOk());
+
+  // Read unaligned literals followed by the rest of the data, to cross the end
+  // of the ring with both kinds of reads.
+  uint64_t first_bits = 0;
+  EXPECT_THAT(rb->ReadUnsignedLiteral(4, first_bits), IsOk());
+  EXPECT_EQ(first_bits, 0);
+  uint64_t unaligned_bits = 0;
+  EXPECT_THAT(rb->ReadUnsignedLiteral(60, unaligned_bits), IsOk());
+  EXPECT_EQ(unaligned_bits, 0x01020304050607);
+  std::vector<uint8_t> output(source_data.size() - 8);
+  EXPECT_THAT(rb->ReadUint8Span(absl::MakeSpan(output)), IsOk());
+  EXPECT_EQ(output, std::vector<uint8_t>(source_data.begin() + 8,
+                                         source_data.end()));
+  EXPECT_FALSE(rb->IsDataAvailable());
+}
+
+TEST(StreamBasedReadBitBufferTest, ReadsAcrossRingGrowth) {
+  const std::vector<uint8_t> kFirstBytes = {0x01, 0x23, 0x45, 0x67};
+  auto rb = StreamBasedReadBitBuffer::Create(1024);
+  ASSERT_NE(rb, nullptr);
+  ASSERT_THAT(rb->PushBytes(kFirstBytes), IsOk());
+  // Load the first bytes, which are served directly from the ring.
+  uint64_t first_byte = 0;
+  ASSERT_THAT(rb->ReadUnsignedLiteral(8, first_byte), IsOk());
+  EXPECT_EQ(first_byte, 0x01);
+  std::vector<uint8_t> more_bytes(4096);
+  for (int i = 0; i < more_bytes.size(); ++i) {
+    more_bytes[i] = static_cast<uint8_t>(i);
+  }
+
+  // Pushing more bytes than the ring holds reallocates it.
+  EXPECT_THAT(rb->PushBytes(more_bytes), IsOk());
+
+  // Bytes loaded before the growth are still readable.
+  std::vector<uint8_t> output(3);
+  EXPECT_THAT(rb->ReadUint8Span(absl::MakeSpan(output)), IsOk());
+  EXPECT_EQ(output, std::vector<uint8_t>({0x23, 0x45, 0x67}));
+  output.resize(more_bytes.size());
+  EXPECT_THAT(rb->ReadUint8Span(absl::MakeSpan(output)), IsOk());
+  EXPECT_EQ(output, more_bytes);
+  EXPECT_FALSE(rb->IsDataAvailable());
+}
+
+TEST(StreamBasedReadBitBufferTest, PushBytesSucceedsWithNoBytes) {
+  auto rb = StreamBasedReadBitBuffer::Create(1024);
+  ASSERT_NE(rb, nullptr);
+
+  EXPECT_THAT(rb->PushBytes({}), IsOk());
+  EXPECT_THAT(rb->Flush(0), IsOk());
+
+  EXPECT_FALSE(rb->IsDataAvailable());
+}
+
 TEST(StreamBasedReadBitBufferTest, PushBytesFailsOnNegativeNumBytes) {
   std::vector<uint8_t> source_data = {0x01, 0x23, 0x45};
   auto rb = StreamBasedReadBitBuffer::Create(1024);
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/common/sample_ring_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/status/status_matchers.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "iamf/common/planar_sample_buffer.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::absl_testing::IsOk;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Not;
+
+constexpr size_t kStereo = 2;
+constexpr size_t kCapacity = 4;
+
+TEST(SampleRingBuffer, ConstructedBufferIsEmpty) {
+  const SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.size(), 0);
+  EXPECT_EQ(buffer.num_channels(), kStereo);
+  EXPECT_EQ(buffer.capacity(), kCapacity);
+}
+
+TEST(SampleRingBuffer, PopsTicksInTheOrderTheyWerePushed) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+  EXPECT_THAT(buffer.PushBack({3, 4}), IsOk());
+  EXPECT_THAT(buffer.PushBack({5, 6}), IsOk());
+
+  PlanarSampleBuffer<int32_t> ticks;
+  EXPECT_THAT(buffer.PopFront(2, ticks), IsOk());
+
+  EXPECT_EQ(ticks.ToTimeChannel(),
+            (std::vector<std::vector<int32_t>>{{1, 2}, {3, 4}}));
+  EXPECT_EQ(buffer.size(), 1);
+}
+
+TEST(SampleRingBuffer, PushZerosPushesZeroedTicks) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+
+  buffer.PushZeros(2);
+
+  PlanarSampleBuffer<int32_t> ticks;
+  EXPECT_THAT(buffer.PopFront(3, ticks), IsOk());
+  EXPECT_EQ(ticks.ToTimeChannel(),
+            (std::vector<std::vector<int32_t>>{{1, 2}, {0, 0}, {0, 0}}));
+}
+
+TEST(SampleRingBuffer, WrapsAroundWithoutGrowing) {
+  SampleRingBuffer<int32_t> buffer(1, kCapacity);
+  PlanarSampleBuffer<int32_t> ticks;
+  for (int32_t i = 0; i < 3; ++i) {
+    EXPECT_THAT(buffer.PushBack({i}), IsOk());
+  }
+  EXPECT_THAT(buffer.PopFront(2, ticks), IsOk());
+
+  // Three more ticks wrap past the end of the underlying storage.
+  for (int32_t i = 3; i < 6; ++i) {
+    EXPECT_THAT(buffer.PushBack({i}), IsOk());
+  }
+
+  EXPECT_EQ(buffer.capacity(), kCapacity);
+  EXPECT_THAT(buffer.PopFront(4, ticks), IsOk());
+  EXPECT_EQ(ticks.ToTimeChannel(),
+            (std::vector<std::vector<int32_t>>{{2}, {3}, {4}, {5}}));
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(SampleRingBuffer, GrowsWhenPushingPastCapacity) {
+  SampleRingBuffer<int32_t> buffer(1, 2);
+  PlanarSampleBuffer<int32_t> ticks;
+  EXPECT_THAT(buffer.PushBack({0}), IsOk());
+  EXPECT_THAT(buffer.PushBack({1}), IsOk());
+  EXPECT_THAT(buffer.PopFront(1, ticks), IsOk());
+  EXPECT_THAT(buffer.PushBack({2}), IsOk());
+
+  // The queued ticks are wrapped around when the buffer needs to grow.
+  buffer.PushZeros(3);
+
+  EXPECT_GE(buffer.capacity(), 5);
+  EXPECT_THAT(buffer.PopFront(5, ticks), IsOk());
+  EXPECT_EQ(ticks.ToTimeChannel(),
+            (std::vector<std::vector<int32_t>>{{1}, {2}, {0}, {0}, {0}}));
+}
+
+TEST(SampleRingBuffer, DefaultConstructedBufferGrowsOnPushZeros) {
+  SampleRingBuffer<int32_t> buffer;
+
+  buffer.PushZeros(3);
+
+  EXPECT_EQ(buffer.size(), 3);
+  PlanarSampleBuffer<int32_t> ticks;
+  EXPECT_THAT(buffer.PopFront(3, ticks), IsOk());
+  EXPECT_EQ(ticks.ToTimeChannel(),
+            (std::vector<std::vector<int32_t>>{{}, {}, {}}));
+}
+
+TEST(SampleRingBuffer, PushBackFailsWithWrongNumberOfChannels) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+
+  EXPECT_THAT(buffer.PushBack({1}), Not(IsOk()));
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(SampleRingBuffer, PopFrontFailsWhenNotEnoughTicksAreQueued) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+
+  PlanarSampleBuffer<int32_t> ticks;
+  EXPECT_THAT(buffer.PopFront(2, ticks), Not(IsOk()));
+  EXPECT_EQ(buffer.size(), 1);
+}
+
+TEST(SampleRingBuffer, PopFrontOverwritesOutput) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+
+  PlanarSampleBuffer<int32_t> ticks(kStereo, 3);
+  ticks.FillChannel(0, 9);
+  ticks.FillChannel(1, 9);
+  EXPECT_THAT(buffer.PopFront(1, ticks), IsOk());
+
+  EXPECT_EQ(ticks.ToTimeChannel(), (std::vector<std::vector<int32_t>>{{1, 2}}));
+}
+
+TEST(SampleRingBuffer, FrontViewsTicksWithoutPopping) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+  EXPECT_THAT(buffer.PushBack({3, 4}), IsOk());
+
+  const auto front = buffer.Front(1, 2);
+
+  ASSERT_THAT(front, IsOk());
+  EXPECT_THAT(front->first, ElementsAre(2, 4));
+  EXPECT_THAT(front->second, IsEmpty());
+  EXPECT_EQ(buffer.size(), 2);
+}
+
+TEST(SampleRingBuffer, FrontSplitsTheViewAtTheWrapPoint) {
+  SampleRingBuffer<int32_t> buffer(1, kCapacity);
+  for (int32_t i = 0; i < 3; ++i) {
+    EXPECT_THAT(buffer.PushBack({i}), IsOk());
+  }
+  EXPECT_THAT(buffer.DropFront(2), IsOk());
+  for (int32_t i = 3; i < 6; ++i) {
+    EXPECT_THAT(buffer.PushBack({i}), IsOk());
+  }
+
+  const auto front = buffer.Front(0, 4);
+
+  ASSERT_THAT(front, IsOk());
+  EXPECT_THAT(front->first, ElementsAre(2, 3));
+  EXPECT_THAT(front->second, ElementsAre(4, 5));
+}
+
+TEST(SampleRingBuffer, FrontFailsWhenChannelIsOutOfRange) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+
+  EXPECT_THAT(buffer.Front(kStereo, 1), Not(IsOk()));
+}
+
+TEST(SampleRingBuffer, FrontFailsWhenNotEnoughTicksAreQueued) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+
+  EXPECT_THAT(buffer.Front(0, 2), Not(IsOk()));
+}
+
+TEST(SampleRingBuffer, DropFrontDiscardsTicks) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+  EXPECT_THAT(buffer.PushBack({3, 4}), IsOk());
+
+  EXPECT_THAT(buffer.DropFront(1), IsOk());
+
+  PlanarSampleBuffer<int32_t> ticks;
+  EXPECT_THAT(buffer.PopFront(1, ticks), IsOk());
+  EXPECT_EQ(ticks.ToTimeChannel(), (std::vector<std::vector<int32_t>>{{3, 4}}));
+}
+
+TEST(SampleRingBuffer, DropFrontFailsWhenNotEnoughTicksAreQueued) {
+  SampleRingBuffer<int32_t> buffer(kStereo, kCapacity);
+  EXPECT_THAT(buffer.PushBack({1, 2}), IsOk());
+
+  EXPECT_THAT(buffer.DropFront(2), Not(IsOk()));
+  EXPECT_EQ(buffer.size(), 1);
+}
+
+}  // namespace
+}  // namespace iamf_tools
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/common/thread_pool.h"
+
+#include <atomic>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace iamf_tools {
+namespace {
+
+using ::testing::Each;
+
+constexpr int kNumTasks = 100;
+
+TEST(ThreadPool, ZeroWorkersRunsTasksOnCallingThread) {
+  ThreadPool thread_pool(0);
+  const auto calling_thread_id = std::this_thread::get_id();
+  std::thread::id task_thread_id;
+
+  thread_pool.Schedule(
+      [&task_thread_id] { task_thread_id = std::this_thread::get_id(); });
+
+  EXPECT_EQ(thread_pool.num_workers(), 0);
+  EXPECT_EQ(task_thread_id, calling_thread_id);
+}
+
+TEST(ThreadPool, NegativeWorkersRunsTasksOnCallingThread) {
+  ThreadPool thread_pool(-1);
+  bool task_ran = false;
+
+  thread_pool.Schedule([&task_ran] { task_ran = true; });
+
+  EXPECT_EQ(thread_pool.num_workers(), 0);
+  EXPECT_TRUE(task_ran);
+}
+
+TEST(ThreadPool, WaitBlocksUntilAllTasksFinish) {
+  ThreadPool thread_pool(4);
+  std::vector<int> results(kNumTasks, 0);
+
+  for (int i = 0; i < kNumTasks; i++) {
+    thread_pool.Schedule([&results, i] { results[i] = 1; });
+  }
+  thread_pool.Wait();
+
+  EXPECT_THAT(results, Each(1));
+}
+
+TEST(ThreadPool, CanBeReusedAfterWait) {
+  ThreadPool thread_pool(2);
+  std::atomic<int> num_tasks_run = 0;
+
+  for (int i = 0; i < kNumTasks; i++) {
+    thread_pool.Schedule([&num_tasks_run] { num_tasks_run++; });
+  }
+  thread_pool.Wait();
+  for (int i = 0; i < kNumTasks; i++) {
+    thread_pool.Schedule([&num_tasks_run] { num_tasks_run++; });
+  }
+  thread_pool.Wait();
+
+  EXPECT_EQ(num_tasks_run, 2 * kNumTasks);
+}
+
+TEST(ThreadPool, DestructorFinishesScheduledTasks) {
+  std::atomic<int> num_tasks_run = 0;
+  {
+    ThreadPool thread_pool(3);
+    for (int i = 0; i < kNumTasks; i++) {
+      thread_pool.Schedule([&num_tasks_run] { num_tasks_run++; });
+    }
+  }
+
+  EXPECT_EQ(num_tasks_run, kNumTasks);
+}
+
+}  // namespace
+}  // namespace iamf_tools
@@ -12,6 +12,9 @@
 #include <sys/types.h>
 
 #include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "fuzztest/fuzztest.h"
 #include "gtest/gtest.h"
@@ -123,5 +126,33 @@ void WriteIso14496_1Expanded(uint32_t data) {
 
 FUZZ_TEST(WriteBitBufferFuzzTest, WriteIso14496_1Expanded);
 
+void WriteUnsignedLiteralsMatchBitByBitReference(
+    const std::vector<std::pair<uint64_t, int>>& data_and_num_bits) {
+  WriteBitBuffer wb(0);
+  std::vector<uint8_t> expected_data;
+  int64_t expected_bit_offset = 0;
+  for (const auto& [data, num_bits] : data_and_num_bits) {
+    const uint64_t mask =
+        num_bits == 64 ? ~uint64_t{0} : (uint64_t{1} << num_bits) - 1;
+    ASSERT_TRUE(wb.WriteUnsignedLiteral64(data & mask, num_bits).ok());
+
+    // Append one bit at a time, most significant bit first.
+    for (int bit = num_bits - 1; bit >= 0; --bit, ++expected_bit_offset) {
+      if (expected_bit_offset % 8 == 0) {
+        expected_data.push_back(0);
+      }
+      expected_data.back() |= ((data >> bit) & 1)
+                              << (7 - expected_bit_offset % 8);
+    }
+  }
+
+  EXPECT_EQ(wb.bit_offset(), expected_bit_offset);
+  EXPECT_EQ(wb.bit_buffer(), expected_data);
+}
+
+FUZZ_TEST(WriteBitBufferFuzzTest, WriteUnsignedLiteralsMatchBitByBitReference)
+    .WithDomains(fuzztest::VectorOf(fuzztest::PairOf(
+        fuzztest::Arbitrary<uint64_t>(), fuzztest::InRange(0, 64))));
+
 }  // namespace
 }  // namespace iamf_tools
@@ -11,6 +11,7 @@
  */
 #include "iamf/common/write_bit_buffer.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -18,12 +19,14 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/status_matchers.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "iamf/cli/leb_generator.h"
@@ -329,6 +332,78 @@ TEST_F(WriteBitBufferTest, Uint8ArrayNotByteAligned) {
   ValidateWriteResults(*wb_, {0x7f, 0x80});
 }
 
+TEST_F(WriteBitBufferTest, Uint8SpanByteAligned) {
+  const std::vector<uint8_t> input = {0, 10, 20, 30, 255};
+
+  EXPECT_THAT(wb_->WriteUint8Span(absl::MakeConstSpan(input)), IsOk());
+  ValidateWriteResults(*wb_, input);
+}
+
+TEST_F(WriteBitBufferTest, Uint8SpanNotByteAligned) {
+  const std::vector<uint8_t> input = {0xff, 0x00};
+
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0, 1), IsOk());
+  EXPECT_THAT(wb_->WriteUint8Span(absl::MakeConstSpan(input)), IsOk());
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0, 7), IsOk());
+  ValidateWriteResults(*wb_, {0x7f, 0x80, 0x00});
+}
+
+TEST_F(WriteBitBufferTest, InsertUint8SpanShiftsLaterData) {
+  const std::vector<uint8_t> kHeader = {0xaa, 0xbb};
+  EXPECT_THAT(wb_->WriteUint8Vector({1, 2, 3}), IsOk());
+
+  EXPECT_THAT(wb_->InsertUint8Span(1, absl::MakeConstSpan(kHeader)), IsOk());
+
+  ValidateWriteResults(*wb_, {1, 0xaa, 0xbb, 2, 3});
+}
+
+TEST_F(WriteBitBufferTest, InsertUint8SpanBeforeUnalignedBits) {
+  const std::vector<uint8_t> kHeader = {0xaa};
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0x3, 2), IsOk());
+
+  EXPECT_THAT(wb_->InsertUint8Span(0, absl::MakeConstSpan(kHeader)), IsOk());
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0, 6), IsOk());
+
+  ValidateWriteResults(*wb_, {0xaa, 0xc0});
+}
+
+TEST_F(WriteBitBufferTest, InsertUint8SpanFailsWhenOffsetIsOutOfRange) {
+  const std::vector<uint8_t> kHeader = {0xaa};
+  EXPECT_THAT(wb_->WriteUint8Vector({1}), IsOk());
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0, 1), IsOk());
+
+  EXPECT_THAT(wb_->InsertUint8Span(-1, absl::MakeConstSpan(kHeader)),
+              StatusIs(kInvalidArgument));
+  EXPECT_THAT(wb_->InsertUint8Span(2, absl::MakeConstSpan(kHeader)),
+              StatusIs(kInvalidArgument));
+  EXPECT_EQ(wb_->bit_offset(), 9);
+}
+
+TEST_F(WriteBitBufferTest, TruncateDiscardsLaterData) {
+  EXPECT_THAT(wb_->WriteUint8Vector({1, 2, 3}), IsOk());
+
+  EXPECT_THAT(wb_->Truncate(8), IsOk());
+
+  ValidateWriteResults(*wb_, {1});
+}
+
+TEST_F(WriteBitBufferTest, TruncateClearsDiscardedBitsOfFinalByte) {
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0xff, 8), IsOk());
+
+  EXPECT_THAT(wb_->Truncate(3), IsOk());
+  EXPECT_THAT(wb_->WriteUnsignedLiteral(0, 5), IsOk());
+
+  ValidateWriteResults(*wb_, {0xe0});
+}
+
+TEST_F(WriteBitBufferTest, TruncateFailsWhenOffsetIsOutOfRange) {
+  EXPECT_THAT(wb_->WriteUint8Vector({1}), IsOk());
+
+  EXPECT_THAT(wb_->Truncate(-1), StatusIs(kInvalidArgument));
+  EXPECT_THAT(wb_->Truncate(9), StatusIs(kInvalidArgument));
+  EXPECT_EQ(wb_->bit_offset(), 8);
+}
+
 TEST_F(WriteBitBufferTest, WriteUleb128Min) {
   EXPECT_THAT(wb_->WriteUleb128(0), IsOk());
   ValidateWriteResults(*wb_, {0x00});
@@ -440,6 +515,53 @@ TEST_F(WriteBitBufferTest, ConsecutiveWrites) {
                         0x80, 0x01});
 }
 
+// Packs bits into bytes, most significant bit first, padding the final byte
+// with zeroes.
+std::vector<uint8_t> PackBits(const std::vector<bool>& bits) {
+  std::vector<uint8_t> bytes((bits.size() + 7) / 8, 0);
+  for (size_t i = 0; i < bits.size(); ++i) {
+    if (bits[i]) {
+      bytes[i / 8] |= 1 << (7 - i % 8);
+    }
+  }
+  return bytes;
+}
+
+TEST_F(WriteBitBufferTest, RandomWritesMatchBitByBitReference) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> num_bits_distribution(0, 64);
+  std::uniform_int_distribution<uint64_t> data_distribution;
+  std::uniform_int_distribution<int> byte_distribution(0, 255);
+  std::bernoulli_distribution write_vector_distribution(0.2);
+
+  // Mix literals of all sizes with byte vectors, at every alignment.
+  std::vector<bool> expected_bits;
+  for (int i = 0; i < 2000; ++i) {
+    if (write_vector_distribution(rng)) {
+      std::vector<uint8_t> data(byte_distribution(rng) % 10);
+      for (auto& byte : data) {
+        byte = byte_distribution(rng);
+        for (int bit = 7; bit >= 0; --bit) {
+          expected_bits.push_back((byte >> bit) & 1);
+        }
+      }
+      ASSERT_THAT(wb_->WriteUint8Vector(data), IsOk());
+    } else {
+      const int num_bits = num_bits_distribution(rng);
+      const uint64_t mask =
+          num_bits == 64 ? ~uint64_t{0} : (uint64_t{1} << num_bits) - 1;
+      const uint64_t data = data_distribution(rng) & mask;
+      for (int bit = num_bits - 1; bit >= 0; --bit) {
+        expected_bits.push_back((data >> bit) & 1);
+      }
+      ASSERT_THAT(wb_->WriteUnsignedLiteral64(data, num_bits), IsOk());
+    }
+    ASSERT_EQ(wb_->bit_offset(), expected_bits.size());
+  }
+
+  EXPECT_EQ(wb_->bit_buffer(), PackBits(expected_bits));
+}
+
 TEST_F(WriteBitBufferTest, UseAfterReset) {
   EXPECT_THAT(wb_->WriteUnsignedLiteral(0xabcd, 16), IsOk());
   ValidateWriteResults(*wb_, {0xab, 0xcd});
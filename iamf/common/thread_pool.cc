@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#include "iamf/common/thread_pool.h"
+
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/mutex.h"
+
+namespace iamf_tools {
+
+ThreadPool::ThreadPool(int num_workers) {
+  for (int i = 0; i < num_workers; i++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  Wait();
+  {
+    absl::MutexLock lock(&mutex_);
+    shutting_down_ = true;
+  }
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Schedule(absl::AnyInvocable<void()> task) {
+  if (workers_.empty()) {
+    std::move(task)();
+    return;
+  }
+
+  absl::MutexLock lock(&mutex_);
+  tasks_.push_back(std::move(task));
+  num_unfinished_tasks_++;
+}
+
+void ThreadPool::Wait() {
+  absl::MutexLock lock(&mutex_);
+  mutex_.Await(absl::Condition(this, &ThreadPool::AllTasksFinished));
+}
+
+bool ThreadPool::AllTasksFinished() const { return num_unfinished_tasks_ == 0; }
+
+bool ThreadPool::TaskAvailableOrShuttingDown() const {
+  return shutting_down_ || !tasks_.empty();
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    absl::AnyInvocable<void()> task;
+    {
+      absl::MutexLock lock(&mutex_);
+      mutex_.Await(
+          absl::Condition(this, &ThreadPool::TaskAvailableOrShuttingDown));
+      if (tasks_.empty()) {
+        // Only reachable when shutting down.
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    std::move(task)();
+
+    absl::MutexLock lock(&mutex_);
+    num_unfinished_tasks_--;
+  }
+}
+
+}  // namespace iamf_tools
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 3-Clause Clear License
+ * and the Alliance for Open Media Patent License 1.0. If the BSD 3-Clause Clear
+ * License was not distributed with this source code in the LICENSE file, you
+ * can obtain it at www.aomedia.org/license/software-license/bsd-3-c-c. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * www.aomedia.org/license/patent.
+ */
+#ifndef COMMON_THREAD_POOL_H_
+#define COMMON_THREAD_POOL_H_
+
+#include <deque>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/mutex.h"
+
+namespace iamf_tools {
+
+/*!\brief A fixed-size pool of worker threads.
+ *
+ * Tasks are started in the order they are scheduled, but may finish in any
+ * order. A pool with no workers runs each task on the calling thread inside
+ * `Schedule()`.
+ *
+ * The use pattern of this class is:
+ *   - Schedule any number of independent tasks (`Schedule()`).
+ *   - Wait for all of them to finish (`Wait()`).
+ */
+class ThreadPool {
+ public:
+  /*!\brief Constructor.
+   *
+   * \param num_workers Number of worker threads. Non-positive values create a
+   *        pool which runs tasks on the calling thread.
+   */
+  explicit ThreadPool(int num_workers);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /*!\brief Destructor.
+   *
+   * Waits for all scheduled tasks to finish before joining the workers.
+   */
+  ~ThreadPool();
+
+  /*!\brief Schedules a task to run on one of the workers.
+   *
+   * \param task Task to run.
+   */
+  void Schedule(absl::AnyInvocable<void()> task);
+
+  /*!\brief Blocks until all scheduled tasks have finished.*/
+  void Wait();
+
+  /*!\brief Gets the number of worker threads.
+   *
+   * \return Number of worker threads.
+   */
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  /*!\brief Runs tasks until the pool is destroyed.*/
+  void WorkerLoop();
+
+  bool AllTasksFinished() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  bool TaskAvailableOrShuttingDown() const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable absl::Mutex mutex_;
+  std::deque<absl::AnyInvocable<void()>> tasks_ ABSL_GUARDED_BY(mutex_);
+  // Number of tasks which are scheduled but have not yet finished.
+  int num_unfinished_tasks_ ABSL_GUARDED_BY(mutex_) = 0;
+  bool shutting_down_ ABSL_GUARDED_BY(mutex_) = false;
+
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace iamf_tools
+
+#endif  // COMMON_THREAD_POOL_H_
@@ -14,7 +14,6 @@
 #include <algorithm>
 #include <cstdint>
 #include <fstream>
-#include <iterator>
 #include <optional>
 #include <string>
 #include <vector>
@@ -22,6 +21,7 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 #include "iamf/cli/leb_generator.h"
 #include "iamf/common/bit_buffer_util.h"
 #include "iamf/common/macros.h"
@@ -31,44 +31,6 @@ namespace iamf_tools {
 
 namespace {
 
-void MaybeResizeBufferToFitNumBits(int num_bits, int64_t bit_offset,
-                                   std::vector<uint8_t>& bit_buffer) {
-  const int64_t size = static_cast<int64_t>(bit_buffer.size());
-  if (bit_offset + num_bits <= size * 8) {
-    return;
-  }
-
-  const int64_t required_bytes = ((bit_offset + num_bits) / 8) +
-                                 ((bit_offset + num_bits) % 8 == 0 ? 0 : 1);
-
-  // Adjust the size of the buffer.
-  bit_buffer.resize(required_bytes, 0);
-}
-
-// Write one bit to the buffer using an AND or OR mask. All unwritten bits are
-// unchanged. This function is designed to work even if the buffer has
-// uninitialized data.
-absl::Status WriteBit(int bit, int64_t& bit_offset,
-                      std::vector<uint8_t>& bit_buffer) {
-  if (bit_offset < 0) {
-    return absl::InvalidArgumentError("The bit offset should not be negative.");
-  }
-  const int64_t off = bit_offset;
-  const int64_t p = off >> 3;
-  const int q = 7 - static_cast<int>(off & 0x7);
-
-  if (bit == 0) {
-    // AND mask to set the target bit to 0 and leave others unchanged.
-    bit_buffer[p] &= ~(1 << q);
-  } else {
-    // OR mask to set the target bit to 1 and leave others unchanged.
-    bit_buffer[p] |= (1 << q);
-  }
-  bit_offset = off + 1;
-
-  return absl::OkStatus();
-}
-
 // A helper function to write out n = `num_bits` bits to the buffer. These
 // are the lower n bits of uint64_t `data`. n must be <= 64.
 absl::Status InternalWriteUnsigned(int max_bits, uint64_t data, int num_bits,
@@ -103,22 +65,32 @@ absl::Status InternalWriteUnsigned(int max_bits, uint64_t data, int num_bits,
                      num_bits, " data= ", data));
   }
 
-  // Expand the buffer and pad the input data with zeroes.
-  MaybeResizeBufferToFitNumBits(num_bits, bit_offset, bit_buffer);
+  if (bit_offset < 0) {
+    return absl::InvalidArgumentError("The bit offset should not be negative.");
+  }
 
-  if (bit_offset % 8 == 0 && num_bits % 8 == 0) {
-    // Short-circuit the common case of writing a byte-aligned input to a
-    // byte-aligned output. Copy one byte at a time.
-    for (int byte = (num_bits / 8) - 1; byte >= 0; byte--) {
-      bit_buffer[bit_offset / 8] = (data >> (byte * 8)) & 0xff;
-      bit_offset += 8;
-    }
-  } else {
-    // The input and/or output are not byte-aligned. Write one bit at
-    // a time.
-    for (int bit = num_bits - 1; bit >= 0; bit--) {
-      RETURN_IF_NOT_OK(WriteBit((data >> bit) & 1, bit_offset, bit_buffer));
-    }
+  // The buffer holds exactly the bytes touched so far, and any bits after
+  // `bit_offset` in the final byte are zero. Complete the final byte first,
+  // then append the remaining bits as whole bytes. Appending grows the buffer
+  // geometrically.
+  const int num_bits_in_final_byte = static_cast<int>(bit_offset % 8);
+  if (num_bits_in_final_byte != 0) {
+    const int num_bits_to_fill =
+        std::min(8 - num_bits_in_final_byte, num_bits);
+    num_bits -= num_bits_to_fill;
+    bit_buffer.back() |= static_cast<uint8_t>(
+        (data >> num_bits) << (8 - num_bits_in_final_byte - num_bits_to_fill));
+    bit_offset += num_bits_to_fill;
+  }
+  while (num_bits >= 8) {
+    num_bits -= 8;
+    bit_buffer.push_back(static_cast<uint8_t>(data >> num_bits));
+    bit_offset += 8;
+  }
+  if (num_bits > 0) {
+    const uint64_t final_bits = data & ((uint64_t{1} << num_bits) - 1);
+    bit_buffer.push_back(static_cast<uint8_t>(final_bits << (8 - num_bits)));
+    bit_offset += num_bits;
   }
 
   return absl::OkStatus();
@@ -233,19 +205,18 @@ absl::Status WriteBitBuffer::WriteIso14496_1Expanded(
 
 absl::Status WriteBitBuffer::WriteUint8Vector(
     const std::vector<uint8_t>& data) {
+  return WriteUint8Span(absl::MakeConstSpan(data));
+}
+
+absl::Status WriteBitBuffer::WriteUint8Span(absl::Span<const uint8_t> data) {
   if (IsByteAligned()) {
     // In the common case we can just copy all of the data over and update
     // `bit_offset_`.
-    bit_buffer_.reserve(bit_buffer_.size() + data.size());
-    std::copy(data.begin(), data.end(), std::back_inserter(bit_buffer_));
+    bit_buffer_.insert(bit_buffer_.end(), data.begin(), data.end());
     bit_offset_ += 8 * data.size();
     return absl::OkStatus();
   }
 
-  // Expand the buffer to fit the data for efficiency when processing large
-  // input.
-  RETURN_IF_NOT_OK(CanWriteBytes(true, data.size(), bit_offset_, bit_buffer_));
-
   // The buffer is mis-aligned. Copy it over one byte at a time.
   for (const uint8_t& value : data) {
     RETURN_IF_NOT_OK(WriteUnsignedLiteral(value, 8));
@@ -253,6 +224,36 @@ absl::Status WriteBitBuffer::WriteUint8Vector(
   return absl::OkStatus();
 }
 
+absl::Status WriteBitBuffer::InsertUint8Span(int64_t byte_offset,
+                                             absl::Span<const uint8_t> data) {
+  if (byte_offset < 0 || byte_offset > bit_offset_ / 8) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Cannot insert at byte_offset= ", byte_offset,
+                     " with bit_offset= ", bit_offset_));
+  }
+  bit_buffer_.insert(bit_buffer_.begin() + byte_offset, data.begin(),
+                     data.end());
+  bit_offset_ += 8 * data.size();
+  return absl::OkStatus();
+}
+
+absl::Status WriteBitBuffer::Truncate(int64_t bit_offset) {
+  if (bit_offset < 0 || bit_offset > bit_offset_) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Cannot truncate to bit_offset= ", bit_offset,
+                     " with bit_offset= ", bit_offset_));
+  }
+  bit_buffer_.resize((bit_offset + 7) / 8);
+  const int num_bits_in_final_byte = bit_offset % 8;
+  if (num_bits_in_final_byte != 0) {
+    // Keep the invariant that bits after `bit_offset_` are zero.
+    bit_buffer_.back() &=
+        static_cast<uint8_t>(0xff << (8 - num_bits_in_final_byte));
+  }
+  bit_offset_ = bit_offset;
+  return absl::OkStatus();
+}
+
 absl::Status WriteBitBuffer::FlushAndWriteToFile(
     std::optional<std::fstream>& output_file) {
   if (!IsByteAligned()) {
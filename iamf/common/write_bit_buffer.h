@@ -19,12 +19,17 @@
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/types/span.h"
 #include "iamf/cli/leb_generator.h"
 #include "iamf/obu/types.h"
 
 namespace iamf_tools {
 
-/*!\brief Holds a buffer and tracks the next bit to be written to. */
+/*!\brief Holds a buffer and tracks the next bit to be written to.
+ *
+ * Unaligned bits are accumulated in the final byte of the buffer, and whole
+ * bytes are appended at once.
+ */
 class WriteBitBuffer {
  public:
   /*!\brief Constructor.
@@ -94,6 +99,39 @@ class WriteBitBuffer {
    */
   absl::Status WriteUint8Vector(const std::vector<uint8_t>& data);
 
+  /*!\brief Writes a span of `uint8_t` to the write buffer.
+   *
+   * \param data Data to write.
+   * \return `absl::OkStatus()` on success. `absl::UnknownError()` if the
+   *         `wb->bit_offset` is negative.
+   */
+  absl::Status WriteUint8Span(absl::Span<const uint8_t> data);
+
+  /*!\brief Inserts bytes at a byte-aligned position in the buffer.
+   *
+   * Data already written after the position is shifted back. Useful to write a
+   * header in front of data whose size was not known ahead of time.
+   *
+   * \param byte_offset Offset in bytes to insert at. Must not be after the
+   *        last whole byte in the buffer.
+   * \param data Data to insert.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         `byte_offset` is out of range.
+   */
+  absl::Status InsertUint8Span(int64_t byte_offset,
+                               absl::Span<const uint8_t> data);
+
+  /*!\brief Discards all data written after a position in the buffer.
+   *
+   * Useful to roll back a partial write after an error.
+   *
+   * \param bit_offset Offset in bits to truncate to. Must not be after the
+   *        current `bit_offset()`.
+   * \return `absl::OkStatus()` on success. `absl::InvalidArgumentError()` if
+   *         `bit_offset` is out of range.
+   */
+  absl::Status Truncate(int64_t bit_offset);
+
   /*!\brief Writes a ULEB128 to the buffer using an implicit generator.
    *
    * \param data Data to write using the member `leb_generator_`.
@@ -158,6 +196,7 @@ class WriteBitBuffer {
   LebGenerator leb_generator_;
 
  private:
+  // Holds `ceil(bit_offset_ / 8)` bytes. Bits after `bit_offset_` are zero.
   std::vector<uint8_t> bit_buffer_;
   int64_t bit_offset_;
 };
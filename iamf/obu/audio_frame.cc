@@ -12,12 +12,14 @@
 #include "iamf/obu/audio_frame.h"
 
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/types/span.h"
+#include "iamf/cli/leb_generator.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/read_bit_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
@@ -56,17 +58,46 @@ absl::StatusOr<AudioFrameObu> AudioFrameObu::CreateFromBuffer(
   return audio_frame_obu;
 }
 
+absl::Status AudioFrameObu::ValidateAndWriteObuPrefix(
+    WriteBitBuffer& wb) const {
+  const std::optional<int64_t> payload_size =
+      GetPayloadSize(wb.leb_generator_);
+  if (!payload_size.has_value()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Failed to generate a uleb128 for substream_id= ",
+                     audio_substream_id_));
+  }
+  RETURN_IF_NOT_OK(header_.ValidateAndWrite(
+      *payload_size + static_cast<int64_t>(footer_.size()), wb));
+  if (header_.obu_type == kObuIaAudioFrame) {
+    RETURN_IF_NOT_OK(wb.WriteUleb128(audio_substream_id_));
+  }
+  return absl::OkStatus();
+}
+
 absl::Status AudioFrameObu::ValidateAndWritePayload(WriteBitBuffer& wb) const {
   if (header_.obu_type == kObuIaAudioFrame) {
     // The ID is explicitly in the bitstream when `kObuIaAudioFrame`. Otherwise
     // it is implied by `obu_type`.
     RETURN_IF_NOT_OK(wb.WriteUleb128(audio_substream_id_));
   }
-  RETURN_IF_NOT_OK(wb.WriteUint8Vector(audio_frame_));
+  RETURN_IF_NOT_OK(wb.WriteUint8Span(absl::MakeConstSpan(audio_frame_)));
 
   return absl::OkStatus();
 }
 
+std::optional<int64_t> AudioFrameObu::GetPayloadSize(
+    const LebGenerator& leb_generator) const {
+  int8_t substream_id_size = 0;
+  if (header_.obu_type == kObuIaAudioFrame &&
+      !leb_generator.GetUleb128Size(audio_substream_id_, substream_id_size)
+           .ok()) {
+    // Let `ValidateAndWritePayload` report the error.
+    return std::nullopt;
+  }
+  return substream_id_size + static_cast<int64_t>(audio_frame_.size());
+}
+
 absl::Status AudioFrameObu::ReadAndValidatePayloadDerived(int64_t payload_size,
                                                           ReadBitBuffer& rb) {
   int8_t encoded_uleb128_size = 0;
@@ -13,11 +13,13 @@
 #define OBU_AUDIO_FRAME_H_
 
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/types/span.h"
+#include "iamf/cli/leb_generator.h"
 #include "iamf/common/read_bit_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/obu_base.h"
@@ -73,6 +75,18 @@ class AudioFrameObu : public ObuBase {
   /*!\brief Prints logging information about the OBU.*/
   void PrintObu() const override;
 
+  /*!\brief Validates and writes the OBU up to, but excluding, the frame.
+   *
+   * Writing `audio_frame_` and then `footer_` directly after the prefix
+   * produces the same bytes as `ValidateAndWriteObu()`. This lets callers
+   * output large audio frames by reference instead of copying them.
+   *
+   * \param wb Buffer to write to.
+   * \return `absl::OkStatus()` if the OBU is valid. A specific status on
+   *         failure.
+   */
+  absl::Status ValidateAndWriteObuPrefix(WriteBitBuffer& wb) const;
+
   /*!\brief Gets the substream ID of the OBU.
    * \return Substream ID.
    */
@@ -97,6 +111,15 @@ class AudioFrameObu : public ObuBase {
    */
   absl::Status ValidateAndWritePayload(WriteBitBuffer& wb) const override;
 
+  /*!\brief Gets the size of the OBU payload.
+   *
+   * \param leb_generator `LebGenerator` the payload will be written with.
+   * \return Size of the payload in bytes. `std::nullopt` if the substream ID
+   *         cannot be represented by `leb_generator`.
+   */
+  std::optional<int64_t> GetPayloadSize(
+      const LebGenerator& leb_generator) const override;
+
   /*!\brief Reads the OBU payload from the buffer.
    *
    * \param payload_size Size of the obu payload in bytes.
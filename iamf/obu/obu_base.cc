@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -27,44 +28,91 @@
 
 namespace iamf_tools {
 
-ObuBase::~ObuBase() {}
+namespace {
 
-absl::Status ObuBase::ValidateAndWriteObu(WriteBitBuffer& final_wb) const {
-  // Allocate a temporary buffer big enough for most OBUs to assist writing, but
-  // make it resizable so it can be expanded for large OBUs.
-  static const int64_t kBufferSize = 1024;
-  WriteBitBuffer temp_wb(kBufferSize, final_wb.leb_generator_);
-
-  // Write the payload to a temporary buffer using the virtual function.
-  RETURN_IF_NOT_OK(ValidateAndWritePayload(temp_wb));
-  // Write the footer to the temporary buffer.
-  RETURN_IF_NOT_OK(temp_wb.WriteUint8Vector(footer_));
-  if (!temp_wb.IsByteAligned()) {
-    // The header stores the size of the OBU in bytes.
+absl::Status ValidateEndOfPayload(int64_t expected_end_payload,
+                                  const WriteBitBuffer& wb) {
+  // Validate the write buffer is at the expected location expected after
+  // writing the payload.
+  if (expected_end_payload != wb.bit_offset()) {
     return absl::InvalidArgumentError(absl::StrCat(
-        "Expected the OBU payload to be byte-aligned: ", temp_wb.bit_offset()));
+        "Expected end_payload: ", expected_end_payload,
+        " to be equal to write buffer bit offset: ", wb.bit_offset()));
   }
+  return absl::OkStatus();
+}
 
-  // Write the header now that the payload size is known.
-  const int64_t payload_size_bytes = temp_wb.bit_buffer().size();
+}  // namespace
 
-  RETURN_IF_NOT_OK(header_.ValidateAndWrite(payload_size_bytes, final_wb));
+ObuBase::~ObuBase() {}
 
-  const int64_t expected_end_payload =
-      final_wb.bit_offset() + payload_size_bytes * 8;
+absl::Status ObuBase::ValidateAndWriteObu(WriteBitBuffer& final_wb) const {
+  const int64_t start_bit_offset = final_wb.bit_offset();
+  const absl::Status status = WriteObu(final_wb);
+  if (!status.ok()) {
+    // Roll back, so the caller never sees a partial OBU.
+    RETURN_IF_NOT_OK(final_wb.Truncate(start_bit_offset));
+  }
+  return status;
+}
 
-  // Copy over the payload into the final write buffer.
-  RETURN_IF_NOT_OK(final_wb.WriteUint8Vector(temp_wb.bit_buffer()));
+absl::Status ObuBase::WriteObu(WriteBitBuffer& final_wb) const {
+  const int64_t header_start_bit_offset = final_wb.bit_offset();
+  const std::optional<int64_t> payload_size_bytes =
+      GetPayloadSize(final_wb.leb_generator_);
+  if (payload_size_bytes.has_value()) {
+    // The size is known up front. Write the header, then write the payload
+    // straight after it.
+    const int64_t obu_payload_size_bytes =
+        *payload_size_bytes + static_cast<int64_t>(footer_.size());
+    RETURN_IF_NOT_OK(header_.ValidateAndWrite(obu_payload_size_bytes, final_wb));
+    const int64_t payload_start_bit_offset = final_wb.bit_offset();
+    RETURN_IF_NOT_OK(ValidateAndWritePayload(final_wb));
+    RETURN_IF_NOT_OK(final_wb.WriteUint8Span(absl::MakeConstSpan(footer_)));
+    return ValidateEndOfPayload(
+        payload_start_bit_offset + obu_payload_size_bytes * 8, final_wb);
+  }
 
-  // Validate the write buffer is at the expected location expected after
-  // writing the payload.
-  if (expected_end_payload != final_wb.bit_offset()) {
+  // Otherwise write the payload into the final buffer, then insert the header
+  // in front of it once the size is known.
+  if (!final_wb.IsByteAligned()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Expected OBUs to start byte-aligned: ",
+                     header_start_bit_offset));
+  }
+  RETURN_IF_NOT_OK(ValidateAndWritePayload(final_wb));
+  RETURN_IF_NOT_OK(final_wb.WriteUint8Span(absl::MakeConstSpan(footer_)));
+  if (!final_wb.IsByteAligned()) {
+    // The header stores the size of the OBU in bytes.
     return absl::InvalidArgumentError(absl::StrCat(
-        "Expected end_payload: ", expected_end_payload,
-        " to be equal to write buffer bit offset: ", final_wb.bit_offset()));
+        "Expected the OBU payload to be byte-aligned: ",
+        final_wb.bit_offset() - header_start_bit_offset));
+  }
+  const int64_t obu_payload_size_bytes =
+      (final_wb.bit_offset() - header_start_bit_offset) / 8;
+
+  // OBU headers are small, so the temporary buffer rarely needs to grow.
+  static const int64_t kHeaderBufferSize = 16;
+  WriteBitBuffer header_wb(kHeaderBufferSize, final_wb.leb_generator_);
+  RETURN_IF_NOT_OK(header_.ValidateAndWrite(obu_payload_size_bytes, header_wb));
+  if (!header_wb.IsByteAligned()) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Expected the OBU header to be byte-aligned: ", header_wb.bit_offset()));
   }
+  const int64_t header_size_bytes = header_wb.bit_offset() / 8;
+  RETURN_IF_NOT_OK(
+      final_wb.InsertUint8Span(header_start_bit_offset / 8,
+                               absl::MakeConstSpan(header_wb.bit_buffer())));
+
+  return ValidateEndOfPayload(
+      header_start_bit_offset +
+          (header_size_bytes + obu_payload_size_bytes) * 8,
+      final_wb);
+}
 
-  return absl::OkStatus();
+std::optional<int64_t> ObuBase::GetPayloadSize(
+    const LebGenerator& /*leb_generator*/) const {
+  return std::nullopt;
 }
 
 absl::Status ObuBase::ReadAndValidatePayload(int64_t payload_size_bytes,
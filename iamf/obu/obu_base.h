@@ -14,9 +14,11 @@
 #define OBU_OBU_BASE_H_
 
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "iamf/cli/leb_generator.h"
 #include "iamf/common/read_bit_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
 #include "iamf/obu/obu_header.h"
@@ -48,7 +50,8 @@ class ObuBase {
 
   /*!\brief Validates and writes an entire OBU to the buffer.
    *
-   * \param final_wb Buffer to write to.
+   * \param final_wb Buffer to write to. On failure anything partially written
+   *        is discarded, so the buffer is left as it was.
    * \return `absl::OkStatus()` if the OBU is valid. A specific status on
    *         failure.
    */
@@ -82,6 +85,19 @@ class ObuBase {
    */
   virtual absl::Status ValidateAndWritePayload(WriteBitBuffer& wb) const = 0;
 
+  /*!\brief Gets the size of the OBU payload without writing it.
+   *
+   * When the size is known the header is written first and the payload is
+   * written directly after it. Otherwise the payload is written first and the
+   * header is inserted in front of it.
+   *
+   * \param leb_generator `LebGenerator` the payload will be written with.
+   * \return Size of the payload in bytes, excluding `footer_`. `std::nullopt`
+   *         if the size is not known until the payload is written.
+   */
+  virtual std::optional<int64_t> GetPayloadSize(
+      const LebGenerator& leb_generator) const;
+
   /*!\brief Reads the entire OBU payload from the buffer.
    *
    * This includes reading in any extra bytes signalled by `obu_size`, but not
@@ -101,6 +117,14 @@ class ObuBase {
   void PrintHeader(int64_t payload_size) const;
 
  private:
+  /*!\brief Writes an entire OBU to the buffer.
+   *
+   * \param final_wb Buffer to write to. May hold a partial OBU on failure.
+   * \return `absl::OkStatus()` if the OBU is valid. A specific status on
+   *         failure.
+   */
+  absl::Status WriteObu(WriteBitBuffer& final_wb) const;
+
   /*!\brief Reads the known OBU payload from the buffer.
    *
    * Implementations of this function MAY omit reading any bytes not known -
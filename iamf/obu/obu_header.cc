@@ -145,9 +145,9 @@ absl::Status GetSizeOfEncodedLeb128(const LebGenerator& leb_generator,
                                     DecodedUleb128 leb128, size_t& size) {
   // Calculate how many bytes `obu_size` will take up based on the current leb
   // generator.
-  WriteBitBuffer temp_wb_obu_size_only(8, leb_generator);
-  RETURN_IF_NOT_OK(temp_wb_obu_size_only.WriteUleb128(leb128));
-  size = temp_wb_obu_size_only.bit_buffer().size();
+  int8_t leb128_size = 0;
+  RETURN_IF_NOT_OK(leb_generator.GetUleb128Size(leb128, leb128_size));
+  size = static_cast<size_t>(leb128_size);
   return absl::OkStatus();
 }
 
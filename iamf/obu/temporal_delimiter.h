@@ -13,9 +13,11 @@
 #define OBU_TEMPORAL_DELIMITER_H_
 
 #include <cstdint>
+#include <optional>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "iamf/cli/leb_generator.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/read_bit_buffer.h"
 #include "iamf/common/write_bit_buffer.h"
@@ -70,6 +72,15 @@ class TemporalDelimiterObu : public ObuBase {
     return absl::OkStatus();
   }
 
+  /*!\brief Gets the size of the OBU payload.
+   *
+   * \return Zero always.
+   */
+  std::optional<int64_t> GetPayloadSize(
+      const LebGenerator& /*leb_generator*/) const override {
+    return 0;
+  }
+
   /*!\brief Reads the OBU payload from the buffer.
    *
    * \param rb Buffer to read from.
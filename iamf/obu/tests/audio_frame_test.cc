@@ -291,6 +291,38 @@ TEST_F(AudioFrameObuTest, ValidateAndWriteObuFailsWithIllegalRedundantCopy) {
   EXPECT_FALSE(obu_->ValidateAndWriteObu(unused_wb).ok());
 }
 
+void ExpectPrefixAndFrameMatchEntireObu(const AudioFrameObu& obu) {
+  WriteBitBuffer expected_wb(0);
+  ASSERT_THAT(obu.ValidateAndWriteObu(expected_wb), IsOk());
+
+  WriteBitBuffer wb(0);
+  EXPECT_THAT(obu.ValidateAndWriteObuPrefix(wb), IsOk());
+  EXPECT_THAT(wb.WriteUint8Span(absl::MakeConstSpan(obu.audio_frame_)), IsOk());
+  EXPECT_THAT(wb.WriteUint8Span(absl::MakeConstSpan(obu.footer_)), IsOk());
+
+  EXPECT_EQ(wb.bit_buffer(), expected_wb.bit_buffer());
+}
+
+TEST(ValidateAndWriteObuPrefix, MatchesObuWithImplicitSubstreamId) {
+  ExpectPrefixAndFrameMatchEntireObu(
+      AudioFrameObu(ObuHeader(), /*substream_id=*/0, {1, 2, 3}));
+}
+
+TEST(ValidateAndWriteObuPrefix, MatchesObuWithExplicitSubstreamIdAndFooter) {
+  AudioFrameObu obu(ObuHeader(), /*substream_id=*/1000, {1, 2, 3});
+  obu.footer_ = {4, 5};
+
+  ExpectPrefixAndFrameMatchEntireObu(obu);
+}
+
+TEST(ValidateAndWriteObuPrefix, FailsWithIllegalRedundantCopy) {
+  const AudioFrameObu obu(ObuHeader{.obu_redundant_copy = true},
+                          /*substream_id=*/0, {1, 2, 3});
+
+  WriteBitBuffer unused_wb(0);
+  EXPECT_FALSE(obu.ValidateAndWriteObuPrefix(unused_wb).ok());
+}
+
 // --- Begin CreateFromBuffer tests ---
 TEST(CreateFromBuffer, ValidAudioFrameWithExplicitId) {
   std::vector<uint8_t> source = {// `explicit_audio_substream_id`, arbitrary.
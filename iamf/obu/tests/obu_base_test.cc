@@ -13,6 +13,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -21,6 +22,7 @@
 #include "absl/types/span.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "iamf/cli/leb_generator.h"
 #include "iamf/common/macros.h"
 #include "iamf/common/read_bit_buffer.h"
 #include "iamf/common/tests/test_utils.h"
@@ -66,6 +68,16 @@ TEST(ObuBaseTest, ObuSizeImpliesValidateAndWritePayloadMustWriteIntegerBytes) {
             absl::StatusCode::kInvalidArgument);
 }
 
+TEST(ObuBaseTest, DiscardsPartialObuWhenPayloadIsInvalid) {
+  const ImaginaryObuNonIntegerBytes obu;
+  WriteBitBuffer wb(1024);
+  ASSERT_THAT(wb.WriteUint8Vector({'a', 'b'}), IsOk());
+
+  EXPECT_FALSE(obu.ValidateAndWriteObu(wb).ok());
+
+  ValidateWriteResults(wb, {'a', 'b'});
+}
+
 TEST(ObuBaseTest, InvalidWhenValidatePayloadDerivedDoesNotReadIntegerBytes) {
   const ImaginaryObuNonIntegerBytes obu;
 
@@ -152,6 +164,101 @@ TEST(ObuBaseTest, WritesObuFooterAndConsistentObuSize) {
                           {255, 'f', 'o', 'o', 't', 'e', 'r'});
 }
 
+TEST(ObuBaseTest, WritesAfterExistingData) {
+  const OneByteObu obu;
+  WriteBitBuffer wb(1024);
+  ASSERT_THAT(wb.WriteUint8Vector({'a', 'b'}), IsOk());
+
+  EXPECT_THAT(obu.ValidateAndWriteObu(wb), IsOk());
+
+  ValidateWriteResults(wb, {'a', 'b', kObuIaReserved24 << 3, 1, 255});
+}
+
+TEST(ObuBaseTest, InvalidWhenWritingObuWithUnknownSizeAtUnalignedOffset) {
+  const OneByteObu obu;
+  WriteBitBuffer wb(1024);
+  ASSERT_THAT(wb.WriteUnsignedLiteral(0, 1), IsOk());
+
+  EXPECT_FALSE(obu.ValidateAndWriteObu(wb).ok());
+}
+
+// A simple OBU with a constant payload of a known size.
+class KnownSizeObu : public ObuBase {
+ public:
+  explicit KnownSizeObu(const std::vector<uint8_t>& payload,
+                        int64_t reported_payload_size)
+      : ObuBase(kObuIaReserved24),
+        payload_(payload),
+        reported_payload_size_(reported_payload_size) {}
+  ~KnownSizeObu() override = default;
+  void PrintObu() const override {}
+
+ private:
+  absl::Status ValidateAndWritePayload(WriteBitBuffer& wb) const override {
+    return wb.WriteUint8Vector(payload_);
+  }
+
+  std::optional<int64_t> GetPayloadSize(
+      const LebGenerator& /*leb_generator*/) const override {
+    return reported_payload_size_;
+  }
+
+  absl::Status ReadAndValidatePayloadDerived(int64_t /*payload_size*/,
+                                             ReadBitBuffer& /*rb*/) override {
+    return absl::OkStatus();
+  }
+
+  std::vector<uint8_t> payload_;
+  int64_t reported_payload_size_;
+};
+
+TEST(ObuBaseTest, WritesObuWithKnownSize) {
+  KnownSizeObu obu({1, 2, 3}, 3);
+  obu.footer_ = {'f'};
+
+  WriteBitBuffer wb(1024);
+  EXPECT_THAT(obu.ValidateAndWriteObu(wb), IsOk());
+
+  ValidateObuWriteResults(wb,
+                          {kObuIaReserved24 << 3,
+                           // `obu_size`.
+                           4},
+                          {1, 2, 3, 'f'});
+}
+
+TEST(ObuBaseTest, WritesObuWithKnownSizeAtUnalignedOffset) {
+  const KnownSizeObu obu({0xff}, 1);
+  WriteBitBuffer wb(1024);
+  ASSERT_THAT(wb.WriteUnsignedLiteral(0, 4), IsOk());
+
+  EXPECT_THAT(obu.ValidateAndWriteObu(wb), IsOk());
+  ASSERT_THAT(wb.WriteUnsignedLiteral(0, 4), IsOk());
+
+  // The OBU is shifted by four bits: `obu_type`, `obu_size` and the payload.
+  ValidateWriteResults(wb, {(kObuIaReserved24 << 3) >> 4,
+                            (kObuIaReserved24 << 3) << 4 & 0xff, 0x1f, 0xf0});
+}
+
+TEST(ObuBaseTest, InvalidWhenKnownSizeDisagreesWithPayload) {
+  const KnownSizeObu obu({1, 2, 3}, 2);
+
+  WriteBitBuffer wb(1024);
+  EXPECT_FALSE(obu.ValidateAndWriteObu(wb).ok());
+}
+
+TEST(ObuBaseTest, DiscardsPartialObuWhenKnownSizeDisagreesWithPayload) {
+  const KnownSizeObu obu({1, 2, 3}, 2);
+  WriteBitBuffer wb(1024);
+  ASSERT_THAT(wb.WriteUnsignedLiteral(0xf, 4), IsOk());
+
+  EXPECT_FALSE(obu.ValidateAndWriteObu(wb).ok());
+
+  // The buffer is restored, including the bits of the partially written byte.
+  EXPECT_EQ(wb.bit_offset(), 4);
+  ASSERT_THAT(wb.WriteUnsignedLiteral(0, 4), IsOk());
+  ValidateWriteResults(wb, {0xf0});
+}
+
 TEST(ObuBaseTest, ReadWithConsistentSize) {
   std::vector<uint8_t> source_data = {kObuIaReserved24 << 3, 1, 255};
   auto rb = MemoryBasedReadBitBuffer::CreateFromSpan(
@@ -36,6 +36,13 @@ typedef int32_t DecodedSleb128;
  */
 typedef double InternalSampleType;
 
+/*!\brief Type of timestamps for internal computation.
+ *
+ * Measured in ticks since the start of the IA Sequence. 64-bit so that
+ * timestamps do not overflow for long-running or continuous streams.
+ */
+typedef int64_t InternalTimestamp;
+
 }  // namespace iamf_tools
 
 #endif  // OBU_LEB128_H_